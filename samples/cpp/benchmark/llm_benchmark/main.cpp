@@ -0,0 +1,300 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+// clang-format off
+#include "openvino/openvino.hpp"
+
+#include "samples/common.hpp"
+#include "samples/latency_metrics.hpp"
+#include "samples/slog.hpp"
+// clang-format on
+
+using Ms = std::chrono::duration<double, std::ratio<1, 1000>>;
+
+namespace {
+// The length is either a number or a MIN:MAX range, in which the lengths of the sequences are uniformly distributed
+struct LengthRange {
+    size_t min;
+    size_t max;
+};
+
+LengthRange parse_length(const std::string& str) {
+    const auto pos = str.find(':');
+    LengthRange range;
+    range.min = std::stoul(str.substr(0, pos));
+    range.max = pos == std::string::npos ? range.min : std::stoul(str.substr(pos + 1));
+    if (range.min == 0 || range.max < range.min) {
+        throw std::invalid_argument("Invalid length " + str + ", expected N or MIN:MAX with 0 < MIN <= MAX");
+    }
+    return range;
+}
+
+// The resident memory of the process in MB, negative if it is unknown
+double get_rss_mb() {
+#ifdef __linux__
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, 6, "VmRSS:") == 0) {
+            return std::stod(line.substr(6)) / 1024;
+        }
+    }
+#endif
+    return -1;
+}
+
+std::string rss_to_string(double rss) {
+    return rss < 0 ? "n/a" : double_to_string(rss) + " MB";
+}
+
+struct SequenceStats {
+    double ttft = 0;  // from the start of the sequence to the first generated token
+    // the latencies of the following tokens and the context lengths they are generated with
+    std::vector<std::pair<size_t, double>> itl;
+};
+
+// Runs the prefill and the greedy decode of one sequence at a time on a stateful decoder model, i.e. the model
+// keeping the KV-cache in its states and taking only the new tokens
+class Generator {
+public:
+    explicit Generator(ov::InferRequest request) : m_request(std::move(request)) {
+        if (m_request.query_state().empty()) {
+            throw std::logic_error("The model has no states, the benchmark expects a stateful decoder model");
+        }
+        for (const auto& input : m_request.get_compiled_model().inputs()) {
+            const auto& name = input.get_any_name();
+            if (name != "input_ids" && name != "attention_mask" && name != "position_ids" && name != "beam_idx") {
+                throw std::logic_error("Unexpected model input " + name + ", the benchmark supports input_ids, " +
+                                       "attention_mask, position_ids and beam_idx");
+            }
+            m_inputs[name] = input;
+        }
+        if (!m_inputs.count("input_ids")) {
+            throw std::logic_error("The model has no input_ids input");
+        }
+    }
+
+    SequenceStats generate(size_t prompt_length, size_t output_length, std::mt19937& generator) {
+        for (auto&& state : m_request.query_state()) {
+            state.reset();
+        }
+        std::uniform_int_distribution<int64_t> token_distribution(1, 1000);
+        std::vector<int64_t> tokens(prompt_length);
+        std::generate(tokens.begin(), tokens.end(), [&] {
+            return token_distribution(generator);
+        });
+
+        SequenceStats stats;
+        auto start = std::chrono::steady_clock::now();
+        auto token = infer(tokens, 0);
+        auto time_point = std::chrono::steady_clock::now();
+        stats.ttft = std::chrono::duration_cast<Ms>(time_point - start).count();
+
+        size_t context_length = prompt_length + 1;
+        for (size_t i = 1; i < output_length; ++i, ++context_length) {
+            token = infer({token}, context_length - 1);
+            auto next_time_point = std::chrono::steady_clock::now();
+            stats.itl.emplace_back(context_length, std::chrono::duration_cast<Ms>(next_time_point - time_point).count());
+            time_point = next_time_point;
+        }
+        return stats;
+    }
+
+private:
+    template <typename F>
+    void set_input(const std::string& name, const ov::Shape& shape, F value) {
+        auto found = m_inputs.find(name);
+        if (found == m_inputs.end()) {
+            return;
+        }
+        ov::Tensor tensor(found->second.get_element_type(), shape);
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            if (tensor.get_element_type() == ov::element::i32) {
+                tensor.data<int32_t>()[i] = static_cast<int32_t>(value(i));
+            } else {
+                tensor.data<int64_t>()[i] = value(i);
+            }
+        }
+        m_request.set_tensor(found->second, tensor);
+    }
+
+    // Runs the model on the new tokens following the past ones kept in the states and returns the next token
+    int64_t infer(const std::vector<int64_t>& tokens, size_t past_length) {
+        const size_t length = tokens.size();
+        set_input("input_ids", {1, length}, [&](size_t i) {
+            return tokens[i];
+        });
+        set_input("attention_mask", {1, past_length + length}, [](size_t) {
+            return int64_t(1);
+        });
+        set_input("position_ids", {1, length}, [&](size_t i) {
+            return static_cast<int64_t>(past_length + i);
+        });
+        set_input("beam_idx", {1}, [](size_t) {
+            return int64_t(0);
+        });
+        m_request.infer();
+
+        // the greedy search over the logits of the last token
+        auto logits = m_request.get_output_tensor(0);
+        if (logits.get_element_type() != ov::element::f32 || logits.get_shape().empty()) {
+            return tokens.back();
+        }
+        const size_t vocab_size = logits.get_shape().back();
+        const float* last = logits.data<float>() + logits.get_size() - vocab_size;
+        return std::max_element(last, last + vocab_size) - last;
+    }
+
+    ov::InferRequest m_request;
+    std::map<std::string, ov::Output<const ov::Node>> m_inputs;
+};
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        slog::info << "OpenVINO:" << slog::endl;
+        slog::info << ov::get_openvino_version();
+        if (argc < 2 || argc > 7) {
+            slog::info << "Usage : " << argv[0]
+                       << " <path_to_model> [device=CPU] [prompt_length=128] [output_length=128] [concurrency=1]"
+                       << " [sequences=16]" << slog::endl;
+            slog::info << "The lengths are N or MIN:MAX, e.g. 32:1024, for the uniformly distributed lengths"
+                       << slog::endl;
+            return EXIT_FAILURE;
+        }
+        const std::string device = argc > 2 ? argv[2] : "CPU";
+        const auto prompt_length = parse_length(argc > 3 ? argv[3] : "128");
+        const auto output_length = parse_length(argc > 4 ? argv[4] : "128");
+        const size_t concurrency = argc > 5 ? std::stoul(argv[5]) : 1;
+        const size_t sequences = argc > 6 ? std::stoul(argv[6]) : 16;
+        if (concurrency == 0 || sequences == 0) {
+            throw std::invalid_argument("The concurrency and the number of sequences must be positive");
+        }
+
+        const double initial_rss = get_rss_mb();
+        // Each sequence is generated by one infer request, the concurrent sequences use the different requests
+        ov::AnyMap config{{ov::hint::num_requests.name(), static_cast<uint32_t>(concurrency)}};
+        ov::Core core;
+        ov::CompiledModel compiled_model = core.compile_model(argv[1], device, config);
+        std::vector<Generator> generators;
+        for (size_t i = 0; i < concurrency; ++i) {
+            generators.emplace_back(compiled_model.create_infer_request());
+        }
+        const double compiled_rss = get_rss_mb();
+
+        // Warm up
+        std::mt19937 warmup_generator(0);
+        for (auto& generator : generators) {
+            generator.generate(prompt_length.min, 2, warmup_generator);
+        }
+        const double warmed_up_rss = get_rss_mb();
+
+        std::atomic<size_t> next_sequence{0};
+        std::mutex mutex;
+        std::vector<SequenceStats> stats;
+        size_t prompt_tokens = 0;
+        size_t generated_tokens = 0;
+        double peak_rss = warmed_up_rss;
+        std::exception_ptr exception;
+        auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> threads;
+        for (size_t i = 0; i < concurrency; ++i) {
+            threads.emplace_back([&, i] {
+                try {
+                    std::mt19937 generator(static_cast<unsigned>(i + 1));
+                    std::uniform_int_distribution<size_t> prompt_distribution(prompt_length.min, prompt_length.max);
+                    std::uniform_int_distribution<size_t> output_distribution(output_length.min, output_length.max);
+                    while (next_sequence++ < sequences) {
+                        const size_t prompt = prompt_distribution(generator);
+                        const size_t output = output_distribution(generator);
+                        auto sequence_stats = generators[i].generate(prompt, output, generator);
+                        const double rss = get_rss_mb();
+                        std::lock_guard<std::mutex> lock(mutex);
+                        stats.push_back(std::move(sequence_stats));
+                        prompt_tokens += prompt;
+                        generated_tokens += output;
+                        peak_rss = std::max(peak_rss, rss);
+                    }
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if (!exception) {
+                        exception = std::current_exception();
+                    }
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+        auto end = std::chrono::steady_clock::now();
+        double duration = std::chrono::duration_cast<Ms>(end - start).count();
+
+        // Report results
+        std::vector<double> ttft, tpot, itl;
+        // the inter-token latency by the context length shows the cost of the KV-cache growth
+        constexpr size_t context_bucket = 256;
+        std::map<size_t, std::vector<double>> itl_by_context;
+        for (const auto& sequence_stats : stats) {
+            ttft.push_back(sequence_stats.ttft);
+            if (sequence_stats.itl.empty()) {
+                continue;
+            }
+            double sum = 0;
+            for (const auto& token : sequence_stats.itl) {
+                itl.push_back(token.second);
+                itl_by_context[token.first / context_bucket].push_back(token.second);
+                sum += token.second;
+            }
+            tpot.push_back(sum / sequence_stats.itl.size());
+        }
+
+        slog::info << "Sequences:  " << stats.size() << ", concurrency " << concurrency << slog::endl
+                   << "Duration:   " << duration << " ms" << slog::endl
+                   << "Time to first token:" << slog::endl;
+        LatencyMetrics{ttft}.write_to_slog();
+        if (!tpot.empty()) {
+            slog::info << "Time per output token:" << slog::endl;
+            LatencyMetrics{tpot}.write_to_slog();
+            slog::info << "Inter-token latency:" << slog::endl;
+            LatencyMetrics{itl, "", 90}.write_to_slog();
+            slog::info << "Inter-token latency by context length:" << slog::endl;
+            for (const auto& bucket : itl_by_context) {
+                const auto& latencies = bucket.second;
+                slog::info << "   [" << bucket.first * context_bucket << ", " << (bucket.first + 1) * context_bucket
+                           << "): " << double_to_string(std::accumulate(latencies.begin(), latencies.end(), 0.0) /
+                                                        latencies.size())
+                           << " ms" << slog::endl;
+            }
+        }
+        slog::info << "Throughput: " << double_to_string(1000 * generated_tokens / duration) << " generated tokens/s, "
+                   << double_to_string(1000 * (prompt_tokens + generated_tokens) / duration) << " tokens/s"
+                   << slog::endl;
+        slog::info << "Memory:" << slog::endl
+                   << "   Initial:          " << rss_to_string(initial_rss) << slog::endl
+                   << "   Compiled:         " << rss_to_string(compiled_rss) << slog::endl
+                   << "   Warmed up:        " << rss_to_string(warmed_up_rss) << slog::endl
+                   << "   Peak:             " << rss_to_string(peak_rss) << slog::endl;
+        if (warmed_up_rss >= 0) {
+            slog::info << "   Growth:           " << rss_to_string(peak_rss - warmed_up_rss) << slog::endl;
+        }
+    } catch (const std::exception& ex) {
+        slog::err << ex.what() << slog::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
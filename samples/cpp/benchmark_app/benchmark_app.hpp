@@ -115,6 +115,31 @@ static const char infer_num_streams_message[] =
 static const char infer_requests_count_message[] =
     "Optional. Number of infer requests. Default value is determined automatically for device.";
 
+/// @brief message for target arrival rate
+static const char arrival_rate_message[] =
+    "Optional. Target arrival rate of the requests per second. Enables the open-loop mode: the requests arrive at "
+    "this rate regardless of the completed ones and wait for an idle infer request, the latency includes the waiting. "
+    "Default value is 0, the requests are submitted as soon as an infer request is idle.";
+
+/// @brief message for arrival process
+static const char arrival_message[] =
+    "Optional. Arrival process of the open-loop mode: \"poisson\" or \"constant\". Default value is \"poisson\".";
+
+/// @brief message for shape trace option
+static const char shape_trace_message[] =
+    "Optional. Path to the trace of the input shapes to replay, a line per request with the shapes in -data_shape "
+    "format of a single group and the optional inter-arrival time in milliseconds, e.g. \"[1,3,224,224] 2.5\" or "
+    "\"data[1,128],mask[1,128]\". The requests are inferred in the order of the trace, the inter-arrival times enable "
+    "the open-loop mode in place of -qps option. The latency is reported per shape.";
+
+/// @brief message for multi-model config option
+static const char multi_model_config_message[] =
+    "Optional. Path to JSON file listing the models to benchmark together in one process, an array of objects with "
+    "the \"model\" path and the optional \"device\", \"hint\", \"nireq\", \"qps\", \"arrival\" and \"config\" "
+    "(properties of the model) fields. Each model is benchmarked alone and then all the models concurrently, the "
+    "throughput, the latency and the throughput lost to the interference are reported per model and in total. "
+    "The other model options are ignored in this mode.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -222,6 +247,12 @@ static const char pc_sort_message[] =
     " \"no_sort\" Analysis opts time cost, print by normal order "
     " \"simple_sort\" Analysis opts time cost, only print EXECUTED opts by normal order";
 
+// @brief message for roofline of performance counters option
+static const char pc_roofline_message[] =
+    "Optional. Report the achieved GFLOP/s and GB/s of each layer from the work estimated by the device. "
+    "Takes the peaks of the device as \"<GFLOP/s>,<GB/s>\" to report the bound of each layer and the percent of "
+    "the roofline it achieves, \"0,0\" reports the achieved values only.";
+
 // @brief message for performance counters for sequence option
 static const char pcseq_message[] = "Optional. Report latencies for each shape in -data_shape sequence.";
 
@@ -313,6 +344,18 @@ DEFINE_string(api, "async", api_message);
 /// @brief Number of infer requests in parallel
 DEFINE_uint64(nireq, 0, infer_requests_count_message);
 
+/// @brief Path to the config file of the multi-model mode
+DEFINE_string(multi_model_config, "", multi_model_config_message);
+
+/// @brief Target arrival rate of the open-loop mode
+DEFINE_double(qps, 0, arrival_rate_message);
+
+/// @brief Arrival process of the open-loop mode
+DEFINE_string(arrival, "poisson", arrival_message);
+
+/// @brief Path to the trace of the input shapes
+DEFINE_string(shape_trace, "", shape_trace_message);
+
 /// @brief Number of streams to use for inference on the CPU (also affects Hetero cases)
 DEFINE_string(nstreams, "", infer_num_streams_message);
 
@@ -370,6 +413,9 @@ DEFINE_bool(pc, false, pc_message);
 /// @brief Define flag for showing sorted performance counters <br>
 DEFINE_string(pcsort, "", pc_sort_message);
 
+/// @brief Define flag for showing roofline of performance counters <br>
+DEFINE_string(pcroofline, "", pc_roofline_message);
+
 /// @brief Define flag for showing performance sequence counters <br>
 DEFINE_bool(pcseq, false, pcseq_message);
 
@@ -411,6 +457,10 @@ static void show_usage() {
     std::cout << "    -load_from_file               " << load_from_file_message << std::endl;
     std::cout << "    -api <sync/async>             " << api_message << std::endl;
     std::cout << "    -nireq  <integer>             " << infer_requests_count_message << std::endl;
+    std::cout << "    -qps  <float>                 " << arrival_rate_message << std::endl;
+    std::cout << "    -arrival  <poisson/constant>  " << arrival_message << std::endl;
+    std::cout << "    -multi_model_config  <path>   " << multi_model_config_message << std::endl;
+    std::cout << "    -shape_trace  <path>          " << shape_trace_message << std::endl;
     std::cout << "    -nstreams  <integer>          " << infer_num_streams_message << std::endl;
     std::cout << "    -inference_only         " << inference_only_message << std::endl;
     std::cout << "    -infer_precision        " << inference_precision_message << std::endl;
@@ -437,6 +487,7 @@ static void show_usage() {
     std::cout << "    -json_stats             " << json_stats_message << std::endl;
     std::cout << "    -pc                     " << pc_message << std::endl;
     std::cout << "    -pcsort                 " << pc_sort_message << std::endl;
+    std::cout << "    -pcroofline             " << pc_roofline_message << std::endl;
     std::cout << "    -pcseq                  " << pcseq_message << std::endl;
     std::cout << "    -exec_graph_path        " << exec_graph_path_message << std::endl;
     std::cout << "    -dump_config            " << dump_config_message << std::endl;
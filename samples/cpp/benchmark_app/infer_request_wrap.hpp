@@ -23,7 +23,8 @@
 #include "utils.hpp"
 // clang-format on
 
-typedef std::function<void(size_t id, size_t group_id, const double latency, const std::exception_ptr& ptr)>
+typedef std::function<
+    void(size_t id, size_t group_id, const double latency, const double queue_time, const std::exception_ptr& ptr)>
     QueueCallbackFunction;
 
 /// @brief Handles asynchronous callbacks and calculates execution time
@@ -41,12 +42,22 @@ public:
           outputClBuffer() {
         _request.set_callback([&](const std::exception_ptr& ptr) {
             _endTime = Time::now();
-            _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), ptr);
+            _callbackQueue(_id,
+                           _lat_group_id,
+                           get_execution_time_in_milliseconds(),
+                           get_queue_time_in_milliseconds(),
+                           ptr);
         });
     }
 
     void start_async() {
+        start_async(Time::now());
+    }
+
+    /// @brief Starts the request arrived at the given time, the time spent waiting for it is its queue time
+    void start_async(Time::time_point arrival_time) {
         _startTime = Time::now();
+        _arrivalTime = std::min(arrival_time, _startTime);
         _request.start_async();
     }
 
@@ -56,9 +67,10 @@ public:
 
     void infer() {
         _startTime = Time::now();
+        _arrivalTime = _startTime;
         _request.infer();
         _endTime = Time::now();
-        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), nullptr);
+        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), 0.0, nullptr);
     }
 
     std::vector<ov::ProfilingInfo> get_performance_counts() {
@@ -83,6 +95,11 @@ public:
         return static_cast<double>(execTime.count()) * 0.000001;
     }
 
+    double get_queue_time_in_milliseconds() const {
+        auto queueTime = std::chrono::duration_cast<ns>(_startTime - _arrivalTime);
+        return static_cast<double>(queueTime.count()) * 0.000001;
+    }
+
     void set_latency_group_id(size_t id) {
         _lat_group_id = id;
     }
@@ -96,6 +113,7 @@ public:
 
 private:
     ov::InferRequest _request;
+    Time::time_point _arrivalTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -116,7 +134,8 @@ public:
                                                                         std::placeholders::_1,
                                                                         std::placeholders::_2,
                                                                         std::placeholders::_3,
-                                                                        std::placeholders::_4)));
+                                                                        std::placeholders::_4,
+                                                                        std::placeholders::_5)));
             _idleIds.push(id);
         }
         _latency_groups.resize(lat_group_n);
@@ -137,6 +156,8 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _queue_times.clear();
+        _service_times.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -146,17 +167,21 @@ public:
         return std::chrono::duration_cast<ns>(_endTime - _startTime).count() * 0.000001;
     }
 
+    /// @brief The latency of the request is the sum of its queue time and its execution time
     void put_idle_request(size_t id,
                           size_t lat_group_id,
                           const double latency,
+                          const double queue_time,
                           const std::exception_ptr& ptr = nullptr) {
         std::unique_lock<std::mutex> lock(_mutex);
         if (ptr) {
             inferenceException = ptr;
         } else {
-            _latencies.push_back(latency);
+            _latencies.push_back(latency + queue_time);
+            _queue_times.push_back(queue_time);
+            _service_times.push_back(latency);
             if (enable_lat_groups) {
-                _latency_groups[lat_group_id].push_back(latency);
+                _latency_groups[lat_group_id].push_back(latency + queue_time);
             }
             _idleIds.push(id);
             _endTime = std::max(Time::now(), _endTime);
@@ -192,6 +217,14 @@ public:
         return _latencies;
     }
 
+    std::vector<double> get_queue_times() {
+        return _queue_times;
+    }
+
+    std::vector<double> get_service_times() {
+        return _service_times;
+    }
+
     std::vector<std::vector<double>> get_latency_groups() {
         return _latency_groups;
     }
@@ -205,6 +238,8 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<double> _queue_times;
+    std::vector<double> _service_times;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
@@ -6,13 +6,17 @@
 #include <chrono>
 #include <map>
 #include <memory>
+#include <numeric>
+#include <random>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
 // clang-format off
 #include "openvino/openvino.hpp"
 #include "openvino/pass/serialize.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #ifndef IN_OV_COMPONENT
 #    define IN_OV_COMPONENT
@@ -34,6 +38,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "multi_model.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -51,7 +56,7 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
         return false;
     }
 
-    if (FLAGS_m.empty()) {
+    if (FLAGS_m.empty() && FLAGS_multi_model_config.empty()) {
         show_usage();
         throw std::logic_error("Model is required but not set. Please set -m option.");
     }
@@ -63,6 +68,24 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_qps < 0) {
+        throw std::logic_error("Incorrect arrival rate. Please set -qps option to a positive value.");
+    }
+    if (FLAGS_qps > 0 && FLAGS_api != "async") {
+        throw std::logic_error("The open-loop mode set by -qps option requires `async` API.");
+    }
+    if (!FLAGS_shape_trace.empty() && !FLAGS_data_shape.empty()) {
+        throw std::logic_error("The shapes of the requests are set by -shape_trace option, -data_shape option can't "
+                               "be used with it.");
+    }
+    if (!FLAGS_shape_trace.empty() && FLAGS_qps > 0) {
+        throw std::logic_error("The arrivals of the requests are set by -shape_trace option, -qps option can't be "
+                               "used with it.");
+    }
+    if (FLAGS_arrival != "poisson" && FLAGS_arrival != "constant") {
+        throw std::logic_error(
+            "Incorrect arrival process. Please set -arrival option to `poisson` or `constant` value.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -248,6 +271,22 @@ int main(int argc, char* argv[]) {
             return 0;
         }
 
+        std::vector<ShapeTraceEntry> shapeTrace;
+        if (!FLAGS_shape_trace.empty()) {
+            FLAGS_data_shape = parse_shape_trace(FLAGS_shape_trace, shapeTrace);
+            // The latency is reported per shape of the trace
+            FLAGS_pcseq = true;
+            slog::info << "Shape trace: " << shapeTrace.size() << " requests with the data shapes " << FLAGS_data_shape
+                       << slog::endl;
+        }
+        const bool traceArrivals =
+            std::any_of(shapeTrace.begin(), shapeTrace.end(), [](const ShapeTraceEntry& entry) {
+                return entry.interval_ms >= 0;
+            });
+        if (traceArrivals && FLAGS_api != "async") {
+            throw std::logic_error("The inter-arrival times of -shape_trace option require `async` API.");
+        }
+
         bool isNetworkCompiled = fileExt(FLAGS_m) == "blob";
         if (isNetworkCompiled) {
             slog::info << "Model is compiled" << slog::endl;
@@ -269,6 +308,15 @@ int main(int argc, char* argv[]) {
 
             statistics->add_parameters(StatisticsReport::Category::COMMAND_LINE_PARAMETERS, command_line_arguments);
         }
+
+        if (!FLAGS_multi_model_config.empty()) {
+            ov::Core core;
+            run_multi_model_benchmark(core, FLAGS_multi_model_config, FLAGS_t, FLAGS_latency_percentile, statistics);
+            if (statistics)
+                statistics->dump();
+            return 0;
+        }
+
         auto isFlagSetInCommandLine = [&command_line_arguments](const std::string& name) {
             return (std::find_if(command_line_arguments.begin(),
                                  command_line_arguments.end(),
@@ -409,6 +457,10 @@ int main(int argc, char* argv[]) {
                 slog::warn << "Turn on sorted performance counters for " << device << " device since pcsort value is "
                            << FLAGS_pcsort << "." << slog::endl;
                 device_config[ov::enable_profiling.name()] = true;
+            } else if (!FLAGS_pcroofline.empty()) {
+                slog::warn << "Turn on performance counters for " << device << " device since pcroofline value is "
+                           << FLAGS_pcroofline << "." << slog::endl;
+                device_config[ov::enable_profiling.name()] = true;
             } else {
                 // set to default value
                 device_config[ov::enable_profiling.name()] = FLAGS_pc;
@@ -859,6 +911,24 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        // breakdown of the compile or import time by the device
+        if (std::find(supported_properties.begin(), supported_properties.end(), ov::intel_cpu::compilation_stages) !=
+            supported_properties.end()) {
+            const auto stages = compiledModel.get_property(ov::intel_cpu::compilation_stages);
+            slog::info << "Compilation stages:" << slog::endl;
+            std::vector<StatisticsVariant> stages_statistics;
+            for (const auto& stage : stages) {
+                slog::info << "  " << stage.first << ": " << double_to_string(stage.second) << " ms" << slog::endl;
+                auto json_name = stage.first;
+                std::replace(json_name.begin(), json_name.end(), '.', '_');
+                stages_statistics.emplace_back("compilation stage " + stage.first + " (ms)",
+                                               "compilation_stage_" + json_name,
+                                               stage.second);
+            }
+            if (statistics)
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS, stages_statistics);
+        }
+
         // Update number of streams
         for (auto&& ds : device_nstreams) {
             try {
@@ -1023,6 +1093,11 @@ int main(int argc, char* argv[]) {
             }
             ss << niter << " iterations";
         }
+        if (traceArrivals) {
+            ss << ", arrivals of the shape trace";
+        } else if (FLAGS_qps > 0) {
+            ss << ", " << FLAGS_arrival << " arrivals at " << double_to_string(FLAGS_qps) << " requests per second";
+        }
 
         next_step(ss.str());
 
@@ -1109,26 +1184,57 @@ int main(int argc, char* argv[]) {
         }
         inferRequestsQueue.reset_times();
 
+        // The device counts the hits of the shape cache and the recompilations of the dynamic shapes
+        const bool hasRuntimeCacheStatistics =
+            isDynamicNetwork && std::find(supported_properties.begin(),
+                                          supported_properties.end(),
+                                          ov::intel_cpu::runtime_cache_statistics) != supported_properties.end();
+        std::map<std::string, uint64_t> runtimeCacheStatistics;
+        if (hasRuntimeCacheStatistics) {
+            runtimeCacheStatistics = compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics);
+        }
+
         size_t processedFramesN = 0;
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        const bool openLoop = FLAGS_qps > 0 || traceArrivals;
+        std::mt19937 arrivalGenerator;
+        std::exponential_distribution<double> arrivalInterval(FLAGS_qps > 0 ? FLAGS_qps : 1.0);
+        auto arrivalTime = startTime;
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
                (FLAGS_api == "async" && iteration % nireq != 0)) {
+            if (openLoop) {
+                // The arrivals do not depend on the completed requests, so a request arrived while all the infer
+                // requests are busy waits for an idle one and the waiting is included in its latency
+                double interval = 0;
+                if (traceArrivals) {
+                    interval = std::max(shapeTrace[iteration % shapeTrace.size()].interval_ms, 0.0) / 1000;
+                } else {
+                    interval = FLAGS_arrival == "constant" ? 1.0 / FLAGS_qps : arrivalInterval(arrivalGenerator);
+                }
+                arrivalTime += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 OPENVINO_THROW("No idle Infer Requests!");
             }
 
             if (!inferenceOnly) {
-                auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
+                // The requests follow the shape trace or cycle through the data shapes
+                const size_t groupsNum = app_inputs_info.size();
+                const size_t group =
+                    (shapeTrace.empty() ? iteration : shapeTrace[iteration % shapeTrace.size()].group) % groupsNum;
+                auto inputs = app_inputs_info[group];
 
                 if (FLAGS_pcseq) {
-                    inferRequest->set_latency_group_id(iteration % app_inputs_info.size());
+                    inferRequest->set_latency_group_id(group);
                 }
 
                 if (isDynamicNetwork) {
@@ -1137,7 +1243,8 @@ int main(int argc, char* argv[]) {
 
                 for (auto& item : inputs) {
                     auto inputName = item.first;
-                    const auto& data = inputsData.at(inputName)[iteration % inputsData.at(inputName).size()];
+                    const auto& tensors = inputsData.at(inputName);
+                    const auto& data = tensors[(iteration / groupsNum * groupsNum + group) % tensors.size()];
                     inferRequest->set_tensor(inputName, data);
                 }
 
@@ -1152,6 +1259,8 @@ int main(int argc, char* argv[]) {
 
             if (FLAGS_api == "sync") {
                 inferRequest->infer();
+            } else if (openLoop) {
+                inferRequest->start_async(arrivalTime);
             } else {
                 inferRequest->start_async();
             }
@@ -1164,12 +1273,23 @@ int main(int argc, char* argv[]) {
         // wait the latest inference executions
         inferRequestsQueue.wait_all();
 
+        if (hasRuntimeCacheStatistics) {
+            for (const auto& counter : compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics)) {
+                runtimeCacheStatistics[counter.first] = counter.second - runtimeCacheStatistics[counter.first];
+            }
+        }
+
         LatencyMetrics generalLatency(inferRequestsQueue.get_latencies(), "", FLAGS_latency_percentile);
         std::vector<LatencyMetrics> groupLatencies = {};
+        std::vector<size_t> groupIds = {};
         if (FLAGS_pcseq && app_inputs_info.size() > 1) {
             const auto& lat_groups = inferRequestsQueue.get_latency_groups();
             for (size_t i = 0; i < lat_groups.size(); i++) {
                 const auto& lats = lat_groups[i];
+                // The run may end before the shape trace reaches some of its shapes
+                if (lats.empty()) {
+                    continue;
+                }
 
                 std::string data_shapes_string = "";
                 for (auto& item : app_inputs_info[i]) {
@@ -1179,12 +1299,33 @@ int main(int argc, char* argv[]) {
                     data_shapes_string == "" ? "" : data_shapes_string.substr(0, data_shapes_string.size() - 1);
 
                 groupLatencies.emplace_back(lats, data_shapes_string, FLAGS_latency_percentile);
+                groupIds.push_back(i);
             }
         }
 
         double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
         double fps = 1000.0 * processedFramesN / totalDuration;
 
+        // In the open-loop mode the tail of the latency is reported together with its queue and execution parts
+        const std::vector<std::pair<std::string, double>> openLoopPercentiles = {{"50", 50},
+                                                                                 {"90", 90},
+                                                                                 {"99", 99},
+                                                                                 {"99.9", 99.9}};
+        std::vector<double> openLoopLatencies;
+        double averageQueueTime = 0;
+        double maxQueueTime = 0;
+        double averageServiceTime = 0;
+        if (openLoop) {
+            for (auto percentile : openLoopPercentiles) {
+                openLoopLatencies.push_back(get_percentile(inferRequestsQueue.get_latencies(), percentile.second));
+            }
+            const auto queueTimes = inferRequestsQueue.get_queue_times();
+            const auto serviceTimes = inferRequestsQueue.get_service_times();
+            averageQueueTime = std::accumulate(queueTimes.begin(), queueTimes.end(), 0.0) / queueTimes.size();
+            maxQueueTime = *std::max_element(queueTimes.begin(), queueTimes.end());
+            averageServiceTime = std::accumulate(serviceTimes.begin(), serviceTimes.end(), 0.0) / serviceTimes.size();
+        }
+
         if (statistics) {
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("total execution time (ms)", "execution_time", totalDuration),
@@ -1204,6 +1345,28 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
 
+                if (openLoop) {
+                    StatisticsReport::Parameters openLoopParameters = {
+                        StatisticsVariant("Average queue time (ms)", "queue_time_avg", averageQueueTime),
+                        StatisticsVariant("Max queue time (ms)", "queue_time_max", maxQueueTime),
+                        StatisticsVariant("Average execution time (ms)", "execution_time_avg", averageServiceTime)};
+                    if (traceArrivals) {
+                        openLoopParameters.emplace_back("shape trace", "shape_trace", FLAGS_shape_trace);
+                    } else {
+                        openLoopParameters.emplace_back("target arrival rate (qps)", "target_qps", FLAGS_qps);
+                        openLoopParameters.emplace_back("arrival process", "arrival", FLAGS_arrival);
+                    }
+                    for (size_t i = 0; i < openLoopPercentiles.size(); ++i) {
+                        const auto& name = openLoopPercentiles[i].first;
+                        auto json_name = name;
+                        std::replace(json_name.begin(), json_name.end(), '.', '_');
+                        openLoopParameters.emplace_back("latency p" + name + " (ms)",
+                                                        "latency_p" + json_name,
+                                                        openLoopLatencies[i]);
+                    }
+                    statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS, openLoopParameters);
+                }
+
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
                         statistics->add_parameters(
@@ -1212,6 +1375,15 @@ int main(int argc, char* argv[]) {
                     }
                 }
             }
+            if (hasRuntimeCacheStatistics) {
+                StatisticsReport::Parameters runtimeCacheParameters;
+                for (const auto& counter : runtimeCacheStatistics) {
+                    runtimeCacheParameters.emplace_back("runtime cache " + counter.first,
+                                                        "runtime_cache_" + counter.first,
+                                                        counter.second);
+                }
+                statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS, runtimeCacheParameters);
+            }
             statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS,
                                        {StatisticsVariant("throughput", "throughput", fps)});
         }
@@ -1253,6 +1425,10 @@ int main(int argc, char* argv[]) {
             if (statistics) {
                 statistics->dump_performance_counters(perfCounts);
             }
+            if (!FLAGS_pcroofline.empty()) {
+                slog::info << "Roofline of the layers:" << slog::endl;
+                print_roofline(compiledModel.get_runtime_model(), FLAGS_pcroofline);
+            }
         }
 
         if (statistics)
@@ -1272,9 +1448,29 @@ int main(int argc, char* argv[]) {
             slog::info << "Latency:" << slog::endl;
             generalLatency.write_to_slog();
 
+            if (openLoop) {
+                if (traceArrivals) {
+                    slog::info << "Latency percentiles at the arrivals of the shape trace:" << slog::endl;
+                } else {
+                    slog::info << "Latency percentiles at " << double_to_string(FLAGS_qps) << " requests per second:"
+                               << slog::endl;
+                }
+                for (size_t i = 0; i < openLoopPercentiles.size(); ++i) {
+                    const auto& name = openLoopPercentiles[i].first;
+                    slog::info << "   P" << name << ":" << std::string(16 - name.size(), ' ')
+                               << double_to_string(openLoopLatencies[i]) << " ms" << slog::endl;
+                }
+                slog::info << "Queue time:" << slog::endl;
+                slog::info << "   Average:          " << double_to_string(averageQueueTime) << " ms" << slog::endl;
+                slog::info << "   Max:              " << double_to_string(maxQueueTime) << " ms" << slog::endl;
+                slog::info << "Execution time:" << slog::endl;
+                slog::info << "   Average:          " << double_to_string(averageServiceTime) << " ms" << slog::endl;
+            }
+
             if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                 slog::info << "Latency for each data shape group:" << slog::endl;
-                for (size_t i = 0; i < app_inputs_info.size(); ++i) {
+                for (size_t k = 0; k < groupLatencies.size(); ++k) {
+                    const size_t i = groupIds[k];
                     slog::info << (i + 1) << ".";
                     for (auto& item : app_inputs_info[i]) {
                         std::stringstream input_shape;
@@ -1285,11 +1481,19 @@ int main(int argc, char* argv[]) {
                     }
                     slog::info << slog::endl;
 
-                    groupLatencies[i].write_to_slog();
+                    groupLatencies[k].write_to_slog();
                 }
             }
         }
 
+        if (hasRuntimeCacheStatistics) {
+            // A miss of the shape cache means the kernels are compiled for a new shape
+            slog::info << "Runtime cache:" << slog::endl;
+            slog::info << "   Hits:             " << runtimeCacheStatistics["hits"] << slog::endl;
+            slog::info << "   Recompilations:   " << runtimeCacheStatistics["misses"] << slog::endl;
+            slog::info << "   Evictions:        " << runtimeCacheStatistics["evictions"] << slog::endl;
+        }
+
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
 
     } catch (const std::exception& ex) {
@@ -0,0 +1,291 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "multi_model.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// clang-format off
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "infer_request_wrap.hpp"
+#include "inputs_filling.hpp"
+#include "utils.hpp"
+// clang-format on
+
+namespace {
+
+struct ModelConfig {
+    std::string model;
+    std::string device = "CPU";
+    std::string hint;
+    uint64_t nireq = 0;
+    double qps = 0;
+    std::string arrival = "poisson";
+    ov::AnyMap config;
+};
+
+struct RunResult {
+    size_t iterations = 0;
+    double duration_ms = 0;
+    std::vector<double> latencies;
+};
+
+std::vector<ModelConfig> parse_multi_model_config(const std::string& config_path) {
+    std::ifstream ifs(config_path);
+    if (!ifs.is_open()) {
+        throw std::runtime_error("Can't load multi-model config file \"" + config_path + "\".");
+    }
+
+    nlohmann::json json_config;
+    try {
+        ifs >> json_config;
+    } catch (const std::exception& e) {
+        throw std::runtime_error("Can't parse multi-model config file \"" + config_path + "\".\n" + e.what());
+    }
+    if (!json_config.is_array() || json_config.empty()) {
+        throw std::logic_error("Multi-model config file should contain a non-empty array of models.");
+    }
+
+    std::vector<ModelConfig> configs;
+    for (const auto& item : json_config) {
+        ModelConfig config;
+        if (!item.contains("model")) {
+            throw std::logic_error("Every model of the multi-model config file should have the \"model\" path.");
+        }
+        config.model = item.at("model").get<std::string>();
+        if (item.contains("device"))
+            config.device = item.at("device").get<std::string>();
+        if (item.contains("hint"))
+            config.hint = item.at("hint").get<std::string>();
+        if (item.contains("nireq"))
+            config.nireq = item.at("nireq").get<uint64_t>();
+        if (item.contains("qps"))
+            config.qps = item.at("qps").get<double>();
+        if (item.contains("arrival"))
+            config.arrival = item.at("arrival").get<std::string>();
+        if (item.contains("config")) {
+            const auto& properties = item.at("config");
+            for (auto property = properties.cbegin(), end = properties.cend(); property != end; ++property) {
+                config.config[property.key()] = property.value().get<std::string>();
+            }
+        }
+        if (config.qps < 0) {
+            throw std::logic_error("Incorrect arrival rate of " + config.model + ", it should be positive.");
+        }
+        if (config.arrival != "poisson" && config.arrival != "constant") {
+            throw std::logic_error("Incorrect arrival process of " + config.model +
+                                   ", it should be `poisson` or `constant`.");
+        }
+        configs.push_back(std::move(config));
+    }
+    return configs;
+}
+
+ov::hint::PerformanceMode get_hint(const std::string& hint) {
+    if (hint == "throughput" || hint == "tput") {
+        return ov::hint::PerformanceMode::THROUGHPUT;
+    } else if (hint == "latency") {
+        return ov::hint::PerformanceMode::LATENCY;
+    } else if (hint == "cumulative_throughput" || hint == "ctput") {
+        return ov::hint::PerformanceMode::CUMULATIVE_THROUGHPUT;
+    } else if (hint == "none") {
+        return ov::hint::PerformanceMode::UNDEFINED;
+    }
+    throw std::logic_error("Incorrect performance hint `" + hint + "` in multi-model config file.");
+}
+
+/// @brief Compiled model with its infer requests filled with random data
+class ModelRunner {
+public:
+    ModelRunner(ov::Core& core, const ModelConfig& config) : _config(config) {
+        auto properties = config.config;
+        if (!config.hint.empty()) {
+            properties[ov::hint::performance_mode.name()] = get_hint(config.hint);
+        }
+        _compiled_model = core.compile_model(config.model, config.device, properties);
+
+        size_t nireq = config.nireq;
+        if (nireq == 0) {
+            nireq = _compiled_model.get_property(ov::optimal_number_of_infer_requests);
+        }
+        _queue = std::make_shared<InferRequestsQueue>(_compiled_model, nireq, 1, false);
+
+        auto inputs_info = get_inputs_info("", "", 0, "", {}, "", "", _compiled_model.inputs());
+        _batch_size = get_batch_size(inputs_info[0]);
+        auto inputs_data = get_tensors_static_case({}, _batch_size, inputs_info[0], nireq);
+        for (size_t i = 0; i < _queue->requests.size(); ++i) {
+            for (auto& input : inputs_data) {
+                auto request_tensor = _queue->requests[i]->get_tensor(input.first);
+                copy_tensor_data(request_tensor, input.second[i % input.second.size()]);
+            }
+        }
+
+        // warming up - out of scope
+        _queue->get_idle_request()->start_async();
+        _queue->wait_all();
+    }
+
+    RunResult run(uint64_t duration_nanoseconds) {
+        const bool open_loop = _config.qps > 0;
+        std::mt19937 arrival_generator;
+        std::exponential_distribution<double> arrival_interval(open_loop ? _config.qps : 1.0);
+
+        _queue->reset_times();
+        RunResult result;
+        const auto start_time = Time::now();
+        auto arrival_time = start_time;
+        while (static_cast<uint64_t>(std::chrono::duration_cast<ns>(Time::now() - start_time).count()) <
+               duration_nanoseconds) {
+            if (open_loop) {
+                const double interval =
+                    _config.arrival == "constant" ? 1.0 / _config.qps : arrival_interval(arrival_generator);
+                arrival_time += std::chrono::duration_cast<Time::duration>(std::chrono::duration<double>(interval));
+                std::this_thread::sleep_until(arrival_time);
+            }
+            auto request = _queue->get_idle_request();
+            if (open_loop) {
+                request->start_async(arrival_time);
+            } else {
+                request->start_async();
+            }
+            ++result.iterations;
+        }
+        _queue->wait_all();
+
+        result.duration_ms = _queue->get_duration_in_milliseconds();
+        result.latencies = _queue->get_latencies();
+        return result;
+    }
+
+    double get_throughput(const RunResult& result) const {
+        return 1000.0 * result.iterations * _batch_size / result.duration_ms;
+    }
+
+    const ModelConfig& get_config() const {
+        return _config;
+    }
+
+private:
+    ModelConfig _config;
+    ov::CompiledModel _compiled_model;
+    std::shared_ptr<InferRequestsQueue> _queue;
+    size_t _batch_size = 1;
+};
+
+}  // namespace
+
+void run_multi_model_benchmark(ov::Core& core,
+                               const std::string& config_path,
+                               uint64_t duration_seconds,
+                               size_t percentile_boundary,
+                               const std::shared_ptr<StatisticsReport>& statistics) {
+    const auto configs = parse_multi_model_config(config_path);
+
+    if (duration_seconds == 0) {
+        for (const auto& config : configs) {
+            duration_seconds = std::max<uint64_t>(duration_seconds,
+                                                  device_default_device_duration_in_seconds(config.device));
+        }
+    }
+    const auto duration_nanoseconds = get_duration_in_nanoseconds(duration_seconds);
+
+    std::vector<std::unique_ptr<ModelRunner>> runners;
+    for (const auto& config : configs) {
+        slog::info << "Compiling " << config.model << " for " << config.device << slog::endl;
+        runners.emplace_back(new ModelRunner(core, config));
+    }
+
+    slog::info << "Benchmarking each of " << runners.size() << " models alone, "
+               << get_duration_in_milliseconds(duration_seconds) << " ms duration" << slog::endl;
+    std::vector<RunResult> solo_results;
+    for (auto& runner : runners) {
+        solo_results.push_back(runner->run(duration_nanoseconds));
+    }
+
+    slog::info << "Benchmarking " << runners.size() << " models concurrently, "
+               << get_duration_in_milliseconds(duration_seconds) << " ms duration" << slog::endl;
+    std::vector<RunResult> concurrent_results(runners.size());
+    std::vector<std::exception_ptr> exceptions(runners.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < runners.size(); ++i) {
+        threads.emplace_back([&, i] {
+            try {
+                concurrent_results[i] = runners[i]->run(duration_nanoseconds);
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto& exception : exceptions) {
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    double aggregate_throughput = 0;
+    std::vector<double> aggregate_latencies;
+    for (size_t i = 0; i < runners.size(); ++i) {
+        const auto& config = runners[i]->get_config();
+        const auto& result = concurrent_results[i];
+        const auto solo_throughput = runners[i]->get_throughput(solo_results[i]);
+        const auto throughput = runners[i]->get_throughput(result);
+        const auto interference = 100.0 * (1.0 - throughput / solo_throughput);
+        aggregate_throughput += throughput;
+        aggregate_latencies.insert(aggregate_latencies.end(), result.latencies.begin(), result.latencies.end());
+
+        LatencyMetrics latency(result.latencies, "", percentile_boundary);
+        const auto p99 = get_percentile(result.latencies, 99);
+        slog::info << (i + 1) << ". " << config.model << " on " << config.device << slog::endl;
+        slog::info << "   Count:            " << result.iterations << " iterations" << slog::endl;
+        slog::info << "   Throughput:       " << double_to_string(throughput) << " FPS (alone "
+                   << double_to_string(solo_throughput) << " FPS)" << slog::endl;
+        slog::info << "   Interference:     " << double_to_string(interference) << " % of throughput lost"
+                   << slog::endl;
+        latency.write_to_slog();
+        slog::info << "   P99:              " << double_to_string(p99) << " ms" << slog::endl;
+
+        if (statistics) {
+            const auto prefix = std::to_string(i + 1) + ". " + config.model;
+            const auto json_prefix = "model_" + std::to_string(i + 1) + "_";
+            statistics->add_parameters(
+                StatisticsReport::Category::EXECUTION_RESULTS,
+                {StatisticsVariant(prefix + " model", json_prefix + "model", config.model),
+                 StatisticsVariant(prefix + " device", json_prefix + "device", config.device),
+                 StatisticsVariant(prefix + " iterations", json_prefix + "iterations_num", result.iterations),
+                 StatisticsVariant(prefix + " throughput", json_prefix + "throughput", throughput),
+                 StatisticsVariant(prefix + " solo throughput", json_prefix + "solo_throughput", solo_throughput),
+                 StatisticsVariant(prefix + " interference (%)", json_prefix + "interference", interference),
+                 StatisticsVariant(prefix + " latency (ms)", json_prefix + "latency", latency.median_or_percentile),
+                 StatisticsVariant(prefix + " average latency (ms)", json_prefix + "latency_avg", latency.avg),
+                 StatisticsVariant(prefix + " latency p99 (ms)", json_prefix + "latency_p99", p99)});
+        }
+    }
+
+    LatencyMetrics aggregate_latency(aggregate_latencies, "", percentile_boundary);
+    slog::info << "All models:" << slog::endl;
+    slog::info << "   Throughput:       " << double_to_string(aggregate_throughput) << " FPS" << slog::endl;
+    aggregate_latency.write_to_slog();
+    if (statistics) {
+        statistics->add_parameters(
+            StatisticsReport::Category::EXECUTION_RESULTS,
+            {StatisticsVariant("aggregate throughput", "throughput", aggregate_throughput),
+             StatisticsVariant("aggregate latency (ms)", "latency", aggregate_latency.median_or_percentile),
+             StatisticsVariant("aggregate average latency (ms)", "latency_avg", aggregate_latency.avg)});
+    }
+}
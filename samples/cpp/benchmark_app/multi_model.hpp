@@ -0,0 +1,28 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+#include <openvino/openvino.hpp>
+#include <string>
+
+// clang-format off
+#include "statistics_report.hpp"
+// clang-format on
+
+/// @brief Benchmarks the models listed in the JSON config file together in one ov::Core
+/// @param core The core compiling all the models
+/// @param config_path Path to the config file, an array of the objects with the "model" path and the optional
+/// "device", "hint", "nireq", "qps", "arrival" and "config" (the properties of the model) fields
+/// @param duration_seconds Duration of each run, 0 to use the default duration of the devices
+/// @param percentile_boundary The percentile reported as the latency
+/// @param statistics The report to add the results to, may be null
+/// Each model is benchmarked alone first and then all the models are benchmarked concurrently, the interference is
+/// the loss of the throughput of the model in the concurrent run relative to its solo run.
+void run_multi_model_benchmark(ov::Core& core,
+                               const std::string& config_path,
+                               uint64_t duration_seconds,
+                               size_t percentile_boundary,
+                               const std::shared_ptr<StatisticsReport>& statistics);
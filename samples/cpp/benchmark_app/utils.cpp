@@ -5,8 +5,12 @@
 #include <format_reader_ptr.h>
 
 #include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
 #include <map>
 #include <regex>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -97,6 +101,16 @@ std::vector<std::string> split(const std::string& s, char delim) {
     return result;
 }
 
+double get_percentile(std::vector<double> values, double percentile) {
+    if (values.empty()) {
+        throw std::logic_error("Percentile of empty vector of values is requested.");
+    }
+    // the same rounding as the percentile of LatencyMetrics
+    auto index = std::min(static_cast<size_t>(values.size() / 100.0 * percentile), values.size() - 1);
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
 std::vector<float> split_float(const std::string& s, char delim) {
     std::vector<float> result;
     std::stringstream ss(s);
@@ -918,3 +932,125 @@ std::string parameter_name_to_tensor_name(const std::string& name,
     throw std::runtime_error("Provided I/O name \"" + name +
                              "\" is not found neither in tensor names nor in nodes names.");
 }
+
+std::string parse_shape_trace(const std::string& filename, std::vector<ShapeTraceEntry>& trace) {
+    std::ifstream ifs(filename);
+    if (!ifs.is_open()) {
+        throw std::runtime_error("Can't load shape trace file \"" + filename + "\".");
+    }
+    // The shapes of a request are a single group of -data_shape like "[1,3,224,224]" or "data[1,128],mask[1,128]"
+    const std::regex shape_regex(R"(([^\[\],]*)(\[[^\]]*\]))");
+    std::vector<std::string> groups;
+    std::vector<std::string> input_names;
+    std::map<std::string, std::string> group_shapes;
+    std::string line;
+    size_t line_number = 0;
+    while (std::getline(ifs, line)) {
+        ++line_number;
+        std::istringstream line_stream(line);
+        std::string shapes;
+        if (!(line_stream >> shapes) || shapes.front() == '#') {
+            continue;
+        }
+        ShapeTraceEntry entry{0, -1.0};
+        std::string interval;
+        if (line_stream >> interval) {
+            entry.interval_ms = std::stod(interval);
+            if (entry.interval_ms < 0) {
+                throw std::logic_error("Negative inter-arrival time at line " + std::to_string(line_number) +
+                                       " of shape trace file \"" + filename + "\".");
+            }
+        }
+
+        auto group = std::find(groups.begin(), groups.end(), shapes);
+        entry.group = static_cast<size_t>(std::distance(groups.begin(), group));
+        if (group == groups.end()) {
+            std::vector<std::string> names;
+            std::string rest = shapes;
+            std::smatch match;
+            while (std::regex_search(rest, match, shape_regex)) {
+                names.push_back(match[1]);
+                group_shapes[match[1]] += match[2];
+                rest = match.suffix();
+            }
+            if (names.empty() || (!input_names.empty() && names != input_names)) {
+                throw std::logic_error("Incorrect shapes \"" + shapes + "\" at line " + std::to_string(line_number) +
+                                       " of shape trace file \"" + filename +
+                                       "\", all the lines should set the shapes of the same inputs.");
+            }
+            input_names = names;
+            groups.push_back(shapes);
+        }
+        trace.push_back(entry);
+    }
+    if (trace.empty()) {
+        throw std::logic_error("Shape trace file \"" + filename + "\" has no requests.");
+    }
+
+    std::string data_shape;
+    for (const auto& name : input_names) {
+        data_shape += (data_shape.empty() ? "" : ",") + name + group_shapes[name];
+    }
+    return data_shape;
+}
+
+void print_roofline(const std::shared_ptr<const ov::Model>& runtime_model, const std::string& peaks) {
+    const auto peak_values = split(peaks, ',');
+    if (peak_values.size() != 2) {
+        throw std::logic_error("Incorrect roofline peaks \"" + peaks + "\", should be \"<GFLOP/s>,<GB/s>\".");
+    }
+    const double peak_gflops = std::stod(peak_values[0]);
+    const double peak_gbps = std::stod(peak_values[1]);
+
+    auto get_value = [](const ov::Node::RTMap& rt_info, const std::string& key) {
+        auto it = rt_info.find(key);
+        if (it == rt_info.end()) {
+            return -1.0;
+        }
+        try {
+            return std::stod(it->second.as<std::string>());
+        } catch (const std::exception&) {
+            return -1.0;  // "not_executed"
+        }
+    };
+
+    std::cout << std::left << std::setw(40) << "layer name" << std::setw(20) << "layer type" << std::right
+              << std::setw(12) << "time (us)" << std::setw(12) << "GFLOP/s" << std::setw(12) << "GB/s"
+              << std::setw(12) << "FLOP/byte";
+    if (peak_gflops > 0 && peak_gbps > 0) {
+        std::cout << std::setw(10) << "bound" << std::setw(12) << "% of roof";
+    }
+    std::cout << std::endl;
+    for (const auto& node : runtime_model->get_ordered_ops()) {
+        const auto& rt_info = node->get_rt_info();
+        const auto time_us = get_value(rt_info, "execTimeMcs");
+        const auto flops = get_value(rt_info, "estimatedFlops");
+        const auto bytes = get_value(rt_info, "estimatedBytes");
+        if (time_us <= 0 || (flops < 0 && bytes < 0)) {
+            continue;
+        }
+        auto name = node->get_friendly_name();
+        if (name.size() > 38) {
+            name = name.substr(0, 35) + "...";
+        }
+        const auto type = rt_info.count("layerType") ? rt_info.at("layerType").as<std::string>() : "";
+        // bytes or flops per microsecond make the thousands of GB/s or GFLOP/s
+        const double gflops = flops / time_us / 1e3;
+        const double gbps = bytes / time_us / 1e3;
+        std::cout << std::fixed << std::setprecision(2) << std::left << std::setw(40) << name << std::setw(20) << type
+                  << std::right << std::setw(12) << time_us << std::setw(12)
+                  << (flops >= 0 ? double_to_string(gflops) : "-") << std::setw(12)
+                  << (bytes >= 0 ? double_to_string(gbps) : "-") << std::setw(12)
+                  << (flops >= 0 && bytes > 0 ? double_to_string(flops / bytes) : "-");
+        if (peak_gflops > 0 && peak_gbps > 0) {
+            // the layers with the unknown FLOPs are treated as the data movement
+            const double intensity = flops > 0 && bytes > 0 ? flops / bytes : 0;
+            const bool compute_bound = intensity >= peak_gflops / peak_gbps;
+            const double roof = intensity > 0 ? 100.0 * gflops / std::min(peak_gflops, intensity * peak_gbps)
+                                              : 100.0 * gbps / peak_gbps;
+            std::cout << std::setw(10) << (compute_bound ? "compute" : "memory") << std::setw(12)
+                      << double_to_string(roof);
+        }
+        std::cout << std::endl;
+    }
+}
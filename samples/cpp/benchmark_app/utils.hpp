@@ -76,6 +76,7 @@ void update_device_config_for_virtual_device(const std::string& value,
 std::string get_shapes_string(const benchmark_app::PartialShapes& shapes);
 size_t get_batch_size(const benchmark_app::InputsInfo& inputs_info);
 std::vector<std::string> split(const std::string& s, char delim);
+double get_percentile(std::vector<double> values, double percentile);
 std::map<std::string, std::vector<float>> parse_scale_or_mean(const std::string& scale_mean,
                                                               const benchmark_app::InputsInfo& inputs_info);
 std::pair<std::string, std::vector<std::string>> parse_input_files(const std::string& file_paths_string);
@@ -137,6 +138,21 @@ std::vector<benchmark_app::InputsInfo> get_inputs_info(const std::string& shape_
 void dump_config(const std::string& filename, const std::map<std::string, ov::AnyMap>& config);
 void load_config(const std::string& filename, std::map<std::string, ov::AnyMap>& config);
 
+/// @brief An entry of the shape trace: the data shape group of the request and the time since the previous request
+struct ShapeTraceEntry {
+    size_t group;
+    /// The inter-arrival time in milliseconds, negative when the trace doesn't set it
+    double interval_ms;
+};
+
+/// @brief Reads the trace of the input shapes, a line per request as "<data shapes> [<inter-arrival time in ms>]"
+/// @return The -data_shape string with the groups of the distinct shapes of the trace in the order of appearance
+std::string parse_shape_trace(const std::string& filename, std::vector<ShapeTraceEntry>& trace);
+
+/// @brief Prints the achieved GFLOP/s and GB/s of the layers of the runtime model with the work estimated by the device
+/// @param peaks The peak GFLOP/s and GB/s of the device as "<GFLOP/s>,<GB/s>", the roofline isn't reported for 0
+void print_roofline(const std::shared_ptr<const ov::Model>& runtime_model, const std::string& peaks);
+
 std::string get_extension(const std::string& name);
 bool is_binary_file(const std::string& filePath);
 bool is_numpy_file(const std::string& filePath);
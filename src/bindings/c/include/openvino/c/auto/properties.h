@@ -31,4 +31,11 @@ ov_property_key_intel_auto_enable_startup_fallback;
  * @ingroup ov_property_c_api
  */
 OPENVINO_C_VAR(const char*)
-ov_property_key_intel_auto_enable_runtime_fallback;
\ No newline at end of file
+ov_property_key_intel_auto_enable_runtime_fallback;
+
+/**
+ * @brief Read-write property<string> to allocate the tensors of the requests in the host memory shared by the devices
+ * @ingroup ov_property_c_api
+ */
+OPENVINO_C_VAR(const char*)
+ov_property_key_intel_auto_shared_host_tensors;
\ No newline at end of file
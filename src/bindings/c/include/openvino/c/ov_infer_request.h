@@ -21,6 +21,13 @@
  */
 typedef struct ov_infer_request ov_infer_request_t;
 
+/**
+ * @struct ov_completion_queue_t
+ * @ingroup ov_infer_request_c_api
+ * @brief type define ov_completion_queue_t from ov_completion_queue
+ */
+typedef struct ov_completion_queue ov_completion_queue_t;
+
 /**
  * @struct ov_callback_t
  * @ingroup ov_infer_request_c_api
@@ -289,6 +296,65 @@ ov_infer_request_wait_for(ov_infer_request_t* infer_request, const int64_t timeo
 OPENVINO_C_API(ov_status_e)
 ov_infer_request_set_callback(ov_infer_request_t* infer_request, const ov_callback_t* callback);
 
+/**
+ * @brief Create a queue the infer requests submitted to it are put into when their inference is done.
+ * The requests are put into the queue without locks, so many requests are served by one thread polling the queue.
+ * @ingroup ov_infer_request_c_api
+ * @param queue A pointer to the newly created ov_completion_queue_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_completion_queue_create(ov_completion_queue_t** queue);
+
+/**
+ * @brief Start inference of the specified infer request in asynchronous mode, the request is put into the queue when
+ * the inference is done. The queue replaces the callback of the request until another callback is set.
+ * @ingroup ov_infer_request_c_api
+ * @param queue A pointer to the ov_completion_queue_t, it must outlive the inference of the submitted requests.
+ * @param infer_request A pointer to the ov_infer_request_t.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_completion_queue_submit(ov_completion_queue_t* queue, ov_infer_request_t* infer_request);
+
+/**
+ * @brief Take the infer requests done since the previous call in the order of completion. The inference status of
+ * a taken request is returned by ov_infer_request_wait without blocking. Only one thread may poll the queue at a time.
+ * @ingroup ov_infer_request_c_api
+ * @param queue A pointer to the ov_completion_queue_t.
+ * @param infer_requests The array the done requests are written to.
+ * @param capacity The max number of the requests written to the array, the rest are taken by the next calls.
+ * @param timeout Maximum duration, in milliseconds, to block for until a request is done, 0 doesn't block and
+ * a negative value blocks until a request is done.
+ * @param count The number of the requests written to the array, 0 if the timeout has elapsed.
+ * @return Status code of the operation: OK(0) for success.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_completion_queue_poll(ov_completion_queue_t* queue,
+                         ov_infer_request_t** infer_requests,
+                         const size_t capacity,
+                         const int64_t timeout,
+                         size_t* count);
+
+/**
+ * @brief Get the eventfd file descriptor, which is readable while there are done requests in the queue, to wait for
+ * the queue in an event loop with poll/epoll. The descriptor is owned by the queue. Only on Linux.
+ * @ingroup ov_infer_request_c_api
+ * @param queue A pointer to the ov_completion_queue_t.
+ * @param fd The file descriptor.
+ * @return Status code of the operation: OK(0) for success, NOT_IMPLEMENT_C_METHOD on the other platforms.
+ */
+OPENVINO_C_API(ov_status_e)
+ov_completion_queue_get_fd(const ov_completion_queue_t* queue, int* fd);
+
+/**
+ * @brief Release the memory allocated by ov_completion_queue_t.
+ * @ingroup ov_infer_request_c_api
+ * @param queue A pointer to the ov_completion_queue_t to free memory.
+ */
+OPENVINO_C_API(void)
+ov_completion_queue_free(ov_completion_queue_t* queue);
+
 /**
  * @brief Release the memory allocated by ov_infer_request_t.
  * @ingroup ov_infer_request_c_api
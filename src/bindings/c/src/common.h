@@ -3,10 +3,15 @@
 //
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <iterator>
 #include <map>
+#include <mutex>
 #include <streambuf>
 #include <string>
 
@@ -96,6 +101,28 @@ struct ov_compiled_model {
  */
 struct ov_infer_request {
     std::shared_ptr<ov::InferRequest> object;
+    // the queue the callback of the request puts it into
+    struct ov_completion_queue* queue = nullptr;
+};
+
+/**
+ * @struct ov_completion_queue
+ * @brief This is a queue of the done infer requests
+ */
+struct ov_completion_queue {
+    struct node {
+        ov_infer_request* request;
+        node* next;
+    };
+    // the requests pushed by the callbacks in the reversed order of completion
+    std::atomic<node*> pushed{nullptr};
+    // the requests taken by the poller in the order of completion
+    std::deque<ov_infer_request*> taken;
+    // the number of the pollers blocked on the condition variable
+    std::atomic<int> waiters{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+    int event_fd = -1;
 };
 
 /**
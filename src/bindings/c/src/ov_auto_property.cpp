@@ -8,3 +8,4 @@
 const char* ov_property_key_intel_auto_device_bind_buffer = "DEVICE_BIND_BUFFER";
 const char* ov_property_key_intel_auto_enable_startup_fallback = "ENABLE_STARTUP_FALLBACK";
 const char* ov_property_key_intel_auto_enable_runtime_fallback = "ENABLE_RUNTIME_FALLBACK";
+const char* ov_property_key_intel_auto_shared_host_tensors = "SHARED_HOST_TENSORS";
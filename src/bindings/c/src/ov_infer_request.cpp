@@ -5,6 +5,11 @@
 
 #include "common.h"
 
+#ifdef __linux__
+#    include <sys/eventfd.h>
+#    include <unistd.h>
+#endif
+
 void ov_infer_request_free(ov_infer_request_t* infer_request) {
     if (infer_request)
         delete infer_request;
@@ -308,6 +313,7 @@ ov_status_e ov_infer_request_set_callback(ov_infer_request_t* infer_request, con
             callback->callback_func(callback->args);
         };
         infer_request->object->set_callback(func);
+        infer_request->queue = nullptr;
     }
     CATCH_OV_EXCEPTIONS
 
@@ -358,3 +364,145 @@ void ov_profiling_info_list_free(ov_profiling_info_list_t* profiling_infos) {
     profiling_infos->profiling_infos = nullptr;
     profiling_infos->size = 0;
 }
+
+ov_status_e ov_completion_queue_create(ov_completion_queue_t** queue) {
+    if (!queue) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        std::unique_ptr<ov_completion_queue_t> _queue(new ov_completion_queue_t);
+#ifdef __linux__
+        _queue->event_fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+        if (_queue->event_fd < 0) {
+            return ov_status_e::GENERAL_ERROR;
+        }
+#endif
+        *queue = _queue.release();
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+static void notify_completion_queue(ov_completion_queue_t* queue) {
+#ifdef __linux__
+    const uint64_t one = 1;
+    (void)!write(queue->event_fd, &one, sizeof(one));
+#endif
+}
+
+static void push_completed_request(ov_completion_queue_t* queue, ov_infer_request_t* infer_request) {
+    auto node = new ov_completion_queue::node{infer_request, queue->pushed.load(std::memory_order_relaxed)};
+    while (!queue->pushed.compare_exchange_weak(node->next, node)) {
+    }
+    // the lock is taken only to not miss a poller going to sleep
+    if (queue->waiters.load() > 0) {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        queue->cv.notify_one();
+    }
+    notify_completion_queue(queue);
+}
+
+static void take_completed_requests(ov_completion_queue_t* queue) {
+    auto node = queue->pushed.exchange(nullptr);
+    ov_completion_queue::node* reversed = nullptr;
+    while (node) {
+        auto next = node->next;
+        node->next = reversed;
+        reversed = node;
+        node = next;
+    }
+    while (reversed) {
+        auto next = reversed->next;
+        queue->taken.push_back(reversed->request);
+        delete reversed;
+        reversed = next;
+    }
+}
+
+ov_status_e ov_completion_queue_submit(ov_completion_queue_t* queue, ov_infer_request_t* infer_request) {
+    if (!queue || !infer_request) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+        // the callback is set once while the request keeps reporting to the same queue
+        if (infer_request->queue != queue) {
+            infer_request->object->set_callback([queue, infer_request](std::exception_ptr) {
+                push_completed_request(queue, infer_request);
+            });
+            infer_request->queue = queue;
+        }
+        infer_request->object->start_async();
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_completion_queue_poll(ov_completion_queue_t* queue,
+                                     ov_infer_request_t** infer_requests,
+                                     const size_t capacity,
+                                     const int64_t timeout,
+                                     size_t* count) {
+    if (!queue || !infer_requests || !count) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+
+    try {
+#ifdef __linux__
+        // the event counter is cleared before taking the requests, so a request pushed later makes it readable again
+        uint64_t events = 0;
+        (void)!read(queue->event_fd, &events, sizeof(events));
+#endif
+        take_completed_requests(queue);
+        if (queue->taken.empty() && timeout != 0) {
+            std::unique_lock<std::mutex> lock(queue->mutex);
+            ++queue->waiters;
+            auto pushed = [queue] {
+                return queue->pushed.load() != nullptr;
+            };
+            if (timeout < 0)
+                queue->cv.wait(lock, pushed);
+            else
+                queue->cv.wait_for(lock, std::chrono::milliseconds(timeout), pushed);
+            --queue->waiters;
+            lock.unlock();
+            take_completed_requests(queue);
+        }
+
+        *count = std::min(capacity, queue->taken.size());
+        std::copy_n(queue->taken.begin(), *count, infer_requests);
+        queue->taken.erase(queue->taken.begin(), queue->taken.begin() + *count);
+        // the requests left for the next calls keep the descriptor readable
+        if (!queue->taken.empty())
+            notify_completion_queue(queue);
+    }
+    CATCH_OV_EXCEPTIONS
+
+    return ov_status_e::OK;
+}
+
+ov_status_e ov_completion_queue_get_fd(const ov_completion_queue_t* queue, int* fd) {
+    if (!queue || !fd) {
+        return ov_status_e::INVALID_C_PARAM;
+    }
+#ifdef __linux__
+    *fd = queue->event_fd;
+    return ov_status_e::OK;
+#else
+    return ov_status_e::NOT_IMPLEMENT_C_METHOD;
+#endif
+}
+
+void ov_completion_queue_free(ov_completion_queue_t* queue) {
+    if (!queue) {
+        return;
+    }
+    take_completed_requests(queue);
+#ifdef __linux__
+    close(queue->event_fd);
+#endif
+    delete queue;
+}
@@ -387,6 +387,34 @@ TEST_P(ov_infer_request_test, infer_request_set_callback) {
     }
 }
 
+TEST_P(ov_infer_request_test, infer_completion_queue) {
+    OV_EXPECT_OK(ov_infer_request_set_input_tensor_by_index(infer_request, 0, input_tensor));
+
+    ov_completion_queue_t* queue = nullptr;
+    OV_ASSERT_OK(ov_completion_queue_create(&queue));
+    EXPECT_NE(nullptr, queue);
+
+    ov_infer_request_t* completed[2] = {nullptr, nullptr};
+    size_t count = 0;
+    OV_EXPECT_OK(ov_completion_queue_poll(queue, completed, 2, 0, &count));
+    EXPECT_EQ(0, count);
+
+    for (size_t i = 0; i < 2; i++) {
+        OV_ASSERT_OK(ov_completion_queue_submit(queue, infer_request));
+        OV_EXPECT_OK(ov_completion_queue_poll(queue, completed, 2, -1, &count));
+        EXPECT_EQ(1, count);
+        EXPECT_EQ(infer_request, completed[0]);
+        OV_EXPECT_OK(ov_infer_request_wait(completed[0]));
+
+        OV_EXPECT_OK(ov_infer_request_get_output_tensor_by_index(completed[0], 0, &output_tensor));
+        EXPECT_NE(nullptr, output_tensor);
+        ov_tensor_free(output_tensor);
+        output_tensor = nullptr;
+    }
+
+    ov_completion_queue_free(queue);
+}
+
 TEST_P(ov_infer_request_test, get_profiling_info) {
     auto device_name = GetParam();
     OV_EXPECT_OK(ov_infer_request_set_tensor(infer_request, in_tensor_name, input_tensor));
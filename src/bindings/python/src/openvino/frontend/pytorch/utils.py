@@ -9,7 +9,7 @@ import torch
 import numpy as np
 import ctypes
 
-from openvino.runtime import op, Type as OVType, Shape, Tensor
+from openvino.runtime import op, Type as OVType, Shape
 from openvino.runtime import opset11 as ops
 
 
@@ -62,11 +62,11 @@ def get_type_from_py_type(value):
 def torch_tensor_to_ov_const(torch_t: torch.Tensor, shared_memory=True):
     torch_t = torch_t.contiguous()
     if torch_t.dtype == torch.bfloat16:
-        # reinterpret bfloat16 data as float16 to allow conversion to numpy
+        # reinterpret bfloat16 data as float16 to allow conversion to numpy, the shared
+        # constant keeps the array and so the torch storage alive
         torch_t = torch_t.view(torch.float16)
         narr = torch_t.numpy(force=True)
-        tensor = Tensor(narr, torch_t.shape, OVType.bf16)
-        ov_const = op.Constant(tensor, shared_memory=shared_memory)
+        ov_const = op.Constant(narr, OVType.bf16, shared_memory=shared_memory)
     else:
         narr = torch_t.numpy(force=True)
         ov_const = op.Constant(narr, shared_memory=shared_memory)
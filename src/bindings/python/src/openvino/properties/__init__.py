@@ -9,6 +9,7 @@ from openvino._pyopenvino.properties import Affinity
 from openvino._pyopenvino.properties import enable_profiling
 from openvino._pyopenvino.properties import cache_dir
 from openvino._pyopenvino.properties import auto_batch_timeout
+from openvino._pyopenvino.properties import auto_batch_latency_slo
 from openvino._pyopenvino.properties import num_streams
 from openvino._pyopenvino.properties import inference_num_threads
 from openvino._pyopenvino.properties import compilation_num_threads
@@ -5,3 +5,4 @@
 from openvino._pyopenvino.properties.intel_auto import device_bind_buffer
 from openvino._pyopenvino.properties.intel_auto import enable_startup_fallback
 from openvino._pyopenvino.properties.intel_auto import enable_runtime_fallback
+from openvino._pyopenvino.properties.intel_auto import shared_host_tensors
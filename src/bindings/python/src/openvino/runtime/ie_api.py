@@ -2,7 +2,7 @@
 # Copyright (C) 2018-2023 Intel Corporation
 # SPDX-License-Identifier: Apache-2.0
 
-from typing import Any, Iterable, Union, Optional, Dict
+from typing import Any, Iterable, Iterator, Union, Optional, Dict
 from pathlib import Path
 import warnings
 
@@ -468,6 +468,7 @@ class AsyncInferQueue(AsyncInferQueueBase):
                               Keeps Tensor inputs "as-is".
 
                               Note: Use with extra care, shared data can be modified during runtime!
+                              The inputs should not be modified until the InferRequest is completed.
                               Note: Using `share_inputs` may result in extra memory overhead.
 
                               Default value: False
@@ -491,6 +492,45 @@ class AsyncInferQueue(AsyncInferQueueBase):
             userdata,
         )
 
+    def imap(self, inputs: Iterable[Any], share_inputs: bool = False) -> Iterator[OVDict]:
+        """Run asynchronous inference of each item of `inputs` using the pool and yield the results.
+
+        The items are started as soon as there is an idle InferRequest in the pool
+        and the results are yielded in the order of the items, so the results can be
+        consumed in a loop without writing a callback. The callback of the pool is
+        replaced.
+
+        .. code-block:: python
+
+            for result in async_infer_queue.imap(images):
+                print(result[0])
+
+        :param inputs: Items that are passed as the `inputs` of `start_async`.
+        :type inputs: Iterable[Any]
+        :param share_inputs: Enables `share_inputs` mode, the same as in `start_async`.
+
+                              Default value: False
+        :type share_inputs: bool, optional
+        :return: Generator of the copies of the results of the items.
+        :rtype: Iterator[openvino.runtime.utils.data_helpers.OVDict]
+        """
+        results: Dict[int, OVDict] = {}
+
+        def callback(request: _InferRequestWrapper, index: int) -> None:
+            results[index] = OVDict(request.results)
+
+        self.set_callback(callback)
+        next_index = 0
+        for index, item in enumerate(inputs):
+            self.start_async(item, index, share_inputs=share_inputs)
+            while next_index in results:
+                yield results.pop(next_index)
+                next_index += 1
+        self.wait_all()
+        while next_index in results:
+            yield results.pop(next_index)
+            next_index += 1
+
 
 class Core(CoreBase):
     """Core class represents OpenVINO runtime Core entity.
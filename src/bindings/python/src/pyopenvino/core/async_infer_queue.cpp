@@ -151,10 +151,89 @@ public:
         }
     }
 
+    void set_batch_callbacks(py::function f_callback, size_t batch_size) {
+        OPENVINO_ASSERT(batch_size > 0, "The batch size of the AsyncInferQueue callback should be positive.");
+        for (size_t handle = 0; handle < m_requests.size(); handle++) {
+            m_requests[handle].m_request.set_callback(
+                [this, f_callback, batch_size, handle](std::exception_ptr exception_ptr) {
+                    *m_requests[handle].m_end_time = Time::now();
+                    std::vector<size_t> batch;
+                    {
+                        // acquire the mutex to access m_idle_handles and m_completed_handles
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        if (exception_ptr) {
+                            m_idle_handles.push(handle);
+                        } else {
+                            m_completed_handles.push_back(handle);
+                        }
+                        batch = take_batch(batch_size);
+                    }
+                    if (exception_ptr) {
+                        m_cv.notify_one();
+                    }
+                    if (!batch.empty()) {
+                        {
+                            // Acquire GIL once for the whole batch, execute Python function
+                            py::gil_scoped_acquire acquire;
+                            try {
+                                py::list completed;
+                                for (auto completed_handle : batch) {
+                                    completed.append(
+                                        py::make_tuple(m_requests[completed_handle], m_user_ids[completed_handle]));
+                                }
+                                f_callback(completed);
+                            } catch (const py::error_already_set& py_error) {
+                                assert(py_error.type());
+                                // acquire the mutex to access m_errors
+                                std::lock_guard<std::mutex> lock(m_mutex);
+                                m_errors.push(py_error);
+                            }
+                        }
+                        {
+                            // acquire the mutex to access m_idle_handles
+                            std::lock_guard<std::mutex> lock(m_mutex);
+                            for (auto completed_handle : batch) {
+                                m_idle_handles.push(completed_handle);
+                            }
+                            m_delivered_handles -= batch.size();
+                        }
+                        // Notify locks in getIdleRequestId()
+                        m_cv.notify_all();
+                    }
+
+                    try {
+                        if (exception_ptr) {
+                            std::rethrow_exception(exception_ptr);
+                        }
+                    } catch (const std::exception& e) {
+                        OPENVINO_THROW(e.what());
+                    }
+                });
+        }
+    }
+
+    // Takes the completed requests to deliver to the batch callback, m_mutex should be locked. The batch is taken
+    // when it is full or when no other request is running, so the requests held by a partial batch are always
+    // delivered and returned to the pool, even if no more requests are started.
+    std::vector<size_t> take_batch(size_t batch_size) {
+        const size_t running =
+            m_requests.size() - m_idle_handles.size() - m_completed_handles.size() - m_delivered_handles;
+        if (m_completed_handles.empty() || (m_completed_handles.size() < batch_size && running > 0))
+            return {};
+        std::vector<size_t> batch;
+        batch.swap(m_completed_handles);
+        m_delivered_handles += batch.size();
+        return batch;
+    }
+
     // AsyncInferQueue is the owner of all requests. When AsyncInferQueue is destroyed,
     // all of requests are destroyed as well.
     std::vector<InferRequestWrapper> m_requests;
     std::queue<size_t> m_idle_handles;
+    // the requests completed while the batch callback is set, waiting for the batch to be delivered
+    std::vector<size_t> m_completed_handles;
+    // the number of the requests being delivered to the batch callback
+    size_t m_delivered_handles = 0;
     std::vector<py::object> m_user_ids;  // user ID can be any Python object
     std::mutex m_mutex;
     std::condition_variable m_cv;
@@ -318,6 +397,37 @@ void regclass_AsyncInferQueue(py::module m) {
             :type callback: function
         )");
 
+    cls.def("set_batch_callback",
+            &AsyncInferQueue::set_batch_callbacks,
+            py::arg("callback"),
+            py::arg("batch_size"),
+            R"(
+            Sets unified callback on all InferRequests from queue's pool, which is called
+            with the completed InferRequests in batches.
+
+            The callback takes one argument, the list of (InferRequest, userdata) pairs.
+            The GIL is acquired once per batch instead of once per InferRequest, which
+            reduces the overhead of the callbacks at high request rates.
+
+            A batch is delivered when `batch_size` InferRequests are completed or when
+            no other InferRequest of the pool is running. The InferRequests of a batch
+            return to the pool after the callback returns, the failed ones are not
+            delivered.
+
+            .. code-block:: python
+
+                def f(completed):
+                    for request, userdata in completed:
+                        print(request.output_tensors[0], userdata)
+
+                async_infer_queue.set_batch_callback(f, 8)
+
+            :param callback: Any Python defined function that matches callback's requirements.
+            :type callback: function
+            :param batch_size: Number of the completed InferRequests delivered at once.
+            :type batch_size: int
+        )");
+
     cls.def(
         "__len__",
         [](AsyncInferQueue& self) {
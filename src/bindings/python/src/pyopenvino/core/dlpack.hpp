@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+
+// The ABI of the DLPack tensor exchange protocol, version 0.8 (https://github.com/dmlc/dlpack).
+// The structures are exchanged through the "dltensor" PyCapsule returned by __dlpack__().
+
+namespace dlpack {
+
+enum DLDeviceType : int32_t {
+    kDLCPU = 1,
+    kDLCUDAHost = 3,
+    kDLROCMHost = 11,
+    kDLCUDAManaged = 13,
+};
+
+enum DLDataTypeCode : uint8_t {
+    kDLInt = 0U,
+    kDLUInt = 1U,
+    kDLFloat = 2U,
+    kDLBfloat = 4U,
+    kDLBool = 6U,
+};
+
+struct DLDevice {
+    int32_t device_type;
+    int32_t device_id;
+};
+
+struct DLDataType {
+    uint8_t code;
+    uint8_t bits;
+    uint16_t lanes;
+};
+
+struct DLTensor {
+    void* data;
+    DLDevice device;
+    int32_t ndim;
+    DLDataType dtype;
+    int64_t* shape;
+    // in elements, nullptr for the compact row-major tensor
+    int64_t* strides;
+    uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+    DLTensor dl_tensor;
+    void* manager_ctx;
+    void (*deleter)(DLManagedTensor* self);
+};
+
+}  // namespace dlpack
@@ -7,11 +7,172 @@
 #include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 
+#include <cstring>
+#include <map>
+#include <memory>
+#include <vector>
+
 #include "openvino/runtime/tensor.hpp"
 #include "pyopenvino/core/common.hpp"
+#include "pyopenvino/core/dlpack.hpp"
 
 namespace py = pybind11;
 
+namespace {
+
+const std::map<ov::element::Type, dlpack::DLDataType>& dlpack_types() {
+    static const std::map<ov::element::Type, dlpack::DLDataType> types = {
+        {ov::element::boolean, {dlpack::kDLBool, 8, 1}},
+        {ov::element::i8, {dlpack::kDLInt, 8, 1}},
+        {ov::element::i16, {dlpack::kDLInt, 16, 1}},
+        {ov::element::i32, {dlpack::kDLInt, 32, 1}},
+        {ov::element::i64, {dlpack::kDLInt, 64, 1}},
+        {ov::element::u8, {dlpack::kDLUInt, 8, 1}},
+        {ov::element::u16, {dlpack::kDLUInt, 16, 1}},
+        {ov::element::u32, {dlpack::kDLUInt, 32, 1}},
+        {ov::element::u64, {dlpack::kDLUInt, 64, 1}},
+        {ov::element::f16, {dlpack::kDLFloat, 16, 1}},
+        {ov::element::f32, {dlpack::kDLFloat, 32, 1}},
+        {ov::element::f64, {dlpack::kDLFloat, 64, 1}},
+        {ov::element::bf16, {dlpack::kDLBfloat, 16, 1}},
+    };
+    return types;
+}
+
+ov::element::Type element_type_from_dlpack(const dlpack::DLDataType& type) {
+    for (const auto& item : dlpack_types()) {
+        if (item.second.code == type.code && item.second.bits == type.bits && item.second.lanes == type.lanes) {
+            return item.first;
+        }
+    }
+    OPENVINO_THROW("DLPack data type with code ",
+                   static_cast<int>(type.code),
+                   ", ",
+                   static_cast<int>(type.bits),
+                   " bits and ",
+                   type.lanes,
+                   " lanes is not supported.");
+}
+
+// Keeps the exported tensor alive until the consumer calls the deleter
+struct DLPackExportContext {
+    ov::Tensor tensor;
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+    dlpack::DLManagedTensor managed;
+};
+
+py::capsule tensor_to_dlpack(const ov::Tensor& tensor) {
+    const auto& type = tensor.get_element_type();
+    const auto dl_type = dlpack_types().find(type);
+    OPENVINO_ASSERT(dl_type != dlpack_types().end(), "Tensor of ", type, " element type can't be exported to DLPack.");
+
+    std::unique_ptr<DLPackExportContext> context(new DLPackExportContext{tensor, {}, {}, {}});
+    const auto& shape = tensor.get_shape();
+    context->shape.assign(shape.begin(), shape.end());
+    for (const auto& stride : tensor.get_strides()) {
+        context->strides.push_back(static_cast<int64_t>(stride / type.size()));
+    }
+    auto& dl_tensor = context->managed.dl_tensor;
+    dl_tensor.data = tensor.data();
+    dl_tensor.device = {dlpack::kDLCPU, 0};
+    dl_tensor.ndim = static_cast<int32_t>(shape.size());
+    dl_tensor.dtype = dl_type->second;
+    dl_tensor.shape = context->shape.data();
+    dl_tensor.strides = context->strides.data();
+    dl_tensor.byte_offset = 0;
+    context->managed.manager_ctx = context.get();
+    context->managed.deleter = [](dlpack::DLManagedTensor* self) {
+        delete static_cast<DLPackExportContext*>(self->manager_ctx);
+    };
+
+    PyObject* capsule = PyCapsule_New(&context->managed, "dltensor", [](PyObject* capsule) {
+        // the consumer renames the capsule to "used_dltensor" and calls the deleter itself
+        if (PyCapsule_IsValid(capsule, "dltensor")) {
+            auto managed = static_cast<dlpack::DLManagedTensor*>(PyCapsule_GetPointer(capsule, "dltensor"));
+            managed->deleter(managed);
+        }
+    });
+    if (capsule == nullptr) {
+        throw py::error_already_set();
+    }
+    context.release();
+    return py::reinterpret_steal<py::capsule>(capsule);
+}
+
+// Memory of an imported DLPack tensor, the producer's deleter is called when the last tensor using it is destroyed
+struct DLPackAllocator {
+    std::shared_ptr<dlpack::DLManagedTensor> owner;
+    void* data;
+    size_t byte_size;
+
+    void* allocate(const size_t bytes, const size_t) {
+        OPENVINO_ASSERT(bytes <= byte_size, "Tensor imported from DLPack can't be enlarged.");
+        return data;
+    }
+    void deallocate(void*, const size_t, const size_t) {}
+    bool is_equal(const DLPackAllocator& other) const {
+        return owner == other.owner;
+    }
+};
+
+ov::Tensor tensor_from_dlpack(const py::object& object) {
+    const py::object capsule = py::hasattr(object, "__dlpack__") ? object.attr("__dlpack__")() : object;
+    OPENVINO_ASSERT(PyCapsule_IsValid(capsule.ptr(), "dltensor"),
+                    "Object should implement __dlpack__() or be a DLPack capsule which is not consumed yet.");
+    auto managed = static_cast<dlpack::DLManagedTensor*>(PyCapsule_GetPointer(capsule.ptr(), "dltensor"));
+    // the tensor is owned from now on
+    PyCapsule_SetName(capsule.ptr(), "used_dltensor");
+    std::shared_ptr<dlpack::DLManagedTensor> owner(managed, [](dlpack::DLManagedTensor* self) {
+        if (self->deleter) {
+            self->deleter(self);
+        }
+    });
+
+    const auto& dl_tensor = managed->dl_tensor;
+    const auto device_type = dl_tensor.device.device_type;
+    OPENVINO_ASSERT(device_type == dlpack::kDLCPU || device_type == dlpack::kDLCUDAHost ||
+                        device_type == dlpack::kDLROCMHost || device_type == dlpack::kDLCUDAManaged,
+                    "Only DLPack tensors in the host memory can be imported, the device type is ",
+                    device_type,
+                    ".");
+    const auto type = element_type_from_dlpack(dl_tensor.dtype);
+    const ov::Shape shape(dl_tensor.shape, dl_tensor.shape + dl_tensor.ndim);
+    auto data = static_cast<uint8_t*>(dl_tensor.data) + dl_tensor.byte_offset;
+
+    // the strides of the dimensions of size 1 are not significant
+    bool is_compact = true;
+    std::vector<int64_t> byte_strides(shape.size());
+    int64_t compact_stride = 1;
+    for (size_t i = shape.size(); i > 0; --i) {
+        const auto stride = dl_tensor.strides ? dl_tensor.strides[i - 1] : compact_stride;
+        is_compact = is_compact && (shape[i - 1] == 1 || stride == compact_stride);
+        byte_strides[i - 1] = stride * static_cast<int64_t>(type.size());
+        compact_stride *= static_cast<int64_t>(shape[i - 1]);
+    }
+    if (is_compact) {
+        return ov::Tensor(type, shape, DLPackAllocator{owner, data, ov::shape_size(shape) * type.size()});
+    }
+
+    // the strided (e.g. transposed) tensors are copied
+    ov::Tensor tensor(type, shape);
+    auto dst = static_cast<uint8_t*>(tensor.data());
+    std::vector<size_t> index(shape.size(), 0);
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        int64_t offset = 0;
+        for (size_t axis = 0; axis < shape.size(); ++axis) {
+            offset += static_cast<int64_t>(index[axis]) * byte_strides[axis];
+        }
+        std::memcpy(dst + i * type.size(), data + offset, type.size());
+        for (size_t axis = shape.size(); axis > 0 && ++index[axis - 1] == shape[axis - 1]; --axis) {
+            index[axis - 1] = 0;
+        }
+    }
+    return tensor;
+}
+
+}  // namespace
+
 void regclass_Tensor(py::module m) {
     py::class_<ov::Tensor, std::shared_ptr<ov::Tensor>> cls(m, "Tensor");
     cls.doc() = "openvino.runtime.Tensor holding either copy of memory or shared host memory.";
@@ -335,6 +496,51 @@ void regclass_Tensor(py::module m) {
             Tensor's shape get/set.
         )");
 
+    cls.def_static("from_dlpack",
+                   &tensor_from_dlpack,
+                   py::arg("tensor"),
+                   R"(
+                    Creates Tensor from an object supporting the DLPack protocol, e.g. torch.Tensor,
+                    jax.Array or numpy.ndarray, or from a DLPack capsule.
+
+                    The host memory of the compact row-major tensors is shared with the producer
+                    without a copy and is kept alive while the Tensor exists. Any action performed
+                    on the producer's memory is reflected on this Tensor's memory!
+                    The strided tensors are copied. The device memory is not supported.
+
+                    :param tensor: Object implementing `__dlpack__` or a DLPack capsule.
+                    :type tensor: Any
+                    :rtype: openvino.runtime.Tensor
+                )");
+
+    cls.def(
+        "__dlpack__",
+        [](const ov::Tensor& self, py::object stream) {
+            OPENVINO_ASSERT(stream.is_none(), "Tensor is in the host memory, the stream should be None.");
+            return tensor_to_dlpack(self);
+        },
+        py::arg("stream") = py::none(),
+        R"(
+            Exports Tensor's memory as a DLPack capsule without a copy, so the Tensor can be
+            consumed by e.g. torch.from_dlpack or numpy.from_dlpack. The Tensor's memory is
+            kept alive while the consumer uses it.
+
+            :param stream: Should be None for the host memory.
+            :type stream: None
+            :rtype: PyCapsule
+        )");
+
+    cls.def(
+        "__dlpack_device__",
+        [](const ov::Tensor&) {
+            return py::make_tuple(static_cast<int>(dlpack::kDLCPU), 0);
+        },
+        R"(
+            Returns the DLPack device of Tensor's memory, the host memory (kDLCPU, 0).
+
+            :rtype: Tuple[int, int]
+        )");
+
     cls.def("__repr__", [](const ov::Tensor& self) {
         std::stringstream ss;
 
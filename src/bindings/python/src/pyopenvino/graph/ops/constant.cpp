@@ -106,6 +106,38 @@ void regclass_graph_op_Constant(py::module m) {
                  }),
                  py::arg("array"),
                  py::arg("shared_memory") = false);
+    // Numpy-based constructor reinterpreting the data as the element type of the same size, e.g. bfloat16 which is
+    // not supported by numpy. The shared memory keeps the array alive, unlike the Constant created from a Tensor
+    // wrapping the array.
+    constant.def(py::init([](py::array& array, const ov::element::Type& type, bool shared_memory) {
+                     OPENVINO_ASSERT(type.size() == static_cast<size_t>(array.itemsize()),
+                                     "The element type ",
+                                     type,
+                                     " doesn't match the size of the array items: ",
+                                     array.itemsize());
+                     if (!shared_memory) {
+                         if (!Common::array_helpers::is_contiguous(array)) {
+                             array = Common::array_helpers::as_contiguous(array,
+                                                                           Common::array_helpers::get_ov_type(array));
+                         }
+                         return ov::op::v0::Constant(type,
+                                                     Common::array_helpers::get_shape(array),
+                                                     array.ndim() == 0 ? array.data() : array.data(0));
+                     }
+                     OPENVINO_ASSERT(Common::array_helpers::is_contiguous(array),
+                                     "SHARED MEMORY MODE FOR THIS CONSTANT IS NOT APPLICABLE! Passed numpy array must "
+                                     "be C contiguous.");
+                     OPENVINO_SUPPRESS_DEPRECATED_START
+                     auto memory = std::make_shared<ngraph::runtime::SharedBuffer<py::array>>(
+                         static_cast<char*>(array.ndim() == 0 ? array.mutable_data() : array.mutable_data(0)),
+                         array.ndim() == 0 ? array.itemsize() : array.nbytes(),
+                         array);
+                     return ov::op::v0::Constant(type, Common::array_helpers::get_shape(array), memory);
+                     OPENVINO_SUPPRESS_DEPRECATED_END
+                 }),
+                 py::arg("array"),
+                 py::arg("type"),
+                 py::arg("shared_memory") = false);
     // Tensor-based constructors
     constant.def(py::init([](ov::Tensor& tensor, bool shared_memory) {
                      return Common::object_from_data<ov::op::v0::Constant>(tensor, shared_memory);
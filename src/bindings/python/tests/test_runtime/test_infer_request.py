@@ -639,6 +639,66 @@ def test_infer_queue_fail_in_inference(device, with_callback):
     assert "Can not clone with new dims" in str(e.value)
 
 
+@pytest.mark.parametrize("batch_size", [1, 3, 16])
+def test_infer_queue_batch_callback(device, batch_size):
+    jobs = 10
+    num_request = 4
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, num_request)
+    jobs_done = [False for _ in range(jobs)]
+    batches = []
+
+    def callback(completed):
+        batches.append(len(completed))
+        for request, job_id in completed:
+            assert len(request.results) == 1
+            jobs_done[job_id] = True
+
+    infer_queue.set_batch_callback(callback, batch_size)
+    for i in range(jobs):
+        infer_queue.start_async({"data": generate_image()}, i)
+    infer_queue.wait_all()
+    assert all(jobs_done)
+    assert sum(batches) == jobs
+    assert max(batches) <= min(batch_size, num_request)
+
+
+def test_infer_queue_batch_callback_fail_on_py_model(device):
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 2)
+
+    def callback(completed):
+        completed = completed + 21
+
+    infer_queue.set_batch_callback(callback, 2)
+    with pytest.raises(TypeError) as e:
+        for _ in range(4):
+            infer_queue.start_async({"data": generate_image()})
+        infer_queue.wait_all()
+
+    assert "can only concatenate list" in str(e.value)
+
+
+def test_infer_queue_imap(device):
+    jobs = 10
+    core = Core()
+    model = get_relu_model()
+    compiled_model = core.compile_model(model, device)
+    infer_queue = AsyncInferQueue(compiled_model, 4)
+    images = [(generate_image() - 0.5) * (i + 1) for i in range(jobs)]
+
+    results = list(infer_queue.imap({"data": image} for image in images))
+
+    assert len(results) == jobs
+    request = compiled_model.create_infer_request()
+    for image, result in zip(images, results):
+        assert np.allclose(request.infer({0: image})[0], result[0])
+
+
 def test_infer_queue_get_idle_handle(device):
     param = ops.parameter([10])
     model = Model(ops.relu(param), [param])
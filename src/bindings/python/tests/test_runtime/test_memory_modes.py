@@ -91,6 +91,31 @@ def test_with_external_memory(cls, shared_flag):
         assert not (np.shares_memory(external_object.to_numpy(), ov_object.data))
 
 
+@pytest.mark.parametrize("shared_flag", [True, False])
+def test_constant_with_numpy_memory_as_type(shared_flag):
+    # float16 array reinterpreted as bfloat16, which is not supported by numpy
+    arr = np.ascontiguousarray(generate_image().astype(np.float16))
+    ov_object = Constant(arr, ov.Type.bf16, shared_memory=shared_flag)
+
+    assert ov_object.get_element_type() == ov.Type.bf16
+    assert tuple(ov_object.shape) == arr.shape
+    assert np.array_equal(ov_object.data.view(np.uint16), arr.view(np.uint16))
+
+    if shared_flag is True:
+        assert np.shares_memory(arr, ov_object.data)
+    else:
+        assert not (np.shares_memory(arr, ov_object.data))
+
+
+def test_constant_with_numpy_memory_as_type_of_other_size():
+    arr = np.ascontiguousarray(generate_image().astype(np.float32))
+
+    with pytest.raises(RuntimeError) as e:
+        _ = Constant(arr, ov.Type.bf16, shared_memory=True)
+
+    assert "doesn't match the size of the array items" in str(e.value)
+
+
 @pytest.mark.parametrize("cls", [Constant])
 @pytest.mark.parametrize("shared_flag_one", [True, False])
 @pytest.mark.parametrize("shared_flag_two", [True, False])
@@ -328,6 +328,16 @@ def test_properties_ro(ov_property_ro, expected_value):
                 (0, False),
             ),
         ),
+        (
+            intel_auto.shared_host_tensors,
+            "SHARED_HOST_TENSORS",
+            (
+                (True, True),
+                (False, False),
+                (1, True),
+                (0, False),
+            ),
+        ),
         (device.id, "DEVICE_ID", (("0", "0"),)),
         (
             log.level,
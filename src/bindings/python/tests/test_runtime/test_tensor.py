@@ -485,3 +485,56 @@ def test_copy_to(dtype, element_type):
 def test_is_continuous(element_type):
     tensor = ov.Tensor(shape=ov.Shape([3, 2, 2]), type=element_type)
     assert tensor.is_continuous()
+
+
+@pytest.mark.parametrize("element_type", [ov.Type.f32, ov.Type.bf16, ov.Type.i64, ov.Type.u8, ov.Type.boolean])
+def test_dlpack_round_trip_shares_memory(element_type):
+    tensor = Tensor(element_type, [2, 3])
+    assert tensor.__dlpack_device__() == (1, 0)
+
+    imported = Tensor.from_dlpack(tensor)
+    assert imported.element_type == element_type
+    assert imported.shape == tensor.shape
+    assert np.shares_memory(imported.data, tensor.data)
+
+    imported_from_capsule = Tensor.from_dlpack(tensor.__dlpack__())
+    del tensor
+    assert imported_from_capsule.shape == imported.shape
+    assert np.shares_memory(imported_from_capsule.data, imported.data)
+
+
+def test_dlpack_capsule_consumed_once():
+    capsule = Tensor(ov.Type.f32, [4]).__dlpack__()
+    Tensor.from_dlpack(capsule)
+    with pytest.raises(RuntimeError) as e:
+        Tensor.from_dlpack(capsule)
+    assert "DLPack capsule which is not consumed yet" in str(e.value)
+
+
+def test_dlpack_unsupported_type():
+    with pytest.raises(RuntimeError) as e:
+        Tensor(ov.Type.u4, [4]).__dlpack__()
+    assert "can't be exported to DLPack" in str(e.value)
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="numpy doesn't support DLPack")
+def test_dlpack_numpy_interop():
+    array = np.arange(12, dtype=np.float32).reshape(3, 4)
+    tensor = Tensor.from_dlpack(array)
+    array[0, 0] = 42
+    assert tensor.data[0, 0] == 42
+    del array
+    assert np.array_equal(tensor.data.flatten()[1:], np.arange(1, 12, dtype=np.float32))
+
+    exported = np.from_dlpack(tensor)
+    exported[2, 3] = -1
+    assert tensor.data[2, 3] == -1
+
+
+@pytest.mark.skipif(not hasattr(np, "from_dlpack"), reason="numpy doesn't support DLPack")
+def test_dlpack_strided_array_is_copied():
+    array = np.arange(12, dtype=np.int32).reshape(3, 4)
+    tensor = Tensor.from_dlpack(array.T)
+    assert tuple(tensor.shape) == (4, 3)
+    assert np.array_equal(tensor.data, array.T)
+    assert not np.shares_memory(tensor.data, array)
@@ -46,6 +46,7 @@ handle_t handle(char const* name);
 void taskBegin(domain_t d, handle_t t);
 void taskEnd(domain_t d);
 void threadName(const char* name);
+bool dumpTrace(const char* path, uint64_t lastMs);
 }  // namespace internal
 /**
  * @endcond
@@ -65,6 +66,20 @@ inline void threadName(const std::string& name) {
     internal::threadName(name.c_str());
 }
 
+/**
+ * @fn bool dumpTrace(const char* path, uint64_t lastMs)
+ * @ingroup ov_dev_profiling
+ * @brief Writes the tasks kept in the trace buffers to a file in the Chrome trace format.
+ * @details The tasks are recorded only when the OPENVINO_TRACE_BUFFER environment variable sets the number of the
+ *          tasks kept per thread. OPENVINO_TRACE_SAMPLING=N records only every N-th top level task with its subtasks.
+ * @param path [in] The file to write
+ * @param lastMs [in] Only the tasks finished during the last @p lastMs milliseconds are written, 0 means all of them
+ * @return false if the tasks are not recorded or the file can't be written
+ */
+inline bool dumpTrace(const std::string& path, uint64_t lastMs = 0) {
+    return internal::dumpTrace(path.c_str(), lastMs);
+}
+
 inline handle_t handle(char const* name) {
     return internal::handle(name);
 }
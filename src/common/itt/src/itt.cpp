@@ -4,7 +4,16 @@
 
 #include "openvino/itt.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 #ifdef ENABLE_PROFILING_ITT
 #    include <ittnotify.h>
@@ -24,15 +33,126 @@ static size_t callStackDepth() {
 
 static thread_local uint32_t call_stack_depth = 0;
 
+// The trace buffers keep the last tasks of every thread without VTune attached, so the slow requests can be looked at
+// after the fact. Every thread writes only its own ring buffer, dumpTrace reads them all.
+static size_t traceBufferSize() {
+    static const char* env = std::getenv("OPENVINO_TRACE_BUFFER");
+    static const size_t size = env ? std::strtoul(env, nullptr, 10) : 0;
+    return size;
+}
+
+static size_t traceSampling() {
+    static const char* env = std::getenv("OPENVINO_TRACE_SAMPLING");
+    static const size_t sampling = env ? std::max<size_t>(1, std::strtoul(env, nullptr, 10)) : 1;
+    return sampling;
+}
+
+static uint64_t traceNow() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+namespace {
+struct TraceEvent {
+    std::atomic<handle_t> name{nullptr};
+    std::atomic<uint64_t> begin{0};
+    std::atomic<uint64_t> end{0};
+};
+
+struct TraceBuffer {
+    TraceBuffer(size_t size, size_t threadId) : events(size), tid(threadId) {}
+
+    std::vector<TraceEvent> events;
+    std::atomic<size_t> written{0};
+    const size_t tid;
+};
+
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector<std::shared_ptr<TraceBuffer>> buffers;
+    std::unordered_map<handle_t, std::string> names;
+};
+
+struct ThreadTrace {
+    static constexpr uint32_t maxDepth = 64;
+
+    std::shared_ptr<TraceBuffer> buffer;
+    std::pair<handle_t, uint64_t> tasks[maxDepth];
+    uint32_t depth = 0;
+    bool sampled = false;
+};
+}  // namespace
+
+// never destroyed, the threads may still record the tasks during the static objects destruction
+static TraceRegistry& traceRegistry() {
+    static auto registry = new TraceRegistry;
+    return *registry;
+}
+
+static thread_local ThreadTrace thread_trace;
+static std::atomic<size_t> root_tasks{0};
+
+static void traceBegin(handle_t t) {
+    auto& trace = thread_trace;
+    if (trace.depth == 0) {
+        trace.sampled = root_tasks.fetch_add(1, std::memory_order_relaxed) % traceSampling() == 0;
+        if (trace.sampled && !trace.buffer) {
+            auto& registry = traceRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            trace.buffer = std::make_shared<TraceBuffer>(traceBufferSize(), registry.buffers.size());
+            registry.buffers.push_back(trace.buffer);
+        }
+    }
+    if (trace.sampled && trace.depth < ThreadTrace::maxDepth)
+        trace.tasks[trace.depth] = {t, traceNow()};
+    trace.depth++;
+}
+
+static void traceEnd() {
+    auto& trace = thread_trace;
+    if (trace.depth == 0)
+        return;
+    trace.depth--;
+    if (!trace.sampled || trace.depth >= ThreadTrace::maxDepth)
+        return;
+
+    auto& buffer = *trace.buffer;
+    const size_t index = buffer.written.load(std::memory_order_relaxed);
+    auto& event = buffer.events[index % buffer.events.size()];
+    event.name.store(trace.tasks[trace.depth].first, std::memory_order_relaxed);
+    event.begin.store(trace.tasks[trace.depth].second, std::memory_order_relaxed);
+    event.end.store(traceNow(), std::memory_order_relaxed);
+    buffer.written.store(index + 1, std::memory_order_release);
+}
+
+static void writeJsonString(std::ostream& out, const std::string& str) {
+    out << '"';
+    for (auto c : str) {
+        if (c == '"' || c == '\\')
+            out << '\\';
+        if (static_cast<unsigned char>(c) >= 0x20)
+            out << c;
+    }
+    out << '"';
+}
+
 domain_t domain(char const* name) {
     return reinterpret_cast<domain_t>(__itt_domain_create(name));
 }
 
 handle_t handle(char const* name) {
-    return reinterpret_cast<handle_t>(__itt_string_handle_create(name));
+    auto h = reinterpret_cast<handle_t>(__itt_string_handle_create(name));
+    if (traceBufferSize()) {
+        auto& registry = traceRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.names.emplace(h, name);
+    }
+    return h;
 }
 
 void taskBegin(domain_t d, handle_t t) {
+    if (traceBufferSize())
+        traceBegin(t);
     if (!callStackDepth() || call_stack_depth++ < callStackDepth())
         __itt_task_begin(reinterpret_cast<__itt_domain*>(d),
                          __itt_null,
@@ -41,10 +161,54 @@ void taskBegin(domain_t d, handle_t t) {
 }
 
 void taskEnd(domain_t d) {
+    if (traceBufferSize())
+        traceEnd();
     if (!callStackDepth() || --call_stack_depth < callStackDepth())
         __itt_task_end(reinterpret_cast<__itt_domain*>(d));
 }
 
+bool dumpTrace(const char* path, uint64_t lastMs) {
+    if (!traceBufferSize())
+        return false;
+    std::ofstream out(path);
+    if (!out.is_open())
+        return false;
+
+    const uint64_t now = traceNow();
+    const uint64_t since = lastMs && lastMs * 1000000 < now ? now - lastMs * 1000000 : 0;
+    auto& registry = traceRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    // the timestamps are in microseconds
+    out << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto& buffer : registry.buffers) {
+        const size_t size = buffer->events.size();
+        const size_t written = buffer->written.load(std::memory_order_acquire);
+        for (size_t i = written > size ? written - size : 0; i < written; i++) {
+            const auto& event = buffer->events[i % size];
+            const auto name = event.name.load(std::memory_order_relaxed);
+            const auto begin = event.begin.load(std::memory_order_relaxed);
+            const auto end = event.end.load(std::memory_order_relaxed);
+            // the slot was overwritten by the thread while it was read
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (i + size < buffer->written.load(std::memory_order_acquire) + 1)
+                continue;
+            if (end < since)
+                continue;
+
+            auto found = registry.names.find(name);
+            out << (first ? "" : ",") << "{\"name\":";
+            writeJsonString(out, found != registry.names.end() ? found->second : std::string("unknown"));
+            out << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->tid << ",\"ts\":" << begin / 1000.0
+                << ",\"dur\":" << (end - begin) / 1000.0 << "}";
+            first = false;
+        }
+    }
+    out << "]}" << std::endl;
+    return out.good();
+}
+
 void threadName(const char* name) {
     __itt_thread_set_name(name);
 }
@@ -65,6 +229,10 @@ void taskEnd(domain_t) {}
 
 void threadName(const char*) {}
 
+bool dumpTrace(const char*, uint64_t) {
+    return false;
+}
+
 #endif  // ENABLE_PROFILING_ITT
 
 }  // namespace internal
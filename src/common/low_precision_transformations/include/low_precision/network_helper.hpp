@@ -233,6 +233,23 @@ public:
         }
     }
 
+    // Makes the attributes of both shared values share the target value. The attributes of the smaller group are
+    // reassigned to the larger one, which takes the target value, so a group of N attributes built by the merges is
+    // reassigned O(N log N) times at most.
+    template <typename SharedAttribute>
+    static void mergeSharedValues(
+        std::shared_ptr<typename SharedAttribute::SharedValueAttribute::SharedValue> targetSharedValue,
+        std::shared_ptr<typename SharedAttribute::SharedValueAttribute::SharedValue> sharedValue) {
+        if (targetSharedValue == sharedValue) {
+            return;
+        }
+        if (targetSharedValue->getAttributes().size() < sharedValue->getAttributes().size()) {
+            sharedValue->value = targetSharedValue->value;
+            std::swap(targetSharedValue, sharedValue);
+        }
+        reassign<SharedAttribute>(targetSharedValue, sharedValue->getAttributes());
+    }
+
     static size_t calculateLevels(
         const float dataPrecisionMin,
         const float dataPrecisionMax,
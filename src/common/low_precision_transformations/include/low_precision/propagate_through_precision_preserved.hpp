@@ -65,15 +65,9 @@ public:
                 const_cast<AttributeType&>(resultAttribute).merge_attributes(toMerge);
 
                 for (size_t index = 1ul; index < parentRestrictions.size(); index++) {
-                    auto& attributes = parentRestrictions[index].template as<AttributeType>().attribute->sharedValue->getAttributes();
-                    for (auto&& attributeWeakPtr : attributes) {
-                        auto attribute = attributeWeakPtr.lock();
-                        if (attribute == nullptr) {
-                            continue;
-                        }
-                        attribute->sharedValue = resultAttribute.attribute->sharedValue;
-                        resultAttribute.attribute->sharedValue->addAttribute(attribute);
-                    }
+                    NetworkHelper::mergeSharedValues<AttributeType>(
+                        resultAttribute.attribute->sharedValue,
+                        parentRestrictions[index].template as<AttributeType>().attribute->sharedValue);
                 }
 
                 auto &rt = node->get_rt_info();
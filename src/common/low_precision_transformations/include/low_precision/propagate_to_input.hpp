@@ -97,15 +97,9 @@ public:
                             std::vector<ov::Any> toMerge = {parentAttribute};
                             res_attr.template as<AttributeType>().merge_attributes(toMerge);
 
-                            auto& attributes =
-                                parentAttribute.template as<AttributeType>().attribute->sharedValue->getAttributes();
-                            for (auto&& attributeWeakPtr : attributes) {
-                                auto attribute = attributeWeakPtr.lock();
-                                if (attribute == nullptr)
-                                    continue;
-                                attribute->sharedValue = res_attr.template as<AttributeType>().attribute->sharedValue;
-                                res_attr.template as<AttributeType>().attribute->sharedValue->addAttribute(attribute);
-                            }
+                            NetworkHelper::mergeSharedValues<AttributeType>(
+                                res_attr.template as<AttributeType>().attribute->sharedValue,
+                                parentAttribute.template as<AttributeType>().attribute->sharedValue);
                         }
                     }
 
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -34,16 +36,20 @@ public:
                     return;
                 }
 
-                for (auto& attr : attributes) {
-                    auto attrLocked = attr.lock();
-                    if (attrLocked == nullptr) {
-                        continue;
-                    }
-                    if (attributeLocked == attrLocked) {
-                        return;
+                // the attributes are indexed by the address, so the large groups built by the propagation are not
+                // rescanned on each addition, the slot of an expired attribute is taken by the new one at its address
+                auto index = indices.find(attributeLocked.get());
+                if (index != indices.end()) {
+                    if (attributes[index->second].lock() != attributeLocked) {
+                        attributes[index->second] = attribute;
                     }
+                    return;
                 }
 
+                if (attributes.size() == attributes.capacity()) {
+                    removeExpired();
+                }
+                indices.emplace(attributeLocked.get(), attributes.size());
                 attributes.push_back(attribute);
             }
 
@@ -52,7 +58,21 @@ public:
             }
 
         private:
+            void removeExpired() {
+                attributes.erase(std::remove_if(attributes.begin(),
+                                                attributes.end(),
+                                                [](const std::weak_ptr<SharedValueAttribute>& attribute) {
+                                                    return attribute.expired();
+                                                }),
+                                 attributes.end());
+                indices.clear();
+                for (size_t i = 0; i < attributes.size(); i++) {
+                    indices.emplace(attributes[i].lock().get(), i);
+                }
+            }
+
             std::vector<std::weak_ptr<SharedValueAttribute>> attributes;
+            std::unordered_map<const SharedValueAttribute*, size_t> indices;
         };
         SharedValueAttribute() : sharedValue(std::make_shared<SharedValue>()) {}
 
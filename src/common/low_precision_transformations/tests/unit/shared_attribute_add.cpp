@@ -23,3 +23,23 @@ TEST(LPT_SharedAttribute, assign) {
     ASSERT_EQ(2ul, attribute1.attribute->sharedValue->getAttributes().size());
     ASSERT_EQ(2ul, attribute2.attribute->sharedValue->getAttributes().size());
 }
+
+TEST(LPT_SharedAttribute, mergeSharedValues) {
+    const auto attribute1 = ov::PrecisionPreservedAttribute(true);
+    const auto attribute2 = ov::PrecisionPreservedAttribute(false);
+    const auto attribute3 = ov::PrecisionPreservedAttribute(false);
+    ov::pass::low_precision::NetworkHelper::reassign<ov::PrecisionPreservedAttribute>(
+        attribute2.attribute->sharedValue,
+        { attribute3.attribute });
+    const auto largerSharedValue = attribute2.attribute->sharedValue;
+
+    ov::pass::low_precision::NetworkHelper::mergeSharedValues<ov::PrecisionPreservedAttribute>(
+        attribute1.attribute->sharedValue,
+        attribute2.attribute->sharedValue);
+
+    // the larger group is kept and takes the target value
+    ASSERT_EQ(largerSharedValue, attribute1.attribute->sharedValue);
+    ASSERT_EQ(largerSharedValue, attribute3.attribute->sharedValue);
+    ASSERT_EQ(3ul, largerSharedValue->getAttributes().size());
+    ASSERT_TRUE(attribute2.value());
+}
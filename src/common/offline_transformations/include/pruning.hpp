@@ -17,6 +17,7 @@ class InitConstMask;
 class InitMasks;
 class PropagateMasks;
 class ShrinkWeights;
+class MarkStructuredSparseWeights;
 
 class Pruning;
 
@@ -71,6 +72,23 @@ public:
     bool run_on_model(const std::shared_ptr<ov::Model>&) override;
 };
 
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief Marks MatMul operations whose constant weights have at most N non zero values in each M consecutive
+ * values along the reduction axis with the SparseWeights runtime attribute. Such zeros don't change the shapes,
+ * so there is nothing to shrink, but the plugins can compute the marked operations with the sparse kernels.
+ */
+class ov::pass::MarkStructuredSparseWeights : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("MarkStructuredSparseWeights", "0");
+    explicit MarkStructuredSparseWeights(size_t n = 2, size_t m = 4) : m_n(n), m_m(m) {}
+    bool run_on_model(const std::shared_ptr<ov::Model>&) override;
+
+private:
+    size_t m_n;
+    size_t m_m;
+};
+
 /**
  * @ingroup ie_transformation_common_api
  * @brief This is just a sequence of passes that performs pruning transformations pipeline
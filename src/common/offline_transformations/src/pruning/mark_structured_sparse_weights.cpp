@@ -0,0 +1,82 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/core/validation_util.hpp"
+#include "openvino/opsets/opset6.hpp"
+#include "openvino/util/log.hpp"
+#include "pruning.hpp"
+#include "transformations/rt_info/sparse_weights.hpp"
+
+namespace {
+// checks that each group of m consecutive values along the reduction axis has at most n non zero values, the
+// weights are read in place, without the copy of the whole constant
+template <typename T>
+bool is_structured_sparse(const T* values, size_t outer, size_t K, size_t inner, size_t n, size_t m) {
+    for (size_t o = 0; o < outer; o++) {
+        for (size_t i = 0; i < inner; i++) {
+            for (size_t group = 0; group < K; group += m) {
+                size_t non_zeros = 0;
+                for (size_t k = group; k < group + m; k++)
+                    non_zeros += static_cast<float>(values[(o * K + k) * inner + i]) != 0.f;
+                if (non_zeros > n)
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool is_structured_sparse(const std::shared_ptr<ov::opset6::Constant>& weights,
+                          size_t outer,
+                          size_t K,
+                          size_t inner,
+                          size_t n,
+                          size_t m) {
+    switch (weights->get_element_type()) {
+    case ov::element::f16:
+        return is_structured_sparse(weights->get_data_ptr<ov::float16>(), outer, K, inner, n, m);
+    case ov::element::bf16:
+        return is_structured_sparse(weights->get_data_ptr<ov::bfloat16>(), outer, K, inner, n, m);
+    case ov::element::f32:
+        return is_structured_sparse(weights->get_data_ptr<float>(), outer, K, inner, n, m);
+    case ov::element::f64:
+        return is_structured_sparse(weights->get_data_ptr<double>(), outer, K, inner, n, m);
+    default:
+        return false;
+    }
+}
+}  // namespace
+
+bool ov::pass::MarkStructuredSparseWeights::run_on_model(const std::shared_ptr<ov::Model>& f) {
+    bool marked = false;
+    for (const auto& node : f->get_ordered_ops()) {
+        auto matmul = std::dynamic_pointer_cast<opset6::MatMul>(node);
+        if (!matmul)
+            continue;
+        // the weights may still be computed by the Gathers inserted by ShrinkWeights
+        const auto weights = ov::get_constant_from_source(matmul->input_value(1));
+        if (!weights || !weights->get_element_type().is_real())
+            continue;
+        const auto& shape = weights->get_shape();
+        const size_t rank = shape.size();
+        if (rank < 2)
+            continue;
+
+        // the groups are taken along the reduction axis K: [..., N, K] with transpose_b or [..., K, N] without it
+        const size_t K = matmul->get_transpose_b() ? shape[rank - 1] : shape[rank - 2];
+        const size_t inner = matmul->get_transpose_b() ? 1 : shape[rank - 1];
+        if (K % m_m != 0 || shape_size(shape) == 0)
+            continue;
+        const size_t outer = shape_size(shape) / (K * inner);
+
+        if (!is_structured_sparse(weights, outer, K, inner, m_n, m_m))
+            continue;
+
+        OPENVINO_DEBUG << "\nMarked " << matmul->get_friendly_name() << " weights as " << m_n << ":" << m_m
+                       << " structured sparse.";
+        ov::mark_as_sparse_weights(matmul, static_cast<int64_t>(m_n), static_cast<int64_t>(m_m));
+        marked = true;
+    }
+    return marked;
+}
@@ -53,6 +53,8 @@ bool ov::pass::Pruning::run_on_model(const std::shared_ptr<ov::Model>& f) {
 #endif
 
     manager.register_pass<ShrinkWeights>();
+    // the weights are checked after the channels are removed, since removing the input channels shifts the groups
+    manager.register_pass<MarkStructuredSparseWeights>();
 
 #ifdef ENABLE_OPENVINO_DEBUG
     // Uncomment following line and change path to resulting svg file
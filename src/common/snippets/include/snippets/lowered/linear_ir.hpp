@@ -21,6 +21,8 @@ public:
     // True if we should check runtime info for nodes to call specific needed transformations
     bool m_need_fill_tail_register = false;
     size_t m_loop_depth = 1;
+    // True if the execution time of the outermost Loops should be measured (requires the saved expressions)
+    bool m_perf_count = false;
 };
 
 /* The control flow of Snippets is built on Linear Intermediate Representation (Linear IR).
@@ -0,0 +1,33 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "pass.hpp"
+
+namespace ov {
+namespace snippets {
+namespace lowered {
+namespace pass {
+
+/**
+ * @interface InsertPerfCount
+ * @brief The pass wraps every outermost Loop and every standalone operation outside of the Loops (e.g. Brgemm)
+ *        with the PerfCountBegin and PerfCountEnd pair to measure the time spent in them on every kernel call.
+ *        The counters are named by the Loop ID and the friendly names of the fused operations inside the region,
+ *        so the report points to the part of the Subgraph which slows down the kernel.
+ *        Note: the pass should be called after the register assignment, since the counters don't use the registers.
+ * @ingroup snippets
+ */
+class InsertPerfCount : public Pass {
+public:
+    OPENVINO_RTTI("InsertPerfCount", "Pass")
+    InsertPerfCount() = default;
+    bool run(LinearIR& linear_ir) override;
+};
+
+} // namespace pass
+} // namespace lowered
+} // namespace snippets
+} // namespace ov
@@ -0,0 +1,33 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "pass.hpp"
+
+namespace ov {
+namespace snippets {
+namespace lowered {
+namespace pass {
+
+/**
+ * @interface ReduceDecomposition
+ * @brief Decomposes ReduceSum and ReduceMax to the accumulation Loop over the last dimension and the horizon op
+ *        on linear IR, the same way as the reductions of SoftmaxDecomposition
+ * @ingroup snippets
+ */
+class ReduceDecomposition : public Pass {
+public:
+    explicit ReduceDecomposition(size_t vector_size);
+    OPENVINO_RTTI("ReduceDecomposition", "Pass")
+    bool run(LinearIR& linear_ir) override;
+
+private:
+    size_t m_vector_size;
+};
+
+} // namespace pass
+} // namespace lowered
+} // namespace snippets
+} // namespace ov
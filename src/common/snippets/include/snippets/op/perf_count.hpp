@@ -0,0 +1,82 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/op/op.hpp"
+#include "openvino/runtime/threading/thread_local.hpp"
+
+namespace ov {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface PerfCountBeginBase
+ * @brief Base class for PerfCountBegin and PerfCountEnd. The ops mark the region of Linear IR which duration
+ *        is measured on every kernel call. The counter ticks are provided by the target specific emitters.
+ * @ingroup snippets
+ */
+class PerfCountBeginBase : public ov::op::Op {
+public:
+    OPENVINO_OP("PerfCountBeginBase", "SnippetsOpset");
+    PerfCountBeginBase(const std::vector<Output<Node>>& args);
+    PerfCountBeginBase() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override { return true; }
+};
+
+/**
+ * @interface PerfCountBegin
+ * @brief Saves the counter ticks at the start of the measured region for the current thread.
+ *        The only output is connected to the corresponding PerfCountEnd
+ * @ingroup snippets
+ */
+class PerfCountBegin : public PerfCountBeginBase {
+public:
+    OPENVINO_OP("PerfCountBegin", "SnippetsOpset", PerfCountBeginBase);
+    PerfCountBegin();
+
+    void validate_and_infer_types() override;
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override;
+
+    void set_start_count(uint64_t count) { m_start_count.local() = count; }
+    uint64_t get_start_count() { return m_start_count.local(); }
+
+private:
+    ov::threading::ThreadLocal<uint64_t> m_start_count;
+};
+
+/**
+ * @interface PerfCountEnd
+ * @brief Accumulates the counter ticks spent in the measured region and the number of its executions
+ *        per thread. The totals are reported to the standard output when the op is destroyed.
+ * @param pc_begin - the output of the corresponding PerfCountBegin
+ * @ingroup snippets
+ */
+class PerfCountEnd : public PerfCountBeginBase {
+public:
+    OPENVINO_OP("PerfCountEnd", "SnippetsOpset", PerfCountBeginBase);
+    PerfCountEnd(const Output<Node>& pc_begin);
+    PerfCountEnd() = default;
+    ~PerfCountEnd() override;
+
+    void validate_and_infer_types() override;
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override;
+
+    std::shared_ptr<PerfCountBegin> get_pc_begin() const;
+    // adds the ticks spent in the region by the current thread
+    void accumulate(uint64_t ticks);
+    // returns the total ticks and the total number of the executions over all the threads
+    std::pair<uint64_t, uint64_t> get_totals() const;
+
+private:
+    void output_perf_count() const;
+
+    ov::threading::ThreadLocal<uint64_t> m_accumulation;
+    ov::threading::ThreadLocal<uint64_t> m_iteration;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ov
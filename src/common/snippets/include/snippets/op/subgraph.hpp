@@ -98,6 +98,7 @@ public:
     size_t get_virtual_port_count() const { return m_virtual_port_count; }
     bool is_quantized() const { return config.m_is_quantized; }
     bool has_domain_sensitive_ops() const { return config.m_has_domain_sensitive_ops; }
+    bool is_perf_count() const { return m_perf_count; }
     snippets::Schedule generate(const BlockedShapeVector& output_shapes,
                                 const BlockedShapeVector& input_shapes,
                                 const std::vector<pass::Manager::PositionedPass>& data_flow_passes,
@@ -123,6 +124,8 @@ public:
     // it's going to be replaced with Jitters table later
     void set_generator(std::shared_ptr<ov::snippets::Generator> generator);
     void set_tile_rank(size_t newRank) {tileRank = newRank;}
+    // plugin enables the performance counters of the generated kernel for debugging
+    void set_perf_count(bool enabled) {m_perf_count = enabled;}
     void set_virtual_port_count(const size_t count);
 
     void print() const;
@@ -162,6 +165,7 @@ private:
 
     ov::PartialShape master_shape;
     size_t tileRank = 0; // set by plugin to specify the number of dimensions processed in a single kernel call
+    bool m_perf_count = false;
     size_t maxInputRank = 0;
     std::vector<size_t> appendOnesForCanonical;
     std::shared_ptr<lowered::LinearIR> m_linear_ir = nullptr;
@@ -0,0 +1,32 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+
+namespace ov {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface ReduceToSnippetsReduce
+ * @brief Converts the ReduceSum, ReduceMax and ReduceMean over the last dimension with the kept dimensions to
+ *        the snippets ReduceSum and ReduceMax, ReduceMean is converted to ReduceSum followed by Multiply by the
+ *        reciprocal of the reduced dimension. The snippets reductions don't depend on the axes input, so they
+ *        are not affected by the changes of the ranks in the body (e.g. canonicalization)
+ * @ingroup snippets
+ */
+class ReduceToSnippetsReduce: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ReduceToSnippetsReduce", "0");
+    ReduceToSnippetsReduce();
+
+    static bool is_supported_reduce(const std::shared_ptr<const ov::Node>& node);
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ov
@@ -0,0 +1,27 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+
+namespace ov {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface SetReducePorts
+ * @brief The pass updates port descriptors of the snippets reductions, so the last dimension is processed
+ *        by the Loops of the decomposition only
+ * @ingroup snippets
+ */
+class SetReducePorts: public ov::pass::MatcherPass {
+public:
+    SetReducePorts();
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ov
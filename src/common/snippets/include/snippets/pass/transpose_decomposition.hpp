@@ -14,12 +14,17 @@ namespace pass {
 /**
  * @interface TransposeDecomposition
  * @brief Decompose Transpose to Load + Store wrapped in several loops.
+ *        If the innermost dimension keeps its place, the Transpose is decomposed to the vector Load with the layout
+ *        that is fused into the loops of the consumers without the materialization of the transposed tensor.
+ * @param vector_size - the count of elements loaded by the vector Load
  * @ingroup snippets
  */
 class TransposeDecomposition: public ov::pass::MatcherPass {
 public:
     OPENVINO_RTTI("TransposeDecomposition", "0");
-    TransposeDecomposition();
+    TransposeDecomposition(size_t vector_size = 1);
+    static bool is_supported_order(const std::vector<int>& order);
+    static bool is_vectorized_order(const std::vector<int>& order);
     static const std::set<std::vector<int>> supported_cases;
 };
 
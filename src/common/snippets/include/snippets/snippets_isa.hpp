@@ -19,7 +19,9 @@
 #include "op/load.hpp"
 #include "op/nop.hpp"
 #include "op/scalar.hpp"
+#include "op/perf_count.hpp"
 #include "op/powerstatic.hpp"
+#include "op/reduce.hpp"
 #include "op/store.hpp"
 #include "op/loop.hpp"
 #include "op/brgemm.hpp"
@@ -7,6 +7,7 @@
 #include "snippets/lowered/linear_ir.hpp"
 #include "snippets/lowered/pass/assign_registers.hpp"
 #include "snippets/lowered/pass/insert_tail_loop.hpp"
+#include "snippets/lowered/pass/insert_perf_count.hpp"
 
 #include "snippets/op/kernel.hpp"
 
@@ -27,6 +28,9 @@ Generator::LoweringResult Generator::generate(lowered::LinearIR& linear_ir, cons
     lowered::pass::PassPipeline lowered_pipeline;
     lowered_pipeline.register_pass<lowered::pass::AssignRegisters>(reg_type_mapper);
     lowered_pipeline.register_pass<lowered::pass::InsertTailLoop>();
+    // the counters are inserted after the register assignment to not affect it
+    if (config.m_perf_count)
+        lowered_pipeline.register_pass<lowered::pass::InsertPerfCount>();
     lowered_pipeline.run(linear_ir);
 
     linear_ir.init_emitters(target);
@@ -62,6 +66,7 @@ Generator::opRegType Generator::get_op_reg_type(const std::shared_ptr<Node>& op)
         std::dynamic_pointer_cast<ov::op::v0::Result>(op) ||
         std::dynamic_pointer_cast<op::LoopBegin>(op) ||
         std::dynamic_pointer_cast<op::LoopEnd>(op) ||
+        std::dynamic_pointer_cast<op::PerfCountBeginBase>(op) ||
         std::dynamic_pointer_cast<op::Brgemm>(op) ||
         std::dynamic_pointer_cast<op::Buffer>(op))
         return gpr2gpr;
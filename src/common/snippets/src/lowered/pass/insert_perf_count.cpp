@@ -0,0 +1,81 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/lowered/pass/insert_perf_count.hpp"
+
+#include "snippets/lowered/linear_ir.hpp"
+#include "snippets/snippets_isa.hpp"
+#include "snippets/itt.hpp"
+
+namespace ov {
+namespace snippets {
+namespace lowered {
+namespace pass {
+
+namespace {
+// The auxiliary ops are created by the lowering and don't identify the fused operations
+bool is_auxiliary_op(const std::shared_ptr<ov::Node>& node) {
+    return ov::is_type<ov::op::v0::Parameter>(node) ||
+           ov::is_type<ov::op::v0::Result>(node) ||
+           ov::is_type<op::LoopBase>(node) ||
+           ov::is_type<op::Buffer>(node) ||
+           ov::is_type<op::Load>(node) ||
+           ov::is_type<op::Store>(node) ||
+           ov::is_type<op::BroadcastLoad>(node) ||
+           ov::is_type<op::BroadcastMove>(node) ||
+           ov::is_type<op::Scalar>(node) ||
+           ov::is_type<op::VectorBuffer>(node) ||
+           ov::is_type<op::Fill>(node) ||
+           ov::is_type<op::Nop>(node);
+}
+}  // namespace
+
+bool InsertPerfCount::run(LinearIR& linear_ir) {
+    OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::InsertPerfCount")
+    if (linear_ir.empty())
+        return false;
+
+    size_t region_count = 0;
+    auto insert_perf_count = [&](LinearIR::constExprIt region_begin, LinearIR::constExprIt region_end, const std::string& name) {
+        const auto& pc_begin = std::make_shared<op::PerfCountBegin>();
+        const auto& pc_begin_expr = linear_ir.create_expression(pc_begin, std::vector<PortConnectorPtr>{});
+        linear_ir.insert(region_begin, pc_begin_expr);
+
+        const auto& pc_end = std::make_shared<op::PerfCountEnd>(pc_begin->output(0));
+        pc_end->set_friendly_name("Region_" + std::to_string(region_count++) + "(" + name + ")");
+        const auto& pc_end_expr = linear_ir.create_expression(pc_end, {pc_begin_expr->get_output_port_connector(0)});
+        return linear_ir.insert(region_end, pc_end_expr);
+    };
+
+    size_t loop_depth = 0;
+    LinearIR::constExprIt region_begin = linear_ir.cend();
+    std::string region_name;
+    auto append_name = [&region_name](const std::string& name) {
+        region_name += region_name.empty() ? name : "," + name;
+    };
+    for (auto expr_it = linear_ir.cbegin(); expr_it != linear_ir.cend(); expr_it++) {
+        const auto& node = (*expr_it)->get_node();
+        if (ov::is_type<op::LoopBegin>(node)) {
+            if (loop_depth++ == 0) {
+                region_begin = expr_it;
+                region_name.clear();
+            }
+        } else if (const auto loop_end = ov::as_type_ptr<op::LoopEnd>(node)) {
+            OPENVINO_ASSERT(loop_depth > 0, "LoopEnd is met before the corresponding LoopBegin");
+            if (--loop_depth == 0)
+                expr_it = insert_perf_count(region_begin, std::next(expr_it), "Loop_" + std::to_string(loop_end->get_id()) + ":" + region_name);
+        } else if (!is_auxiliary_op(node)) {
+            if (loop_depth > 0)
+                append_name(node->get_friendly_name());
+            else
+                expr_it = insert_perf_count(expr_it, std::next(expr_it), node->get_friendly_name());
+        }
+    }
+    return region_count > 0;
+}
+
+} // namespace pass
+} // namespace lowered
+} // namespace snippets
+} // namespace ov
@@ -0,0 +1,87 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/itt.hpp"
+
+#include "snippets/op/perf_count.hpp"
+
+#include <iostream>
+
+namespace ov {
+namespace snippets {
+namespace op {
+
+PerfCountBeginBase::PerfCountBeginBase(const std::vector<Output<Node>>& args) : Op(args) {}
+
+PerfCountBegin::PerfCountBegin() : PerfCountBeginBase() {
+    validate_and_infer_types();
+}
+
+void PerfCountBegin::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(PerfCountBegin_validate_and_infer_types);
+    NODE_VALIDATION_CHECK(this, get_input_size() == 0, "PerfCountBegin doesn't expect any inputs");
+    set_output_type(0, element::f32, ov::PartialShape{ov::Shape{}});
+}
+
+std::shared_ptr<Node> PerfCountBegin::clone_with_new_inputs(const OutputVector& inputs) const {
+    INTERNAL_OP_SCOPE(PerfCountBegin_clone_with_new_inputs);
+    return std::make_shared<PerfCountBegin>();
+}
+
+PerfCountEnd::PerfCountEnd(const Output<Node>& pc_begin) : PerfCountBeginBase({pc_begin}) {
+    constructor_validate_and_infer_types();
+}
+
+PerfCountEnd::~PerfCountEnd() {
+    output_perf_count();
+}
+
+void PerfCountEnd::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(PerfCountEnd_validate_and_infer_types);
+    NODE_VALIDATION_CHECK(this, get_input_size() == 1 && ov::is_type<PerfCountBegin>(get_input_node_shared_ptr(0)),
+                          "PerfCountEnd must have PerfCountBegin as the only input");
+    set_output_size(0);
+}
+
+std::shared_ptr<Node> PerfCountEnd::clone_with_new_inputs(const OutputVector& inputs) const {
+    INTERNAL_OP_SCOPE(PerfCountEnd_clone_with_new_inputs);
+    check_new_args_count(this, inputs);
+    return std::make_shared<PerfCountEnd>(inputs.at(0));
+}
+
+std::shared_ptr<PerfCountBegin> PerfCountEnd::get_pc_begin() const {
+    const auto pc_begin = ov::as_type_ptr<PerfCountBegin>(get_input_node_shared_ptr(0));
+    OPENVINO_ASSERT(pc_begin != nullptr, "PerfCountEnd last input is not connected to PerfCountBegin");
+    return pc_begin;
+}
+
+void PerfCountEnd::accumulate(uint64_t ticks) {
+    m_accumulation.local() += ticks;
+    m_iteration.local()++;
+}
+
+std::pair<uint64_t, uint64_t> PerfCountEnd::get_totals() const {
+    uint64_t accumulation = 0;
+    uint64_t iteration = 0;
+    for (const auto& thread_accumulation : m_accumulation)
+        accumulation += thread_accumulation;
+    for (const auto& thread_iteration : m_iteration)
+        iteration += thread_iteration;
+    return {accumulation, iteration};
+}
+
+void PerfCountEnd::output_perf_count() const {
+    const auto totals = get_totals();
+    // the clones which are never executed are not reported
+    if (totals.second == 0)
+        return;
+    std::cout << "Snippets perf count " << get_friendly_name()
+              << ": ticks = " << totals.first
+              << ", executions = " << totals.second
+              << ", avg ticks = " << totals.first / totals.second << std::endl;
+}
+
+} // namespace op
+} // namespace snippets
+} // namespace ov
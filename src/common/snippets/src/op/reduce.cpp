@@ -0,0 +1,47 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/itt.hpp"
+
+#include "snippets/op/reduce.hpp"
+
+
+namespace ov {
+namespace snippets {
+namespace op {
+
+ReduceBase::ReduceBase(const Output<Node>& x) : Op({x}) {}
+
+void ReduceBase::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(ReduceBase_validate_and_infer_types);
+    auto new_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, new_shape.rank().is_static() && new_shape.size() > 0,
+                          "Reduce supports only the inputs of the static non-zero rank");
+    new_shape[new_shape.size() - 1] = 1lu;
+    set_output_type(0, get_input_element_type(0), new_shape);
+}
+
+ReduceSum::ReduceSum(const Output<Node>& x) : ReduceBase(x) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> ReduceSum::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ReduceSum_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ReduceSum>(new_args.at(0));
+}
+
+ReduceMax::ReduceMax(const Output<Node>& x) : ReduceBase(x) {
+    constructor_validate_and_infer_types();
+}
+
+std::shared_ptr<Node> ReduceMax::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(ReduceMax_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ReduceMax>(new_args.at(0));
+}
+
+} // namespace op
+} // namespace snippets
+} // namespace ov
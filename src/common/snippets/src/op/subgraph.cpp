@@ -7,6 +7,7 @@
 
 #include "snippets/op/subgraph.hpp"
 #include "snippets/op/convert_saturation.hpp"
+#include "snippets/op/reduce.hpp"
 
 #include "snippets/pass/insert_movebroadcast.hpp"
 #include "snippets/pass/broadcast_to_movebroadcast.hpp"
@@ -17,6 +18,8 @@
 #include "snippets/pass/matmul_to_brgemm.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
 #include "snippets/pass/set_softmax_ports.hpp"
+#include "snippets/pass/set_reduce_ports.hpp"
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
 
 #include "snippets/utils.hpp"
 
@@ -34,6 +37,7 @@
 #include "snippets/lowered/pass/propagate_layout.hpp"
 #include "snippets/lowered/pass/cleanup_loop_offsets.hpp"
 #include "snippets/lowered/pass/softmax_decomposition.hpp"
+#include "snippets/lowered/pass/reduce_decomposition.hpp"
 #include "snippets/lowered/pass/move_scalar_to_consumer.hpp"
 #include "snippets/lowered/pass/move_result_out_of_loop.hpp"
 #include "snippets/lowered/pass/clean_repeated_ptr_shifts.hpp"
@@ -71,6 +75,8 @@ auto Subgraph::is_domain_sensitive_op(const std::shared_ptr<ov::Node>& op) -> bo
     return ov::is_type<ov::op::v1::Transpose>(op) ||
            ov::is_type<ov::op::v1::Softmax>(op) ||
            ov::is_type<ov::op::v8::Softmax>(op) ||
+           ov::is_type<op::ReduceBase>(op) ||
+           snippets::pass::ReduceToSnippetsReduce::is_supported_reduce(op) ||
            ov::is_type<ov::op::v0::MatMul>(op) ||
            ov::is_type<ov::op::v1::Broadcast>(op) || // Broadcast is domain sensetive op because the output shape depends on
            ov::is_type<ov::op::v3::Broadcast>(op);   // the both input and broadcast shapes (the both - are inputs of op). Note: is used only in MHA pattern
@@ -93,7 +99,7 @@ auto Subgraph::get_estimated_buffer_count(const ov::NodeVector& ops) -> size_t {
     // 2. Around MatMul: all buffers around Matmul must not be inplace because MatMul blocking implementation changes registers during computations.
     // The count is estimated because when we calculate this number, we have only original graph representation
     // and where will be Loops - we can just predict.
-    // Note: The ops that create Buffers: MatMul, Transpose and Softmax (always FP32)
+    // Note: The ops that create Buffers: MatMul, Transpose, Softmax and Reduce (always FP32)
     std::vector<size_t> used_precision_size;
 
     auto push_prc_size = [&used_precision_size](size_t precision_size) {
@@ -121,6 +127,9 @@ auto Subgraph::get_estimated_buffer_count(const ov::NodeVector& ops) -> size_t {
             // Softmax always uses 2 FP32 Buffers after decomposition.
             // They are inplace and the same, so we can push precision size only once
             push_prc_size(ov::element::f32.size());
+        } else if (ov::is_type<op::ReduceBase>(op) || snippets::pass::ReduceToSnippetsReduce::is_supported_reduce(op)) {
+            // The reduction is decomposed into the own Loops as Softmax, so it uses FP32 Buffers on its input
+            push_prc_size(ov::element::f32.size());
         } else if (const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(op)) {
             // Since all buffers around Matmul must be unique, we explicitely add values to the vector without any checks
             if (!ov::is_type<ov::op::v0::Parameter>(matmul->get_input_node_shared_ptr(0)))
@@ -531,9 +540,11 @@ Subgraph::LIRShapeInfer::infer(const std::vector<VectorDimsRef>& input_shapes) {
 std::shared_ptr<lowered::LinearIR>
 Subgraph::convert_body_to_linear_ir(const std::shared_ptr<IShapeInferSnippetsFactory>& shape_infer_factory) const {
     lowered::Config lowering_config;
-    lowering_config.m_save_expressions = config.m_has_domain_sensitive_ops;
+    // the performance counters are accessed by the kernel on execution time
+    lowering_config.m_save_expressions = config.m_has_domain_sensitive_ops || m_perf_count;
     lowering_config.m_need_fill_tail_register = config.m_has_domain_sensitive_ops;
     lowering_config.m_loop_depth = tileRank;
+    lowering_config.m_perf_count = m_perf_count;
 
     return std::make_shared<lowered::LinearIR>(body_ptr(), shape_infer_factory, lowering_config);
 }
@@ -621,8 +632,9 @@ void Subgraph::data_flow_transformations(const std::vector<snippets::pass::Manag
     if (config.m_has_domain_sensitive_ops) {
         manager.register_pass<snippets::pass::MatMulToBrgemm>();
         manager.register_pass<snippets::pass::FuseTransposeBrgemm>();
-        manager.register_pass<snippets::pass::TransposeDecomposition>();
+        manager.register_pass<snippets::pass::TransposeDecomposition>(m_generator->get_target_machine()->get_lanes());
         manager.register_pass<snippets::pass::SetSoftmaxPorts>();
+        manager.register_pass<snippets::pass::SetReducePorts>();
     }
     manager.register_pass<snippets::pass::BroadcastToMoveBroadcast>();
     manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
@@ -660,6 +672,7 @@ void Subgraph::control_flow_transformations(lowered::LinearIR& linear_ir,
     lowered::pass::PassPipeline common_pipeline;
     common_pipeline.register_pass<lowered::pass::MarkLoops>(vector_size);
     common_pipeline.register_pass<lowered::pass::SoftmaxDecomposition>(vector_size);
+    common_pipeline.register_pass<lowered::pass::ReduceDecomposition>(vector_size);
     common_pipeline.register_pass<lowered::pass::FuseLoops>();
     common_pipeline.register_pass<lowered::pass::SplitLoops>();
     common_pipeline.register_pass<lowered::pass::MoveResultOutOfLoop>();
@@ -9,6 +9,7 @@
 #include "snippets/pass/tokenization.hpp"
 #include "snippets/pass/transpose_decomposition.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
 #include "snippets/op/subgraph.hpp"
 #include "snippets/utils.hpp"
 
@@ -78,7 +79,7 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
             const auto& order = as_type_ptr<const opset1::Constant>(n->get_input_node_shared_ptr(1));
             if (order) {
                 const auto order_value = order->cast_vector<int>();
-                return (TransposeDecomposition::supported_cases.count(order_value) != 0) ||
+                return TransposeDecomposition::is_supported_order(order_value) ||
                        (is_brgemm_case && FuseTransposeBrgemm::supported_cases.count(order_value) != 0);
             }
         }
@@ -180,6 +181,7 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
            is_supported_ternary_eltwise_op(n) ||
            is_supported_transpose(n) ||
            is_supported_softmax(n) ||
+           ReduceToSnippetsReduce::is_supported_reduce(n) ||
            is_supported_matmul(n) ||
            is_supported_broadcast_op(n);
 }
@@ -6,6 +6,7 @@
 
 #include "snippets/pass/fq_decomposition.hpp"
 #include "snippets/pass/softmax_reshape_elimination.hpp"
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
 #include "snippets/pass/explicit_transpose_matmul_inputs.hpp"
 #include "snippets/pass/transpose_decomposition.hpp"
 #include "snippets/pass/fuse_transpose_brgemm.hpp"
@@ -340,7 +341,7 @@ void CommonOptimizations::ExtractUnsupportedTransposes(const std::shared_ptr<op:
         const auto is_brgemm_case = ov::is_type<opset1::MatMul>(transpose_child.get_node()->shared_from_this());
         // If Transpose is supported (can be decomposed or fused into Brgemm), skip
         if ((is_brgemm_case && FuseTransposeBrgemm::supported_cases.count(order_value) != 0) ||
-            (TransposeDecomposition::supported_cases.count(order_value) != 0))
+            TransposeDecomposition::is_supported_order(order_value))
             continue;
 
         // If the transpose isn't supported - we have to extract it from Subgraph
@@ -379,6 +380,7 @@ CommonOptimizations::CommonOptimizations(const SnippetsTokenization::Config& con
             manager.register_pass<ov::snippets::pass::CommonFakeQuantizeDecomposition>();
         }
         manager.register_pass<snippets::pass::SoftmaxReshapeElimination>();
+        manager.register_pass<snippets::pass::ReduceToSnippetsReduce>();
         manager.run_passes(body);
 
         // At the moment only non-scalar Constants of FakeQuantize can be inside Subgraph
@@ -6,6 +6,7 @@
 
 #include "ov_ops/type_relaxed.hpp"
 #include "snippets/itt.hpp"
+#include "snippets/op/reduce.hpp"
 #include "snippets/utils.hpp"
 #include "openvino/core/rt_info.hpp"
 
@@ -33,7 +34,8 @@ bool ov::snippets::pass::PropagatePrecision::run_on_model(const std::shared_ptr<
         std::set<ov::element::TypeVector> supported_precisions;
         // TODO: At the moment Softmax is decomposed on Linear IR level.
         //       When Softmax will be decomposed on NGraph level, remove it
-        if (type_info.is_castable(ov::op::v1::Softmax::get_type_info_static())) {
+        if (type_info.is_castable(ov::op::v1::Softmax::get_type_info_static()) ||
+            type_info.is_castable(op::ReduceBase::get_type_info_static())) {
             supported_precisions = {{ov::element::f32}};
         } else {
             OPENVINO_ASSERT(
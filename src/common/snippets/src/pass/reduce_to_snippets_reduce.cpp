@@ -0,0 +1,67 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/itt.hpp"
+
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/validation_util.hpp"
+#include "openvino/op/reduce_max.hpp"
+#include "openvino/op/reduce_mean.hpp"
+#include "openvino/op/reduce_sum.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+
+bool ov::snippets::pass::ReduceToSnippetsReduce::is_supported_reduce(const std::shared_ptr<const ov::Node>& node) {
+    const auto reduce = ov::as_type_ptr<const ov::op::util::ArithmeticReductionKeepDims>(node);
+    if (!reduce || !reduce->get_keep_dims() ||
+        !(ov::is_type<ov::op::v1::ReduceSum>(reduce) || ov::is_type<ov::op::v1::ReduceMax>(reduce) ||
+          ov::is_type<ov::op::v1::ReduceMean>(reduce)))
+        return false;
+    const auto& pshape = reduce->get_input_partial_shape(0);
+    if (pshape.rank().is_dynamic() || pshape.size() == 0 || pshape.rbegin()->is_dynamic())
+        return false;
+    const auto axes = ov::as_type_ptr<const ov::op::v0::Constant>(reduce->get_input_node_shared_ptr(1));
+    if (!axes || ov::shape_size(axes->get_shape()) != 1)
+        return false;
+    const auto rank = static_cast<int64_t>(pshape.size());
+    const auto axis = axes->cast_vector<int64_t>()[0];
+    return axis == rank - 1 || axis == -1;
+}
+
+ov::snippets::pass::ReduceToSnippetsReduce::ReduceToSnippetsReduce() {
+    MATCHER_SCOPE(ReduceToSnippetsReduce);
+    auto m_reduce = ov::pass::pattern::wrap_type<ov::op::v1::ReduceSum, ov::op::v1::ReduceMax, ov::op::v1::ReduceMean>(
+        [](const ov::Output<ov::Node>& out) {
+            return is_supported_reduce(out.get_node_shared_ptr());
+        });
+
+    register_matcher(std::make_shared<ov::pass::pattern::Matcher>(m_reduce, matcher_name), [](ov::pass::pattern::Matcher &m) {
+        OV_ITT_SCOPED_TASK(ov::pass::itt::domains::SnippetsTransform, "Snippets::op::ReduceToSnippetsReduce")
+        const auto root = m.get_match_root();
+        const auto& data = root->input_value(0);
+
+        std::shared_ptr<ov::Node> snippets_reduce;
+        if (ov::is_type<ov::op::v1::ReduceMax>(root))
+            snippets_reduce = std::make_shared<op::ReduceMax>(data);
+        else
+            snippets_reduce = std::make_shared<op::ReduceSum>(data);
+        ov::NodeVector new_ops{snippets_reduce};
+
+        std::shared_ptr<ov::Node> result = snippets_reduce;
+        if (ov::is_type<ov::op::v1::ReduceMean>(root)) {
+            const auto work_amount = data.get_partial_shape().rbegin()->get_length();
+            const auto reciprocal = ov::op::v0::Constant::create(data.get_element_type(), ov::Shape{},
+                                                                 {1.f / static_cast<float>(work_amount)});
+            result = std::make_shared<ov::op::v1::Multiply>(snippets_reduce, reciprocal);
+            new_ops.push_back(reciprocal);
+            new_ops.push_back(result);
+        }
+        result->set_friendly_name(root->get_friendly_name());
+        ov::copy_runtime_info(root, new_ops);
+        ov::replace_node(root, result);
+        return true;
+    });
+}
@@ -16,7 +16,16 @@ using namespace lowered;
 
 const std::set<std::vector<int>> TransposeDecomposition::supported_cases = {{0, 2, 3, 1}};
 
-TransposeDecomposition::TransposeDecomposition() {
+bool TransposeDecomposition::is_vectorized_order(const std::vector<int>& order) {
+    // the innermost dimension is contiguous in the memory of the input, so the vector access is possible
+    return !order.empty() && order.back() == static_cast<int>(order.size() - 1);
+}
+
+bool TransposeDecomposition::is_supported_order(const std::vector<int>& order) {
+    return supported_cases.count(order) != 0 || is_vectorized_order(order);
+}
+
+TransposeDecomposition::TransposeDecomposition(size_t vector_size) {
     MATCHER_SCOPE(TransposeDecomposition);
     // Todo: we need a special transformation that detects and propagates data access pattern to Parameters and Results
     //       this is needed to communicate access pattern to the plugin node and op::Kernel
@@ -37,12 +46,28 @@ TransposeDecomposition::TransposeDecomposition() {
             return false;
 
         auto order_value = order->cast_vector<int>();
-        if (supported_cases.count(order_value) == 0)
+        if (!is_supported_order(order_value))
             return false;
 
+        const auto& layout = order->cast_vector<size_t>();
+        if (is_vectorized_order(order_value)) {
+            // The consumers read the transposed data directly from the input: the vector LoadReshape with the layout
+            // is fused into their loops (the subtensor is the default one), so the Store is not needed
+            const auto& input_shape = transpose->get_input_shape(0);
+            const auto count = input_shape.back() == 1 ? 1 : vector_size;
+            auto load = std::make_shared<snippets::op::LoadReshape>(data_input, count, 0, layout);
+            PortDescriptorUtils::set_port_descriptor_ptr(load->input(0), std::make_shared<PortDescriptor>(load->get_input_shape(0),
+                                                                                                          std::vector<size_t>{}, layout));
+            PortDescriptorUtils::set_port_descriptor_ptr(load->output(0), std::make_shared<PortDescriptor>(load->get_output_shape(0),
+                                                                                                           std::vector<size_t>{}));
+            for (auto& input : transpose->output(0).get_target_inputs()) {
+                input.replace_source_output(load->output(0));
+            }
+            return true;
+        }
+
         // number of elements that can be processed on every iteration. For 0,1,2,3 -> 0,2,3,1 we can guarantee only scalar access
         const auto subtensor = std::vector<size_t>{1};
-        const auto& layout = order->cast_vector<size_t>();
 
         // todo: LoadReshape used here is essentially Load + an easy way to maintain correct shape propagation
         //  fix this in future and develop a more consistent shape propagation approach.
@@ -50,11 +50,16 @@ const IShapeInferSnippetsFactory::TRegistry IShapeInferSnippetsFactory::registry
         SHAPE_INFER_PREDEFINED(ov::op::v0::PRelu, PassThroughShapeInfer),
         SHAPE_INFER_PREDEFINED(op::HorizonMax, HorizonOpShapeInfer),
         SHAPE_INFER_PREDEFINED(op::HorizonSum, HorizonOpShapeInfer),
+        // Note: The reductions are decomposed on LIR as Softmax, they reduce the last dimension as the horizon ops
+        SHAPE_INFER_PREDEFINED(op::ReduceSum, HorizonOpShapeInfer),
+        SHAPE_INFER_PREDEFINED(op::ReduceMax, HorizonOpShapeInfer),
         //
         SHAPE_INFER_PREDEFINED(op::LoopBegin, SingleElementShapeInfer),
+        SHAPE_INFER_PREDEFINED(op::PerfCountBegin, SingleElementShapeInfer),
         SHAPE_INFER_PREDEFINED(op::Scalar, SingleElementShapeInfer),
         SHAPE_INFER_PREDEFINED(op::VectorBuffer, SingleElementShapeInfer),
         SHAPE_INFER_PREDEFINED(op::LoopEnd, EmptyShapeInfer),
+        SHAPE_INFER_PREDEFINED(op::PerfCountEnd, EmptyShapeInfer),
         SHAPE_INFER_PREDEFINED(op::Nop, EmptyShapeInfer),
         SHAPE_INFER_OP_SPECIFIC_EXTERNAL(opset1::Select, SelectShapeInfer),
         // Note that Result has no output PortConnectors, so the shape must be empty
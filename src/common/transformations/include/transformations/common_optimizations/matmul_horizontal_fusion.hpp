@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <memory>
+
+#include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pattern/matcher.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ov {
+namespace pass {
+
+class TRANSFORMATIONS_API MatMulHorizontalFusion;
+
+}  // namespace pass
+}  // namespace ov
+
+/**
+ * @ingroup ie_transformation_common_api
+ * @brief MatMulHorizontalFusion transformation fuses the MatMul layers sharing the first input and having the constant
+ * 2D weights (e.g. Q, K and V projections) into one MatMul with the concatenated weights followed by VariadicSplit.
+ * The MatMuls for which the transformation callback returns true are not fused, so a plugin may keep the MatMuls
+ * whose split output it cannot consume without a copy.
+ */
+class ov::pass::MatMulHorizontalFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MatMulHorizontalFusion", "0");
+    MatMulHorizontalFusion();
+};
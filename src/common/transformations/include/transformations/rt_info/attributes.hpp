@@ -21,6 +21,7 @@
 #include "transformations/rt_info/old_api_map_order_attribute.hpp"
 #include "transformations/rt_info/preprocessing_attribute.hpp"
 #include "transformations/rt_info/primitives_priority_attribute.hpp"
+#include "transformations/rt_info/sparse_weights.hpp"
 #include "transformations/rt_info/strides_property.hpp"
 #include "transformations_visibility.hpp"
 
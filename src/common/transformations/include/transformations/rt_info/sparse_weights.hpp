@@ -0,0 +1,52 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <string>
+
+#include "openvino/core/node.hpp"
+#include "openvino/core/runtime_attribute.hpp"
+#include "transformations_visibility.hpp"
+
+namespace ov {
+
+TRANSFORMATIONS_API void mark_as_sparse_weights(const std::shared_ptr<Node>& node, int64_t n, int64_t m);
+
+TRANSFORMATIONS_API bool has_sparse_weights(const std::shared_ptr<const Node>& node);
+
+/**
+ * @brief Returns the minimal share of the zeros in the weights of the marked node, 1 - N / M
+ */
+TRANSFORMATIONS_API float get_sparse_weights_rate(const std::shared_ptr<const Node>& node);
+
+/**
+ * @ingroup ie_runtime_attr_api
+ * @brief SparseWeights class represents runtime info attribute that marks operation
+ * whose weights have the N:M structured sparsity: at most N of each M consecutive
+ * weights along the reduction axis are non zero.
+ */
+class TRANSFORMATIONS_API SparseWeights : public RuntimeAttribute {
+public:
+    OPENVINO_RTTI("sparse_weights", "0");
+
+    SparseWeights() = default;
+
+    SparseWeights(int64_t n, int64_t m) : n(n), m(m) {}
+
+    bool visit_attributes(AttributeVisitor& visitor) override {
+        visitor.on_attribute("n", n);
+        visitor.on_attribute("m", m);
+        return true;
+    }
+
+    std::string to_string() const override {
+        return std::to_string(n) + ":" + std::to_string(m);
+    }
+
+    int64_t n = 0;
+    int64_t m = 0;
+};
+
+}  // namespace ov
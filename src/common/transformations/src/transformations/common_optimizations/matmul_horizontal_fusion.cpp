@@ -0,0 +1,121 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/matmul_horizontal_fusion.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "itt.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/core/validation_util.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/variadic_split.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/rt_info/decompression.hpp"
+#include "transformations/utils/utils.hpp"
+
+namespace {
+
+// Returns the weights constant of the MatMul, the constant may be decompressed by Convert
+std::shared_ptr<ov::op::v0::Constant> get_weights(const ov::op::v0::MatMul* matmul) {
+    auto weights = matmul->get_input_node_shared_ptr(1);
+    if (ov::is_type<ov::op::v0::Convert>(weights))
+        weights = weights->get_input_node_shared_ptr(0);
+    auto constant = ov::as_type_ptr<ov::op::v0::Constant>(weights);
+    if (!constant || constant->get_output_partial_shape(0).rank() != 2)
+        return nullptr;
+    return constant;
+}
+
+bool can_be_fused(const ov::op::v0::MatMul* matmul, const ov::op::v0::MatMul* other) {
+    const auto weights = matmul->get_input_node_ptr(1);
+    const auto other_weights = other->get_input_node_ptr(1);
+    if (matmul->get_transpose_a() != other->get_transpose_a() ||
+        matmul->get_transpose_b() != other->get_transpose_b() ||
+        matmul->get_output_element_type(0) != other->get_output_element_type(0) ||
+        weights->get_type_info() != other_weights->get_type_info() ||
+        weights->get_output_element_type(0) != other_weights->get_output_element_type(0) || !get_weights(other))
+        return false;
+    // the decompressed weights are concatenated in the compressed precision
+    return weights->get_input_size() == 0 ||
+           weights->get_input_element_type(0) == other_weights->get_input_element_type(0);
+}
+
+}  // namespace
+
+ov::pass::MatMulHorizontalFusion::MatMulHorizontalFusion() {
+    MATCHER_SCOPE(MatMulHorizontalFusion);
+    auto input_m = pass::pattern::any_input(ov::pass::pattern::consumers_more_than(1));
+    auto weights_m = pass::pattern::wrap_type<ov::op::v0::Constant, ov::op::v0::Convert>();
+    auto matmul_m = pass::pattern::wrap_type<ov::op::v0::MatMul>({input_m, weights_m});
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto matmul = ov::as_type_ptr<ov::op::v0::MatMul>(pattern_map.at(matmul_m).get_node_shared_ptr());
+        const auto input = pattern_map.at(input_m);
+        if (transformation_callback(matmul) || !get_weights(matmul.get()))
+            return false;
+
+        // the consumers are sorted to keep the order of the weights stable from run to run
+        std::vector<std::shared_ptr<ov::op::v0::MatMul>> matmuls;
+        for (const auto& in : input.get_target_inputs()) {
+            auto cur_matmul = ov::as_type<ov::op::v0::MatMul>(in.get_node());
+            if (in.get_index() == 0 && cur_matmul && can_be_fused(matmul.get(), cur_matmul) &&
+                !transformation_callback(cur_matmul->shared_from_this()))
+                matmuls.push_back(ov::as_type_ptr<ov::op::v0::MatMul>(cur_matmul->shared_from_this()));
+        }
+        if (matmuls.size() < 2)
+            return false;
+        std::sort(matmuls.begin(), matmuls.end(), [](const std::shared_ptr<Node>& a, const std::shared_ptr<Node>& b) {
+            return a->get_instance_id() < b->get_instance_id();
+        });
+
+        // the weights are [K, N] or [N, K] if transposed, so they are concatenated by N
+        const bool transpose_b = matmul->get_transpose_b();
+        const int64_t n_axis = transpose_b ? 0 : 1;
+        ov::OutputVector constants;
+        std::vector<int64_t> split_lengths;
+        ov::NodeVector from;
+        for (const auto& cur_matmul : matmuls) {
+            const auto constant = get_weights(cur_matmul.get());
+            constants.push_back(constant);
+            split_lengths.push_back(static_cast<int64_t>(constant->get_shape()[n_axis]));
+            from.push_back(cur_matmul);
+        }
+        const auto concat = std::make_shared<ov::op::v0::Concat>(constants, n_axis);
+        std::shared_ptr<ov::Node> weights = ov::get_constant_from_source(concat);
+        if (!weights)
+            return false;
+        const auto decompression = matmul->get_input_node_shared_ptr(1);
+        if (ov::is_type<ov::op::v0::Convert>(decompression)) {
+            auto convert = decompression->clone_with_new_inputs({weights});
+            ov::copy_runtime_info(decompression, convert);
+            if (ov::is_decompression(decompression))
+                ov::mark_as_decompression(convert);
+            weights = convert;
+        }
+
+        auto fused_matmul =
+            std::make_shared<ov::op::v0::MatMul>(input, weights, matmul->get_transpose_a(), transpose_b);
+        fused_matmul->set_friendly_name(matmul->get_friendly_name() + "/horizontal_fusion");
+        auto split = std::make_shared<ov::op::v1::VariadicSplit>(
+            fused_matmul,
+            ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {-1}),
+            ov::op::v0::Constant::create(ov::element::i64, ov::Shape{split_lengths.size()}, split_lengths));
+        ov::copy_runtime_info(from, {fused_matmul, split});
+
+        for (size_t i = 0; i < matmuls.size(); ++i)
+            matmuls[i]->output(0).replace(split->output(i));
+        split->set_friendly_name(matmul->get_friendly_name() + "/split");
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(matmul_m, matcher_name);
+    register_matcher(m, callback);
+}
@@ -4,18 +4,27 @@
 
 #include "transformations/common_optimizations/shared_ops_optimization.hpp"
 
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+
 #include "itt.hpp"
+#include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/concat.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/gather.hpp"
 #include "openvino/op/gather_elements.hpp"
+#include "openvino/op/random_uniform.hpp"
 #include "openvino/op/reshape.hpp"
+#include "openvino/op/result.hpp"
 #include "openvino/op/shape_of.hpp"
+#include "openvino/op/sink.hpp"
 #include "openvino/op/slice.hpp"
 #include "openvino/op/squeeze.hpp"
 #include "openvino/op/tile.hpp"
 #include "openvino/op/unsqueeze.hpp"
+#include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
 
 using namespace std;
@@ -25,6 +34,15 @@ using namespace ov::op;
 namespace {
 using rules_t = unordered_map<Node::type_info_t, bool (*)(const Node*, const Node*)>;
 
+// the operations compared by the attributes, which are not in the rules table, have to match all the outputs
+bool are_equal_by_attributes(const Node* lhs, const Node* rhs);
+
+bool can_be_compared_by_attributes(const Node* node) {
+    return node->get_control_dependencies().empty() && !ov::is_type<v0::Result>(node) &&
+           !dynamic_cast<const op::Sink*>(node) && !ov::is_type<op::util::ReadValueBase>(node) &&
+           !ov::is_type<v8::RandomUniform>(node) && !ov::is_type<op::util::MultiSubGraphOp>(node);
+}
+
 bool shared_node_optimization(const shared_ptr<Model>& model, const rules_t& rules) {
     bool rewritten = false;
 
@@ -43,13 +61,14 @@ bool shared_node_optimization(const shared_ptr<Model>& model, const rules_t& rul
             unordered_map<Node::type_info_t, vector<Node*>> type_to_node;
             for (const auto& input : target_inputs)
                 if (auto node = input.get_node())
-                    if (rules.count(node->get_type_info()))
+                    if (rules.count(node->get_type_info()) || can_be_compared_by_attributes(node))
                         type_to_node[node->get_type_info()].push_back(node);
             for (auto& item : type_to_node) {
                 auto& shared_nodes = item.second;
                 if (shared_nodes.size() < 2)
                     continue;
-                const auto& are_equal = rules.at(item.first);
+                const auto rule = rules.find(item.first);
+                const auto& are_equal = rule != rules.end() ? rule->second : are_equal_by_attributes;
 
                 std::vector<bool> visited_nodes(shared_nodes.size(), false);
                 for (size_t i = 0; i < visited_nodes.size(); ++i) {
@@ -62,7 +81,8 @@ bool shared_node_optimization(const shared_ptr<Model>& model, const rules_t& rul
                             continue;
                         const auto& child_op = shared_nodes[j];
                         if (are_equal(root_op, child_op)) {
-                            rewritten |= replace_output_update_name(child_op->output(0), root_op->output(0));
+                            for (size_t k = 0; k < (rule != rules.end() ? 1 : child_op->get_output_size()); ++k)
+                                rewritten |= replace_output_update_name(child_op->output(k), root_op->output(k));
                             visited_nodes[j] = true;
                         }
                     }
@@ -97,6 +117,120 @@ bool inputs_from_same_source_or_equal_constants(const Node* lhs, const Node* rhs
     return true;
 }
 
+// Collects the attributes of an operation as a binary string, an attribute of an unknown type makes the operation
+// incomparable
+class AttributesCollector : public AttributeVisitor {
+public:
+    void on_adapter(const std::string&, ValueAccessor<void>&) override {
+        m_comparable = false;
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::string>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<bool>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<int8_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<int16_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<int32_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<int64_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<uint8_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<uint16_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<uint32_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<uint64_t>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<float>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<double>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int8_t>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int16_t>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int32_t>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<int64_t>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<uint8_t>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<uint16_t>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<uint32_t>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<uint64_t>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<float>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<double>>& adapter) override {
+        add(name, adapter.get());
+    }
+    void on_adapter(const std::string& name, ValueAccessor<std::vector<std::string>>& adapter) override {
+        for (const auto& value : adapter.get())
+            add(name, value);
+    }
+
+    bool is_comparable() const {
+        return m_comparable;
+    }
+
+    const std::string& get_attributes() const {
+        return m_attributes;
+    }
+
+private:
+    void add(const std::string& name, const std::string& value) {
+        add_bytes(name.data(), name.size());
+        add_bytes(value.data(), value.size());
+    }
+
+    template <typename T>
+    void add(const std::string& name, const T& value) {
+        add_bytes(name.data(), name.size());
+        add_bytes(&value, sizeof(value));
+    }
+
+    template <typename T>
+    void add(const std::string& name, const std::vector<T>& value) {
+        add_bytes(name.data(), name.size());
+        add_bytes(value.data(), value.size() * sizeof(T));
+    }
+
+    // the size goes first, so the concatenation of the values is unambiguous
+    void add_bytes(const void* data, size_t size) {
+        m_attributes.append(reinterpret_cast<const char*>(&size), sizeof(size));
+        m_attributes.append(static_cast<const char*>(data), size);
+    }
+
+    std::string m_attributes;
+    bool m_comparable = true;
+};
+
 bool concats_are_equal(const Node* lhs, const Node* rhs) {
     const auto lhs_concat = as_type<const v0::Concat>(lhs);
     if (!lhs_concat)
@@ -162,6 +296,77 @@ bool converts_are_equal(const Node* lhs, const Node* rhs) {
            inputs_from_same_source_or_equal_constants(lhs, rhs);
 }
 
+bool have_same_rt_info_keys(const Node* lhs, const Node* rhs) {
+    const auto& lhs_rt_info = lhs->get_rt_info();
+    const auto& rhs_rt_info = rhs->get_rt_info();
+    if (lhs_rt_info.size() != rhs_rt_info.size())
+        return false;
+    for (const auto& item : lhs_rt_info)
+        if (!rhs_rt_info.count(item.first))
+            return false;
+    return true;
+}
+
+bool are_equal_by_attributes(const Node* lhs, const Node* rhs) {
+    if (lhs->get_type_info() != rhs->get_type_info() || lhs->get_output_size() != rhs->get_output_size())
+        return false;
+    for (size_t i = 0; i < lhs->get_output_size(); ++i) {
+        if (lhs->get_output_element_type(i) != rhs->get_output_element_type(i) ||
+            !lhs->get_output_partial_shape(i).same_scheme(rhs->get_output_partial_shape(i)))
+            return false;
+    }
+    // the markup of the transformations (e.g. the decompression, the disabled constant folding) has to match
+    if (!have_same_rt_info_keys(lhs, rhs) || !inputs_from_same_source_or_equal_constants(lhs, rhs))
+        return false;
+
+    // the operations not implementing visit_attributes can not be compared
+    AttributesCollector lhs_attributes, rhs_attributes;
+    if (!const_cast<Node*>(lhs)->visit_attributes(lhs_attributes) ||
+        !const_cast<Node*>(rhs)->visit_attributes(rhs_attributes))
+        return false;
+    return lhs_attributes.is_comparable() && rhs_attributes.is_comparable() &&
+           lhs_attributes.get_attributes() == rhs_attributes.get_attributes();
+}
+
+// Merges the Constants of the same type, shape and content, which are larger than the ones compared by the content in
+// inputs_from_same_source_or_equal_constants, so their consumers become the candidates for the merge as well
+bool shared_constants_optimization(const shared_ptr<Model>& model) {
+    bool rewritten = false;
+    // the constants are grouped by the type, the shape and the beginning of the data, the rest is compared in a group
+    constexpr size_t key_data_size = 64;
+    unordered_map<string, vector<shared_ptr<v0::Constant>>> groups;
+    for (const auto& op : model->get_ordered_ops()) {
+        if (auto multi_subgraph_op = dynamic_pointer_cast<op::util::MultiSubGraphOp>(op)) {
+            for (const auto& sub_graph : multi_subgraph_op->get_functions()) {
+                if (sub_graph)
+                    rewritten |= shared_constants_optimization(sub_graph);
+            }
+            continue;
+        }
+        auto constant = as_type_ptr<v0::Constant>(op);
+        if (!constant || shape_size(constant->get_shape()) <= 10 || !constant->get_control_dependencies().empty())
+            continue;
+
+        std::stringstream key;
+        key << constant->get_element_type() << constant->get_shape();
+        key.write(static_cast<const char*>(constant->get_data_ptr()),
+                  std::min(key_data_size, constant->get_byte_size()));
+        auto& group = groups[key.str()];
+        bool replaced = false;
+        for (const auto& root : group) {
+            if (have_same_rt_info_keys(root.get(), constant.get()) &&
+                memcmp(root->get_data_ptr(), constant->get_data_ptr(), constant->get_byte_size()) == 0) {
+                replaced = replace_output_update_name(constant->output(0), root->output(0));
+                rewritten |= replaced;
+                break;
+            }
+        }
+        if (!replaced)
+            group.push_back(constant);
+    }
+    return rewritten;
+}
+
 bool shape_of_upgrade(const shared_ptr<Model>& model) {
     bool rewritten = false;
     for (const auto& op : model->get_ordered_ops()) {
@@ -206,9 +411,10 @@ bool pass::SharedOpOptimization::run_on_model(const shared_ptr<Model>& model) {
         RECORD(v1::Reshape, reshapes_are_equal),
         RECORD(v0::ShapeOf, shapeof_are_equal),
         RECORD(v3::ShapeOf, shapeof_are_equal),
-    };  // TODO: use visit_attributes to uniformly perform attributes check in the future and get rid of rules table
+    };  // the rest of the operations are compared by the attributes collected with visit_attributes
 
     bool rewritten = shape_of_upgrade(model);
+    rewritten |= shared_constants_optimization(model);
     rewritten |= shared_node_optimization(model, rules);
     return rewritten;
 }
@@ -17,6 +17,7 @@ ov::pass::Attributes::Attributes() {
     register_factory<ov::preprocess::TensorInfoMemoryType>();
     register_factory<StridesPropagation>();
     register_factory<PreprocessingAttribute>();
+    register_factory<SparseWeights>();
 }
 
 ov::Any ov::pass::Attributes::create_by_type_info(const ov::DiscreteTypeInfo& type_info) {
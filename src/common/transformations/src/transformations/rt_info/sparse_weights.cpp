@@ -0,0 +1,24 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/rt_info/sparse_weights.hpp"
+
+void ov::mark_as_sparse_weights(const std::shared_ptr<Node>& node, int64_t n, int64_t m) {
+    auto& rt_info = node->get_rt_info();
+    rt_info[SparseWeights::get_type_info_static()] = SparseWeights{n, m};
+}
+
+bool ov::has_sparse_weights(const std::shared_ptr<const Node>& node) {
+    const auto& rt_info = node->get_rt_info();
+    return rt_info.count(SparseWeights::get_type_info_static());
+}
+
+float ov::get_sparse_weights_rate(const std::shared_ptr<const Node>& node) {
+    const auto& rt_info = node->get_rt_info();
+    const auto it = rt_info.find(SparseWeights::get_type_info_static());
+    if (it == rt_info.end())
+        return 0.f;
+    const auto& attr = it->second.as<SparseWeights>();
+    return attr.m > 0 ? 1.f - static_cast<float>(attr.n) / static_cast<float>(attr.m) : 0.f;
+}
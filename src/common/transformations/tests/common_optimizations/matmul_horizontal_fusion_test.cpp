@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformations/common_optimizations/matmul_horizontal_fusion.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/opsets/opset10.hpp"
+#include "transformations/rt_info/decompression.hpp"
+
+using namespace ov;
+using namespace testing;
+
+TEST_F(TransformationTestsF, MatMulHorizontalFusion) {
+    {
+        auto input = std::make_shared<opset10::Parameter>(element::f32, PartialShape{-1, -1, 4});
+        auto q = std::make_shared<opset10::MatMul>(input,
+                                                   opset10::Constant::create(element::f32, Shape{2, 4}, {1}),
+                                                   false,
+                                                   true);
+        auto k = std::make_shared<opset10::MatMul>(input,
+                                                   opset10::Constant::create(element::f32, Shape{3, 4}, {2}),
+                                                   false,
+                                                   true);
+        auto v = std::make_shared<opset10::MatMul>(input,
+                                                   opset10::Constant::create(element::f32, Shape{2, 4}, {3}),
+                                                   false,
+                                                   true);
+        model = std::make_shared<Model>(NodeVector{q, k, v}, ParameterVector{input});
+        manager.register_pass<ov::pass::MatMulHorizontalFusion>();
+    }
+    {
+        auto input = std::make_shared<opset10::Parameter>(element::f32, PartialShape{-1, -1, 4});
+        auto weights = opset10::Constant::create(element::f32,
+                                                 Shape{7, 4},
+                                                 {1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+                                                  3, 3, 3, 3, 3, 3, 3, 3});
+        auto matmul = std::make_shared<opset10::MatMul>(input, weights, false, true);
+        auto axis = opset10::Constant::create(element::i64, Shape{}, {-1});
+        auto split_lengths = opset10::Constant::create(element::i64, Shape{3}, {2, 3, 2});
+        auto split = std::make_shared<opset10::VariadicSplit>(matmul, axis, split_lengths);
+        model_ref = std::make_shared<Model>(split->outputs(), ParameterVector{input});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, MatMulHorizontalFusionDecompressedWeights) {
+    auto make_weights = [](const Shape& shape, const std::vector<float>& values) {
+        auto convert =
+            std::make_shared<opset10::Convert>(opset10::Constant::create(element::f16, shape, values), element::f32);
+        mark_as_decompression(convert);
+        return convert;
+    };
+    {
+        auto input = std::make_shared<opset10::Parameter>(element::f32, PartialShape{-1, 2});
+        auto gate = std::make_shared<opset10::MatMul>(input, make_weights(Shape{2, 1}, {1, 2}));
+        auto up = std::make_shared<opset10::MatMul>(input, make_weights(Shape{2, 2}, {3, 4, 5, 6}));
+        model = std::make_shared<Model>(NodeVector{gate, up}, ParameterVector{input});
+        manager.register_pass<ov::pass::MatMulHorizontalFusion>();
+    }
+    {
+        auto input = std::make_shared<opset10::Parameter>(element::f32, PartialShape{-1, 2});
+        auto matmul = std::make_shared<opset10::MatMul>(input, make_weights(Shape{2, 3}, {1, 3, 4, 2, 5, 6}));
+        auto axis = opset10::Constant::create(element::i64, Shape{}, {-1});
+        auto split_lengths = opset10::Constant::create(element::i64, Shape{2}, {1, 2});
+        auto split = std::make_shared<opset10::VariadicSplit>(matmul, axis, split_lengths);
+        model_ref = std::make_shared<Model>(split->outputs(), ParameterVector{input});
+    }
+    comparator.enable(FunctionsComparator::CmpValues::CONST_VALUES);
+}
+
+TEST_F(TransformationTestsF, MatMulHorizontalFusionDifferentTranspose) {
+    {
+        auto input = std::make_shared<opset10::Parameter>(element::f32, PartialShape{-1, 4});
+        auto first = std::make_shared<opset10::MatMul>(input,
+                                                       opset10::Constant::create(element::f32, Shape{4, 4}, {1}),
+                                                       false,
+                                                       true);
+        auto second = std::make_shared<opset10::MatMul>(input,
+                                                        opset10::Constant::create(element::f32, Shape{4, 4}, {2}),
+                                                        false,
+                                                        false);
+        model = std::make_shared<Model>(NodeVector{first, second}, ParameterVector{input});
+        manager.register_pass<ov::pass::MatMulHorizontalFusion>();
+    }
+}
+
+TEST_F(TransformationTestsF, MatMulHorizontalFusionRejectedByCallback) {
+    {
+        auto input = std::make_shared<opset10::Parameter>(element::f32, PartialShape{-1, 4});
+        auto first = std::make_shared<opset10::MatMul>(input, opset10::Constant::create(element::f32, Shape{4, 2}, {1}));
+        auto second =
+            std::make_shared<opset10::MatMul>(input, opset10::Constant::create(element::f32, Shape{4, 3}, {2}));
+        model = std::make_shared<Model>(NodeVector{first, second}, ParameterVector{input});
+        manager.get_pass_config()->set_callback<ov::pass::MatMulHorizontalFusion>(
+            [](const std::shared_ptr<const Node>& node) -> bool {
+                return node->get_output_partial_shape(0)[0] != 1;
+            });
+        manager.register_pass<ov::pass::MatMulHorizontalFusion>();
+    }
+}
@@ -5,13 +5,18 @@
 
 #include <gtest/gtest.h>
 
+#include <numeric>
+
 #include "common_test_utils/ov_test_utils.hpp"
+#include "openvino/op/add.hpp"
 #include "openvino/op/concat.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
 #include "openvino/op/reshape.hpp"
 #include "openvino/op/shape_of.hpp"
 #include "openvino/op/slice.hpp"
+#include "openvino/op/softmax.hpp"
 #include "openvino/op/tile.hpp"
 
 using namespace ov;
@@ -433,3 +438,56 @@ TEST_F(SharedTransformationTestsF, SharedShapeOfTestMixed) {
         model_ref = std::make_shared<Model>(NodeVector{concat}, ParameterVector{input});
     }
 }
+
+TEST_F(SharedTransformationTestsF, SharedSubgraphByAttributes) {
+    {
+        auto data = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1});
+
+        auto multiply_0 = std::make_shared<v1::Multiply>(data, v0::Constant::create(element::f32, Shape{}, {2.f}));
+        auto softmax_0 = std::make_shared<v8::Softmax>(multiply_0, 1);
+        auto multiply_1 = std::make_shared<v1::Multiply>(data, v0::Constant::create(element::f32, Shape{}, {2.f}));
+        auto softmax_1 = std::make_shared<v8::Softmax>(multiply_1, 1);
+        auto softmax_2 = std::make_shared<v8::Softmax>(multiply_1, 0);
+
+        auto concat = std::make_shared<v0::Concat>(OutputVector{softmax_0, softmax_1, softmax_2}, 0);
+        model = std::make_shared<ov::Model>(OutputVector{concat}, ParameterVector{data});
+        manager.register_pass<ov::pass::SharedOpOptimization>();
+    }
+    {
+        auto data = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1});
+
+        auto multiply = std::make_shared<v1::Multiply>(data, v0::Constant::create(element::f32, Shape{}, {2.f}));
+        auto softmax_0 = std::make_shared<v8::Softmax>(multiply, 1);
+        auto softmax_2 = std::make_shared<v8::Softmax>(multiply, 0);
+
+        auto concat = std::make_shared<v0::Concat>(OutputVector{softmax_0, softmax_0, softmax_2}, 0);
+        model_ref = std::make_shared<ov::Model>(OutputVector{concat}, ParameterVector{data});
+    }
+}
+
+TEST_F(SharedTransformationTestsF, SharedLargeConstants) {
+    std::vector<float> values(16);
+    std::iota(values.begin(), values.end(), 0.f);
+    {
+        auto data = std::make_shared<v0::Parameter>(element::f32, PartialShape{16});
+
+        auto add_0 = std::make_shared<v1::Add>(data, v0::Constant::create(element::f32, Shape{16}, values));
+        auto add_1 = std::make_shared<v1::Add>(data, v0::Constant::create(element::f32, Shape{16}, values));
+        values.back() = -1.f;
+        auto add_2 = std::make_shared<v1::Add>(data, v0::Constant::create(element::f32, Shape{16}, values));
+
+        auto concat = std::make_shared<v0::Concat>(OutputVector{add_0, add_1, add_2}, 0);
+        model = std::make_shared<ov::Model>(OutputVector{concat}, ParameterVector{data});
+        manager.register_pass<ov::pass::SharedOpOptimization>();
+    }
+    {
+        auto data = std::make_shared<v0::Parameter>(element::f32, PartialShape{16});
+
+        auto add_2 = std::make_shared<v1::Add>(data, v0::Constant::create(element::f32, Shape{16}, values));
+        values.back() = 15.f;
+        auto add_0 = std::make_shared<v1::Add>(data, v0::Constant::create(element::f32, Shape{16}, values));
+
+        auto concat = std::make_shared<v0::Concat>(OutputVector{add_0, add_0, add_2}, 0);
+        model_ref = std::make_shared<ov::Model>(OutputVector{concat}, ParameterVector{data});
+    }
+}
@@ -24,6 +24,7 @@
 #include "openvino/reference/utils/coordinate_transform.hpp"
 #include "openvino/util/env_util.hpp"
 #include "transformations/init_node_info.hpp"
+#include "transformations/rt_info/sparse_weights.hpp"
 
 #define VISUALIZE_TESTS_TREE false
 #define VISUALIZE_TREE_ROOT  "/tmp/"
@@ -6202,3 +6203,27 @@ TEST_F(TransformationTestsF, PruningReshapeNegativeOneNonConstantShape) {
     comparator.enable(FunctionsComparator::CmpValues::ATTRIBUTES);
     comparator.enable(FunctionsComparator::CmpValues::ACCURACY);
 }
+
+TEST(TransformationTests, MarkStructuredSparseWeights) {
+    auto input = std::make_shared<opset10::Parameter>(element::f32, Shape{1, 8});
+    // two of each four weights along K are zeros
+    std::vector<float> sparse_values(8 * 6, 1.f);
+    for (size_t k = 0; k < 8; k++) {
+        for (size_t n = 0; n < 6; n++) {
+            if ((k + n) % 4 < 2)
+                sparse_values[k * 6 + n] = 0.f;
+        }
+    }
+    auto sparse_matmul =
+        std::make_shared<opset10::MatMul>(input, opset10::Constant::create(element::f32, Shape{8, 6}, sparse_values));
+    auto dense_matmul = std::make_shared<opset10::MatMul>(input, create_constant_with_zeros({8, 6}, {{}, {}}));
+    auto model = std::make_shared<ov::Model>(OutputVector{sparse_matmul, dense_matmul}, ParameterVector{input});
+
+    pass::Manager m;
+    m.register_pass<pass::MarkStructuredSparseWeights>();
+    m.run_passes(model);
+
+    ASSERT_TRUE(ov::has_sparse_weights(sparse_matmul));
+    ASSERT_EQ(ov::get_sparse_weights_rate(sparse_matmul), 0.5f);
+    ASSERT_FALSE(ov::has_sparse_weights(dense_matmul));
+}
@@ -0,0 +1,193 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "pugixml.hpp"
+
+namespace ov {
+/**
+ * @brief Binary encoding of the IR XML document
+ *
+ * The document tree is stored as the indices in a table of the unique strings, so the reader neither tokenizes nor
+ * unescapes the text and the names and the values repeated over the layers ("port", "dim", "f32", ...) are stored once.
+ * The layout, all the integers are in the native byte order:
+ *
+ *     [ signature, 8 bytes ] [ IR version, uint64 ]
+ *     [ strings number, uint32 ] [ strings size, uint64 ] [ the NUL terminated strings ]
+ *     [ nodes ]
+ *
+ * where a node is an element [ 1, uint8 ] [ name, uint32 ] [ attributes number, uint32 ] [ name, value, uint32 ]...
+ * [ children number, uint32 ] [ children ] or a text [ 2, uint8 ] [ value, uint32 ], the document is an element.
+ * The header and the functions are inline as the document is saved by the core and loaded by the IR frontend, which
+ * have their own pugixml.
+ */
+namespace binary_xml {
+
+constexpr char signature[8] = {'O', 'V', 'B', 'X', 'M', 'L', '\0', '\1'};
+
+enum NodeType : uint8_t { ELEMENT = 1, TEXT = 2 };
+
+/**
+ * @brief Checks if the data begins with the binary XML signature
+ */
+inline bool is_binary_xml(const char* data, size_t size) {
+    return size >= sizeof(signature) && std::memcmp(data, signature, sizeof(signature)) == 0;
+}
+
+/**
+ * @brief Returns the IR version of the binary XML, the data should contain the header at least
+ */
+inline uint64_t get_ir_version(const char* data, size_t size) {
+    if (size < sizeof(signature) + sizeof(uint64_t) || !is_binary_xml(data, size))
+        return 0;
+    uint64_t version;
+    std::memcpy(&version, data + sizeof(signature), sizeof(version));
+    return version;
+}
+
+/**
+ * @brief Writes the document in the binary XML format
+ */
+inline void save(const pugi::xml_document& doc, std::ostream& stream) {
+    std::unordered_map<std::string, uint32_t> string_ids;
+    std::string strings;
+    std::string nodes;
+
+    auto write = [&nodes](const void* value, size_t size) {
+        nodes.append(static_cast<const char*>(value), size);
+    };
+    auto write_string = [&](const char* value) {
+        auto it = string_ids.emplace(value, static_cast<uint32_t>(string_ids.size()));
+        if (it.second) {
+            strings.append(value);
+            strings.push_back('\0');
+        }
+        write(&it.first->second, sizeof(uint32_t));
+    };
+    std::function<void(const pugi::xml_node&)> write_node = [&](const pugi::xml_node& node) {
+        if (node.type() == pugi::node_pcdata || node.type() == pugi::node_cdata) {
+            const auto type = TEXT;
+            write(&type, sizeof(type));
+            write_string(node.value());
+            return;
+        }
+        const auto type = ELEMENT;
+        write(&type, sizeof(type));
+        write_string(node.name());
+        const auto attributes_num =
+            static_cast<uint32_t>(std::distance(node.attributes_begin(), node.attributes_end()));
+        write(&attributes_num, sizeof(attributes_num));
+        for (const auto& attribute : node.attributes()) {
+            write_string(attribute.name());
+            write_string(attribute.value());
+        }
+        uint32_t children_num = 0;
+        for (const auto& child : node.children()) {
+            if (child.type() == pugi::node_element || child.type() == pugi::node_pcdata ||
+                child.type() == pugi::node_cdata)
+                ++children_num;
+        }
+        write(&children_num, sizeof(children_num));
+        for (const auto& child : node.children()) {
+            if (child.type() == pugi::node_element || child.type() == pugi::node_pcdata ||
+                child.type() == pugi::node_cdata)
+                write_node(child);
+        }
+    };
+    write_node(doc);
+
+    const uint64_t version = doc.document_element().attribute("version").as_ullong();
+    const uint32_t strings_num = static_cast<uint32_t>(string_ids.size());
+    const uint64_t strings_size = strings.size();
+    stream.write(signature, sizeof(signature));
+    stream.write(reinterpret_cast<const char*>(&version), sizeof(version));
+    stream.write(reinterpret_cast<const char*>(&strings_num), sizeof(strings_num));
+    stream.write(reinterpret_cast<const char*>(&strings_size), sizeof(strings_size));
+    stream.write(strings.data(), strings.size());
+    stream.write(nodes.data(), nodes.size());
+}
+
+/**
+ * @brief Reads the document written by save() from the data
+ */
+inline void load(pugi::xml_document& doc, const char* data, size_t size) {
+    const char* const end = data + size;
+    auto read = [&](void* value, size_t value_size) {
+        OPENVINO_ASSERT(static_cast<size_t>(end - data) >= value_size, "The binary XML is truncated");
+        std::memcpy(value, data, value_size);
+        data += value_size;
+    };
+
+    OPENVINO_ASSERT(is_binary_xml(data, size), "The binary XML signature is not found");
+    data += sizeof(signature);
+    uint64_t version;
+    uint32_t strings_num;
+    uint64_t strings_size;
+    read(&version, sizeof(version));
+    read(&strings_num, sizeof(strings_num));
+    read(&strings_size, sizeof(strings_size));
+    OPENVINO_ASSERT(static_cast<uint64_t>(end - data) >= strings_size, "The binary XML is truncated");
+    OPENVINO_ASSERT(!strings_size || data[strings_size - 1] == '\0', "The binary XML strings table is corrupted");
+
+    // the strings are passed to pugixml right from the data
+    std::vector<const char*> strings;
+    strings.reserve(strings_num);
+    for (const char* string = data; string < data + strings_size; string += std::strlen(string) + 1)
+        strings.push_back(string);
+    OPENVINO_ASSERT(strings.size() == strings_num, "The binary XML strings table is corrupted");
+    data += strings_size;
+
+    auto read_string = [&]() {
+        uint32_t id;
+        read(&id, sizeof(id));
+        OPENVINO_ASSERT(id < strings.size(), "The binary XML string index is out of range");
+        return strings[id];
+    };
+    std::function<void(pugi::xml_node&, bool)> read_node = [&](pugi::xml_node& parent, bool is_document) {
+        NodeType type;
+        read(&type, sizeof(type));
+        if (type == TEXT) {
+            parent.append_child(pugi::node_pcdata).set_value(read_string());
+            return;
+        }
+        OPENVINO_ASSERT(type == ELEMENT, "The binary XML node type is unknown");
+        const auto name = read_string();
+        pugi::xml_node node = is_document ? parent : parent.append_child(name);
+        uint32_t attributes_num;
+        read(&attributes_num, sizeof(attributes_num));
+        for (uint32_t i = 0; i < attributes_num; ++i) {
+            const auto attribute_name = read_string();
+            node.append_attribute(attribute_name).set_value(read_string());
+        }
+        uint32_t children_num;
+        read(&children_num, sizeof(children_num));
+        for (uint32_t i = 0; i < children_num; ++i)
+            read_node(node, false);
+    };
+    doc.reset();
+    read_node(doc, true);
+}
+
+/**
+ * @brief Reads the document written by save() from the rest of the stream
+ */
+inline void load(pugi::xml_document& doc, std::istream& stream) {
+    const std::string data{std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>()};
+    load(doc, data.data(), data.size());
+}
+
+}  // namespace binary_xml
+}  // namespace ov
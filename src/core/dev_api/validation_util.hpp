@@ -38,5 +38,19 @@ OPENVINO_API int64_t clip(const int64_t& value, const int64_t& min, const int64_
 ///
 /// \return Constant node or nullptr if unable to constantfold the subgraph
 OPENVINO_API std::shared_ptr<op::v0::Constant> constantfold_subgraph(const Output<Node>& subgraph_sink);
+
+/// \brief Folds the node splitting the constant along the axis into the views of the constant data. The node outputs
+///        are the consecutive ranges of the data along the axis, e.g. Split or VariadicSplit.
+///
+/// \param node           Node to fold, its output shapes should be static.
+/// \param data           Constant being split.
+/// \param axis           Split axis, may be negative.
+/// \param output_values  The views of the data.
+///
+/// \return False if the ranges are not contiguous in the data, i.e. a dimension before the axis is not 1.
+OPENVINO_API bool fold_split_to_views(const Node* node,
+                                      const op::v0::Constant& data,
+                                      int64_t axis,
+                                      OutputVector& output_values);
 }  // namespace util
 }  // namespace ov
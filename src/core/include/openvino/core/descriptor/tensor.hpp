@@ -104,6 +104,11 @@ public:
         return m_upper_value && m_lower_value && m_upper_value.data() == m_lower_value.data();
     }
     size_t size() const;
+    /// \brief Returns the version of the element type and the shape. It changes with them and is unique among all the
+    ///        tensors, so a consumer may check if the tensor has changed since it was seen.
+    uint64_t get_version() const {
+        return m_version;
+    }
 
     RTMap& get_rt_info() {
         return m_rt_info;
@@ -141,6 +146,7 @@ protected:
     std::unordered_set<std::string>::const_iterator m_name_it;
     RTMap m_rt_info;
     mutable std::atomic_bool m_shape_changed;
+    uint64_t m_version;
 
     friend OPENVINO_API std::string get_ov_tensor_legacy_name(const Tensor& tensor);
     friend OPENVINO_API void set_ov_tensor_legacy_name(Tensor& tensor, const std::string& tensor_name);
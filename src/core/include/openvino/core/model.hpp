@@ -177,6 +177,18 @@ public:
 
     void validate_nodes_and_infer_types() const;
 
+    /// \brief Enables the incremental mode of validate_nodes_and_infer_types(). In this mode the nodes are not
+    ///        revalidated if the element types and the shapes of their inputs have not changed since their last
+    ///        validation and none of their producers with inputs was revalidated, as the values of the producer
+    ///        outputs may change with the same shapes. The changes of the node attributes are not tracked, so the
+    ///        code changing them should call revalidate_and_infer_types() of the node itself. The nodes without
+    ///        inputs, with the subgraphs or the variables are always revalidated.
+    /// \param enable Enables the incremental mode if true
+    void set_incremental_validation(bool enable);
+
+    /// \brief Returns true if the incremental mode of validate_nodes_and_infer_types() is enabled
+    bool get_incremental_validation() const;
+
     /// \brief Returns the sum of the size of all nodes in the graph plus the size of
     /// all constant data. This has little value beyond comparing the relative size of
     /// graphs and should not be considered the actual memory consumption of a graph.
@@ -572,7 +584,6 @@ private:
     // of weak_ptr not to increase node ref counter to prevent the situation when
     // node has no consumers but still exists in a graph.
     mutable std::vector<std::weak_ptr<Node>> m_cached_ordered_ops;
-    mutable std::unordered_set<Node*> m_cached_ops;
 
     mutable std::unordered_map<std::string, Output<Node>> m_cached_output_names;
     mutable std::unordered_map<std::string, std::weak_ptr<Node>> m_cached_op_names;
@@ -582,6 +593,8 @@ private:
     std::shared_ptr<SharedRTInfo> m_shared_rt_info;
 
     mutable std::mutex m_model_mutex;
+
+    bool m_incremental_validation = false;
 };
 
 OPENVINO_API
@@ -472,6 +472,9 @@ private:
     static std::atomic<size_t> m_next_instance_id;
     std::deque<descriptor::Input> m_inputs;
     std::deque<descriptor::Output> m_outputs;
+    // Versions of the input tensors at the last validation by Model::validate_nodes_and_infer_types(), used by its
+    // incremental mode to skip the nodes whose inputs have not changed
+    std::vector<uint64_t> m_validated_input_versions;
     RTMap m_rt_info;
 
     // The vector of SharedRTInfo attributes associated to Functions
@@ -184,6 +184,13 @@ public:
 
     Constant(const Constant& other);
     Constant(const Constant& other, const Shape& new_shape);
+    /// \brief Constructs a tensor constant viewing a contiguous range of the other constant data, the data is
+    ///        shared and kept alive by the view, nothing is copied.
+    ///
+    /// \param other The constant owning the data.
+    /// \param new_shape The shape of the view.
+    /// \param byte_offset The offset of the view data from the beginning of the other constant data.
+    Constant(const Constant& other, const Shape& new_shape, size_t byte_offset);
     Constant& operator=(const Constant&) = delete;
 
     ~Constant() override;
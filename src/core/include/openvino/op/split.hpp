@@ -46,6 +46,7 @@ public:
     bool evaluate_upper(TensorVector& outputs) const override;
     bool has_evaluate() const override;
     bool evaluate_label(TensorLabelVector& output_labels) const override;
+    bool constant_fold(OutputVector& output_values, const OutputVector& inputs_values) override;
 
 protected:
     size_t m_num_splits;
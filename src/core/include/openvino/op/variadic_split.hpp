@@ -44,6 +44,7 @@ public:
     bool evaluate_upper(TensorVector& outputs) const override;
     bool has_evaluate() const override;
     bool evaluate_label(TensorLabelVector& output_labels) const override;
+    bool constant_fold(OutputVector& output_values, const OutputVector& inputs_values) override;
 
 private:
     bool evaluate_variadic_split(const HostTensorVector& outputs, const HostTensorVector& inputs) const;
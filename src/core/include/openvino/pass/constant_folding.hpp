@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 #include "openvino/core/runtime_attribute.hpp"
 #include "openvino/pass/pass.hpp"
 
@@ -26,6 +28,13 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+    /// \brief Folds the nodes with the constant inputs in parallel, wave by wave, as the nodes of one wave do not
+    /// depend on each other. The nodes which are not folded are added to not_folded.
+    bool fold_independent_nodes(const std::shared_ptr<ov::Model>& model,
+                                bool validate,
+                                std::unordered_set<const Node*>& not_folded);
+    /// \brief Replaces the outputs of the folded node by the replacements
+    bool replace_with_folded(const std::shared_ptr<Node>& node, const OutputVector& replacements);
 };
 
 /**
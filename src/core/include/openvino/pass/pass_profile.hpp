@@ -0,0 +1,84 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+namespace pass {
+/// \brief Profile of a pass run by pass::Manager or of a MatcherPass run by GraphRewrite
+struct PassProfile {
+    std::string name;
+    /// \brief Wall time of the pass including its nested passes
+    std::chrono::nanoseconds duration{0};
+    /// \brief Number of the model operations before and after the pass, not collected for the MatcherPasses
+    size_t nodes_before = 0;
+    size_t nodes_after = 0;
+    /// \brief Number of the runs, for a MatcherPass it is the number of the nodes it was tried on. 0 for a pass
+    /// skipped because it requires the static shapes.
+    size_t runs = 0;
+    /// \brief Number of the runs which changed the model
+    size_t applied = 0;
+    /// \brief The passes run by this one: the passes of the nested pass::Managers and the MatcherPasses of a
+    /// GraphRewrite, the latter are merged by the name
+    std::vector<PassProfile> children;
+};
+
+/// \brief Collects the profile of the passes run by pass::Manager on the calling thread while the profiler exists.
+/// Without a profiler the Manager does not collect anything. For example:
+///
+///     pass::PassProfiler profiler;
+///     manager.run_passes(model);
+///     std::cout << profiler.to_json();
+///
+/// The profilers can be nested, the passes run during the lifetime of the inner one are collected by it only.
+class OPENVINO_API PassProfiler {
+public:
+    PassProfiler();
+    ~PassProfiler();
+
+    PassProfiler(const PassProfiler&) = delete;
+    PassProfiler& operator=(const PassProfiler&) = delete;
+
+    /// \return The root of the profile, its children are the passes run by the outermost Managers
+    const PassProfile& get_profile() const {
+        return m_profile;
+    }
+
+    /// \return The profile as a JSON array of the passes run by the outermost Managers, each one is an object with
+    /// "name", "duration_ns", "nodes_before", "nodes_after", "runs", "applied" and "children" fields
+    std::string to_json() const;
+
+    /// \return The profile of the pass being run on the calling thread, the nested passes are added to its children.
+    /// nullptr if there is no profiler.
+    static PassProfile* get_current();
+
+private:
+    PassProfile m_profile;
+    PassProfile* m_previous = nullptr;
+
+    friend class PassProfileScope;
+    static PassProfile* set_current(PassProfile* profile);
+};
+
+/// \brief Makes the profile of a pass the current one on the calling thread while the pass runs, so the passes it
+/// runs are added to the profile children
+class OPENVINO_API PassProfileScope {
+public:
+    explicit PassProfileScope(PassProfile* profile);
+    ~PassProfileScope();
+
+    PassProfileScope(const PassProfileScope&) = delete;
+    PassProfileScope& operator=(const PassProfileScope&) = delete;
+
+private:
+    PassProfile* m_previous;
+};
+}  // namespace pass
+}  // namespace ov
@@ -40,8 +40,18 @@ public:
         IR_V10 = 10,      // v10 IR
         IR_V11 = 11       // v11 IR
     };
+
+    enum class Format : uint8_t {
+        XML = 0,    // IR XML
+        BINARY = 1  // Binary encoding of the IR XML, read by the IR frontend without the XML parsing
+    };
     bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
 
+    /// \brief Sets the format of the model file or stream, the weights are written the same way for all formats
+    void set_format(Format format) {
+        m_format = format;
+    }
+
     OPENVINO_DEPRECATED("This constructor is deprecated. Please use new extension API")
     Serialize(std::ostream& xmlFile,
               std::ostream& binFile,
@@ -63,6 +73,7 @@ private:
     const std::string m_binPath;
     const Version m_version;
     const std::map<std::string, ngraph::OpSet> m_custom_opsets;
+    Format m_format = Format::XML;
 };
 
 /**
@@ -86,6 +97,12 @@ public:
 
     bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
 
+    /// \brief Sets the format of the model part of the stream, the plugins use Serialize::Format::BINARY for the
+    /// cache blobs to speed up the import
+    void set_format(Serialize::Format format) {
+        m_format = format;
+    }
+
     OPENVINO_DEPRECATED("This constructor is deprecated. Please use new extension API")
     StreamSerialize(std::ostream& stream,
                     std::map<std::string, ngraph::OpSet>&& custom_opsets = {},
@@ -100,6 +117,7 @@ private:
     std::map<std::string, ngraph::OpSet> m_custom_opsets;
     std::function<void(std::ostream&)> m_custom_data_serializer;
     const Serialize::Version m_version;
+    Serialize::Format m_format = Serialize::Format::XML;
 };
 OPENVINO_SUPPRESS_DEPRECATED_END
 
@@ -0,0 +1,83 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the pooled allocator of the tensors memory
+ * @file openvino/runtime/pooled_allocator.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "openvino/core/core_visibility.hpp"
+
+namespace ov {
+
+/**
+ * @brief Allocator recycling the freed memory blocks by size classes, to be passed to ov::Allocator.
+ *
+ * The applications creating the input tensors per request pass it to ov::Tensor to avoid the system allocator on
+ * the request path. The freed blocks are kept in the pool of the freeing thread and reused by its next allocations of
+ * the same size class, so the memory touched by a thread pinned to a NUMA node mostly stays on that node. The copies
+ * of a PooledAllocator share one pool.
+ * @ingroup ov_runtime_cpp_api
+ */
+class OPENVINO_API PooledAllocator {
+public:
+    /**
+     * @brief Statistics of the pool
+     */
+    struct Statistics {
+        size_t allocations = 0;      //!< Number of the allocations
+        size_t reused = 0;           //!< Number of the allocations served by a cached block
+        size_t allocated_bytes = 0;  //!< Size of the blocks in use, rounded up to the size classes
+        size_t cached_bytes = 0;     //!< Size of the freed blocks kept for the reuse
+    };
+
+    /**
+     * @brief Constructs the allocator with a new pool
+     * @param max_cached_bytes The limit of the memory kept by the pool, the blocks freed above it are released
+     */
+    explicit PooledAllocator(size_t max_cached_bytes = 256 * 1024 * 1024);
+
+    /**
+     * @brief Allocates memory
+     * @param bytes The size in bytes at least to allocate
+     * @param alignment The alignment of storage, must be a power of 2
+     * @return Handle to the allocated memory
+     */
+    void* allocate(const size_t bytes, const size_t alignment = alignof(max_align_t));
+
+    /**
+     * @brief Returns the block to the pool of the calling thread, or releases it above the cache limit
+     * @param handle The handle returned by allocate()
+     * @param bytes The size passed to allocate(), the pool does not rely on it
+     * @param alignment The alignment passed to allocate()
+     */
+    void deallocate(void* handle, const size_t bytes, const size_t alignment = alignof(max_align_t));
+
+    /**
+     * @brief Compares with other PooledAllocator
+     * @param other Other instance of the allocator
+     * @return `true` if both allocators share the pool
+     */
+    bool is_equal(const PooledAllocator& other) const;
+
+    /**
+     * @brief Returns the statistics of the pool
+     */
+    Statistics get_statistics() const;
+
+    /**
+     * @brief Releases all the cached blocks
+     */
+    void release_cached_memory();
+
+private:
+    struct Pool;
+    std::shared_ptr<Pool> m_pool;
+};
+
+}  // namespace ov
@@ -8,6 +8,7 @@
 
 #include "ngraph/type/element_type.hpp"
 #include "ngraph/type/float16.hpp"
+#include "openvino/reference/utils/parallel_chunks.hpp"
 
 namespace ov {
 namespace reference {
@@ -94,9 +95,11 @@ void lp_convert(const TI* arg, TO* out, size_t count, element::Type_t src_type,
 
 template <typename TI, typename TO>
 typename std::enable_if<!std::is_same<TO, char>::value>::type convert(const TI* arg, TO* out, size_t count) {
-    for (size_t i = 0; i < count; ++i) {
-        out[i] = static_cast<TO>(arg[i]);
-    }
+    parallel_chunks(count, min_parallel_chunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            out[i] = static_cast<TO>(arg[i]);
+        }
+    });
 }
 
 #if defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64)
@@ -123,9 +126,11 @@ void convert_from_f32_to_f16_with_clamp(const float* arg, float16* out, size_t c
 // overload to handle ngraph::boolean (it is stored as char)
 template <typename TI, typename TO>
 typename std::enable_if<std::is_same<TO, char>::value>::type convert(const TI* arg, TO* out, size_t count) {
-    for (size_t i = 0; i < count; ++i) {
-        out[i] = static_cast<char>(static_cast<bool>(arg[i]));
-    }
+    parallel_chunks(count, min_parallel_chunk, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            out[i] = static_cast<char>(static_cast<bool>(arg[i]));
+        }
+    });
 }
 
 }  // namespace reference
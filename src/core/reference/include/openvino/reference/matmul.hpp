@@ -12,6 +12,7 @@
 #include "ngraph/runtime/opt_kernel/reshape.hpp"
 #include "ngraph/shape_util.hpp"
 #include "openvino/reference/broadcast.hpp"
+#include "openvino/reference/utils/parallel_chunks.hpp"
 
 namespace ov {
 namespace reference {
@@ -23,7 +24,6 @@ void dot(const T* arg0,
          const Shape& arg0_shape,
          const Shape& arg1_shape,
          const Shape& out_shape) {
-    std::fill(out, out + shape_size(out_shape), T{0});
     const size_t arg0_rank = arg0_shape.size();
     const size_t arg1_rank = arg1_shape.size();
 
@@ -34,16 +34,20 @@ void dot(const T* arg0,
     const size_t J_dim = arg1_rank == 1 ? 1 : arg1_shape[arg1_rank - 1];
     const size_t K_dim = arg1_rank == 1 ? arg1_shape[arg1_rank - 1] : arg1_shape[arg1_rank - 2];
 
-    for (size_t i = 0; i < I_dim; ++i) {
-        for (size_t k = 0; k < K_dim; ++k) {
-            const size_t a_idx = i * K_dim + k;
-            for (size_t j = 0; j < J_dim; ++j) {
-                const size_t b_idx = k * J_dim + j;
-                const size_t out_idx = i * J_dim + j;
-                out[out_idx] += arg0[a_idx] * arg1[b_idx];
+    // the output rows are computed by the threads independently
+    parallel_chunks(I_dim, min_parallel_chunk / std::max<size_t>(K_dim * J_dim, 1), [&](size_t begin, size_t end) {
+        std::fill(out + begin * J_dim, out + end * J_dim, T{0});
+        for (size_t i = begin; i < end; ++i) {
+            for (size_t k = 0; k < K_dim; ++k) {
+                const size_t a_idx = i * K_dim + k;
+                for (size_t j = 0; j < J_dim; ++j) {
+                    const size_t b_idx = k * J_dim + j;
+                    const size_t out_idx = i * J_dim + j;
+                    out[out_idx] += arg0[a_idx] * arg1[b_idx];
+                }
             }
         }
-    }
+    });
 }
 
 std::vector<size_t> get_transpose_order(const Shape& input_shape);
@@ -207,14 +211,18 @@ void matmul(const T* arg0,
     const size_t arg0_offset = (arg0_rank > 2) ? shape_size(dot_arg0_shape) : 0;
     const size_t arg1_offset = (arg1_rank > 2) ? shape_size(dot_arg1_shape) : 0;
     const size_t output_offset = shape_size(dot_output_shape);
-    for (size_t i = 0; i < output_batch_size; i++) {
-        details::dot(arg0_data + i * arg0_offset,
-                     arg1_data + i * arg1_offset,
-                     out + i * output_offset,
-                     dot_arg0_shape,
-                     dot_arg1_shape,
-                     dot_output_shape);
-    }
+    // the batches of the small matrices are split between the threads, the large ones are split by rows in dot()
+    const size_t dot_size = std::max<size_t>(output_offset * dot_arg0_shape.back(), 1);
+    parallel_chunks(output_batch_size, min_parallel_chunk / dot_size, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; i++) {
+            details::dot(arg0_data + i * arg0_offset,
+                         arg1_data + i * arg1_offset,
+                         out + i * output_offset,
+                         dot_arg0_shape,
+                         dot_arg1_shape,
+                         dot_output_shape);
+        }
+    });
 }
 }  // namespace reference
 }  // namespace ov
@@ -0,0 +1,36 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+
+#include "openvino/core/parallel.hpp"
+
+namespace ov {
+namespace reference {
+/// \brief The smallest number of the elements processed by a thread of the element-wise kernels, below it the
+/// threading overhead exceeds the gain
+constexpr size_t min_parallel_chunk = 32 * 1024;
+
+/// \brief Splits the [0, count) range into the contiguous chunks of at least min_chunk elements and runs
+/// func(begin, end) for them in parallel. The ranges of less than 2 chunks run on the calling thread.
+template <typename F>
+void parallel_chunks(size_t count, size_t min_chunk, const F& func) {
+    const auto nthr = static_cast<int>(
+        std::min(static_cast<size_t>(parallel_get_max_threads()), count / std::max(min_chunk, size_t{1})));
+    if (nthr <= 1) {
+        func(size_t{0}, count);
+        return;
+    }
+    parallel_nt(nthr, [&](const int ithr, const int team) {
+        size_t begin = 0, end = 0;
+        splitter(count, static_cast<size_t>(team), static_cast<size_t>(ithr), begin, end);
+        if (begin < end)
+            func(begin, end);
+    });
+}
+}  // namespace reference
+}  // namespace ov
@@ -229,8 +229,10 @@ void convert_impl(const TI* arg, TO* out, size_t count) {
     auto converter = jit_convert_array::get<TI, TO, clamp>();
 
     if (converter) {
-        jit_convert_array::args_t args = {arg, out, count};
-        converter(&args);
+        parallel_chunks(count, min_parallel_chunk, [&](size_t begin, size_t end) {
+            jit_convert_array::args_t args = {arg + begin, out + begin, end - begin};
+            converter(&args);
+        });
     } else {
         for (size_t i = 0; i < count; ++i) {
             out[i] = static_cast<TO>(arg[i]);
@@ -243,8 +245,10 @@ void convert_impl<float, float16, true>(const float* arg, float16* out, size_t c
     auto converter = jit_convert_array::get<float, float16, true>();
 
     if (converter) {
-        jit_convert_array::args_t args = {arg, out, count};
-        converter(&args);
+        parallel_chunks(count, min_parallel_chunk, [&](size_t begin, size_t end) {
+            jit_convert_array::args_t args = {arg + begin, out + begin, end - begin};
+            converter(&args);
+        });
     } else {
         for (size_t i = 0; i < count; ++i) {
             if (arg[i] > std::numeric_limits<ov::float16>::max()) {
@@ -31,6 +31,8 @@ ov::descriptor::Input::~Input() {
 }
 
 void ov::descriptor::Input::replace_output(Output& new_output) {
+    // keep the old source alive until the cached order of nodes is repaired
+    auto old_source = m_src_node;
     if (m_output != nullptr) {
         m_output->remove_input(this);
     }
@@ -38,12 +40,12 @@ void ov::descriptor::Input::replace_output(Output& new_output) {
     m_output = &new_output;
     m_src_node = std::shared_ptr<ov::Node>(new_output.get_node());
 
-    // Output replacement may change the topological order of nodes,
-    // so we have to reset cache by setting a flag into shared node info.
+    // Output replacement may change the topological order of nodes, so the shared node info either repairs its
+    // cached order or resets it.
     for_each(m_node->m_shared_rt_info.cbegin(),
              m_node->m_shared_rt_info.cend(),
-             [](const std::shared_ptr<SharedRTInfo>& info) {
-                 info->set_use_topological_cache(false);
+             [&](const std::shared_ptr<SharedRTInfo>& info) {
+                 info->on_input_replaced(m_node, old_source.get(), m_src_node.get());
              });
 }
 
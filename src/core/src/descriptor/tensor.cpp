@@ -4,22 +4,44 @@
 
 #include "openvino/core/descriptor/tensor.hpp"
 
+#include "openvino/core/dimension_tracker.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/node.hpp"
 
+namespace {
+uint64_t new_version() {
+    static std::atomic<uint64_t> next_version{0};
+    return ++next_version;
+}
+
+bool is_same_shape(const ov::PartialShape& lhs, const ov::PartialShape& rhs) {
+    if (lhs != rhs)
+        return false;
+    if (lhs.rank().is_dynamic())
+        return true;
+    for (size_t i = 0; i < lhs.size(); ++i) {
+        if (ov::DimensionTracker::get_label(lhs[i]) != ov::DimensionTracker::get_label(rhs[i]))
+            return false;
+    }
+    return true;
+}
+}  // namespace
+
 ov::descriptor::Tensor::Tensor(const element::Type& element_type,
                                const PartialShape& pshape,
                                const std::unordered_set<std::string>& names)
     : m_element_type(element_type),
       m_partial_shape(pshape),
-      m_shape_changed(true) {
+      m_shape_changed(true),
+      m_version(new_version()) {
     set_names(names);
 }
 
 ov::descriptor::Tensor::Tensor(const element::Type& element_type, const PartialShape& pshape, const std::string& name)
     : m_element_type(element_type),
       m_partial_shape(pshape),
-      m_shape_changed(true) {
+      m_shape_changed(true),
+      m_version(new_version()) {
     m_name_it = m_names.cend();
 }
 
@@ -29,18 +51,23 @@ ov::descriptor::Tensor::Tensor(const element::Type& element_type,
                                size_t node_output_number)
     : m_element_type(element_type),
       m_partial_shape(pshape),
-      m_shape_changed(true) {
+      m_shape_changed(true),
+      m_version(new_version()) {
     m_name_it = m_names.cend();
 }
 
 OPENVINO_SUPPRESS_DEPRECATED_START
 void ov::descriptor::Tensor::set_tensor_type(const element::Type& element_type, const PartialShape& pshape) {
     set_element_type(element_type);
+    if (!is_same_shape(m_partial_shape, pshape))
+        m_version = new_version();
     m_partial_shape = pshape;
     m_shape_changed = true;
 }
 
 void ov::descriptor::Tensor::set_element_type(const element::Type& element_type) {
+    if (m_element_type != element_type)
+        m_version = new_version();
     m_element_type = element_type;
 }
 OPENVINO_SUPPRESS_DEPRECATED_END
@@ -140,6 +167,7 @@ void ov::descriptor::Tensor::clone_from(const ov::descriptor::Tensor& old) {
     m_legacy_name = old.m_legacy_name;
     m_rt_info = old.get_rt_info();
     m_shape_changed = true;
+    m_version = new_version();
 }
 
 std::string ov::descriptor::get_ov_tensor_legacy_name(const ov::descriptor::Tensor& tensor) {
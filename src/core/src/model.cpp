@@ -7,6 +7,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 
 #include "itt.hpp"
 #include "layout_utils.hpp"
@@ -16,6 +17,7 @@
 #include "openvino/core/meta_data.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/variable_context.hpp"
 #include "openvino/op/util/variable_extension.hpp"
@@ -217,6 +219,14 @@ void ov::Model::prerequirements(bool detect_variables, bool detect_parameters) {
         check_all_variables_registered(ordered_ops, m_variables);
 }
 
+void ov::Model::set_incremental_validation(bool enable) {
+    m_incremental_validation = enable;
+}
+
+bool ov::Model::get_incremental_validation() const {
+    return m_incremental_validation;
+}
+
 void ov::Model::validate_nodes_and_infer_types() const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::core, "Model::validate_nodes_and_infer_types");
 
@@ -229,8 +239,36 @@ void ov::Model::validate_nodes_and_infer_types() const {
     std::stringstream unregistered_variables;
     std::unordered_set<const ov::descriptor::Tensor*> tensors;
 
+    std::vector<uint64_t> input_versions;
+    // The revalidated nodes with inputs: their output values may change while the types and the shapes stay the same
+    // (ShapeOf of the reshaped input), and the consumers inferring the shapes from those values must be revalidated
+    std::unordered_set<const Node*> revalidated;
     for (auto& node : get_ordered_ops()) {
-        node->revalidate_and_infer_types();
+        if (m_incremental_validation) {
+            input_versions.clear();
+            bool producer_revalidated = false;
+            for (const auto& input : node->inputs()) {
+                input_versions.push_back(input.get_tensor().get_version());
+                producer_revalidated = producer_revalidated || revalidated.count(input.get_source_output().get_node());
+            }
+            // the outputs of the nodes below depend on their attributes, bodies or variables rather than inputs
+            const bool always_revalidate = input_versions.empty() ||
+                                           ov::is_type<op::util::MultiSubGraphOp>(node) ||
+                                           dynamic_cast<op::util::VariableExtension*>(node.get());
+            if (always_revalidate || producer_revalidated || node->m_validated_input_versions != input_versions) {
+                node->m_validated_input_versions.clear();
+                // the values cached in the outputs were evaluated from the previous inputs
+                if (!input_versions.empty())
+                    node->invalidate_values();
+                node->revalidate_and_infer_types();
+                node->m_validated_input_versions = input_versions;
+                if (!input_versions.empty())
+                    revalidated.insert(node.get());
+            }
+        } else {
+            node->m_validated_input_versions.clear();
+            node->revalidate_and_infer_types();
+        }
         for (const auto& output : node->outputs()) {
             const auto& tensor = output.get_tensor();
             // Skip results outputs tensors because result_input_tensor == result_output_tensor
@@ -285,8 +323,10 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
 
     NodeVector nodes;
     if (m_shared_rt_info->get_use_topological_cache()) {
+        // the cached order is repaired on the graph modifications, the nodes removed from the model are skipped
         for (const auto& node : m_cached_ordered_ops) {
-            if (auto locked_node = node.lock()) {
+            auto locked_node = node.lock();
+            if (locked_node && m_shared_rt_info->is_in_topological_order(locked_node.get())) {
                 nodes.emplace_back(locked_node);
             }
         }
@@ -310,9 +350,9 @@ std::vector<shared_ptr<ov::Node>> ov::Model::get_ordered_ops() const {
     m_cached_ordered_ops.clear();
     for_each(order.cbegin(), order.cend(), [this](const shared_ptr<Node>& node) {
         m_cached_ordered_ops.push_back(node);
-        m_cached_ops.insert(node.get());
         node->insert_info(m_shared_rt_info);
     });
+    m_shared_rt_info->set_topological_order(order);
     m_cached_output_names.clear();
     m_cached_op_names.clear();
     m_shared_rt_info->set_use_topological_cache(true);
@@ -929,7 +969,7 @@ ov::Output<ov::Node> ov::Model::add_output(const std::string& op_name, size_t ou
 
 ov::Output<ov::Node> ov::Model::add_output(const ov::Output<ov::Node>& port) {
     auto cache_valid = [&]() {
-        return m_cached_ops.count(port.get_node());
+        return m_shared_rt_info->is_in_topological_order(port.get_node());
     };
     if (ov::op::util::is_output(port.get_node()))
         return port;
@@ -945,7 +985,7 @@ ov::Output<ov::Node> ov::Model::add_output(const ov::Output<ov::Node>& port) {
         if (cache_valid()) {
             // Full update of topological cache is not needed, 'result' can be just inserted to the end
             m_cached_ordered_ops.push_back(result);
-            m_cached_ops.insert(result.get());
+            m_shared_rt_info->append_to_topological_order(result.get());
             result->insert_info(m_shared_rt_info);  // Just for consistency, not required for Result nodes
         } else {
             m_shared_rt_info->set_use_topological_cache(false);
@@ -98,10 +98,19 @@ ov::Node::Node(const OutputVector& arguments, size_t output_size) : Node() {
 
 ov::Node::~Node() {
     try {
-        // raise a flag to reset nodes cache
-        for_each(m_shared_rt_info.cbegin(), m_shared_rt_info.cend(), [](const std::shared_ptr<SharedRTInfo>& info) {
-            info->set_use_topological_cache(false);
-        });
+        // the destroyed node has no consumers, so it only leaves the cached order of nodes
+        if (!m_shared_rt_info.empty()) {
+            std::vector<Node*> sources;
+            for (descriptor::Input& input : m_inputs) {
+                if (input.has_output())
+                    sources.push_back(input.get_output().get_node().get());
+            }
+            for_each(m_shared_rt_info.cbegin(),
+                     m_shared_rt_info.cend(),
+                     [this, &sources](const std::shared_ptr<SharedRTInfo>& info) {
+                         info->on_node_destroyed(this, sources);
+                     });
+        }
 
         for (descriptor::Input& input : m_inputs) {
             if (input.has_output()) {
@@ -237,6 +237,25 @@ ov::op::v0::Constant::Constant(const Constant& other, const ov::Shape& new_shape
     constructor_validate_and_infer_types();
 }
 
+ov::op::v0::Constant::Constant(const Constant& other, const ov::Shape& new_shape, size_t byte_offset) {
+    m_element_type = other.m_element_type;
+    m_shape = new_shape;
+    const auto byte_size = mem_size();
+    OPENVINO_ASSERT(byte_offset + byte_size <= other.get_byte_size(),
+                    "The view of ",
+                    byte_size,
+                    " bytes at the offset ",
+                    byte_offset,
+                    " is out of the constant data of ",
+                    other.get_byte_size(),
+                    " bytes");
+    m_data = make_shared<ngraph::runtime::SharedBuffer<shared_ptr<ngraph::runtime::AlignedBuffer>>>(
+        static_cast<char*>(other.m_data->get_ptr()) + byte_offset,
+        byte_size,
+        other.m_data);
+    constructor_validate_and_infer_types();
+}
+
 ov::op::v0::Constant::~Constant() = default;
 
 string ov::op::v0::Constant::convert_value_to_string(size_t index) const {
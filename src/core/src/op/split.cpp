@@ -16,6 +16,7 @@
 #include "ngraph/op/util/op_types.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/validation_util.hpp"
+#include "validation_util.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -127,3 +128,15 @@ bool op::v1::Split::evaluate_label(TensorLabelVector& output_labels) const {
     return input(1).get_tensor().has_and_set_bound() && default_label_evaluator(this, output_labels);
     OPENVINO_SUPPRESS_DEPRECATED_END
 }
+
+bool op::v1::Split::constant_fold(OutputVector& output_values, const OutputVector& inputs_values) {
+    OV_OP_SCOPE(v1_Split_constant_fold);
+    // the splits of the contiguous ranges are folded into the views of the data, so the weights are not copied
+    const auto data = ov::as_type_ptr<op::v0::Constant>(inputs_values[0].get_node_shared_ptr());
+    const auto axis = ov::as_type_ptr<op::v0::Constant>(inputs_values[1].get_node_shared_ptr());
+    if (data && axis && !is_const_fold_disabled() &&
+        ov::util::fold_split_to_views(this, *data, axis->cast_vector<int64_t>()[0], output_values)) {
+        return true;
+    }
+    return Node::constant_fold(output_values, inputs_values);
+}
@@ -5,6 +5,7 @@
 #include "openvino/pass/constant_folding.hpp"
 
 #include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/constant.hpp"
@@ -48,42 +49,69 @@ const auto friendly_name_from = [](const ov::Node& node, const size_t output_cou
     }
 };
 
+/**
+ * \brief Get the size of the output data in bytes.
+ *
+ * \param output  Output to check.
+ *
+ * \return size in bytes or 0 if the shape of the output is dynamic.
+ */
+const auto byte_size_of = [](const ov::Output<const ov::Node>& output) -> size_t {
+    if (output.get_partial_shape().is_dynamic())
+        return 0;
+    return (ov::shape_size(output.get_shape()) * output.get_element_type().bitwidth() + 7) / 8;
+};
+
+/**
+ * \brief Check if folding of the node would create a constant much larger than its inputs, e.g. a broadcast of a
+ * scalar. Such a constant takes the memory of the model for almost no computation saved, so it is not folded.
+ *
+ * \param node  Node to check.
+ *
+ * \return true if the folded outputs are too large otherwise false.
+ */
+const auto is_folded_size_too_large = [](const ov::Node* node) {
+    constexpr size_t max_size_ratio = 16;
+    constexpr size_t min_limited_size = 16 * 1024 * 1024;
+
+    size_t input_size = 0;
+    for (const auto& input : node->inputs()) {
+        if (input.get_partial_shape().is_dynamic())
+            return false;
+        input_size += byte_size_of(input.get_source_output());
+    }
+    size_t output_size = 0;
+    for (const auto& output : node->outputs()) {
+        if (output.get_partial_shape().is_dynamic())
+            return false;
+        output_size += byte_size_of(output);
+    }
+    return output_size > min_limited_size && output_size > input_size * max_size_ratio;
+};
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& node : model->get_ordered_ops()) {
+    std::unordered_set<const Node*> not_folded;
+    rewritten |= fold_independent_nodes(model, rewritten, not_folded);
+
+    auto ordered_ops = model->get_ordered_ops();
+    for (auto& ordered_op : ordered_ops) {
+        // the folded node is released as soon as it is replaced, so are its inputs not used by other nodes
+        const auto node = std::move(ordered_op);
+        if (not_folded.count(node.get()))
+            continue;
+
         if (rewritten) {
             node->validate_and_infer_types();
         }
 
         OutputVector replacements(node->get_output_size());
 
-        if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = node->output(i);
-                auto replacement = replacements.at(i);
-                if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
-                    replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(node, replacement.get_node_shared_ptr());
-
-                    rewritten = true;
-                }
-            }
+        if (!is_folded_size_too_large(node.get()) && node->constant_fold(replacements, node->input_values())) {
+            rewritten |= replace_with_folded(node, replacements);
         } else {
             // recursively constant fold operators containing subgraphs (ie: TensorIterator, Loop)
             if (auto sub_graph_node = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(node)) {
@@ -98,6 +126,105 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     return rewritten;
 }
 
+bool ov::pass::ConstantFolding::fold_independent_nodes(const std::shared_ptr<ov::Model>& model,
+                                                      bool validate,
+                                                      std::unordered_set<const Node*>& not_folded) {
+    const auto is_independent = [&not_folded](const Node* node) {
+        if (!node->get_input_size() || not_folded.count(node) || op::util::is_output(node) ||
+            op::util::is_sink(node) || ov::is_type<op::util::ReadValueBase>(node) ||
+            ov::is_type<op::util::MultiSubGraphOp>(node))
+            return false;
+        const auto& input_values = node->input_values();
+        return std::all_of(input_values.cbegin(), input_values.cend(), [](const Output<Node>& input) {
+            return ov::is_type<op::v0::Constant>(input.get_node());
+        });
+    };
+
+    std::vector<std::shared_ptr<Node>> wave;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (is_independent(node.get()))
+            wave.push_back(node);
+    }
+
+    bool rewritten = false;
+    while (!wave.empty()) {
+        if (validate || rewritten) {
+            for (const auto& node : wave)
+                node->validate_and_infer_types();
+        }
+        std::vector<OutputVector> replacements(wave.size());
+        std::vector<char> folded(wave.size(), 0);
+        // the exceptions are passed to the caller as they are, whatever the threading backend
+        std::vector<std::exception_ptr> exceptions(wave.size());
+        ov::parallel_for(wave.size(), [&](size_t i) {
+            const auto& node = wave[i];
+            if (is_folded_size_too_large(node.get()))
+                return;
+            try {
+                replacements[i].resize(node->get_output_size());
+                folded[i] = node->constant_fold(replacements[i], node->input_values());
+            } catch (...) {
+                exceptions[i] = std::current_exception();
+            }
+        });
+        for (const auto& exception : exceptions) {
+            if (exception)
+                std::rethrow_exception(exception);
+        }
+
+        // the consumers of the folded nodes make the next wave
+        std::vector<std::shared_ptr<Node>> next_wave;
+        std::unordered_set<const Node*> next_wave_nodes;
+        for (size_t i = 0; i < wave.size(); ++i) {
+            if (!folded[i]) {
+                not_folded.insert(wave[i].get());
+                continue;
+            }
+            rewritten |= replace_with_folded(wave[i], replacements[i]);
+            for (const auto& replacement : replacements[i]) {
+                if (!replacement.get_node())
+                    continue;
+                for (const auto& target : replacement.get_target_inputs()) {
+                    const auto consumer = target.get_node();
+                    if (is_independent(consumer) && next_wave_nodes.insert(consumer).second)
+                        next_wave.push_back(consumer->shared_from_this());
+                }
+            }
+        }
+        wave = std::move(next_wave);
+    }
+    return rewritten;
+}
+
+bool ov::pass::ConstantFolding::replace_with_folded(const std::shared_ptr<Node>& node,
+                                                   const OutputVector& replacements) {
+    OPENVINO_ASSERT(!constant_folding_is_disabled(node),
+                    "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                    node);
+    OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                    "constant_fold_default returned incorrect number of replacements for ",
+                    node);
+
+    bool rewritten = false;
+    for (size_t i = 0; i < replacements.size(); ++i) {
+        auto node_output = node->output(i);
+        auto replacement = replacements.at(i);
+        if (replacement.get_node_shared_ptr() && (node_output != replacement)) {
+            replacement.get_node()->set_friendly_name(friendly_name_from(*node, replacements.size(), i));
+
+            node_output.replace(replacement);
+            // Copy runtime info from source nodes
+            // when it was not propogated during pre-calculation
+            copy_runtime_info_from_input_values(node);
+            // Propagate runtime info attributes to replacement
+            copy_runtime_info(node, replacement.get_node_shared_ptr());
+
+            rewritten = true;
+        }
+    }
+    return rewritten;
+}
+
 void ov::pass::ConstantFolding::copy_runtime_info_from_input_values(const std::shared_ptr<Node>& node) {
     if (is_type<op::util::ShapeOfBase>(node)) {
         // Don't propogate names of ShapeOf source node since it is not fused itself
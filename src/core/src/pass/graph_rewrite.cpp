@@ -5,8 +5,10 @@
 #include "openvino/pass/graph_rewrite.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <deque>
 #include <iostream>
+#include <limits>
 #include <regex>
 #include <string>
 #include <unordered_set>
@@ -14,6 +16,7 @@
 
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/op/util/multi_subgraph_base.hpp"
+#include "openvino/pass/pass_profile.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/log.hpp"
 #include "perf_counters.hpp"
@@ -92,9 +95,11 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
     bool rewritten = false;
     const auto& pass_config = get_pass_config();
 
-    // Check that all Matchers in MatcherPasses has type bases root node
-    bool all_roots_has_type = true;
+    // Index the MatcherPasses by the type of the pattern root. The matchers whose root type is unknown (e.g. any
+    // input or a predicate pattern) are generic and run for every node, so a single such matcher does not force all
+    // the others to be tried on every node.
     std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matcher;
+    std::vector<size_t> generic_matchers;
     for (size_t matcher_index = 0; matcher_index < m_matchers.size(); ++matcher_index) {
         // Skip passes that are disabled
         if (pass_config->is_disabled(m_matchers[matcher_index]->get_type_info()))
@@ -102,8 +107,8 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         auto matcher = m_matchers[matcher_index]->get_matcher();
         if (!matcher) {
-            all_roots_has_type = false;
-            break;
+            generic_matchers.push_back(matcher_index);
+            continue;
         }
 
         auto root = matcher->get_pattern_value().get_node_shared_ptr();
@@ -114,30 +119,69 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         }
 
         // if root is an operation from opset or has pattern::op::WrapType type then we can extract
-        // it's type
-        // and use it in unordered_map as key for fast MatcherPass search. Otherwise type is unknown
-        // and default algorithm is used.
+        // it's type and use it in unordered_map as key for fast MatcherPass search.
         if (auto p = std::dynamic_pointer_cast<pattern::op::Pattern>(root)) {
             if (auto any_type = std::dynamic_pointer_cast<ov::pass::pattern::op::WrapType>(p)) {
                 for (const auto& root_type_info : any_type->get_wrapped_types()) {
                     type_to_matcher[root_type_info].push_back(matcher_index);
                 }
             } else {
-                all_roots_has_type = false;
-                break;
+                generic_matchers.push_back(matcher_index);
             }
         } else {
             type_to_matcher[root->get_type_info()].push_back(matcher_index);
         }
-
-        // TODO: traverse parents for root_type_info in order to register complete list of matchers
-        // including ones triggered by parent type info.
     }
 
+    // Matchers to run for a node type, including the ones registered for its parent types and the generic ones, in
+    // the order of the registration. Filled on the first node of each type.
+    std::unordered_map<NodeTypeInfo, std::vector<size_t>> type_to_matchers_to_run;
+    auto get_matchers_to_run = [&](const DiscreteTypeInfo& type_info) -> const std::vector<size_t>& {
+        auto it = type_to_matchers_to_run.find(type_info);
+        if (it != type_to_matchers_to_run.end())
+            return it->second;
+        std::vector<size_t> matcher_passes_to_run = generic_matchers;
+        for (auto node_type_info = &type_info; node_type_info; node_type_info = node_type_info->parent) {
+            auto matchers = type_to_matcher.find(*node_type_info);
+            if (matchers != type_to_matcher.end()) {
+                matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                             matchers->second.begin(),
+                                             matchers->second.end());
+            }
+        }
+        std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+        matcher_passes_to_run.erase(std::unique(matcher_passes_to_run.begin(), matcher_passes_to_run.end()),
+                                    matcher_passes_to_run.end());
+        return type_to_matchers_to_run.emplace(type_info, std::move(matcher_passes_to_run)).first->second;
+    };
+
+    // The MatcherPasses are profiled as the children of the GraphRewrite profile, the index of the child of each
+    // MatcherPass is found on its first run
+    const auto profile = PassProfiler::get_current();
+    std::vector<size_t> matcher_profiles(profile ? m_matchers.size() : 0, std::numeric_limits<size_t>::max());
+    auto get_matcher_profile = [&](size_t matcher_index) -> PassProfile& {
+        auto& child_index = matcher_profiles[matcher_index];
+        if (child_index == std::numeric_limits<size_t>::max()) {
+            const auto& name = m_matchers[matcher_index]->get_name();
+            auto& children = profile->children;
+            auto it = std::find_if(children.begin(), children.end(), [&](const PassProfile& child) {
+                return child.name == name;
+            });
+            if (it == children.end()) {
+                children.emplace_back();
+                children.back().name = name;
+                it = std::prev(children.end());
+            }
+            child_index = it - children.begin();
+        }
+        return profile->children[child_index];
+    };
+
     // This lambda preforms execution of particular MatcherPass on given node.
     // It automatically handles nodes registered by MatcherPass during transformation and set
     // transformation callback.
-    auto run_matcher_pass = [&](std::shared_ptr<MatcherPass> m_pass, std::shared_ptr<Node> node) -> bool {
+    auto run_matcher_pass = [&](size_t matcher_index, std::shared_ptr<Node> node) -> bool {
+        const auto& m_pass = m_matchers[matcher_index];
         // Keep this property check for backward compatibility. In future transformation property
         // will be deprecated and removed.
         if (m_pass->get_property(PassProperty::REQUIRE_STATIC_SHAPE) && f->is_dynamic()) {
@@ -150,7 +194,21 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
 
         // Apply MatcherPass. In case if it returns true no other MatcherPasses will apply
         // to this node
-        bool status = m_pass->apply(node);
+        bool status = false;
+        if (profile) {
+            auto& matcher_profile = get_matcher_profile(matcher_index);
+            const auto start = std::chrono::steady_clock::now();
+            {
+                PassProfileScope profile_scope(&matcher_profile);
+                status = m_pass->apply(node);
+            }
+            matcher_profile.duration +=
+                std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+            ++matcher_profile.runs;
+            matcher_profile.applied += status ? 1 : 0;
+        } else {
+            status = m_pass->apply(node);
+        }
 
         // In case if MatcherPass registered nodes they will be added to the beginning of execution
         // queue
@@ -166,9 +224,6 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
-
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
         nodes_to_run.pop_front();
@@ -191,47 +246,11 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         if (m_enable_shape_inference) {
             node->revalidate_and_infer_types();
         }
-        // If all Matchers in MatcherPasses has type based root node then we apply efficient
-        // algorithm for finding matchers
-        if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
-                }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
-
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
-
-            for (size_t matcher_index : matcher_passes_to_run) {
-                if (run_matcher_pass(m_matchers[matcher_index], node)) {
-                    rewritten = true;
-                    break;
-                }
-            }
-        }
-        // Otherwise we use default algorithm that iterates over all registered matcher passes
-        else {
-            for (auto& m_pass : m_matchers) {
-                // Skip passes that are disabled
-                if (pass_config->is_disabled(m_pass->get_type_info()))
-                    continue;
-
-                if (run_matcher_pass(m_pass, node)) {
-                    rewritten = true;
-                    break;
-                }
+        // Apply the matchers registered for the node type until one of them rewrites the node
+        for (size_t matcher_index : get_matchers_to_run(node->get_type_info())) {
+            if (run_matcher_pass(matcher_index, node)) {
+                rewritten = true;
+                break;
             }
         }
     }
@@ -15,6 +15,7 @@
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/util.hpp"
 #include "openvino/pass/graph_rewrite.hpp"
+#include "openvino/pass/pass_profile.hpp"
 #include "openvino/pass/visualize_tree.hpp"
 #include "openvino/util/env_util.hpp"
 #include "openvino/util/log.hpp"
@@ -70,12 +71,23 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
     bool pass_applied = false;
     bool function_changed = false;
     bool needs_validate = false;
+    // the profiles of the passes are added to the one of the enclosing pass, nullptr if there is no PassProfiler
+    const auto parent_profile = PassProfiler::get_current();
     for (auto& pass : m_pass_list) {
         if (m_pass_config->is_disabled(pass->get_type_info())) {
             OPENVINO_DEBUG << "Pass " << pass->get_name() << " is disabled";
             continue;
         }
 
+        PassProfile* pass_profile = nullptr;
+        if (parent_profile) {
+            parent_profile->children.emplace_back();
+            pass_profile = &parent_profile->children.back();
+            pass_profile->name = pass->get_name();
+            pass_profile->nodes_before = func->get_ops().size();
+        }
+        PassProfileScope profile_scope(pass_profile);
+
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::ov_pass, ov::pass::perf_counters()[pass->get_type_info()]);
 
         pass_timer.start();
@@ -134,6 +146,12 @@ bool ov::pass::Manager::run_passes(shared_ptr<ov::Model> func) {
         }
         index++;
         pass_timer.stop();
+        if (pass_profile) {
+            pass_profile->duration = pass_timer.get_timer_value();
+            pass_profile->nodes_after = func->get_ops().size();
+            pass_profile->runs = 1;
+            pass_profile->applied = pass_applied ? 1 : 0;
+        }
         if (profile_enabled) {
             cout << setw(7) << pass_timer.get_milliseconds() << "ms " << pass->get_name() << "\n";
         }
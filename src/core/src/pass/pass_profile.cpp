@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/pass/pass_profile.hpp"
+
+#include <sstream>
+
+namespace {
+thread_local ov::pass::PassProfile* current_profile = nullptr;
+
+void write_json(std::ostream& out, const std::vector<ov::pass::PassProfile>& profiles) {
+    out << "[";
+    for (size_t i = 0; i < profiles.size(); ++i) {
+        const auto& profile = profiles[i];
+        if (i)
+            out << ",";
+        out << "{\"name\":\"";
+        for (auto c : profile.name) {
+            if (c == '"' || c == '\\')
+                out << '\\';
+            out << c;
+        }
+        out << "\",\"duration_ns\":" << profile.duration.count() << ",\"nodes_before\":" << profile.nodes_before
+            << ",\"nodes_after\":" << profile.nodes_after << ",\"runs\":" << profile.runs
+            << ",\"applied\":" << profile.applied << ",\"children\":";
+        write_json(out, profile.children);
+        out << "}";
+    }
+    out << "]";
+}
+}  // namespace
+
+ov::pass::PassProfiler::PassProfiler() : m_previous(set_current(&m_profile)) {}
+
+ov::pass::PassProfiler::~PassProfiler() {
+    set_current(m_previous);
+}
+
+std::string ov::pass::PassProfiler::to_json() const {
+    std::stringstream out;
+    write_json(out, m_profile.children);
+    return out.str();
+}
+
+ov::pass::PassProfile* ov::pass::PassProfiler::get_current() {
+    return current_profile;
+}
+
+ov::pass::PassProfile* ov::pass::PassProfiler::set_current(PassProfile* profile) {
+    auto previous = current_profile;
+    current_profile = profile;
+    return previous;
+}
+
+ov::pass::PassProfileScope::PassProfileScope(PassProfile* profile) : m_previous(PassProfiler::set_current(profile)) {}
+
+ov::pass::PassProfileScope::~PassProfileScope() {
+    PassProfiler::set_current(m_previous);
+}
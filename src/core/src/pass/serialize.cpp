@@ -4,6 +4,7 @@
 
 #include "openvino/pass/serialize.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <cstdint>
@@ -11,11 +12,14 @@
 #include <openvino/cc/pass/itt.hpp>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+#include "openvino/core/binary_xml.hpp"
 #include "openvino/core/coordinate_diff.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/meta_data.hpp"
 #include "openvino/core/model.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
 #include "openvino/op/util/framework_node.hpp"
 #include "openvino/opsets/opset1.hpp"
@@ -81,15 +85,31 @@ size_t hash_combine(const void* v, int64_t size) {
     return seed;
 }
 
+// The chunks are hashed in parallel and their hashes are combined in order, so the result does not depend on the
+// number of threads
+size_t parallel_hash_combine(const char* ptr, size_t size) {
+    constexpr size_t chunk_size = 1 << 20;
+    if (size <= chunk_size)
+        return hash_combine(ptr, size);
+    const size_t chunks_num = (size + chunk_size - 1) / chunk_size;
+    std::vector<size_t> hashes(chunks_num);
+    ov::parallel_for(chunks_num, [&](size_t i) {
+        const size_t offset = i * chunk_size;
+        hashes[i] = hash_combine(ptr + offset, std::min(chunk_size, size - offset));
+    });
+    return hash_combine(hashes.data(), hashes.size() * sizeof(size_t));
+}
+
 class ConstantWriter {
 public:
     using FilePosition = int64_t;
     using HashValue = size_t;
     using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, bool hash_only = false)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
+          m_hash_only(hash_only),
           m_blob_offset(bin_data.tellp()) {}
 
     FilePosition write(const char* ptr,
@@ -101,6 +121,16 @@ public:
         const auto offset = write_pos - m_blob_offset;
         *new_size = size;
 
+        if (m_hash_only) {
+            // Only the hash of the data goes to the output, which saves streaming the whole weights into the
+            // hash calculation
+            if (compress_to_fp16)
+                *new_size = size / src_type.size() * ov::element::f16.size();
+            const HashValue hash = parallel_hash_combine(ptr, size);
+            m_binary_output.write(reinterpret_cast<const char*>(&hash), sizeof(hash));
+            return offset;
+        }
+
         if (!m_enable_compression || compress_to_fp16) {
             write_with_optional_fp16_compression(ptr, size, new_size, compress_to_fp16, src_type);
             return offset;
@@ -186,6 +216,7 @@ private:
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    bool m_hash_only;
     FilePosition m_blob_offset;  // blob offset inside output stream
 };
 
@@ -1154,7 +1185,9 @@ void serializeFunc(std::ostream& xml_file,
                    std::shared_ptr<ov::Model> model,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   ov::pass::Serialize::Format format = ov::pass::Serialize::Format::XML,
+                   bool deterministic = false,
+                   bool hash_weights = false) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = model->get_rt_info();
@@ -1175,11 +1208,15 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    ConstantWriter constant_write_handler(bin_file, true, hash_weights);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, model);
 
-    xml_doc.save(xml_file);
+    if (format == ov::pass::Serialize::Format::BINARY) {
+        ov::binary_xml::save(xml_doc, xml_file);
+    } else {
+        xml_doc.save(xml_file);
+    }
     xml_file.flush();
     bin_file.flush();
 };
@@ -1190,7 +1227,7 @@ namespace ov {
 bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_FUNCTION_SCOPE(Serialize);
     if (m_xmlFile && m_binFile) {
-        serializeFunc(*m_xmlFile, *m_binFile, model, m_version, m_custom_opsets);
+        serializeFunc(*m_xmlFile, *m_binFile, model, m_version, m_custom_opsets, m_format);
     } else {
         auto xmlDir = ov::util::get_directory(m_xmlPath);
         if (xmlDir != m_xmlPath)
@@ -1200,11 +1237,12 @@ bool pass::Serialize::run_on_model(const std::shared_ptr<ov::Model>& model) {
         OPENVINO_ASSERT(bin_file, "Can't open bin file: \"" + m_binPath + "\"");
 
         // create xml file
-        std::ofstream xml_file(m_xmlPath, std::ios::out);
+        const auto xml_mode = m_format == Format::BINARY ? std::ios::out | std::ios::binary : std::ios::out;
+        std::ofstream xml_file(m_xmlPath, xml_mode);
         OPENVINO_ASSERT(xml_file, "Can't open xml file: \"" + m_xmlPath + "\"");
 
         try {
-            serializeFunc(xml_file, bin_file, model, m_version, m_custom_opsets);
+            serializeFunc(xml_file, bin_file, model, m_version, m_custom_opsets, m_format);
         } catch (const ov::AssertFailure&) {
             // optimization decision was made to create .bin file upfront and
             // write to it directly instead of buffering its content in memory,
@@ -1321,7 +1359,11 @@ bool pass::StreamSerialize::run_on_model(const std::shared_ptr<ov::Model>& model
 
     // IR
     hdr.model_offset = m_stream.tellp();
-    xml_doc.save(m_stream);
+    if (m_format == Serialize::Format::BINARY) {
+        ov::binary_xml::save(xml_doc, m_stream);
+    } else {
+        xml_doc.save(m_stream);
+    }
     m_stream.flush();
 
     const size_t file_size = m_stream.tellp();
@@ -1382,7 +1424,7 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
     std::ostream bin(&binHash);
 
     // Determinism is important for hash calculation
-    serializeFunc(xml, bin, model, Serialize::Version::UNSPECIFIED, {}, true);
+    serializeFunc(xml, bin, model, Serialize::Version::UNSPECIFIED, {}, Serialize::Format::XML, true, true);
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
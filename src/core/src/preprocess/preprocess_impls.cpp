@@ -141,10 +141,18 @@ InputInfo::InputInfoImpl::InputInfoData InputInfo::InputInfoImpl::create_new_par
 
 PreStepsList InputInfo::InputInfoImpl::create_implicit_steps(const PreprocessingContext& context, element::Type type) {
     PreStepsList implicit_steps;
-    if (type != context.target_element_type()) {
+    const auto convert_type = type != context.target_element_type();
+    const auto convert_layout = !context.target_layout().empty() && context.target_layout() != context.layout();
+    // The layout is converted on the narrower element type, e.g. the u8 image is transposed before the conversion
+    // to f32, so the transposition moves less memory
+    const auto layout_first = convert_type && type.bitwidth() < context.target_element_type().bitwidth();
+    if (convert_layout && layout_first) {
+        implicit_steps.add_convert_layout_impl(context.target_layout());
+    }
+    if (convert_type) {
         implicit_steps.add_convert_impl(context.target_element_type());
     }
-    if (!context.target_layout().empty() && context.target_layout() != context.layout()) {
+    if (convert_layout && !layout_first) {
         implicit_steps.add_convert_layout_impl(context.target_layout());
     }
     return implicit_steps;
@@ -320,6 +328,26 @@ void InputInfo::InputInfoImpl::dump(std::ostream& str,
 }
 
 //----------- OutputInfoImpl ----------
+PostStepsList OutputInfo::OutputInfoImpl::create_implicit_steps(const PostprocessingContext& context,
+                                                              element::Type type) const {
+    PostStepsList implicit_steps;
+    const auto convert_type = type != get_tensor_data()->get_element_type() &&
+                              get_tensor_data()->is_element_type_set() && type != element::dynamic;
+    const auto convert_layout = !context.target_layout().empty() && context.target_layout() != context.layout();
+    // The same as for the inputs, the layout is converted on the narrower element type
+    const auto layout_first = convert_type && type.bitwidth() < get_tensor_data()->get_element_type().bitwidth();
+    if (convert_layout && layout_first) {
+        implicit_steps.add_convert_layout_impl(context.target_layout());
+    }
+    if (convert_type) {
+        implicit_steps.add_convert_impl(get_tensor_data()->get_element_type());
+    }
+    if (convert_layout && !layout_first) {
+        implicit_steps.add_convert_layout_impl(context.target_layout());
+    }
+    return implicit_steps;
+}
+
 void OutputInfo::OutputInfoImpl::build(ov::ResultVector& results) {
     std::shared_ptr<opset8::Result> result;
     auto node = m_output_node;
@@ -347,15 +375,7 @@ void OutputInfo::OutputInfoImpl::build(ov::ResultVector& results) {
         post_processing_applied = true;
     }
     // Implicit: Convert element type + layout to user's tensor implicitly
-    PostStepsList implicit_steps;
-    if (node.get_element_type() != get_tensor_data()->get_element_type() && get_tensor_data()->is_element_type_set() &&
-        node.get_element_type() != element::dynamic) {
-        implicit_steps.add_convert_impl(get_tensor_data()->get_element_type());
-    }
-
-    if (!context.target_layout().empty() && context.target_layout() != context.layout()) {
-        implicit_steps.add_convert_layout_impl(context.target_layout());
-    }
+    auto implicit_steps = create_implicit_steps(context, node.get_element_type());
     for (const auto& action : implicit_steps.actions()) {
         auto action_result = action.m_op({node}, context);
         node = std::get<0>(action_result);
@@ -460,15 +480,7 @@ void OutputInfo::OutputInfoImpl::dump(std::ostream& str) const {
         str << ")" << std::endl;
     }
     // Implicit: Convert element type + layout to user's tensor implicitly
-    PostStepsList implicit_steps;
-    if (node.get_element_type() != get_tensor_data()->get_element_type() && get_tensor_data()->is_element_type_set() &&
-        node.get_element_type() != element::dynamic) {
-        implicit_steps.add_convert_impl(get_tensor_data()->get_element_type());
-    }
-
-    if (!context.target_layout().empty() && context.target_layout() != context.layout()) {
-        implicit_steps.add_convert_layout_impl(context.target_layout());
-    }
+    auto implicit_steps = create_implicit_steps(context, node.get_element_type());
     if (!implicit_steps.actions().empty()) {
         str << "    Post-processing implicit steps (" << implicit_steps.actions().size() << "):" << std::endl;
     }
@@ -67,6 +67,8 @@ struct OutputInfo::OutputInfoImpl {
         return m_model_info.m_impl;
     }
 
+    PostStepsList create_implicit_steps(const PostprocessingContext& context, element::Type type) const;
+
     void build(ov::ResultVector& results);
 
     void dump(std::ostream& str) const;
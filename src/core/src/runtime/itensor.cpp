@@ -4,9 +4,11 @@
 
 #include "openvino/runtime/itensor.hpp"
 
+#include <algorithm>
 #include <memory>
 
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/runtime/allocator.hpp"
 #include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -76,7 +78,6 @@ void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
     auto* dst_data = static_cast<uint8_t*>(dst->data());
     ov::Strides src_strides{get_byte_size()};
     ov::Strides dst_strides{dst->get_byte_size()};
-    ov::Shape cur_pos{0};
     ov::Shape max_pos{1};
 
     if (get_element_type().bitwidth() < 8 || (get_strides() == dst->get_strides() && is_continuous()) ||
@@ -120,7 +121,6 @@ void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
                     src_str.resize(strides_size + 1);
                     dst_str.resize(strides_size + 1);
                     max_pos.resize(strides_size + 1);
-                    cur_pos.resize(strides_size + 1);
                     // In case of default continuous strides we can copy several elements
                     // In other case only one element
                     size_t dim = 1;
@@ -133,19 +133,17 @@ void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
                     src_str[strides_size] = strides;
                     dst_str[strides_size] = strides;
                     max_pos[strides_size] = dim;
-                    cur_pos[strides_size] = 0;
                 }
             }
             src_str[inverted_idx] = src_strides[inverted_idx];
             dst_str[inverted_idx] = dst_strides[inverted_idx];
             max_pos[inverted_idx] = shape[inverted_idx];
-            cur_pos[inverted_idx] = 0;
         }
         src_strides = src_str;
         dst_strides = dst_str;
     }
 
-    const auto update_index = [](const ov::Shape& pos, const ov::Shape& shape, const ov::Strides& strides) {
+    const auto update_index = [](const ov::Shape& pos, const ov::Strides& strides) {
         size_t offset = 0;
 
         for (size_t i = 0; i < pos.size(); i++) {
@@ -154,24 +152,46 @@ void ITensor::copy_to(const std::shared_ptr<ov::ITensor>& dst) const {
         return offset;
     };
 
-    bool finish = false;
-    for (size_t dst_idx = 0, src_idx = 0; !finish;) {
-        memcpy(dst_data + dst_idx, src_data + src_idx, src_strides[src_strides.size() - 1]);
-        // update indexes
-        for (size_t i = 0; i < cur_pos.size(); i++) {
-            size_t inverted_idx = cur_pos.size() - i - 1;
-            cur_pos[inverted_idx]++;
-            if (cur_pos[inverted_idx] != max_pos[inverted_idx]) {
-                break;
+    // The copied blocks are split between the threads, a single contiguous block is split into the chunks
+    const size_t num_blocks = ov::shape_size(max_pos);
+    const size_t block_size = src_strides[src_strides.size() - 1];
+    size_t chunks_per_block = 1;
+    const size_t chunk_size = 64 * 1024;
+    if (num_blocks == 1 && block_size > chunk_size) {
+        chunks_per_block = (block_size + chunk_size - 1) / chunk_size;
+    }
+    const size_t work_amount = num_blocks * chunks_per_block;
+    const size_t min_parallel_bytes = 1024 * 1024;
+    const int num_threads = num_blocks * block_size < min_parallel_bytes ? 1 : ov::parallel_get_max_threads();
+
+    ov::parallel_nt(num_threads, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        ov::splitter(work_amount, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        if (chunks_per_block > 1) {
+            const size_t begin = start * chunk_size;
+            const size_t size = std::min(end * chunk_size, block_size) - begin;
+            memcpy(dst_data + begin, src_data + begin, size);
+            return;
+        }
+
+        ov::Shape pos(max_pos.size());
+        for (size_t i = pos.size(), rest = start; i > 0; i--) {
+            pos[i - 1] = rest % max_pos[i - 1];
+            rest /= max_pos[i - 1];
+        }
+        for (size_t block = start; block < end; block++) {
+            memcpy(dst_data + update_index(pos, dst_strides), src_data + update_index(pos, src_strides), block_size);
+            // update indexes
+            for (size_t i = pos.size(); i > 0; i--) {
+                if (++pos[i - 1] != max_pos[i - 1])
+                    break;
+                pos[i - 1] = 0;
             }
-            if (inverted_idx)
-                cur_pos[inverted_idx] = 0;
-            else
-                finish = true;
         }
-        src_idx = update_index(cur_pos, max_pos, src_strides);
-        dst_idx = update_index(cur_pos, max_pos, dst_strides);
-    }
+    });
 }
 
 }  // namespace ov
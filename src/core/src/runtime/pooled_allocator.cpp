@@ -0,0 +1,175 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/pooled_allocator.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov {
+namespace {
+
+// The block header keeps the size and the offset of the data, so deallocate() does not need the size
+struct BlockHeader {
+    size_t size;
+    size_t offset;
+    bool pooled;
+};
+
+constexpr size_t min_alignment = 64;
+constexpr size_t max_pooled_alignment = 64;
+
+// Rounds up to the size class, the classes are spaced by a quarter of the power of 2 below the size
+size_t round_to_size_class(size_t bytes) {
+    if (bytes <= min_alignment)
+        return min_alignment;
+    size_t base = min_alignment;
+    while (base <= (bytes - 1) / 2)
+        base *= 2;
+    const size_t step = base / 4;
+    return base + (bytes - base + step - 1) / step * step;
+}
+
+void* aligned_alloc_block(size_t bytes, size_t alignment) {
+#if defined(_WIN32)
+    void* result = _aligned_malloc(bytes, alignment);
+    OPENVINO_ASSERT(result, "_aligned_malloc failed");
+    return result;
+#else
+    void* result = nullptr;
+    if (posix_memalign(&result, alignment, bytes) != 0) {
+        OPENVINO_THROW("posix_memalign failed");
+    }
+    return result;
+#endif
+}
+
+void free_block(void* block) {
+#if defined(_WIN32)
+    _aligned_free(block);
+#else
+    free(block);
+#endif
+}
+
+BlockHeader* header_of(void* data) {
+    return reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(data) - sizeof(BlockHeader));
+}
+
+}  // namespace
+
+struct PooledAllocator::Pool {
+    static constexpr size_t shards_number = 16;
+
+    struct Shard {
+        std::mutex mutex;
+        std::unordered_map<size_t, std::vector<void*>> blocks;
+    };
+
+    explicit Pool(size_t max_cached) : max_cached_bytes(max_cached) {}
+
+    ~Pool() {
+        release();
+    }
+
+    // The threads are assigned to the shards in the round robin order, so the threads of the streams do not contend
+    Shard& local_shard() {
+        static std::atomic<size_t> next_shard{0};
+        thread_local size_t shard = next_shard++ % shards_number;
+        return shards[shard];
+    }
+
+    void release() {
+        for (auto& shard : shards) {
+            std::lock_guard<std::mutex> lock{shard.mutex};
+            for (auto& it : shard.blocks) {
+                for (auto data : it.second) {
+                    cached_bytes -= it.first;
+                    free_block(static_cast<uint8_t*>(data) - header_of(data)->offset);
+                }
+            }
+            shard.blocks.clear();
+        }
+    }
+
+    const size_t max_cached_bytes;
+    std::array<Shard, shards_number> shards;
+    std::atomic<size_t> allocations{0};
+    std::atomic<size_t> reused{0};
+    std::atomic<size_t> allocated_bytes{0};
+    std::atomic<size_t> cached_bytes{0};
+};
+
+PooledAllocator::PooledAllocator(size_t max_cached_bytes) : m_pool{std::make_shared<Pool>(max_cached_bytes)} {}
+
+void* PooledAllocator::allocate(const size_t bytes, const size_t alignment) {
+    OPENVINO_ASSERT(alignment && !static_cast<bool>(alignment & (alignment - static_cast<size_t>(1))),
+                    "Alignment is not power of 2: ",
+                    alignment);
+    ++m_pool->allocations;
+    const bool pooled = alignment <= max_pooled_alignment;
+    const size_t size = pooled ? round_to_size_class(bytes) : bytes;
+    if (pooled) {
+        auto& shard = m_pool->local_shard();
+        std::lock_guard<std::mutex> lock{shard.mutex};
+        auto it = shard.blocks.find(size);
+        if (it != shard.blocks.end() && !it->second.empty()) {
+            void* data = it->second.back();
+            it->second.pop_back();
+            ++m_pool->reused;
+            m_pool->cached_bytes -= size;
+            m_pool->allocated_bytes += size;
+            return data;
+        }
+    }
+    // the header takes the whole alignment step before the data, so the data stays aligned
+    const size_t offset = std::max(min_alignment, alignment);
+    auto block = static_cast<uint8_t*>(aligned_alloc_block(offset + size, offset));
+    void* data = block + offset;
+    *header_of(data) = BlockHeader{size, offset, pooled};
+    m_pool->allocated_bytes += size;
+    return data;
+}
+
+void PooledAllocator::deallocate(void* handle, const size_t, const size_t) {
+    if (!handle)
+        return;
+    const auto header = *header_of(handle);
+    m_pool->allocated_bytes -= header.size;
+    if (header.pooled && m_pool->cached_bytes + header.size <= m_pool->max_cached_bytes) {
+        auto& shard = m_pool->local_shard();
+        std::lock_guard<std::mutex> lock{shard.mutex};
+        shard.blocks[header.size].push_back(handle);
+        m_pool->cached_bytes += header.size;
+        return;
+    }
+    free_block(static_cast<uint8_t*>(handle) - header.offset);
+}
+
+bool PooledAllocator::is_equal(const PooledAllocator& other) const {
+    return m_pool == other.m_pool;
+}
+
+PooledAllocator::Statistics PooledAllocator::get_statistics() const {
+    Statistics statistics;
+    statistics.allocations = m_pool->allocations;
+    statistics.reused = m_pool->reused;
+    statistics.allocated_bytes = m_pool->allocated_bytes;
+    statistics.cached_bytes = m_pool->cached_bytes;
+    return statistics;
+}
+
+void PooledAllocator::release_cached_memory() {
+    m_pool->release();
+}
+
+}  // namespace ov
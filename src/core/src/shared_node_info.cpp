@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_node_info.hpp"
+
+#include "openvino/op/util/op_types.hpp"
+
+void ov::SharedRTInfo::set_topological_order(const std::vector<std::shared_ptr<Node>>& order) {
+    m_positions.clear();
+    m_positions.reserve(order.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        m_positions.emplace(order[i].get(), i);
+    }
+    m_next_position = order.size();
+}
+
+void ov::SharedRTInfo::append_to_topological_order(const Node* node) {
+    m_positions.emplace(node, m_next_position++);
+}
+
+void ov::SharedRTInfo::on_input_replaced(const Node* node, Node* old_source, const Node* new_source) {
+    if (!m_use_topological_cache)
+        return;
+    const auto node_it = m_positions.find(node);
+    // the node was already removed from the model, so its inputs do not change the order
+    if (node_it == m_positions.end())
+        return;
+    const auto source_it = m_positions.find(new_source);
+    if (source_it == m_positions.end() || source_it->second >= node_it->second) {
+        m_use_topological_cache = false;
+        return;
+    }
+    if (old_source)
+        remove_unused({old_source});
+}
+
+void ov::SharedRTInfo::on_node_destroyed(const Node* node, std::vector<Node*> sources) {
+    if (!m_use_topological_cache || !m_positions.erase(node))
+        return;
+    remove_unused(std::move(sources));
+}
+
+void ov::SharedRTInfo::remove_unused(std::vector<Node*> candidates) {
+    while (!candidates.empty()) {
+        const auto candidate = candidates.back();
+        candidates.pop_back();
+        // the parameters, results and sinks are in the order without the consumers
+        if (!m_positions.count(candidate) || op::util::is_parameter(candidate) || op::util::is_output(candidate) ||
+            op::util::is_sink(candidate) || !candidate->get_control_dependents().empty())
+            continue;
+        bool is_used = false;
+        for (const auto& output : candidate->outputs()) {
+            for (const auto& input : output.get_target_inputs()) {
+                is_used = is_used || m_positions.count(input.get_node());
+            }
+        }
+        if (is_used)
+            continue;
+        m_positions.erase(candidate);
+        for (const auto& input : candidate->inputs()) {
+            candidates.push_back(input.get_source_output().get_node());
+        }
+        for (const auto& dependency : candidate->get_control_dependencies()) {
+            candidates.push_back(dependency.get());
+        }
+    }
+}
@@ -7,6 +7,8 @@
 #include <memory>
 #include <openvino/core/except.hpp>
 #include <openvino/core/node.hpp>
+#include <unordered_map>
+#include <vector>
 
 namespace ov {
 class SharedRTInfo {
@@ -21,7 +23,30 @@ public:
         return m_use_topological_cache;
     }
 
+    /// \brief Remembers the positions of the nodes in the cached topological order of the model
+    void set_topological_order(const std::vector<std::shared_ptr<Node>>& order);
+
+    /// \brief Adds the node to the end of the cached order, the node must not have the consumers
+    void append_to_topological_order(const Node* node);
+
+    bool is_in_topological_order(const Node* node) const {
+        return m_positions.count(node) != 0;
+    }
+
+    /// \brief Repairs the cached order after the input of the node was connected to the new source. The order stays
+    /// valid if the new source precedes the node in it, otherwise the cache is reset. The old source and its inputs
+    /// are removed from the order once they have no consumers in it.
+    void on_input_replaced(const Node* node, Node* old_source, const Node* new_source);
+
+    /// \brief Removes the destroyed node from the cached order, its sources are removed as well once they have no
+    /// consumers in it
+    void on_node_destroyed(const Node* node, std::vector<Node*> sources);
+
 private:
+    void remove_unused(std::vector<Node*> candidates);
+
     bool m_use_topological_cache;
+    std::unordered_map<const Node*, size_t> m_positions;
+    size_t m_next_position = 0;
 };
 }  // namespace ov
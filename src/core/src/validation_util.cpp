@@ -1370,3 +1370,36 @@ std::shared_ptr<ov::op::v0::Constant> ov::util::constantfold_subgraph(const Outp
         return nullptr;
     return ov::as_type_ptr<op::v0::Constant>(outputs[subgraph_sink.get_index()].get_node_shared_ptr());
 }
+
+bool ov::util::fold_split_to_views(const Node* node,
+                                   const op::v0::Constant& data,
+                                   int64_t axis,
+                                   OutputVector& output_values) {
+    const auto& data_shape = data.get_shape();
+    const auto rank = static_cast<int64_t>(data_shape.size());
+    axis = normalize(axis, rank);
+    if (axis < 0 || axis >= rank ||
+        std::any_of(data_shape.begin(), data_shape.begin() + axis, [](size_t dim) {
+            return dim != 1;
+        })) {
+        return false;
+    }
+
+    const auto& element_type = data.get_element_type();
+    const auto inner_size = shape_size(Shape(data_shape.begin() + axis + 1, data_shape.end()));
+    OutputVector views;
+    size_t axis_offset = 0;
+    for (const auto& output : node->outputs()) {
+        if (output.get_partial_shape().is_dynamic())
+            return false;
+        const auto& shape = output.get_shape();
+        const auto bit_offset = axis_offset * inner_size * element_type.bitwidth();
+        // the views of the sub-byte types should start at a byte boundary
+        if (bit_offset % 8 != 0)
+            return false;
+        views.push_back(std::make_shared<op::v0::Constant>(data, shape, bit_offset / 8));
+        axis_offset += shape[axis];
+    }
+    output_values = std::move(views);
+    return true;
+}
@@ -267,6 +267,23 @@ TEST(GraphRewriteTest, TypeBasedMatcherPassOrder2) {
     ASSERT_EQ(count_ops_of_type<op::v0::Tanh>(f), 1);
 }
 
+TEST(GraphRewriteTest, TypeBasedAndGenericMatcherPassOrder) {
+    auto f = get_model();
+
+    NodeVector order;
+    Anchor anchor;
+    anchor.add_matcher<GatherNodesPass>(order);
+    anchor.add_matcher<TypeBasedTestPass>()->set_callback(get_callback());
+    anchor.run_on_model(f);
+
+    // the generic matcher registered first still sees the Divide before the typed one replaces it
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v1::Divide>(f), 0);
+    ASSERT_TRUE(std::any_of(order.begin(), order.end(), [](const std::shared_ptr<Node>& node) {
+        return ov::is_type<op::v1::Divide>(node);
+    }));
+}
+
 TEST(PassConfigTest, Test1) {
     {
         auto f = get_model();
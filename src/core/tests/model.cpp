@@ -1481,7 +1481,13 @@ TEST(model, topological_sort_caching_replace_source_output) {
 
     relu2->input(0).replace_source_output(relu1);
 
-    // model has changed so cache must be updated
+    // the new source precedes the node, so the cached order is repaired
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    auto new_relu = std::make_shared<ov::opset8::Relu>(arg0);
+    relu2->input(0).replace_source_output(new_relu);
+
+    // the new source is not in the model yet, so cache must be updated
     ASSERT_FALSE(shared_info->get_use_topological_cache());
 
     ASSERT_EQ(f->get_ordered_ops().size(), 4);
@@ -1527,6 +1533,29 @@ TEST(model, topological_sort_caching_replace_output) {
     ASSERT_TRUE(all_ops_have_same_info(f));
 }
 
+TEST(model, topological_sort_caching_eliminate_node) {
+    auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
+    auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
+    auto relu2 = std::make_shared<ov::opset8::Relu>(relu1);
+    auto relu3 = std::make_shared<ov::opset8::Relu>(relu2);
+    auto result = std::make_shared<ov::opset8::Result>(relu3);
+    auto f = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{arg0});
+
+    auto shared_info = ov::ModelAccessor(f).get_shared_info();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+
+    // relu2 is still alive, but it has no consumers in the model
+    relu2->output(0).replace(relu1);
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops(), (ov::NodeVector{arg0, relu1, relu3, result}));
+
+    // relu1 and relu2 leave the model once relu3 is connected to the parameter
+    relu3->input(0).replace_source_output(arg0);
+    relu2.reset();
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
+    ASSERT_EQ(f->get_ordered_ops(), (ov::NodeVector{arg0, relu3, result}));
+}
+
 TEST(model, topological_sort_caching_set_argument) {
     auto arg0 = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1});
     auto relu1 = std::make_shared<ov::opset8::Relu>(arg0);
@@ -1539,8 +1568,8 @@ TEST(model, topological_sort_caching_set_argument) {
 
     relu2->set_argument(0, arg0);
 
-    // model has changed so cache must be updated
-    ASSERT_FALSE(shared_info->get_use_topological_cache());
+    // the new argument precedes the node, so the cached order is repaired and relu1 leaves it
+    ASSERT_TRUE(shared_info->get_use_topological_cache());
     ASSERT_EQ(f->get_ordered_ops().size(), 3);
     ASSERT_TRUE(shared_info->get_use_topological_cache());
     ASSERT_TRUE(all_ops_have_same_info(f));
@@ -2135,3 +2164,42 @@ TEST(model, create_model) {
     EXPECT_THROW(ov::Model(ov::ResultVector{}, {}, {}, {nullptr}, ""), ov::Exception);
     EXPECT_THROW(ov::Model(ov::OutputVector{ov::Output<ov::Node>{nullptr, 0}}, {}, {}, {}, ""), ov::Exception);
 }
+
+TEST(model, incremental_validation_skips_unchanged_nodes) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto relu = std::make_shared<ov::opset8::Relu>(param);
+    auto model = std::make_shared<ov::Model>(relu, ov::ParameterVector{param});
+    model->set_incremental_validation(true);
+    EXPECT_TRUE(model->get_incremental_validation());
+    model->validate_nodes_and_infer_types();
+
+    // the inputs of Relu have not changed, so the output type set outside of the validation is kept
+    relu->set_output_type(0, ov::element::f32, ov::PartialShape::dynamic());
+    model->validate_nodes_and_infer_types();
+    EXPECT_EQ(relu->get_output_partial_shape(0), ov::PartialShape::dynamic());
+
+    param->set_partial_shape({2, 3});
+    model->validate_nodes_and_infer_types();
+    EXPECT_EQ(relu->get_output_partial_shape(0), (ov::PartialShape{2, 3}));
+
+    model->set_incremental_validation(false);
+    relu->set_output_type(0, ov::element::f32, ov::PartialShape::dynamic());
+    model->validate_nodes_and_infer_types();
+    EXPECT_EQ(relu->get_output_partial_shape(0), (ov::PartialShape{2, 3}));
+}
+
+TEST(model, incremental_validation_reshape_revalidates_value_dependent_nodes) {
+    auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{1, 3});
+    auto shape_of = std::make_shared<ov::opset8::ShapeOf>(param);
+    auto value = ov::opset8::Constant::create(ov::element::f32, ov::Shape{}, {1.f});
+    auto broadcast = std::make_shared<ov::opset8::Broadcast>(value, shape_of);
+    auto model = std::make_shared<ov::Model>(broadcast, ov::ParameterVector{param});
+    model->set_incremental_validation(true);
+    model->validate_nodes_and_infer_types();
+    EXPECT_EQ(broadcast->get_output_partial_shape(0), (ov::PartialShape{1, 3}));
+
+    // the shape of the ShapeOf output stays {2}, but its value changes and Broadcast has to follow it
+    model->reshape(ov::PartialShape{2, 3});
+    EXPECT_EQ(shape_of->get_output_partial_shape(0), (ov::PartialShape{2}));
+    EXPECT_EQ(broadcast->get_output_partial_shape(0), (ov::PartialShape{2, 3}));
+}
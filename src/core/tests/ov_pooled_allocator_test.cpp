@@ -0,0 +1,63 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+#include "openvino/runtime/allocator.hpp"
+#include "openvino/runtime/pooled_allocator.hpp"
+#include "openvino/runtime/tensor.hpp"
+
+using OVPooledAllocatorTest = ::testing::Test;
+
+TEST_F(OVPooledAllocatorTest, reusesFreedBlockOfSameSizeClass) {
+    ov::PooledAllocator pool;
+    ov::Allocator allocator{pool};
+    void* ptr = allocator.allocate(1000);
+    allocator.deallocate(ptr, 1000);
+    EXPECT_EQ(allocator.allocate(990), ptr);
+    allocator.deallocate(ptr, 990);
+
+    const auto statistics = pool.get_statistics();
+    EXPECT_EQ(statistics.allocations, 2);
+    EXPECT_EQ(statistics.reused, 1);
+    EXPECT_EQ(statistics.allocated_bytes, 0);
+    EXPECT_EQ(statistics.cached_bytes, 1024);
+}
+
+TEST_F(OVPooledAllocatorTest, keepsAlignment) {
+    ov::PooledAllocator pool;
+    for (size_t alignment : {1, 16, 64, 256, 4096}) {
+        void* ptr = pool.allocate(100, alignment);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % alignment, 0);
+        pool.deallocate(ptr, 100, alignment);
+    }
+    EXPECT_EQ(pool.get_statistics().allocated_bytes, 0);
+}
+
+TEST_F(OVPooledAllocatorTest, releasesBlocksAboveCacheLimit) {
+    ov::PooledAllocator pool(1024);
+    void* small = pool.allocate(1024);
+    void* large = pool.allocate(4096);
+    pool.deallocate(small, 1024);
+    pool.deallocate(large, 4096);
+    EXPECT_EQ(pool.get_statistics().cached_bytes, 1024);
+    pool.release_cached_memory();
+    EXPECT_EQ(pool.get_statistics().cached_bytes, 0);
+}
+
+TEST_F(OVPooledAllocatorTest, copiesShareThePool) {
+    ov::PooledAllocator pool;
+    ov::Allocator allocator0{pool}, allocator1{pool};
+    EXPECT_TRUE(allocator0 == allocator1);
+    EXPECT_FALSE(allocator0 == ov::Allocator{ov::PooledAllocator{}});
+
+    {
+        ov::Tensor tensor(ov::element::f32, ov::Shape{1, 3, 8, 8}, allocator0);
+        EXPECT_EQ(pool.get_statistics().allocated_bytes, 768);
+    }
+    ov::Tensor tensor(ov::element::f32, ov::Shape{1, 3, 8, 8}, allocator1);
+    EXPECT_EQ(pool.get_statistics().reused, 1);
+}
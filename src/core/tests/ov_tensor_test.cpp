@@ -260,6 +260,12 @@ TEST_F(OVTensorTest, canSetShape) {
         ASSERT_EQ(origShape, t.get_shape());
         ASSERT_EQ(orig_data, t.data());
     }
+
+    // set_shape for the memory within the allocated one - does not perform reallocation
+    {
+        t.set_shape({2, 5, 6});
+        ASSERT_EQ(orig_data, t.data());
+    }
 }
 
 TEST_F(OVTensorTest, cannotSetShapeOfBiggerSizeOnPreallocatedMemory) {
@@ -565,6 +571,14 @@ INSTANTIATE_TEST_SUITE_P(copy_tests,
                                                                   ov::Shape{3, 2, 2}, ov::Strides{64, 16, 8},
                                                                   ov::Shape{3, 2, 2}, ov::Strides{128, 24, 8}
                                                               },
+                                                              TestParams {
+                                                                  ov::Shape{16, 64, 256}, {},
+                                                                  {0}, {}
+                                                              },
+                                                              TestParams {
+                                                                  ov::Shape{16, 64, 256}, {},
+                                                                  ov::Shape{16, 64, 256}, ov::Strides{135168, 2112, 8}
+                                                              },
                                                               TestParams {
                                                                   ov::Shape{}, {},
                                                                   {}, {}
@@ -327,6 +327,19 @@ TEST(constant_folding, constant_broadcast_v1_numpy) {
     ASSERT_EQ(values_expected, values_out);
 }
 
+TEST(constant_folding, constant_broadcast_v1_too_large_is_not_folded) {
+    auto constant_in = make_shared<ov::op::v0::Constant>(element::i8, Shape{}, vector<int8_t>{1});
+    auto constant_shape = make_shared<ov::op::v0::Constant>(element::i64, Shape{2}, vector<int64_t>{8192, 8192});
+    auto broadcast_v1 = make_shared<op::v1::Broadcast>(constant_in, constant_shape);
+    auto relu = make_shared<op::v0::Relu>(broadcast_v1);
+    auto f = make_shared<Model>(relu, ParameterVector{});
+
+    run_constant_folding(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::Broadcast>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::v0::Relu>(f), 1);
+}
+
 TEST(constant_folding, constant_unary_binary) {
     vector<int> values_a{1, 2, 3, 4};
     vector<int> values_b{1, 2, 3, 4};
@@ -2952,6 +2965,33 @@ TEST(constant_folding, constant_v1_variadic_split_axis_1_3_splits_neg_length) {
               res3_values);
 }
 
+TEST(constant_folding, constant_v1_variadic_split_shares_data) {
+    vector<int32_t> data{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+
+    const auto const_data = ov::op::v0::Constant::create(element::i32, Shape{1, 6, 2}, data);
+    const auto const_axis = ov::op::v0::Constant::create(element::i64, Shape{}, {-2});
+    const auto constant_lengths = ov::op::v0::Constant::create(element::i64, Shape{2}, {2, -1});
+
+    auto variadic_split_v1 = make_shared<op::v1::VariadicSplit>(const_data, const_axis, constant_lengths);
+    auto f = make_shared<Model>(variadic_split_v1->outputs(), ParameterVector{});
+
+    run_constant_folding(f);
+
+    ASSERT_EQ(count_ops_of_type<op::v1::VariadicSplit>(f), 0);
+
+    auto res1 = get_result_constant(f);
+    auto res2 = get_result_constant(f, 1);
+    ASSERT_TRUE(res1);
+    ASSERT_TRUE(res2);
+
+    // the outputs are the views of the data
+    EXPECT_EQ(res1->get_data_ptr<int32_t>(), const_data->get_data_ptr<int32_t>());
+    EXPECT_EQ(res2->get_data_ptr<int32_t>(), const_data->get_data_ptr<int32_t>() + 4);
+    EXPECT_EQ(res2->get_byte_size(), 8 * sizeof(int32_t));
+    ASSERT_EQ(vector<int32_t>({0, 1, 2, 3}), res1->get_vector<int32_t>());
+    ASSERT_EQ(vector<int32_t>({4, 5, 6, 7, 8, 9, 10, 11}), res2->get_vector<int32_t>());
+}
+
 TEST(constant_folding, constant_v1_one_hot) {
     const vector<int64_t> indices{0, 1, 2};
     const float on_value = 1.123f;
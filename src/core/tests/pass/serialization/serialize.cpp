@@ -62,6 +62,14 @@ TEST_P(SerializationTest, CompareFunctions) {
     });
 }
 
+TEST_P(SerializationTest, CompareFunctionsBinaryFormat) {
+    CompareSerialized([this](const std::shared_ptr<ov::Model>& m) {
+        ov::pass::Serialize serializer(m_out_xml_path, m_out_bin_path);
+        serializer.set_format(ov::pass::Serialize::Format::BINARY);
+        serializer.run_on_model(m);
+    });
+}
+
 TEST_P(SerializationTest, SerializeHelper) {
     CompareSerialized([this](const std::shared_ptr<ov::Model>& m) {
         ov::serialize(m, m_out_xml_path, m_out_bin_path);
@@ -16,8 +16,11 @@
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/pass/graph_rewrite.hpp"
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/pass.hpp"
+#include "openvino/pass/pass_profile.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
 
 using namespace ov;
 using namespace std;
@@ -75,6 +78,31 @@ bool validate_list(const std::vector<std::shared_ptr<ov::Node>>& nodes) {
     return rc;
 }
 
+class MultiplyToAdd : public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("MultiplyToAdd");
+    MultiplyToAdd() {
+        auto multiply = ov::pass::pattern::wrap_type<ov::op::v1::Multiply>();
+        ov::matcher_pass_callback callback = [](ov::pass::pattern::Matcher& m) {
+            auto node = m.get_match_root();
+            auto add = std::make_shared<ov::op::v1::Add>(node->input_value(0), node->input_value(1));
+            ov::replace_node(node, add);
+            return true;
+        };
+        register_matcher(std::make_shared<ov::pass::pattern::Matcher>(multiply, "MultiplyToAdd"), callback);
+    }
+};
+
+class NestedManagerPass : public ov::pass::ModelPass {
+public:
+    OPENVINO_RTTI("NestedManagerPass");
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override {
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::GraphRewrite>()->add_matcher<MultiplyToAdd>();
+        return manager.run_passes(model);
+    }
+};
+
 }  // namespace
 
 TEST(pass_manager, add) {
@@ -90,3 +118,44 @@ TEST(pass_manager, add) {
     EXPECT_EQ(node_count, sorted.size());
     EXPECT_TRUE(validate_list(sorted));
 }
+
+TEST(pass_manager, profile) {
+    auto graph = make_test_graph();
+    const auto nodes_count = graph->get_ops().size();
+
+    pass::PassProfiler profiler;
+    pass::Manager pass_manager;
+    pass_manager.register_pass<NestedManagerPass>();
+    pass_manager.run_passes(graph);
+
+    const auto& passes = profiler.get_profile().children;
+    ASSERT_FALSE(passes.empty());
+    const auto& nested_manager_pass = passes.front();
+    EXPECT_EQ(nested_manager_pass.name, "NestedManagerPass");
+    EXPECT_EQ(nested_manager_pass.nodes_before, nodes_count);
+    EXPECT_EQ(nested_manager_pass.nodes_after, nodes_count);
+    EXPECT_EQ(nested_manager_pass.applied, 1u);
+
+    ASSERT_FALSE(nested_manager_pass.children.empty());
+    const auto& graph_rewrite = nested_manager_pass.children.front();
+    ASSERT_EQ(graph_rewrite.children.size(), 1u);
+    const auto& matcher_pass = graph_rewrite.children.front();
+    EXPECT_EQ(matcher_pass.name, "MultiplyToAdd");
+    EXPECT_EQ(matcher_pass.runs, 1u);
+    EXPECT_EQ(matcher_pass.applied, 1u);
+    EXPECT_LE(matcher_pass.duration, graph_rewrite.duration);
+
+    EXPECT_NE(profiler.to_json().find("{\"name\":\"MultiplyToAdd\""), std::string::npos);
+}
+
+TEST(pass_manager, profile_is_not_collected_without_profiler) {
+    auto graph = make_test_graph();
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<NestedManagerPass>();
+    pass_manager.run_passes(graph);
+
+    pass::PassProfiler profiler;
+    EXPECT_TRUE(profiler.get_profile().children.empty());
+    EXPECT_EQ(profiler.to_json(), "[]");
+}
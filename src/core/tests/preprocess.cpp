@@ -1045,6 +1045,26 @@ TEST(pre_post_process, preprocess_convert_layout_implicit) {
     EXPECT_EQ(tensor_names, f->output().get_tensor().get_names());
 }
 
+TEST(pre_post_process, preprocess_convert_layout_implicit_on_narrower_type) {
+    auto f = create_simple_function(element::f32, Shape{1, 3, 2, 2});
+    auto p = PrePostProcessor(f);
+
+    p.input().tensor().set_layout("NHWC").set_element_type(element::u8);
+    p.input().model().set_layout("NCHW");
+    p.build();
+    EXPECT_EQ(f->get_parameters()[0]->get_element_type(), element::u8);
+    EXPECT_EQ(f->get_parameters()[0]->get_output_tensor(0).get_partial_shape(), (PartialShape{1, 2, 2, 3}));
+    // u8 data is transposed before the conversion to f32
+    auto consumers = f->get_parameters()[0]->output(0).get_target_inputs();
+    ASSERT_EQ(consumers.size(), 1u);
+    auto transpose = consumers.begin()->get_node();
+    EXPECT_EQ(std::string(transpose->get_type_name()), std::string(op::v1::Transpose::get_type_info_static().name));
+    EXPECT_EQ(transpose->get_output_element_type(0), element::u8);
+    ASSERT_EQ(transpose->output(0).get_target_inputs().size(), 1u);
+    auto convert = transpose->output(0).get_target_inputs().begin()->get_node();
+    EXPECT_EQ(std::string(convert->get_type_name()), std::string(op::v0::Convert::get_type_info_static().name));
+}
+
 TEST(pre_post_process, preprocess_convert_layout_default) {
     auto f = create_simple_function(element::f32, Shape{1, 3, 2, 2});
     auto p = PrePostProcessor(f);
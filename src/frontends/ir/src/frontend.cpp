@@ -4,14 +4,18 @@
 
 #include "openvino/frontend/ir/frontend.hpp"
 
+#include <algorithm>
 #include <array>
+#include <fstream>
 #include <pugixml.hpp>
+#include <thread>
 #include <vector>
 
 #include "input_model.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/core/any.hpp"
+#include "openvino/core/binary_xml.hpp"
 #include "openvino/core/so_extension.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/mmap_object.hpp"
@@ -23,6 +27,44 @@ namespace frontend {
 namespace ir {
 namespace {
 
+/**
+ * @brief Reads the weights file, the large files are read by the chunks on the concurrent threads
+ *
+ * A single sequential read leaves the bandwidth of the network file systems mostly unused, while each of the
+ * concurrent reads of the chunks has its own request in flight.
+ */
+template <typename Path>
+void read_weights(std::ifstream& bin_stream, const Path& weights_path, char* data, size_t size) {
+    constexpr size_t min_chunk_size = 16 * 1024 * 1024;
+    const size_t chunks = std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), 8);
+    const size_t chunk_size = std::max(min_chunk_size, (size + chunks - 1) / chunks);
+    if (size <= chunk_size) {
+        bin_stream.read(data, size);
+        OPENVINO_ASSERT(bin_stream.gcount() == static_cast<std::streamsize>(size), "Weights file cannot be read!");
+        return;
+    }
+    std::vector<std::thread> readers;
+    std::vector<char> read_ok((size + chunk_size - 1) / chunk_size, false);
+    for (size_t chunk = 0; chunk < read_ok.size(); chunk++) {
+        readers.emplace_back([&, chunk] {
+            const size_t offset = chunk * chunk_size;
+            const size_t bytes = std::min(chunk_size, size - offset);
+            std::ifstream chunk_stream(weights_path.c_str(), std::ios::binary);
+            chunk_stream.seekg(offset, std::ios::beg);
+            chunk_stream.read(data + offset, bytes);
+            read_ok[chunk] = chunk_stream.gcount() == static_cast<std::streamsize>(bytes);
+        });
+    }
+    for (auto& reader : readers)
+        reader.join();
+    OPENVINO_ASSERT(std::all_of(read_ok.begin(),
+                                read_ok.end(),
+                                [](char ok) {
+                                    return ok;
+                                }),
+                    "Weights file cannot be read!");
+}
+
 inline size_t get_ir_version(pugi::xml_node& root) {
     return static_cast<size_t>(pugixml::utils::get_uint64_attr(root, "version", 0));
 }
@@ -40,6 +82,10 @@ size_t get_ir_version(std::istream& model) {
     model.clear();
     model.seekg(0, model.beg);
 
+    if (ov::binary_xml::is_binary_xml(header.data(), header.size())) {
+        return static_cast<size_t>(ov::binary_xml::get_ir_version(header.data(), header.size()));
+    }
+
     pugi::xml_document doc;
     auto res =
         doc.load_buffer(header.data(), header.size(), pugi::parse_default | pugi::parse_fragment, pugi::encoding_utf8);
@@ -223,7 +269,7 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
             bin_stream.seekg(0, std::ios::beg);
 
             auto aligned_weights_buffer = std::make_shared<ngraph::runtime::AlignedBuffer>(file_size);
-            bin_stream.read(aligned_weights_buffer->get_ptr<char>(), aligned_weights_buffer->size());
+            read_weights(bin_stream, weights_path, aligned_weights_buffer->get_ptr<char>(), file_size);
             bin_stream.close();
 
             weights = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ngraph::runtime::AlignedBuffer>>>(
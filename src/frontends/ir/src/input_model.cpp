@@ -4,9 +4,11 @@
 
 #include "input_model.hpp"
 
+#include <array>
 #include <pugixml.hpp>
 
 #include "ir_deserializer.hpp"
+#include "openvino/core/binary_xml.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/validation_util.hpp"
 #include "openvino/op/concat.hpp"
@@ -206,6 +208,9 @@ class InputModel::InputModelIRImpl {
     std::unordered_map<std::string, ov::OpSet> m_opsets;
     pugi::xml_node m_root;
     pugi::xml_document m_xml_doc;
+    std::shared_ptr<ov::Model> m_model;
+
+    std::shared_ptr<ov::Model> convert_document();
 
 public:
     InputModelIRImpl(std::istream& stream,
@@ -213,9 +218,19 @@ public:
                      const std::unordered_map<ov::DiscreteTypeInfo, ov::BaseOpExtension::Ptr>& extensions)
         : m_weights(weights),
           m_extensions(extensions) {
-        pugi::xml_parse_result res = m_xml_doc.load(stream);
-        if (res.status != pugi::status_ok) {
-            OPENVINO_THROW(res.description(), " at offset ", res.offset);
+        std::array<char, sizeof(ov::binary_xml::signature)> signature{};
+        const auto position = stream.tellg();
+        stream.read(signature.data(), signature.size());
+        const auto signature_size = static_cast<size_t>(stream.gcount());
+        stream.clear();
+        stream.seekg(position);
+        if (ov::binary_xml::is_binary_xml(signature.data(), signature_size)) {
+            ov::binary_xml::load(m_xml_doc, stream);
+        } else {
+            pugi::xml_parse_result res = m_xml_doc.load(stream);
+            if (res.status != pugi::status_ok) {
+                OPENVINO_THROW(res.description(), " at offset ", res.offset);
+            }
         }
         m_root = m_xml_doc.document_element();
         for (const auto& it : ov::get_available_opsets()) {
@@ -238,6 +253,24 @@ std::shared_ptr<ov::Model> InputModel::convert() {
 }
 
 std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert() {
+    // the XML of the layers is released during the conversion, so the model is built once and returned again
+    if (m_model)
+        return m_model;
+    OPENVINO_ASSERT(m_root, "The XML of the IR model was released by the failed conversion");
+    // the document and its in-situ buffer holding the text of the whole XML are freed once the conversion is over
+    try {
+        m_model = convert_document();
+    } catch (...) {
+        m_xml_doc.reset();
+        m_root = {};
+        throw;
+    }
+    m_xml_doc.reset();
+    m_root = {};
+    return m_model;
+}
+
+std::shared_ptr<ov::Model> InputModel::InputModelIRImpl::convert_document() {
     std::unordered_map<std::string, std::shared_ptr<ov::op::util::Variable>> variables;
 
     // Load default opsets
@@ -483,6 +483,7 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(
     std::map<std::string, std::shared_ptr<ov::Node>> variable_id_to_read_value;
 
     //  Following topological order create OpenVINO operations
+    auto layers = root.child("layers");
     for (auto& layer_id : order) {
         auto& p = params[layer_id];
         const auto& edgeIt = edges.find(layer_id);
@@ -508,6 +509,12 @@ std::shared_ptr<ov::Model> ov::XmlDeserializer::parse_function(
 
         auto node = create_node(inputs, p.xml, weights, p.params);
         id_to_node[layer_id] = node;
+        // The XML of the created layer, including the bodies of the sub-graph operations, is released right away to
+        // lower the peak memory of the big models. The Parameter and Result layers are kept for the port maps of the
+        // sub-graph operations.
+        if (p.params.type != "Parameter" && p.params.type != "Result") {
+            layers.remove_child(p.xml);
+        }
 
         if (const auto& parameter_node = std::dynamic_pointer_cast<ov::op::v0::Parameter>(node)) {
             io_map.inputs.insert({layer_id, func_nodes.parameters.size()});
@@ -86,6 +86,65 @@ TEST_F(IRFrontendTests, elementary_model_reading_v11) {
     EXPECT_TRUE(res.valid) << res.message;
 }
 
+TEST_F(IRFrontendTests, model_is_converted_once) {
+    std::string testModel = R"V0G0N(
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="relu" type="ReLU" id="1" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+            <output>
+                <port id="1" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="2" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="1" to-port="0"/>
+        <edge from-layer="1" from-port="1" to-layer="2" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::istringstream modelStream(testModel);
+    ov::AnyVector params{static_cast<std::istream*>(&modelStream)};
+    auto FE = manager.load_by_model(params);
+    ASSERT_TRUE(FE);
+    auto inputModel = FE->load(params);
+    ASSERT_TRUE(inputModel);
+
+    std::shared_ptr<ov::Model> model;
+    ASSERT_NO_THROW(model = FE->convert(inputModel));
+    ASSERT_EQ(3u, model->get_ops().size());
+    // the XML of the layers is released during the conversion, the model converted first is returned again
+    std::shared_ptr<ov::Model> model_again;
+    ASSERT_NO_THROW(model_again = FE->convert(inputModel));
+    EXPECT_EQ(model, model_again);
+}
+
 TEST_F(IRFrontendTests, elementary_model_reading_v10) {
     std::string testModelV10 = R"V0G0N(
 <net name="Network" version="10">
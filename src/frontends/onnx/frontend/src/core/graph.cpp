@@ -4,10 +4,13 @@
 
 #include "core/graph.hpp"
 
+#include <algorithm>
 #include <exception>
 #include <functional>
+#include <future>
 #include <numeric>
 #include <sstream>
+#include <thread>
 
 #include "core/transform.hpp"
 #include "core/value_info.hpp"
@@ -38,6 +41,27 @@ bool common_node_for_all_outputs(const OutputVector& outputs) {
     return ret;
 };
 
+/// \brief Runs func(begin, end) for the chunks of the [0, count) range on the hardware threads, the small ranges
+/// run on the calling thread
+void parallel_for_chunks(size_t count, const std::function<void(size_t, size_t)>& func) {
+    constexpr size_t min_chunk = 16;
+    const auto threads_num =
+        std::min(static_cast<size_t>(std::max(std::thread::hardware_concurrency(), 1u)), count / min_chunk);
+    if (threads_num <= 1) {
+        func(0, count);
+        return;
+    }
+    std::vector<std::future<void>> chunks;
+    const auto chunk = (count + threads_num - 1) / threads_num;
+    for (size_t begin = chunk; begin < count; begin += chunk) {
+        chunks.push_back(std::async(std::launch::async, func, begin, std::min(begin + chunk, count)));
+    }
+    func(0, chunk);
+    for (auto& c : chunks) {
+        c.get();
+    }
+}
+
 OPENVINO_SUPPRESS_DEPRECATED_START
 OperatorsBridge register_extensions(OperatorsBridge& bridge,
                                     const std::vector<ov::frontend::ConversionExtensionBase::Ptr>& conversions) {
@@ -144,24 +168,43 @@ Graph::Graph(const std::string& model_dir,
     std::map<std::string, Tensor> initializers;
 
     // Process all initializers in the graph
+    std::vector<const ONNX_NAMESPACE::TensorProto*> named_initializers;
     for (const auto& initializer_tensor : m_model->get_graph().initializer()) {
         if (initializer_tensor.has_name()) {
-            Tensor tensor = Tensor{initializer_tensor, m_model_dir, m_mmap_cache};
-            std::shared_ptr<default_opset::Constant> ng_constant;
-            // For each initializer create a Constant node and store it in cache
+            named_initializers.push_back(&initializer_tensor);
+        }
+    }
+    // The initializers are independent, so they are decoded into the Constant nodes in parallel. The nodes are put
+    // into the cache in the order of the initializers and the first error in that order is rethrown, the same as for
+    // the sequential processing.
+    std::vector<std::shared_ptr<default_opset::Constant>> ng_constants(named_initializers.size());
+    std::vector<std::exception_ptr> errors(named_initializers.size());
+    detail::parallel_for_chunks(named_initializers.size(), [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            Tensor tensor = Tensor{*named_initializers[i], m_model_dir, m_mmap_cache, model_proto};
+            // For each initializer create a Constant node
             try {
-                ng_constant = tensor.get_ng_constant();
-            } catch (const error::invalid_external_data&) {
-                // invalid external data makes initializers creation impossible
-                throw;
-            } catch (const ngraph::ngraph_error&) {
-                ng_constant = ngraph::onnx_import::common::make_failsafe_constant(tensor.get_ng_type());
+                try {
+                    ng_constants[i] = tensor.get_ng_constant();
+                } catch (const error::invalid_external_data&) {
+                    // invalid external data makes initializers creation impossible
+                    throw;
+                } catch (const ngraph::ngraph_error&) {
+                    ng_constants[i] = ngraph::onnx_import::common::make_failsafe_constant(tensor.get_ng_type());
+                }
+            } catch (...) {
+                errors[i] = std::current_exception();
             }
-
-            initializers.emplace(initializer_tensor.name(), tensor);
-            ng_constant->get_output_tensor(0).set_names({initializer_tensor.name()});
-            m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constant));
         }
+    });
+    for (size_t i = 0; i < named_initializers.size(); ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
+        }
+        const auto& initializer_tensor = *named_initializers[i];
+        initializers.emplace(initializer_tensor.name(), Tensor{initializer_tensor, m_model_dir, m_mmap_cache});
+        ng_constants[i]->get_output_tensor(0).set_names({initializer_tensor.name()});
+        m_cache->emplace_node(initializer_tensor.name(), std::move(ng_constants[i]));
     }
 
     // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
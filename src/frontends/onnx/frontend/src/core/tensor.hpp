@@ -7,6 +7,8 @@
 #include <onnx/onnx_pb.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -108,13 +110,19 @@ public:
     };
 
     Tensor() = delete;
+    /// \brief      Constructs the tensor
+    ///
+    /// \param      model_proto  The model owning the tensor proto. If it is set, the Constant nodes share the raw
+    ///                          data embedded in the model instead of copying it and keep the model alive.
     Tensor(const ONNX_NAMESPACE::TensorProto& tensor,
            const std::string& model_dir,
-           detail::MappedMemoryHandles mmap_cache)
+           detail::MappedMemoryHandles mmap_cache,
+           std::shared_ptr<ONNX_NAMESPACE::ModelProto> model_proto = nullptr)
         : m_tensor_proto{&tensor},
           m_shape{std::begin(tensor.dims()), std::end(tensor.dims())},
           m_model_dir{model_dir},
-          m_mmap_cache{mmap_cache} {
+          m_mmap_cache{mmap_cache},
+          m_model_proto{std::move(model_proto)} {
         if (m_shape == Shape{0}) {
             // It's possible to construct a tensor in ONNX with "dims: 0" property
             // Such tensor contains a scalar. This results in a Shape{0} stored in m_shape.
@@ -258,7 +266,10 @@ private:
                     "' in the model");
             }
         } else if (data_size == shape_size(m_shape)) {
-            constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
+            constant = make_shared_raw_data_constant(type);
+            if (!constant) {
+                constant = std::make_shared<ngraph::op::Constant>(type, m_shape, get_data_ptr());
+            }
         } else if (data_size == 0 && m_shape.size() == 0) {
             constant = common::make_failsafe_constant(type);
         } else {
@@ -277,7 +288,13 @@ private:
                                           !std::is_same<T, uint64_t>::value,
                                       bool>::type = true>
     std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const {
-        std::shared_ptr<default_opset::Constant> constant{nullptr};
+        std::shared_ptr<default_opset::Constant> constant = make_shared_raw_data_constant(type);
+        if (constant) {
+            if (m_tensor_proto->has_name()) {
+                constant->set_friendly_name(get_name());
+            }
+            return constant;
+        }
         auto data = get_data<T>();
         auto data_size = data.size();
         if (data_size == shape_size(m_shape)) {
@@ -293,6 +310,28 @@ private:
         return constant;
     }
 
+    // Creates the Constant over the raw data of the tensor proto, the buffer holds the model proto. Returns nullptr
+    // if the data can't be shared: there is no owner, the data is not raw, its size doesn't match the shape or it
+    // is small or misaligned, e.g. kept inside the std::string object.
+    std::shared_ptr<ngraph::op::Constant> make_shared_raw_data_constant(const element::Type& type) const {
+        constexpr size_t min_shared_size = 64;
+        if (!m_model_proto || !m_tensor_proto->has_raw_data() || has_external_data()) {
+            return nullptr;
+        }
+        const auto& raw_data = m_tensor_proto->raw_data();
+        if (raw_data.size() < min_shared_size || raw_data.size() != shape_size(m_shape) * type.size() ||
+            reinterpret_cast<uintptr_t>(raw_data.data()) % type.size() != 0) {
+            return nullptr;
+        }
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ONNX_NAMESPACE::ModelProto>>>(
+            const_cast<char*>(raw_data.data()),
+            raw_data.size(),
+            m_model_proto);
+        OPENVINO_SUPPRESS_DEPRECATED_END
+        return std::make_shared<ngraph::op::Constant>(type, m_shape, buffer);
+    }
+
     bool has_external_data() const {
         return m_tensor_proto->has_data_location() &&
                m_tensor_proto->data_location() ==
@@ -355,6 +394,7 @@ private:
     Shape m_shape;
     std::string m_model_dir;
     detail::MappedMemoryHandles m_mmap_cache;
+    std::shared_ptr<ONNX_NAMESPACE::ModelProto> m_model_proto;
 };
 
 inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor) {
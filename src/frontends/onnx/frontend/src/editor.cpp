@@ -312,6 +312,16 @@ struct onnx_editor::ONNXModelEditor::Impl {
     Impl(const std::wstring& model_path)
         : Impl(std::make_shared<ONNX_NAMESPACE::ModelProto>(ngraph::onnx_common::parse_from_file(model_path))) {}
 #endif
+
+    /// \brief Copies the model proto if it is shared, before the initializers are replaced or removed
+    ///
+    /// The Constant nodes of the converted models share the raw data of the initializers with the model proto, so
+    /// the editor modifies its own copy while any of them is alive.
+    void detach_model_proto() {
+        if (m_model_proto.use_count() > 1) {
+            m_model_proto = std::make_shared<ONNX_NAMESPACE::ModelProto>(*m_model_proto);
+        }
+    }
 };
 
 onnx_editor::ONNXModelEditor::ONNXModelEditor(const std::string& model_path,
@@ -455,6 +465,7 @@ void onnx_editor::ONNXModelEditor::extract_subgraph(const std::vector<InputEdge>
         return;
     }
 
+    m_pimpl->detach_model_proto();
     if (!outputs.empty()) {
         m_pimpl->m_model_proto->mutable_graph()->mutable_output()->Clear();
     }
@@ -542,6 +553,7 @@ std::shared_ptr<Model> onnx_editor::ONNXModelEditor::get_function() const {
 
 void onnx_editor::ONNXModelEditor::set_input_values(
     const std::map<std::string, std::shared_ptr<ngraph::op::Constant>>& input_values) {
+    m_pimpl->detach_model_proto();
     auto onnx_graph = m_pimpl->m_model_proto->mutable_graph();
 
     for (const auto& input : input_values) {
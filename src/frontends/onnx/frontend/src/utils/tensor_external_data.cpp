@@ -5,6 +5,7 @@
 #include "utils/tensor_external_data.hpp"
 
 #include <fstream>
+#include <mutex>
 #include <sstream>
 
 #include "exceptions.hpp"
@@ -40,13 +41,18 @@ Buffer<ov::MappedMemory> TensorExternalData::load_external_mmap_data(const std::
     if (file_size <= 0 || m_offset + m_data_length > static_cast<uint64_t>(file_size)) {
         throw error::invalid_external_data{*this};
     }
-    auto cached_mapped_memory = cache->find(full_path);
     std::shared_ptr<ov::MappedMemory> mapped_memory;
-    if (cached_mapped_memory != cache->end()) {
-        mapped_memory = cached_mapped_memory->second;
-    } else {
-        mapped_memory = ov::load_mmap_object(full_path);
-        (*cache)[full_path] = mapped_memory;
+    {
+        // the initializers of a graph are loaded in parallel
+        static std::mutex cache_mutex;
+        std::lock_guard<std::mutex> lock{cache_mutex};
+        auto cached_mapped_memory = cache->find(full_path);
+        if (cached_mapped_memory != cache->end()) {
+            mapped_memory = cached_mapped_memory->second;
+        } else {
+            mapped_memory = ov::load_mmap_object(full_path);
+            (*cache)[full_path] = mapped_memory;
+        }
     }
     if (m_data_length > mapped_memory->size() || mapped_memory->size() == 0) {
         throw error::invalid_external_data{*this};
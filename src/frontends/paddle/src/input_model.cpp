@@ -4,16 +4,23 @@
 
 #include "input_model.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
+#include <future>
 #include <queue>
+#include <thread>
 
 #include "decoder_proto.hpp"
 #include "framework.pb.h"
 #include "input_model.hpp"
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/paddle/node_context.hpp"
 #include "openvino/opsets/opset7.hpp"
+#include "openvino/runtime/tensor.hpp"
 #include "openvino/util/common_util.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "paddle_utils.hpp"
 #include "place.hpp"
 
@@ -57,6 +64,7 @@ private:
     template <typename T>
     void load_consts(const std::basic_string<T>& folder_with_weights);
     void load_consts(std::istream* weight_stream);
+    void load_consts(const std::shared_ptr<ov::MappedMemory>& weights);
     void create_temp_consts();
     std::vector<std::shared_ptr<OpPlace>> determine_cut_nodes() const;
 
@@ -184,16 +192,13 @@ bool is_pdmodel(const std::basic_string<wchar_t>& path) {
 #endif
 
 template <typename T>
-std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstream* weights_stream) {
+std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::basic_string<T>* weights_file) {
     std::string model_file{path};
     std::string ext = ".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::string params_ext = ".pdiparams";
-        std::string weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file, std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<T>() + "__model__";
     }
@@ -202,16 +207,13 @@ std::basic_string<T> get_model_path(const std::basic_string<T>& path, std::ifstr
 
 #if defined(OPENVINO_ENABLE_UNICODE_PATH_SUPPORT) && defined(_WIN32)
 template <>
-std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::ifstream* weights_stream) {
+std::basic_string<wchar_t> get_model_path(const std::basic_string<wchar_t>& path, std::wstring* weights_file) {
     std::wstring model_file{path};
     std::wstring ext = L".pdmodel";
     if (ov::util::ends_with(model_file, ext)) {
         std::wstring params_ext = L".pdiparams";
-        std::wstring weights_file{path};
-        weights_file.replace(weights_file.size() - ext.size(), ext.size(), params_ext);
-        weights_stream->open(weights_file.c_str(), std::ios::binary);
-        // Don't throw error if file isn't opened
-        // It may mean that model don't have constants
+        *weights_file = path;
+        weights_file->replace(weights_file->size() - ext.size(), ext.size(), params_ext);
     } else {
         model_file += paddle::get_path_sep<wchar_t>() + L"__model__";
     }
@@ -271,6 +273,7 @@ std::vector<std::shared_ptr<OpPlace>> InputModel::InputModelImpl::determine_cut_
 // load_consts with folder is compatible with old PaddlePaddle API.
 template <typename T>
 void InputModel::InputModelImpl::load_consts(const std::basic_string<T>& folder_with_weights) {
+    std::vector<std::string> names;
     for (const auto& item : m_var_places) {
         const auto& var_desc = item.second->get_desc();
         const auto& name = item.first;
@@ -280,35 +283,69 @@ void InputModel::InputModelImpl::load_consts(const std::basic_string<T>& folder_
             continue;
 
         FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
-        const auto& tensor = var_desc.type().lod_tensor().tensor();
-        Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
-        const auto& type = get_ov_type(tensor.data_type());
-        const auto& data_length = shape_size(shape) * type.size();
-        std::vector<uint8_t> tensor_data(data_length);
+        names.push_back(name);
+    }
+    FRONT_END_GENERAL_CHECK(names.empty() || !folder_with_weights.empty(), "Folder with weights must be provided.");
+
+    // Every variable is stored in its own file, so the files are read in parallel chunks. The errors are rethrown in
+    // the order of the variables, the same as for the sequential reading.
+    std::vector<std::shared_ptr<opset7::Constant>> consts(names.size());
+    std::vector<std::exception_ptr> errors(names.size());
+    auto read_consts = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            try {
+                const auto& name = names[i];
+                const auto& tensor = m_var_places.at(name)->get_desc().type().lod_tensor().tensor();
+                Shape shape(tensor.dims().cbegin(), tensor.dims().cend());
+                const auto& type = get_ov_type(tensor.data_type());
+                // the constant shares the tensor, so the data is read right into the constant memory
+                ov::Tensor tensor_data(type, shape);
+
+                std::ifstream is(get_const_path(folder_with_weights, name), std::ios::in | std::ifstream::binary);
+                FRONT_END_GENERAL_CHECK(is && is.is_open(), "Cannot open file for constant value.");
+                const size_t header_size = 16;
+                std::vector<char> header(header_size);
+                is.read(&header[0], header_size);
+
+                uint32_t dims_len = 0;
+                is.read(reinterpret_cast<char*>(&dims_len), 4);
+                std::vector<char> dims_struct(dims_len);
+                is.read(dims_struct.data(), dims_len);
+                bool read_succeed =
+                    read_tensor(is, static_cast<char*>(tensor_data.data()), tensor_data.get_byte_size());
+                FRONT_END_GENERAL_CHECK(read_succeed,
+                                        "File containing constant with name ",
+                                        name,
+                                        " wasn't successfully read.");
+                consts[i] = std::make_shared<opset7::Constant>(tensor_data);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    };
+    const size_t min_chunk = 16;
+    const size_t chunks_number =
+        std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), (names.size() + min_chunk - 1) / min_chunk);
+    if (chunks_number <= 1) {
+        read_consts(0, names.size());
+    } else {
+        const size_t chunk = (names.size() + chunks_number - 1) / chunks_number;
+        std::vector<std::future<void>> chunks;
+        for (size_t begin = 0; begin < names.size(); begin += chunk) {
+            chunks.push_back(
+                std::async(std::launch::async, read_consts, begin, std::min(begin + chunk, names.size())));
+        }
+        for (auto& result : chunks) {
+            result.get();
+        }
+    }
 
-        bool read_succeed = false;
-        if (!folder_with_weights.empty()) {
-            std::ifstream is(get_const_path(folder_with_weights, name), std::ios::in | std::ifstream::binary);
-            FRONT_END_GENERAL_CHECK(is && is.is_open(), "Cannot open file for constant value.");
-            const size_t header_size = 16;
-            std::vector<char> header(header_size);
-            is.read(&header[0], header_size);
-
-            uint32_t dims_len = 0;
-            is.read(reinterpret_cast<char*>(&dims_len), 4);
-            std::vector<char> dims_struct(dims_len);
-            is.read(&dims_struct[0], dims_len);
-            read_succeed = read_tensor(is, reinterpret_cast<char*>(&tensor_data[0]), data_length);
-        } else {
-            FRONT_END_GENERAL_CHECK(false, "Folder with weights must be provided.");
+    for (size_t i = 0; i < names.size(); ++i) {
+        if (errors[i]) {
+            std::rethrow_exception(errors[i]);
         }
-        FRONT_END_GENERAL_CHECK(read_succeed,
-                                "File containing constant with name ",
-                                name,
-                                " wasn't successfully read.");
-        auto const_node = opset7::Constant::create(type, shape, &tensor_data[0]);
-        const_node->set_friendly_name(name);
-        m_tensor_values[name] = const_node;
+        consts[i]->set_friendly_name(names[i]);
+        m_tensor_values[names[i]] = consts[i];
     }
 }
 
@@ -370,6 +407,61 @@ void InputModel::InputModelImpl::load_consts(std::istream* weight_stream) {
     }
 }
 
+// load_consts with mapped memory is compatible with new PaddlePaddle API, the constants share the mapped weights.
+void InputModel::InputModelImpl::load_consts(const std::shared_ptr<ov::MappedMemory>& weights) {
+    const char* data = weights ? weights->data() : nullptr;
+    const size_t size = weights ? weights->size() : 0;
+    size_t offset = 0;
+    for (const auto& item : m_var_places) {
+        const auto& var_desc = item.second->get_desc();
+        const auto& name = item.first;
+        if (ov::util::ends_with(name, std::string{"feed"}) || ov::util::ends_with(name, std::string{"fetch"}))
+            continue;
+
+        // var_desc.persistable() is used to mark node const value or not.
+        if (!var_desc.persistable())
+            continue;
+
+        FRONT_END_GENERAL_CHECK(var_desc.type().type() == ::paddle::framework::proto::VarType::LOD_TENSOR);
+        FRONT_END_GENERAL_CHECK(offset < size, "PaddlePaddle *.pdiparams format weight file doesn't exist!");
+        // the layout of the weight is described in load_consts with stream
+        const size_t header_size = 16;
+        int32_t desc_size = 0;
+        FRONT_END_GENERAL_CHECK(size - offset >= header_size + sizeof(desc_size),
+                                "File containing constant with name ",
+                                name,
+                                " wasn't successfully read.");
+        std::memcpy(&desc_size, data + offset + header_size, sizeof(desc_size));
+        offset += header_size + sizeof(desc_size);
+        FRONT_END_GENERAL_CHECK(desc_size >= 0 && size - offset >= static_cast<size_t>(desc_size),
+                                "File containing constant with name ",
+                                name,
+                                " wasn't successfully read.");
+
+        ::paddle::framework::proto::VarType_TensorDesc tensor_desc;
+        tensor_desc.ParseFromArray(data + offset, desc_size);
+        offset += desc_size;
+        Shape shape(tensor_desc.dims().cbegin(), tensor_desc.dims().cend());
+        const auto& type = get_ov_type(tensor_desc.data_type());
+        const auto& data_length = shape_size(shape) * type.size();
+        FRONT_END_GENERAL_CHECK(size - offset >= data_length,
+                                "File containing constant with name ",
+                                name,
+                                " wasn't successfully read.");
+
+        OPENVINO_SUPPRESS_DEPRECATED_START
+        auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+            const_cast<char*>(data + offset),
+            data_length,
+            weights);
+        auto const_node = std::make_shared<opset7::Constant>(type, shape, buffer);
+        OPENVINO_SUPPRESS_DEPRECATED_END
+        offset += data_length;
+        const_node->set_friendly_name(name);
+        m_tensor_values[name] = const_node;
+    }
+}
+
 /*
     1. path: is a directory, compatible with old PaddlePaddle API.
              read __model__ as model stream.
@@ -385,8 +477,8 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
     : m_fw_ptr{std::make_shared<ProgramDesc>()},
       m_input_model(input_model),
       m_telemetry(telemetry) {
-    std::ifstream weights_stream;
-    std::ifstream pb_stream(get_model_path<T>(path, &weights_stream).c_str(), std::ios::in | std::ifstream::binary);
+    std::basic_string<T> weights_file;
+    std::ifstream pb_stream(get_model_path<T>(path, &weights_file).c_str(), std::ios::in | std::ifstream::binary);
 
     FRONT_END_GENERAL_CHECK(pb_stream && pb_stream.is_open(), "Model file doesn't exist");
     FRONT_END_GENERAL_CHECK(m_fw_ptr->ParseFromIstream(&pb_stream), "Model can't be parsed");
@@ -400,7 +492,13 @@ InputModel::InputModelImpl::InputModelImpl(const std::basic_string<T>& path,
         "[Frontend]Only Support Paddle greater than 2.0.0, current version " + std::to_string(version));
     load_places();
     if (is_pdmodel(path)) {
-        load_consts(&weights_stream);
+        // Don't throw error if the weights file doesn't exist
+        // It may mean that model don't have constants
+        std::shared_ptr<ov::MappedMemory> weights;
+        if (ov::util::file_exists(weights_file)) {
+            weights = ov::load_mmap_object(weights_file);
+        }
+        load_consts(weights);
     } else {
         load_consts(path);
     }
@@ -4,6 +4,8 @@
 
 #include "checkpoint_v1_reader.hpp"
 
+#include <future>
+
 #include "checkpoint_utils.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/file_util.hpp"
@@ -51,49 +53,68 @@ void CheckpointV1Reader::initialize() {
     }
 
     m_variables_info_map.clear();
+    m_shards.clear();
+    m_shard_names.clear();
 
-    for (auto checkpoint_path : checkpoints_paths) {
-        // create ifstream for each shard
-        std::shared_ptr<std::ifstream> shard_stream =
-            std::make_shared<std::ifstream>(checkpoint_path, std::ifstream::in | std::ifstream::binary);
-        FRONT_END_GENERAL_CHECK(
-            shard_stream && shard_stream->is_open(),
-            "[TensorFlow Frontend] incorrect model: checkpoint file " + checkpoint_path + "does not exist");
-        const int32_t shard_ind = static_cast<int32_t>(m_shards.size());
-        m_shards.push_back(shard_stream);
-        m_shard_names.push_back(checkpoint_path);
-        std::string value;
-        find_entry(shard_stream, checkpoint_path, SAVED_TENSOR_SLICES_KEY, value);
+    // the shards are independent, so their tables of contents are read in parallel and merged in the order of the
+    // shards, the same as the sequential reading
+    using ShardVariables = std::vector<std::pair<std::string, VariableInfo>>;
+    std::vector<std::shared_ptr<std::ifstream>> shard_streams(checkpoints_paths.size());
+    std::vector<std::future<ShardVariables>> shard_variables;
+    for (size_t shard_ind = 0; shard_ind < checkpoints_paths.size(); ++shard_ind) {
+        shard_variables.push_back(std::async(std::launch::async, [&, shard_ind]() {
+            const auto& checkpoint_path = checkpoints_paths[shard_ind];
+            // create ifstream for each shard
+            std::shared_ptr<std::ifstream> shard_stream =
+                std::make_shared<std::ifstream>(checkpoint_path, std::ifstream::in | std::ifstream::binary);
+            FRONT_END_GENERAL_CHECK(
+                shard_stream && shard_stream->is_open(),
+                "[TensorFlow Frontend] incorrect model: checkpoint file " + checkpoint_path + "does not exist");
+            shard_streams[shard_ind] = shard_stream;
+            std::string value;
+            find_entry(shard_stream, checkpoint_path, SAVED_TENSOR_SLICES_KEY, value);
 
-        // parse empty index block
-        // This is only present at the first item of each checkpoint file and serves
-        // as a table of contents, listing all the tensor slices saved in this file.
-        ::tensorflow::SavedTensorSlices sts;
-        FRONT_END_GENERAL_CHECK(sts.ParseFromArray(value.data(), static_cast<int>(value.size())),
-                                "[TensorFlow Frontend] incorrect input checkpoint file or internal error: cannot parse "
-                                "SavedTensorSlices entry");
-        for (const auto& saved_slice_meta : sts.meta().tensor()) {
-            // parse shapes and types for variables
-            VariableInfo var_info;
-            var_info.shard_id = shard_ind;
-            auto variable_name = saved_slice_meta.name();  // original variable name (not encoded)
-            var_info.variable_shape = saved_slice_meta.shape();
-            var_info.variable_type = saved_slice_meta.type();
+            // parse empty index block
+            // This is only present at the first item of each checkpoint file and serves
+            // as a table of contents, listing all the tensor slices saved in this file.
+            ::tensorflow::SavedTensorSlices sts;
+            FRONT_END_GENERAL_CHECK(sts.ParseFromArray(value.data(), static_cast<int>(value.size())),
+                                    "[TensorFlow Frontend] incorrect input checkpoint file or internal error: cannot "
+                                    "parse SavedTensorSlices entry");
+            ShardVariables variables;
+            for (const auto& saved_slice_meta : sts.meta().tensor()) {
+                // parse shapes and types for variables
+                VariableInfo var_info;
+                var_info.shard_id = static_cast<int32_t>(shard_ind);
+                auto variable_name = saved_slice_meta.name();  // original variable name (not encoded)
+                var_info.variable_shape = saved_slice_meta.shape();
+                var_info.variable_type = saved_slice_meta.type();
 
-            // save starts and lenghts of slices for variable name encoding
-            for (const auto& slice : saved_slice_meta.slice()) {
-                // var_info.starts.push_back(slice.extent())
-                for (const auto& extent : slice.extent()) {
-                    var_info.starts.push_back(extent.start());
-                    if (extent.has_length()) {
-                        var_info.lenghts.push_back(extent.length());
-                    } else {
-                        var_info.lenghts.push_back(-1);
+                // save starts and lenghts of slices for variable name encoding
+                for (const auto& slice : saved_slice_meta.slice()) {
+                    for (const auto& extent : slice.extent()) {
+                        var_info.starts.push_back(extent.start());
+                        if (extent.has_length()) {
+                            var_info.lenghts.push_back(extent.length());
+                        } else {
+                            var_info.lenghts.push_back(-1);
+                        }
                     }
                 }
+                variables.emplace_back(variable_name, var_info);
             }
-            m_variables_info_map[variable_name] = var_info;
-        }
+            return variables;
+        }));
+    }
+
+    // wait for all the shards before rethrowing, as the tasks refer to the local data
+    for (auto& variables : shard_variables)
+        variables.wait();
+    for (size_t shard_ind = 0; shard_ind < checkpoints_paths.size(); ++shard_ind) {
+        for (auto& variable : shard_variables[shard_ind].get())
+            m_variables_info_map[variable.first] = std::move(variable.second);
+        m_shards.push_back(shard_streams[shard_ind]);
+        m_shard_names.push_back(checkpoints_paths[shard_ind]);
     }
 }
 
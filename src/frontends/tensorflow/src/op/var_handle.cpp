@@ -54,15 +54,15 @@ static std::shared_ptr<ov::Node> read_variable(std::shared_ptr<VariablesIndex> v
                 mapped_memory));
         OPENVINO_SUPPRESS_DEPRECATED_END
     } else {
-        std::vector<T> var_data;
-        var_data.resize(size);
         auto fs = var_index->get_data_file(entry.shard_id());
         if (!fs.get()) {
             TENSORFLOW_OP_VALIDATION(node, var_index, "[TensorFlow Frontend] Internal error: Cannot get shard file.");
         }
+        // the data is read into a tensor shared by the constant, without an intermediate copy
+        ov::Tensor var_data(ov_type, shape);
         fs->seekg(entry.offset(), std::ios::beg);
-        fs->read(reinterpret_cast<char*>(var_data.data()), entry.size());
-        return std::make_shared<Constant>(ov_type, shape, var_data);
+        fs->read(static_cast<char*>(var_data.data()), entry.size());
+        return std::make_shared<Constant>(var_data);
     }
 }
 
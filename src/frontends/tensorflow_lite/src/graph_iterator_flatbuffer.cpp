@@ -18,13 +18,15 @@ GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::wstring& path)
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
 GraphIteratorFlatBuffer::GraphIteratorFlatBuffer(const std::string& path) {
-    std::ifstream model_file(path, std::ios::binary | std::ios::in);
-    FRONT_END_GENERAL_CHECK(model_file && model_file.is_open(), "Model file does not exist: ", path);
-
-    m_data = {(std::istreambuf_iterator<char>(model_file)), std::istreambuf_iterator<char>()};
-    model_file.close();
+    // the model is mapped rather than read, so the constants refer to the file pages instead of the heap copies
+    try {
+        m_mapped_memory = ov::load_mmap_object(path);
+    } catch (const std::exception& ex) {
+        FRONT_END_GENERAL_CHECK(false, "Model file does not exist: ", path, ", ", ex.what());
+    }
+    FRONT_END_GENERAL_CHECK(m_mapped_memory->size() > 0, "Model file is empty: ", path);
 
-    m_model = tflite::GetModel(m_data.data());
+    m_model = tflite::GetModel(m_mapped_memory->data());
     auto sub_graphs = m_model->subgraphs();
     m_subgraphs = {sub_graphs->begin(), sub_graphs->end()};
     m_graph = m_subgraphs[0];
@@ -46,6 +48,7 @@ std::shared_ptr<GraphIteratorFlatBuffer> GraphIteratorFlatBuffer::get_subgraph(c
     FRONT_END_GENERAL_CHECK(m_subgraphs.size() > idx, "There is no subgraph with idx ", idx);
     auto iterator = std::make_shared<GraphIteratorFlatBuffer>();
     iterator->node_index = 0;
+    iterator->m_mapped_memory = m_mapped_memory;
     iterator->m_model = m_model;
     iterator->m_subgraphs = {};  // TODO: check if we need to pass all sub-graphs here (while in a while situation)
     iterator->m_graph = m_subgraphs[idx];
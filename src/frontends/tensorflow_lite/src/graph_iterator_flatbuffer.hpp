@@ -9,6 +9,7 @@
 #include "openvino/core/any.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
 #include "schema_generated.h"
 
 namespace ov {
@@ -23,7 +24,7 @@ struct TensorInfo {
 
 class GraphIteratorFlatBuffer {
     size_t node_index = 0;
-    std::vector<uint8_t> m_data;
+    std::shared_ptr<ov::MappedMemory> m_mapped_memory;
     std::vector<ov::Any> m_nodes;
     const tflite::Model* m_model{};
     std::vector<const tflite::SubGraph*> m_subgraphs;
@@ -62,6 +63,11 @@ public:
     /// Return Decoder for the current node that iterator points to
     std::shared_ptr<ov::frontend::tensorflow_lite::DecoderFlatBuffer> get_decoder() const;
 
+    /// \brief Returns the mapped model file, the constants share its memory
+    const std::shared_ptr<ov::MappedMemory>& get_mapped_memory() const {
+        return m_mapped_memory;
+    }
+
     /// \brief Returns the number of sub-graphs that can be enumerated with get_subgraph
     size_t get_subgraph_size() const;
 
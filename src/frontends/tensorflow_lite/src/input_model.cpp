@@ -7,6 +7,7 @@
 #include <iterator>
 #include <queue>
 
+#include "ngraph/runtime/shared_buffer.hpp"
 #include "openvino/frontend/exception.hpp"
 #include "openvino/opsets/opset10.hpp"
 #include "openvino/util/log.hpp"
@@ -19,6 +20,29 @@ namespace ov {
 namespace frontend {
 namespace tensorflow_lite {
 
+namespace {
+std::shared_ptr<ov::op::v0::Constant> create_constant(const ov::element::Type& type,
+                                                      const ov::Shape& shape,
+                                                      const void* data,
+                                                      const std::shared_ptr<ov::MappedMemory>& mapped_memory) {
+    if (!mapped_memory)
+        return ov::op::v0::Constant::create(type, shape, data);
+    // the constant shares the mapped model file, which it keeps alive
+    const auto size = (shape_size(shape) * type.bitwidth() + 7) >> 3;
+    const auto begin = static_cast<const char*>(data);
+    FRONT_END_GENERAL_CHECK(begin >= mapped_memory->data() &&
+                                begin + size <= mapped_memory->data() + mapped_memory->size(),
+                            "Constant data is out of the model file");
+    OPENVINO_SUPPRESS_DEPRECATED_START
+    auto buffer = std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<ov::MappedMemory>>>(
+        const_cast<char*>(begin),
+        size,
+        mapped_memory);
+    return std::make_shared<ov::op::v0::Constant>(type, shape, buffer);
+    OPENVINO_SUPPRESS_DEPRECATED_END
+}
+}  // namespace
+
 class InputModel::InputModelTFLiteImpl {
 public:
     InputModelTFLiteImpl(const GraphIteratorFlatBuffer::Ptr& graph_iterator,
@@ -110,9 +134,10 @@ void InputModel::InputModelTFLiteImpl::load_model() {
             if (m_tensor_places.count(name) == 0) {
                 m_tensor_places[name] = place;
                 if (auto data = place->get_data()) {
-                    auto constant = ov::op::v0::Constant::create(place->get_element_type(),
-                                                                 place->get_partial_shape().to_shape(),
-                                                                 data);
+                    auto constant = create_constant(place->get_element_type(),
+                                                    place->get_partial_shape().to_shape(),
+                                                    data,
+                                                    m_graph_iterator->get_mapped_memory());
                     constant->set_friendly_name(name);
                     m_tensor_values[name] = constant;
                 } else if (place->get_partial_shape() == PartialShape{0}) {  // empty constant
@@ -88,6 +88,52 @@ INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(SMALL_CORE_OFFSET);
  */
 INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_RUNTIME_CACHE_CAPACITY);
 
+/**
+ * @brief Enables concurrent execution of independent branches of the CPU execution graph inside a single infer request
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_PARALLEL_BRANCHES);
+
+/**
+ * @brief Defines how many dynamic shape execution plans (keyed by the input shapes) can be stored per CPU graph
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_EXEC_PLANS_CACHE_CAPACITY);
+
+/**
+ * @brief Defines how many models transformed up to the low precision transformations are kept by the CPU plugin, so the
+ * repeated compilations of the same model with the different runtime properties (streams, hints) skip these
+ * transformations. Zero (default) disables the cache
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_TRANSFORMED_MODELS_CACHE_CAPACITY);
+
+/**
+ * @brief Enables the process-wide CPU weights registry, so the compiled models share identical repacked weights
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_SHARE_WEIGHTS_ACROSS_MODELS);
+
+/**
+ * @brief Makes the graphs of all the streams of a CPU compiled model use one thread safe runtime (primitives) cache
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_SHARED_RUNTIME_CACHE);
+
+/**
+ * @brief Makes the CPU compiled models with the same streams configuration run on one process-wide streams executor,
+ * the requests of the models with a higher ov::hint::model_priority are taken by the shared streams first
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_SHARED_STREAMS_EXECUTOR);
+
+/**
+ * @brief Enables the Snippets tokenization of the dynamic shape elementwise subgraphs with the static innermost
+ * dimension, their kernels take the outer dimensions offsets at runtime and are reused for all the shapes
+ * @ingroup ie_dev_api_plugin_api
+ */
+INFERENCE_ENGINE_1_0_DEPRECATED DECLARE_CONFIG_KEY(CPU_DYNAMIC_SNIPPETS);
+
 /**
  * @brief Internal device id for particular device (like GPU.0, GPU.1 etc)
  */
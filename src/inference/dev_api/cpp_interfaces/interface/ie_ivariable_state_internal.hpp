@@ -53,6 +53,14 @@ public:
      */
     virtual Blob::CPtr GetState() const;
 
+    /**
+     * @brief Truncates the state along the axis keeping its first @p length elements.
+     * The default implementation copies the kept part of the state and sets it as the new state
+     * @param axis The axis to truncate, negative values count from the last dimension
+     * @param length The new length of the state along the axis
+     */
+    virtual void Truncate(int64_t axis, size_t length);
+
 protected:
     /**
      * @brief A default dtor
@@ -26,6 +26,8 @@
  */
 namespace ExecGraphInfoSerialization {
 
+using ov::exec_model_info::ESTIMATED_BYTES;
+using ov::exec_model_info::ESTIMATED_FLOPS;
 using ov::exec_model_info::EXECUTION_ORDER;
 using ov::exec_model_info::ExecutionNode;
 using ov::exec_model_info::IMPL_TYPE;
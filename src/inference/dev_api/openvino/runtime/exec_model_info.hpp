@@ -72,6 +72,20 @@ static const char LAYER_TYPE[] = "layerType";
  */
 static const char RUNTIME_PRECISION[] = "runtimePrecision";
 
+/**
+ * @ingroup ov_dev_exec_model
+ * @brief Used to get the estimated number of the arithmetic operations of the executable primitive.
+ * The value is computed from the shapes of the last inference, it is absent when the plugin can't estimate it.
+ */
+static const char ESTIMATED_FLOPS[] = "estimatedFlops";
+
+/**
+ * @ingroup ov_dev_exec_model
+ * @brief Used to get the estimated number of the bytes read and written by the executable primitive.
+ * The value is the size of the inputs and the outputs of the primitive in the last inference.
+ */
+static const char ESTIMATED_BYTES[] = "estimatedBytes";
+
 /**
  * @ingroup ov_dev_exec_model
  * @brief The Execution node which is used to represent node in execution graph.
@@ -85,6 +99,8 @@ static const char RUNTIME_PRECISION[] = "runtimePrecision";
  * - ExecGraphInfoSerialization::EXECUTION_ORDER
  * - ExecGraphInfoSerialization::LAYER_TYPE
  * - ExecGraphInfoSerialization::RUNTIME_PRECISION
+ * - ExecGraphInfoSerialization::ESTIMATED_FLOPS
+ * - ExecGraphInfoSerialization::ESTIMATED_BYTES
  */
 class OPENVINO_RUNTIME_API ExecutionNode : public ov::op::Op {
 public:
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <future>
 #include <memory>
 
@@ -37,6 +38,13 @@ namespace ov {
  */
 class OPENVINO_RUNTIME_API IAsyncInferRequest : public IInferRequest {
 public:
+    /**
+     * @brief Constructs the request with a single stage pipeline running the synchronous request
+     * @param request Synchronous inference request
+     * @param task_executor Executor running the inference stage
+     * @param callback_executor Executor running the user callback. If it is nullptr, the callback is called inline
+     * in the thread completing the last stage, which saves a task submission per request.
+     */
     IAsyncInferRequest(const std::shared_ptr<IInferRequest>& request,
                        const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                        const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor);
@@ -71,6 +79,19 @@ public:
      */
     virtual void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Sets the priority the stages of the next asynchronous inferences are queued with to the executors
+     * @param priority The priority relative to the other requests of the executor, the greater value is run first
+     */
+    virtual void set_priority(int priority);
+
+    /**
+     * @brief Sets the time an asynchronous inference may wait in the executor queue
+     * @param deadline The maximal time from start_async() to the start of the first stage, zero disables the limit.
+     * A request missing the deadline does not run and completes with ov::Cancelled exception.
+     */
+    virtual void set_deadline(const std::chrono::microseconds& deadline);
+
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
@@ -198,7 +219,7 @@ private:
     enum InferState { IDLE, BUSY, CANCELLED, STOP };
     using Futures = std::vector<std::shared_future<void>>;
     enum Stage_e : std::uint8_t { EXECUTOR, TASK };
-    InferState m_state = InferState::IDLE;
+    std::atomic<InferState> m_state{InferState::IDLE};  //!< Changed under m_mutex, but may be read without it
     Futures m_futures;
     std::promise<void> m_promise;
 
@@ -220,9 +241,7 @@ private:
                          const Pipeline::iterator itEndStage,
                          const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor = {});
 
-    ov::threading::Task make_next_stage_task(const Pipeline::iterator itStage,
-                                             const Pipeline::iterator itEndStage,
-                                             const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor);
+    ov::threading::Task make_next_stage_task(const Pipeline::iterator itStage);
 
     template <typename F>
     void infer_impl(const F& f) {
@@ -277,6 +296,16 @@ private:
         m_sync_callback_executor;  //!< Used to run post inference callback in synchronous pipline
     mutable std::mutex m_mutex;
     std::function<void(std::exception_ptr)> m_callback;
+
+    // The stages of the running pipeline only capture `this` and the stage iterator, which std::function keeps
+    // without an allocation, while the rest is set once per run by run_first_stage
+    Pipeline::iterator m_begin_stage;
+    Pipeline::iterator m_end_stage;
+    std::shared_ptr<ov::threading::ITaskExecutor> m_stage_callback_executor;
+    std::chrono::steady_clock::time_point m_deadline_time = std::chrono::steady_clock::time_point::max();
+
+    int m_priority = 0;
+    std::chrono::microseconds m_deadline{0};
 };
 
 }  // namespace ov
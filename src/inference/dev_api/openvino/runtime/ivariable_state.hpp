@@ -51,6 +51,15 @@ public:
      */
     virtual const ov::SoPtr<ov::ITensor>& get_state() const;
 
+    /**
+     * @brief Truncates the state along the axis keeping its first @p length elements.
+     * The default implementation copies the kept part of the state and sets it as the new state, the plugins may
+     * override it to truncate the state in place.
+     * @param axis The axis to truncate, negative values count from the last dimension
+     * @param length The new length of the state along the axis
+     */
+    virtual void truncate(int64_t axis, size_t length);
+
 protected:
     /**
      * @brief A default dtor
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the stream buffer over a shared read-only memory
+ * @file shared_stream_buffer.hpp
+ */
+
+#pragma once
+
+#include <memory>
+#include <streambuf>
+
+namespace ov {
+
+/**
+ * @brief Stream buffer reading a memory owned by another object, e.g. a memory mapped cache blob.
+ *
+ * The plugins importing a model may check whether `std::istream::rdbuf()` is a SharedStreamBuffer and reference
+ * the data at the current position instead of copying it, keeping the owner alive as long as the data is used.
+ */
+class SharedStreamBuffer : public std::streambuf {
+public:
+    SharedStreamBuffer(const char* data, size_t size, std::shared_ptr<void> owner)
+        : m_data(const_cast<char*>(data)),
+          m_size(size),
+          m_owner(std::move(owner)) {
+        setg(m_data, m_data, m_data + m_size);
+    }
+
+    /**
+     * @brief Returns pointer to the data at the current read position
+     */
+    const char* current() const {
+        return gptr();
+    }
+
+    /**
+     * @brief Returns the number of bytes after the current read position
+     */
+    size_t available() const {
+        return static_cast<size_t>(egptr() - gptr());
+    }
+
+    /**
+     * @brief Returns the object keeping the data alive
+     */
+    const std::shared_ptr<void>& get_owner() const {
+        return m_owner;
+    }
+
+protected:
+    pos_type seekoff(off_type off,
+                     std::ios_base::seekdir dir,
+                     std::ios_base::openmode which = std::ios_base::in) override {
+        if (!(which & std::ios_base::in))
+            return pos_type(off_type(-1));
+        off_type base = dir == std::ios_base::beg ? 0 : dir == std::ios_base::cur ? gptr() - eback() : off_type(m_size);
+        off_type pos = base + off;
+        if (pos < 0 || pos > off_type(m_size))
+            return pos_type(off_type(-1));
+        setg(m_data, m_data + pos, m_data + m_size);
+        return pos_type(pos);
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+
+private:
+    char* m_data;
+    size_t m_size;
+    std::shared_ptr<void> m_owner;
+};
+
+}  // namespace ov
@@ -11,6 +11,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "openvino/runtime/common.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -42,12 +43,36 @@ public:
 
     void execute(Task task) override;
 
+    /**
+     * @brief Queues the task ahead of the tasks of lower priorities, the tasks of the same priority are run in FIFO
+     * order. The run() method queues a task with the zero priority.
+     */
+    void run_with_priority(Task task, int priority) override;
+
     int get_stream_id() override;
 
     int get_numa_node_id() override;
 
     int get_socket_id() override;
 
+    /**
+     * @brief Returns the number of the tasks waiting in the queue for an idle stream
+     * @return The queue depth
+     */
+    size_t get_pending_tasks_number();
+
+    /**
+     * @brief Returns the number of the streams executing a task now
+     * @return The number of the busy streams
+     */
+    size_t get_busy_streams_number();
+
+    /**
+     * @brief Returns the number of the tasks executed by each stream thread so far
+     * @return The numbers of the executed tasks indexed by the stream id
+     */
+    std::vector<size_t> get_executed_tasks_numbers();
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
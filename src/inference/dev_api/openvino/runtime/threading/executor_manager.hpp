@@ -45,6 +45,22 @@ public:
     virtual std::shared_ptr<ov::threading::IStreamsExecutor> get_idle_cpu_streams_executor(
         const ov::threading::IStreamsExecutor::Config& config) = 0;
 
+    /**
+     * @brief Returns cpu streams executor shared by all the callers with the same config
+     *
+     * Unlike the idle executors, the shared one is returned even if it is in use, so the compiled models running
+     * side by side do not oversubscribe the cores with their own threads. The tasks queued by the returned executor
+     * are taken by the shared streams ahead of the tasks of lower priorities.
+     *
+     * @param config Streams executor config
+     * @param priority Priority of the tasks queued by the returned executor, the greater value is run first
+     *
+     * @return pointer to streams executor
+     */
+    virtual std::shared_ptr<ov::threading::IStreamsExecutor> get_shared_cpu_streams_executor(
+        const ov::threading::IStreamsExecutor::Config& config,
+        int priority) = 0;
+
     /**
      * @brief Allows to configure executor manager
      *
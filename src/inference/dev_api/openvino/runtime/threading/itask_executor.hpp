@@ -70,6 +70,14 @@ public:
      * @param tasks A vector of tasks to execute
      */
     virtual void run_and_wait(const std::vector<Task>& tasks);
+
+    /**
+     * @brief Execute ov::Task inside task executor context ahead of the queued tasks of lower priorities
+     *        Default run_with_priority() method implementation ignores the priority and calls run()
+     * @param task A task to start
+     * @param priority The task priority, the greater value is run first, run() uses zero
+     */
+    virtual void run_with_priority(Task task, int priority);
 };
 
 }  // namespace threading
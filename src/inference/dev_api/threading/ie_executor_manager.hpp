@@ -56,6 +56,9 @@ public:
     /// @private
     virtual IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) = 0;
 
+    /// @private
+    virtual IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config, int priority) = 0;
+
     /**
      * @cond
      */
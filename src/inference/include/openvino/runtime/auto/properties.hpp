@@ -28,5 +28,12 @@ static constexpr Property<bool> enable_startup_fallback{"ENABLE_STARTUP_FALLBACK
  * selected device
  */
 static constexpr Property<bool> enable_runtime_fallback{"ENABLE_RUNTIME_FALLBACK"};
+
+/**
+ * @brief auto/multi device setting that allocates the tensors of the infer requests in the host memory of the first
+ * candidate device having a remote context, e.g. USM host memory of iGPU, which is visible to the other devices, so
+ * the request is dispatched to any device without the copy of its tensors
+ */
+static constexpr Property<bool> shared_host_tensors{"SHARED_HOST_TENSORS"};
 }  // namespace intel_auto
 }  // namespace ov
\ No newline at end of file
@@ -0,0 +1,80 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief A header file for the OpenVINO Runtime model cache manager interface.
+ *
+ * @file openvino/runtime/cache_manager.hpp
+ */
+#pragma once
+
+#include <functional>
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace ov {
+
+/**
+ * @brief Interface of the storage for the compiled model blobs
+ *
+ * By default the OpenVINO Runtime keeps the blobs as files in ov::cache_dir. A custom implementation set by the
+ * ov::cache_manager property may keep them elsewhere, e.g. in an object store or a volume shared by several hosts.
+ * The entries are identified by the hash of the model, the device and the compilation properties, so the same id
+ * always refers to the same content. The calls for the same id are serialized within one ov::Core, but the
+ * implementation is responsible for the writers from other processes or hosts, e.g. by publishing an entry only
+ * after it is completely written.
+ * @ingroup ov_runtime_cpp_api
+ */
+class ICacheManager {
+public:
+    /**
+     * @brief Default destructor
+     */
+    virtual ~ICacheManager() = default;
+
+    /**
+     * @brief Function passing created output stream
+     *
+     */
+    using StreamWriter = std::function<void(std::ostream&)>;
+    /**
+     * @brief Callback when OpenVINO Runtime intends to write network to cache
+     *
+     * Client needs to call create std::ostream object and call writer(ostream)
+     * Otherwise, network will not be cached
+     *
+     * @param id Id of cache (hash of the network)
+     * @param writer Lambda function to be called when stream is created
+     */
+    virtual void write_cache_entry(const std::string& id, StreamWriter writer) = 0;
+
+    /**
+     * @brief Function passing created input stream
+     *
+     */
+    using StreamReader = std::function<void(std::istream&)>;
+    /**
+     * @brief Callback when OpenVINO Runtime intends to read network from cache
+     *
+     * Client needs to call create std::istream object and call reader(istream)
+     * Otherwise, network will not be read from cache and will be loaded as usual
+     *
+     * @param id Id of cache (hash of the network)
+     * @param enable_mmap Allows to read the entry through a ov::SharedStreamBuffer over the mapped memory
+     * @param reader Lambda function to be called when input stream is created
+     */
+    virtual void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) = 0;
+
+    /**
+     * @brief Callback when OpenVINO Runtime intends to remove cache entry
+     *
+     * Client needs to perform appropriate cleanup (e.g. delete a cache file)
+     *
+     * @param id Id of cache (hash of the network)
+     */
+    virtual void remove_cache_entry(const std::string& id) = 0;
+};
+
+}  // namespace ov
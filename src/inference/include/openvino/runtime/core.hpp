@@ -13,6 +13,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <vector>
 
 #include "openvino/core/extension.hpp"
@@ -184,6 +185,19 @@ public:
         return compile_model(model, device_name, AnyMap{std::forward<Properties>(properties)...});
     }
 
+    /**
+     * @brief Creates compiled models from several source model objects concurrently.
+     *
+     * The models are compiled by a number of threads bounded by the hardware concurrency and share the model cache.
+     * The items with the same model object, device name and properties are compiled once and get the same compiled
+     * model. If any compilation fails, the exception is thrown after all the compilations end.
+     * @param models Tuples of a model object acquired from Core::read_model, the name of a device to load it to and
+     * the properties relevant only for this load operation.
+     * @return Compiled models in the order of @p models.
+     */
+    std::vector<CompiledModel> compile_models(
+        const std::vector<std::tuple<std::shared_ptr<const ov::Model>, std::string, AnyMap>>& models);
+
     /**
      * @brief Reads and loads a compiled model from the IR/ONNX/PDPD file to the default OpenVINO device selected by the
      * AUTO plugin.
@@ -307,6 +307,22 @@ public:
      */
     void set_callback(std::function<void(std::exception_ptr)> callback);
 
+    /**
+     * @brief Sets the priority of the next asynchronous inferences among the requests sharing the device executors.
+     * @param priority Priority of the request, the greater value is run first. The default priority is zero.
+     * @note The priority orders the queued work of the plugins scheduling it by the streams executors, the other
+     * plugins ignore it.
+     */
+    void set_priority(int priority);
+
+    /**
+     * @brief Sets the time the next asynchronous inferences may wait in a queue before the execution.
+     * @param deadline Maximal duration from start_async() to the start of the inference, zero disables the limit.
+     * The request missing the deadline is not executed and completes with ov::Cancelled exception passed to the
+     * callback and thrown by wait().
+     */
+    void set_deadline(const std::chrono::microseconds deadline);
+
     /**
      * @brief Gets state control interface for the given infer request.
      *
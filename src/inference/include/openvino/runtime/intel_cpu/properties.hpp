@@ -63,5 +63,333 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
  */
 static constexpr Property<float> sparse_weights_decompression_rate{"CPU_SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @enum       WeightsNumaPlacement
+ * @brief      This enum contains definition of the placement policies of the weights memory on NUMA systems.
+ */
+enum class WeightsNumaPlacement {
+    REPLICATE = 0,   //!<  A copy of the weights is bound to the NUMA node of the streams using it.
+    INTERLEAVE = 1,  //!<  A single copy of the weights is interleaved across all the NUMA nodes.
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const WeightsNumaPlacement& placement) {
+    switch (placement) {
+    case WeightsNumaPlacement::REPLICATE:
+        return os << "REPLICATE";
+    case WeightsNumaPlacement::INTERLEAVE:
+        return os << "INTERLEAVE";
+    default:
+        OPENVINO_THROW("Unsupported weights NUMA placement!");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, WeightsNumaPlacement& placement) {
+    std::string str;
+    is >> str;
+    if (str == "REPLICATE") {
+        placement = WeightsNumaPlacement::REPLICATE;
+    } else if (str == "INTERLEAVE") {
+        placement = WeightsNumaPlacement::INTERLEAVE;
+    } else {
+        OPENVINO_THROW("Unsupported weights NUMA placement: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief This property defines how the weights memory is placed on NUMA systems.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * With REPLICATE placement (default) the weights are cached per socket and each copy is bound to the NUMA node of
+ * the streams using it, so no weights are read through the inter-socket link. INTERLEAVE placement keeps one copy
+ * of the weights spread across all the NUMA nodes, which saves memory at the cost of remote accesses.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::weights_numa_placement(ov::intel_cpu::WeightsNumaPlacement::INTERLEAVE));
+ * @endcode
+ */
+static constexpr Property<WeightsNumaPlacement> weights_numa_placement{"CPU_WEIGHTS_NUMA_PLACEMENT"};
+
+/**
+ * @brief Read-only property to get the size (in bytes) of the cached weights memory per NUMA node of a compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The keys are the NUMA node ids. In case of INTERLEAVE placement the memory is reported evenly split between the nodes.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> weights_memory_per_numa_node{
+    "CPU_WEIGHTS_MEMORY_PER_NUMA_NODE"};
+
+/**
+ * @brief Read-only property to get the runtime (primitives) cache statistics of a compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The map contains the "hits", "misses" and "evictions" counters accumulated over the graphs of all the streams.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the breakdown (in bytes) of the memory held by a compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The map contains the categories accumulated over the graphs of all the streams:
+ *  - "weights": the constants and the repacked weights owned by the graphs,
+ *  - "weights_cache": the weights shared by the streams, "weights_cache.shared" is the process wide registry
+ *    used by all the compiled models (if enabled),
+ *  - "activations": the intermediate tensors, "activations.peak" additionally includes the largest sizes of the
+ *    dynamic tensors observed by the inferences,
+ *  - "scratchpad": the temporary buffers of the primitives,
+ *  - "total" and "total.peak": the sums of the categories above,
+ *  - "nodes.<name>": the memory of each node (its weights, output tensors and temporary buffers), the tensors
+ *    reusing the memory of other tensors are accounted in each node.
+ * The primitives caches and the JIT code are not accounted.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> memory_statistics{
+    "CPU_MEMORY_STATISTICS"};
+
+/**
+ * @brief This property enables the recording of the per node execution timeline of the inferences
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The start/stop timestamps, the thread and the stream of each node execution are recorded, while the shape inference
+ * and the parameters preparation of the dynamic nodes are recorded as separate events.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::enable_exec_timeline(true));
+ * @endcode
+ */
+static constexpr Property<bool> enable_exec_timeline{"CPU_ENABLE_EXEC_TIMELINE"};
+
+/**
+ * @brief This property defines the number of the latest events kept by the execution timeline of each stream
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The older events are dropped. The default value is 65536, which is a few MB per stream.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::exec_timeline_capacity(1 << 20));
+ * @endcode
+ */
+static constexpr Property<uint64_t> exec_timeline_capacity{"CPU_EXEC_TIMELINE_CAPACITY"};
+
+/**
+ * @brief Read-only property to get the recorded execution timeline of a compiled model as the Chrome trace JSON
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The JSON can be opened in chrome://tracing or Perfetto UI, the streams are shown as processes.
+ * The timeline is empty unless ov::intel_cpu::enable_exec_timeline is set.
+ *
+ * @code
+ * std::ofstream("trace.json") << compiled_model.get_property(ov::intel_cpu::exec_timeline);
+ * @endcode
+ */
+static constexpr Property<std::string, PropertyMutability::RO> exec_timeline{"CPU_EXEC_TIMELINE"};
+
+/**
+ * @brief Read-only property to get the profile of the transformations applied to a compiled model as JSON
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The JSON is the ov::pass::PassProfiler one: the wall time, the number of the operations before and after each pass,
+ * with the nested passes and the matchers of the GraphRewrite passes as the children. The profile is empty unless
+ * ov::enable_profiling is set for the compilation.
+ *
+ * @code
+ * auto compiled_model = core.compile_model(model, "CPU", ov::enable_profiling(true));
+ * std::ofstream("transformations.json") << compiled_model.get_property(ov::intel_cpu::transformations_profile);
+ * @endcode
+ */
+static constexpr Property<std::string, PropertyMutability::RO> transformations_profile{"CPU_TRANSFORMATIONS_PROFILE"};
+
+/**
+ * @brief Read-only property to get the durations of the compilation stages of a compiled model in milliseconds
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The stages of a compiled model are:
+ *  - "transformations": the copy of the model, the common and the low precision transformations (or the restore of the
+ *    transformed model when it is cached by the plugin),
+ *  - "streams": the performance hints and the streams calculation,
+ *  - "cpu_transformations": the transformations following the low precision ones, the snippets tokenization and the
+ *    conversion to the CPU operations set,
+ * the stages of an imported model are:
+ *  - "cache_read": the deserialization of the model and the repacked weights,
+ *  - "streams": the streams calculation,
+ * followed by:
+ *  - "graph": the creation of the graphs of all the streams, with the stages of the slowest graph: "graph.replicate"
+ *    (the nodes creation), "graph.init" (the graph optimizations, the primitive descriptors and the edges),
+ *    "graph.allocate" and "graph.primitives" (the kernels creation and the constants execution, including the weights
+ *    reorders),
+ *  - "warmup": the primitives creation for ov::intel_cpu::warmup_shapes, if set.
+ * The reading of the model file is not included, it is measured by the caller.
+ */
+static constexpr Property<std::map<std::string, double>, PropertyMutability::RO> compilation_stages{
+    "CPU_COMPILATION_STAGES"};
+
+/**
+ * @brief This property defines the input shapes the dynamic shape primitives are prepared for at the model compilation
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The value is the ';' separated list of the shapes profiles, each profile lists the static shapes of the model inputs.
+ * The input name may be omitted for a single input model. The primitives created for the profiles are stored in the
+ * runtime cache, so the first inferences of these shapes do not spend time on the kernels compilation.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::warmup_shapes("input_ids[1,128],attention_mask[1,128];input_ids[1,512],attention_mask[1,512]"));
+ * @endcode
+ */
+static constexpr Property<std::string> warmup_shapes{"CPU_WARMUP_SHAPES"};
+
+/**
+ * @brief This property limits the capacity reserved in advance for the growing states (e.g. the KV caches) of the model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The state buffers grow geometrically, so appending to a state costs an amortized constant time. The value is the
+ * max length along the first dynamic dimension of a state the capacity is reserved for, while the longer states are
+ * still allocated on demand. Zero (default) means no limit.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::max_state_reserved_length(4096));
+ * @endcode
+ */
+static constexpr Property<uint64_t> max_state_reserved_length{"CPU_MAX_STATE_RESERVED_LENGTH"};
+
+/**
+ * @brief This property makes the states keep the tensors passed to ov::VariableState::set_state instead of copying them
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The infer request computes the state in place in the set tensor, so the states of many sessions served by a few
+ * infer requests are switched without copies, each session keeps its own state tensors. The tensor must have the
+ * state precision and a plain layout, it must not be used by another request at the same time. A state growing beyond
+ * the set tensor continues in a buffer of the request, so get_state returns the actual state. False by default.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::bind_state_tensors(true));
+ * @endcode
+ */
+static constexpr Property<bool> bind_state_tensors{"CPU_BIND_STATE_TENSORS"};
+
+/**
+ * @enum       HugePagesMode
+ * @brief      This enum contains definition of the huge pages usage modes for the CPU memory.
+ */
+enum class HugePagesMode {
+    DISABLED = 0,   //!<  The memory is allocated with the regular pages.
+    ADVISE = 1,     //!<  The memory is hinted to be backed with the transparent huge pages (madvise).
+    HUGETLBFS = 2,  //!<  The memory is allocated from the explicit huge pages pool, the transparent ones are used
+                    //!<  when the pool is exhausted.
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const HugePagesMode& mode) {
+    switch (mode) {
+    case HugePagesMode::DISABLED:
+        return os << "DISABLED";
+    case HugePagesMode::ADVISE:
+        return os << "ADVISE";
+    case HugePagesMode::HUGETLBFS:
+        return os << "HUGETLBFS";
+    default:
+        OPENVINO_THROW("Unsupported huge pages mode!");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, HugePagesMode& mode) {
+    std::string str;
+    is >> str;
+    if (str == "DISABLED") {
+        mode = HugePagesMode::DISABLED;
+    } else if (str == "ADVISE") {
+        mode = HugePagesMode::ADVISE;
+    } else if (str == "HUGETLBFS") {
+        mode = HugePagesMode::HUGETLBFS;
+    } else {
+        OPENVINO_THROW("Unsupported huge pages mode: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief This property defines whether the weights and the activations memory of a model is backed with the huge pages
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The huge pages reduce the TLB misses on the models with the large weights. The memory allocated at the model
+ * compilation (the weights, the constants and the intermediate tensors arena) is affected, the buffers smaller than
+ * a huge page are allocated as usual. When the huge pages are not available the regular pages are used silently,
+ * use ov::intel_cpu::huge_pages_memory_size to check the result. Only Linux is supported.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::huge_pages(ov::intel_cpu::HugePagesMode::ADVISE));
+ * @endcode
+ */
+static constexpr Property<HugePagesMode> huge_pages{"CPU_HUGE_PAGES"};
+
+/**
+ * @brief Read-only property to get the size (in bytes) of the CPU plugin memory actually backed with the huge pages
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The value is collected across all the compiled models of the process.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> huge_pages_memory_size{"CPU_HUGE_PAGES_MEMORY_SIZE"};
+
+/**
+ * @brief This property enables the splitting of a single inference request by the batch into the slices executed
+ * concurrently
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The layers which parallelize poorly over the batch (e.g. Softmax, TopK, the reference implementations) leave most
+ * of the cores of a single stream idle. When enabled, a model executed by a single stream (e.g. ov::hint::latency) is
+ * compiled for a part of the batch, the slices of the request run concurrently on the groups of the stream cores and
+ * write their outputs directly into the request tensors. Only the static models with the same batch (the outermost
+ * dimension) on all the inputs and the outputs are split, use ov::intel_cpu::batch_split_slices to check the result.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::batch_split(true));
+ * @endcode
+ */
+static constexpr Property<bool> batch_split{"CPU_BATCH_SPLIT"};
+
+/**
+ * @brief Read-only property to get the number of the slices a request of the compiled model is split into by the batch
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The value is 1 if the request is not split.
+ */
+static constexpr Property<uint32_t, PropertyMutability::RO> batch_split_slices{"CPU_BATCH_SPLIT_SLICES"};
+
+/**
+ * @brief This property enables the revision of the selected memory layouts to reduce the reorders between the layers
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The layouts are selected layer by layer looking at the producers only, so a layer may select a layout requiring
+ * reorders on all its outputs. When enabled, the layers switch to another layout of the same implementation while
+ * this decreases the total size of the reordered tensors. The speed of the implementation may differ between the
+ * layouts, so the property is disabled by default.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::minimize_reorders(true));
+ * @endcode
+ */
+static constexpr Property<bool> minimize_reorders{"CPU_MINIMIZE_REORDERS"};
+
+/**
+ * @brief This property defines the op types whose transcendental functions are computed by the faster approximations
+ * of a lower accuracy
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The value is the ',' separated list of the op types, the supported ones are:
+ *  - "Gelu": the erf based Gelu is computed by the tanh approximation
+ *  - "Erf": the lower degree rational approximation without the exponent is used (the absolute error is below 5e-4)
+ *
+ * The approximations are applied with ov::hint::ExecutionMode::PERFORMANCE only, the accurate ones are kept with
+ * ov::hint::ExecutionMode::ACCURACY. The list is empty by default.
+ *
+ * @code
+ * core.set_property(ov::intel_cpu::fast_math_ops("Gelu,Erf"));
+ * @endcode
+ */
+static constexpr Property<std::string> fast_math_ops{"CPU_FAST_MATH_OPS"};
+
 }  // namespace intel_cpu
 }  // namespace ov
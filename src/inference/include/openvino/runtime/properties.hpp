@@ -14,6 +14,7 @@
 #include <iomanip>
 #include <istream>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -21,6 +22,7 @@
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/cache_manager.hpp"
 #include "openvino/runtime/common.hpp"
 
 namespace ov {
@@ -462,6 +464,16 @@ static constexpr Property<std::shared_ptr<ov::Model>> model{"MODEL_PTR"};
  */
 static constexpr Property<bool, PropertyMutability::RW> allow_auto_batching{"ALLOW_AUTO_BATCHING"};
 
+/**
+ * @brief The tensor names of the model outputs read by the application.
+ *
+ * The other outputs and the operations computing only them are removed from the model before the compilation, so the
+ * compiled model has only the listed outputs. The property is accepted by all compile_model() overloads, the model
+ * given by a path or by a string is read by the core before the compilation.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<std::vector<std::string>, PropertyMutability::WO> consumed_outputs{"CONSUMED_OUTPUTS"};
+
 /**
  * @brief Enum to define possible execution mode hints
  * @ingroup ov_runtime_cpp_prop_api
@@ -612,6 +624,18 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief This property sets the storage of the compiled model blobs instead of the files in ov::cache_dir
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * The manager is set for the whole ov::Core and replaces the cache directory set before:
+ *
+ * @code
+ * core.set_property(ov::cache_manager(std::make_shared<MyObjectStoreCacheManager>()));
+ * @endcode
+ */
+static constexpr Property<std::shared_ptr<ICacheManager>> cache_manager{"CACHE_MANAGER"};
+
 /**
  * @brief Read-only property to notify user that compiled model was loaded from the cache
  * @ingroup ov_runtime_cpp_prop_api
@@ -657,6 +681,16 @@ static constexpr Property<uint32_t, PropertyMutability::RO> max_batch_size{"MAX_
  */
 static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_timeout{"AUTO_BATCH_TIMEOUT"};
 
+/**
+ * @brief Read-write property to set the latency target (in ms) of the requests collected by the auto-batching
+ *
+ * When set (non-zero), the auto-batching adapts the timeout to the arrival rate, so that the collection time plus the
+ * measured execution time of the batch stays within the target, and executes the partially collected batch on the
+ * timeout instead of executing the requests one by one. Zero (default) keeps the fixed ov::auto_batch_timeout.
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint32_t, PropertyMutability::RW> auto_batch_latency_slo{"AUTO_BATCH_LATENCY_SLO"};
+
 /**
  * @brief Read-only property to provide a hint for a range for number of async infer requests. If device supports
  * streams, the metric provides range for number of IRs per stream.
@@ -81,6 +81,15 @@ public:
      * @param state The current state to set.
      */
     void set_state(const Tensor& state);
+
+    /**
+     * @brief Truncates the state along the axis keeping its first elements, e.g. drops the rejected draft tokens
+     * from a KV-cache state in speculative decoding. The plugins supporting it update the state in place instead of
+     * copying the whole state as get_state() and set_state() do.
+     * @param axis The axis to truncate, negative values count from the last dimension.
+     * @param length The new length of the state along the axis, must not exceed the current one.
+     */
+    void truncate(int64_t axis, size_t length);
 };
 
 }  // namespace ov
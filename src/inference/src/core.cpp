@@ -4,6 +4,12 @@
 
 #include "openvino/runtime/core.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <map>
+#include <thread>
+
 #include "any_copy.hpp"
 #include "dev/converter_utils.hpp"
 #include "dev/core_impl.hpp"
@@ -116,6 +122,62 @@ CompiledModel Core::compile_model(const std::shared_ptr<const ov::Model>& model,
     });
 }
 
+std::vector<CompiledModel> Core::compile_models(
+    const std::vector<std::tuple<std::shared_ptr<const ov::Model>, std::string, AnyMap>>& models) {
+    // The identical items are compiled once
+    std::map<std::tuple<const ov::Model*, std::string, std::string>, size_t> unique_ids;
+    std::vector<size_t> item_to_unique(models.size());
+    std::vector<size_t> unique_to_item;
+    for (size_t i = 0; i < models.size(); i++) {
+        std::string config;
+        for (const auto& kvp : std::get<2>(models[i])) {
+            config += kvp.first + '=' + kvp.second.as<std::string>() + ';';
+        }
+        auto key = std::make_tuple(std::get<0>(models[i]).get(), std::get<1>(models[i]), config);
+        auto it = unique_ids.emplace(key, unique_to_item.size()).first;
+        if (it->second == unique_to_item.size())
+            unique_to_item.push_back(i);
+        item_to_unique[i] = it->second;
+    }
+
+    std::vector<ov::SoPtr<ov::ICompiledModel>> compiled(unique_to_item.size());
+    std::vector<std::exception_ptr> errors(unique_to_item.size());
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (size_t id = next++; id < unique_to_item.size(); id = next++) {
+            const auto& item = models[unique_to_item[id]];
+            try {
+                compiled[id] = _impl->compile_model(std::get<0>(item), std::get<1>(item), std::get<2>(item));
+            } catch (...) {
+                errors[id] = std::current_exception();
+            }
+        }
+    };
+    const size_t threads_num =
+        std::min<size_t>(unique_to_item.size(), std::max(1u, std::thread::hardware_concurrency()));
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < threads_num; i++) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (const auto& error : errors) {
+        if (error) {
+            OV_CORE_CALL_STATEMENT(std::rethrow_exception(error));
+        }
+    }
+    std::vector<CompiledModel> result;
+    result.reserve(models.size());
+    for (size_t i = 0; i < models.size(); i++) {
+        const auto& exec = compiled[item_to_unique[i]];
+        result.push_back(CompiledModel{exec._ptr, exec._so});
+    }
+    return result;
+}
+
 CompiledModel Core::compile_model(const std::string& model_path, const AnyMap& config) {
     return compile_model(model_path, ov::DEFAULT_DEVICE_NAME, config);
 }
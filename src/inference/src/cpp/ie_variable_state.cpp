@@ -92,4 +92,8 @@ void VariableState::set_state(const Tensor& state) {
     OV_VARIABLE_CALL_STATEMENT(_impl->set_state(get_tensor_impl(state)));
 }
 
+void VariableState::truncate(int64_t axis, size_t length) {
+    OV_VARIABLE_CALL_STATEMENT(_impl->truncate(axis, length));
+}
+
 }  // namespace ov
@@ -4,6 +4,8 @@
 
 #include <cpp_interfaces/interface/ie_ivariable_state_internal.hpp>
 
+#include "openvino/runtime/make_tensor.hpp"
+
 IE_SUPPRESS_DEPRECATED_START
 namespace InferenceEngine {
 IVariableStateInternal::IVariableStateInternal(const std::string& name_) : name{name_} {}
@@ -24,4 +26,27 @@ Blob::CPtr IVariableStateInternal::GetState() const {
     return state;
 }
 
+void IVariableStateInternal::Truncate(int64_t axis, size_t length) {
+    auto current = ov::make_tensor(std::const_pointer_cast<Blob>(GetState()));
+    const auto& shape = current->get_shape();
+    const auto rank = static_cast<int64_t>(shape.size());
+    if (axis < -rank || axis >= rank)
+        IE_THROW() << "Can't truncate the state " << GetName() << ": the axis " << axis
+                   << " is out of the state rank " << rank;
+    const auto normAxis = static_cast<size_t>(axis < 0 ? axis + rank : axis);
+    if (length > shape[normAxis])
+        IE_THROW() << "Can't truncate the state " << GetName() << " of the shape " << shape << " to the length "
+                   << length << " along the axis " << axis;
+    if (length == shape[normAxis])
+        return;
+
+    ov::Coordinate begin(shape.size(), 0);
+    ov::Coordinate end(shape);
+    end[normAxis] = length;
+    auto kept = ov::make_tensor(current._ptr, begin, end);
+    auto truncated = ov::make_tensor(current->get_element_type(), kept->get_shape());
+    kept->copy_to(truncated);
+    SetState(ov::tensor_to_blob({truncated, nullptr}));
+}
+
 }  // namespace InferenceEngine
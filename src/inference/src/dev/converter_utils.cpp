@@ -221,6 +221,10 @@ public:
     InferenceEngine::Blob::CPtr GetState() const override {
         return tensor_to_blob(m_state->get_state());
     }
+
+    void Truncate(int64_t axis, size_t length) override {
+        m_state->truncate(axis, length);
+    }
 };
 
 class IInferencePluginWrapper : public InferenceEngine::IInferencePlugin {
@@ -671,6 +675,10 @@ public:
 
         return m_converted_state;
     }
+
+    void truncate(int64_t axis, size_t length) override {
+        m_state->Truncate(axis, length);
+    }
 };
 
 class IAsyncInferRequestWrapper : public ov::IAsyncInferRequest {
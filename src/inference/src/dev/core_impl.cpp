@@ -5,6 +5,7 @@
 #include "core_impl.hpp"
 
 #include <memory>
+#include <unordered_set>
 
 #include "check_network_batchable.hpp"
 #include "compilation_context.hpp"
@@ -250,6 +251,37 @@ bool ov::is_config_applicable(const std::string& user_device_name, const std::st
     return false;
 }
 
+std::shared_ptr<const ov::Model> ov::remove_unconsumed_outputs(const std::shared_ptr<const ov::Model>& model,
+                                                               const std::vector<std::string>& consumed_outputs) {
+    const std::unordered_set<std::string> names(consumed_outputs.begin(), consumed_outputs.end());
+    std::unordered_set<std::string> found_names;
+    std::vector<size_t> unconsumed;
+    const auto& results = model->get_results();
+    for (size_t i = 0; i < results.size(); ++i) {
+        bool consumed = false;
+        for (const auto& name : results[i]->get_output_tensor(0).get_names()) {
+            if (names.count(name)) {
+                consumed = true;
+                found_names.insert(name);
+            }
+        }
+        if (!consumed)
+            unconsumed.push_back(i);
+    }
+    for (const auto& name : names) {
+        OPENVINO_ASSERT(found_names.count(name), "The consumed output '", name, "' is not found in the model");
+    }
+    if (unconsumed.empty())
+        return model;
+
+    // the operations computing only the removed outputs are not reachable from the results anymore and released
+    auto pruned_model = model->clone();
+    const auto pruned_results = pruned_model->get_results();
+    for (const auto& i : unconsumed)
+        pruned_model->remove_result(pruned_results[i]);
+    return pruned_model;
+}
+
 ov::Parsed ov::parseDeviceNameIntoConfig(const std::string& deviceName,
                                          const AnyMap& config,
                                          const bool keep_core_property) {
@@ -740,8 +772,14 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::LoadTime, "Core::compile_model::model");
     std::string deviceName = device_name;
     ov::AnyMap config_with_batch = config;
+    auto model = model_;
+    auto consumed_outputs = config_with_batch.find(ov::hint::consumed_outputs.name());
+    if (consumed_outputs != config_with_batch.end()) {
+        model = remove_unconsumed_outputs(model, consumed_outputs->second.as<std::vector<std::string>>());
+        config_with_batch.erase(consumed_outputs);
+    }
     // if auto-batching is applicable, the below function will patch the device name and config accordingly:
-    auto model = apply_auto_batching(model_, deviceName, config_with_batch);
+    model = apply_auto_batching(model, deviceName, config_with_batch);
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, config_with_batch, is_proxy_device(device_name));
     auto plugin = get_plugin(parsed._deviceName);
@@ -749,7 +787,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     auto cacheManager = coreConfig.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
     // Skip caching for proxy plugin. HW plugin will load network from the cache
     if (cacheManager && device_supports_model_caching(plugin) && !is_proxy_device(plugin)) {
-        CacheContent cacheContent{cacheManager};
+        CacheContent cacheContent{cacheManager, coreConfig.get_enable_mmap()};
         cacheContent.blobId = ov::ModelCache::compute_hash(model, create_compile_config(plugin, parsed._config));
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
         res = load_model_from_cache(cacheContent, plugin, parsed._config, ov::SoPtr<ov::IRemoteContext>{}, [&]() {
@@ -773,8 +811,14 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
         OPENVINO_THROW("Remote context is null");
     std::string deviceName = context->get_device_name();
     ov::AnyMap config_with_batch = config;
+    auto model = model_;
+    auto consumed_outputs = config_with_batch.find(ov::hint::consumed_outputs.name());
+    if (consumed_outputs != config_with_batch.end()) {
+        model = remove_unconsumed_outputs(model, consumed_outputs->second.as<std::vector<std::string>>());
+        config_with_batch.erase(consumed_outputs);
+    }
     // if auto-batching is applicable, the below function will patch the device name and config accordingly:
-    auto model = apply_auto_batching(model_, deviceName, config_with_batch);
+    model = apply_auto_batching(model, deviceName, config_with_batch);
 
     auto parsed = parseDeviceNameIntoConfig(deviceName, config_with_batch, is_proxy_device(deviceName));
     auto plugin = get_plugin(parsed._deviceName);
@@ -782,7 +826,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
     auto cacheManager = coreConfig.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
     // Skip caching for proxy plugin. HW plugin will load network from the cache
     if (cacheManager && device_supports_model_caching(plugin) && !is_proxy_device(plugin)) {
-        CacheContent cacheContent{cacheManager};
+        CacheContent cacheContent{cacheManager, coreConfig.get_enable_mmap()};
         cacheContent.blobId = ov::ModelCache::compute_hash(model, create_compile_config(plugin, parsed._config));
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
         res = load_model_from_cache(cacheContent, plugin, parsed._config, context, [&]() {
@@ -819,6 +863,9 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
                                                           const std::string& device_name,
                                                           const ov::AnyMap& config) const {
     OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::LoadTime, "Core::compile_model::Path");
+    // the unconsumed outputs are removed from ov::Model, so the model is read here and not by the plugin
+    if (config.count(ov::hint::consumed_outputs.name()))
+        return compile_model(read_model(model_path, std::string{}), device_name, config);
     auto parsed = parseDeviceNameIntoConfig(device_name, config);
     // in case of compile_model(file_name), we need to clear-up core-level properties
     auto plugin = get_plugin(parsed._deviceName);
@@ -827,7 +874,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
     auto cacheManager = coreConfig.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
     // Skip caching for proxy plugin. HW plugin will load network from the cache
     if (cacheManager && device_supports_model_caching(plugin) && !is_proxy_device(plugin)) {
-        CacheContent cacheContent{cacheManager, model_path};
+        CacheContent cacheContent{cacheManager, coreConfig.get_enable_mmap(), model_path};
         cacheContent.blobId = ov::ModelCache::compute_hash(model_path, create_compile_config(plugin, parsed._config));
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
         compiled_model =
@@ -851,6 +898,9 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
                                                           const std::string& device_name,
                                                           const ov::AnyMap& config) const {
     OV_ITT_SCOPED_TASK(ov::itt::domains::OV, "Core::compile_model::from_memory");
+    // the unconsumed outputs are removed from ov::Model, so the model is read first
+    if (config.count(ov::hint::consumed_outputs.name()))
+        return compile_model(read_model(model_str, weights), device_name, config);
     auto parsed = parseDeviceNameIntoConfig(device_name, config);
     // in case of compile_model(file_name), we need to clear-up core-level properties
     auto plugin = get_plugin(parsed._deviceName);
@@ -859,7 +909,7 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
     auto cacheManager = coreConfig.get_cache_config_for_device(plugin, parsed._config)._cacheManager;
     // Skip caching for proxy plugin. HW plugin will load network from the cache
     if (cacheManager && device_supports_model_caching(plugin) && !is_proxy_device(plugin)) {
-        CacheContent cacheContent{cacheManager};
+        CacheContent cacheContent{cacheManager, coreConfig.get_enable_mmap()};
         cacheContent.blobId =
             ov::ModelCache::compute_hash(model_str, weights, create_compile_config(plugin, parsed._config));
         std::unique_ptr<CacheGuardEntry> lock = cacheGuard.get_hash_lock(cacheContent.blobId);
@@ -1001,10 +1051,12 @@ ov::AnyMap ov::CoreImpl::get_supported_property(const std::string& full_device_n
 
     static const std::vector<std::string> core_level_properties = {
         ov::cache_dir.name(),
+        ov::cache_manager.name(),
         ov::force_tbb_terminate.name(),
         // auto-batch properties are also treated as core-level
         ov::auto_batch_timeout.name(),
         ov::hint::allow_auto_batching.name(),
+        ov::hint::consumed_outputs.name(),
     };
 
     const auto flattened = ov::parseDeviceNameIntoConfig(full_device_name, user_properties, true);
@@ -1175,6 +1227,8 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
         return decltype(ov::force_tbb_terminate)::value_type(flag);
     } else if (name == ov::cache_dir.name()) {
         return ov::Any(coreConfig.get_cache_dir());
+    } else if (name == ov::cache_manager.name()) {
+        return ov::Any(coreConfig.get_cache_manager());
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = coreConfig.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
@@ -1447,31 +1501,35 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::load_model_from_cache(
 
     OPENVINO_ASSERT(cacheContent.cacheManager != nullptr);
     try {
-        cacheContent.cacheManager->read_cache_entry(cacheContent.blobId, [&](std::istream& networkStream) {
-            OV_ITT_SCOPE(FIRST_INFERENCE,
-                         ov::itt::domains::LoadTime,
-                         "Core::load_model_from_cache::ReadStreamAndImport");
-            try {
-                ov::CompiledBlobHeader header;
-                networkStream >> header;
-                if (header.getIeVersion() != ov::get_openvino_version().buildNumber) {
-                    // Build number mismatch, don't use this cache
-                    OPENVINO_THROW("Version does not match");
-                }
-                if (header.getFileInfo() != ov::ModelCache::calculate_file_info(cacheContent.modelPath)) {
-                    // Original file is changed, don't use cache
-                    OPENVINO_THROW("Original model file is changed");
+        cacheContent.cacheManager->read_cache_entry(
+            cacheContent.blobId,
+            cacheContent.mmap_enabled,
+            [&](std::istream& networkStream) {
+                OV_ITT_SCOPE(FIRST_INFERENCE,
+                             ov::itt::domains::LoadTime,
+                             "Core::load_model_from_cache::ReadStreamAndImport");
+                try {
+                    ov::CompiledBlobHeader header;
+                    networkStream >> header;
+                    if (header.getIeVersion() != ov::get_openvino_version().buildNumber) {
+                        // Build number mismatch, don't use this cache
+                        OPENVINO_THROW("Version does not match");
+                    }
+                    if (header.getFileInfo() != ov::ModelCache::calculate_file_info(cacheContent.modelPath)) {
+                        // Original file is changed, don't use cache
+                        OPENVINO_THROW("Original model file is changed");
+                    }
+                } catch (...) {
+                    throw HeaderException();
                 }
-            } catch (...) {
-                throw HeaderException();
-            }
 
-            compiled_model = context ? plugin.import_model(networkStream, context, config)
-                                     : plugin.import_model(networkStream, config);
-            if (auto wrapper = std::dynamic_pointer_cast<InferenceEngine::ICompiledModelWrapper>(compiled_model._ptr)) {
-                wrapper->get_executable_network()->loadedFromCache();
-            }
-        });
+                compiled_model = context ? plugin.import_model(networkStream, context, config)
+                                         : plugin.import_model(networkStream, config);
+                if (auto wrapper =
+                        std::dynamic_pointer_cast<InferenceEngine::ICompiledModelWrapper>(compiled_model._ptr)) {
+                    wrapper->get_executable_network()->loadedFromCache();
+                }
+            });
     } catch (const HeaderException&) {
         // For these exceptions just remove old cache and set that import didn't work
         cacheContent.cacheManager->remove_cache_entry(cacheContent.blobId);
@@ -1557,6 +1615,17 @@ void ov::CoreImpl::CoreConfig::set_and_update(ov::AnyMap& config) {
         config.erase(it);
     }
 
+    it = config.find(ov::cache_manager.name());
+    if (it != config.end()) {
+        std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+        // the user manager serves all the devices and has no cache directory
+        _cacheConfig = {std::string{}, it->second.as<std::shared_ptr<ov::ICacheManager>>()};
+        for (auto& deviceCfg : _cacheConfigPerDevice) {
+            deviceCfg.second = _cacheConfig;
+        }
+        config.erase(it);
+    }
+
     it = config.find(ov::force_tbb_terminate.name());
     if (it != config.end()) {
         auto flag = it->second.as<std::string>() == CONFIG_VALUE(YES) ? true : false;
@@ -1582,6 +1651,11 @@ std::string ov::CoreImpl::CoreConfig::get_cache_dir() const {
     return _cacheConfig._cacheDir;
 }
 
+std::shared_ptr<ov::ICacheManager> ov::CoreImpl::CoreConfig::get_cache_manager() const {
+    std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+    return _cacheConfig._cacheManager;
+}
+
 bool ov::CoreImpl::CoreConfig::get_enable_mmap() const {
     return _flag_enable_mmap;
 }
@@ -54,6 +54,15 @@ bool is_config_applicable(const std::string& device_name, const std::string& dev
 
 std::string find_plugins_xml(const std::string& xmlFile);
 
+/**
+ * @brief Removes the outputs not listed in ov::hint::consumed_outputs and the operations computing only them
+ * @param model The original model, it is not changed
+ * @param consumed_outputs The tensor names of the outputs to keep
+ * @return The original model if all its outputs are consumed, otherwise the pruned copy
+ */
+std::shared_ptr<const ov::Model> remove_unconsumed_outputs(const std::shared_ptr<const ov::Model>& model,
+                                                           const std::vector<std::string>& consumed_outputs);
+
 class CoreImpl : public InferenceEngine::ICore, public std::enable_shared_from_this<InferenceEngine::ICore> {
 private:
     mutable std::map<std::string, ov::Plugin> plugins;
@@ -89,6 +98,8 @@ private:
 
         std::string get_cache_dir() const;
 
+        std::shared_ptr<ov::ICacheManager> get_cache_manager() const;
+
         bool get_enable_mmap() const;
 
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
@@ -104,10 +115,13 @@ private:
 
     struct CacheContent {
         explicit CacheContent(const std::shared_ptr<ov::ICacheManager>& cache_manager,
+                              bool mmap_enabled = false,
                               const std::string model_path = {})
             : cacheManager(cache_manager),
+              mmap_enabled(mmap_enabled),
               modelPath(model_path) {}
         std::shared_ptr<ov::ICacheManager> cacheManager;
+        bool mmap_enabled = false;
         std::string blobId = {};
         std::string modelPath = {};
     };
@@ -91,10 +91,8 @@ bool ov::IAsyncInferRequest::wait_for(const std::chrono::milliseconds& timeout)
 }
 
 void ov::IAsyncInferRequest::cancel() {
-    std::lock_guard<std::mutex> lock{m_mutex};
-    if (m_state == InferState::BUSY) {
-        m_state = InferState::CANCELLED;
-    }
+    auto state = InferState::BUSY;
+    m_state.compare_exchange_strong(state, InferState::CANCELLED);
 }
 
 void ov::IAsyncInferRequest::set_callback(std::function<void(std::exception_ptr)> callback) {
@@ -102,6 +100,17 @@ void ov::IAsyncInferRequest::set_callback(std::function<void(std::exception_ptr)
     m_callback = std::move(callback);
 }
 
+void ov::IAsyncInferRequest::set_priority(int priority) {
+    check_state();
+    m_priority = priority;
+}
+
+void ov::IAsyncInferRequest::set_deadline(const std::chrono::microseconds& deadline) {
+    OPENVINO_ASSERT(deadline >= std::chrono::microseconds{0}, "Deadline can't be less than 0 for InferRequest.");
+    check_state();
+    m_deadline = deadline;
+}
+
 std::vector<ov::SoPtr<ov::IVariableState>> ov::IAsyncInferRequest::query_state() const {
     check_state();
     return m_sync_request->query_state();
@@ -120,78 +129,86 @@ void ov::IAsyncInferRequest::run_first_stage(const Pipeline::iterator itBeginSta
                                              const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
     auto& firstStageExecutor = std::get<Stage_e::EXECUTOR>(*itBeginStage);
     OPENVINO_ASSERT(nullptr != firstStageExecutor);
-    firstStageExecutor->run(make_next_stage_task(itBeginStage, itEndStage, std::move(callbackExecutor)));
+    // Only one pipeline runs at a time, so the members are not changed until the last stage sets the IDLE state
+    m_begin_stage = itBeginStage;
+    m_end_stage = itEndStage;
+    m_stage_callback_executor = std::move(callbackExecutor);
+    firstStageExecutor->run_with_priority(make_next_stage_task(itBeginStage), m_priority);
 }
 
-ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(
-    const Pipeline::iterator itStage,
-    const Pipeline::iterator itEndStage,
-    const std::shared_ptr<ov::threading::ITaskExecutor> callbackExecutor) {
-    return std::bind(
-        [this, itStage, itEndStage](std::shared_ptr<ov::threading::ITaskExecutor>& callbackExecutor) mutable {
-            std::exception_ptr currentException = nullptr;
-            auto& thisStage = *itStage;
-            auto itNextStage = itStage + 1;
-            try {
-                auto& stageTask = std::get<Stage_e::TASK>(thisStage);
-                OPENVINO_ASSERT(nullptr != stageTask);
-                stageTask();
-                if (itEndStage != itNextStage) {
-                    auto& nextStage = *itNextStage;
-                    auto& nextStageExecutor = std::get<Stage_e::EXECUTOR>(nextStage);
-                    OPENVINO_ASSERT(nullptr != nextStageExecutor);
-                    nextStageExecutor->run(make_next_stage_task(itNextStage, itEndStage, std::move(callbackExecutor)));
-                }
-            } catch (...) {
-                currentException = std::current_exception();
+ov::threading::Task ov::IAsyncInferRequest::make_next_stage_task(const Pipeline::iterator itStage) {
+    return [this, itStage] {
+        std::exception_ptr currentException = nullptr;
+        auto& thisStage = *itStage;
+        auto itNextStage = itStage + 1;
+        // Read before the next stage is submitted as the next run may reset them as soon as this one completes
+        const bool isLastStage = m_end_stage == itNextStage;
+        // a copy, so the executor outlives its run() even if the next start_async() replaces it
+        auto callbackExecutor = m_stage_callback_executor;
+        try {
+            // the request missing the deadline in the queue is dropped before it takes any resources
+            if (itStage == m_begin_stage && m_deadline_time != std::chrono::steady_clock::time_point::max() &&
+                std::chrono::steady_clock::now() > m_deadline_time)
+                ov::Cancelled::create("Infer Request missed the deadline");
+            auto& stageTask = std::get<Stage_e::TASK>(thisStage);
+            OPENVINO_ASSERT(nullptr != stageTask);
+            stageTask();
+            if (!isLastStage) {
+                auto& nextStage = *itNextStage;
+                auto& nextStageExecutor = std::get<Stage_e::EXECUTOR>(nextStage);
+                OPENVINO_ASSERT(nullptr != nextStageExecutor);
+                nextStageExecutor->run_with_priority(make_next_stage_task(itNextStage), m_priority);
             }
+        } catch (...) {
+            currentException = std::current_exception();
+        }
 
-            if ((itEndStage == itNextStage) || (nullptr != currentException)) {
-                auto lastStageTask = [this, currentException]() mutable {
-                    auto promise = std::move(m_promise);
-                    std::function<void(std::exception_ptr)> callback;
-                    {
-                        std::lock_guard<std::mutex> lock{m_mutex};
-                        m_state = InferState::IDLE;
-                        std::swap(callback, m_callback);
-                    }
-                    if (callback) {
-                        try {
-                            callback(currentException);
-                        } catch (...) {
-                            currentException = std::current_exception();
-                        }
-                        std::lock_guard<std::mutex> lock{m_mutex};
-                        if (!m_callback) {
-                            std::swap(callback, m_callback);
-                        }
+        if (isLastStage || (nullptr != currentException)) {
+            auto lastStageTask = [this, currentException]() mutable {
+                auto promise = std::move(m_promise);
+                std::function<void(std::exception_ptr)> callback;
+                {
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    m_state = InferState::IDLE;
+                    std::swap(callback, m_callback);
+                }
+                if (callback) {
+                    try {
+                        callback(currentException);
+                    } catch (...) {
+                        currentException = std::current_exception();
                     }
-                    if (nullptr == currentException) {
-                        promise.set_value();
-                    } else {
-                        promise.set_exception(currentException);
+                    std::lock_guard<std::mutex> lock{m_mutex};
+                    if (!m_callback) {
+                        std::swap(callback, m_callback);
                     }
-                };
-
-                if (nullptr == callbackExecutor) {
-                    lastStageTask();
+                }
+                if (nullptr == currentException) {
+                    promise.set_value();
                 } else {
-                    callbackExecutor->run(std::move(lastStageTask));
+                    promise.set_exception(currentException);
                 }
+            };
+
+            if (nullptr == callbackExecutor) {
+                lastStageTask();
+            } else {
+                callbackExecutor->run(std::move(lastStageTask));
             }
-        },
-        std::move(callbackExecutor));
+        }
+    };
 }
 
 void ov::IAsyncInferRequest::start_async() {
     infer_impl([&] {
+        m_deadline_time = m_deadline.count() ? std::chrono::steady_clock::now() + m_deadline
+                                             : std::chrono::steady_clock::time_point::max();
         start_async_thread_unsafe();
     });
 }
 
 void ov::IAsyncInferRequest::check_state() const {
-    std::lock_guard<std::mutex> lock{m_mutex};
-    switch (m_state) {
+    switch (m_state.load()) {
     case InferState::BUSY:
         ov::Busy::create("Infer Request is busy");
     case InferState::CANCELLED:
@@ -202,7 +219,6 @@ void ov::IAsyncInferRequest::check_state() const {
 }
 
 void ov::IAsyncInferRequest::check_cancelled_state() const {
-    std::lock_guard<std::mutex> lock{m_mutex};
     if (m_state == InferState::CANCELLED)
         ov::Cancelled::create("Infer Request was canceled");
 }
@@ -257,6 +273,7 @@ void ov::IAsyncInferRequest::stop_and_wait() {
 void ov::IAsyncInferRequest::infer() {
     DisableCallbackGuard disableCallbackGuard{this};
     infer_impl([&] {
+        m_deadline_time = std::chrono::steady_clock::time_point::max();
         infer_thread_unsafe();
     });
     wait();
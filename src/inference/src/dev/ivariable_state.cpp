@@ -5,6 +5,7 @@
 #include "openvino/runtime/ivariable_state.hpp"
 
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/make_tensor.hpp"
 
 ov::IVariableState::IVariableState(const std::string& name) : m_name(name) {}
 
@@ -25,3 +26,25 @@ void ov::IVariableState::set_state(const ov::SoPtr<ov::ITensor>& state) {
 const ov::SoPtr<ov::ITensor>& ov::IVariableState::get_state() const {
     return m_state;
 }
+
+void ov::IVariableState::truncate(int64_t axis, size_t length) {
+    auto state = get_state();
+    const auto& shape = state->get_shape();
+    const auto rank = static_cast<int64_t>(shape.size());
+    OPENVINO_ASSERT(axis >= -rank && axis < rank,
+                    "Can't truncate the state ", get_name(), ": the axis ", axis, " is out of the state rank ", rank);
+    const auto norm_axis = static_cast<size_t>(axis < 0 ? axis + rank : axis);
+    OPENVINO_ASSERT(length <= shape[norm_axis],
+                    "Can't truncate the state ", get_name(), " of the shape ", shape, " to the length ", length,
+                    " along the axis ", axis);
+    if (length == shape[norm_axis])
+        return;
+
+    ov::Coordinate begin(shape.size(), 0);
+    ov::Coordinate end(shape);
+    end[norm_axis] = length;
+    auto kept = ov::make_tensor(state._ptr, begin, end);
+    auto truncated = ov::make_tensor(state->get_element_type(), kept->get_shape());
+    kept->copy_to(truncated);
+    set_state({truncated, nullptr});
+}
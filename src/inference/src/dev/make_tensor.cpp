@@ -181,18 +181,20 @@ public:
                          OPENVINO_ASSERT(allocator, "Allocator was not initialized");
                          return const_cast<Allocator&>(allocator).allocate(element_type.size() * shape_size(shape));
                      }()},
-          m_allocator{allocator} {}
+          m_allocator{allocator},
+          m_bytes_allocated{get_byte_size()} {}
 
     ~AllocatedTensor() {
-        m_allocator.deallocate(m_ptr, get_byte_size());
+        m_allocator.deallocate(m_ptr, m_bytes_allocated);
     }
 
     void set_shape(ov::Shape new_shape) override {
-        auto old_byte_size = get_byte_size();
         m_shape = std::move(new_shape);
-        if (get_byte_size() > old_byte_size) {
-            m_allocator.deallocate(m_ptr, old_byte_size);
+        // the memory is kept when the shape shrinks, so it is reallocated only if the shape outgrows the allocation
+        if (get_byte_size() > m_bytes_allocated) {
+            m_allocator.deallocate(m_ptr, m_bytes_allocated);
             m_ptr = m_allocator.allocate(get_byte_size());
+            m_bytes_allocated = get_byte_size();
         }
         m_strides.clear();
         update_strides();
@@ -200,6 +202,7 @@ public:
 
 private:
     Allocator m_allocator;
+    size_t m_bytes_allocated;
 };
 
 /**
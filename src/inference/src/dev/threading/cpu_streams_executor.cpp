@@ -4,7 +4,11 @@
 
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 
+#include <algorithm>
+#include <atomic>
 #include <condition_variable>
+#include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <queue>
@@ -432,6 +436,7 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        _executedTasks.reset(new std::atomic<size_t>[_config._streams]());
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
@@ -440,15 +445,25 @@ struct CPUStreamsExecutor::Impl {
                     {
                         std::unique_lock<std::mutex> lock(_mutex);
                         _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
+                            return _pendingTasks != 0 || (stopped = _isStopped);
                         });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
+                        if (_pendingTasks != 0) {
+                            // the queues of the seen priorities are kept, so there are few of them to look through
+                            auto queue = std::find_if(_taskQueues.begin(),
+                                                      _taskQueues.end(),
+                                                      [](const TaskQueues::value_type& it) {
+                                                          return !it.second.empty();
+                                                      });
+                            task = std::move(queue->second.front());
+                            queue->second.pop();
+                            --_pendingTasks;
                         }
                     }
                     if (task) {
+                        ++_busyStreams;
                         Execute(task, *(_streams.local()));
+                        ++_executedTasks[streamId];
+                        --_busyStreams;
                     }
                 }
             });
@@ -456,10 +471,11 @@ struct CPUStreamsExecutor::Impl {
         _streams.set_thread_ids_map(_threads);
     }
 
-    void Enqueue(Task task) {
+    void Enqueue(Task task, int priority) {
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+            _taskQueues[priority].emplace(std::move(task));
+            ++_pendingTasks;
         }
         _queueCondVar.notify_one();
     }
@@ -500,8 +516,13 @@ struct CPUStreamsExecutor::Impl {
     std::vector<std::thread> _threads;
     std::mutex _mutex;
     std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
+    // the tasks of a higher priority are taken first, the tasks of the same priority are taken in FIFO order
+    using TaskQueues = std::map<int, std::queue<Task>, std::greater<int>>;
+    TaskQueues _taskQueues;
+    size_t _pendingTasks = 0;
     bool _isStopped = false;
+    std::atomic<size_t> _busyStreams{0};
+    std::unique_ptr<std::atomic<size_t>[]> _executedTasks;
     std::vector<int> _usedNumaNodes;
     CustomThreadLocal _streams;
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -531,6 +552,23 @@ int CPUStreamsExecutor::get_socket_id() {
     return stream->_socketId;
 }
 
+size_t CPUStreamsExecutor::get_pending_tasks_number() {
+    std::lock_guard<std::mutex> lock(_impl->_mutex);
+    return _impl->_pendingTasks;
+}
+
+size_t CPUStreamsExecutor::get_busy_streams_number() {
+    return _impl->_busyStreams;
+}
+
+std::vector<size_t> CPUStreamsExecutor::get_executed_tasks_numbers() {
+    std::vector<size_t> numbers(_impl->_threads.size());
+    for (size_t i = 0; i < numbers.size(); i++) {
+        numbers[i] = _impl->_executedTasks[i];
+    }
+    return numbers;
+}
+
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) : _impl{new Impl{config}} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
@@ -551,10 +589,14 @@ void CPUStreamsExecutor::execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    run_with_priority(std::move(task), 0);
+}
+
+void CPUStreamsExecutor::run_with_priority(Task task, int priority) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->Enqueue(std::move(task), priority);
     }
 }
 
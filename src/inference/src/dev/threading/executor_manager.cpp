@@ -15,6 +15,7 @@
 #    endif
 #endif
 
+#include <algorithm>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -29,6 +30,9 @@ public:
     std::shared_ptr<ov::threading::ITaskExecutor> get_executor(const std::string& id) override;
     std::shared_ptr<ov::threading::IStreamsExecutor> get_idle_cpu_streams_executor(
         const ov::threading::IStreamsExecutor::Config& config) override;
+    std::shared_ptr<ov::threading::IStreamsExecutor> get_shared_cpu_streams_executor(
+        const ov::threading::IStreamsExecutor::Config& config,
+        int priority) override;
     size_t get_executors_number() const override;
     size_t get_idle_cpu_streams_executors_number() const override;
     void clear(const std::string& id = {}) override;
@@ -41,6 +45,8 @@ private:
     std::unordered_map<std::string, std::shared_ptr<ov::threading::ITaskExecutor>> executors;
     std::vector<std::pair<ov::threading::IStreamsExecutor::Config, std::shared_ptr<ov::threading::IStreamsExecutor>>>
         cpuStreamsExecutors;
+    std::vector<std::pair<ov::threading::IStreamsExecutor::Config, std::shared_ptr<ov::threading::CPUStreamsExecutor>>>
+        sharedCpuStreamsExecutors;
     mutable std::mutex streamExecutorMutex;
     mutable std::mutex taskExecutorMutex;
     bool tbbTerminateFlag = false;
@@ -55,6 +61,47 @@ private:
 #endif
 };
 
+class PriorityStreamsExecutor : public ov::threading::IStreamsExecutor {
+public:
+    PriorityStreamsExecutor(const std::shared_ptr<ov::threading::CPUStreamsExecutor>& executor, int priority)
+        : m_executor(executor),
+          m_priority(priority) {}
+    void run(ov::threading::Task task) override {
+        m_executor->run_with_priority(std::move(task), m_priority);
+    }
+    // the priority of a task is relative to the priority of the executor
+    void run_with_priority(ov::threading::Task task, int priority) override {
+        m_executor->run_with_priority(std::move(task), m_priority + priority);
+    }
+    void execute(ov::threading::Task task) override {
+        m_executor->execute(std::move(task));
+    }
+    int get_stream_id() override {
+        return m_executor->get_stream_id();
+    }
+    int get_numa_node_id() override {
+        return m_executor->get_numa_node_id();
+    }
+    int get_socket_id() override {
+        return m_executor->get_socket_id();
+    }
+
+private:
+    std::shared_ptr<ov::threading::CPUStreamsExecutor> m_executor;
+    int m_priority;
+};
+
+bool is_same_streams_config(const ov::threading::IStreamsExecutor::Config& executorConfig,
+                            const ov::threading::IStreamsExecutor::Config& config) {
+    return executorConfig._name == config._name && executorConfig._streams == config._streams &&
+           executorConfig._threadsPerStream == config._threadsPerStream &&
+           executorConfig._threadBindingType == config._threadBindingType &&
+           executorConfig._threadBindingStep == config._threadBindingStep &&
+           executorConfig._threadBindingOffset == config._threadBindingOffset &&
+           (executorConfig._threadBindingType != ov::threading::IStreamsExecutor::ThreadBindingType::HYBRID_AWARE ||
+            executorConfig._threadPreferredCoreType == config._threadPreferredCoreType);
+}
+
 }  // namespace
 
 ExecutorManagerImpl::~ExecutorManagerImpl() {
@@ -131,15 +178,8 @@ std::shared_ptr<ov::threading::IStreamsExecutor> ExecutorManagerImpl::get_idle_c
         if (executor.use_count() != 1)
             continue;
 
-        const auto& executorConfig = it.first;
-        if (executorConfig._name == config._name && executorConfig._streams == config._streams &&
-            executorConfig._threadsPerStream == config._threadsPerStream &&
-            executorConfig._threadBindingType == config._threadBindingType &&
-            executorConfig._threadBindingStep == config._threadBindingStep &&
-            executorConfig._threadBindingOffset == config._threadBindingOffset)
-            if (executorConfig._threadBindingType != ov::threading::IStreamsExecutor::ThreadBindingType::HYBRID_AWARE ||
-                executorConfig._threadPreferredCoreType == config._threadPreferredCoreType)
-                return executor;
+        if (is_same_streams_config(it.first, config))
+            return executor;
     }
     auto newExec = std::make_shared<ov::threading::CPUStreamsExecutor>(config);
     tbbThreadsCreated = true;
@@ -147,6 +187,25 @@ std::shared_ptr<ov::threading::IStreamsExecutor> ExecutorManagerImpl::get_idle_c
     return newExec;
 }
 
+std::shared_ptr<ov::threading::IStreamsExecutor> ExecutorManagerImpl::get_shared_cpu_streams_executor(
+    const ov::threading::IStreamsExecutor::Config& config,
+    int priority) {
+    std::lock_guard<std::mutex> guard(streamExecutorMutex);
+    auto found = std::find_if(sharedCpuStreamsExecutors.begin(),
+                              sharedCpuStreamsExecutors.end(),
+                              [&](const std::pair<ov::threading::IStreamsExecutor::Config,
+                                                  std::shared_ptr<ov::threading::CPUStreamsExecutor>>& it) {
+                                  return is_same_streams_config(it.first, config);
+                              });
+    if (found == sharedCpuStreamsExecutors.end()) {
+        tbbThreadsCreated = true;
+        found = sharedCpuStreamsExecutors.emplace(found,
+                                                  config,
+                                                  std::make_shared<ov::threading::CPUStreamsExecutor>(config));
+    }
+    return std::make_shared<PriorityStreamsExecutor>(found->second, priority);
+}
+
 size_t ExecutorManagerImpl::get_executors_number() const {
     std::lock_guard<std::mutex> guard(taskExecutorMutex);
     return executors.size();
@@ -163,6 +222,7 @@ void ExecutorManagerImpl::clear(const std::string& id) {
     if (id.empty()) {
         executors.clear();
         cpuStreamsExecutors.clear();
+        sharedCpuStreamsExecutors.clear();
     } else {
         executors.erase(id);
         cpuStreamsExecutors.erase(
@@ -173,6 +233,14 @@ void ExecutorManagerImpl::clear(const std::string& id) {
                                return it.first._name == id;
                            }),
             cpuStreamsExecutors.end());
+        sharedCpuStreamsExecutors.erase(
+            std::remove_if(sharedCpuStreamsExecutors.begin(),
+                           sharedCpuStreamsExecutors.end(),
+                           [&](const std::pair<ov::threading::IStreamsExecutor::Config,
+                                               std::shared_ptr<ov::threading::CPUStreamsExecutor>>& it) {
+                               return it.first._name == id;
+                           }),
+            sharedCpuStreamsExecutors.end());
     }
 }
 
@@ -37,5 +37,9 @@ void ITaskExecutor::run_and_wait(const std::vector<Task>& tasks) {
     }
 }
 
+void ITaskExecutor::run_with_priority(Task task, int) {
+    run(std::move(task));
+}
+
 }  // namespace threading
 }  // namespace ov
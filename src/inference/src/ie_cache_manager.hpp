@@ -9,69 +9,23 @@
  */
 #pragma once
 
+#include <chrono>
+#include <cstdio>
 #include <fstream>
 #include <functional>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <thread>
 
 #include "file_utils.h"
 #include "ie_api.h"
+#include "openvino/runtime/cache_manager.hpp"
+#include "openvino/runtime/shared_stream_buffer.hpp"
+#include "openvino/util/mmap_object.hpp"
 
 namespace ov {
 
-/**
- * @brief This class represents private interface for Cache Manager
- *
- */
-class ICacheManager {
-public:
-    /**
-     * @brief Default destructor
-     */
-    virtual ~ICacheManager() = default;
-
-    /**
-     * @brief Function passing created output stream
-     *
-     */
-    using StreamWriter = std::function<void(std::ostream&)>;
-    /**
-     * @brief Callback when Inference Engine intends to write network to cache
-     *
-     * Client needs to call create std::ostream object and call writer(ostream)
-     * Otherwise, network will not be cached
-     *
-     * @param id Id of cache (hash of the network)
-     * @param writer Lambda function to be called when stream is created
-     */
-    virtual void write_cache_entry(const std::string& id, StreamWriter writer) = 0;
-
-    /**
-     * @brief Function passing created input stream
-     *
-     */
-    using StreamReader = std::function<void(std::istream&)>;
-    /**
-     * @brief Callback when Inference Engine intends to read network from cache
-     *
-     * Client needs to call create std::istream object and call reader(istream)
-     * Otherwise, network will not be read from cache and will be loaded as usual
-     *
-     * @param id Id of cache (hash of the network)
-     * @param reader Lambda function to be called when input stream is created
-     */
-    virtual void read_cache_entry(const std::string& id, StreamReader reader) = 0;
-
-    /**
-     * @brief Callback when Inference Engine intends to remove cache entry
-     *
-     * Client needs to perform appropriate cleanup (e.g. delete a cache file)
-     *
-     * @param id Id of cache (hash of the network)
-     */
-    virtual void remove_cache_entry(const std::string& id) = 0;
-};
-
 /**
  * @brief File storage-based Implementation of ICacheManager
  *
@@ -100,15 +54,40 @@ public:
 
 private:
     void write_cache_entry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
+        // The blob is written under a unique temporary name and renamed when complete, so the processes sharing
+        // the cache directory never read a partially written blob
+        const auto blobFileName = getBlobFile(id);
+        std::stringstream tmpSuffix;
+        tmpSuffix << ".tmp" << std::this_thread::get_id() << '_'
+                  << std::chrono::steady_clock::now().time_since_epoch().count();
+        const auto tmpFileName = blobFileName + tmpSuffix.str();
+        {
+            std::ofstream stream(tmpFileName, std::ios_base::binary | std::ofstream::out);
+            writer(stream);
+            if (!stream.good()) {
+                stream.close();
+                std::remove(tmpFileName.c_str());
+                return;
+            }
+        }
+        if (std::rename(tmpFileName.c_str(), blobFileName.c_str()) != 0)
+            std::remove(tmpFileName.c_str());
     }
 
-    void read_cache_entry(const std::string& id, StreamReader reader) override {
+    void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) override {
         auto blobFileName = getBlobFile(id);
         if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
+            if (enable_mmap) {
+                // The plugins may reference the mapped pages instead of copying them, and the page cache shares
+                // them between the processes importing the same blob
+                auto mapped_memory = ov::load_mmap_object(blobFileName);
+                ov::SharedStreamBuffer buffer(mapped_memory->data(), mapped_memory->size(), mapped_memory);
+                std::istream stream(&buffer);
+                reader(stream);
+            } else {
+                std::ifstream stream(blobFileName, std::ios_base::binary);
+                reader(stream);
+            }
         }
     }
 
@@ -277,6 +277,14 @@ void InferRequest::set_callback(std::function<void(std::exception_ptr)> callback
     OV_INFER_REQ_CALL_STATEMENT(_impl->set_callback(std::move(callback));)
 }
 
+void InferRequest::set_priority(int priority) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->set_priority(priority);)
+}
+
+void InferRequest::set_deadline(const std::chrono::microseconds deadline) {
+    OV_INFER_REQ_CALL_STATEMENT(_impl->set_deadline(deadline);)
+}
+
 std::vector<VariableState> InferRequest::query_state() {
     std::vector<VariableState> variable_states;
     OV_INFER_REQ_CALL_STATEMENT({
@@ -29,6 +29,8 @@ public:
     std::vector<std::vector<int>> _cpu_mapping_table;
     std::mutex _cpu_mutex;
     int _socket_idx = 0;
+    // the number of processors the CFS quota of the cgroup allows, -1 if not set or not enabled
+    int _cpu_quota = -1;
 };
 
 CPU& cpu_info();
@@ -106,6 +108,24 @@ void update_valid_processor_linux(const std::vector<int> phy_core_list,
                                   std::vector<std::vector<int>>& _proc_type_table,
                                   std::vector<std::vector<int>>& _cpu_mapping_table);
 
+/**
+ * @brief      Get the CFS quota of the cgroup of the process on Linux. The lowest quota of the cgroup v2 cpu.max or
+ *             the cgroup v1 cpu.cfs_quota_us and cpu.cfs_period_us from the cgroup of the process up to the root of
+ *             the hierarchy is taken.
+ * @param[in]  cgroup_root the mount point of the cgroup file systems, e.g. /sys/fs/cgroup
+ * @param[in]  self_cgroup the content of /proc/self/cgroup
+ * @return     the number of processors the quota lets run at the same time (rounded up), -1 if the quota is not set
+ */
+int get_cpu_quota_linux(const std::string& cgroup_root, const std::string& self_cgroup);
+
+/**
+ * @brief      Cap the number of processors in proc_type_table by the CPU quota, taking the physical cores first. The
+ *             CPU mapping table is not changed, so the streams may run on any processor of the process.
+ * @param[in]  cpu_quota the number of processors the quota allows, the table is not changed if not positive
+ * @param[in/out] _proc_type_table summary table of number of processors per type
+ */
+void apply_cpu_quota_linux(const int cpu_quota, std::vector<std::vector<int>>& _proc_type_table);
+
 /**
  * @brief      Get cpu_mapping_table from the number of processors, cores and numa nodes
  * @param[in]  _processors total number for processors in system.
@@ -6,8 +6,12 @@
 #include <string.h>
 #include <unistd.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
+#include <iterator>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -19,6 +23,32 @@
 
 namespace ov {
 
+// Returns the number of processors the CFS quota of the cgroup directory lets run at the same time (the cgroup v2
+// cpu.max or the cgroup v1 cpu.cfs_quota_us and cpu.cfs_period_us), or -1 when the quota is not set
+static int read_cpu_quota_linux(const std::string& cgroup_dir) {
+    long long quota = -1;
+    long long period = 0;
+    std::ifstream cpu_max(cgroup_dir + "/cpu.max");
+    if (cpu_max.is_open()) {
+        std::string quota_str;
+        cpu_max >> quota_str >> period;
+        if (!quota_str.empty() && quota_str != "max") {
+            quota = std::strtoll(quota_str.c_str(), nullptr, 10);
+        }
+    } else {
+        std::ifstream cfs_quota(cgroup_dir + "/cpu.cfs_quota_us");
+        std::ifstream cfs_period(cgroup_dir + "/cpu.cfs_period_us");
+        if (cfs_quota.is_open() && cfs_period.is_open()) {
+            cfs_quota >> quota;
+            cfs_period >> period;
+        }
+    }
+    if (quota <= 0 || period <= 0) {
+        return -1;
+    }
+    return static_cast<int>(std::max<long long>(1, (quota + period - 1) / period));
+}
+
 CPU::CPU() {
     std::vector<std::vector<std::string>> system_info_table;
     std::vector<std::string> node_info_table;
@@ -267,6 +297,98 @@ CPU::CPU() {
     if (check_valid_cpu() < 0) {
         OPENVINO_THROW("CPU affinity check failed. No CPU is eligible to run inference.");
     };
+
+    // The CFS quota of a container is opt-in, it caps the processors the streams and the threads are sized for
+    const char* use_cpu_quota = std::getenv("OV_CPU_USE_CGROUP_QUOTA");
+    if (use_cpu_quota && std::string(use_cpu_quota) != "0") {
+        std::ifstream self_cgroup_file("/proc/self/cgroup");
+        const std::string self_cgroup((std::istreambuf_iterator<char>(self_cgroup_file)),
+                                      std::istreambuf_iterator<char>());
+        _cpu_quota = get_cpu_quota_linux("/sys/fs/cgroup", self_cgroup);
+    }
+}
+
+int get_cpu_quota_linux(const std::string& cgroup_root, const std::string& self_cgroup) {
+    // The cgroup of the process is nested, e.g. /kubepods/pod/container, and the quota may be set on any level of
+    // the hierarchy, so the lowest quota from the cgroup of the process up to the root is taken
+    std::vector<std::string> cgroup_dirs;
+    std::istringstream lines(self_cgroup);
+    std::string line;
+    while (std::getline(lines, line)) {
+        // hierarchy-ID:controller-list:cgroup-path
+        const auto first = line.find(':');
+        const auto second = first == std::string::npos ? std::string::npos : line.find(':', first + 1);
+        if (second == std::string::npos) {
+            continue;
+        }
+        const std::string controllers = "," + line.substr(first + 1, second - first - 1) + ",";
+        std::string path = line.substr(second + 1);
+        if (controllers == ",,") {
+            cgroup_dirs.push_back(cgroup_root + path);
+        } else if (controllers.find(",cpu,") != std::string::npos) {
+            cgroup_dirs.push_back(cgroup_root + "/cpu" + path);
+            cgroup_dirs.push_back(cgroup_root + "/cpu,cpuacct" + path);
+        }
+    }
+    if (cgroup_dirs.empty()) {
+        cgroup_dirs = {cgroup_root, cgroup_root + "/cpu"};
+    }
+
+    int cpu_quota = -1;
+    for (auto dir : cgroup_dirs) {
+        while (true) {
+            const int level_quota = read_cpu_quota_linux(dir);
+            if (level_quota > 0 && (cpu_quota < 0 || level_quota < cpu_quota)) {
+                cpu_quota = level_quota;
+            }
+            const auto slash = dir.find_last_of('/');
+            if (dir.size() <= cgroup_root.size() || slash == std::string::npos || slash < cgroup_root.size()) {
+                break;
+            }
+            dir.erase(slash);
+        }
+    }
+    return cpu_quota;
+}
+
+void apply_cpu_quota_linux(const int cpu_quota, std::vector<std::vector<int>>& _proc_type_table) {
+    if (cpu_quota <= 0 || _proc_type_table.empty() || cpu_quota >= _proc_type_table[0][ALL_PROC]) {
+        return;
+    }
+    // the quota is taken from the physical cores first, then from their hyper-threading siblings
+    const size_t first_node = _proc_type_table.size() > 1 ? 1 : 0;
+    int quota_left = cpu_quota;
+    for (const int proc_type : {MAIN_CORE_PROC, EFFICIENT_CORE_PROC, HYPER_THREADING_PROC}) {
+        for (size_t i = first_node; i < _proc_type_table.size(); i++) {
+            _proc_type_table[i][proc_type] = std::min(_proc_type_table[i][proc_type], quota_left);
+            quota_left -= _proc_type_table[i][proc_type];
+        }
+    }
+    for (size_t i = first_node; i < _proc_type_table.size(); i++) {
+        _proc_type_table[i][ALL_PROC] = _proc_type_table[i][MAIN_CORE_PROC] +
+                                        _proc_type_table[i][EFFICIENT_CORE_PROC] +
+                                        _proc_type_table[i][HYPER_THREADING_PROC];
+    }
+    if (first_node == 0) {
+        return;
+    }
+    _proc_type_table.erase(std::remove_if(_proc_type_table.begin() + 1,
+                                          _proc_type_table.end(),
+                                          [](const std::vector<int>& row) {
+                                              return row[ALL_PROC] == 0;
+                                          }),
+                           _proc_type_table.end());
+    if (_proc_type_table.size() == 2) {
+        // the only node left is the whole table
+        _proc_type_table.erase(_proc_type_table.begin());
+        return;
+    }
+    for (const int column : {ALL_PROC, MAIN_CORE_PROC, EFFICIENT_CORE_PROC, HYPER_THREADING_PROC}) {
+        _proc_type_table[0][column] = 0;
+        for (size_t i = 1; i < _proc_type_table.size(); i++) {
+            _proc_type_table[0][column] += _proc_type_table[i][column];
+        }
+    }
 }
 
 void parse_node_info_linux(const std::vector<std::string> node_info_table,
@@ -312,6 +312,13 @@ std::vector<int> get_available_numa_nodes() {
 std::vector<std::vector<int>> get_proc_type_table() {
     CPU& cpu = cpu_info();
     std::lock_guard<std::mutex> lock{cpu._cpu_mutex};
+#    ifdef __linux__
+    if (cpu._cpu_quota > 0) {
+        auto proc_type_table = cpu._proc_type_table;
+        apply_cpu_quota_linux(cpu._cpu_quota, proc_type_table);
+        return proc_type_table;
+    }
+#    endif
     return cpu._proc_type_table;
 }
 
@@ -31,6 +31,7 @@ public:
     ExecutorManagerImpl(const std::shared_ptr<ov::threading::ExecutorManager>& manager);
     ITaskExecutor::Ptr getExecutor(const std::string& id) override;
     IStreamsExecutor::Ptr getIdleCPUStreamsExecutor(const IStreamsExecutor::Config& config) override;
+    IStreamsExecutor::Ptr getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config, int priority) override;
     size_t getExecutorsNumber() const override;
     size_t getIdleCPUStreamsExecutorsNumber() const override;
     void clear(const std::string& id = {}) override;
@@ -108,6 +109,11 @@ IStreamsExecutor::Ptr ExecutorManagerImpl::getIdleCPUStreamsExecutor(const IStre
     return std::make_shared<StreamsExecutorWrapper>(m_manager->get_idle_cpu_streams_executor(config));
 }
 
+IStreamsExecutor::Ptr ExecutorManagerImpl::getSharedCPUStreamsExecutor(const IStreamsExecutor::Config& config,
+                                                                       int priority) {
+    return std::make_shared<StreamsExecutorWrapper>(m_manager->get_shared_cpu_streams_executor(config, priority));
+}
+
 size_t ExecutorManagerImpl::getExecutorsNumber() const {
     return m_manager->get_executors_number();
 }
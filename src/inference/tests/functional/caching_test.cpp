@@ -8,12 +8,15 @@
 #include <atomic>
 #include <chrono>
 #include <functional>
+#include <map>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
 
 #include "common_test_utils/file_utils.hpp"
+#include "common_test_utils/test_assertions.hpp"
 #include "ie_plugin_config.hpp"
 #include "ngraph_functions/subgraph_builders.hpp"
 #include "openvino/core/any.hpp"
@@ -448,6 +451,60 @@ TEST_P(CachingTest, TestLoad) {
 }
 
 /// \brief Verifies that core.set_property({{"CACHE_DIR", <dir>}}, "deviceName"}}); enables caching for one device
+/// \brief The consumed outputs are applied by the core to the model given in any way, they are not passed to the
+/// plugin and the pruned model is cached
+TEST_P(CachingTest, TestLoad_ConsumedOutputs) {
+    m_checkConfigCb = [](const ov::AnyMap& config) {
+        EXPECT_EQ(config.count(ov::hint::consumed_outputs.name()), 0);
+    };
+    EXPECT_CALL(*mockPlugin, get_property(ov::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::device::capability::EXPORT_IMPORT, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::device::architecture.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::internal::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::internal::caching_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::device::capabilities.name(), _)).Times(AnyNumber());
+    const ov::AnyMap config = {ov::hint::consumed_outputs(std::vector<std::string>{"reshape2"})};
+
+    {
+        EXPECT_CALL(*mockPlugin, compile_model(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, compile_model(A<const std::shared_ptr<const ov::Model>&>(), _))
+            .Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, import_model(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, import_model(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockICompiledModelImpl& net) {
+            EXPECT_CALL(net, export_model(_)).Times(1);
+        });
+        testLoad([&](ov::Core& core) {
+            core.set_property(ov::cache_dir(m_cacheDir));
+            m_testFunctionWithCfg(core, config);
+        });
+        EXPECT_EQ(comp_models.size(), 1);
+    }
+
+    {
+        EXPECT_CALL(*mockPlugin, compile_model(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, compile_model(A<const std::shared_ptr<const ov::Model>&>(), _)).Times(0);
+        EXPECT_CALL(*mockPlugin, import_model(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, import_model(_, _)).Times(!m_remoteContext ? 1 : 0);
+        testLoad([&](ov::Core& core) {
+            core.set_property(ov::cache_dir(m_cacheDir));
+            m_testFunctionWithCfg(core, config);
+        });
+        EXPECT_EQ(comp_models.size(), 1);
+    }
+
+    {
+        EXPECT_CALL(*mockPlugin, compile_model(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, compile_model(A<const std::shared_ptr<const ov::Model>&>(), _)).Times(0);
+        const ov::AnyMap missed_config = {ov::hint::consumed_outputs(std::vector<std::string>{"missed"})};
+        testLoad([&](ov::Core& core) {
+            OV_EXPECT_THROW(m_testFunctionWithCfg(core, missed_config),
+                            ov::Exception,
+                            HasSubstr("The consumed output 'missed' is not found in the model"));
+        });
+    }
+}
+
 TEST_P(CachingTest, TestLoad_by_device_name) {
     EXPECT_CALL(*mockPlugin, get_property(ov::supported_properties.name(), _)).Times(AnyNumber());
     EXPECT_CALL(*mockPlugin, get_property(ov::device::capability::EXPORT_IMPORT, _)).Times(AnyNumber());
@@ -488,6 +545,98 @@ TEST_P(CachingTest, TestLoad_by_device_name) {
     }
 }
 
+/// \brief Verifies that Core::compile_models compiles the identical items once
+TEST_P(CachingTest, TestCompileModels) {
+    if (m_type != TestLoadType::EModel)
+        GTEST_SKIP();
+    EXPECT_CALL(*mockPlugin, get_property(ov::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::device::capability::EXPORT_IMPORT, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::device::architecture.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::internal::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::internal::caching_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::device::capabilities.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, compile_model(A<const std::shared_ptr<const ov::Model>&>(), _)).Times(2);
+    EXPECT_CALL(*mockPlugin, import_model(_, _)).Times(0);
+
+    testLoad([&](ov::Core& core) {
+        auto model = core.read_model(modelName);
+        auto other_model = core.read_model(modelName);
+        auto compiled = core.compile_models({std::make_tuple(model, deviceToLoad, ov::AnyMap{}),
+                                             std::make_tuple(other_model, deviceToLoad, ov::AnyMap{}),
+                                             std::make_tuple(model, deviceToLoad, ov::AnyMap{})});
+        ASSERT_EQ(compiled.size(), 3);
+        EXPECT_EQ(comp_models.size(), 2);
+    });
+}
+
+/// \brief Verifies that the blobs are stored in the cache manager set by ov::cache_manager
+TEST_P(CachingTest, TestLoad_CustomCacheManager) {
+    class MemoryCacheManager : public ov::ICacheManager {
+    public:
+        std::map<std::string, std::string> entries;
+
+        void write_cache_entry(const std::string& id, StreamWriter writer) override {
+            std::stringstream stream;
+            writer(stream);
+            entries[id] = stream.str();
+        }
+
+        void read_cache_entry(const std::string& id, bool, StreamReader reader) override {
+            auto it = entries.find(id);
+            if (it != entries.end()) {
+                std::stringstream stream(it->second);
+                reader(stream);
+            }
+        }
+
+        void remove_cache_entry(const std::string& id) override {
+            entries.erase(id);
+        }
+    };
+    auto cacheManager = std::make_shared<MemoryCacheManager>();
+
+    EXPECT_CALL(*mockPlugin, get_property(ov::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::device::capability::EXPORT_IMPORT, _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::device::architecture.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::internal::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::internal::caching_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, get_property(ov::device::capabilities.name(), _)).Times(AnyNumber());
+
+    {
+        EXPECT_CALL(*mockPlugin, compile_model(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, compile_model(A<const std::shared_ptr<const ov::Model>&>(), _))
+            .Times(!m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, import_model(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, import_model(_, _)).Times(0);
+        m_post_mock_net_callbacks.emplace_back([&](MockICompiledModelImpl& net) {
+            EXPECT_CALL(net, export_model(_)).Times(1);
+        });
+        testLoad([&](ov::Core& core) {
+            core.set_property(ov::cache_manager(cacheManager));
+            m_testFunction(core);
+        });
+        EXPECT_EQ(comp_models.size(), 1);
+        EXPECT_EQ(cacheManager->entries.size(), 1);
+    }
+
+    {
+        EXPECT_CALL(*mockPlugin, compile_model(_, _, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, compile_model(A<const std::shared_ptr<const ov::Model>&>(), _)).Times(0);
+        EXPECT_CALL(*mockPlugin, import_model(_, _, _)).Times(m_remoteContext ? 1 : 0);
+        EXPECT_CALL(*mockPlugin, import_model(_, _)).Times(!m_remoteContext ? 1 : 0);
+        for (auto& model : comp_models) {
+            EXPECT_CALL(*model, export_model(_)).Times(0);  // No more 'export_model' for existing models
+        }
+        testLoad([&](ov::Core& core) {
+            core.set_property(ov::cache_manager(cacheManager));
+            EXPECT_EQ(core.get_property(ov::cache_manager.name()).as<std::shared_ptr<ov::ICacheManager>>(),
+                      cacheManager);
+            m_testFunction(core);
+        });
+        EXPECT_EQ(comp_models.size(), 1);
+    }
+}
+
 TEST_P(CachingTest, TestLoadCustomImportExport) {
     const char customData[] = {1, 2, 3, 4, 5};
     EXPECT_CALL(*mockPlugin, get_property(ov::supported_properties.name(), _)).Times(AnyNumber());
@@ -11,6 +11,9 @@
 #include <threading/ie_cpu_streams_executor.hpp>
 #include <threading/ie_immediate_executor.hpp>
 
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+#include "openvino/runtime/threading/executor_manager.hpp"
+
 using namespace ::testing;
 using namespace std;
 using namespace InferenceEngine;
@@ -280,3 +283,87 @@ static auto AsyncExecutors = ::testing::Values(
     });
 
 INSTANTIATE_TEST_SUITE_P(ASyncTaskExecutorTests, ASyncTaskExecutorTests, AsyncExecutors);
+
+TEST(CPUStreamsExecutorStatisticsTests, countsPendingAndExecutedTasks) {
+    auto executor = std::make_shared<ov::threading::CPUStreamsExecutor>(
+        ov::threading::IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                                1,
+                                                1,
+                                                ov::threading::IStreamsExecutor::ThreadBindingType::NONE});
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::promise<void> started;
+    executor->run([&] {
+        started.set_value();
+        released.wait();
+    });
+    started.get_future().wait();
+    auto f = async(executor, [] {});
+
+    EXPECT_EQ(executor->get_busy_streams_number(), 1);
+    EXPECT_EQ(executor->get_pending_tasks_number(), 1);
+    release.set_value();
+    f.wait();
+
+    while (executor->get_busy_streams_number() != 0) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(executor->get_pending_tasks_number(), 0);
+    EXPECT_EQ(executor->get_executed_tasks_numbers(), std::vector<size_t>{2});
+}
+
+TEST(CPUStreamsExecutorPriorityTests, runsTasksOfHigherPriorityFirst) {
+    auto executor = std::make_shared<ov::threading::CPUStreamsExecutor>(
+        ov::threading::IStreamsExecutor::Config{"TestCPUStreamsExecutor",
+                                                1,
+                                                1,
+                                                ov::threading::IStreamsExecutor::ThreadBindingType::NONE});
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::promise<void> started;
+    executor->run([&] {
+        started.set_value();
+        released.wait();
+    });
+    started.get_future().wait();
+
+    std::vector<int> order;
+    std::promise<void> done;
+    executor->run_with_priority(
+        [&] {
+            order.push_back(-1);
+            done.set_value();
+        },
+        -1);
+    executor->run([&] {
+        order.push_back(0);
+    });
+    executor->run_with_priority(
+        [&] {
+            order.push_back(1);
+        },
+        1);
+    release.set_value();
+    done.get_future().wait();
+    EXPECT_EQ(order, (std::vector<int>{1, 0, -1}));
+}
+
+TEST(ExecutorManagerTests, sharesStreamsExecutorBetweenUsers) {
+    auto manager = ov::threading::executor_manager();
+    ov::threading::IStreamsExecutor::Config config{"TestSharedStreamsExecutor",
+                                                   1,
+                                                   1,
+                                                   ov::threading::IStreamsExecutor::ThreadBindingType::NONE};
+    auto high = manager->get_shared_cpu_streams_executor(config, 1);
+    auto low = manager->get_shared_cpu_streams_executor(config, -1);
+
+    std::thread::id high_thread, low_thread;
+    async(high, [&] {
+        high_thread = std::this_thread::get_id();
+    }).wait();
+    async(low, [&] {
+        low_thread = std::this_thread::get_id();
+    }).wait();
+    EXPECT_EQ(high_thread, low_thread);
+    manager->clear(config._name);
+}
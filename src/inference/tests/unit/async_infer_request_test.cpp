@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+#include "openvino/runtime/iasync_infer_request.hpp"
+#include "openvino/runtime/icompiled_model.hpp"
+#include "openvino/runtime/threading/cpu_streams_executor.hpp"
+
+using namespace ::testing;
+
+namespace {
+
+class MockInferRequest : public ov::IInferRequest {
+public:
+    MOCK_METHOD(void, infer, ());
+    MOCK_METHOD(std::vector<ov::ProfilingInfo>, get_profiling_info, (), (const));
+    MOCK_METHOD(ov::SoPtr<ov::ITensor>, get_tensor, (const ov::Output<const ov::Node>&), (const));
+    MOCK_METHOD(void, set_tensor, (const ov::Output<const ov::Node>&, const ov::SoPtr<ov::ITensor>&));
+    MOCK_METHOD(std::vector<ov::SoPtr<ov::ITensor>>, get_tensors, (const ov::Output<const ov::Node>&), (const));
+    MOCK_METHOD(void, set_tensors, (const ov::Output<const ov::Node>&, const std::vector<ov::SoPtr<ov::ITensor>>&));
+    MOCK_METHOD(std::vector<ov::SoPtr<ov::IVariableState>>, query_state, (), (const));
+    MOCK_METHOD(const std::shared_ptr<const ov::ICompiledModel>&, get_compiled_model, (), (const));
+    MOCK_METHOD(const std::vector<ov::Output<const ov::Node>>&, get_inputs, (), (const));
+    MOCK_METHOD(const std::vector<ov::Output<const ov::Node>>&, get_outputs, (), (const));
+    MOCK_METHOD(void, check_tensors, (), (const));
+};
+
+}  // namespace
+
+class IAsyncInferRequestTests : public ::testing::Test {
+protected:
+    std::shared_ptr<MockInferRequest> sync_request;
+    std::shared_ptr<ov::threading::ITaskExecutor> task_executor;
+
+    void SetUp() override {
+        sync_request = std::make_shared<NiceMock<MockInferRequest>>();
+        task_executor =
+            std::make_shared<ov::threading::CPUStreamsExecutor>(ov::threading::IStreamsExecutor::Config{"Test"});
+    }
+};
+
+TEST_F(IAsyncInferRequestTests, callbackIsCalledInlineWithoutCallbackExecutor) {
+    std::thread::id infer_thread;
+    EXPECT_CALL(*sync_request, infer()).WillOnce([&] {
+        infer_thread = std::this_thread::get_id();
+    });
+    ov::IAsyncInferRequest request(sync_request, task_executor, nullptr);
+
+    std::thread::id callback_thread;
+    request.set_callback([&](std::exception_ptr) {
+        callback_thread = std::this_thread::get_id();
+    });
+    request.start_async();
+    request.wait();
+    EXPECT_EQ(infer_thread, callback_thread);
+}
+
+TEST_F(IAsyncInferRequestTests, stageExceptionIsPassedToCallbackAndWait) {
+    EXPECT_CALL(*sync_request, infer()).WillOnce(Throw(std::runtime_error("infer")));
+    ov::IAsyncInferRequest request(sync_request, task_executor, nullptr);
+
+    std::exception_ptr callback_exception;
+    request.set_callback([&](std::exception_ptr exception) {
+        callback_exception = exception;
+    });
+    request.start_async();
+    EXPECT_THROW(request.wait(), std::runtime_error);
+    EXPECT_NE(nullptr, callback_exception);
+}
+
+TEST_F(IAsyncInferRequestTests, requestMissingDeadlineIsCancelled) {
+    EXPECT_CALL(*sync_request, infer()).Times(0);
+    ov::IAsyncInferRequest request(sync_request, task_executor, nullptr);
+
+    std::promise<void> release;
+    std::promise<void> started;
+    task_executor->run([&] {
+        started.set_value();
+        release.get_future().wait();
+    });
+    started.get_future().wait();
+    request.set_deadline(std::chrono::milliseconds{1});
+    request.start_async();
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    release.set_value();
+    EXPECT_THROW(request.wait(), ov::Cancelled);
+}
+
+TEST_F(IAsyncInferRequestTests, requestOfHigherPriorityRunsFirst) {
+    std::vector<int> order;
+    auto low_sync_request = std::make_shared<NiceMock<MockInferRequest>>();
+    EXPECT_CALL(*low_sync_request, infer()).WillOnce([&] {
+        order.push_back(0);
+    });
+    EXPECT_CALL(*sync_request, infer()).WillOnce([&] {
+        order.push_back(1);
+    });
+    ov::IAsyncInferRequest low_request(low_sync_request, task_executor, nullptr);
+    ov::IAsyncInferRequest high_request(sync_request, task_executor, nullptr);
+    high_request.set_priority(1);
+
+    std::promise<void> release;
+    std::promise<void> started;
+    task_executor->run([&] {
+        started.set_value();
+        release.get_future().wait();
+    });
+    started.get_future().wait();
+    low_request.start_async();
+    high_request.start_async();
+    release.set_value();
+    low_request.wait();
+    high_request.wait();
+    EXPECT_EQ(order, (std::vector<int>{1, 0}));
+}
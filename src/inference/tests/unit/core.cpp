@@ -418,3 +418,24 @@ TEST_F(ApplyAutoBatchThreading, ApplyAutoBatch) {
         core.apply_auto_batching(model, device, config);
     });
 }
+
+TEST(CoreTests_remove_unconsumed_outputs, Removes_outputs_and_their_operations) {
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 2});
+    auto consumed = std::make_shared<ov::op::v0::Relu>(input);
+    consumed->output(0).set_names({"consumed"});
+    auto unconsumed = std::make_shared<ov::op::v0::Relu>(std::make_shared<ov::op::v0::Relu>(input));
+    unconsumed->output(0).set_names({"unconsumed"});
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{consumed, unconsumed}, ov::ParameterVector{input});
+
+    auto pruned_model = ov::remove_unconsumed_outputs(model, {"consumed"});
+    ASSERT_NE(model, pruned_model);
+    ASSERT_EQ(1u, pruned_model->outputs().size());
+    EXPECT_EQ("consumed", pruned_model->output(0).get_any_name());
+    EXPECT_EQ(3u, pruned_model->get_ops().size());
+    EXPECT_EQ(2u, model->outputs().size());
+
+    EXPECT_EQ(model, ov::remove_unconsumed_outputs(model, {"consumed", "unconsumed"}));
+    OV_EXPECT_THROW(ov::remove_unconsumed_outputs(model, {"missed"}),
+                    ov::Exception,
+                    ::testing::HasSubstr("The consumed output 'missed' is not found in the model"));
+}
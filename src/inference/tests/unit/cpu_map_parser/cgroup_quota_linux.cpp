@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <common_test_utils/common_utils.hpp>
+#include <common_test_utils/file_utils.hpp>
+#include <common_test_utils/test_common.hpp>
+
+#include "openvino/runtime/system_conf.hpp"
+#include "os/cpu_map_info.hpp"
+
+using namespace testing;
+using namespace ov;
+
+namespace {
+
+#ifdef __linux__
+
+struct LinuxCgroupQuotaTestCase {
+    std::vector<std::pair<std::string, std::string>> files;  // the path relative to the cgroup root and the content
+    std::string self_cgroup;
+    int cpu_quota;
+};
+
+class LinuxCgroupQuotaTests : public ov::test::TestsCommon,
+                              public testing::WithParamInterface<std::tuple<LinuxCgroupQuotaTestCase>> {
+public:
+    void SetUp() override {
+        const auto& test_data = std::get<0>(GetParam());
+        m_root = "./" + ov::test::utils::generateTestFilePrefix() + "_cgroup";
+        for (const auto& file : test_data.files) {
+            const auto path = m_root + file.first;
+            ASSERT_EQ(0, ov::test::utils::createDirectoryRecursive(path.substr(0, path.find_last_of('/'))));
+            ov::test::utils::createFile(path, file.second);
+            m_files.push_back(path);
+        }
+
+        ASSERT_EQ(test_data.cpu_quota, get_cpu_quota_linux(m_root, test_data.self_cgroup));
+    }
+
+    void TearDown() override {
+        for (const auto& path : m_files) {
+            ov::test::utils::removeFile(path);
+        }
+        // the directories are removed from the deepest one, a non empty directory is kept until its last file is gone
+        for (auto it = m_files.rbegin(); it != m_files.rend(); ++it) {
+            auto dir = it->substr(0, it->find_last_of('/'));
+            while (dir.size() >= m_root.size() && ov::test::utils::removeDir(dir) == 0) {
+                dir = dir.substr(0, dir.find_last_of('/'));
+            }
+        }
+    }
+
+private:
+    std::string m_root;
+    std::vector<std::string> m_files;
+};
+
+LinuxCgroupQuotaTestCase cgroup_v2_quota = {
+    {{"/cpu.max", "250000 100000\n"}},
+    "0::/\n",
+    3,
+};
+LinuxCgroupQuotaTestCase cgroup_v2_no_quota = {
+    {{"/cpu.max", "max 100000\n"}},
+    "0::/\n",
+    -1,
+};
+LinuxCgroupQuotaTestCase cgroup_v2_nested_quota = {
+    {{"/cpu.max", "max 100000\n"},
+     {"/kubepods/pod/cpu.max", "400000 100000\n"},
+     {"/kubepods/pod/container/cpu.max", "max 100000\n"}},
+    "0::/kubepods/pod/container\n",
+    4,
+};
+LinuxCgroupQuotaTestCase cgroup_v2_lowest_quota = {
+    {{"/kubepods/cpu.max", "150000 100000\n"}, {"/kubepods/pod/cpu.max", "800000 100000\n"}},
+    "0::/kubepods/pod\n",
+    2,
+};
+LinuxCgroupQuotaTestCase cgroup_v1_quota = {
+    {{"/cpu/cpu.cfs_quota_us", "50000\n"}, {"/cpu/cpu.cfs_period_us", "100000\n"}},
+    "12:cpu,cpuacct:/\n",
+    1,
+};
+LinuxCgroupQuotaTestCase cgroup_v1_no_quota = {
+    {{"/cpu/cpu.cfs_quota_us", "-1\n"}, {"/cpu/cpu.cfs_period_us", "100000\n"}},
+    "12:cpu,cpuacct:/\n",
+    -1,
+};
+LinuxCgroupQuotaTestCase cgroup_v1_nested_quota = {
+    {{"/cpu,cpuacct/docker/container/cpu.cfs_quota_us", "600000\n"},
+     {"/cpu,cpuacct/docker/container/cpu.cfs_period_us", "100000\n"}},
+    "11:memory:/docker/container\n12:cpu,cpuacct:/docker/container\n",
+    6,
+};
+LinuxCgroupQuotaTestCase cgroup_v1_other_controller = {
+    {{"/cpu/docker/cpu.cfs_quota_us", "200000\n"}, {"/cpu/docker/cpu.cfs_period_us", "100000\n"}},
+    "11:cpuset:/docker\n",
+    -1,
+};
+
+TEST_P(LinuxCgroupQuotaTests, LinuxCgroupQuota) {}
+
+INSTANTIATE_TEST_SUITE_P(CPUMap,
+                         LinuxCgroupQuotaTests,
+                         testing::Values(cgroup_v2_quota,
+                                         cgroup_v2_no_quota,
+                                         cgroup_v2_nested_quota,
+                                         cgroup_v2_lowest_quota,
+                                         cgroup_v1_quota,
+                                         cgroup_v1_no_quota,
+                                         cgroup_v1_nested_quota,
+                                         cgroup_v1_other_controller));
+
+struct LinuxCpuQuotaTestCase {
+    int cpu_quota;
+    std::vector<std::vector<int>> input_proc_type_table;
+    std::vector<std::vector<int>> _proc_type_table;
+};
+
+class LinuxCpuQuotaTests : public ov::test::TestsCommon,
+                           public testing::WithParamInterface<std::tuple<LinuxCpuQuotaTestCase>> {
+public:
+    void SetUp() override {
+        const auto& test_data = std::get<0>(GetParam());
+        auto test_proc_type_table = test_data.input_proc_type_table;
+
+        apply_cpu_quota_linux(test_data.cpu_quota, test_proc_type_table);
+
+        ASSERT_EQ(test_data._proc_type_table, test_proc_type_table);
+    }
+};
+
+LinuxCpuQuotaTestCase quota_1sockets_14cores_hyperthreading = {
+    3,
+    {{20, 6, 8, 6, 0, 0}},
+    {{3, 3, 0, 0, 0, 0}},
+};
+LinuxCpuQuotaTestCase quota_1sockets_6cores_hyperthreading = {
+    8,
+    {{12, 6, 0, 6, 0, 0}},
+    {{8, 6, 0, 2, 0, 0}},
+};
+LinuxCpuQuotaTestCase quota_2sockets_20cores_hyperthreading = {
+    30,
+    {{40, 20, 0, 20, -1, -1}, {20, 10, 0, 10, 0, 0}, {20, 10, 0, 10, 1, 1}},
+    {{30, 20, 0, 10, -1, -1}, {20, 10, 0, 10, 0, 0}, {10, 10, 0, 0, 1, 1}},
+};
+LinuxCpuQuotaTestCase quota_2sockets_20cores_one_node = {
+    4,
+    {{40, 20, 0, 20, -1, -1}, {20, 10, 0, 10, 0, 0}, {20, 10, 0, 10, 1, 1}},
+    {{4, 4, 0, 0, 0, 0}},
+};
+LinuxCpuQuotaTestCase quota_above_processors = {
+    16,
+    {{12, 6, 0, 6, 0, 0}},
+    {{12, 6, 0, 6, 0, 0}},
+};
+
+TEST_P(LinuxCpuQuotaTests, LinuxCpuQuota) {}
+
+INSTANTIATE_TEST_SUITE_P(CPUMap,
+                         LinuxCpuQuotaTests,
+                         testing::Values(quota_1sockets_14cores_hyperthreading,
+                                         quota_1sockets_6cores_hyperthreading,
+                                         quota_2sockets_20cores_hyperthreading,
+                                         quota_2sockets_20cores_one_node,
+                                         quota_above_processors));
+#endif
+}  // namespace
@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <istream>
+#include <string>
+
+#include "openvino/runtime/shared_stream_buffer.hpp"
+
+TEST(SharedStreamBufferTest, ReadsAndSeeksOverSharedMemory) {
+    auto data = std::make_shared<std::string>("header:weights");
+    ov::SharedStreamBuffer buffer(data->data(), data->size(), data);
+    std::istream stream(&buffer);
+
+    std::string header;
+    std::getline(stream, header, ':');
+    EXPECT_EQ(header, "header");
+    EXPECT_EQ(stream.tellg(), std::streampos(7));
+    EXPECT_EQ(buffer.current(), data->data() + 7);
+    EXPECT_EQ(buffer.available(), 7u);
+
+    stream.seekg(-3, std::ios_base::end);
+    std::string tail(3, '\0');
+    stream.read(&tail[0], tail.size());
+    EXPECT_EQ(tail, "hts");
+    EXPECT_EQ(buffer.available(), 0u);
+
+    stream.seekg(0);
+    EXPECT_EQ(buffer.current(), data->data());
+    EXPECT_EQ(buffer.get_owner(), data);
+}
+
+TEST(SharedStreamBufferTest, RejectsSeekOutOfRange) {
+    const std::string data = "data";
+    ov::SharedStreamBuffer buffer(data.data(), data.size(), nullptr);
+    std::istream stream(&buffer);
+
+    stream.seekg(5);
+    EXPECT_TRUE(stream.fail());
+}
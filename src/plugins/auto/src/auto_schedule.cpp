@@ -102,6 +102,9 @@ void AutoSchedule::init() {
                 context_ptr->m_worker_name = context_ptr->m_device_info.device_name;
             }
             generate_workers(context_ptr->m_worker_name, context_ptr->m_compiled_model);
+            // the CPU helper serves the requests meanwhile, so the accelerator is warmed up before taking them
+            if (context_ptr == &m_compile_context[ACTUALDEVICE] && m_compile_context[CPU].m_is_enabled)
+                warm_up_workers(context_ptr->m_worker_name);
             context_ptr->m_is_already = true;
             // reloadsuccess flag only for m_compile_context[FALLBACKDEVICE]
             context_ptr->m_is_reload_success = true;
@@ -181,9 +184,21 @@ void AutoSchedule::init() {
         m_executor->run(m_compile_context[ACTUALDEVICE].m_task);
         auto recycleTask = [this]() mutable {
             wait_actual_compiled_model_ready();
+            size_t destroynum = 0;
+            std::list<Time> cpuhelp_all_start_times;
+            std::list<Time> cpuhelp_all_end_times;
             while (!m_exitflag && m_compile_context[ACTUALDEVICE].m_is_already) {
                 // handle the case of ACTUAL faster than CPU
                 m_compile_context[CPU].m_future.wait();
+                // keep the helper while the requests still spill over to it, i.e. the accelerator is saturated
+                size_t spillover_count = m_spillover_count;
+                while (!m_exitflag && !m_cpuhelp_released) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    if (spillover_count == m_spillover_count)
+                        break;
+                    spillover_count = m_spillover_count;
+                }
+                m_cpuhelp_released = true;
                 // clean up helper infer requests
                 // first, wait for all the remaining requests to finish
                 for (auto& iter : m_worker_requests["CPU_HELP"]) {
@@ -194,11 +209,9 @@ void AutoSchedule::init() {
                     }
                 }
                 // late enough to check the idle queue now
-                // second, check the idle queue if all requests are in place
-                size_t destroynum = 0;
+                // second, check the idle queue if all requests are in place, the requests dispatched before the
+                // helper was released return to the queue later, so the popped ones are counted across the checks
                 std::pair<int, WorkerInferRequest*> worker;
-                std::list<Time> cpuhelp_all_start_times;
-                std::list<Time> cpuhelp_all_end_times;
                 while (m_idle_worker_requests["CPU_HELP"].try_pop(worker)) {
                     destroynum++;
                     INFO_RUN([&cpuhelp_all_start_times, &cpuhelp_all_end_times, &worker]() {
@@ -384,6 +397,23 @@ SoCompiledModel AutoSchedule::wait_first_compiled_model_ready() {
     OPENVINO_THROW("[", get_log_tag(), "] ", result.str());
 }
 
+void AutoSchedule::warm_up_workers(const std::string& device) {
+    // the first inferences pay the lazy initialization of the device, so every request runs once with zero inputs
+    for (auto& worker : m_worker_requests[device]) {
+        try {
+            for (const auto& input : worker.m_inferrequest->get_inputs()) {
+                auto tensor = worker.m_inferrequest->get_tensor(input);
+                if (!std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr))
+                    std::memset(tensor->data(), 0, tensor->get_byte_size());
+            }
+            worker.m_inferrequest->infer();
+        } catch (const std::exception& e) {
+            LOG_DEBUG_TAG("warm-up inference on %s failed: %s", device.c_str(), e.what());
+        }
+    }
+    LOG_INFO_TAG("device:%s warmed up", device.c_str());
+}
+
 void AutoSchedule::wait_actual_compiled_model_ready() const {
     OV_ITT_SCOPED_TASK(itt::domains::AutoPlugin, "AutoSchedule::wait_actual_compiled_model_ready");
     // Maybe different API will call this function, so add call once here
@@ -415,6 +445,13 @@ bool AutoSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
         } else {
             if (m_compile_context[ACTUALDEVICE].m_is_already) {
                 devices.push_back(m_compile_context[ACTUALDEVICE].m_device_info);
+                if (m_compile_context[CPU].m_is_enabled && m_compile_context[CPU].m_is_already &&
+                    !m_cpuhelp_released) {
+                    // the helper takes the requests the accelerator has no idle request for
+                    auto m_device_info = m_compile_context[CPU].m_device_info;
+                    m_device_info.device_name = m_compile_context[CPU].m_worker_name;
+                    devices.push_back(std::move(m_device_info));
+                }
             } else {
                 // replace deviceName with m_worker_name, so schedule can select correct
                 // idleWorkerQueue
@@ -425,11 +462,15 @@ bool AutoSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
         }
     }
     lock.unlock();
-    for (auto&& device : devices) {
+    for (size_t i = 0; i < devices.size(); i++) {
+        const auto& device = devices[i];
         if (!preferred_device.empty() && (device.device_name != preferred_device)) {
             continue;
         }
         if (run_pipeline_task(pipeline_task, m_idle_worker_requests[device.device_name], preferred_device)) {
+            // only the CPU helper follows the accelerator in the list
+            if (i > 0)
+                ++m_spillover_count;
             return true;
         }
     }
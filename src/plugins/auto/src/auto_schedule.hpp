@@ -31,6 +31,7 @@ private:
     SoCompiledModel wait_first_compiled_model_ready() override;
     void try_to_compile_model(AutoCompileContext& context, const std::shared_ptr<ov::Model>& model) override;
     bool select_other_device(const std::string& cur_dev_name) override;
+    void warm_up_workers(const std::string& device);
     size_t                                                               m_cpuhelp_infer_count = 0;
     double                                                               m_cpuhelp_fps = 0.0;
     mutable std::once_flag                                               m_oc;
@@ -38,6 +39,9 @@ private:
     std::future<void>                                                    m_firstload_future;
     std::promise<void>                                                   m_firstload_promise;
     bool                                                                 m_exitflag = {false};
+    // the CPU helper takes the requests the accelerator has no idle request for, until it is released
+    std::atomic<bool>                                                    m_cpuhelp_released = {false};
+    std::atomic<size_t>                                                  m_spillover_count = {0};
 };
 } // namespace auto_plugin
 } // namespace ov
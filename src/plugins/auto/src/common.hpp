@@ -5,6 +5,8 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <map>
 #include <string>
 #include "ie_icore.hpp"
@@ -63,6 +65,31 @@ public:
     ov::threading::Task immediate_task;
 };
 
+// The load of a device tracked for the CUMULATIVE_THROUGHPUT scheduling
+struct DeviceLoad {
+    void dispatched() {
+        ++m_in_flight;
+        ++m_dispatched;
+    }
+    void completed(const Time& dispatch_time) {
+        const uint64_t exec_time =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - dispatch_time)
+                .count();
+        // the moving average with the 1/8 weight of the new sample
+        const uint64_t average = m_exec_time_us;
+        m_exec_time_us = average ? average - average / 8 + exec_time / 8 : exec_time;
+        --m_in_flight;
+    }
+    // the time to complete one more request, as the device executes the requests by its workers in parallel
+    uint64_t estimate_completion_time() const {
+        return m_exec_time_us * (m_in_flight + 1) / std::max<size_t>(m_workers, 1);
+    }
+    std::atomic<uint64_t>         m_exec_time_us = {0};
+    std::atomic<size_t>           m_in_flight = {0};
+    std::atomic<size_t>           m_dispatched = {0};
+    size_t                        m_workers = 1;
+};
+
 struct WorkerInferRequest {
     SoAsyncInferRequest           m_inferrequest;
     ov::threading::Task           m_task;
@@ -71,6 +98,8 @@ struct WorkerInferRequest {
     std::list<Time>               m_end_times;
     int                           m_index = 0;
     AutoImmediateExecutor::Ptr    m_fallback_exec;
+    DeviceLoad*                   m_load = nullptr;
+    Time                          m_dispatch_time;
 };
 
 struct ThisRequestExecutor : public ov::threading::ITaskExecutor {
@@ -213,6 +242,8 @@ public:
     bool                                           m_startup_fallback = true;
     bool                                           m_runtime_fallback = true;
     bool                                           m_bind_buffer = false;
+    // the context allocating the tensors of the requests in the host memory visible to all the devices
+    ov::SoPtr<ov::IRemoteContext>                  m_host_tensor_context;
     std::shared_ptr<ov::Model>                     m_model;
     std::string                                    m_model_path;
     std::shared_ptr<const ov::IPlugin>             m_plugin;
@@ -128,6 +128,7 @@ void CumuSchedule::init() {
         m_idle_worker_requests[device.device_name];
         m_worker_requests[device.device_name];
         m_infer_pipeline_tasks_device_specific[device.device_name] = nullptr;
+        m_device_loads[device.device_name];
     }
     // load devices other than CPU first
     if (other_devices_loads.size() > 0) {
@@ -187,6 +188,17 @@ void CumuSchedule::try_to_compile_model(AutoCompileContext& context, const std::
         context.m_is_load_success = false;
     }
 }
+void CumuSchedule::generate_workers(const std::string& device, const SoCompiledModel& compiled_model) {
+    Schedule::generate_workers(device, compiled_model);
+    auto load = m_device_loads.find(device);
+    if (load == m_device_loads.end())
+        return;
+    auto& worker_requests = m_worker_requests[device];
+    load->second.m_workers = worker_requests.size();
+    for (auto& worker_request : worker_requests)
+        worker_request.m_load = &load->second;
+}
+
 SoCompiledModel CumuSchedule::wait_first_compiled_model_ready() {
     std::ostringstream result;
     result << "compile model failed, ";
@@ -217,6 +229,25 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
         devices = m_context->m_device_priorities;
     }
     lock.unlock();
+    if (preferred_device.empty() && devices.size() > 1) {
+        // try the devices expected to complete the request first, the estimates are taken once as they change
+        // concurrently, and the devices not measured yet keep the priority order ahead of the others
+        std::vector<std::pair<uint64_t, DeviceInformation>> estimates;
+        estimates.reserve(devices.size());
+        for (auto&& device : devices) {
+            auto load = m_device_loads.find(device.device_name);
+            estimates.emplace_back(load == m_device_loads.end() ? 0 : load->second.estimate_completion_time(),
+                                   std::move(device));
+        }
+        std::stable_sort(estimates.begin(),
+                         estimates.end(),
+                         [](const std::pair<uint64_t, DeviceInformation>& lhs,
+                            const std::pair<uint64_t, DeviceInformation>& rhs) {
+                             return lhs.first < rhs.first;
+                         });
+        for (size_t i = 0; i < devices.size(); i++)
+            devices[i] = std::move(estimates[i].second);
+    }
     for (auto&& device : devices) {
         if (!preferred_device.empty() && (device.device_name != preferred_device)) {
             continue;
@@ -235,6 +266,12 @@ bool CumuSchedule::schedule_to_worker_infer_request(ov::threading::Task pipeline
 }
 
 CumuSchedule::~CumuSchedule() {
+    for (auto&& load : m_device_loads) {
+        LOG_INFO_TAG("%s:dispatched:%ld, average execution time:%ld us",
+                     load.first.c_str(),
+                     static_cast<long>(load.second.m_dispatched.load()),
+                     static_cast<long>(load.second.m_exec_time_us.load()));
+    }
     if (m_context) {
         std::lock_guard<std::mutex> lock(m_context->m_fallback_mutex);
         m_context->m_device_priorities.clear();
@@ -24,6 +24,9 @@ private:
     bool schedule_to_worker_infer_request(ov::threading::Task, DeviceName preferred_device = "") override;
     void try_to_compile_model(AutoCompileContext& context, const std::shared_ptr<ov::Model>& model) override;
     bool select_other_device(const std::string& cur_dev_name) override;
+    void generate_workers(const std::string& device, const SoCompiledModel& compiled_model) override;
+    // created before the devices are compiled, so the concurrent schedulers only read the map
+    DeviceMap<DeviceLoad>                   m_device_loads;
 };
 } // namespace auto_plugin
 } // namespace ov
@@ -22,9 +22,16 @@ using Time = std::chrono::high_resolution_clock;
 
 namespace {
 
-void allocate_tensor_impl(ov::SoPtr<ov::ITensor>& tensor, const ov::element::Type& element_type, const ov::Shape& shape) {
+void allocate_tensor_impl(ov::SoPtr<ov::ITensor>& tensor,
+                          const ov::element::Type& element_type,
+                          const ov::Shape& shape,
+                          const ov::SoPtr<ov::IRemoteContext>& host_tensor_context) {
     if (!tensor || tensor->get_element_type() != element_type) {
-        tensor = ov::make_tensor(element_type, shape);
+        // the host memory of the context is visible to the devices, so the tensor is set to any of them without copy
+        if (host_tensor_context)
+            tensor = host_tensor_context->create_host_tensor(element_type, shape);
+        else
+            tensor = ov::make_tensor(element_type, shape);
     } else {
         tensor->set_shape(shape);
     }
@@ -33,25 +40,28 @@ void allocate_tensor_impl(ov::SoPtr<ov::ITensor>& tensor, const ov::element::Typ
 }  // namespace
 
 ov::auto_plugin::InferRequest::InferRequest(const std::shared_ptr<const ov::auto_plugin::CompiledModel>& model,
-                                            const SoAsyncInferRequest& request_to_share_tensors_with)
+                                            const SoAsyncInferRequest& request_to_share_tensors_with,
+                                            const ov::SoPtr<ov::IRemoteContext>& host_tensor_context)
     : ov::ISyncInferRequest(model),
       m_shared_request(request_to_share_tensors_with) {
     if (!m_shared_request) {
         // Allocate input/output tensors
         for (const auto& input : get_inputs()) {
-            allocate_tensor(input, [input](ov::SoPtr<ov::ITensor>& tensor) {
+            allocate_tensor(input, [input, &host_tensor_context](ov::SoPtr<ov::ITensor>& tensor) {
                 // Can add a check to avoid double work in case of shared tensors
                 allocate_tensor_impl(tensor,
                                     input.get_element_type(),
-                                    input.get_partial_shape().is_dynamic() ? ov::Shape{0} : input.get_shape());
+                                    input.get_partial_shape().is_dynamic() ? ov::Shape{0} : input.get_shape(),
+                                    host_tensor_context);
             });
         }
         for (const auto& output : get_outputs()) {
-            allocate_tensor(output, [output](ov::SoPtr<ov::ITensor>& tensor) {
+            allocate_tensor(output, [output, &host_tensor_context](ov::SoPtr<ov::ITensor>& tensor) {
                 // Can add a check to avoid double work in case of shared tensors
                 allocate_tensor_impl(tensor,
                                     output.get_element_type(),
-                                    output.get_partial_shape().is_dynamic() ? ov::Shape{0} : output.get_shape());
+                                    output.get_partial_shape().is_dynamic() ? ov::Shape{0} : output.get_shape(),
+                                    host_tensor_context);
             });
         }
     } else {
@@ -22,7 +22,8 @@ class CompiledModel;
 class InferRequest : public ov::ISyncInferRequest {
 public:
     explicit InferRequest(const std::shared_ptr<const ov::auto_plugin::CompiledModel>& compiled_model,
-                          const SoAsyncInferRequest& request_to_share_tensors_with);
+                          const SoAsyncInferRequest& request_to_share_tensors_with,
+                          const ov::SoPtr<ov::IRemoteContext>& host_tensor_context = {});
     ~InferRequest();
 
     void infer() override;
@@ -555,6 +555,17 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model_impl(const std::string
     auto_s_context->m_startup_fallback = load_config.get_property(ov::intel_auto::enable_startup_fallback);
     auto_s_context->m_runtime_fallback = load_config.get_property(ov::intel_auto::enable_runtime_fallback);
     auto_s_context->m_bind_buffer = load_config.get_property(ov::intel_auto::device_bind_buffer);
+    if (load_config.get_property(ov::intel_auto::shared_host_tensors) && support_devices.size() > 1) {
+        for (auto& device : support_devices) {
+            try {
+                auto_s_context->m_host_tensor_context = get_core()->get_default_context(device.device_name);
+                LOG_INFO_TAG("allocate the tensors of the requests in the host memory of device:%s",
+                             device.device_name.c_str());
+                break;
+            } catch (const ov::Exception&) {
+            }
+        }
+    }
     std::shared_ptr<ov::ICompiledModel> impl;
     std::shared_ptr<Schedule> scheduler = is_cumulative ? std::static_pointer_cast<Schedule>(std::make_shared<CumuSchedule>()) :
                                 std::static_pointer_cast<Schedule>(std::make_shared<AutoSchedule>());
@@ -43,8 +43,9 @@ ISyncInferPtr Schedule::create_sync_infer_request() {
     } else if (m_passthrough_compiled_model) {
         request_to_share_tensors_with = {m_passthrough_compiled_model->create_infer_request(), m_passthrough_compiled_model._so};
     }
-    return std::make_shared<InferRequest>(
-        std::static_pointer_cast<const CompiledModel>(compiled_model), request_to_share_tensors_with);
+    return std::make_shared<InferRequest>(std::static_pointer_cast<const CompiledModel>(compiled_model),
+                                          request_to_share_tensors_with,
+                                          m_context->m_host_tensor_context);
 }
 
 void Schedule::run(ov::threading::Task pipeline_task) {
@@ -60,6 +61,10 @@ bool Schedule::run_pipeline_task(ov::threading::Task& pipeline_task,
         worker_request_ptr = worker.second;
         IdleGuard<NotBusyPriorityWorkerRequests> idle_guard{worker_request_ptr, idle_workerrequests};
         m_this_worker_infer_request = worker_request_ptr;
+        if (worker_request_ptr->m_load) {
+            worker_request_ptr->m_dispatch_time = std::chrono::steady_clock::now();
+            worker_request_ptr->m_load->dispatched();
+        }
         {
             auto captured_task = std::move(pipeline_task);
             captured_task();
@@ -103,6 +108,8 @@ void Schedule::generate_workers(const std::string& device, const SoCompiledModel
             [worker_request_ptr, this, device, idle_workerrequests_ptr](std::exception_ptr exception_ptr) mutable {
                 IdleGuard<NotBusyPriorityWorkerRequests> idleGuard{worker_request_ptr, *idle_workerrequests_ptr};
                 worker_request_ptr->m_exception_ptr = std::move(exception_ptr);
+                if (worker_request_ptr->m_load)
+                    worker_request_ptr->m_load->completed(worker_request_ptr->m_dispatch_time);
                 {
                     auto stop_retry_and_continue = [worker_request_ptr]() {
                         auto captured_task = std::move(worker_request_ptr->m_task);
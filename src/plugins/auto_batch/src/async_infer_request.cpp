@@ -19,6 +19,19 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& re
     struct ThisRequestExecutor : public ov::threading::ITaskExecutor {
         explicit ThisRequestExecutor(AsyncInferRequest* _this_) : _this{_this_} {}
         void run(ov::threading::Task task) override {
+            if (!_this->m_sync_request->is_stateful() && _this->m_sync_request->has_remote_tensors()) {
+                // the remote tensors are passed to the request without batching as is, instead of the host copy
+                auto sync_request = _this->m_sync_request;
+                sync_request->m_batched_request_status = SyncInferRequest::eExecutionFlavor::TIMEOUT_EXECUTED;
+                sync_request->set_tensors_to_another_request(_this->m_request_without_batch);
+                _this->m_request_without_batch->set_callback([sync_request, task](std::exception_ptr p) {
+                    if (p)
+                        sync_request->m_exception_ptr = p;
+                    task();
+                });
+                _this->m_request_without_batch->start_async();
+                return;
+            }
             auto workerInferRequest = _this->m_sync_request->m_batched_request_wrapper;
             std::pair<AsyncInferRequest*, ov::threading::Task> t;
             t.first = _this;
@@ -56,7 +69,8 @@ std::vector<ov::ProfilingInfo> AsyncInferRequest::get_profiling_info() const {
 
 std::vector<ov::SoPtr<ov::IVariableState>> AsyncInferRequest::query_state() const {
     check_state();
-    if (SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
+    if (m_sync_request->is_stateful() ||
+        SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED == m_sync_request->m_batched_request_status)
         return m_sync_request->query_state();
     else
         return m_request_without_batch->query_state();
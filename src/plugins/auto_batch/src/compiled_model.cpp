@@ -5,10 +5,117 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "compiled_model.hpp"
 
+#include <algorithm>
+#include <cstring>
+
 #include "async_infer_request.hpp"
+#include "openvino/core/validation_util.hpp"
+#include "openvino/op/util/read_value_base.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "transformations/utils/utils.hpp"
 
 namespace ov {
 namespace autobatch_plugin {
+namespace {
+// copies the slots (of the tensors batched by the 0th dim) that are marked with the value
+void copy_slots(const ov::SoPtr<ov::ITensor>& src,
+                const ov::SoPtr<ov::ITensor>& dst,
+                const std::vector<bool>& slots,
+                bool value) {
+    const auto size_per_slot = dst->get_byte_size() / slots.size();
+    auto src_ptr = static_cast<const uint8_t*>(src->data());
+    auto dst_ptr = static_cast<uint8_t*>(dst->data());
+    for (size_t n = 0; n < slots.size(); n++) {
+        if (slots[n] == value)
+            std::memcpy(dst_ptr + n * size_per_slot, src_ptr + n * size_per_slot, size_per_slot);
+    }
+}
+}  // namespace
+
+void CompiledModel::WorkerInferRequest::start_partial_batch(const std::set<std::string>& batched_outputs) {
+    if (_partial_outputs.empty()) {
+        for (const auto& output : _infer_request_batched->get_outputs()) {
+            PartialOutput partial;
+            partial.port = output;
+            partial.tensor = _infer_request_batched->get_tensor(output);
+            partial.scratch = {ov::make_tensor(partial.tensor->get_element_type(), partial.tensor->get_shape()),
+                               nullptr};
+            const auto name = ov::op::util::get_ie_output_name(output.get_node_shared_ptr()->input_value(0));
+            partial.batched = batched_outputs.count(name) != 0;
+            _partial_outputs.push_back(std::move(partial));
+        }
+    }
+    for (const auto& output : _partial_outputs)
+        _infer_request_batched->set_tensor(output.port, output.scratch);
+    _saved_states.clear();
+    for (const auto& state : _infer_request_batched->query_state()) {
+        const auto& tensor = state->get_state();
+        ov::SoPtr<ov::ITensor> saved = {ov::make_tensor(tensor->get_element_type(), tensor->get_shape()), nullptr};
+        tensor->copy_to(saved._ptr);
+        _saved_states.push_back(std::move(saved));
+    }
+    _partial = true;
+}
+
+void CompiledModel::WorkerInferRequest::complete_partial_batch() {
+    if (!_partial)
+        return;
+    _partial = false;
+    for (const auto& output : _partial_outputs) {
+        if (output.batched)
+            copy_slots(output.scratch, output.tensor, _batched_slots, true);
+        else
+            output.scratch->copy_to(output.tensor._ptr);
+        _infer_request_batched->set_tensor(output.port, output.tensor);
+    }
+    // the idle slots executed on the stale inputs, so their sequences continue from the saved states
+    auto states = _infer_request_batched->query_state();
+    OPENVINO_ASSERT(states.size() == _saved_states.size());
+    for (size_t i = 0; i < states.size(); i++) {
+        const auto& saved = _saved_states[i];
+        const auto& shape = saved->get_shape();
+        // the states not batched by the 0th dim are shared by all the slots
+        if (shape.empty() || shape[0] != static_cast<size_t>(_batch_size))
+            continue;
+        const auto& current = states[i]->get_state();
+        ov::SoPtr<ov::ITensor> restored = {ov::make_tensor(current->get_element_type(), current->get_shape()),
+                                           nullptr};
+        current->copy_to(restored._ptr);
+        copy_slots(saved, restored, _batched_slots, false);
+        states[i]->set_state(restored);
+    }
+    _saved_states.clear();
+}
+
+std::map<std::string, ov::SoPtr<ov::ITensor>> CompiledModel::collect_initial_states(
+    const std::shared_ptr<const ov::Model>& model) {
+    std::map<std::string, ov::SoPtr<ov::ITensor>> initial_states;
+    for (const auto& op : model->get_ops()) {
+        auto read_value = std::dynamic_pointer_cast<const ov::op::util::ReadValueBase>(op);
+        if (!read_value)
+            continue;
+        OPENVINO_ASSERT(read_value->get_output_partial_shape(0).is_static(),
+                        "Auto-batching does not support the states of dynamic shapes!");
+        ov::SoPtr<ov::ITensor> initial = {
+            ov::make_tensor(read_value->get_output_element_type(0), read_value->get_output_shape(0)),
+            nullptr};
+        if (read_value->get_input_size()) {
+            OPENVINO_SUPPRESS_DEPRECATED_START
+            auto constant = ov::get_constant_from_source(read_value->input_value(0));
+            OPENVINO_SUPPRESS_DEPRECATED_END
+            OPENVINO_ASSERT(constant && constant->get_element_type() == initial->get_element_type() &&
+                                constant->get_shape() == initial->get_shape(),
+                            "Auto-batching supports only the states with the constant initial values!");
+            std::memcpy(initial->data(), constant->get_data_ptr(), initial->get_byte_size());
+        } else {
+            // the ReadValue without the initializer starts from zeros
+            std::memset(initial->data(), 0, initial->get_byte_size());
+        }
+        initial_states[read_value->get_variable_id()] = initial;
+    }
+    return initial_states;
+}
+
 CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
                              const std::shared_ptr<const ov::IPlugin>& plugin,
                              const ov::AnyMap& config,
@@ -22,6 +129,7 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_config(config),
       m_batched_inputs(batched_inputs),
       m_batched_outputs(batched_outputs),
+      m_stateful(!model->get_variables().empty()),
       m_compiled_model_with_batch(compiled_model_with_batch),
       m_compiled_model_without_batch(compiled_model_without_batch) {
     // WA for gcc 4.8 ( fails compilation with member init-list)
@@ -29,6 +137,11 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     auto time_out = config.find(ov::auto_batch_timeout.name());
     OPENVINO_ASSERT(time_out != config.end(), "No timeout property be set in config, default will be used!");
     m_time_out = time_out->second.as<std::uint32_t>();
+    auto latency_slo = config.find(ov::auto_batch_latency_slo.name());
+    if (latency_slo != config.end())
+        m_latency_slo = latency_slo->second.as<std::uint32_t>();
+    if (m_stateful && m_compiled_model_with_batch)
+        m_initial_states = collect_initial_states(model);
 }
 
 CompiledModel::~CompiledModel() {
@@ -64,20 +177,55 @@ CompiledModel::GetWorkerInferRequest() const {
             workerRequestPtr->_infer_request_batched._so = m_compiled_model_with_batch._so;
         workerRequestPtr->_batch_size = m_device_info.device_batch_size;
         workerRequestPtr->_completion_tasks.resize(workerRequestPtr->_batch_size);
+        workerRequestPtr->_batched_slots.resize(workerRequestPtr->_batch_size);
         workerRequestPtr->_infer_request_batched->set_callback(
-            [workerRequestPtr](std::exception_ptr exceptionPtr) mutable {
+            [workerRequestPtr, this](std::exception_ptr exceptionPtr) mutable {
                 if (exceptionPtr)
                     workerRequestPtr->_exception_ptr = exceptionPtr;
+                // the moving average (1/8 weight of the new sample) of the batched execution time
+                const uint64_t exec_time = std::chrono::duration_cast<std::chrono::microseconds>(
+                                               std::chrono::steady_clock::now() - workerRequestPtr->_batch_start)
+                                               .count();
+                const uint64_t average = m_batch_exec_time_us;
+                m_batch_exec_time_us = average ? average - average / 8 + exec_time / 8 : exec_time;
                 OPENVINO_ASSERT(workerRequestPtr->_completion_tasks.size() == (size_t)workerRequestPtr->_batch_size);
-                // notify the individual requests on the completion
+                // the outputs of the partial batch are in place before the requests copy or read them
+                try {
+                    workerRequestPtr->complete_partial_batch();
+                } catch (...) {
+                    workerRequestPtr->_exception_ptr = std::current_exception();
+                }
+                // notify the individual requests on the completion, the partial batch leaves some slots empty
                 for (int c = 0; c < workerRequestPtr->_batch_size; c++) {
-                    workerRequestPtr->_completion_tasks[c]();
+                    if (workerRequestPtr->_completion_tasks[c])
+                        workerRequestPtr->_completion_tasks[c]();
                 }
                 // reset the timeout
                 workerRequestPtr->_cond.notify_one();
             });
 
         workerRequestPtr->_thread = std::thread([workerRequestPtr, this] {
+            // pops the collected requests to the batched request, the rest of the slots are not waited for
+            auto start_batched = [workerRequestPtr, this](int sz) {
+                std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
+                std::fill(workerRequestPtr->_batched_slots.begin(), workerRequestPtr->_batched_slots.end(), false);
+                for (int n = 0; n < workerRequestPtr->_batch_size; n++) {
+                    if (n >= sz) {
+                        workerRequestPtr->_completion_tasks[n] = nullptr;
+                        continue;
+                    }
+                    OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
+                    workerRequestPtr->_completion_tasks[n] = std::move(t.second);
+                    workerRequestPtr->_batched_slots[t.first->m_sync_request->get_batch_id()] = true;
+                    t.first->m_sync_request->copy_inputs_if_needed();
+                    t.first->m_sync_request->m_batched_request_status =
+                        ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+                }
+                if (sz < workerRequestPtr->_batch_size)
+                    workerRequestPtr->start_partial_batch(m_batched_outputs);
+                workerRequestPtr->_batch_start = std::chrono::steady_clock::now();
+                workerRequestPtr->_infer_request_batched->start_async();
+            };
             while (1) {
                 std::cv_status status;
                 {
@@ -91,16 +239,23 @@ CompiledModel::GetWorkerInferRequest() const {
                     // it is ok to call size() (as the _tasks can only grow in parallel)
                     const int sz = static_cast<int>(workerRequestPtr->_tasks.size());
                     if (sz == workerRequestPtr->_batch_size) {
-                        std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
-                        for (int n = 0; n < sz; n++) {
-                            OPENVINO_ASSERT(workerRequestPtr->_tasks.try_pop(t));
-                            workerRequestPtr->_completion_tasks[n] = std::move(t.second);
-                            t.first->m_sync_request->copy_inputs_if_needed();
-                            t.first->m_sync_request->m_batched_request_status =
-                                ov::autobatch_plugin::SyncInferRequest::eExecutionFlavor::BATCH_EXECUTED;
+                        start_batched(sz);
+                    } else if ((status == std::cv_status::timeout) && sz &&
+                               (m_stateful || (m_latency_slo && sz * 2 >= workerRequestPtr->_batch_size))) {
+                        // the states of the stateful model live in the batched request only, while with the latency
+                        // target the half-full batch is cheaper to execute as is than one by one
+                        if (m_latency_slo)
+                            tune_time_out(sz, workerRequestPtr->_batch_size);
+                        start_batched(sz);
+                        // the requests of the empty slots may arrive meanwhile, so wait for the batch to complete
+                        try {
+                            workerRequestPtr->_infer_request_batched->wait();
+                        } catch (...) {
+                            // the exception is already passed to the requests by the callback
                         }
-                        workerRequestPtr->_infer_request_batched->start_async();
                     } else if ((status == std::cv_status::timeout) && sz) {
+                        if (m_latency_slo)
+                            tune_time_out(sz, workerRequestPtr->_batch_size);
                         // timeout to collect the batch is over, have to execute the requests in the batch1 mode
                         std::pair<ov::autobatch_plugin::AsyncInferRequest*, ov::threading::Task> t;
                         // popping all tasks collected by the moment of the time-out and execute each with batch1
@@ -133,6 +288,21 @@ CompiledModel::GetWorkerInferRequest() const {
     return {m_worker_requests.back(), static_cast<int>(batch_id)};
 }
 
+void CompiledModel::tune_time_out(int collected, int batch_size) const {
+    // the time left to collect the batch once its execution is accounted
+    const uint64_t exec_time_ms = m_batch_exec_time_us / 1000;
+    const uint32_t budget = exec_time_ms < m_latency_slo ? static_cast<uint32_t>(m_latency_slo - exec_time_ms) : 1;
+    uint32_t time_out = m_time_out;
+    if (collected * 2 >= batch_size) {
+        // the requests arrive at the rate close to the batch, waiting a bit longer likely fills it
+        time_out += time_out / 4 + 1;
+    } else {
+        // the load is low, waiting for the batch only adds the latency
+        time_out -= time_out / 4;
+    }
+    m_time_out = std::max(1u, std::min(time_out, budget));
+}
+
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
     if (!m_compiled_model_with_batch) {
         auto res = m_compiled_model_without_batch->create_infer_request();
@@ -170,11 +340,16 @@ void CompiledModel::set_property(const ov::AnyMap& properties) {
         if (property.first == ov::auto_batch_timeout.name()) {
             m_time_out = property.second.as<std::uint32_t>();
             m_config[ov::auto_batch_timeout.name()] = property.second.as<std::uint32_t>();
+        } else if (property.first == ov::auto_batch_latency_slo.name()) {
+            m_latency_slo = property.second.as<std::uint32_t>();
+            m_config[ov::auto_batch_latency_slo.name()] = property.second.as<std::uint32_t>();
         } else {
             OPENVINO_THROW("AutoBatching Compiled Model dosen't support property",
                            property.first,
-                           ". The only property that can be changed on the fly is the ",
-                           ov::auto_batch_timeout.name());
+                           ". The only properties that can be changed on the fly are the ",
+                           ov::auto_batch_timeout.name(),
+                           " and the ",
+                           ov::auto_batch_latency_slo.name());
         }
     }
 }
@@ -210,7 +385,7 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                                             METRIC_KEY(SUPPORTED_CONFIG_KEYS),
                                             ov::execution_devices.name()};
         } else if (name == METRIC_KEY(SUPPORTED_CONFIG_KEYS)) {
-            return std::vector<std::string>{ov::auto_batch_timeout.name()};
+            return std::vector<std::string>{ov::auto_batch_timeout.name(), ov::auto_batch_latency_slo.name()};
         } else if (name == ov::execution_devices) {
             return m_compiled_model_without_batch->get_property(name);
         } else if (name == ov::loaded_from_cache) {
@@ -222,10 +397,14 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
                 ov::PropertyName{ov::model_name.name(), ov::PropertyMutability::RO},
                 ov::PropertyName{METRIC_KEY(SUPPORTED_CONFIG_KEYS), ov::PropertyMutability::RO},
                 ov::PropertyName{ov::execution_devices.name(), ov::PropertyMutability::RO},
-                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RO}};
+                ov::PropertyName{ov::auto_batch_timeout.name(), ov::PropertyMutability::RO},
+                ov::PropertyName{ov::auto_batch_latency_slo.name(), ov::PropertyMutability::RW}};
         } else if (name == ov::auto_batch_timeout) {
             uint32_t time_out = m_time_out;
             return time_out;
+        } else if (name == ov::auto_batch_latency_slo) {
+            uint32_t latency_slo = m_latency_slo;
+            return latency_slo;
         } else if (name == ov::device::properties) {
             ov::AnyMap all_devices = {};
             ov::AnyMap device_properties = {};
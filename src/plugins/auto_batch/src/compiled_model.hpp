@@ -5,7 +5,9 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #pragma once
 
+#include <chrono>
 #include <condition_variable>
+#include <map>
 #include <thread>
 
 #include "openvino/runtime/iasync_infer_request.hpp"
@@ -30,6 +32,25 @@ public:
         std::condition_variable _cond;
         std::mutex _mutex;
         std::exception_ptr _exception_ptr;
+        std::chrono::steady_clock::time_point _batch_start;
+        // the slots of the requests collected into the running batch, the partial batch leaves the rest idle
+        std::vector<bool> _batched_slots;
+        bool _partial = false;
+
+        struct PartialOutput {
+            ov::Output<const ov::Node> port;
+            ov::SoPtr<ov::ITensor> tensor;   // the output of the batched request, viewed by the requests
+            ov::SoPtr<ov::ITensor> scratch;  // written by the partial batch instead
+            bool batched;
+        };
+        std::vector<PartialOutput> _partial_outputs;
+        // the states of the batched request saved before the partial batch
+        std::vector<ov::SoPtr<ov::ITensor>> _saved_states;
+
+        // redirects the outputs and saves the states, so the idle slots keep them while the partial batch executes
+        void start_partial_batch(const std::set<std::string>& batched_outputs);
+        // copies the outputs of the batched slots and restores the states of the idle slots
+        void complete_partial_batch();
     };
 
     CompiledModel(const std::shared_ptr<ov::Model>& model,
@@ -54,9 +75,21 @@ public:
 
     virtual ~CompiledModel();
 
+    // the initial values of the states (per the ReadValue of the batch1 model), the reset of a single request's state
+    // restores them in its slot
+    const std::map<std::string, ov::SoPtr<ov::ITensor>>& get_initial_states() const {
+        return m_initial_states;
+    }
+
+    // throws when the initial value of a state depends on the inputs, so a single slot can't be reset
+    static std::map<std::string, ov::SoPtr<ov::ITensor>> collect_initial_states(
+        const std::shared_ptr<const ov::Model>& model);
+
 protected:
     std::shared_ptr<ov::ISyncInferRequest> create_sync_infer_request() const override;
     static unsigned int ParseTimeoutValue(const std::string&);
+    // adapts the timeout to the arrival rate of the requests, within the latency target minus the batch execution time
+    void tune_time_out(int collected, int batch_size) const;
     std::atomic_bool m_terminate = {false};
     ov::AnyMap m_config;
     DeviceInformation m_device_info;
@@ -67,10 +100,14 @@ protected:
     mutable std::mutex m_worker_requests_mutex;
 
     mutable std::atomic_size_t m_num_requests_created = {0};
-    std::atomic<std::uint32_t> m_time_out = {0};  // in ms
+    mutable std::atomic<std::uint32_t> m_time_out = {0};            // in ms
+    std::atomic<std::uint32_t> m_latency_slo = {0};                 // in ms, 0 keeps the timeout fixed
+    mutable std::atomic<std::uint64_t> m_batch_exec_time_us = {0};  // moving average of the batched execution
 
     const std::set<std::string> m_batched_inputs;
     const std::set<std::string> m_batched_outputs;
+    const bool m_stateful;
+    std::map<std::string, ov::SoPtr<ov::ITensor>> m_initial_states;
 
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_with_batch;
     ov::SoPtr<ov::ICompiledModel> m_compiled_model_without_batch;
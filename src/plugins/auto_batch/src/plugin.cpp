@@ -26,6 +26,7 @@ OPENVINO_SUPPRESS_DEPRECATED_START
 std::vector<std::string> supported_configKeys = {CONFIG_KEY(AUTO_BATCH_DEVICE_CONFIG),
                                                  ov::device::priorities.name(),
                                                  ov::auto_batch_timeout.name(),
+                                                 ov::auto_batch_latency_slo.name(),
                                                  ov::cache_dir.name()};
 OPENVINO_SUPPRESS_DEPRECATED_END
 
@@ -132,7 +133,8 @@ OV_DEFINE_PLUGIN_CREATE_FUNCTION(Plugin, version)
 
 Plugin::Plugin() {
     set_device_name("BATCH");
-    m_plugin_config.insert(ov::auto_batch_timeout(1000));  // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_timeout(1000));    // default value (ms)
+    m_plugin_config.insert(ov::auto_batch_latency_slo(0));  // no latency target by default
 }
 
 std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
@@ -228,6 +230,9 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
         }
         if (!batched_inputs.size() || !batched_outputs.size())
             OPENVINO_THROW("Auto-batching supports only networks with inputs/outputs featuring batched dim!");
+        // the state of a single request is reset to the initial value in its slot, so the value can't depend on the
+        // inputs of the other requests in the batch
+        CompiledModel::collect_initial_states(cloned_model);
     } catch (const ov::Exception&) {
         meta_device.device_batch_size = 1;
     }
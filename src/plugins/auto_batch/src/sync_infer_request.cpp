@@ -5,7 +5,10 @@
 ///////////////////////////////////////////////////////////////////////////////////////////////////
 #include "sync_infer_request.hpp"
 
+#include <cstring>
+
 #include "openvino/core/type/element_type_traits.hpp"
+#include "openvino/runtime/iremote_tensor.hpp"
 #include "openvino/runtime/make_tensor.hpp"
 #include "transformations/utils/utils.hpp"
 
@@ -30,6 +33,77 @@ inline ov::SoPtr<ov::ITensor> create_shared_tensor_on_batched_tensor(ov::SoPtr<o
     }
 }
 
+// The view of the request's slot in the variable state of the batched request, the states not batched by the 0th dim
+// are shared by all the slots
+class SlotVariableState : public ov::IVariableState {
+public:
+    SlotVariableState(const ov::SoPtr<ov::IVariableState>& batched_state,
+                      const ov::SoPtr<ov::ITensor>& initial_state,
+                      size_t batch_id,
+                      size_t batch_size)
+        : ov::IVariableState(batched_state->get_name()),
+          m_batched_state(batched_state),
+          m_initial_state(initial_state),
+          m_batch_id(batch_id),
+          m_batch_size(batch_size) {}
+
+    void reset() override {
+        auto batched = m_batched_state->get_state();
+        const auto& shape = batched->get_shape();
+        if (shape.empty() || shape[0] != m_batch_size) {
+            m_batched_state->reset();
+            return;
+        }
+        // resetting the batched state would reset the sequences of all the slots, so only the slot gets the initial
+        // value of the state (zeros for the ReadValue without the initializer)
+        auto slot = get_slot(batched);
+        if (m_initial_state) {
+            OPENVINO_ASSERT(slot->get_byte_size() == m_initial_state->get_byte_size(),
+                            "The initial value of the state ",
+                            get_name(),
+                            " doesn't match the request's slot");
+            std::memcpy(slot->data(), m_initial_state->data(), slot->get_byte_size());
+        } else {
+            std::memset(slot->data(), 0, slot->get_byte_size());
+        }
+        m_batched_state->set_state(batched);
+    }
+
+    void set_state(const ov::SoPtr<ov::ITensor>& state) override {
+        auto batched = m_batched_state->get_state();
+        state->copy_to(get_slot(batched)._ptr);
+        m_batched_state->set_state(batched);
+    }
+
+    const ov::SoPtr<ov::ITensor>& get_state() const override {
+        m_slot_state = get_slot(m_batched_state->get_state());
+        return m_slot_state;
+    }
+
+    void truncate(int64_t /* axis */, size_t /* length */) override {
+        // the slots share the shape of the batched state
+        OPENVINO_THROW("Can't truncate the state ", get_name(), " of a request batched by the AUTO_BATCH plugin");
+    }
+
+private:
+    ov::SoPtr<ov::ITensor> get_slot(const ov::SoPtr<ov::ITensor>& batched) const {
+        const auto& shape = batched->get_shape();
+        if (shape.empty() || shape[0] != m_batch_size)
+            return batched;
+        ov::Coordinate begin(shape.size(), 0);
+        ov::Coordinate end(shape);
+        begin[0] = m_batch_id;
+        end[0] = m_batch_id + 1;
+        return {ov::make_tensor(batched._ptr, begin, end), batched._so};
+    }
+
+    ov::SoPtr<ov::IVariableState> m_batched_state;
+    ov::SoPtr<ov::ITensor> m_initial_state;
+    size_t m_batch_id;
+    size_t m_batch_size;
+    mutable ov::SoPtr<ov::ITensor> m_slot_state;
+};
+
 SyncInferRequest::SyncInferRequest(
     const std::shared_ptr<const ov::autobatch_plugin::CompiledModel>& compiled_model,
     const std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest>& worker_request,
@@ -40,7 +114,8 @@ SyncInferRequest::SyncInferRequest(
     : ov::ISyncInferRequest(compiled_model),
       m_batched_request_wrapper(worker_request),
       m_batch_id(batch_id),
-      m_batch_size(num_batch) {
+      m_batch_size(num_batch),
+      m_stateful(!worker_request->_infer_request_batched->query_state().empty()) {
     share_tensors_with_batched_req(batched_inputs, batched_outputs);
 }
 
@@ -75,13 +150,24 @@ void SyncInferRequest::share_tensors_with_batched_req(const std::set<std::string
     }
 }
 
+inline bool is_remote_tensor(const ov::SoPtr<ov::ITensor>& tensor) {
+    return std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr) != nullptr;
+}
+
+inline bool is_same_memory(const ov::SoPtr<ov::ITensor>& lhs, const ov::SoPtr<ov::ITensor>& rhs) {
+    // the memory of the remote tensors is not accessible on the host, so only the same tensor is the same memory
+    if (is_remote_tensor(lhs) || is_remote_tensor(rhs))
+        return lhs._ptr == rhs._ptr;
+    auto type = lhs->get_element_type();
+    return lhs->data(type) == rhs->data(type);
+}
+
 void SyncInferRequest::set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferRequest>& req) {
     for (const auto& it : get_inputs()) {
         // this request is already in BUSY state, so using the internal functions safely
         auto tensor = get_tensor(it);
         OPENVINO_ASSERT(tensor != nullptr, "The tensor is empty!");
-        auto type = tensor->get_element_type();
-        if (req->get_tensor(it)->data(type) != tensor->data(type)) {
+        if (!is_same_memory(req->get_tensor(it), tensor)) {
             req->set_tensor(it, tensor);
         }
     }
@@ -89,13 +175,24 @@ void SyncInferRequest::set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferR
         // this request is already in BUSY state, so using the internal functions safely
         auto tensor = get_tensor(it);
         OPENVINO_ASSERT(tensor != nullptr, "The tensor is empty!");
-        auto type = tensor->get_element_type();
-        if (req->get_tensor(it)->data(type) != tensor->data(type)) {
+        if (!is_same_memory(req->get_tensor(it), tensor)) {
             req->set_tensor(it, tensor);
         }
     }
 }
 
+bool SyncInferRequest::has_remote_tensors() const {
+    for (const auto& it : get_inputs()) {
+        if (is_remote_tensor(get_tensor(it)))
+            return true;
+    }
+    for (const auto& it : get_outputs()) {
+        if (is_remote_tensor(get_tensor(it)))
+            return true;
+    }
+    return false;
+}
+
 void SyncInferRequest::copy_inputs_if_needed() {
     for (const auto& it : get_inputs()) {
         // this request is already in BUSY state, so using the internal functions safely
@@ -140,9 +237,18 @@ void SyncInferRequest::infer() {
 
 std::vector<ov::SoPtr<ov::IVariableState>> SyncInferRequest::query_state() const {
     auto states = m_batched_request_wrapper->_infer_request_batched->query_state();
+    const auto& initial_states =
+        std::static_pointer_cast<const CompiledModel>(get_compiled_model())->get_initial_states();
     for (auto&& state : states) {
         if (!state._so)
             state._so = m_batched_request_wrapper->_infer_request_batched._so;
+        auto initial = initial_states.find(state->get_name());
+        state = {std::make_shared<SlotVariableState>(state,
+                                                     initial != initial_states.end() ? initial->second
+                                                                                     : ov::SoPtr<ov::ITensor>{},
+                                                     m_batch_id,
+                                                     m_batch_size),
+                 state._so};
     }
     return states;
 }
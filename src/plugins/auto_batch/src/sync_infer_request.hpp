@@ -23,14 +23,29 @@ public:
     // Batch-Device impl specific: sets the data (blobs from the device request to the batched device request)
     void set_tensors_to_another_request(ov::SoPtr<ov::IAsyncInferRequest>& req);
 
+    // the tensors of the request are the views of its slot in the batched tensors, so the inputs and the outputs are
+    // copied only when the user sets other host tensors
     void copy_inputs_if_needed();
 
     void copy_outputs_if_needed();
 
+    // the remote tensors set by the user can not be viewed by the batched request, so the request executes without
+    // batching to avoid the copy through the host memory
+    bool has_remote_tensors() const;
+
     void infer() override;
 
+    // the states of the stateful model are the views of the request's slot in the states of the batched request
     std::vector<ov::SoPtr<ov::IVariableState>> query_state() const override;
 
+    bool is_stateful() const {
+        return m_stateful;
+    }
+
+    size_t get_batch_id() const {
+        return m_batch_id;
+    }
+
     std::vector<ov::ProfilingInfo> get_profiling_info() const override;
 
     std::shared_ptr<ov::autobatch_plugin::CompiledModel::WorkerInferRequest> m_batched_request_wrapper;
@@ -52,6 +67,9 @@ protected:
     size_t m_batch_id;
 
     size_t m_batch_size;
+
+    // the states live in the batched request, so the request is never executed without batching
+    const bool m_stateful;
 };
 }  // namespace autobatch_plugin
 }  // namespace ov
\ No newline at end of file
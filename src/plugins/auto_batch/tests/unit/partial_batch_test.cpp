@@ -0,0 +1,189 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "mock_common.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/assign.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/read_value.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/util/variable.hpp"
+#include "openvino/runtime/threading/immediate_executor.hpp"
+#include "transformations/utils/utils.hpp"
+#include "unit_test_utils/mocks/openvino/runtime/mock_icore.hpp"
+
+using ::testing::NiceMock;
+using ::testing::Return;
+
+class TestVariableState : public ov::IVariableState {
+public:
+    TestVariableState(const std::string& name, const ov::SoPtr<ov::ITensor>& tensor) : ov::IVariableState(name) {
+        m_state = tensor;
+    }
+    void set_state(const ov::SoPtr<ov::ITensor>& state) override {
+        state->copy_to(m_state._ptr);
+    }
+    void reset() override {
+        std::memset(m_state->data(), 0, m_state->get_byte_size());
+    }
+};
+
+class AutoBatchPartialBatchTest : public ::testing::Test {
+public:
+    const size_t m_batch_size = 4;
+    const std::vector<float> m_initial_value = {5.f, 6.f};
+
+    std::shared_ptr<NiceMock<ov::MockICore>> m_core;
+    std::shared_ptr<NiceMock<MockAutoBatchInferencePlugin>> m_auto_batch_plugin;
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_without_batch;
+    std::shared_ptr<NiceMock<MockICompiledModel>> m_i_compile_model_with_batch;
+    std::shared_ptr<MockAutoBatchCompileModel> m_auto_batch_compile_model;
+    std::shared_ptr<NiceMock<MockISyncInferRequest>> m_sync_infer_request_with_batch;
+    std::shared_ptr<NiceMock<MockIAsyncInferRequest>> m_async_infer_request_with_batch;
+    std::shared_ptr<CompiledModel::WorkerInferRequest> m_worker;
+    std::set<std::string> m_batched_inputs;
+    std::set<std::string> m_batched_outputs;
+    ov::SoPtr<ov::ITensor> m_batched_state;
+    std::vector<std::shared_ptr<SyncInferRequest>> m_requests;
+
+    // the running sum of the inputs, starting from the constant initial value
+    std::shared_ptr<ov::Model> make_model(size_t batch_size) {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{batch_size, 2});
+        auto variable = std::make_shared<ov::op::util::Variable>(
+            ov::op::util::VariableInfo{ov::PartialShape{ov::Dimension::dynamic(), 2}, ov::element::f32, "sum"});
+        std::vector<float> initial;
+        for (size_t b = 0; b < batch_size; b++)
+            initial.insert(initial.end(), m_initial_value.begin(), m_initial_value.end());
+        auto init = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{batch_size, 2}, initial);
+        auto read_value = std::make_shared<ov::op::v6::ReadValue>(init, variable);
+        auto add = std::make_shared<ov::op::v1::Add>(param, read_value);
+        auto assign = std::make_shared<ov::op::v6::Assign>(add, variable);
+        auto result = std::make_shared<ov::op::v0::Result>(add);
+        return std::make_shared<ov::Model>(ov::ResultVector{result},
+                                           ov::SinkVector{assign},
+                                           ov::ParameterVector{param});
+    }
+
+    void SetUp() override {
+        auto model = make_model(1);
+        m_core = std::make_shared<NiceMock<ov::MockICore>>();
+        m_auto_batch_plugin = std::make_shared<NiceMock<MockAutoBatchInferencePlugin>>();
+        m_auto_batch_plugin->set_core(m_core);
+        m_i_compile_model_without_batch = std::make_shared<NiceMock<MockICompiledModel>>(model, m_auto_batch_plugin);
+        m_i_compile_model_with_batch =
+            std::make_shared<NiceMock<MockICompiledModel>>(make_model(m_batch_size), m_auto_batch_plugin);
+
+        m_batched_inputs = {ov::op::util::get_ie_output_name(model->get_parameters()[0]->output(0))};
+        m_batched_outputs = {ov::op::util::get_ie_output_name(model->get_results()[0]->input_value(0))};
+        DeviceInformation device_info = {"CPU", {}, static_cast<uint32_t>(m_batch_size)};
+        ov::SoPtr<ov::ICompiledModel> compile_model_with_batch = {m_i_compile_model_with_batch, {}};
+        ov::SoPtr<ov::ICompiledModel> compile_model_without_batch = {m_i_compile_model_without_batch, {}};
+        ov::AnyMap config = {{"AUTO_BATCH_TIMEOUT", "200"}};
+        m_auto_batch_compile_model = std::make_shared<MockAutoBatchCompileModel>(model->clone(),
+                                                                                 m_auto_batch_plugin,
+                                                                                 config,
+                                                                                 device_info,
+                                                                                 m_batched_inputs,
+                                                                                 m_batched_outputs,
+                                                                                 compile_model_with_batch,
+                                                                                 compile_model_without_batch,
+                                                                                 ov::SoPtr<ov::IRemoteContext>{});
+
+        m_batched_state = {ov::make_tensor(ov::element::f32, ov::Shape{m_batch_size, 2}), {}};
+        auto state = std::make_shared<TestVariableState>("sum", m_batched_state);
+        m_sync_infer_request_with_batch =
+            std::make_shared<NiceMock<MockISyncInferRequest>>(m_i_compile_model_with_batch);
+        ON_CALL(*m_sync_infer_request_with_batch, query_state())
+            .WillByDefault(Return(std::vector<ov::SoPtr<ov::IVariableState>>{{state, {}}}));
+        m_async_infer_request_with_batch =
+            std::make_shared<NiceMock<MockIAsyncInferRequest>>(m_sync_infer_request_with_batch,
+                                                               std::make_shared<ov::threading::ImmediateExecutor>(),
+                                                               nullptr);
+
+        m_worker = std::make_shared<CompiledModel::WorkerInferRequest>();
+        m_worker->_infer_request_batched = {m_async_infer_request_with_batch, {}};
+        m_worker->_batch_size = static_cast<int>(m_batch_size);
+        m_worker->_completion_tasks.resize(m_batch_size);
+        m_worker->_batched_slots.resize(m_batch_size);
+
+        for (size_t batch_id = 0; batch_id < m_batch_size; batch_id++) {
+            m_requests.push_back(std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                                    m_worker,
+                                                                    static_cast<int>(batch_id),
+                                                                    static_cast<int>(m_batch_size),
+                                                                    m_batched_inputs,
+                                                                    m_batched_outputs));
+        }
+    }
+
+    void TearDown() override {
+        m_requests.clear();
+        m_worker.reset();
+        m_async_infer_request_with_batch.reset();
+        m_sync_infer_request_with_batch.reset();
+        m_auto_batch_compile_model.reset();
+    }
+
+    static void fill(const ov::SoPtr<ov::ITensor>& tensor, float value) {
+        auto data = static_cast<float*>(tensor->data());
+        std::fill(data, data + tensor->get_size(), value);
+    }
+
+    static std::vector<float> values(const ov::SoPtr<ov::ITensor>& tensor) {
+        auto data = static_cast<const float*>(tensor->data());
+        return std::vector<float>(data, data + tensor->get_size());
+    }
+
+    // executes the requests of the slots as the partial batch, the device writes the value to all the slots
+    void execute_partial_batch(const std::vector<bool>& slots, float value) {
+        m_worker->_batched_slots = slots;
+        m_worker->start_partial_batch(m_batched_outputs);
+        const auto& output = m_async_infer_request_with_batch->get_outputs()[0];
+        fill(m_async_infer_request_with_batch->get_tensor(output), value);
+        fill(m_batched_state, value);
+        m_worker->complete_partial_batch();
+    }
+};
+
+TEST_F(AutoBatchPartialBatchTest, PartialBatchKeepsStatesOfIdleRequests) {
+    for (size_t batch_id = 0; batch_id < m_batch_size; batch_id++) {
+        std::vector<float> value(2, static_cast<float>(batch_id));
+        auto state = ov::make_tensor(ov::element::f32, {1, 2}, value.data());
+        m_requests[batch_id]->query_state()[0]->set_state({state, {}});
+    }
+
+    execute_partial_batch({true, false, true, false}, 9.f);
+
+    for (size_t batch_id = 0; batch_id < m_batch_size; batch_id++) {
+        const float expected = batch_id % 2 ? static_cast<float>(batch_id) : 9.f;
+        EXPECT_EQ(values(m_requests[batch_id]->query_state()[0]->get_state()), std::vector<float>(2, expected));
+    }
+}
+
+TEST_F(AutoBatchPartialBatchTest, ResetRestoresInitialValueOfSlot) {
+    fill(m_batched_state, 1.f);
+    m_requests[1]->query_state()[0]->reset();
+
+    EXPECT_EQ(values(m_requests[1]->query_state()[0]->get_state()), m_initial_value);
+    for (size_t batch_id : {0, 2, 3})
+        EXPECT_EQ(values(m_requests[batch_id]->query_state()[0]->get_state()), std::vector<float>(2, 1.f));
+}
+
+TEST_F(AutoBatchPartialBatchTest, PartialBatchKeepsOutputsOfIdleRequests) {
+    const auto& output = m_requests[0]->get_outputs()[0];
+    fill(m_async_infer_request_with_batch->get_tensor(output), 1.f);
+    const auto batched_output = m_async_infer_request_with_batch->get_tensor(output);
+
+    execute_partial_batch({false, true, false, true}, 9.f);
+
+    EXPECT_EQ(m_async_infer_request_with_batch->get_tensor(output)._ptr, batched_output._ptr);
+    for (size_t batch_id = 0; batch_id < m_batch_size; batch_id++) {
+        const float expected = batch_id % 2 ? 9.f : 1.f;
+        EXPECT_EQ(values(m_requests[batch_id]->get_tensor(output)), std::vector<float>(2, expected));
+    }
+}
@@ -222,6 +222,26 @@ TEST_P(AutoBatchRequestTest, AutoBatchRequestCopyOutputTensorTestCase) {
     EXPECT_NO_THROW(req->copy_outputs_if_needed());
 }
 
+TEST_P(AutoBatchRequestTest, AutoBatchRequestTensorsShareBatchedTensorsTestCase) {
+    prepare_input(m_model, m_batch_size);
+    create_worker(m_batch_size);
+
+    auto req = std::make_shared<SyncInferRequest>(m_auto_batch_compile_model,
+                                                  workerRequestPtr,
+                                                  0,
+                                                  m_batch_size,
+                                                  m_batched_inputs,
+                                                  m_batched_outputs);
+    EXPECT_NE(req, nullptr);
+    m_auto_batch_infer_requests.emplace_back(req);
+
+    for (const auto& input : req->get_inputs()) {
+        EXPECT_EQ(req->get_tensor(input)->data(),
+                  workerRequestPtr->_infer_request_batched->get_tensor(input)->data());
+    }
+    EXPECT_FALSE(req->has_remote_tensors());
+}
+
 TEST_P(AutoBatchRequestTest, AutoBatchRequestGetProfilingInfoTestCase) {
     prepare_input(m_model, m_batch_size);
     create_worker(m_batch_size);
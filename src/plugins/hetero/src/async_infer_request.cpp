@@ -26,6 +26,8 @@ ov::hetero::AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<ov::heter
                                                  const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
     : ov::IAsyncInferRequest(request, task_executor, callback_executor),
       m_infer_request(std::static_pointer_cast<ov::hetero::InferRequest>(request)) {
+    // each submodel is a stage started by the completion of the previous one, so while the request executes a stage
+    // on one device, the other requests execute their stages on the other devices
     m_pipeline.clear();
     for (auto&& request : m_infer_request->m_subrequests) {
         auto request_executor = std::make_shared<RequestExecutor>(request);
@@ -4,6 +4,7 @@
 
 #include "compiled_model.hpp"
 
+#include <map>
 #include <memory>
 
 #include "async_infer_request.hpp"
@@ -490,11 +491,20 @@ ov::Any ov::hetero::CompiledModel::get_property(const std::string& name) const {
     } else if (ov::loaded_from_cache == name) {
         return decltype(ov::loaded_from_cache)::value_type{m_loaded_from_cache};
     } else if (ov::optimal_number_of_infer_requests == name) {
-        unsigned int value = 0u;
+        // every request occupies one submodel's device at a time, so the requests keeping each device busy add up
+        // for the devices to execute the submodels of the different requests in parallel. The submodels of the same
+        // device are executed by the same device streams, so the device needs the most of their requests only
+        std::map<std::string, unsigned int> device_requests;
         for (const auto& comp_model_desc : m_compiled_submodels) {
-            value = std::max(value,
-                             comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
-                                 .as<unsigned int>());
+            const auto submodel_requests =
+                comp_model_desc.compiled_model->get_property(ov::optimal_number_of_infer_requests.name())
+                    .as<unsigned int>();
+            auto& requests = device_requests[comp_model_desc.device];
+            requests = std::max(requests, submodel_requests);
+        }
+        unsigned int value = 0u;
+        for (const auto& requests : device_requests) {
+            value += requests.second;
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
     } else if (ov::execution_devices == name) {
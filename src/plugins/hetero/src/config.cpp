@@ -7,10 +7,11 @@
 #include "ie/ie_plugin_config.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "properties.hpp"
 
 using namespace ov::hetero;
 
-Configuration::Configuration() : dump_graph(false) {}
+Configuration::Configuration() : dump_graph(false), merge_small_islands(false), split_by_memory(false) {}
 
 Configuration::Configuration(const ov::AnyMap& config, const Configuration& defaultCfg, bool throwOnUnsupported) {
     OPENVINO_SUPPRESS_DEPRECATED_START
@@ -22,6 +23,10 @@ Configuration::Configuration(const ov::AnyMap& config, const Configuration& defa
 
         if (HETERO_CONFIG_KEY(DUMP_GRAPH_DOT) == key) {
             dump_graph = value.as<bool>();
+        } else if (ov::hetero::merge_small_islands == key) {
+            merge_small_islands = value.as<bool>();
+        } else if (ov::hetero::split_by_memory == key) {
+            split_by_memory = value.as<bool>();
         } else if ("TARGET_FALLBACK" == key || ov::device::priorities == key) {
             device_priorities = value.as<std::string>();
         } else {
@@ -37,6 +42,10 @@ ov::Any Configuration::get(const std::string& name) const {
     OPENVINO_SUPPRESS_DEPRECATED_START
     if (name == HETERO_CONFIG_KEY(DUMP_GRAPH_DOT)) {
         return {dump_graph};
+    } else if (name == ov::hetero::merge_small_islands) {
+        return {merge_small_islands};
+    } else if (name == ov::hetero::split_by_memory) {
+        return {split_by_memory};
     } else if (name == "TARGET_FALLBACK" || name == ov::device::priorities) {
         return {device_priorities};
     } else {
@@ -48,6 +57,8 @@ ov::Any Configuration::get(const std::string& name) const {
 std::vector<ov::PropertyName> Configuration::get_supported() const {
     OPENVINO_SUPPRESS_DEPRECATED_START
     static const std::vector<ov::PropertyName> names = {HETERO_CONFIG_KEY(DUMP_GRAPH_DOT),
+                                                        ov::hetero::merge_small_islands,
+                                                        ov::hetero::split_by_memory,
                                                         "TARGET_FALLBACK",
                                                         ov::device::priorities};
     return names;
@@ -57,6 +68,8 @@ std::vector<ov::PropertyName> Configuration::get_supported() const {
 ov::AnyMap Configuration::get_hetero_properties() const {
     OPENVINO_SUPPRESS_DEPRECATED_START
     return {{HETERO_CONFIG_KEY(DUMP_GRAPH_DOT), dump_graph},
+            {ov::hetero::merge_small_islands.name(), merge_small_islands},
+            {ov::hetero::split_by_memory.name(), split_by_memory},
             {"TARGET_FALLBACK", device_priorities},
             {ov::device::priorities.name(), device_priorities}};
     OPENVINO_SUPPRESS_DEPRECATED_END
@@ -32,6 +32,8 @@ struct Configuration {
     ov::AnyMap get_device_properties() const;
 
     bool dump_graph;
+    bool merge_small_islands;
+    bool split_by_memory;
     std::string device_priorities;
     ov::AnyMap device_properties;
 };
@@ -4,9 +4,11 @@
 
 #include "plugin.hpp"
 
+#include <algorithm>
 #include <fstream>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -15,12 +17,203 @@
 #include "compiled_model.hpp"
 #include "ie/ie_plugin_config.hpp"
 #include "itt.hpp"
+#include "openvino/op/util/op_types.hpp"
 #include "openvino/runtime/device_id_parser.hpp"
+#include "openvino/runtime/intel_gpu/properties.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
 #include "properties.hpp"
 
+namespace {
+// The islands of at most this number of operations are moved to the device around them
+constexpr size_t max_island_size = 4;
+
+// Every crossing of the devices costs the transfer of the tensors and the synchronization of the subgraphs, which
+// outweighs the offload of a few operations. So the island of the operations surrounded by the operations of one
+// other device is moved to that device, if it supports them. It breaks the device priorities, so it is done only if
+// ov::hetero::merge_small_islands is set.
+void merge_device_islands(const std::shared_ptr<const ov::Model>& model,
+                          const std::map<std::string, ov::SupportedOpsMap>& query_results,
+                          ov::SupportedOpsMap& affinities) {
+    const auto supports = [&query_results](const std::string& device, const std::string& name) {
+        const auto it = query_results.find(device);
+        return it != query_results.end() && it->second.count(name);
+    };
+    const auto neighbours = [](const ov::Node* node) {
+        std::vector<ov::Node*> result;
+        for (const auto& input : node->input_values())
+            result.push_back(input.get_node());
+        for (const auto& output : node->outputs())
+            for (const auto& target : output.get_target_inputs())
+                result.push_back(target.get_node());
+        return result;
+    };
+
+    const auto ordered_ops = model->get_ordered_ops();
+    std::unordered_set<const ov::Node*> visited;
+    for (const auto& op : ordered_ops) {
+        // the constants are not the islands, they follow their consumers below
+        if (visited.count(op.get()) || ov::op::util::is_constant(op))
+            continue;
+        const auto affinity = affinities.find(op->get_friendly_name());
+        if (affinity == affinities.end())
+            continue;
+        const auto device = affinity->second;
+        // collect the connected operations of the same device
+        std::vector<ov::Node*> island;
+        std::set<std::string> neighbour_devices;
+        size_t island_size = 0;
+        std::unordered_set<const ov::Node*> members{op.get()};
+        std::vector<ov::Node*> stack{op.get()};
+        visited.insert(op.get());
+        while (!stack.empty()) {
+            auto node = stack.back();
+            stack.pop_back();
+            island.push_back(node);
+            if (!ov::op::util::is_parameter(node) && !ov::op::util::is_output(node))
+                island_size++;
+            for (auto neighbour : neighbours(node)) {
+                if (ov::op::util::is_constant(neighbour))
+                    continue;
+                const auto it = affinities.find(neighbour->get_friendly_name());
+                if (it == affinities.end())
+                    continue;
+                if (it->second != device) {
+                    neighbour_devices.insert(it->second);
+                } else if (members.insert(neighbour).second) {
+                    visited.insert(neighbour);
+                    stack.push_back(neighbour);
+                }
+            }
+        }
+        if (neighbour_devices.size() != 1 || island_size > max_island_size)
+            continue;
+        const auto target_device = *neighbour_devices.begin();
+        if (!std::all_of(island.begin(), island.end(), [&](const ov::Node* node) {
+                return supports(target_device, node->get_friendly_name());
+            }))
+            continue;
+        for (auto node : island)
+            affinities[node->get_friendly_name()] = target_device;
+    }
+
+    // the constants consumed by one device are placed on it, so they do not turn into the parameters of the subgraphs
+    for (const auto& op : ordered_ops) {
+        if (!ov::op::util::is_constant(op))
+            continue;
+        std::set<std::string> consumer_devices;
+        for (const auto& target : op->output(0).get_target_inputs()) {
+            const auto it = affinities.find(target.get_node()->get_friendly_name());
+            if (it != affinities.end())
+                consumer_devices.insert(it->second);
+        }
+        if (consumer_devices.size() == 1 && supports(*consumer_devices.begin(), op->get_friendly_name()))
+            affinities[op->get_friendly_name()] = *consumer_devices.begin();
+    }
+}
+
+// Part of the device memory taken by the weights and the activations of the model, the rest is left for the runtime
+constexpr double model_memory_ratio = 0.8;
+
+size_t get_output_bytes(const ov::Node* node) {
+    size_t bytes = 0;
+    for (const auto& output : node->outputs()) {
+        if (output.get_partial_shape().is_static())
+            bytes += ov::shape_size(output.get_shape()) * output.get_element_type().size();
+    }
+    return bytes;
+}
+
+// Walks the model in the topological order and places each operation on the first device in the priority list which
+// supports it and still has the memory for its weights. A device running out of the memory is not used for the rest
+// of the model, so every device gets a contiguous range of the layers. The activations are reused by the device
+// plugins, so only the largest activation of each device is counted. Returns false if the model fits into the
+// first devices, i.e. the memory did not change the placement. It moves the operations off the devices preferred by
+// the priorities, so it is done only if ov::hetero::split_by_memory is set.
+bool split_by_device_memory(const std::shared_ptr<const ov::Model>& model,
+                            const std::vector<std::string>& device_names,
+                            const std::map<std::string, ov::SupportedOpsMap>& query_results,
+                            const std::map<std::string, uint64_t>& memory_sizes,
+                            ov::SupportedOpsMap& affinities) {
+    struct MemoryUsage {
+        size_t weights = 0;
+        size_t max_activation = 0;
+    };
+    std::map<std::string, MemoryUsage> usages;
+    const auto supports = [&query_results](const std::string& device, const std::string& name) {
+        const auto it = query_results.find(device);
+        return it != query_results.end() && it->second.count(name);
+    };
+    const auto fits = [&memory_sizes](const std::string& device, const MemoryUsage& usage) {
+        const auto it = memory_sizes.find(device);
+        return it == memory_sizes.end() ||
+               usage.weights + usage.max_activation <= static_cast<double>(it->second) * model_memory_ratio;
+    };
+
+    bool split = false;
+    // the devices before this one are full
+    size_t first_device = 0;
+    const auto ordered_ops = model->get_ordered_ops();
+    for (const auto& op : ordered_ops) {
+        if (ov::op::util::is_constant(op))
+            continue;
+        const auto& name = op->get_friendly_name();
+        std::vector<const ov::Node*> weights;
+        size_t weights_bytes = 0;
+        for (const auto& input : op->input_values()) {
+            const auto source = input.get_node();
+            if (ov::op::util::is_constant(source) && !affinities.count(source->get_friendly_name())) {
+                weights.push_back(source);
+                weights_bytes += get_output_bytes(source);
+            }
+        }
+
+        std::string device;
+        for (size_t i = first_device; i < device_names.size() && device.empty(); i++) {
+            const auto& candidate = device_names[i];
+            if (!supports(candidate, name))
+                continue;
+            auto usage = usages[candidate];
+            usage.weights += weights_bytes;
+            usage.max_activation = std::max(usage.max_activation, get_output_bytes(op.get()));
+            if (fits(candidate, usage)) {
+                device = candidate;
+                usages[candidate] = usage;
+            } else if (i == first_device) {
+                first_device++;
+                split = true;
+            }
+        }
+        // no device has the memory left, so the operation falls back to the placement by the priority
+        for (size_t i = 0; i < device_names.size() && device.empty(); i++) {
+            if (supports(device_names[i], name))
+                device = device_names[i];
+        }
+        if (device.empty())
+            continue;
+        affinities[name] = device;
+        for (const auto weight : weights) {
+            if (supports(device, weight->get_friendly_name()))
+                affinities[weight->get_friendly_name()] = device;
+        }
+    }
+
+    // the constants not supported by the device of their consumer are placed by the priority
+    for (const auto& op : ordered_ops) {
+        if (!ov::op::util::is_constant(op) || affinities.count(op->get_friendly_name()))
+            continue;
+        for (const auto& device_name : device_names) {
+            if (supports(device_name, op->get_friendly_name())) {
+                affinities[op->get_friendly_name()] = device_name;
+                break;
+            }
+        }
+    }
+    return split;
+}
+}  // namespace
+
 ov::hetero::Plugin::Plugin() {
     set_device_name("HETERO");
 }
@@ -89,13 +282,36 @@ ov::SupportedOpsMap ov::hetero::Plugin::query_model(const std::shared_ptr<const
     auto device_names = ov::DeviceIDParser::get_hetero_devices(full_config.device_priorities);
 
     ov::SupportedOpsMap res;
+    if (full_config.split_by_memory && query_results.size() > 1) {
+        std::map<std::string, uint64_t> memory_sizes;
+        for (const auto& device_name : device_names) {
+            const auto memory_size = get_device_memory_size(device_name);
+            if (memory_size)
+                memory_sizes[device_name] = memory_size;
+        }
+        if (!memory_sizes.empty() && split_by_device_memory(model, device_names, query_results, memory_sizes, res))
+            return res;
+    }
+
+    res.clear();
     for (const auto& device_name : device_names)
         for (const auto& layer_query_result : query_results[device_name])
             res.emplace(layer_query_result);
 
+    if (full_config.merge_small_islands && query_results.size() > 1)
+        merge_device_islands(model, query_results, res);
+
     return res;
 }
 
+uint64_t ov::hetero::Plugin::get_device_memory_size(const std::string& device_name) const {
+    // only the memory size of the device is exposed, so the weights of other models on it are not taken into account
+    auto supported_properties = get_core()->get_property(device_name, ov::supported_properties);
+    if (!ov::util::contains(supported_properties, ov::intel_gpu::device_total_mem_size))
+        return 0;
+    return get_core()->get_property(device_name, ov::intel_gpu::device_total_mem_size);
+}
+
 void ov::hetero::Plugin::set_property(const ov::AnyMap& properties) {
     m_cfg = Configuration{properties, m_cfg, true};
 }
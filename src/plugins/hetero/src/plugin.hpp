@@ -59,6 +59,8 @@ private:
     DeviceProperties get_properties_per_device(const std::string& device_priorities,
                                                const ov::AnyMap& properties) const;
 
+    uint64_t get_device_memory_size(const std::string& device_name) const;
+
     Configuration m_cfg;
 };
 
@@ -18,5 +18,19 @@ static constexpr Property<std::string, PropertyMutability::RO> caching_device_pr
  */
 static constexpr Property<size_t, PropertyMutability::RO> number_of_submodels{"HETERO_NUMBER_OF_SUBMODELS"};
 
+/**
+ * @brief Enables moving the small islands of operations surrounded by another device to that device, if it supports
+ * them, so the model is split into fewer subgraphs at the cost of not following the device priorities. Disabled by
+ * default.
+ */
+static constexpr Property<bool> merge_small_islands{"HETERO_MERGE_SMALL_ISLANDS"};
+
+/**
+ * @brief Enables placing the operations by the memory size of the devices, so the layers which don't fit into the
+ * memory of a device go to the next device in the priority list. Only the devices reporting their total memory size
+ * are bounded. Disabled by default.
+ */
+static constexpr Property<bool> split_by_memory{"HETERO_SPLIT_BY_MEMORY"};
+
 }  // namespace hetero
 }  // namespace ov
@@ -9,10 +9,12 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "compiled_model.hpp"
 #include "itt.hpp"
 #include "openvino/core/except.hpp"
+#include "openvino/runtime/device_id_parser.hpp"
 #include "plugin.hpp"
 
 ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::CompiledModel>& compiled_model)
@@ -33,16 +35,42 @@ ov::hetero::InferRequest::InferRequest(const std::shared_ptr<const ov::hetero::C
         m_port_to_subrequest_idx[port] = submodel_idx;
     }
 
+    std::map<std::pair<size_t, size_t>, std::vector<std::pair<size_t, size_t>>> prev_output_to_submodels_inputs;
     for (const auto& kvp : compiled_model->m_submodels_input_to_prev_output) {
-        const auto& submodel_idx_in = kvp.first.first;
-        const auto& port_idx_in = kvp.first.second;
-        const auto& submodel_idx_out = kvp.second.first;
-        const auto& port_idx_out = kvp.second.second;
+        prev_output_to_submodels_inputs[kvp.second].push_back(kvp.first);
+    }
 
+    auto is_cpu = [&](size_t submodel_idx) {
+        return ov::DeviceIDParser(compiled_model->m_compiled_submodels[submodel_idx].device).get_device_name() == "CPU";
+    };
+    for (const auto& kvp : prev_output_to_submodels_inputs) {
+        const auto& submodel_idx_out = kvp.first.first;
+        const auto& port_idx_out = kvp.first.second;
         const auto& output_port = m_subrequests[submodel_idx_out]->get_compiled_model()->outputs()[port_idx_out];
-        const auto& output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
-        const auto& input_port = m_subrequests[submodel_idx_in]->get_compiled_model()->inputs()[port_idx_in];
-        m_subrequests[submodel_idx_in]->set_tensor(input_port, output_tensor);
+        auto output_tensor = m_subrequests[submodel_idx_out]->get_tensor(output_port);
+
+        // The CPU works with any host memory in place, while the other devices share only the memory of their own
+        // allocation (e.g. USM host memory of the integrated GPU) and copy the rest. So the tensor between the CPU
+        // and such device is allocated by the device, then neither request copies it.
+        if (is_cpu(submodel_idx_out) && output_port.get_partial_shape().is_static()) {
+            for (const auto& input : kvp.second) {
+                if (is_cpu(input.first))
+                    continue;
+                const auto& input_port = m_subrequests[input.first]->get_compiled_model()->inputs()[input.second];
+                auto input_tensor = m_subrequests[input.first]->get_tensor(input_port);
+                if (input_tensor->get_element_type() == output_tensor->get_element_type() &&
+                    input_tensor->get_shape() == output_tensor->get_shape()) {
+                    m_subrequests[submodel_idx_out]->set_tensor(output_port, input_tensor);
+                    output_tensor = input_tensor;
+                    break;
+                }
+            }
+        }
+
+        for (const auto& input : kvp.second) {
+            const auto& input_port = m_subrequests[input.first]->get_compiled_model()->inputs()[input.second];
+            m_subrequests[input.first]->set_tensor(input_port, output_tensor);
+        }
     }
 }
 
@@ -98,6 +98,19 @@ TEST_F(HeteroTests, compile_with_device_properties_no_exclusive) {
     EXPECT_EQ(6, mock1_properties.at(ov::num_streams.name()).as<ov::streams::Num>());
 }
 
+TEST_F(HeteroTests, optimal_number_of_infer_requests_per_device) {
+    ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1"),
+                         ov::internal::exclusive_async_requests(false),
+                         ov::device::properties("MOCK0", ov::num_streams(4)),
+                         ov::device::properties("MOCK1", ov::num_streams(6))};
+    // add and reshape are executed by MOCK0, subtract by MOCK1
+    auto model = create_model_with_subtract_reshape();
+    auto compiled_model = core.compile_model(model, "HETERO", config);
+    ASSERT_EQ(3, compiled_model.get_property("HETERO_NUMBER_OF_SUBMODELS").as<size_t>());
+    // the submodels of MOCK0 share its streams, so they are not counted twice
+    EXPECT_EQ(10, compiled_model.get_property(ov::optimal_number_of_infer_requests));
+}
+
 TEST_F(HeteroTests, get_runtime_model) {
     ov::AnyMap config = {ov::device::priorities("MOCK0,MOCK1")};
     auto model = create_model_with_subtract_reshape();
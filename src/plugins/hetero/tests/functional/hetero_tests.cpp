@@ -16,6 +16,7 @@
 #include "openvino/pass/manager.hpp"
 #include "openvino/pass/serialize.hpp"
 #include "openvino/runtime/exec_model_info.hpp"
+#include "openvino/runtime/intel_gpu/properties.hpp"
 #include "openvino/runtime/internal_properties.hpp"
 #include "openvino/runtime/iplugin.hpp"
 #include "openvino/runtime/iremote_context.hpp"
@@ -41,6 +42,9 @@ std::function<T> make_std_function(const std::shared_ptr<void> so, const std::st
     return ptr;
 }
 
+// the memory size reported by MOCK0 like the one of GPU, the devices reporting it are bounded by HETERO_SPLIT_BY_MEMORY
+constexpr uint64_t mock_device_total_mem_size = 1000;
+
 bool support_model(const std::shared_ptr<const ov::Model>& model, const ov::SupportedOpsMap& supported_ops) {
     for (const auto& op : model->get_ops()) {
         if (supported_ops.find(op->get_friendly_name()) == supported_ops.end())
@@ -242,6 +246,10 @@ public:
             return m_config.count(ov::num_streams.name()) ? m_config.at(ov::num_streams.name()) : ov::streams::Num(1);
         } else if (name == ov::enable_profiling) {
             return m_config.count(ov::enable_profiling.name()) ? m_config.at(ov::enable_profiling.name()) : false;
+        } else if (name == ov::optimal_number_of_infer_requests) {
+            // a request per stream keeps the device busy
+            const auto streams = get_property(ov::num_streams.name()).as<ov::streams::Num>();
+            return decltype(ov::optimal_number_of_infer_requests)::value_type(streams.num);
         } else {
             OPENVINO_THROW("get property: " + name);
         }
@@ -594,6 +602,7 @@ public:
             RO_property(ov::loaded_from_cache.name()),
             RO_property(ov::device::uuid.name()),
             RO_property(METRIC_KEY(IMPORT_EXPORT_SUPPORT)),
+            RO_property(ov::intel_gpu::device_total_mem_size.name()),
         };
         // the whole config is RW before network is loaded.
         const static std::vector<ov::PropertyName> rwProperties{
@@ -658,6 +667,8 @@ public:
             return decltype(ov::enable_profiling)::value_type{m_profiling};
         } else if (name == ov::streams::num.name()) {
             return decltype(ov::streams::num)::value_type{num_streams};
+        } else if (name == ov::intel_gpu::device_total_mem_size) {
+            return decltype(ov::intel_gpu::device_total_mem_size)::value_type{mock_device_total_mem_size};
         }
         OPENVINO_THROW("Unsupported property: ", name);
     }
@@ -39,6 +39,8 @@ TEST_F(HeteroTests, get_property_supported_metrics) {
 
 TEST_F(HeteroTests, get_property_supported_configs) {
     const std::vector<std::string> supported_configs = {"HETERO_DUMP_GRAPH_DOT",
+                                                        "HETERO_MERGE_SMALL_ISLANDS",
+                                                        "HETERO_SPLIT_BY_MEMORY",
                                                         "TARGET_FALLBACK",
                                                         ov::device::priorities.name()};
     auto actual_supported_configs =
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "hetero_tests.hpp"
+#include "openvino/opsets/opset11.hpp"
 
 using namespace ov::hetero::tests;
 
@@ -72,6 +73,75 @@ TEST_F(HeteroTests, query_model_on_mixed) {
     EXPECT_EQ(0, names.size());
 }
 
+TEST_F(HeteroTests, query_model_on_mixed_merge_small_islands) {
+    const std::string dev_name0 = "MOCK0.3";
+    const std::string dev_name1 = "MOCK1.2";
+    ov::AnyMap config = {ov::device::priorities(dev_name0 + "," + dev_name1), {"HETERO_MERGE_SMALL_ISLANDS", true}};
+    const auto model = create_model_with_subtract_reshape();
+    // the input and the add are moved to the device of the subtract, to not cross the devices twice
+    const std::set<std::string> supported_ops_mock0{"reshape_val", "reshape", "res"};
+    const auto supported_ops = core.query_model(model, "HETERO", config);
+    std::unordered_set<std::string> names;
+    for (const auto& op : model->get_ops()) {
+        names.insert(op->get_friendly_name());
+    }
+    for (const auto& op : supported_ops) {
+        if (supported_ops_mock0.count(op.first))
+            EXPECT_EQ(op.second, dev_name0);
+        else
+            EXPECT_EQ(op.second, dev_name1);
+        names.erase(op.first);
+    }
+    EXPECT_EQ(0, names.size());
+}
+
+TEST_F(HeteroTests, query_model_on_mixed_split_by_memory) {
+    const std::string dev_name0 = "MOCK0.3";
+    const std::string dev_name1 = "MOCK1.2";
+    // each add takes the weights of 96 bytes and the activation of 96 bytes, MOCK0 reports the memory of 1000 bytes
+    // and gets the adds fitting into its 80%, the rest of the model goes to MOCK1
+    const size_t adds_num = 10;
+    const size_t adds_on_mock0 = 7;
+    auto param = std::make_shared<ov::opset11::Parameter>(ov::element::i64, ov::Shape{1, 3, 2, 2});
+    param->set_friendly_name("input");
+    ov::Output<ov::Node> output = param;
+    for (size_t i = 0; i < adds_num; i++) {
+        auto const_value = ov::opset11::Constant::create(ov::element::i64, ov::Shape{1, 3, 2, 2}, {i});
+        const_value->set_friendly_name("const_val" + std::to_string(i));
+        auto add = std::make_shared<ov::opset11::Add>(output, const_value);
+        add->set_friendly_name("add" + std::to_string(i));
+        output = add;
+    }
+    auto result = std::make_shared<ov::opset11::Result>(output);
+    result->set_friendly_name("res");
+    const auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    // the placement follows the priorities unless the split is requested
+    ov::AnyMap config = {ov::device::priorities(dev_name0 + "," + dev_name1)};
+    for (const auto& op : core.query_model(model, "HETERO", config))
+        EXPECT_EQ(op.second, dev_name0) << op.first;
+
+    config.emplace("HETERO_SPLIT_BY_MEMORY", true);
+    std::set<std::string> supported_ops_mock0{"input"};
+    for (size_t i = 0; i < adds_on_mock0; i++) {
+        supported_ops_mock0.insert("const_val" + std::to_string(i));
+        supported_ops_mock0.insert("add" + std::to_string(i));
+    }
+    const auto supported_ops = core.query_model(model, "HETERO", config);
+    std::unordered_set<std::string> names;
+    for (const auto& op : model->get_ops()) {
+        names.insert(op->get_friendly_name());
+    }
+    for (const auto& op : supported_ops) {
+        if (supported_ops_mock0.count(op.first))
+            EXPECT_EQ(op.second, dev_name0) << op.first;
+        else
+            EXPECT_EQ(op.second, dev_name1) << op.first;
+        names.erase(op.first);
+    }
+    EXPECT_EQ(0, names.size());
+}
+
 TEST_F(HeteroTests, query_dynamic_model_on_mixed) {
     const std::string dev_name0 = "MOCK0.3";
     const std::string dev_name1 = "MOCK1.2";
@@ -0,0 +1,310 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "batch_splitter.h"
+
+#include <blob_factory.hpp>
+#include <ie_compound_blob.h>
+#include <openvino/core/validation_util.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/op/util/binary_elementwise_arithmetic.hpp>
+#include <openvino/op/util/binary_elementwise_comparison.hpp>
+#include <openvino/op/util/binary_elementwise_logical.hpp>
+#include <openvino/op/util/reduction_base.hpp>
+#include <openvino/op/util/unary_elementwise_arithmetic.hpp>
+
+#include "transformations/cpu_opset/common/op/fully_connected.hpp"
+#include "transformations/cpu_opset/common/op/leaky_relu.hpp"
+#include "transformations/cpu_opset/common/op/power_static.hpp"
+#include "transformations/cpu_opset/common/op/swish_cpu.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <map>
+#include <numeric>
+#include <unordered_set>
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+#    include <tbb/task_group.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// the slice executed by fewer threads does not compensate the lost parallelism of the well parallelized layers
+constexpr int minThreadsPerSlice = 4;
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+// the constant axes don't contain the batch one
+bool excludesBatchAxis(const ov::Output<ov::Node>& axes, size_t rank) {
+    const auto constant = ov::get_constant_from_source(axes);
+    if (!constant)
+        return false;
+    const auto values = constant->cast_vector<int64_t>();
+    return std::none_of(values.begin(), values.end(), [rank](int64_t axis) {
+        return axis == 0 || axis == -static_cast<int64_t>(rank);
+    });
+}
+
+// the unbatched input is broadcast across the batch of the output
+bool isBroadcastAcrossBatch(const ov::Shape& shape, size_t outRank) {
+    return shape.size() < outRank || shape[0] == 1;
+}
+
+/**
+ * Checks that the elements of the batch (the outermost dimension) of the batched inputs are processed independently,
+ * so the node computes the same outputs for the slices of the batch. The unknown ops are considered dependent.
+ */
+bool processesBatchIndependently(const std::shared_ptr<ov::Node>& node, const std::vector<bool>& batchedInputs) {
+    using namespace ov::opset8;
+    const size_t rank = node->get_output_shape(0).size();
+    auto onlyDataBatched = [&]() {
+        return batchedInputs[0] &&
+               std::none_of(batchedInputs.begin() + 1, batchedInputs.end(), [](bool batched) { return batched; });
+    };
+
+    if (ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(node) ||
+        ov::is_type<ov::op::util::BinaryElementwiseArithmetic>(node) ||
+        ov::is_type<ov::op::util::BinaryElementwiseComparison>(node) ||
+        ov::is_type<ov::op::util::BinaryElementwiseLogical>(node) ||
+        ov::is_type<LogicalNot>(node) || ov::is_type<Convert>(node) || ov::is_type<Swish>(node) ||
+        ov::is_type<PRelu>(node) || ov::is_type<Select>(node) || ov::is_type<FakeQuantize>(node) ||
+        ov::is_type<ov::op::v0::BatchNormInference>(node) || ov::is_type<BatchNormInference>(node) ||
+        ov::is_type<Result>(node) || ov::is_type<LeakyReluNode>(node) || ov::is_type<PowerStaticNode>(node) ||
+        ov::is_type<SwishNode>(node)) {
+        for (size_t i = 0; i < batchedInputs.size(); i++) {
+            const auto& shape = node->get_input_shape(i);
+            if (batchedInputs[i] ? shape.size() != rank : !isBroadcastAcrossBatch(shape, rank))
+                return false;
+        }
+        return true;
+    }
+    // the batch of the data input is kept by the op, the others are the weights or the parameters
+    if (ov::is_type<Convolution>(node) || ov::is_type<GroupConvolution>(node) ||
+        ov::is_type<ConvolutionBackpropData>(node) || ov::is_type<GroupConvolutionBackpropData>(node) ||
+        ov::is_type<MaxPool>(node) || ov::is_type<ov::op::v1::MaxPool>(node) || ov::is_type<AvgPool>(node) ||
+        ov::is_type<DepthToSpace>(node) || ov::is_type<SpaceToDepth>(node) || ov::is_type<Reshape>(node) ||
+        ov::is_type<Squeeze>(node) || ov::is_type<Unsqueeze>(node) || ov::is_type<Tile>(node) ||
+        ov::is_type<FullyConnectedNode>(node)) {
+        return onlyDataBatched();
+    }
+    if (ov::is_type<Pad>(node)) {
+        auto hasNoBatchPad = [](const ov::Output<ov::Node>& pads) {
+            const auto constant = ov::get_constant_from_source(pads);
+            return constant && constant->cast_vector<int64_t>()[0] == 0;
+        };
+        return onlyDataBatched() && hasNoBatchPad(node->input_value(1)) && hasNoBatchPad(node->input_value(2));
+    }
+    if (const auto softmax = ov::as_type_ptr<ov::op::v1::Softmax>(node))
+        return softmax->get_axis() != 0;
+    if (const auto softmax = ov::as_type_ptr<Softmax>(node))
+        return softmax->get_axis() != 0 && softmax->get_axis() != -static_cast<int64_t>(rank);
+    if (const auto logSoftmax = ov::as_type_ptr<LogSoftmax>(node))
+        return logSoftmax->get_axis() != 0 && logSoftmax->get_axis() != -static_cast<int64_t>(rank);
+    if (const auto shuffle = ov::as_type_ptr<ShuffleChannels>(node))
+        return shuffle->get_axis() != 0 && shuffle->get_axis() != -static_cast<int64_t>(rank);
+    if (const auto topK = ov::as_type_ptr<ov::op::util::TopKBase>(node))
+        return onlyDataBatched() && topK->get_axis() != 0;
+    if (const auto concat = ov::as_type_ptr<Concat>(node)) {
+        // the unbatched inputs would be concatenated to each slice
+        return concat->get_concatenation_axis() != 0 &&
+               std::all_of(batchedInputs.begin(), batchedInputs.end(), [](bool batched) { return batched; });
+    }
+    if (const auto gather = ov::as_type_ptr<ov::op::util::GatherBase>(node))
+        return onlyDataBatched() && gather->get_batch_dims() == 0 && gather->get_axis() != 0;
+    if (const auto mvn = ov::as_type_ptr<ov::op::v0::MVN>(node))
+        return mvn->get_reduction_axes().count(0) == 0;
+    if (ov::is_type<ov::op::util::ReductionBase>(node) || ov::is_type<MVN>(node) || ov::is_type<NormalizeL2>(node) ||
+        ov::is_type<Split>(node) || ov::is_type<VariadicSplit>(node)) {
+        return onlyDataBatched() && excludesBatchAxis(node->input_value(1), node->get_input_shape(0).size());
+    }
+    if (ov::is_type<Transpose>(node)) {
+        const auto order = ov::get_constant_from_source(node->input_value(1));
+        return onlyDataBatched() && order && order->cast_vector<int64_t>()[0] == 0;
+    }
+    if (const auto matMul = ov::as_type_ptr<MatMul>(node)) {
+        for (size_t i = 0; i < 2; i++) {
+            const auto& shape = node->get_input_shape(i);
+            // the batch of the 2D inputs is the rows of the first matrix
+            const bool batchAsRows = i == 0 && shape.size() == 2 && !matMul->get_transpose_a();
+            if (batchedInputs[i] ? shape.size() != rank || (rank < 3 && !batchAsRows)
+                                 : rank >= 3 && !isBroadcastAcrossBatch(shape, rank))
+                return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Checks that the model computes the elements of the batch independently: the data of each batched tensor (the one
+ * depending on the data of the inputs) keeps the batch as the outermost dimension and is processed by the ops which
+ * don't mix the elements of the batch. The shape computations (e.g. ShapeOf) follow the batch of the slice after
+ * the reshape.
+ */
+bool isBatchIndependent(const std::shared_ptr<const ov::Model>& model, size_t batch) {
+    std::unordered_set<const ov::Node*> batchedNodes;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (ov::is_type<ov::op::v0::Parameter>(node)) {
+            batchedNodes.insert(node.get());
+            continue;
+        }
+        std::vector<bool> batchedInputs;
+        for (const auto& input : node->input_values())
+            batchedInputs.push_back(batchedNodes.count(input.get_node()) != 0);
+        if (std::none_of(batchedInputs.begin(), batchedInputs.end(), [](bool batched) { return batched; }) ||
+            ov::is_type<ov::op::v0::ShapeOf>(node) || ov::is_type<ov::op::v3::ShapeOf>(node))
+            continue;
+        if (!processesBatchIndependently(node, batchedInputs))
+            return false;
+        for (const auto& output : node->outputs()) {
+            const auto& shape = output.get_shape();
+            if (shape.empty() || shape[0] != batch)
+                return false;
+        }
+        batchedNodes.insert(node.get());
+    }
+    return true;
+}
+#endif
+}  // namespace
+
+size_t BatchSplitter::getSlicesNum(const std::shared_ptr<const ov::Model>& model, int threadsNum) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    if (model->is_dynamic() || !model->get_variables().empty() || !model->get_sinks().empty())
+        return 1;
+
+    size_t batch = 0;
+    auto isBatchOf = [&batch](const ov::Shape& shape) {
+        if (shape.empty())
+            return false;
+        if (batch == 0)
+            batch = shape[0];
+        return shape[0] == batch;
+    };
+    for (const auto& parameter : model->get_parameters()) {
+        if (!isBatchOf(parameter->get_output_shape(0)))
+            return 1;
+    }
+    for (const auto& result : model->get_results()) {
+        if (!isBatchOf(result->get_input_shape(0)))
+            return 1;
+    }
+
+    if (batch < 2 || !isBatchIndependent(model, batch))
+        return 1;
+
+    // the largest divisor of the batch giving each slice enough threads
+    const size_t maxSlicesNum = static_cast<size_t>(std::max(1, threadsNum / minThreadsPerSlice));
+    for (size_t slicesNum = std::min(batch, maxSlicesNum); slicesNum > 1; slicesNum--) {
+        if (batch % slicesNum == 0)
+            return slicesNum;
+    }
+#endif
+    return 1;
+}
+
+bool BatchSplitter::reshapeToSlice(const std::shared_ptr<ov::Model>& model, size_t slicesNum) {
+    std::vector<ov::Shape> expectedShapes;
+    for (const auto& result : model->get_results()) {
+        auto shape = result->get_input_shape(0);
+        shape[0] /= slicesNum;
+        expectedShapes.push_back(shape);
+    }
+
+    std::map<ov::Output<ov::Node>, ov::PartialShape> sliceShapes;
+    for (const auto& parameter : model->get_parameters()) {
+        auto shape = parameter->get_output_shape(0);
+        shape[0] /= slicesNum;
+        sliceShapes[parameter->output(0)] = shape;
+    }
+    try {
+        model->reshape(sliceShapes);
+    } catch (const std::exception&) {
+        // the batch is hardcoded in the model (e.g. the target shape of a Reshape)
+        return false;
+    }
+
+    const auto& results = model->get_results();
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& shape = results[i]->get_input_partial_shape(0);
+        if (shape.is_dynamic() || shape.to_shape() != expectedShapes[i])
+            return false;
+    }
+    return true;
+}
+
+bool BatchSplitter::isSliceable(const InferenceEngine::Blob::Ptr& blob) {
+    if (!blob || blob->is<InferenceEngine::CompoundBlob>())
+        return false;
+    const auto& desc = blob->getTensorDesc();
+    const auto& dims = desc.getDims();
+    if (dims.empty())
+        return false;
+    InferenceEngine::SizeVector order(dims.size());
+    std::iota(order.begin(), order.end(), 0);
+    return desc.getBlockingDesc() == InferenceEngine::BlockingDesc(dims, order);
+}
+
+InferenceEngine::Blob::Ptr BatchSplitter::getSlice(const InferenceEngine::Blob::Ptr& blob, size_t slice, size_t slicesNum) {
+    const auto& desc = blob->getTensorDesc();
+    auto dims = desc.getDims();
+    dims[0] /= slicesNum;
+    const InferenceEngine::TensorDesc sliceDesc(desc.getPrecision(), dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
+    auto data = blob->buffer().as<uint8_t*>() + slice * (blob->byteSize() / slicesNum);
+    return make_blob_with_precision(sliceDesc, data);
+}
+
+BatchSplitter::BatchSplitter(size_t slicesNum, int threadsNum) : slicesNum(slicesNum) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    const int sliceThreadsNum = std::max(1, threadsNum / static_cast<int>(slicesNum));
+    for (size_t i = 0; i < slicesNum; i++) {
+        // only the first slice is executed by the calling thread, the others are entirely run by the workers
+        const unsigned reservedForMasters = i == 0 ? 1 : 0;
+        arenas.emplace_back(new tbb::task_arena(sliceThreadsNum, reservedForMasters));
+    }
+#endif
+}
+
+void BatchSplitter::execute(const std::function<void(size_t)>& f) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    std::unique_ptr<tbb::task_group[]> groups(new tbb::task_group[slicesNum]);
+    for (size_t i = 1; i < slicesNum; i++) {
+        arenas[i]->execute([&, i] {
+            groups[i].run([&f, i] {
+                f(i);
+            });
+        });
+    }
+
+    std::exception_ptr exception;
+    try {
+        arenas[0]->execute([&] {
+            f(0);
+        });
+    } catch (...) {
+        exception = std::current_exception();
+    }
+    // all the slices are waited for, since they refer to the memory of the caller
+    for (size_t i = 1; i < slicesNum; i++) {
+        try {
+            arenas[i]->execute([&, i] {
+                groups[i].wait();
+            });
+        } catch (...) {
+            if (!exception)
+                exception = std::current_exception();
+        }
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+#else
+    for (size_t i = 0; i < slicesNum; i++)
+        f(i);
+#endif
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
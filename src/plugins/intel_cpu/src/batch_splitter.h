@@ -0,0 +1,76 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_blob.h>
+#include <ie_parallel.hpp>
+#include <openvino/core/model.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+#    include <tbb/task_arena.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Splits the batch of a single inference request executed by a stream into the slices. The graph of each slice
+ * is compiled for a part of the batch and executed concurrently with the others on a group of the stream threads,
+ * so the layers parallelized poorly over the batch (e.g. Softmax, TopK, the reference implementations) occupy all
+ * the cores. The batch is the outermost dimension, so the slices of the request tensors are their contiguous parts.
+ */
+class BatchSplitter {
+public:
+    typedef std::shared_ptr<BatchSplitter> Ptr;
+
+    /**
+     * @brief Returns the number of the slices the batch of the model is split into for the stream threads number,
+     * 1 if the model is not split (e.g. a dynamic or a stateful model, the inputs and the outputs of a different batch,
+     * an op which is unknown or mixes the elements of the batch, like Softmax over the batch axis)
+     */
+    static size_t getSlicesNum(const std::shared_ptr<const ov::Model>& model, int threadsNum);
+
+    /**
+     * @brief Reshapes the model inputs to the batch of a slice
+     * @return false if the outputs do not follow the batch of the inputs (e.g. the batch is mixed by a Reshape or
+     * a reduction), so the model cannot be split
+     */
+    static bool reshapeToSlice(const std::shared_ptr<ov::Model>& model, size_t slicesNum);
+
+    /**
+     * @brief Checks whether the slices of the blob can refer to its memory (the dense planar layout)
+     */
+    static bool isSliceable(const InferenceEngine::Blob::Ptr& blob);
+
+    /**
+     * @brief Creates the blob referring to the slice of the batch of the sliceable blob
+     */
+    static InferenceEngine::Blob::Ptr getSlice(const InferenceEngine::Blob::Ptr& blob, size_t slice, size_t slicesNum);
+
+    BatchSplitter(size_t slicesNum, int threadsNum);
+
+    /**
+     * @brief Executes the function for all the slices concurrently, each one on its own group of the threads.
+     * The first slice is executed by the calling thread.
+     */
+    void execute(const std::function<void(size_t)>& f);
+
+    size_t getSlicesNum() const {
+        return slicesNum;
+    }
+
+private:
+    size_t slicesNum;
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    std::vector<std::unique_ptr<tbb::task_arena>> arenas;
+#endif
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
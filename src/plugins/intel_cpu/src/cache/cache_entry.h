@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <functional>
 #include "lru_cache.h"
@@ -17,16 +18,22 @@ public:
         Hit,
         Miss
     };
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
 public:
     virtual ~CacheEntryBase() = default;
+    virtual Statistics getStatistics() const = 0;
 };
 
 /**
  * @brief Class represents a templated record in multi cache
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const KeyType&)
- *         interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType), ValueType get(const KeyType&)
+ *         and size_t getEvictionsNumber() interface and must have constructor of type ImplType(size_t).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
@@ -52,6 +59,7 @@ public:
     ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            _misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -59,15 +67,29 @@ public:
         auto retEmpty = ValType();
         if (retVal == retEmpty) {
             retStatus = LookUpStatus::Miss;
+            // the builder is called outside of the storage locks, so the same key may be built concurrently
             retVal = builder(key);
             if (retVal != retEmpty)
                 _impl.put(key, retVal);
         }
+        (retStatus == LookUpStatus::Hit ? _hits : _misses).fetch_add(1, std::memory_order_relaxed);
         return {retVal, retStatus};
     }
 
+    Statistics getStatistics() const override {
+        Statistics result;
+        result.hits = _hits.load(std::memory_order_relaxed);
+        result.misses = _misses.load(std::memory_order_relaxed);
+        result.evictions = _impl.getEvictionsNumber();
+        return result;
+    }
+
 public:
     ImplType _impl;
+
+private:
+    std::atomic<size_t> _hits{0};
+    std::atomic<size_t> _misses{0};
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,125 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "lru_cache.h"
+
+/**
+ * @brief This is a sharded version of the LruCache, which can be used concurrently from several threads.
+ * The records are distributed between the shards by the key hash and each shard is an independent LruCache with its own lock,
+ * so the concurrent lookups of the different keys rarely contend. The LRU eviction policy is applied per shard.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ *
+ * @note This cache implementation IS THREAD SAFE.
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ConcurrentLruCache {
+public:
+    static constexpr size_t defaultShardsNum = 16;
+
+public:
+    explicit ConcurrentLruCache(size_t capacity, size_t shardsNum = defaultShardsNum) : _capacity(capacity) {
+        if (0 == _capacity) {
+            return;
+        }
+        shardsNum = std::max<size_t>(1, std::min(shardsNum, _capacity));
+        const size_t shardCapacity = (_capacity + shardsNum - 1) / shardsNum;
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key &key, const Value &val) {
+        if (0 == _capacity) {
+            return;
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.guard);
+        shard.cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        if (0 == _capacity) {
+            return Value();
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.guard);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records from each shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->guard);
+            shard->cache.evict(n);
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of the records evicted from the cache
+     */
+    size_t getEvictionsNumber() const {
+        size_t result = 0;
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->guard);
+            result += shard->cache.getEvictionsNumber();
+        }
+        return result;
+    }
+
+private:
+    struct Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+
+        mutable std::mutex guard;
+        LruCache<Key, Value> cache;
+    };
+
+    Shard& getShard(const Key &key) {
+        const size_t hash = key.hash();
+        // mix the high bits in, since the keys hashes are often combined with shifts
+        return *_shards[(hash ^ (hash >> 16)) % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
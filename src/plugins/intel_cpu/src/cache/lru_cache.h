@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <list>
 #include <unordered_map>
 
@@ -74,6 +75,7 @@ public:
         for (size_t i = 0; i < n && !_lruList.empty(); ++i) {
             _cacheMapper.erase(_lruList.back().first);
             _lruList.pop_back();
+            _evictionsNum.fetch_add(1, std::memory_order_relaxed);
         }
     }
 
@@ -85,6 +87,13 @@ public:
          return _capacity;
      }
 
+    /**
+     * @brief Returns the number of the records evicted from the cache
+     */
+    size_t getEvictionsNumber() const noexcept {
+        return _evictionsNum.load(std::memory_order_relaxed);
+    }
+
 private:
     struct key_hasher {
         std::size_t operator()(const Key &k) const {
@@ -102,6 +111,8 @@ private:
     lru_list_type _lruList;
     std::unordered_map<Key, cache_map_value_type, key_hasher> _cacheMapper;
     size_t _capacity;
+    // may be read from another thread to collect the statistics
+    std::atomic<size_t> _evictionsNum{0};
 };
 
 }   // namespace intel_cpu
@@ -7,7 +7,9 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
+#include "concurrent_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -15,7 +17,7 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention This implementation IS NOT THREAD SAFE unless it is created with the threadSafe flag!
  */
 
 class MultiCache {
@@ -25,13 +27,20 @@ public:
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+    template<typename KeyType, typename ValueType>
+    using ConcurrentEntryTypeT = CacheEntry<KeyType, ValueType, ConcurrentLruCache<KeyType, ValueType>>;
+    using Statistics = CacheEntryBase::Statistics;
 
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param threadSafe makes the cache usable concurrently from several threads (e.g. the graphs of all the streams)
+    *       at the cost of the sharded storage
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, bool threadSafe = false) : _capacity(capacity), _threadSafe(threadSafe) {}
+    MultiCache(const MultiCache& other) = delete;
+    MultiCache& operator=(const MultiCache& other) = delete;
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -45,20 +54,37 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
+        if (_threadSafe) {
+            auto entry = getEntryThreadSafe<ConcurrentEntryTypeT<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
         auto entry = getEntry<KeyType, ValueType>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Returns the hits/misses/evictions numbers accumulated over all the entries
+    */
+    Statistics getStatistics() const;
+
 private:
     template<typename T>
     size_t getTypeId();
     template<typename KeyType, typename ValueType>
     EntryPtr<KeyType, ValueType> getEntry();
+    template<typename EntryType>
+    EntryType* getEntryThreadSafe();
 
 private:
+    // the entries of the types with the small ids are looked up without locking
+    static constexpr size_t fastSlotsNum = 256;
+
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    bool _threadSafe = false;
+    mutable std::mutex _storageGuard;
     std::unordered_map<size_t, EntryBasePtr> _storage;
+    std::atomic<CacheEntryBase*> _fastSlots[fastSlotsNum] = {};
 };
 
 template<typename T>
@@ -73,12 +99,32 @@ MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
+        // the owner thread is the only writer, the lock just makes the statistics collection safe
+        std::lock_guard<std::mutex> lock(_storageGuard);
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
 }
 
+template<typename EntryType>
+EntryType* MultiCache::getEntryThreadSafe() {
+    size_t id = getTypeId<EntryType>();
+    if (id < fastSlotsNum) {
+        if (auto entry = _fastSlots[id].load(std::memory_order_acquire))
+            return static_cast<EntryType*>(entry);
+    }
+    std::lock_guard<std::mutex> lock(_storageGuard);
+    auto itr = _storage.find(id);
+    if (itr == _storage.end()) {
+        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        itr = result.first;
+        if (id < fastSlotsNum)
+            _fastSlots[id].store(itr->second.get(), std::memory_order_release);
+    }
+    return static_cast<EntryType*>(itr->second.get());
+}
+
 using MultiCacheWeakPtr = std::weak_ptr<MultiCache>;
 using MultiCacheWeakCPtr = std::weak_ptr<const MultiCache>;
 using MultiCachePtr = std::shared_ptr<MultiCache>;
@@ -7,6 +7,7 @@
 #include <string>
 #include <map>
 #include <algorithm>
+#include <sstream>
 
 #include "ie_plugin_config.hpp"
 #include "cpu/cpu_config.hpp"
@@ -26,6 +27,58 @@ namespace intel_cpu {
 using namespace InferenceEngine;
 using namespace dnnl::impl::cpu::x64;
 
+namespace {
+// the profiles are separated by ';' and each profile is the list of the input shapes, e.g.
+// "input0[1,3,224,224],input1[1,10];input0[1,3,320,320],input1[1,20]", the name may be omitted for a single input model
+std::vector<std::map<std::string, std::vector<size_t>>> parseWarmupShapes(const std::string& val) {
+    auto throwWrongValue = [&val]() {
+        IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::warmup_shapes.name()
+                   << ". Expected the ';' separated list of the input shapes profiles like "
+                   << "\"input0[1,3,224,224],input1[1,10];input0[1,3,320,320],input1[1,20]\"";
+    };
+
+    std::vector<std::map<std::string, std::vector<size_t>>> result;
+    for (const auto& profile : ov::util::split(val, ';', true)) {
+        if (profile.empty())
+            continue;
+        std::map<std::string, std::vector<size_t>> inputShapes;
+        size_t pos = 0;
+        while (pos < profile.size()) {
+            const auto open = profile.find('[', pos);
+            const auto close = profile.find(']', open);
+            if (open == std::string::npos || close == std::string::npos)
+                throwWrongValue();
+
+            std::vector<size_t> dims;
+            const auto dimsStr = ov::util::trim(profile.substr(open + 1, close - open - 1));
+            // the empty brackets stand for a scalar
+            for (const auto& dim : dimsStr.empty() ? std::vector<std::string>{} : ov::util::split(dimsStr, ',', true)) {
+                int dim_i = -1;
+                try {
+                    dim_i = std::stoi(dim);
+                } catch (const std::exception&) {
+                    throwWrongValue();
+                }
+                if (dim_i < 0)
+                    throwWrongValue();
+                dims.push_back(static_cast<size_t>(dim_i));
+            }
+            if (!inputShapes.emplace(ov::util::trim(profile.substr(pos, open - pos)), dims).second)
+                throwWrongValue();
+
+            pos = profile.find_first_not_of(' ', close + 1);
+            if (pos == std::string::npos)
+                break;
+            if (profile[pos] != ',')
+                throwWrongValue();
+            pos++;
+        }
+        result.push_back(inputShapes);
+    }
+    return result;
+}
+}  // namespace
+
 Config::Config() {
     // this is default mode
 #if defined(__APPLE__) || defined(_WIN32)
@@ -104,6 +157,28 @@ void Config::readProperties(const std::map<std::string, std::string> &prop, Mode
                            << ov::hint::SchedulingCoreType::PCORE_ONLY << "/"
                            << ov::hint::SchedulingCoreType::ECORE_ONLY << std::endl;
             }
+        } else if (key == ov::intel_cpu::weights_numa_placement.name()) {
+            const auto placement = ov::util::from_string(val, ov::intel_cpu::weights_numa_placement);
+            if (placement == ov::intel_cpu::WeightsNumaPlacement::REPLICATE ||
+                placement == ov::intel_cpu::WeightsNumaPlacement::INTERLEAVE) {
+                weightsNumaPlacement = placement;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::weights_numa_placement.name()
+                           << ". Expected only " << ov::intel_cpu::WeightsNumaPlacement::REPLICATE << "/"
+                           << ov::intel_cpu::WeightsNumaPlacement::INTERLEAVE << std::endl;
+            }
+        } else if (key == ov::intel_cpu::huge_pages.name()) {
+            const auto mode = ov::util::from_string(val, ov::intel_cpu::huge_pages);
+            if (mode == ov::intel_cpu::HugePagesMode::DISABLED ||
+                mode == ov::intel_cpu::HugePagesMode::ADVISE ||
+                mode == ov::intel_cpu::HugePagesMode::HUGETLBFS) {
+                hugePagesMode = mode;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::huge_pages.name()
+                           << ". Expected only " << ov::intel_cpu::HugePagesMode::DISABLED << "/"
+                           << ov::intel_cpu::HugePagesMode::ADVISE << "/"
+                           << ov::intel_cpu::HugePagesMode::HUGETLBFS << std::endl;
+            }
         } else if (key == ov::hint::enable_hyper_threading.name()) {
             if (val == PluginConfigParams::YES) {
                 enableHyperThreading = true;
@@ -207,6 +282,28 @@ void Config::readProperties(const std::map<std::string, std::string> &prop, Mode
             // any negative value will be treated
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_EXEC_PLANS_CACHE_CAPACITY == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_EXEC_PLANS_CACHE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the cache
+            execPlansCacheCapacity = std::max(val_i, 0);
+        } else if (PluginConfigInternalParams::KEY_CPU_TRANSFORMED_MODELS_CACHE_CAPACITY == key) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_TRANSFORMED_MODELS_CACHE_CAPACITY
+                           << ". Expected only integer numbers";
+            }
+            // any negative value will be treated
+            // as zero that means disabling the cache
+            transformedModelsCacheCapacity = std::max(val_i, 0);
         } else if (CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION == key) {
             if (val == PluginConfigParams::YES) {
                 denormalsOptMode = DenormalsOptMode::DO_On;
@@ -217,6 +314,125 @@ void Config::readProperties(const std::map<std::string, std::string> &prop, Mode
                 IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION
                 << ". Expected only YES/NO";
             }
+        } else if (key == ov::intel_cpu::warmup_shapes.name()) {
+            warmupShapes = parseWarmupShapes(val);
+        } else if (key == ov::intel_cpu::max_state_reserved_length.name()) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::max_state_reserved_length.name()
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::max_state_reserved_length.name()
+                           << ". Expected only non negative numbers";
+            }
+            maxStateReservedLength = static_cast<size_t>(val_i);
+        } else if (key == ov::intel_cpu::bind_state_tensors.name()) {
+            if (val == PluginConfigParams::YES) {
+                bindStateTensors = true;
+            } else if (val == PluginConfigParams::NO) {
+                bindStateTensors = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::bind_state_tensors.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::batch_split.name()) {
+            if (val == PluginConfigParams::YES) {
+                batchSplit = true;
+            } else if (val == PluginConfigParams::NO) {
+                batchSplit = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::batch_split.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::minimize_reorders.name()) {
+            if (val == PluginConfigParams::YES) {
+                minimizeReorders = true;
+            } else if (val == PluginConfigParams::NO) {
+                minimizeReorders = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::minimize_reorders.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::fast_math_ops.name()) {
+            static const std::set<std::string> supportedOps = {"Gelu", "Erf"};
+            std::set<std::string> ops;
+            for (const auto& op : ov::util::split(val, ',', true)) {
+                if (op.empty())
+                    continue;
+                if (supportedOps.count(op) == 0) {
+                    IE_THROW() << "Wrong value " << val << " for property key " << ov::intel_cpu::fast_math_ops.name()
+                               << ". Expected the ',' separated list of the op types: Gelu, Erf";
+                }
+                ops.insert(op);
+            }
+            fastMathOps = ops;
+        } else if (key == ov::intel_cpu::enable_exec_timeline.name()) {
+            if (val == PluginConfigParams::YES) {
+                collectExecTimeline = true;
+            } else if (val == PluginConfigParams::NO) {
+                collectExecTimeline = false;
+            } else {
+                IE_THROW() << "Wrong value " << val << "for property key " << ov::intel_cpu::enable_exec_timeline.name()
+                           << ". Expected only true/false." << std::endl;
+            }
+        } else if (key == ov::intel_cpu::exec_timeline_capacity.name()) {
+            long long val_i = -1;  // NOLINT
+            try {
+                val_i = std::stoll(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::exec_timeline_capacity.name()
+                           << ". Expected only integer numbers";
+            }
+            if (val_i < 0) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::exec_timeline_capacity.name()
+                           << ". Expected only non negative numbers";
+            }
+            execTimelineCapacity = static_cast<size_t>(val_i);
+        } else if (key == PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES) {
+            if (val == PluginConfigParams::YES)
+                enableParallelBranches = true;
+            else if (val == PluginConfigParams::NO)
+                enableParallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES
+                           << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SHARE_WEIGHTS_ACROSS_MODELS) {
+            if (val == PluginConfigParams::YES)
+                shareWeightsAcrossModels = true;
+            else if (val == PluginConfigParams::NO)
+                shareWeightsAcrossModels = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARE_WEIGHTS_ACROSS_MODELS
+                           << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SHARED_RUNTIME_CACHE) {
+            if (val == PluginConfigParams::YES)
+                sharedRtCache = true;
+            else if (val == PluginConfigParams::NO)
+                sharedRtCache = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARED_RUNTIME_CACHE
+                           << ". Expected only YES/NO";
+        } else if (key == PluginConfigInternalParams::KEY_CPU_SHARED_STREAMS_EXECUTOR) {
+            if (val == PluginConfigParams::YES)
+                sharedStreamsExecutor = true;
+            else if (val == PluginConfigParams::NO)
+                sharedStreamsExecutor = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_SHARED_STREAMS_EXECUTOR
+                           << ". Expected only YES/NO";
+        } else if (key == ov::hint::model_priority.name()) {
+            modelPriority = ov::util::from_string(val, ov::hint::model_priority);
+        } else if (key == PluginConfigInternalParams::KEY_CPU_DYNAMIC_SNIPPETS) {
+            if (val == PluginConfigParams::YES)
+                dynamicSnippets = true;
+            else if (val == PluginConfigParams::NO)
+                dynamicSnippets = false;
+            else
+                IE_THROW() << "Wrong value for property key " << PluginConfigInternalParams::KEY_CPU_DYNAMIC_SNIPPETS
+                           << ". Expected only YES/NO";
         } else if (key == PluginConfigInternalParams::KEY_SNIPPETS_MODE) {
             if (val == PluginConfigInternalParams::ENABLE)
                 snippetsMode = SnippetsMode::Enable;
@@ -319,5 +535,25 @@ void Config::updateProperties() {
             std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
 }
 
+std::string Config::getWarmupShapes() const {
+    std::stringstream result;
+    for (size_t i = 0; i < warmupShapes.size(); i++) {
+        if (i > 0)
+            result << ";";
+        bool first = true;
+        for (const auto& input : warmupShapes[i]) {
+            if (!first)
+                result << ",";
+            first = false;
+            result << input.first << "[" << ov::util::join(input.second, ",") << "]";
+        }
+    }
+    return result.str();
+}
+
+std::string Config::getFastMathOps() const {
+    return ov::util::join(fastMathOps, ",");
+}
+
 }  // namespace intel_cpu
 }   // namespace ov
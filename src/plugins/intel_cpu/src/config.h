@@ -8,6 +8,7 @@
 #include <ie_performance_hints.hpp>
 #include <ie/ie_common.h>
 #include <openvino/runtime/properties.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
 #include <openvino/util/common_util.hpp>
 #include "utils/debug_caps_config.h"
 #include <openvino/core/type/element_type.hpp>
@@ -16,6 +17,8 @@
 #include <string>
 #include <map>
 #include <mutex>
+#include <set>
+#include <vector>
 
 namespace ov {
 namespace intel_cpu {
@@ -51,8 +54,16 @@ struct Config {
     };
 
     bool collectPerfCounters = false;
+    bool collectExecTimeline = false;
+    size_t execTimelineCapacity = 1ul << 16;
     bool exclusiveAsyncRequests = false;
+    // run independent branches of the graph concurrently within one infer request
+    bool enableParallelBranches = false;
+    // share the repacked weights with the other compiled models through the process-wide weights registry
+    bool shareWeightsAcrossModels = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
+    // tokenize the dynamic shape elementwise subgraphs, their kernels are reused for all the outer dimensions
+    bool dynamicSnippets = false;
     std::string dumpToDot = {};
     std::string device_id = {};
     float fcSparseWeiDecompressionRate = 1.0f;
@@ -62,11 +73,36 @@ struct Config {
     // TODO: Executor cache may leads to incorrect behavior on oneDNN ACL primitives
     size_t rtCacheCapacity = 0ul;
 #endif
+    // share one thread safe runtime cache between the graphs of all the streams
+    bool sharedRtCache = false;
+    // run on the process-wide streams executor shared with the other compiled models of the same streams config
+    bool sharedStreamsExecutor = false;
+    // the requests of the models with a higher priority are taken first by the shared streams executor
+    ov::hint::Priority modelPriority = ov::hint::Priority::MEDIUM;
+    // number of the dynamic shape execution plans stored per graph, zero disables the plans caching
+    size_t execPlansCacheCapacity = 16ul;
+    // number of the models transformed up to LPT kept by the plugin for the repeated compilations, zero disables it
+    size_t transformedModelsCacheCapacity = 0ul;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
     bool enableCpuPinning = true;
     bool changedCpuPinning = false;
     ov::hint::SchedulingCoreType schedulingCoreType = ov::hint::SchedulingCoreType::ANY_CORE;
+    ov::intel_cpu::WeightsNumaPlacement weightsNumaPlacement = ov::intel_cpu::WeightsNumaPlacement::REPLICATE;
+    ov::intel_cpu::HugePagesMode hugePagesMode = ov::intel_cpu::HugePagesMode::DISABLED;
+    // split the batch of a request into the slices executed concurrently by a single stream
+    bool batchSplit = false;
+    // revise the selected layouts to reduce the reorders between the nodes
+    bool minimizeReorders = false;
+    // the op types computed by the faster approximations in the PERFORMANCE execution mode
+    std::set<std::string> fastMathOps;
+    // the input shapes profiles the dynamic shape executors are prepared for at the model compilation,
+    // the empty input name stands for the only input of the model
+    std::vector<std::map<std::string, std::vector<size_t>>> warmupShapes;
+    // the max length the growing states capacity is reserved in advance for, zero means no limit
+    size_t maxStateReservedLength = 0ul;
+    // the states compute in place in the tensors set to them instead of copying them
+    bool bindStateTensors = false;
     bool enableHyperThreading = true;
     bool changedHyperThreading = false;
     Config::LatencyThreadingMode latencyThreadingMode = Config::LatencyThreadingMode::PER_SOCKET;
@@ -90,6 +126,11 @@ struct Config {
 
     void readProperties(const std::map<std::string, std::string> &config, ModelType modelType = ModelType::Unknown);
     void updateProperties();
+    std::string getWarmupShapes() const;
+    std::string getFastMathOps() const;
+    bool isFastMath(const std::string& opType) const {
+        return executionMode == ov::hint::ExecutionMode::PERFORMANCE && fastMathOps.count(opType) != 0;
+    }
 
     std::map<std::string, std::string> _config;
 
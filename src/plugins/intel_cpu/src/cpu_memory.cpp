@@ -3,6 +3,7 @@
 //
 
 #include <oneapi/dnnl/dnnl.hpp>
+#include <algorithm>
 #include <vector>
 #include <numeric>
 #include <unordered_set>
@@ -17,6 +18,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/reorder.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/huge_pages.h"
 
 using namespace InferenceEngine;
 using namespace dnnl;
@@ -217,13 +219,18 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > m_memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
-        if (!ptr) {
-            IE_THROW() << "Failed to allocate " << size << " bytes of memory";
+        // the huge pages are used only within a HugePagesScope of the allocating thread
+        if (void *ptr = allocateHugePages(size)) {
+            m_data = decltype(m_data)(ptr, freeHugePages);
+        } else {
+            ptr = dnnl::impl::malloc(size, cacheLineSize);
+            if (!ptr) {
+                IE_THROW() << "Failed to allocate " << size << " bytes of memory";
+            }
+            m_data = decltype(m_data)(ptr, destroy);
         }
         m_memUpperBound = size;
         m_useExternalStorage = false;
-        m_data = decltype(m_data)(ptr, destroy);
         sizeChanged = true;
     }
     return sizeChanged;
@@ -239,6 +246,49 @@ void MemoryMngrWithReuse::destroy(void *ptr) {
     dnnl::impl::free(ptr);
 }
 
+void* MemoryMngrWithReserve::getRawPtr() const noexcept {
+    return m_data.get();
+}
+
+void MemoryMngrWithReserve::setExtBuff(void *ptr, size_t size) {
+    m_useExternalStorage = true;
+    m_capacity = size;
+    m_data = decltype(m_data)(ptr, release);
+}
+
+bool MemoryMngrWithReserve::resize(size_t size) {
+    constexpr int cacheLineSize = 64;
+    if (size <= m_capacity) {
+        return false;
+    }
+    size_t capacity = 2 * m_capacity;
+    if (m_maxReserve != 0ul)
+        capacity = std::min(capacity, m_maxReserve);
+    capacity = std::max(capacity, size);
+
+    void *ptr = dnnl::impl::malloc(capacity, cacheLineSize);
+    if (!ptr) {
+        IE_THROW() << "Failed to allocate " << capacity << " bytes of memory";
+    }
+    // the whole previous capacity is kept, since the memory objects sharing the manager may use different sizes
+    if (m_data)
+        cpu_memcpy(ptr, m_data.get(), m_capacity);
+    m_capacity = capacity;
+    m_useExternalStorage = false;
+    m_data = decltype(m_data)(ptr, destroy);
+    return true;
+}
+
+bool MemoryMngrWithReserve::hasExtBuffer() const noexcept {
+    return m_useExternalStorage;
+}
+
+void MemoryMngrWithReserve::release(void *ptr) {}
+
+void MemoryMngrWithReserve::destroy(void *ptr) {
+    dnnl::impl::free(ptr);
+}
+
 void* DnnlMemoryMngr::getRawPtr() const noexcept {
     return m_pMemMngr->getRawPtr();
 }
@@ -90,6 +90,40 @@ private:
     static void destroy(void *ptr);
 };
 
+/**
+ * @brief An implementation of the mem manager for the growing buffers (e.g. the states accumulated over the inferences).
+ * The buffer capacity is at least doubled on each reallocation, so the appends cost an amortized constant time,
+ * and the previous content is preserved. The max reserve limits the speculative part of the capacity, but not the
+ * requested size itself.
+ */
+class MemoryMngrWithReserve : public IMemoryMngr {
+public:
+    MemoryMngrWithReserve() : m_data(nullptr, release) {}
+    void* getRawPtr() const noexcept override;
+    void setExtBuff(void* ptr, size_t size) override;
+    bool resize(size_t size) override;
+    bool hasExtBuffer() const noexcept override;
+
+    /**
+     * @brief Sets the upper bound (in bytes) of the capacity reserved in advance, zero means no limit
+     */
+    void setMaxReserve(size_t size) {
+        m_maxReserve = size;
+    }
+    size_t getCapacity() const noexcept {
+        return m_capacity;
+    }
+
+private:
+    bool m_useExternalStorage = false;
+    size_t m_capacity = 0ul;
+    size_t m_maxReserve = 0ul;
+    std::unique_ptr<void, void (*)(void *)> m_data;
+
+    static void release(void *ptr);
+    static void destroy(void *ptr);
+};
+
 class IMemoryMngrObserver : public IMemoryMngr {
 public:
     virtual void registerMemory(Memory* memPtr) = 0;
@@ -32,6 +32,10 @@ uint8_t DnnlExtensionUtils::sizeOfDataType(dnnl::memory::data_type dataType) {
         return 1;
     case dnnl::memory::data_type::bin:
         return 1;
+    // the sub-byte types are packed, the size is rounded up to the byte
+    case dnnl::memory::data_type::u4:
+    case dnnl::memory::data_type::s4:
+        return 1;
     case dnnl::memory::data_type::f16:
         return 2;
     case dnnl::memory::data_type::undef:
@@ -56,6 +60,10 @@ memory::data_type DnnlExtensionUtils::IEPrecisionToDataType(const InferenceEngin
             return memory::data_type::u8;
         case InferenceEngine::Precision::BIN:
             return memory::data_type::bin;
+        case InferenceEngine::Precision::U4:
+            return memory::data_type::u4;
+        case InferenceEngine::Precision::I4:
+            return memory::data_type::s4;
         case InferenceEngine::Precision::FP16:
             return memory::data_type::f16;
         case InferenceEngine::Precision::UNSPECIFIED:
@@ -80,6 +88,10 @@ InferenceEngine::Precision DnnlExtensionUtils::DataTypeToIEPrecision(memory::dat
             return InferenceEngine::Precision::U8;
         case memory::data_type::bin:
             return InferenceEngine::Precision::BIN;
+        case memory::data_type::u4:
+            return InferenceEngine::Precision::U4;
+        case memory::data_type::s4:
+            return InferenceEngine::Precision::I4;
         case memory::data_type::f16:
             return InferenceEngine::Precision::FP16;
         case memory::data_type::undef:
@@ -251,41 +251,60 @@ void DnnlPostOpsComposer::appendClip(const std::vector<float>& low, const std::v
     }
 }
 
-MemoryPtr DnnlPostOpsComposer::prepackDecompressionParams(const std::vector<float>& params, size_t icBlock) {
-    // Prepacking params from [oc] to [oc, icBlock] layout, where for each icBlock corresponding parameter is duplicated
+MemoryPtr DnnlPostOpsComposer::prepackDecompressionParams(const std::vector<float>& params, size_t icBlock, size_t groupsNum) {
+    // Prepacking params from [oc, groups] to [groups, oc, icBlock] layout, where for each icBlock corresponding parameter is duplicated
     DnnlBlockedMemoryDesc memoryDesc(InferenceEngine::Precision::FP32, Shape({icBlock * params.size()}));
     auto mem = std::make_shared<Memory>(engine, memoryDesc);
+    const size_t ocNum = params.size() / groupsNum;
     size_t dstIdx = 0;
     auto decomp_scales_buf = static_cast<float*>(mem->getData());
-    for (size_t oc = 0; oc < params.size(); oc++) {
-        for (size_t intIdx = 0; intIdx < icBlock; intIdx++) {
-            decomp_scales_buf[dstIdx] = params[oc];
-            dstIdx++;
+    for (size_t g = 0; g < groupsNum; g++) {
+        for (size_t oc = 0; oc < ocNum; oc++) {
+            for (size_t intIdx = 0; intIdx < icBlock; intIdx++) {
+                decomp_scales_buf[dstIdx] = params[oc * groupsNum + g];
+                dstIdx++;
+            }
         }
     }
     return mem;
 }
 
-void DnnlPostOpsComposer::appendDecompressionScales(const std::vector<float>& scales, size_t icBlock) {
+void DnnlPostOpsComposer::setDecompressionParamsAttr(int arg, const std::vector<float>& params, size_t groupsNum, bool isScales) {
+    if (params.size() % groupsNum != 0)
+        IE_THROW() << "Decompression parameters number " << params.size() << " is not aligned with the groups number " << groupsNum;
+
+    // the group-wise parameters vary along both OC and IC dimensions of the weights
+    int mask = groupsNum > 1 ? (weightScaleMaskPerChannel | (1 << 1)) : params.size() > 1 ? weightScaleMaskPerChannel : 0;
+    DEBUG_LOG("Set weights ", isScales ? "scales" : "zero points", " mask ", "DNNL_ARG: ", arg, " mask: ", mask, " groups: ", groupsNum);
+    if (isScales)
+        attr.set_scales_mask(arg, mask);
+    else
+        attr.set_zero_points_mask(arg, mask);
+
+    if (groupsNum > 1) {
+        const dnnl::memory::dims dims{static_cast<dnnl::memory::dim>(groupsNum),
+                                      static_cast<dnnl::memory::dim>(params.size() / groupsNum)};
+        if (isScales)
+            attr.set_scales_dims(arg, dims);
+        else
+            attr.set_zero_points_dims(arg, dims);
+    }
+}
+
+void DnnlPostOpsComposer::appendDecompressionScales(const std::vector<float>& scales, size_t icBlock, size_t groupsNum) {
     if (scales.empty())
         return;
 
-    int mask = scales.size() > 1 ? weightScaleMaskPerChannel : 0;
-    DEBUG_LOG("Set weights scales mask ", "DNNL_ARG: ", DNNL_ARG_WEIGHTS, " mask: ", mask);
-    attr.set_scales_mask(DNNL_ARG_WEIGHTS, mask);
-
-    args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS] = prepackDecompressionParams(scales, icBlock);
+    setDecompressionParamsAttr(DNNL_ARG_WEIGHTS, scales, groupsNum, true);
+    args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS] = prepackDecompressionParams(scales, icBlock, groupsNum);
 }
 
-void DnnlPostOpsComposer::appendDecompressionZeroPoints(const std::vector<float>& zero_points, size_t icBlock) {
+void DnnlPostOpsComposer::appendDecompressionZeroPoints(const std::vector<float>& zero_points, size_t icBlock, size_t groupsNum) {
     if (zero_points.empty())
         return;
 
-    int mask = zero_points.size() > 1 ? weightScaleMaskPerChannel : 0;
-    DEBUG_LOG("Set weights zero points mask ", "DNNL_ARG: ", DNNL_ARG_WEIGHTS, " mask: ", mask);
-    attr.set_zero_points_mask(DNNL_ARG_WEIGHTS, mask);
-
-    args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS] = prepackDecompressionParams(zero_points, icBlock);
+    setDecompressionParamsAttr(DNNL_ARG_WEIGHTS, zero_points, groupsNum, false);
+    args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS] = prepackDecompressionParams(zero_points, icBlock, groupsNum);
 }
 
 }  // namespace intel_cpu
@@ -42,8 +42,8 @@ public:
     bool appendLinear(const std::vector<float>& scale, const std::vector<float>& shift, bool isLastPostOp, bool allowBinary = true);
     void appendClip(const std::vector<float>& low, const std::vector<float>& high);
 
-    void appendDecompressionScales(const std::vector<float>& scales, size_t icBlock);
-    void appendDecompressionZeroPoints(const std::vector<float>& zero_points, size_t icBlock);
+    void appendDecompressionScales(const std::vector<float>& scales, size_t icBlock, size_t groupsNum = 1);
+    void appendDecompressionZeroPoints(const std::vector<float>& zero_points, size_t icBlock, size_t groupsNum = 1);
 
     const VectorDims& getOutputDims() {
         return outputDims;
@@ -69,7 +69,8 @@ private:
 
     void updateWeiScales();
     void updateDestScales();
-    MemoryPtr prepackDecompressionParams(const std::vector<float>& params, size_t icBlock);
+    MemoryPtr prepackDecompressionParams(const std::vector<float>& params, size_t icBlock, size_t groupsNum);
+    void setDecompressionParamsAttr(int arg, const std::vector<float>& params, size_t groupsNum, bool isScales);
 };
 
 }  // namespace intel_cpu
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 
 #include "common/memory.hpp"
@@ -15,17 +16,59 @@ namespace intel_cpu {
 
 class DnnlScratchPad {
     MemoryMngrPtr mgrPtr;
+    // the temporary buffers of the custom nodes, may be used along with the oneDNN scratchpad by the same node
+    MemoryMngrPtr buffersMgrPtr;
     dnnl::engine eng;
 
 public:
     DnnlScratchPad(dnnl::engine eng) : eng(eng) {
         mgrPtr = std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>());
+        buffersMgrPtr = std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>());
     }
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
         auto mem = std::make_shared<Memory>(eng, md, mgrPtr);
         return mem;
     }
+
+    MemoryPtr createScratchBufferMem(const MemoryDescPtr& md) {
+        auto mem = std::make_shared<Memory>(eng, md, buffersMgrPtr);
+        return mem;
+    }
+};
+
+/**
+ * @brief Bump pointer allocator over the node scratch buffer. The allocations are aligned to the cache line and are
+ * released all together when the arena is destroyed, so an arena is supposed to live within one node execution.
+ */
+class ScratchArena {
+public:
+    ScratchArena(uint8_t* base, size_t size) : m_base(base), m_size(size) {}
+
+    template <typename T>
+    T* allocate(size_t count) {
+        const size_t offset = alignedSize(m_offset);
+        const size_t end = offset + count * sizeof(T);
+        if (end > m_size)
+            IE_THROW() << "Scratch buffer of " << m_size << " bytes is too small to allocate " << count * sizeof(T) << " bytes";
+        m_offset = end;
+        return reinterpret_cast<T*>(m_base + offset);
+    }
+
+    /**
+     * @brief Returns the space taken by an allocation of the given size, the sum for all the allocations is the size
+     * to be reserved
+     */
+    static size_t alignedSize(size_t size) {
+        return (size + alignment - 1) / alignment * alignment;
+    }
+
+    static constexpr size_t alignment = 64;
+
+private:
+    uint8_t* m_base;
+    size_t m_size;
+    size_t m_offset = 0;
 };
 
 using DnnlScratchPadPtr = std::shared_ptr<DnnlScratchPad>;
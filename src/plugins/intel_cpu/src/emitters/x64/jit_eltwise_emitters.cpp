@@ -1777,8 +1777,8 @@ void jit_negative_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, cons
 }
 
 /// ERF ///
-jit_erf_emitter::jit_erf_emitter(x64::jit_generator *host, x64::cpu_isa_t host_isa, Precision exec_prc)
-: jit_emitter(host, host_isa, exec_prc) {
+jit_erf_emitter::jit_erf_emitter(x64::jit_generator *host, x64::cpu_isa_t host_isa, Precision exec_prc, bool fast_math)
+: jit_emitter(host, host_isa, exec_prc), fast_math(fast_math) {
     prepare_table();
 }
 
@@ -1887,6 +1887,36 @@ void jit_erf_emitter::emit_isa(const std::vector<size_t> &in_vec_idxs, const std
         h->uni_vandps(vmm_src, vmm_src, table_val("positive_mask"));
     };
 
+    if (fast_math) {
+        // erf(x) = sign(x) * (1 - 1 / (1 + a1 * |x| + a2 * |x|^2 + a3 * |x|^3 + a4 * |x|^4)^4), the max error is 5e-4
+        // get sign
+        h->uni_vmovups(vmm_aux0, vmm_src);
+        h->uni_vandps(vmm_aux0, vmm_aux0, table_val("sign_mask"));
+
+        // abs(x)
+        h->uni_vmovups(vmm_aux1, vmm_src);
+        abs_compute_vector_fwd(vmm_aux1);
+
+        // p = 1 + a1 * |x| + a2 * |x|^2 + a3 * |x|^3 + a4 * |x|^4
+        h->uni_vmovups(vmm_aux2, table_val("erf_fast_pol4"));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val("erf_fast_pol3"));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val("erf_fast_pol2"));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val("erf_fast_pol1"));
+        h->uni_vfmadd213ps(vmm_aux2, vmm_aux1, table_val("one"));
+
+        // p^4, the overflow for the large |x| gives 1 / p^4 = 0
+        h->uni_vmulps(vmm_aux2, vmm_aux2, vmm_aux2);
+        h->uni_vmulps(vmm_aux2, vmm_aux2, vmm_aux2);
+
+        // erf = sign * (1 - 1 / p^4)
+        h->uni_vmovups(vmm_aux1, table_val("one"));
+        h->uni_vdivps(vmm_aux1, vmm_aux1, vmm_aux2);
+        h->uni_vmovups(vmm_dst, table_val("one"));
+        h->uni_vsubps(vmm_dst, vmm_dst, vmm_aux1);
+        h->uni_vxorps(vmm_dst, vmm_dst, vmm_aux0);
+        return;
+    }
+
     // IMPORTANT: we use vmm_aux3 to save `x` as exp_compute does not use it.
     h->uni_vmovups(vmm_aux3, vmm_src);
 
@@ -1945,6 +1975,11 @@ void jit_erf_emitter::register_table_entries() {
     push_arg_entry_of("erf_pol4", 0xbfba00e3, true); // p4 = -1.453152027f
     push_arg_entry_of("erf_pol5", 0x3f87dc22, true); // p5 = 1.061405429f
 
+    push_arg_entry_of("erf_fast_pol1", 0x3e8e8987, true); // p1 = 0.278393f
+    push_arg_entry_of("erf_fast_pol2", 0x3e6beb18, true); // p2 = 0.230389f
+    push_arg_entry_of("erf_fast_pol3", 0x3a7ecdd1, true); // p3 = 0.000972f
+    push_arg_entry_of("erf_fast_pol4", 0x3d9ff716, true); // p4 = 0.078108f
+
     push_arg_entry_of("one", CONST_1_F, true);
     push_arg_entry_of("half", 0x3f000000, true);
 
@@ -528,7 +528,7 @@ private:
 class jit_erf_emitter : public jit_emitter {
 public:
     jit_erf_emitter(dnnl::impl::cpu::x64::jit_generator *host, dnnl::impl::cpu::x64::cpu_isa_t host_isa,
-        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
+        InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32, bool fast_math = false);
 
     jit_erf_emitter(dnnl::impl::cpu::x64::jit_generator *host, dnnl::impl::cpu::x64::cpu_isa_t host_isa, const std::shared_ptr<ov::Node>& n,
                     InferenceEngine::Precision exec_prc = InferenceEngine::Precision::FP32);
@@ -546,6 +546,9 @@ private:
 
     void register_table_entries() override;
     size_t aux_vecs_count() const override;
+
+    // the lower degree rational approximation without the exponent is used
+    bool fast_math = false;
 };
 
 class jit_soft_sign_emitter : public jit_emitter {
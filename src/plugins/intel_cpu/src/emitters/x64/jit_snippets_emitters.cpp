@@ -6,6 +6,8 @@
 
 #include <cpu/x64/jit_generator.hpp>
 
+#include <immintrin.h>
+
 #include "snippets/snippets_isa.hpp"
 #include "snippets/lowered/expression.hpp"
 #include "snippets/lowered/port_connector.hpp"
@@ -136,6 +138,9 @@ KernelEmitter::KernelEmitter(jit_generator* h, cpu_isa_t isa, const ExpressionPt
         OPENVINO_ASSERT(shape.size() == layout.size(), "Shape and layout must have the same length");
         const auto max_dim = *std::max_element(layout.begin(), layout.end());
         OPENVINO_ASSERT(max_dim < shape.size(), "Max layout index can't be larger than the shape size");
+        // the runtime offsets are calculated by the caller for the planar access
+        OPENVINO_ASSERT(!jcp.runtime_data_offsets || std::is_sorted(layout.begin(), layout.end()),
+                        "Runtime data offsets are supported only for the planar layouts");
         io_shapes.push_back(shape);
         io_data_layouts.push_back(layout);
         io_data_sizes.push_back(etype.size());
@@ -267,6 +272,16 @@ void KernelEmitter::init_data_pointers(const Xbyak::Reg64& reg_indexes, const Xb
             }
         }
     };
+    // the offsets are read from the call args, params is the operand holding the call args pointer
+    auto init_ptr_with_runtime_offset = [&](Reg64 pointer, size_t param_idx, const Xbyak::Operand& params, Reg64 reg_tmp) {
+        for (size_t j = 0; j < offset_rank; j++) {
+            h->mov(reg_tmp, params);
+            h->mov(reg_tmp, h->ptr[reg_tmp + GET_OFF(data_offsets)]);
+            h->mov(reg_tmp, h->ptr[reg_tmp + (param_idx * offset_rank + j) * sizeof(size_t)]);
+            h->imul(reg_tmp, h->ptr[reg_indexes + j * sizeof(size_t)]);
+            h->add(pointer, reg_tmp);
+        }
+    };
     const auto spare_corruptable_gpr = std::find_if(gp_regs_pool.begin(), gp_regs_pool.end(),
                                                    [this](size_t reg) {
                                                         return reg != reg_indexes_idx && reg != reg_const_params_idx;
@@ -287,7 +302,10 @@ void KernelEmitter::init_data_pointers(const Xbyak::Reg64& reg_indexes, const Xb
             h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
         else
             h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
-        init_ptr_with_offset(data_ptr_regs[i], data_offsets[i], reg_tmp);
+        if (jcp.runtime_data_offsets)
+            init_ptr_with_runtime_offset(data_ptr_regs[i], i, reg_const_params, reg_tmp);
+        else
+            init_ptr_with_offset(data_ptr_regs[i], data_offsets[i], reg_tmp);
     }
     // a rare case when num_params is maximal, so we have no spare gprs
     // * Static case: we can use reg_const_params as the last reg_tmp for the last iteration (and corrupt it), since
@@ -296,9 +314,16 @@ void KernelEmitter::init_data_pointers(const Xbyak::Reg64& reg_indexes, const Xb
     //     push a reg on the stack, and restore it value afterwards
     if (last_iter_explicitly) {
         h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
-        reg_tmp = reg_const_params;
-        // can corrupt reg_const_params, since we won't use it anymore
-        init_ptr_with_offset(data_ptr_regs[i], data_offsets[i], reg_tmp);
+        if (jcp.runtime_data_offsets) {
+            // the call args pointer is kept on the stack, since reg_const_params is corrupted by the offsets
+            h->push(reg_const_params);
+            init_ptr_with_runtime_offset(data_ptr_regs[i], i, h->ptr[h->rsp], reg_const_params);
+            h->add(h->rsp, sizeof(size_t));
+        } else {
+            reg_tmp = reg_const_params;
+            // can corrupt reg_const_params, since we won't use it anymore
+            init_ptr_with_offset(data_ptr_regs[i], data_offsets[i], reg_tmp);
+        }
     }
 }
 void KernelEmitter::emit_impl(const std::vector<size_t>& in,
@@ -430,6 +455,104 @@ void LoopEndEmitter::emit_impl(const std::vector<size_t>& in,
     }
 }
 
+PerfCountEmitter::PerfCountEmitter(jit_generator* h, cpu_isa_t isa) : jit_emitter(h, isa) {
+    in_out_type_ = emitter_in_out_map::gpr_to_gpr;
+}
+
+void PerfCountEmitter::emit_internal_call(const void* func, const void* arg0, const void* arg1) const {
+    Xbyak::Operand gprs_to_save[] = {h->r8, h->r9, h->r10, h->r11, h->r12, h->r13, h->r14, h->r15,
+                                     h->rax, h->rcx, h->rdx, h->rdi, h->rsi, h->rbp, h->rbx};
+    size_t n_gprs_to_save = sizeof(gprs_to_save) / sizeof(gprs_to_save[0]);
+
+    h->sub(h->rsp, n_gprs_to_save * gpr_size);
+    for (size_t i = 0; i < n_gprs_to_save; ++i)
+        h->mov(h->ptr[h->rsp + i * gpr_size], gprs_to_save[i]);
+
+    // caller obligation to save k-regs and vector registers as callee may use them
+    const bool is_avx512 = mayiuse(avx512_core);
+    const size_t n_k_regs_to_save = is_avx512 ? 8 : 0;
+    h->sub(h->rsp, n_k_regs_to_save * k_mask_size);
+    for (size_t i = 0; i < n_k_regs_to_save; ++i)
+        h->kmovq(h->ptr[h->rsp + i * k_mask_size], Opmask(static_cast<int>(i)));
+
+    h->sub(h->rsp, get_max_vecs_count() * get_vec_length());
+    for (size_t i = 0; i < get_max_vecs_count(); ++i) {
+        if (is_avx512)
+            h->uni_vmovups(h->ptr[h->rsp + i * get_vec_length()], Zmm(static_cast<int>(i)));
+        else
+            h->uni_vmovups(h->ptr[h->rsp + i * get_vec_length()], Ymm(static_cast<int>(i)));
+    }
+
+    h->mov(h->rbp, reinterpret_cast<uintptr_t>(func));
+    h->mov(abi_param1, reinterpret_cast<uintptr_t>(arg0));
+    h->mov(abi_param2, reinterpret_cast<uintptr_t>(arg1));
+
+    // align stack on 16-byte as ABI requires
+    // note that RBX must not be changed by the callee
+    h->mov(h->rbx, h->rsp);
+    h->and_(h->rbx, 0xf);
+    h->sub(h->rsp, h->rbx);
+#ifdef _WIN32
+    // shadow space for the register parameters
+    h->sub(h->rsp, 4 * gpr_size);
+#endif
+
+    h->call(h->rbp);
+
+#ifdef _WIN32
+    h->add(h->rsp, 4 * gpr_size);
+#endif
+    h->add(h->rsp, h->rbx);
+
+    for (int i = static_cast<int>(get_max_vecs_count()) - 1; i >= 0; --i) {
+        if (is_avx512)
+            h->uni_vmovups(Zmm(i), h->ptr[h->rsp + i * get_vec_length()]);
+        else
+            h->uni_vmovups(Ymm(i), h->ptr[h->rsp + i * get_vec_length()]);
+    }
+    h->add(h->rsp, get_max_vecs_count() * get_vec_length());
+
+    for (int i = static_cast<int>(n_k_regs_to_save) - 1; i >= 0; --i)
+        h->kmovq(Opmask(i), h->ptr[h->rsp + i * k_mask_size]);
+    h->add(h->rsp, n_k_regs_to_save * k_mask_size);
+
+    for (int i = static_cast<int>(n_gprs_to_save) - 1; i >= 0; --i)
+        h->mov(gprs_to_save[i], h->ptr[h->rsp + i * gpr_size]);
+    h->add(h->rsp, n_gprs_to_save * gpr_size);
+}
+
+PerfCountBeginEmitter::PerfCountBeginEmitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr)
+    : PerfCountEmitter(h, isa) {
+    m_pc_begin = ov::as_type_ptr<snippets::op::PerfCountBegin>(expr->get_node());
+    if (!m_pc_begin)
+        IE_THROW() << "PerfCountBeginEmitter invoked with invalid op argument";
+}
+
+void PerfCountBeginEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out) const {
+    emit_internal_call(reinterpret_cast<const void*>(set_start_count), m_pc_begin.get(), nullptr);
+}
+
+void PerfCountBeginEmitter::set_start_count(snippets::op::PerfCountBegin* pc_begin) {
+    pc_begin->set_start_count(__rdtsc());
+}
+
+PerfCountEndEmitter::PerfCountEndEmitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr)
+    : PerfCountEmitter(h, isa) {
+    m_pc_end = ov::as_type_ptr<snippets::op::PerfCountEnd>(expr->get_node());
+    if (!m_pc_end)
+        IE_THROW() << "PerfCountEndEmitter invoked with invalid op argument";
+    m_pc_begin = m_pc_end->get_pc_begin();
+}
+
+void PerfCountEndEmitter::emit_impl(const std::vector<size_t>& in, const std::vector<size_t>& out) const {
+    emit_internal_call(reinterpret_cast<const void*>(accumulate), m_pc_begin.get(), m_pc_end.get());
+}
+
+void PerfCountEndEmitter::accumulate(snippets::op::PerfCountBegin* pc_begin, snippets::op::PerfCountEnd* pc_end) {
+    // the overhead of the counter calls is included, it is negligible compared to the outermost Loops
+    pc_end->accumulate(__rdtsc() - pc_begin->get_start_count());
+}
+
 NopEmitter::NopEmitter(jit_generator* h, cpu_isa_t isa, const ExpressionPtr& expr) : jit_emitter(h, isa) {
     in_out_type_ = emitter_in_out_map::gpr_to_gpr;
 }
@@ -32,11 +32,17 @@ struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *buffer_scratchpad_ptr = nullptr;
+    // [num_inputs + num_outputs][master_shape rank - 1] byte offsets of the scheduler dimensions,
+    // used when the kernel is compiled with runtime_data_offsets
+    const size_t *data_offsets = nullptr;
 };
 
 struct jit_snippets_compile_args {
     std::vector<size_t> master_shape{};
     size_t tile_rank = 0;
+    // the data offsets of the scheduler dimensions are taken from the call args, so the kernel doesn't depend on
+    // the outer dimensions of the master shape
+    bool runtime_data_offsets = false;
 };
 ///
 /// \brief jit_container_emitter designed to wrap Emitters that contain other Emitters (for example, KernelEmitter)
@@ -166,6 +172,49 @@ private:
     std::vector<int64_t> finalization_offsets;
 };
 
+/**
+ * @interface PerfCountEmitter
+ * @brief Base class for the emitters of the performance counters. The counter ticks (rdtsc) are read and saved into
+ *        the counter ops by the C++ function called from the kernel, so all the registers are preserved.
+ */
+class PerfCountEmitter : public jit_emitter {
+public:
+    PerfCountEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa);
+    size_t get_inputs_num() const override {return 0;}
+
+protected:
+    void emit_internal_call(const void* func, const void* arg0, const void* arg1) const;
+};
+
+class PerfCountBeginEmitter : public PerfCountEmitter {
+public:
+    PerfCountBeginEmitter(dnnl::impl::cpu::x64::jit_generator* h,
+                          dnnl::impl::cpu::x64::cpu_isa_t isa,
+                          const ov::snippets::lowered::ExpressionPtr& expr);
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out) const override;
+    static void set_start_count(snippets::op::PerfCountBegin* pc_begin);
+
+    std::shared_ptr<snippets::op::PerfCountBegin> m_pc_begin;
+};
+
+class PerfCountEndEmitter : public PerfCountEmitter {
+public:
+    PerfCountEndEmitter(dnnl::impl::cpu::x64::jit_generator* h,
+                        dnnl::impl::cpu::x64::cpu_isa_t isa,
+                        const ov::snippets::lowered::ExpressionPtr& expr);
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out) const override;
+    static void accumulate(snippets::op::PerfCountBegin* pc_begin, snippets::op::PerfCountEnd* pc_end);
+
+    std::shared_ptr<snippets::op::PerfCountBegin> m_pc_begin;
+    std::shared_ptr<snippets::op::PerfCountEnd> m_pc_end;
+};
+
 class NopEmitter : public jit_emitter {
 public:
     NopEmitter(dnnl::impl::cpu::x64::jit_generator* h,
@@ -29,8 +29,10 @@
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/util/common_util.hpp"
+#include "utils/huge_pages.h"
 
 #include <algorithm>
+#include <chrono>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
@@ -66,12 +68,17 @@ struct ImmediateSerialExecutor : public ITaskExecutor {
 ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                          const Config &cfg,
                          const ExtensionManager::Ptr& extMgr,
-                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin) :
+                         const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                         const PackedWeights::CPtr& packedWeights,
+                         const SelectedDescriptors::CPtr& selectedDescriptors) :
     InferenceEngine::ExecutableNetworkThreadSafeDefault{nullptr, nullptr},
     extensionManager(extMgr),
     _network(network),
     _cfg{cfg},
-    _name{network.getName()} {
+    _name{network.getName()},
+    _socketWeights{cfg.weightsNumaPlacement},
+    _packedWeights{packedWeights},
+    _selectedDescriptors{selectedDescriptors} {
     SetPointerToPlugin(plugin);
     auto function = network.getFunction();
     if (function == nullptr) {
@@ -80,6 +87,10 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     bool isFloatModel = !ov::op::util::has_op_with_type<ngraph::op::FakeQuantize>(function);
 
     _mutex = std::make_shared<std::mutex>();
+    if (_cfg.shareWeightsAcrossModels)
+        _sharedSocketWeights = SocketsWeights::getGlobal(_cfg.weightsNumaPlacement);
+    if (_cfg.sharedRtCache)
+        _sharedParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, true);
     const auto& core = _plugin->GetCore();
     if (!core)
         IE_THROW() << "Unable to get API version. Core is unavailable";
@@ -100,7 +111,13 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
 #if FIX_62820 && (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
         _taskExecutor = std::make_shared<TBBStreamsExecutor>(streamsExecutorConfig);
 #else
-        _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        if (_cfg.sharedStreamsExecutor) {
+            // LOW, MEDIUM and HIGH are queued with -1, 0 and 1 priorities, the other executor users queue with 0
+            const auto priority = static_cast<int>(_cfg.modelPriority) - static_cast<int>(ov::hint::Priority::MEDIUM);
+            _taskExecutor = _plugin->executorManager()->getSharedCPUStreamsExecutor(streamsExecutorConfig, priority);
+        } else {
+            _taskExecutor = _plugin->executorManager()->getIdleCPUStreamsExecutor(streamsExecutorConfig);
+        }
 #endif
     }
     if (0 != cfg.streamExecutorConfig._streams) {
@@ -114,6 +131,27 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         _callbackExecutor = _taskExecutor;
     }
+    // the single stream of the latency oriented configurations is split into the groups of threads executing
+    // the batch slices of a request concurrently
+    if (_cfg.batchSplit && !_cfg.isLegacyApi && _cfg.streamExecutorConfig._streams == 1) {
+        _batchSplitThreadsNum = _cfg.streamExecutorConfig._threads > 0 ? _cfg.streamExecutorConfig._threads : parallel_get_max_threads();
+        const auto slicesNum = BatchSplitter::getSlicesNum(function, _batchSplitThreadsNum);
+        if (slicesNum > 1) {
+            auto sliceNetwork = InferenceEngine::details::cloneNetwork(_network);
+            if (BatchSplitter::reshapeToSlice(sliceNetwork.getFunction(), slicesNum)) {
+                _batchSliceNetwork = sliceNetwork;
+                _batchSlicesNum = slicesNum;
+            }
+        }
+    }
+
+    auto stageStart = std::chrono::steady_clock::now();
+    auto finishStage = [&](const char* stage) {
+        const auto now = std::chrono::steady_clock::now();
+        _compilationStages[stage] = std::chrono::duration<double, std::milli>(now - stageStart).count();
+        stageStart = now;
+    };
+
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -134,6 +172,43 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
     } else {
         ExecNetwork::GetGraph();
     }
+    finishStage("graph");
+    // the streams build their graphs concurrently, so the slowest graph is reported for each stage
+    for (auto&& graph : _graphs) {
+        for (const auto& stage : graph.getCreationStages()) {
+            auto& duration = _compilationStages[stage.first];
+            duration = std::max(duration, stage.second);
+        }
+    }
+
+    if (!_cfg.warmupShapes.empty()) {
+        // each stream prepares the primitives of its own graph, so the streams are warmed up concurrently
+        auto warmUp = [this] {
+            auto graphLock = ExecNetwork::GetGraph();
+            if (graphLock._graph._warmedUp)
+                return;
+            for (const auto& inputShapes : _cfg.warmupShapes) {
+                graphLock._graph.WarmUp(inputShapes);
+            }
+            graphLock._graph._warmedUp = true;
+        };
+        if (_cfg.streamExecutorConfig._streams != 0) {
+            auto all_graphs_warmed_up = [&] {
+                return std::all_of(_graphs.begin(), _graphs.end(), [&] (GraphGuard& graph) {
+                    return graph._warmedUp;
+                });
+            };
+            do {
+                for (auto&& task : tasks) {
+                    task = warmUp;
+                }
+                _taskExecutor->runAndWait(tasks);
+            } while (!all_graphs_warmed_up());
+        } else {
+            warmUp();
+        }
+        finishStage("warmup");
+    }
 
     // Save all MemoryLayer data tensors. Will use insight about mechanics
     // of MemoryLayer implementation. It uses output edge of MemoryLayer
@@ -145,7 +220,6 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (!memoryNode) {
                     IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
                 }
-                auto state_store = memoryNode->getStore();
                 auto state_name = memoryNode->getId();
 
                 // Remove suffix with pair ID. Internal information.
@@ -153,7 +227,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
                 if (suffix_idx != std::string::npos)
                     state_name = state_name.substr(0, suffix_idx);
 
-                memoryStates.emplace_back(new VariableState(state_name, state_store));
+                memoryStates.emplace_back(memoryNode->makeState(state_name, _cfg.maxStateReservedLength, _cfg.bindStateTensors));
             }
         }
     }
@@ -172,19 +246,47 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
         std::exception_ptr exception;
         auto makeGraph = [&] {
             try {
-                GraphContext::Ptr ctx;
+                std::vector<GraphContext::Ptr> contexts(_batchSlicesNum);
                 {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
                     // disable weights caching if graph was created only once
-                    auto weightsCache = _cfg.streamExecutorConfig._streams != 1 ? _socketWeights[socketId] : nullptr;
+                    auto weightsCache = _cfg.streamExecutorConfig._streams != 1 || _batchSlicesNum > 1 ? _socketWeights[socketId] : nullptr;
+                    if (weightsCache && streamsExecutor)
+                        weightsCache->setNumaNodeId(streamsExecutor->GetNumaNodeId());
+                    auto sharedWeightsCache = _sharedSocketWeights ? (*_sharedSocketWeights)[socketId] : nullptr;
+                    if (sharedWeightsCache && streamsExecutor)
+                        sharedWeightsCache->setNumaNodeId(streamsExecutor->GetNumaNodeId());
 
                     auto isQuantizedFlag =
                         (_cfg.lpTransformsMode == Config::On) &&
                         ov::pass::low_precision::LowPrecision::isFunctionQuantized(_network.getFunction());
 
-                    ctx = std::make_shared<GraphContext>(_cfg, extensionManager, weightsCache, isQuantizedFlag);
+                    // each batch slice has its own context, since the slices are executed concurrently
+                    for (auto& ctx : contexts) {
+                        ctx = std::make_shared<GraphContext>(_cfg,
+                                                            extensionManager,
+                                                            weightsCache,
+                                                            isQuantizedFlag,
+                                                            sharedWeightsCache,
+                                                            _sharedParamsCache,
+                                                            _packedWeights,
+                                                            _selectedDescriptors);
+                        if (auto execTimeline = ctx->getExecTimeline())
+                            execTimeline->setStreamId(streamId);
+                    }
+                }
+                if (_batchSlicesNum > 1) {
+                    auto& graph = graphLock._graph;
+                    graph._batchSplitter = std::make_shared<BatchSplitter>(_batchSlicesNum, _batchSplitThreadsNum);
+                    graph._batchSlices.resize(_batchSlicesNum - 1);
+                    // the primitives are created in the arena of the slice to be tuned for its threads number
+                    graph._batchSplitter->execute([&](size_t slice) {
+                        auto& sliceGraph = slice == 0 ? static_cast<Graph&>(graph) : graph._batchSlices[slice - 1];
+                        sliceGraph.CreateGraph(_batchSliceNetwork, contexts[slice]);
+                    });
+                } else {
+                    graphLock._graph.CreateGraph(_network, contexts.front());
                 }
-                graphLock._graph.CreateGraph(_network, ctx);
             } catch (...) {
                 exception = std::current_exception();
             }
@@ -298,9 +400,28 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::enable_cpu_pinning.name()),
             RO_property(ov::hint::scheduling_core_type.name()),
             RO_property(ov::hint::enable_hyper_threading.name()),
+            RO_property(ov::hint::model_priority.name()),
             RO_property(ov::execution_devices.name()),
             RO_property(ov::intel_cpu::denormals_optimization.name()),
             RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+            RO_property(ov::intel_cpu::weights_numa_placement.name()),
+            RO_property(ov::intel_cpu::weights_memory_per_numa_node.name()),
+            RO_property(ov::intel_cpu::huge_pages.name()),
+            RO_property(ov::intel_cpu::huge_pages_memory_size.name()),
+            RO_property(ov::intel_cpu::batch_split.name()),
+            RO_property(ov::intel_cpu::batch_split_slices.name()),
+            RO_property(ov::intel_cpu::minimize_reorders.name()),
+            RO_property(ov::intel_cpu::fast_math_ops.name()),
+            RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::memory_statistics.name()),
+            RO_property(ov::intel_cpu::enable_exec_timeline.name()),
+            RO_property(ov::intel_cpu::exec_timeline_capacity.name()),
+            RO_property(ov::intel_cpu::exec_timeline.name()),
+            RO_property(ov::intel_cpu::transformations_profile.name()),
+            RO_property(ov::intel_cpu::compilation_stages.name()),
+            RO_property(ov::intel_cpu::warmup_shapes.name()),
+            RO_property(ov::intel_cpu::max_state_reserved_length.name()),
+            RO_property(ov::intel_cpu::bind_state_tensors.name()),
         };
     }
 
@@ -349,6 +470,8 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::hint::enable_hyper_threading)::value_type(use_ht);
     } else if (name == ov::hint::execution_mode) {
         return config.executionMode;
+    } else if (name == ov::hint::model_priority) {
+        return config.modelPriority;
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
@@ -358,6 +481,111 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(config.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(config.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::weights_numa_placement) {
+        return decltype(ov::intel_cpu::weights_numa_placement)::value_type(config.weightsNumaPlacement);
+    } else if (name == ov::intel_cpu::huge_pages) {
+        return decltype(ov::intel_cpu::huge_pages)::value_type(config.hugePagesMode);
+    } else if (name == ov::intel_cpu::huge_pages_memory_size) {
+        return decltype(ov::intel_cpu::huge_pages_memory_size)::value_type(getHugePagesBackedSize());
+    } else if (name == ov::intel_cpu::batch_split) {
+        return decltype(ov::intel_cpu::batch_split)::value_type(config.batchSplit);
+    } else if (name == ov::intel_cpu::batch_split_slices) {
+        return decltype(ov::intel_cpu::batch_split_slices)::value_type(_batchSlicesNum);
+    } else if (name == ov::intel_cpu::minimize_reorders) {
+        return decltype(ov::intel_cpu::minimize_reorders)::value_type(config.minimizeReorders);
+    } else if (name == ov::intel_cpu::fast_math_ops) {
+        return decltype(ov::intel_cpu::fast_math_ops)::value_type(config.getFastMathOps());
+    } else if (name == ov::intel_cpu::weights_memory_per_numa_node) {
+        auto statistics = _socketWeights.getMemoryStatistics();
+        // the shared registry accounts the weights of all the compiled models using it
+        if (_sharedSocketWeights) {
+            for (const auto& item : _sharedSocketWeights->getMemoryStatistics())
+                statistics[item.first] += item.second;
+        }
+        return decltype(ov::intel_cpu::weights_memory_per_numa_node)::value_type(statistics);
+    } else if (name == ov::intel_cpu::runtime_cache_statistics) {
+        MultiCache::Statistics statistics;
+        auto accumulate = [&statistics](const MultiCacheCPtr& cache) {
+            const auto cacheStatistics = cache->getStatistics();
+            statistics.hits += cacheStatistics.hits;
+            statistics.misses += cacheStatistics.misses;
+            statistics.evictions += cacheStatistics.evictions;
+        };
+        if (_sharedParamsCache) {
+            accumulate(_sharedParamsCache);
+        } else {
+            for (auto&& graphGuard : _graphs) {
+                // the graph of the current stream is already locked
+                std::unique_lock<std::mutex> lock;
+                if (&graphGuard != &graphLock._graph)
+                    lock = std::unique_lock<std::mutex>(graphGuard._mutex);
+                if (graphGuard.IsReady())
+                    accumulate(graphGuard.getGraphContext()->getParamsCache());
+                for (auto& slice : graphGuard._batchSlices) {
+                    if (slice.IsReady())
+                        accumulate(slice.getGraphContext()->getParamsCache());
+                }
+            }
+        }
+        return decltype(ov::intel_cpu::runtime_cache_statistics)::value_type{
+            {"hits", statistics.hits},
+            {"misses", statistics.misses},
+            {"evictions", statistics.evictions}};
+    } else if (name == ov::intel_cpu::memory_statistics) {
+        std::map<std::string, uint64_t> statistics;
+        for (auto&& graphGuard : _graphs) {
+            // the graph of the current stream is already locked
+            std::unique_lock<std::mutex> lock;
+            if (&graphGuard != &graphLock._graph)
+                lock = std::unique_lock<std::mutex>(graphGuard._mutex);
+            graphGuard.accumulateMemoryStatistics(statistics);
+            for (auto& slice : graphGuard._batchSlices)
+                slice.accumulateMemoryStatistics(statistics);
+        }
+        uint64_t weightsCacheSize = 0;
+        for (const auto& item : _socketWeights.getMemoryStatistics())
+            weightsCacheSize += item.second;
+        statistics["weights_cache"] = weightsCacheSize;
+        if (_sharedSocketWeights) {
+            uint64_t sharedSize = 0;
+            for (const auto& item : _sharedSocketWeights->getMemoryStatistics())
+                sharedSize += item.second;
+            statistics["weights_cache.shared"] = sharedSize;
+        }
+        const uint64_t total = statistics["weights"] + statistics["weights_cache"] + statistics["weights_cache.shared"] +
+                               statistics["activations"] + statistics["scratchpad"];
+        statistics["total"] = total;
+        statistics["total.peak"] = total - statistics["activations"] + statistics["activations.peak"];
+        return decltype(ov::intel_cpu::memory_statistics)::value_type(statistics);
+    } else if (name == ov::intel_cpu::enable_exec_timeline) {
+        return decltype(ov::intel_cpu::enable_exec_timeline)::value_type(config.collectExecTimeline);
+    } else if (name == ov::intel_cpu::exec_timeline_capacity) {
+        return decltype(ov::intel_cpu::exec_timeline_capacity)::value_type(config.execTimelineCapacity);
+    } else if (name == ov::intel_cpu::warmup_shapes) {
+        return decltype(ov::intel_cpu::warmup_shapes)::value_type(config.getWarmupShapes());
+    } else if (name == ov::intel_cpu::max_state_reserved_length) {
+        return decltype(ov::intel_cpu::max_state_reserved_length)::value_type(config.maxStateReservedLength);
+    } else if (name == ov::intel_cpu::bind_state_tensors) {
+        return decltype(ov::intel_cpu::bind_state_tensors)::value_type(config.bindStateTensors);
+    } else if (name == ov::intel_cpu::exec_timeline) {
+        std::vector<ExecTimeline::Event> events;
+        for (auto&& graphGuard : _graphs) {
+            // the graph of the current stream is already locked
+            std::unique_lock<std::mutex> lock;
+            if (&graphGuard != &graphLock._graph)
+                lock = std::unique_lock<std::mutex>(graphGuard._mutex);
+            if (!graphGuard.IsReady())
+                continue;
+            if (auto execTimeline = graphGuard.getGraphContext()->getExecTimeline()) {
+                auto graphEvents = execTimeline->getEvents();
+                events.insert(events.end(), graphEvents.begin(), graphEvents.end());
+            }
+        }
+        return decltype(ov::intel_cpu::exec_timeline)::value_type(ExecTimeline::toChromeTrace(events));
+    } else if (name == ov::intel_cpu::transformations_profile) {
+        return decltype(ov::intel_cpu::transformations_profile)::value_type(_transformationsProfile);
+    } else if (name == ov::intel_cpu::compilation_stages) {
+        return decltype(ov::intel_cpu::compilation_stages)::value_type(_compilationStages);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -367,6 +595,20 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
 void ExecNetwork::Export(std::ostream& modelStream) {
     CNNNetworkSerializer serializer(modelStream, extensionManager);
     serializer <<_network;
+
+    // the repacked weights are stored after the model, so the imported model doesn't reorder the weights again
+    // as well as the selected primitive descriptors, so the imported model skips their selection
+    PackedWeights packedWeights;
+    SelectedDescriptors selectedDescriptors;
+    {
+        auto graphLock = GetGraph();
+        for (const auto& node : graphLock._graph.GetNodes()) {
+            node->exportPackedWeights(packedWeights);
+            selectedDescriptors.add(*node);
+        }
+    }
+    packedWeights.serialize(modelStream);
+    selectedDescriptors.serialize(modelStream);
 }
 
 }   // namespace intel_cpu
@@ -8,6 +8,7 @@
 #include <cpp_interfaces/impl/ie_executable_network_thread_safe_default.hpp>
 
 #include "graph.h"
+#include "batch_splitter.h"
 #include "extension_mngr.h"
 #include "graph_context.h"
 #include <threading/ie_thread_local.hpp>
@@ -37,7 +38,9 @@ public:
 
     ExecNetwork(const InferenceEngine::CNNNetwork &network, const Config &cfg,
                 const ExtensionManager::Ptr &extMgr,
-                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin);
+                const std::shared_ptr<InferenceEngine::IInferencePlugin>& plugin,
+                const PackedWeights::CPtr& packedWeights = nullptr,
+                const SelectedDescriptors::CPtr& selectedDescriptors = nullptr);
 
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
@@ -47,6 +50,16 @@ public:
 
     void Export(std::ostream& modelStream) override;
 
+    // the JSON profile of the transformations returned by ov::intel_cpu::transformations_profile
+    void setTransformationsProfile(std::string profile) {
+        _transformationsProfile = std::move(profile);
+    }
+
+    // the stages of the plugin preceding the graphs creation returned by ov::intel_cpu::compilation_stages
+    void addCompilationStages(const std::map<std::string, double>& stages) {
+        _compilationStages.insert(stages.begin(), stages.end());
+    }
+
 protected:
     friend class InferRequestBase;
     ExtensionManager::Ptr extensionManager;
@@ -60,6 +73,11 @@ protected:
     std::string                                 _name;
     struct GraphGuard : public Graph {
         std::mutex  _mutex;
+        // the primitives for the ov::intel_cpu::warmup_shapes profiles are already prepared
+        bool        _warmedUp = false;
+        // the graphs of the other batch slices when the request is split by the batch, this one executes the first slice
+        std::deque<Graph>   _batchSlices;
+        BatchSplitter::Ptr  _batchSplitter;
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(GraphGuard& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             GraphGuard& _graph;
@@ -69,6 +87,21 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable SocketsWeights                      _socketWeights;
+    // process-wide registry shared with the other compiled models, nullptr if the sharing is disabled
+    SocketsWeights::Ptr                         _sharedSocketWeights;
+    // runtime cache shared by the graphs of all the streams, nullptr if each graph has its own one
+    MultiCachePtr                               _sharedParamsCache;
+    // repacked weights imported with the model, nullptr if the model is not imported
+    PackedWeights::CPtr                         _packedWeights;
+    // primitive descriptors selected by the exported graph, nullptr if the model is not imported
+    SelectedDescriptors::CPtr                   _selectedDescriptors;
+    // the model reshaped to the batch of a slice, when the requests are split by the batch
+    InferenceEngine::CNNNetwork                 _batchSliceNetwork;
+    size_t                                      _batchSlicesNum = 1;
+    // the threads of the stream shared by the slices
+    int                                         _batchSplitThreadsNum = 0;
+    std::string                                 _transformationsProfile;
+    std::map<std::string, double>               _compilationStages;
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
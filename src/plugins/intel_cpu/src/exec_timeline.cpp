@@ -0,0 +1,156 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "exec_timeline.h"
+
+#include <iomanip>
+#include <sstream>
+
+#include "node.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// the same epoch is used by all the streams, so their timelines are aligned
+const std::chrono::steady_clock::time_point& timelineEpoch() {
+    static const auto epoch = std::chrono::steady_clock::now();
+    return epoch;
+}
+
+double toMicroseconds(std::chrono::steady_clock::duration duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+void writeJsonString(std::ostream& os, const std::string& str) {
+    os << '"';
+    for (const char c : str) {
+        switch (c) {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        case '\t':
+            os << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                os << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(c) << std::dec;
+            } else {
+                os << c;
+            }
+        }
+    }
+    os << '"';
+}
+}  // namespace
+
+constexpr size_t ExecTimeline::defaultCapacity;
+
+ExecTimeline::Scope::Scope(ExecTimeline& timeline, const Node& node, Phase phase)
+    : m_timeline(timeline),
+      m_name(node.getName()),
+      m_type(node.getTypeStr()),
+      m_phase(phase),
+      m_start(std::chrono::steady_clock::now()) {}
+
+ExecTimeline::Scope::Scope(ExecTimeline& timeline, std::string name, Phase phase)
+    : m_timeline(timeline),
+      m_name(std::move(name)),
+      m_phase(phase),
+      m_start(std::chrono::steady_clock::now()) {}
+
+ExecTimeline::Scope::~Scope() {
+    m_timeline.record(std::move(m_name), std::move(m_type), m_phase, m_start, std::chrono::steady_clock::now());
+}
+
+ExecTimeline::ExecTimeline(size_t capacity) : m_capacity(capacity) {
+    timelineEpoch();
+}
+
+void ExecTimeline::setStreamId(int streamId) {
+    std::lock_guard<std::mutex> lock(m_guard);
+    m_streamId = streamId;
+}
+
+void ExecTimeline::nextInference() {
+    std::lock_guard<std::mutex> lock(m_guard);
+    m_inferId++;
+}
+
+void ExecTimeline::record(std::string name, std::string type, Phase phase,
+                          std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point finish) {
+    std::lock_guard<std::mutex> lock(m_guard);
+    if (0 == m_capacity)
+        return;
+    if (m_events.size() == m_capacity)
+        m_events.pop_front();
+
+    auto threadItr = m_threadIds.find(std::this_thread::get_id());
+    if (threadItr == m_threadIds.end()) {
+        threadItr = m_threadIds.emplace(std::this_thread::get_id(), static_cast<int>(m_threadIds.size())).first;
+    }
+
+    m_events.push_back({std::move(name),
+                        std::move(type),
+                        phase,
+                        m_streamId,
+                        threadItr->second,
+                        m_inferId,
+                        toMicroseconds(start - timelineEpoch()),
+                        toMicroseconds(finish - start)});
+}
+
+std::vector<ExecTimeline::Event> ExecTimeline::getEvents() const {
+    std::lock_guard<std::mutex> lock(m_guard);
+    return std::vector<Event>(m_events.begin(), m_events.end());
+}
+
+const char* ExecTimeline::phaseName(Phase phase) {
+    switch (phase) {
+    case Phase::Inference:
+        return "Inference";
+    case Phase::ShapeInference:
+        return "ShapeInference";
+    case Phase::PrepareParams:
+        return "PrepareParams";
+    case Phase::Execution:
+        return "Execution";
+    }
+    return "Unknown";
+}
+
+std::string ExecTimeline::toChromeTrace(const std::vector<Event>& events) {
+    std::stringstream result;
+    result << std::fixed << std::setprecision(3);
+    result << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    bool first = true;
+    for (const auto& event : events) {
+        if (!first)
+            result << ",";
+        first = false;
+        // the streams are shown as processes and the worker threads of a stream as its threads
+        result << "{\"name\":";
+        writeJsonString(result, event.name);
+        result << ",\"cat\":\"" << phaseName(event.phase) << "\""
+               << ",\"ph\":\"X\""
+               << ",\"ts\":" << event.start
+               << ",\"dur\":" << event.duration
+               << ",\"pid\":" << event.streamId
+               << ",\"tid\":" << event.threadId
+               << ",\"args\":{\"type\":";
+        writeJsonString(result, event.type);
+        result << ",\"infer\":" << event.inferId << "}}";
+    }
+    result << "]}";
+    return result.str();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,98 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+class Node;
+
+/**
+ * @brief Collects the per node execution timeline of the graphs sharing one graph context (i.e. one stream).
+ * The shape inference and the parameters preparation are recorded separately from the node execution.
+ * The events of the last inferences are kept in a bounded buffer and can be exported in the Chrome trace format.
+ *
+ * Is a thread safe
+ */
+class ExecTimeline {
+public:
+    typedef std::shared_ptr<ExecTimeline> Ptr;
+
+    enum class Phase {
+        Inference,
+        ShapeInference,
+        PrepareParams,
+        Execution
+    };
+
+    struct Event {
+        std::string name;
+        std::string type;
+        Phase phase;
+        int streamId;
+        int threadId;
+        uint64_t inferId;
+        double start;  // microseconds since the process wide epoch
+        double duration;
+    };
+
+    class Scope {
+    public:
+        Scope(ExecTimeline& timeline, const Node& node, Phase phase);
+        Scope(ExecTimeline& timeline, std::string name, Phase phase);
+        ~Scope();
+
+    private:
+        ExecTimeline& m_timeline;
+        std::string m_name;
+        std::string m_type;
+        Phase m_phase;
+        std::chrono::steady_clock::time_point m_start;
+    };
+
+    explicit ExecTimeline(size_t capacity);
+
+    void setStreamId(int streamId);
+    /**
+     * @brief Marks the beginning of the next inference, the following events are attributed to it
+     */
+    void nextInference();
+
+    std::vector<Event> getEvents() const;
+
+    /**
+     * @brief Serializes the events to the Chrome trace JSON (chrome://tracing, Perfetto)
+     */
+    static std::string toChromeTrace(const std::vector<Event>& events);
+    static const char* phaseName(Phase phase);
+
+private:
+    void record(std::string name, std::string type, Phase phase,
+                std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point finish);
+
+    mutable std::mutex m_guard;
+    std::deque<Event> m_events;
+    std::unordered_map<std::thread::id, int> m_threadIds;
+    size_t m_capacity;
+    int m_streamId = 0;
+    uint64_t m_inferId = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
+
+#define EXEC_TIMELINE_SCOPE(_timeline, _node, _phase) \
+    std::unique_ptr<ExecTimeline::Scope> etScope = (_timeline) ? \
+        std::unique_ptr<ExecTimeline::Scope>(new ExecTimeline::Scope(*(_timeline), *(_node), ExecTimeline::Phase::_phase)) : nullptr;
@@ -3,6 +3,7 @@
 //
 
 #include <algorithm>
+#include <chrono>
 #include <string>
 #include <map>
 #include <vector>
@@ -10,6 +11,7 @@
 #include <unordered_set>
 #include <limits>
 #include <fstream>
+#include <functional>
 #include <unordered_map>
 #include <memory>
 #include <utility>
@@ -24,6 +26,7 @@
 #include "itt.h"
 #include "infer_request.h"
 #include "nodes/input.h"
+#include "nodes/memory.hpp"
 #include <nodes/reorder.h>
 #include "nodes/convert.h"
 #include "nodes/subgraph.h"
@@ -42,6 +45,7 @@
 #include "utils/node_dumper.h"
 #include "utils/ngraph_utils.hpp"
 #include "utils/cpu_utils.hpp"
+#include "utils/huge_pages.h"
 #include "utils/verbose.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
 
@@ -53,8 +57,10 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_desc.hpp>
 #include <common/primitive_desc_iface.hpp>
+#include <common/primitive_hashing_utils.hpp>
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
 #   include <tbb/task.h>
+#   include <tbb/task_group.h>
 #endif
 
 using namespace dnnl;
@@ -79,8 +85,13 @@ void Graph::CreateGraph(NET &net, const GraphContext::CPtr ctx) {
         ForgetGraphData();
 
     context = ctx;
+    // the constants, the weights and the static memory arena are allocated while the graph is created
+    HugePagesScope hugePagesScope(getConfig().hugePagesMode);
 
+    const auto replicateStart = std::chrono::steady_clock::now();
     Replicate(net);
+    creationStages["graph.replicate"] =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - replicateStart).count();
 
     InitGraph();
 
@@ -101,6 +112,7 @@ void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
 
     this->graphNodes = graphNodes;
     this->graphEdges = graphEdges;
+    HugePagesScope hugePagesScope(getConfig().hugePagesMode);
 
     for (auto node : graphNodes) {
         if ("Parameter" == node->getTypeStr()) {
@@ -355,6 +367,12 @@ void Graph::Replicate(const CNNNetwork &network) {
 
 void Graph::InitGraph() {
     GraphOptimizer optimizer;
+    auto stageStart = std::chrono::steady_clock::now();
+    auto finishStage = [&](const char* stage) {
+        const auto now = std::chrono::steady_clock::now();
+        creationStages[stage] = std::chrono::duration<double, std::milli>(now - stageStart).count();
+        stageStart = now;
+    };
 
     SortTopologically();
     InitNodes();
@@ -364,6 +382,8 @@ void Graph::InitGraph() {
 
     InitDescriptors();
 
+    optimizer.ApplyLayoutOptimizations(*this);
+
     ResolveInplaceDirections();
 
     InitOptimalPrimitiveDescriptors();
@@ -374,10 +394,16 @@ void Graph::InitGraph() {
     SortTopologically();
 
     const bool hasDynNodes = ProcessDynNodes();
+    finishStage("graph.init");
 
     Allocate();
+    finishStage("graph.allocate");
+
+    const auto& streamsConfig = getConfig().streamExecutorConfig;
+    pCoresArena = PCoresArena::create(streamsConfig._streams_info_table, streamsConfig._streams);
 
     CreatePrimitivesAndExecConstants();
+    finishStage("graph.primitives");
 
 #ifndef CPU_DEBUG_CAPS
     for (auto &graphNode : graphNodes) {
@@ -387,6 +413,18 @@ void Graph::InitGraph() {
 
     ExtractExecutableNodes();
 
+    if (hasDynNodes) {
+        InitDynamicExecPlans();
+        InitMemoryPeakTracking();
+    }
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    // the memory of dynamic edges is rebound at runtime, so the branches dependencies are only built for static graphs
+    if (getConfig().enableParallelBranches && !hasDynNodes) {
+        BuildParallelBranchesPlan();
+    }
+#endif
+
     status = hasDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
 
@@ -439,7 +477,10 @@ void Graph::InitDescriptors() {
     for (auto &node : graphNodes) {
         OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
         DEBUG_LOG("Select optimal primitive descriptors for node: ", node->getName());
-        node->selectOptimalPrimitiveDescriptor();
+        // the imported model reuses the selection of the exported graph if the node has the same descriptors
+        const auto& selectedDescriptors = context->getSelectedDescriptors();
+        if (!selectedDescriptors || !selectedDescriptors->restore(*node))
+            node->selectOptimalPrimitiveDescriptor();
     }
 }
 
@@ -481,6 +522,131 @@ void Graph::ExtractExecutableNodes() {
     }
 }
 
+void Graph::InitDynamicExecPlans() {
+    const auto capacity = getConfig().execPlansCacheCapacity;
+    if (0 == capacity)
+        return;
+
+    // states may change the shapes regardless of the graph input shapes
+    for (const auto& node : executableGraphNodes) {
+        if (node->getType() == Type::MemoryInput)
+            return;
+    }
+
+    // the output shapes of the nodes after a sync point may depend on the data, so they are not recorded
+    dynamicExecPlanSize = executableGraphNodes.size();
+    for (const auto& item : syncNodesInds) {
+        dynamicExecPlanSize = std::min(dynamicExecPlanSize, item.second);
+    }
+
+    if (dynamicExecPlanSize > 0) {
+        execPlansCache = std::make_shared<MultiCache>(capacity);
+    }
+}
+
+void Graph::BuildParallelBranchesPlan() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::BuildParallelBranchesPlan");
+
+    struct MemRegion {
+        const uint8_t* begin;
+        const uint8_t* end;
+    };
+
+    auto collectRegions = [](const std::vector<EdgeWeakPtr>& edges) {
+        std::vector<MemRegion> regions;
+        for (const auto& weakEdge : edges) {
+            auto edge = weakEdge.lock();
+            if (!edge)
+                continue;
+            auto mem = edge->getMemoryPtr();
+            if (!mem || !mem->isAllocated() || mem->getSize() == 0)
+                continue;
+            auto ptr = static_cast<const uint8_t*>(mem->getData());
+            regions.push_back({ptr, ptr + mem->getSize()});
+        }
+        return regions;
+    };
+
+    auto overlap = [](const std::vector<MemRegion>& lhs, const std::vector<MemRegion>& rhs) {
+        for (const auto& l : lhs) {
+            for (const auto& r : rhs) {
+                if (l.begin < r.end && r.begin < l.end)
+                    return true;
+            }
+        }
+        return false;
+    };
+
+    const size_t nodesNum = executableGraphNodes.size();
+    std::unordered_map<const Node*, size_t> execIndices;
+    for (size_t i = 0; i < nodesNum; ++i) {
+        execIndices[executableGraphNodes[i].get()] = i;
+    }
+
+    std::vector<std::vector<MemRegion>> reads(nodesNum);
+    std::vector<std::vector<MemRegion>> writes(nodesNum);
+    std::vector<std::vector<size_t>> dataParents(nodesNum);
+    std::vector<bool> isBarrier(nodesNum);
+    for (size_t i = 0; i < nodesNum; ++i) {
+        const auto& node = executableGraphNodes[i];
+        reads[i] = collectRegions(node->getParentEdges());
+        writes[i] = collectRegions(node->getChildEdges());
+        for (size_t j = 0; j < node->getParentEdges().size(); ++j) {
+            auto itr = execIndices.find(node->getParentEdgeAt(j)->getParent().get());
+            if (itr != execIndices.end())
+                dataParents[i].push_back(itr->second);
+        }
+        // memory nodes communicate through the internal state, not through the edges
+        isBarrier[i] = one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput);
+    }
+
+    auto dependsOn = [&](size_t prev, size_t next) {
+        if (isBarrier[prev] || isBarrier[next])
+            return true;
+        if (std::find(dataParents[next].begin(), dataParents[next].end(), prev) != dataParents[next].end())
+            return true;
+        // Memory conflicts cover the in-place edges as well as the buffers shared by the memory reuse solver,
+        // whose lifetimes are computed with respect to the sequential execution order
+        return overlap(writes[prev], reads[next]) || overlap(writes[prev], writes[next]) || overlap(reads[prev], writes[next]);
+    };
+
+    std::vector<std::vector<size_t>> successors(nodesNum);
+    std::vector<size_t> predecessorsNum(nodesNum, 0);
+    // only the dependencies that are not implied transitively are stored to keep the scheduling overhead low
+    std::vector<std::vector<bool>> ancestors(nodesNum, std::vector<bool>(nodesNum, false));
+    bool hasIndependentBranches = false;
+    for (size_t next = 0; next < nodesNum; ++next) {
+        auto& nextAncestors = ancestors[next];
+        for (size_t prev = next; prev-- > 0;) {
+            if (nextAncestors[prev] || !dependsOn(prev, next))
+                continue;
+            successors[prev].push_back(next);
+            predecessorsNum[next]++;
+            nextAncestors[prev] = true;
+            const auto& prevAncestors = ancestors[prev];
+            for (size_t k = 0; k < prev; ++k) {
+                if (prevAncestors[k])
+                    nextAncestors[k] = true;
+            }
+        }
+        // the execution order is total if each node depends on the previous one
+        if (next > 0 && !nextAncestors[next - 1])
+            hasIndependentBranches = true;
+    }
+
+    if (!hasIndependentBranches) {
+        DEBUG_LOG("Graph ", GetName(), " has no independent branches, the sequential execution is used");
+        return;
+    }
+
+    parallelBranchesSuccessors = std::move(successors);
+    parallelBranchesPredecessorsNum = std::move(predecessorsNum);
+    for (size_t i = 0; i < nodesNum; ++i) {
+        if (parallelBranchesPredecessorsNum[i] == 0)
+            parallelBranchesRoots.push_back(i);
+    }
+}
+
 void Graph::CreatePrimitivesAndExecConstants() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
     dnnl::stream stream(getEngine());
@@ -513,7 +679,14 @@ void Graph::CreatePrimitivesAndExecConstants() const {
         {
             OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
             DEBUG_LOG(*node);
-            node->createPrimitive();
+            // the kernels threading is set up for the threads number of the arena the node is executed in
+            if (pCoresArena && PCoresArena::isComputeBound(*node)) {
+                pCoresArena->execute([&]() {
+                    node->createPrimitive();
+                });
+            } else {
+                node->createPrimitive();
+            }
         }
 
         if (!node->isConstant()) {
@@ -829,6 +1002,23 @@ void Graph::AllocateWithReuse() {
     }
 
     if (!undefinedBoxes.empty()) {
+        // The states appended in place are served by the state buffers, which are bound on each inference.
+        // The whole cluster shares the state buffer, even the graph outputs, which are copied to the user blobs then.
+        for (auto& box : undefinedBoxes) {
+            MemoryMngrPtr stateMemMngr;
+            for (auto& edge : edge_clusters[box.id]) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation && !stateMemMngr)
+                    stateMemMngr = node::MemoryInput::getStateMemMngr(*edge);
+            }
+            if (!stateMemMngr)
+                continue;
+            DEBUG_LOG("State memory manager ", stateMemMngr, " ", this);
+            for (auto& edge : edge_clusters[box.id]) {
+                if (edge->getStatus() == Edge::Status::NeedAllocation)
+                    edge->allocate(stateMemMngr);
+            }
+        }
+
         // Use proxy memory manager for output edges
         for (auto& box : undefinedBoxes) {
             for (auto& edge : edge_clusters[box.id]) {
@@ -881,9 +1071,59 @@ void Graph::AllocateWithReuse() {
 
         MemorySolver::normalizeBoxes(undefinedBoxes);
 
+        // The clusters, whose dynamic shapes have upper bounds, are served by views into a single arena planned once
+        // for the upper bound sizes. So the shapes variations within the bounds do not cause any reallocation.
+        // The boxes with huge upper bounds (e.g. the ones derived from the data type limits) are still allocated on demand.
+        constexpr int64_t maxBoundedBoxSize = static_cast<int64_t>(1) << 30;
+        auto getBoundedSize = [](const edge_cluster_t& cluster) -> int64_t {
+            bool needAllocation = false;
+            int64_t maxSize = 0;
+            for (auto& edge : cluster) {
+                if (!edge->hasDefinedMaxSize())
+                    return -1;
+                needAllocation |= edge->getStatus() == Edge::Status::NeedAllocation;
+                maxSize = std::max(maxSize, static_cast<int64_t>(edge->getDesc().getMaxMemSize()));
+            }
+            return needAllocation ? maxSize : -1;
+        };
+
+        std::vector<MemorySolver::Box> boundedBoxes;
+        for (auto itr = undefinedBoxes.begin(); itr != undefinedBoxes.end();) {
+            const auto boundedSize = getBoundedSize(edge_clusters[itr->id]);
+            if (boundedSize < 0 || boundedSize > maxBoundedBoxSize) {
+                ++itr;
+                continue;
+            }
+            auto box = *itr;
+            box.size = std::max<int64_t>(div_up(boundedSize, alignment), 1);
+            boundedBoxes.push_back(box);
+            itr = undefinedBoxes.erase(itr);
+        }
+
+        if (!boundedBoxes.empty()) {
+            MemorySolver boundedMemSolver(boundedBoxes);
+            size_t bounded_total_size = static_cast<size_t>(boundedMemSolver.solve()) * alignment;
+            memBoundedWorkspace = std::make_shared<Memory>(getEngine(),
+                DnnlBlockedMemoryDesc(InferenceEngine::Precision::I8, Shape(InferenceEngine::SizeVector{bounded_total_size})));
+            auto* bounded_workspace_ptr = static_cast<int8_t*>(memBoundedWorkspace->getData());
+            for (auto& box : boundedBoxes) {
+                // the memory manager falls back to its own allocation if a shape exceeds the upper bound
+                auto viewMngr = make_unique<MemoryMngrWithReuse>();
+                viewMngr->setExtBuff(bounded_workspace_ptr + boundedMemSolver.getOffset(box.id) * alignment, box.size * alignment);
+                auto boxMemMngr = std::make_shared<DnnlMemoryMngr>(std::move(viewMngr));
+                for (auto& edge : edge_clusters[box.id]) {
+                    if (edge->getStatus() == Edge::Status::NeedAllocation) {
+                        edge->allocate(boxMemMngr);
+                    }
+                }
+            }
+        }
+
         std::vector<std::vector<MemorySolver::Box>> groups; //groups of nonoverlapping boxes
         constexpr bool enableMemReuse = true; // set false to disable mem reuse for debug purposes
-        if (enableMemReuse) {
+        if (undefinedBoxes.empty()) {
+            // all the dynamic clusters are served by the bounded arena
+        } else if (enableMemReuse) {
             groups.push_back({undefinedBoxes.front()});
             for (size_t i = 1; i < undefinedBoxes.size(); ++i) {
                 const auto& box = undefinedBoxes[i];
@@ -1069,6 +1309,14 @@ void Graph::PullOutputData(BlobMap &out) {
         }
 
         auto outDims = intr_blob.getStaticDims();
+        // The graph may write the output to the user blob memory bound up to its capacity, while the blob can
+        // reallocate the memory when its shape grows, so the memory is kept until the output is copied
+        Blob::Ptr userMemoryHolder;
+        const auto& extDims = ext_blob->getTensorDesc().getDims();
+        if (intr_blob.getData() == static_cast<void*>(ext_blob->buffer()) && !extDims.empty() &&
+            std::accumulate(outDims.begin(), outDims.end(), size_t{1}, std::multiplies<size_t>()) > ext_blob->size()) {
+            userMemoryHolder = ext_blob->createROI(std::vector<size_t>(extDims.size(), 0), extDims);
+        }
         if (out[name]->getTensorDesc().getDims() != outDims && !isScalarOutput) {
             // WA: because input/output info initially contains non empty dims, order etc.
             // and setDims (called inside setShape) can't correct modify blocked desc for desc with blocked layout
@@ -1120,11 +1368,19 @@ void Graph::PullOutputData(BlobMap &out) {
 }
 
 void Graph::InferStatic(InferRequestBase* request) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    if (!parallelBranchesRoots.empty()) {
+        InferStaticParallel(request);
+        return;
+    }
+#endif
     dnnl::stream stream(getEngine());
+    auto execTimeline = context->getExecTimeline().get();
 
     for (const auto& node : executableGraphNodes) {
         VERBOSE(node, getConfig().debugCaps.verbose);
         PERF(node, getConfig().collectPerfCounters);
+        EXEC_TIMELINE_SCOPE(execTimeline, node, Execution);
 
         if (request)
             request->ThrowIfCanceled();
@@ -1132,22 +1388,143 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+void Graph::InferStaticParallel(InferRequestBase* request) {
+    const size_t nodesNum = executableGraphNodes.size();
+    std::unique_ptr<std::atomic<size_t>[]> pendingPredecessors(new std::atomic<size_t>[nodesNum]);
+    for (size_t i = 0; i < nodesNum; ++i) {
+        pendingPredecessors[i].store(parallelBranchesPredecessorsNum[i], std::memory_order_relaxed);
+    }
+
+    tbb::task_group tasks;
+    auto execTimeline = context->getExecTimeline().get();
+    std::function<void(size_t)> runBranch;
+    runBranch = [&](size_t indx) {
+        // the dnnl stream is not shared between the concurrently executed branches
+        dnnl::stream stream(getEngine());
+        while (true) {
+            {
+                const auto& node = executableGraphNodes[indx];
+                VERBOSE(node, getConfig().debugCaps.verbose);
+                PERF(node, getConfig().collectPerfCounters);
+                EXEC_TIMELINE_SCOPE(execTimeline, node, Execution);
+
+                if (request)
+                    request->ThrowIfCanceled();
+                ExecuteNode(node, stream);
+            }
+            // continue with the first ready successor in the current task, the others are spawned
+            size_t nextIndx = nodesNum;
+            for (auto succ : parallelBranchesSuccessors[indx]) {
+                if (pendingPredecessors[succ].fetch_sub(1, std::memory_order_acq_rel) != 1)
+                    continue;
+                if (nextIndx == nodesNum) {
+                    nextIndx = succ;
+                } else {
+                    tasks.run([&runBranch, succ] {
+                        runBranch(succ);
+                    });
+                }
+            }
+            if (nextIndx == nodesNum)
+                break;
+            indx = nextIndx;
+        }
+    };
+
+    for (size_t i = 1; i < parallelBranchesRoots.size(); ++i) {
+        const auto root = parallelBranchesRoots[i];
+        tasks.run([&runBranch, root] {
+            runBranch(root);
+        });
+    }
+    tasks.run_and_wait([&] {
+        runBranch(parallelBranchesRoots.front());
+    });
+}
+#endif
+
 namespace {
 
+/**
+ * @brief Keeps the output shapes of the executable nodes recorded for a particular graph input shapes signature.
+ * Only the nodes preceding the first synchronization point are recorded, since their output shapes depend solely
+ * on the graph input shapes.
+ */
+struct DynamicExecPlan {
+    explicit DynamicExecPlan(size_t nodesNum) : outputShapes(nodesNum) {}
+
+    std::vector<std::vector<VectorDims>> outputShapes;
+    bool complete = false;
+};
+
+using DynamicExecPlanPtr = std::shared_ptr<DynamicExecPlan>;
+
+struct DynamicExecPlanKey {
+    std::vector<VectorDims> inputShapes;
+
+    size_t hash() const {
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        for (const auto& dims : inputShapes) {
+            seed = get_vector_hash(seed, dims);
+        }
+        return seed;
+    }
+
+    bool operator==(const DynamicExecPlanKey& rhs) const {
+        return inputShapes == rhs.inputShapes;
+    }
+};
+
 class IUpdateNodes {
 public:
     virtual void run(size_t stopIndx) = 0;
     virtual ~IUpdateNodes() = default;
 };
 
+void updateNodeShapes(const NodePtr& node, size_t indx, DynamicExecPlan* plan) {
+    if (plan && indx < plan->outputShapes.size() && node->getType() != Type::Input) {
+        auto& outputShapes = plan->outputShapes[indx];
+        const size_t outputsNum = node->getOriginalOutputsNumber();
+        if (plan->complete) {
+            // the shapes are the function of the graph input shapes, so the recorded ones are applied without shape inference
+            if (!outputShapes.empty() && outputShapes.size() == outputsNum) {
+                node->redefineOutputMemory(outputShapes);
+                return;
+            }
+        } else {
+            node->updateShapes();
+            outputShapes.clear();
+            for (size_t port = 0; port < outputsNum; ++port) {
+                const auto edges = node->getChildEdgesAtPort(port);
+                if (edges.empty() || !edges.front()->getMemory().getDesc().isDefined()) {
+                    outputShapes.clear();
+                    break;
+                }
+                outputShapes.push_back(edges.front()->getMemory().getStaticDims());
+            }
+            return;
+        }
+    }
+    node->updateShapes();
+}
+
 class UpdateNodesSeq : public IUpdateNodes {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes,
+                            DynamicExecPlan* plan = nullptr,
+                            ExecTimeline* timeline = nullptr)
+        : m_executableGraphNodes(executableGraphNodes), m_plan(plan), m_timeline(timeline) {}
     void run(size_t stopIndx) override {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                {
+                    EXEC_TIMELINE_SCOPE(m_timeline, node, ShapeInference);
+                    updateNodeShapes(node, prepareCounter, m_plan);
+                }
+                EXEC_TIMELINE_SCOPE(m_timeline, node, PrepareParams);
                 node->updateDynamicParams();
             }
         }
@@ -1156,6 +1533,8 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    DynamicExecPlan* m_plan;
+    ExecTimeline* m_timeline;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1165,13 +1544,17 @@ private:
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_OMP)
 class UpdateNodesBase : public IUpdateNodes {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes) : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes,
+                             DynamicExecPlan* plan = nullptr,
+                             ExecTimeline* timeline = nullptr)
+        : m_executableGraphNodes(executableGraphNodes), m_plan(plan), m_timeline(timeline) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    EXEC_TIMELINE_SCOPE(m_timeline, node, ShapeInference);
+                    updateNodeShapes(node, i, m_plan);
                 }
                 m_prepareCounter.store(i, std::memory_order::memory_order_release);
             }
@@ -1195,6 +1578,7 @@ public:
             while (local_counter < prepareCounter) {
                 const auto& node = m_executableGraphNodes[local_counter++];
                 if (node->isDynamicNode()) {
+                    EXEC_TIMELINE_SCOPE(m_timeline, node, PrepareParams);
                     node->updateDynamicParams();
                 }
             }
@@ -1205,6 +1589,8 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    DynamicExecPlan* m_plan;
+    ExecTimeline* m_timeline;
 };
 
 #if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
@@ -1331,6 +1717,18 @@ public:
 void Graph::InferDynamic(InferRequestBase* request) {
     dnnl::stream stream(getEngine());
 
+    DynamicExecPlanPtr execPlan;
+    if (execPlansCache && dynamicExecPlanSize > 0) {
+        DynamicExecPlanKey key;
+        for (const auto& input : inputNodesMap) {
+            key.inputShapes.push_back(input.second->getChildEdgeAt(0)->getMemory().getStaticDims());
+        }
+        const size_t planSize = dynamicExecPlanSize;
+        execPlan = execPlansCache->getOrCreate(key, [planSize](const DynamicExecPlanKey&) {
+            return std::make_shared<DynamicExecPlan>(planSize);
+        }).first;
+    }
+
     std::set<size_t> syncIndsWorkSet;
     for (const auto& nodeIndx : syncNodesInds) {
         syncIndsWorkSet.insert(nodeIndx.second);
@@ -1340,11 +1738,12 @@ void Graph::InferDynamic(InferRequestBase* request) {
     }
     syncIndsWorkSet.insert(executableGraphNodes.size());
 
+    auto execTimeline = context->getExecTimeline().get();
     std::unique_ptr<IUpdateNodes> updateNodes{};
     if (parallel_get_max_threads() > 1) {
-        updateNodes.reset(new UpdateNodes(executableGraphNodes));
+        updateNodes.reset(new UpdateNodes(executableGraphNodes, execPlan.get(), execTimeline));
     } else {
-        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes));
+        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes, execPlan.get(), execTimeline));
     }
     size_t inferCounter = 0;
 
@@ -1354,12 +1753,163 @@ void Graph::InferDynamic(InferRequestBase* request) {
             auto& node = executableGraphNodes[inferCounter];
             VERBOSE(node, getConfig().debugCaps.verbose);
             PERF(node, getConfig().collectPerfCounters);
+            EXEC_TIMELINE_SCOPE(execTimeline, node, Execution);
 
             if (request)
                 request->ThrowIfCanceled();
             ExecuteNode(node, stream);
         }
     }
+
+    if (execPlan)
+        execPlan->complete = true;
+
+    UpdateMemoryPeak();
+}
+
+void Graph::InitMemoryPeakTracking() {
+    dynamicBuffers.clear();
+    // the edges sharing a buffer share the memory manager, the buffers of the arenas and the external ones are skipped
+    std::unordered_set<const IMemoryMngrObserver*> memoryMngrs;
+    for (const auto& edge : graphEdges) {
+        const auto memory = edge->getMemoryPtr();
+        if (!memory || edge->isUseExternalMemory() || !edge->getParent()->isDynamicNode() || edge->getParent()->isConstant())
+            continue;
+        const auto memoryMngr = memory->getMemoryMngr();
+        if (!memoryMngr || memoryMngr->hasExtBuffer() || !memoryMngrs.insert(memoryMngr.get()).second)
+            continue;
+        dynamicBuffers.push_back(memory);
+    }
+    dynamicBuffersPeak.reset(new std::atomic<uint64_t>[dynamicBuffers.size()]);
+    for (size_t i = 0; i < dynamicBuffers.size(); i++)
+        dynamicBuffersPeak[i].store(0, std::memory_order_relaxed);
+}
+
+void Graph::UpdateMemoryPeak() {
+    for (size_t i = 0; i < dynamicBuffers.size(); i++) {
+        const auto& memory = dynamicBuffers[i];
+        const uint64_t size = memory->isAllocated() ? memory->getSize() : 0;
+        if (size > dynamicBuffersPeak[i].load(std::memory_order_relaxed))
+            dynamicBuffersPeak[i].store(size, std::memory_order_relaxed);
+    }
+}
+
+void Graph::accumulateMemoryStatistics(std::map<std::string, uint64_t>& statistics) const {
+    if (!IsReady())
+        return;
+
+    // the buffers are accounted once by their data pointers, the tensors of the arenas are accounted by the arenas
+    std::unordered_set<const void*> buffers;
+    auto inArena = [](const MemoryPtr& arena, const void* data) {
+        if (!arena || !arena->isAllocated())
+            return false;
+        const auto begin = static_cast<const uint8_t*>(arena->getData());
+        return data >= begin && data < begin + arena->getSize();
+    };
+    auto account = [&buffers](const MemoryCPtr& memory) -> uint64_t {
+        if (!memory || !memory->isAllocated())
+            return 0;
+        const void* data = memory->getData();
+        if (!data || !buffers.insert(data).second)
+            return 0;
+        return memory->getSize();
+    };
+
+    uint64_t weights = 0;
+    uint64_t activations = 0;
+    uint64_t scratchpad = 0;
+    for (const auto& node : graphNodes) {
+        uint64_t nodeSize = 0;
+        for (const auto& memory : node->internalBlobMemory)
+            nodeSize += account(memory);
+        for (const auto& item : node->privateWeightCache)
+            nodeSize += account(item.second);
+        weights += nodeSize;
+
+        for (const auto& childEdge : node->getChildEdges()) {
+            const auto edge = childEdge.lock();
+            // the outputs stored in the weights cache are accounted by the compiled model
+            if (!edge || edge->isUseExternalMemory())
+                continue;
+            const auto memory = edge->getMemoryPtr();
+            if (!memory || !memory->isAllocated())
+                continue;
+            const void* data = memory->getData();
+            if (inArena(memWorkspace, data) || inArena(memBoundedWorkspace, data)) {
+                nodeSize += memory->getSize();
+                continue;
+            }
+            const uint64_t size = account(memory);
+            nodeSize += size;
+            if (node->isConstant())
+                weights += size;
+            else
+                activations += size;
+        }
+
+        const uint64_t scratchSize = account(node->scratchpadMem) + account(node->scratchBufferMem);
+        scratchpad += scratchSize;
+        nodeSize += scratchSize;
+        statistics["nodes." + node->getName()] += nodeSize;
+    }
+
+    for (const auto& arena : {memWorkspace, memBoundedWorkspace}) {
+        if (arena && arena->isAllocated())
+            activations += arena->getSize();
+    }
+
+    uint64_t activationsPeak = activations;
+    for (size_t i = 0; i < dynamicBuffers.size(); i++) {
+        const auto& memory = dynamicBuffers[i];
+        const uint64_t size = memory->isAllocated() && buffers.count(memory->getData()) ? memory->getSize() : 0;
+        activationsPeak += std::max(size, dynamicBuffersPeak[i].load(std::memory_order_relaxed)) - size;
+    }
+
+    statistics["weights"] += weights;
+    statistics["activations"] += activations;
+    statistics["activations.peak"] += activationsPeak;
+    statistics["scratchpad"] += scratchpad;
+}
+
+void Graph::WarmUp(const std::map<std::string, VectorDims>& inputShapes) {
+    // the primitives of the static graph are created at the compilation stage
+    if (Status::ReadyDynamic != status)
+        return;
+
+    for (const auto& input : inputNodesMap) {
+        auto shapeItr = inputShapes.find(input.first);
+        if (shapeItr == inputShapes.end() && inputNodesMap.size() == 1)
+            shapeItr = inputShapes.find("");
+        if (shapeItr == inputShapes.end()) {
+            if (input.second->isDynamicNode())
+                IE_THROW() << "Warm-up shape is not specified for the dynamic input " << input.first << " of the graph " << GetName();
+            continue;
+        }
+        const auto& shape = input.second->getOutputShapeAtPort(0);
+        if (!shape.isCompatible(shapeItr->second))
+            IE_THROW() << "Warm-up shape " << MemoryDescUtils::dims2str(shapeItr->second) << " is not compatible with the shape "
+                       << shape.toString() << " of the input " << input.first << " of the graph " << GetName();
+        if (input.second->isDynamicNode())
+            input.second->redefineOutputMemory({shapeItr->second});
+    }
+    for (const auto& input : inputShapes) {
+        if (!input.first.empty() && inputNodesMap.find(input.first) == inputNodesMap.end())
+            IE_THROW() << "Warm-up shape is specified for the unknown input " << input.first << " of the graph " << GetName();
+    }
+
+    // the output shapes of the data dependent nodes are not known without the preceding nodes execution
+    size_t stopIndx = executableGraphNodes.size();
+    for (const auto& nodeIndx : syncNodesInds)
+        stopIndx = std::min(stopIndx, nodeIndx.second);
+
+    auto execTimeline = context->getExecTimeline().get();
+    std::unique_ptr<IUpdateNodes> updateNodes{};
+    if (parallel_get_max_threads() > 1) {
+        updateNodes.reset(new UpdateNodes(executableGraphNodes, nullptr, execTimeline));
+    } else {
+        updateNodes.reset(new UpdateNodesSeq(executableGraphNodes, nullptr, execTimeline));
+    }
+    updateNodes->run(stopIndx);
 }
 
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
@@ -1367,7 +1917,15 @@ inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream)
 
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, node->profiling.execute);
     DEBUG_LOG(*node);
-    if (node->isDynamicNode()) {
+    if (pCoresArena && PCoresArena::isComputeBound(*node)) {
+        pCoresArena->execute([&]() {
+            if (node->isDynamicNode()) {
+                node->executeDynamic(stream);
+            } else {
+                node->execute(stream);
+            }
+        });
+    } else if (node->isDynamicNode()) {
         node->executeDynamic(stream);
     } else {
         node->execute(stream);
@@ -1379,6 +1937,10 @@ void Graph::Infer(InferRequestBase* request) {
         IE_THROW() << "Wrong state of the ov::intel_cpu::Graph. Topology is not ready.";
     }
 
+    std::unique_ptr<ExecTimeline::Scope> inferScope;
+    if (auto execTimeline = context->getExecTimeline())
+        inferScope.reset(new ExecTimeline::Scope(*execTimeline, GetName(), ExecTimeline::Phase::Inference));
+
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
@@ -13,6 +13,7 @@
 #include "cache/multi_cache.h"
 #include "dnnl_scratch_pad.h"
 #include "graph_context.h"
+#include "hybrid_cores_arena.h"
 #include <map>
 #include <string>
 #include <vector>
@@ -64,6 +65,13 @@ public:
     void PullOutputData(InferenceEngine::BlobMap &out);
 
     void Infer(InferRequestBase* request = nullptr);
+    /**
+     * @brief Runs the shape inference and the parameters preparation of the dynamic nodes for the given input shapes
+     * without the execution, so the primitives for these shapes are created and stored in the runtime cache.
+     * The nodes following the first node whose output shapes depend on data are skipped.
+     * @param inputShapes the static shapes of the graph inputs, the empty name stands for the only graph input
+     */
+    void WarmUp(const std::map<std::string, VectorDims>& inputShapes);
 
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
@@ -194,6 +202,22 @@ public:
 
     Status getStatus() const {return status;}
 
+    /**
+     * @brief Adds the memory held by the graph to the statistics (in bytes): the "weights", "activations" and
+     * "scratchpad" categories with the steady state values, the "activations.peak" with the largest sizes of the
+     * dynamic tensors observed by the inferences, and the "nodes.<name>" with the memory of each node
+     */
+    void accumulateMemoryStatistics(std::map<std::string, uint64_t>& statistics) const;
+
+    /**
+     * @brief Returns the durations of the graph creation stages in milliseconds: "graph.replicate" (the nodes
+     * creation), "graph.init" (the graph optimizations, the primitive descriptors and the edges), "graph.allocate"
+     * and "graph.primitives" (the kernels creation and the constants execution, including the weights reorders)
+     */
+    const std::map<std::string, double>& getCreationStages() const {
+        return creationStages;
+    }
+
 protected:
     void VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes);
 
@@ -206,6 +230,13 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        parallelBranchesSuccessors.clear();
+        parallelBranchesPredecessorsNum.clear();
+        parallelBranchesRoots.clear();
+        execPlansCache.reset();
+        dynamicExecPlanSize = 0;
+        dynamicBuffers.clear();
+        creationStages.clear();
     }
     Status status { Status::NotReady };
 
@@ -216,6 +247,8 @@ protected:
     bool reuse_io_tensors = true;
 
     MemoryPtr memWorkspace;
+    // arena for the dynamic edges with upper bounded shapes
+    MemoryPtr memBoundedWorkspace;
 
     std::vector<NodePtr> graphNodes;
     std::vector<EdgePtr> graphEdges;
@@ -237,9 +270,12 @@ protected:
     void Allocate();
     void AllocateWithReuse();
     void ExtractExecutableNodes();
+    void BuildParallelBranchesPlan();
+    void InitDynamicExecPlans();
     void ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const;
     void CreatePrimitivesAndExecConstants() const;
     void InferStatic(InferRequestBase* request);
+    void InferStaticParallel(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
 
     friend class LegacyInferRequest;
@@ -261,6 +297,29 @@ private:
 
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // dependency DAG over executableGraphNodes (by index) used to execute independent branches concurrently.
+    // Empty when the parallel branches execution mode is disabled or the graph has no independent branches.
+    std::vector<std::vector<size_t>> parallelBranchesSuccessors;
+    std::vector<size_t> parallelBranchesPredecessorsNum;
+    std::vector<size_t> parallelBranchesRoots;
+
+    // LRU cache of the dynamic execution plans keyed by the graph input shapes signature
+    MultiCachePtr execPlansCache;
+    // number of the leading executable nodes covered by a dynamic execution plan
+    size_t dynamicExecPlanSize = 0;
+
+    // executes the compute bound nodes on the Performance cores, is null unless the stream spans different core types
+    PCoresArena::Ptr pCoresArena;
+
+    // the separately allocated buffers of the dynamic tensors and their largest sizes observed at the inferences end
+    std::vector<MemoryCPtr> dynamicBuffers;
+    std::unique_ptr<std::atomic<uint64_t>[]> dynamicBuffersPeak;
+
+    std::map<std::string, double> creationStages;
+
+    void InitMemoryPeakTracking();
+    void UpdateMemoryPeak();
+
     GraphContext::CPtr context;
 
     void EnforceInferencePrecision();
@@ -7,7 +7,9 @@
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "dnnl_scratch_pad.h"
+#include "exec_timeline.h"
 #include "extension_mngr.h"
+#include "selected_descriptors.h"
 #include "weights_cache.hpp"
 
 namespace ov {
@@ -21,12 +23,23 @@ public:
     GraphContext(const Config& config,
                  ExtensionManager::Ptr extensionManager,
                  WeightsSharing::Ptr w_cache,
-                 bool isGraphQuantized)
+                 bool isGraphQuantized,
+                 WeightsSharing::Ptr shared_w_cache = nullptr,
+                 MultiCachePtr params_cache = nullptr,
+                 PackedWeights::CPtr packed_weights = nullptr,
+                 SelectedDescriptors::CPtr selected_descriptors = nullptr)
         : config(config),
           extensionManager(extensionManager),
           weightsCache(w_cache),
+          sharedWeightsCache(shared_w_cache),
+          packedWeights(packed_weights),
+          selectedDescriptors(selected_descriptors),
+          rtParamsCache(params_cache),
           isGraphQuantizedFlag(isGraphQuantized) {
-        rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        if (!rtParamsCache)
+            rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+        if (config.collectExecTimeline)
+            execTimeline = std::make_shared<ExecTimeline>(config.execTimelineCapacity);
         rtScratchPad = std::make_shared<DnnlScratchPad>(eng);
     }
 
@@ -42,6 +55,21 @@ public:
         return weightsCache;
     }
 
+    // process-wide cache, which only accepts the keys identifying the weights by the content
+    WeightsSharing::Ptr getSharedWeightsCache() const {
+        return sharedWeightsCache;
+    }
+
+
+    // the repacked weights imported together with the model, nullptr if there are none
+    PackedWeights::CPtr getPackedWeights() const {
+        return packedWeights;
+    }
+
+    // the primitive descriptors selected by the exported graph, nullptr if the model is not imported
+    SelectedDescriptors::CPtr getSelectedDescriptors() const {
+        return selectedDescriptors;
+    }
 
     MultiCachePtr getParamsCache() const {
         return rtParamsCache;
@@ -55,6 +83,11 @@ public:
         return eng;
     }
 
+    // nullptr unless the execution timeline recording is enabled
+    ExecTimeline::Ptr getExecTimeline() const {
+        return execTimeline;
+    }
+
     bool isGraphQuantized() const {
         return isGraphQuantizedFlag;
     }
@@ -64,9 +97,13 @@ private:
 
     ExtensionManager::Ptr extensionManager;
     WeightsSharing::Ptr weightsCache;         // per NUMA node caches for sharing weights data
+    WeightsSharing::Ptr sharedWeightsCache;   // per NUMA node caches for sharing weights data across the models
+    PackedWeights::CPtr packedWeights;        // repacked weights imported with the model
+    SelectedDescriptors::CPtr selectedDescriptors;  // primitive descriptors imported with the model
 
-    MultiCachePtr rtParamsCache;     // primitive cache
+    MultiCachePtr rtParamsCache;     // primitive cache, may be shared between the streams
     DnnlScratchPadPtr rtScratchPad;  // scratch pad
+    ExecTimeline::Ptr execTimeline;  // shared by the nested graphs
 
     bool isGraphQuantizedFlag = false;
     static dnnl::engine eng;  // onednn engine (singleton)
@@ -13,10 +13,12 @@
 #include <ngraph/pass/manager.hpp>
 #include <openvino/pass/serialize.hpp>
 
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <memory>
 #include <map>
+#include <set>
 
 using namespace InferenceEngine;
 
@@ -28,6 +30,70 @@ void serializeToXML(const Graph &graph, const std::string& path);
 
 namespace {
 
+// The work of the node in the last inference: the bytes of all the inputs and the outputs and
+// the arithmetic operations of the nodes the estimation is known for, -1 if the shapes are unknown
+std::pair<int64_t, int64_t> estimate_node_work(const NodePtr &node) {
+    auto get_desc = [](const EdgePtr& edge) -> MemoryDescPtr {
+        auto memory = edge->getMemoryPtr();
+        if (!memory || !memory->getDesc().isDefined())
+            return nullptr;
+        return memory->getDescPtr();
+    };
+    auto get_elements = [](const MemoryDescPtr& desc) {
+        return static_cast<int64_t>(desc->getShape().getElementsCount());
+    };
+
+    std::vector<MemoryDescPtr> inputs, outputs;
+    for (size_t i = 0; i < node->getParentEdges().size(); i++)
+        inputs.push_back(get_desc(node->getParentEdgeAt(i)));
+    for (size_t i = 0; i < node->getChildEdges().size(); i++)
+        outputs.push_back(get_desc(node->getChildEdgeAt(i)));
+    if (std::any_of(inputs.begin(), inputs.end(), [](const MemoryDescPtr& desc) { return !desc; }) ||
+        std::any_of(outputs.begin(), outputs.end(), [](const MemoryDescPtr& desc) { return !desc; }))
+        return {-1, -1};
+
+    int64_t bytes = 0;
+    for (const auto& desc : inputs)
+        bytes += desc->getCurrentMemSize();
+    // the same output memory is shared by the child edges of the port
+    std::set<int> output_ports;
+    for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+        if (output_ports.insert(node->getChildEdgeAt(i)->getInputNum()).second)
+            bytes += outputs[i]->getCurrentMemSize();
+    }
+
+    int64_t flops = -1;
+    if (outputs.empty() || inputs.empty())
+        return {bytes, flops};
+    const auto output_elements = get_elements(outputs[0]);
+    const auto& output_dims = outputs[0]->getShape().getStaticDims();
+    switch (node->getType()) {
+    case Type::Convolution:
+    case Type::FullyConnected:
+        // the weights are [output channels, multiply-adds per output element]
+        if (inputs.size() > 1 && output_dims.size() > 1) {
+            const auto channels =
+                static_cast<int64_t>(node->getType() == Type::FullyConnected ? output_dims.back() : output_dims[1]);
+            if (channels > 0)
+                flops = 2 * output_elements * (get_elements(inputs[1]) / channels);
+        }
+        break;
+    case Type::MatMul:
+        // [..., M, K] x [..., K, N] = [..., M, N]
+        if (inputs.size() > 1 && !output_dims.empty() && output_dims.back() > 0 && output_elements > 0) {
+            const auto rows = output_elements / static_cast<int64_t>(output_dims.back());
+            flops = 2 * output_elements * (get_elements(inputs[0]) / rows);
+        }
+        break;
+    case Type::Eltwise:
+        flops = output_elements * static_cast<int64_t>(1 + node->getFusedWith().size());
+        break;
+    default:
+        break;
+    }
+    return {bytes, flops};
+}
+
 std::map<std::string, std::string> extract_node_metadata(const NodePtr &node) {
     std::map<std::string, std::string> serialization_info;
 
@@ -108,6 +174,14 @@ std::map<std::string, std::string> extract_node_metadata(const NodePtr &node) {
 
     serialization_info[ExecGraphInfoSerialization::RUNTIME_PRECISION] = node->getRuntimePrecision().name();
 
+    if (node->isExecutable()) {
+        const auto work = estimate_node_work(node);
+        if (work.first >= 0)
+            serialization_info[ExecGraphInfoSerialization::ESTIMATED_BYTES] = std::to_string(work.first);
+        if (work.second >= 0)
+            serialization_info[ExecGraphInfoSerialization::ESTIMATED_FLOPS] = std::to_string(work.second);
+    }
+
     return serialization_info;
 }
 
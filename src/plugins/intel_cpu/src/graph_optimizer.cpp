@@ -14,12 +14,16 @@
 #include "nodes/conv.h"
 #include "nodes/deconv.h"
 #include "nodes/fullyconnected.h"
+#include "nodes/matmul.h"
 #include "nodes/bin_conv.h"
 #include "nodes/fake_quantize.h"
 #include "nodes/mvn.h"
 #include "nodes/transpose.h"
 #include "nodes/interpolate.h"
+#include "nodes/color_convert.h"
 #include "nodes/reduce.h"
+#include "nodes/softmax.h"
+#include "nodes/topk.h"
 #include "nodes/input.h"
 #include "nodes/rnn.h"
 #include "nodes/common/cpu_convert.h"
@@ -99,6 +103,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseFCAndTransposeOnWeights(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseMatMulAndTransposeOnInputs");
+    FuseMatMulAndTransposeOnInputs(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseDeconvolutionAndSimpleOperation");
     FuseDeconvolutionAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -139,6 +147,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseConvolutionAndDWConvolution(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseDWConvolutionAndPWConvolution");
+    FuseDWConvolutionAndPWConvolution(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseConvolutionSumAndConvolutionSumActivation");
     FuseConvolutionSumAndConvolutionSumActivation(graph);
     graph.RemoveDroppedNodes();
@@ -159,10 +171,22 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseMVNAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseColorConvertAndInterpolate");
+    FuseColorConvertAndInterpolate(graph);
+    graph.RemoveDroppedNodes();
+
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseColorConvertAndSimpleOperation");
+    FuseColorConvertAndSimpleOperation(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseInterpolateAndSimpleOperation");
     FuseInterpolateAndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseInterpolateAndSum");
+    FuseInterpolateAndSum(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseNormalizeL2AndSimpleOperation");
     FuseNormalizeL2AndSimpleOperation(graph);
     graph.RemoveDroppedNodes();
@@ -175,6 +199,10 @@ void GraphOptimizer::ApplyCommonGraphOptimizations(Graph &graph) {
     FuseEltwiseAndSimple(graph);
     graph.RemoveDroppedNodes();
 
+    OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "FuseSoftmaxAndTopK");
+    FuseSoftmaxAndTopK(graph);
+    graph.RemoveDroppedNodes();
+
     OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, "reshapeRnnSeq");
     reshapeRnnSeq(graph);
     graph.RemoveDroppedNodes();
@@ -199,6 +227,14 @@ void GraphOptimizer::ApplyImplSpecificGraphOptimizations(Graph &graph) {
     graph.RemoveDroppedEdges();
 }
 
+void GraphOptimizer::ApplyLayoutOptimizations(Graph &graph) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "GraphOptimizer::ApplyLayoutOptimizations");
+
+    // the cost model accounts for the reorders only, not for the speed of the kernels on the revised layouts
+    if (graph.getConfig().minimizeReorders)
+        MinimizeReorders(graph);
+}
+
 void GraphOptimizer::FuseConvMatmulFCDeconvAndDQScales(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -286,7 +322,9 @@ void GraphOptimizer::FuseConvMatmulFCDeconvAndDQScales(Graph &graph) {
 }
 
 void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
-    const std::set<InferenceEngine::Precision> supportedWeightsPrecisions{InferenceEngine::Precision::U8};
+    const std::set<InferenceEngine::Precision> supportedWeightsPrecisions{InferenceEngine::Precision::U8,
+                                                                           InferenceEngine::Precision::U4,
+                                                                           InferenceEngine::Precision::I4};
     const std::set<InferenceEngine::Precision> supportedDataPrecisions{InferenceEngine::Precision::FP32, InferenceEngine::Precision::BF16};
     auto expectedNode = [](NodePtr node, Type expectedType) {
         return node->getType() == expectedType && node->getChildEdges().size() == 1;
@@ -305,7 +343,14 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
         const bool withTranspose = parent->getType() == Type::Transpose;
         const NodePtr transposeNode = withTranspose ? parent : nullptr;
 
-        const auto multiplyNode = withTranspose ? parent->getParentEdgesAtPort(0)[0]->getParent() : parent;
+        // the group-wise decompression is applied to the weights of [OC, G, IC / G] shape, which are reshaped to [OC, IC] after that
+        const auto transposeParent = withTranspose ? parent->getParentEdgesAtPort(0)[0]->getParent() : parent;
+        const bool withReshape = transposeParent->getType() == Type::Reshape;
+        const NodePtr reshapeNode = withReshape ? transposeParent : nullptr;
+        if (withReshape && (withTranspose || !expectedNode(reshapeNode, Type::Reshape) || !reshapeNode->isConstant()))
+            continue;
+
+        const auto multiplyNode = withReshape ? reshapeNode->getParentEdgesAtPort(0)[0]->getParent() : transposeParent;
         if (!expectedNode(multiplyNode, Type::Eltwise) || multiplyNode->getAlgorithm() != Algorithm::EltwiseMultiply ||
             !multiplyNode->isConstant())
             continue;
@@ -350,8 +395,19 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
         if (weightsShape != fcInputWeightsShape)
             continue;
 
-        const auto expectedDims = withTranspose ? VectorDims{1, weightsShape.getDims()[1]}
-                                                 : VectorDims{weightsShape.getDims()[0], 1};
+        if (weightsShape.getRank() != (withReshape ? 3 : 2) || !weightsShape.isStatic())
+            continue;
+        const auto& weightsDims = weightsShape.getStaticDims();
+        if (withReshape) {
+            const auto& fcWeightsDims = reshapeNode->getOutputShapeAtPort(0);
+            if (fcWeightsDims.getRank() != 2 || fcWeightsDims.getDims() != VectorDims({weightsDims[0], weightsDims[1] * weightsDims[2]}))
+                continue;
+        }
+
+        const size_t groupsNum = withReshape ? weightsDims[1] : 1;
+        const auto expectedDims = withReshape ? VectorDims{weightsDims[0], groupsNum, 1}
+                                              : withTranspose ? VectorDims{1, weightsDims[1]}
+                                                              : VectorDims{weightsDims[0], 1};
         if (multiplyConstNode->getOutputShapeAtPort(0).getDims() != expectedDims)
             continue;
         if (withSubtract && subtractConstNode->getOutputShapeAtPort(0).getDims() != expectedDims)
@@ -361,8 +417,11 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
         if (impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core_amx)) {
             // OneDNN AMX IP implementation has limited shapes support due to performance considerations. As a current solution conditions below are copied
             // from OneDNN to make sure correct IP impl will be used since fallback one doesn't support weights decompression feature.
-            size_t OC = withTranspose ? weightsShape.getDims()[1] : weightsShape.getDims()[0];
-            size_t IC = withTranspose ? weightsShape.getDims()[0] : weightsShape.getDims()[1];
+            // The group-wise parameters are not prepacked for the AMX internal IC blocking.
+            if (groupsNum > 1)
+                continue;
+            size_t OC = withTranspose ? weightsDims[1] : weightsDims[0];
+            size_t IC = withTranspose ? weightsDims[0] : weightsDims[1];
             size_t simdWidth = 16;
             size_t vnniFactor = 2;
             size_t maxSize = 512;
@@ -376,6 +435,7 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
         fcNode->fuseDecompressionMultiply(multiplyConstNode);
         if (withSubtract)
             fcNode->fuseDecompressionSubtract(subtractConstNode);
+        fcNode->setDecompressionGroupsNum(groupsNum);
 
         fcNode->addOriginalLayer(multiplyNode->getOriginalLayers());
         fcNode->addOriginalLayer(convertNode->getOriginalLayers());
@@ -394,6 +454,11 @@ void GraphOptimizer::FuseFCAndWeightsDecompression(Graph &graph) {
         graph.DropNode(multiplyNode);
 
         const auto& weightsPrecision = weightsNode->getOriginalOutputPrecisionAtPort(0);
+        // the in-place reshape of the compressed weights is kept, so the weights constant has the [OC, G, IC / G] shape
+        if (withReshape) {
+            reshapeNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
+            reshapeNode->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
+        }
         if (withTranspose) {
             transposeNode->setOriginalInputPrecisionAtPort(0, weightsPrecision);
             transposeNode->setOriginalOutputPrecisionAtPort(0, weightsPrecision);
@@ -761,7 +826,16 @@ void GraphOptimizer::MergeConvertAndScaleShift(Graph& graph) {
     };
 
     auto isSuitableChildNode = [](NodePtr childNode) {
-        return childNode->getType() == Type::Eltwise && childNode->getParentEdges().size() != 2;
+        if (childNode->getType() != Type::Eltwise)
+            return false;
+        if (childNode->getParentEdges().size() != 2)
+            return true;
+        // The arithmetic binary operations (e.g. the residual Add of the quantized branches or the dequantization Subtract)
+        // load the int8 operand on any port and convert it in registers, so the fp32 copy of the operand is not stored
+        return one_of(childNode->getAlgorithm(), Algorithm::EltwiseAdd, Algorithm::EltwiseSubtract, Algorithm::EltwiseMultiply,
+                      Algorithm::EltwiseDivide, Algorithm::EltwiseMaximum, Algorithm::EltwiseMinimum,
+                      Algorithm::EltwiseSquaredDifference) &&
+               childNode->getOriginalOutputPrecisionAtPort(0) == Precision::FP32;
     };
 
     auto parent = graphNodes.begin();
@@ -775,13 +849,15 @@ void GraphOptimizer::MergeConvertAndScaleShift(Graph& graph) {
         CPU_GRAPH_OPTIMIZER_SCOPE(MergeConvertAndScaleShift_ParentNode);
 
         auto childNode = parentNode->getChildEdgeAt(0)->getChild();
-        if (!isSuitableChildNode(childNode)) {
+        // the constant inputs of the binary operations are expected in FP32 by the post ops (e.g. scales and shifts)
+        if (!isSuitableChildNode(childNode) || (childNode->getParentEdges().size() == 2 && parentNode->isConstant())) {
             parent++;
             continue;
         }
 
         CPU_GRAPH_OPTIMIZER_SCOPE(MergeConvertAndScaleShift_ChildNode);
 
+        const auto childPort = parentNode->getChildEdgeAt(0)->getOutputNum();
         auto parents = parentNode->parentEdges;
         for (size_t i = 0; i < parents.size(); i++) {
             auto p_edge = parents[i].lock();
@@ -815,7 +891,7 @@ void GraphOptimizer::MergeConvertAndScaleShift(Graph& graph) {
             parent->addEdge(newEdge);
         }
 
-        childNode->setOriginalInputPrecisionAtPort(0, parentNode->getOriginalInputPrecisionAtPort(0));
+        childNode->setOriginalInputPrecisionAtPort(childPort, parentNode->getOriginalInputPrecisionAtPort(0));
         childNode->addOriginalLayer(parentNode->getOriginalLayers());
         graph.DropNode(parentNode);
     }
@@ -873,6 +949,46 @@ void GraphOptimizer::FuseFCAndTransposeOnWeights(Graph& graph) {
     }
 }
 
+void GraphOptimizer::FuseMatMulAndTransposeOnInputs(Graph& graph) {
+    // The Transpose of an activation input is not executed: its output shares the memory with the input
+    // and MatMul reads the data through the strides of the permuted dimensions
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitablePattern = [](NodePtr parent) {
+        if (parent->getType() != Type::Transpose || parent->isConstant() || parent->isDynamicNode() ||
+            parent->getChildEdges().size() != 1)
+            return false;
+        const auto childEdge = parent->getChildEdgeAt(0);
+        const auto child = childEdge->getChild();
+        if (child->getType() != Type::MatMul || child->isDynamicNode() || !one_of(childEdge->getOutputNum(), 0, 1))
+            return false;
+        // the Transpose output is read in place, so MatMul must consume it in the same precision:
+        // a conversion would insert a Reorder, which reads the shared memory as the dense transposed tensor
+        const auto matMulPrecisions = std::dynamic_pointer_cast<MatMul>(child)->getExecInputPrecisions();
+        if (matMulPrecisions[childEdge->getOutputNum()] != parent->getOriginalInputPrecisionAtPort(0) ||
+            parent->getOriginalOutputPrecisionAtPort(0) != parent->getOriginalInputPrecisionAtPort(0))
+            return false;
+        const auto& order = std::dynamic_pointer_cast<Transpose>(parent)->getOrder();
+        const size_t rank = order.size();
+        // oneDNN reads strided matrices efficiently only if the innermost source dim stays one of the matrix dims
+        return rank >= 2 && rank == parent->getOutputShapeAtPort(0).getRank() &&
+               one_of(rank - 1, order[rank - 1], order[rank - 2]);
+    };
+
+    for (auto parent : graphNodes) {
+        if (isSuitablePattern(parent)) {
+            CPU_GRAPH_OPTIMIZER_SCOPE(FuseMatMulAndTransposeOnInputs);
+            auto transposeNode = std::dynamic_pointer_cast<Transpose>(parent);
+            auto childEdge = parent->getChildEdgeAt(0);
+            auto matMulNode = std::dynamic_pointer_cast<MatMul>(childEdge->getChild());
+            if (!transposeNode || !matMulNode)
+                IE_THROW() << "Cannot cast to Transpose or MatMul node";
+            matMulNode->fuseInputTranspose(childEdge->getOutputNum(), transposeNode->getOrder());
+            transposeNode->setOptimized(true);
+        }
+    }
+}
+
 void GraphOptimizer::FuseConvolutionAndZeroPoints(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1269,6 +1385,92 @@ void GraphOptimizer::FuseConvolutionAndDWConvolution(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseDWConvolutionAndPWConvolution(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto hasConstantWeights = [](const NodePtr &node) {
+        for (size_t i = 1; i < node->getParentEdges().size(); i++) {
+            const auto weights = node->getParentEdgesAtPort(i)[0]->getParent();
+            if (weights->getType() != Type::Input || !weights->isConstant())
+                return false;
+        }
+        return true;
+    };
+
+    auto isSuitableConvolution = [&](const NodePtr &node) {
+        if (node->getType() != Type::Convolution || node->isDropped() || node->isDynamicNode())
+            return false;
+
+        const auto conv = std::dynamic_pointer_cast<Convolution>(node);
+        if (conv == nullptr)
+            IE_THROW() << "Cannot cast to convolution node " << node->getName();
+
+        const auto &fusedWith = node->getFusedWith();
+        const auto outputPrecision = fusedWith.empty() ? node->getOriginalOutputPrecisionAtPort(0)
+                                                       : fusedWith.back()->getOriginalOutputPrecisionAtPort(0);
+        const bool onlyActivationsFused = std::all_of(fusedWith.begin(), fusedWith.end(), [](const NodePtr &fused) {
+            return fused->getType() == Type::Eltwise && DWPWConvolution::isSupportedActivation(fused->getAlgorithm());
+        });
+        return everyone_is(Precision::FP32, node->getOriginalInputPrecisionAtPort(0), node->getOriginalInputPrecisionAtPort(1),
+                           node->getOriginalOutputPrecisionAtPort(0), outputPrecision) &&
+               conv->legacyInputZeroPoints.empty() && conv->legacyWeightsZeroPoints.empty() && conv->inputZeroPoints.empty() &&
+               node->getInputShapeAtPort(0).getRank() == 4 && onlyActivationsFused && hasConstantWeights(node);
+    };
+
+    auto isSuitableParentConvolution = [&](const NodePtr &node) {
+        if (!isSuitableConvolution(node))
+            return false;
+
+        const auto conv = std::dynamic_pointer_cast<Convolution>(node);
+        const auto &weightDims = conv->getWeightDims();
+        const auto &dilation = conv->getDilation();
+        // oneDNN pads such channels to the vector length in the blocked layouts and reorders around the convolution,
+        // the plugin kernel computes them in nhwc as is
+        const size_t channelsBlock = impl::cpu::x64::mayiuse(impl::cpu::x64::avx512_core) ? 16 : 8;
+        const auto channels = node->getInputShapeAtPort(0).getStaticDims()[1];
+        return conv->isDepthWise() && channels % channelsBlock != 0 &&
+               everyone_is(3u, weightDims[weightDims.size() - 1], weightDims[weightDims.size() - 2]) &&
+               everyone_is(0, dilation[0], dilation[1]) &&
+               node->getChildEdges().size() == 1 && node->getChildEdgeAt(0)->getOutputNum() == 0;
+    };
+
+    auto isSuitableChildConvolution = [&](const NodePtr &node) {
+        if (!isSuitableConvolution(node))
+            return false;
+
+        const auto conv = std::dynamic_pointer_cast<Convolution>(node);
+        const auto &weightDims = conv->getWeightDims();
+        const auto &strides = conv->getStride();
+        return conv->getGroupNum() == 1 &&
+               everyone_is(1u, weightDims[weightDims.size() - 1], weightDims[weightDims.size() - 2], strides[0], strides[1]) &&
+               everyone_is(0, conv->getPaddingL()[0], conv->getPaddingL()[1], conv->getPaddingR()[0], conv->getPaddingR()[1]);
+    };
+
+    if (!impl::cpu::x64::mayiuse(impl::cpu::x64::avx2))
+        return;
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto parentConvNode = graphNodes[i];
+        if (!isSuitableParentConvolution(parentConvNode)) continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseDWConvolutionAndPWConvolution_ParentConv);
+
+        auto childConvNode = parentConvNode->getChildEdgeAt(0)->getChild();
+        if (!isSuitableChildConvolution(childConvNode)) continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseDWConvolutionAndPWConvolution_ChildConv);
+
+        parentConvNode->addFusedNode(childConvNode);
+
+        for (auto& node : childConvNode->getFusedWith()) {
+            parentConvNode->addFusedNode(node);
+        }
+        childConvNode->clearFusedWith();
+
+        graph.DropDWConvNode(childConvNode);
+    }
+}
+
 // TODO [NM]: unite with FuseConvolutionAndSimpleOperation
 void GraphOptimizer::FuseConvolutionAndSimpleOperationThroughMaxPool(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
@@ -1726,6 +1928,84 @@ void GraphOptimizer::FuseMVNAndSimpleOperation(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseColorConvertAndInterpolate(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](const NodePtr& node) {
+        return node->getType() == Type::ColorConvert && !node->isDropped() && node->getChildEdges().size() == 1 &&
+               node->getChildEdgeAt(0)->getOutputNum() == 0;
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto parentNode = graphNodes[i];
+        if (!isSuitableParentNode(parentNode)) continue;
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (childNode->getType() != Type::Interpolate) continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseColorConvertAndInterpolate);
+
+        const auto colorConvert = std::dynamic_pointer_cast<ColorConvert>(parentNode);
+        if (colorConvert == nullptr)
+            IE_THROW() << "Cannot cast to color convert node " << parentNode->getName();
+        const auto interpolate = std::dynamic_pointer_cast<Interpolate>(childNode);
+        if (interpolate == nullptr)
+            IE_THROW() << "Cannot cast to interpolate node " << childNode->getName();
+        if (!colorConvert->canFuseResize(childNode)) continue;
+
+        colorConvert->fuseResize(interpolate->getCoordTransMode());
+        colorConvert->addOriginalLayer(childNode->getOriginalLayers());
+        // the converted image has the resized shape now
+        parentNode->outputShapes[0] = childNode->getOutputShapeAtPort(0);
+
+        auto parentEdges = childNode->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge->getParent() != parentNode)
+                graph.RemoveEdge(p_edge);
+        }
+        graph.DropNode(childNode);
+    }
+}
+
+void GraphOptimizer::FuseColorConvertAndSimpleOperation(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableParentNode = [](const NodePtr& node) {
+        return node->getType() == Type::ColorConvert && node->getChildEdges().size() == 1;
+    };
+
+    auto parent = graphNodes.begin();
+    while (parent != graphNodes.end()) {
+        auto parentNode = *parent;
+        if (!isSuitableParentNode(parentNode)) {
+            parent++;
+            continue;
+        }
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseColorConvertAndSimpleOperation_ParentNode);
+
+        auto childNode = parentNode->getChildEdgeAt(0)->getChild();
+        if (!parentNode->canFuse(childNode)) {
+            parent++;
+            continue;
+        }
+
+        childNode->fuseInto(parentNode);
+
+        auto parentEdges = childNode->parentEdges;
+        for (auto &parentEdge : parentEdges) {
+            auto p_edge = parentEdge.lock();
+            if (p_edge->getParent() == parentNode)
+                continue;
+
+            graph.RemoveEdge(p_edge);
+        }
+
+        graph.DropNode(childNode);
+    }
+}
+
 void GraphOptimizer::FuseInterpolateAndSimpleOperation(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -1785,6 +2065,71 @@ void GraphOptimizer::FuseInterpolateAndSimpleOperation(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseInterpolateAndSum(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    for (auto &graphNode : graphNodes) {
+        const auto sum = std::dynamic_pointer_cast<Eltwise>(graphNode);
+        if (!sum || sum->getAlgorithm() != Algorithm::EltwiseAdd || sum->getParentEdges().size() != 2 ||
+            sum->isWithBroadcast() || !sum->getFusedWith().empty() || sum->isDynamicNode() ||
+            sum->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+
+        std::shared_ptr<Interpolate> interpolate;
+        size_t peerPort = 0;
+        for (size_t port = 0; port < 2 && !interpolate; port++) {
+            auto parent = std::dynamic_pointer_cast<Interpolate>(sum->getParentEdgesAtPort(port)[0]->getParent());
+            if (parent && !parent->isConstant() && parent->getChildEdges().size() == 1 && parent->canFuseSum()) {
+                interpolate = parent;
+                peerPort = 1 - port;
+            }
+        }
+        if (!interpolate || sum->getOriginalInputPrecisionAtPort(peerPort) != Precision::FP32)
+            continue;
+
+        auto peerEdge = sum->getParentEdgesAtPort(peerPort)[0];
+        auto peerNode = peerEdge->getParent();
+        bool fuseAllowed = peerNode != interpolate;
+        for (size_t i = 0; fuseAllowed && i < interpolate->getParentEdges().size(); i++) {
+            if (interpolate->getParentEdgeAt(i)->getParent() == peerNode)
+                fuseAllowed = false;
+        }
+        if (!fuseAllowed)
+            continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseInterpolateAndSum);
+
+        // the second term of the sum becomes the last input of the Interpolate
+        const size_t sumPort = interpolate->getParentEdges().size();
+        interpolate->inputShapes.push_back(sum->getInputShapeAtPort(peerPort));
+        interpolate->fuseSum(sumPort);
+        interpolate->addOriginalLayer(sum->getOriginalLayers());
+
+        const int peerOutPort = peerEdge->getInputNum();
+        peerEdge->drop();
+        EdgePtr edgePtr(new Edge(peerNode, interpolate, peerOutPort, sumPort));
+        graph.GetEdges().push_back(edgePtr);
+        interpolate->addEdge(edgePtr);
+
+        std::vector<EdgeWeakPtr> edgesToReconnect = sum->getChildEdges();
+        for (auto &edgeWeak : edgesToReconnect) {
+            auto edge = edgeWeak.lock();
+            auto child = edge->getChild();
+            const int idxParent = edge->getInputNum();
+            const int idxChild = edge->getOutputNum();
+            IE_ASSERT(idxParent == 0);
+
+            edge->drop();
+
+            EdgePtr newEdge(new Edge(interpolate, child, idxParent, idxChild));
+            graph.GetEdges().push_back(newEdge);
+            child->addEdge(newEdge);
+        }
+
+        sum->remove();
+    }
+}
+
 void GraphOptimizer::FuseNormalizeL2AndSimpleOperation(Graph &graph) {
     auto& graphNodes = graph.GetNodes();
 
@@ -2001,6 +2346,42 @@ void GraphOptimizer::FuseEltwiseAndSimple(Graph &graph) {
     }
 }
 
+void GraphOptimizer::FuseSoftmaxAndTopK(Graph &graph) {
+    auto& graphNodes = graph.GetNodes();
+
+    auto isSuitableSoftmax = [](const NodePtr &node) {
+        return node->getType() == Type::Softmax && !node->isDropped() && node->getFusedWith().empty() &&
+               node->getChildEdges().size() == 1 && node->getChildEdgeAt(0)->getOutputNum() == 0 &&
+               everyone_is(Precision::FP32, node->getOriginalInputPrecisionAtPort(0), node->getOriginalOutputPrecisionAtPort(0));
+    };
+
+    for (size_t i = 0; i < graphNodes.size(); i++) {
+        auto softmaxNode = graphNodes[i];
+        if (!isSuitableSoftmax(softmaxNode)) continue;
+
+        auto childNode = softmaxNode->getChildEdgeAt(0)->getChild();
+        if (childNode->getType() != Type::TopK) continue;
+
+        CPU_GRAPH_OPTIMIZER_SCOPE(FuseSoftmaxAndTopK);
+
+        const auto softmax = std::dynamic_pointer_cast<SoftMax>(softmaxNode);
+        if (softmax == nullptr)
+            IE_THROW() << "Cannot cast to softmax node " << softmaxNode->getName();
+        const auto topK = std::dynamic_pointer_cast<TopK>(childNode);
+        if (topK == nullptr)
+            IE_THROW() << "Cannot cast to topk node " << childNode->getName();
+
+        // only the largest values of the softmax are the largest logits
+        if (!topK->isModeMax() || static_cast<size_t>(topK->getAxis()) != softmax->getAxis() ||
+            topK->getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+            continue;
+
+        topK->fuseInputSoftmax();
+        topK->addOriginalLayer(softmaxNode->getOriginalLayers());
+        graph.DropNode(softmaxNode);
+    }
+}
+
 void GraphOptimizer::DropDoubleReorders(Graph &graph) {
     std::set<NodePtr> processed;
     std::size_t graphNodesSize = graph.GetNodes().size();
@@ -2597,5 +2978,117 @@ void GraphOptimizer::RemoveSameConvert(Graph& graph) {
     }
 }
 
+void GraphOptimizer::MinimizeReorders(Graph &graph) {
+    // The primitive descriptors are selected node by node looking at the parents only, so a node may pick a layout
+    // which is good for its inputs but requires reorders on all its outputs. Here the choice among the descriptors
+    // of the same implementation type is revised to minimize the total size of the tensors to be reordered.
+    auto& graphNodes = graph.GetNodes();
+
+    // the size of the tensors is unknown for the dynamic edges, so all of them are treated as a mid-size tensor
+    constexpr size_t dynamicEdgeCost = 1024 * 1024;
+    constexpr size_t maxSweeps = 4;
+
+    auto isInPlaceDesc = [](const NodeDesc& pd) {
+        const auto& config = pd.getConfig();
+        return std::any_of(config.inConfs.begin(), config.inConfs.end(), [](const PortConfig& conf) { return conf.inPlace() >= 0; }) ||
+               std::any_of(config.outConfs.begin(), config.outConfs.end(), [](const PortConfig& conf) { return conf.inPlace() >= 0; });
+    };
+
+    auto isSuitableNode = [&](const NodePtr& node) {
+        // Concat and Split choose the descriptors by the in-place possibility which is not modeled by the cost
+        if (one_of(node->getType(), Type::Input, Type::Output, Type::Concatenation, Type::Split))
+            return false;
+        const auto selectedPD = node->getSelectedPrimitiveDescriptor();
+        return node->getSupportedPrimitiveDescriptors().size() > 1 && selectedPD && !isInPlaceDesc(*selectedPD);
+    };
+
+    // a reorder is needed on the edge if the descriptors are not compatible, the constant edges are reordered once
+    // at the compilation stage so they are free
+    auto edgeCost = [&](const EdgePtr& edge, const NodeDesc* parentPD, const NodeDesc* childPD) -> size_t {
+        if (!parentPD || !childPD || edge->getParent()->isConstant())
+            return 0;
+        const auto& outConfs = parentPD->getConfig().outConfs;
+        const auto& inConfs = childPD->getConfig().inConfs;
+        const int inNum = edge->getInputNum();
+        const int outNum = edge->getOutputNum();
+        if (inNum < 0 || static_cast<size_t>(inNum) >= outConfs.size() || outNum < 0 || static_cast<size_t>(outNum) >= inConfs.size())
+            return 0;
+
+        const auto& parentDesc = outConfs[inNum].getMemDesc();
+        const auto& childDesc = inConfs[outNum].getMemDesc();
+        if (childDesc->isCompatible(*parentDesc))
+            return 0;
+        const auto& shape = childDesc->getShape();
+        return shape.isStatic() ? std::max<size_t>(shape.getElementsCount(), 1) * childDesc->getPrecision().size() : dynamicEdgeCost;
+    };
+
+    auto nodeCost = [&](const NodePtr& node, const NodeDesc* pd) {
+        size_t cost = 0;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto edge = node->getParentEdgeAt(i);
+            cost += edgeCost(edge, edge->getParent()->getSelectedPrimitiveDescriptor(), pd);
+        }
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            const auto edge = node->getChildEdgeAt(i);
+            cost += edgeCost(edge, pd, edge->getChild()->getSelectedPrimitiveDescriptor());
+        }
+        return cost;
+    };
+
+    auto countReorders = [&]() {
+        size_t count = 0;
+        for (const auto& edge : graph.GetEdges()) {
+            if (edgeCost(edge, edge->getParent()->getSelectedPrimitiveDescriptor(), edge->getChild()->getSelectedPrimitiveDescriptor()) > 0)
+                count++;
+        }
+        return count;
+    };
+
+    const size_t reordersBefore = countReorders();
+    if (reordersBefore == 0)
+        return;
+
+    // every change strictly decreases the total cost, so the sweeps converge
+    for (size_t sweep = 0; sweep < maxSweeps; sweep++) {
+        bool changed = false;
+        for (const auto& node : graphNodes) {
+            if (!isSuitableNode(node))
+                continue;
+
+            const auto& supportedPDs = node->getSupportedPrimitiveDescriptors();
+            const auto selectedPD = node->getSelectedPrimitiveDescriptor();
+            const auto implType = selectedPD->getImplementationType();
+            size_t bestCost = nodeCost(node, selectedPD);
+            if (bestCost == 0)
+                continue;
+
+            int bestIdx = -1;
+            for (size_t i = 0; i < supportedPDs.size(); i++) {
+                const auto& candidate = supportedPDs[i];
+                // the implementation priority is kept, only the layouts are revised
+                if (&candidate == selectedPD || candidate.getImplementationType() != implType || isInPlaceDesc(candidate))
+                    continue;
+                const size_t cost = nodeCost(node, &candidate);
+                if (cost < bestCost) {
+                    bestCost = cost;
+                    bestIdx = static_cast<int>(i);
+                }
+            }
+
+            if (bestIdx >= 0) {
+                DEBUG_LOG("GraphOptimizer##MinimizeReorders: Node ##", node->getName(), " primitive descriptor is changed to ",
+                          bestIdx, ", reorders cost ", nodeCost(node, selectedPD), " -> ", bestCost);
+                node->selectPrimitiveDescriptorByIndex(bestIdx);
+                changed = true;
+            }
+        }
+        if (!changed)
+            break;
+    }
+
+    DEBUG_LOG("GraphOptimizer##MinimizeReorders: reorders ", reordersBefore, " -> ", countReorders(),
+              " (", graph.GetName(), ")");
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -18,6 +18,8 @@ public:
 public:
     void ApplyCommonGraphOptimizations(Graph& graph);
     void ApplyImplSpecificGraphOptimizations(Graph& graph);
+    // Is applied after the primitive descriptors selection, before the edges (and the reorders) are created
+    void ApplyLayoutOptimizations(Graph& graph);
 
 private:
     void FuseConvMatmulFCDeconvAndDQScales(Graph &graph);
@@ -28,15 +30,20 @@ private:
     void MergeConvertAndScaleShift(Graph& graph);
     void FuseFCAndConvertOnWeights(Graph& graph);
     void FuseFCAndTransposeOnWeights(Graph& graph);
+    void FuseMatMulAndTransposeOnInputs(Graph& graph);
     void FuseFullyConnectedAndSimpleOperation(Graph &graph);
     void FuseMatMulAndSimpleOperation(Graph &graph);
     void FuseConvolutionAndSimpleOperationThroughMaxPool(Graph &graph);
     void FuseConvolutionAndSimpleOperation(Graph &graph);
     void FuseConvolutionAndDWConvolution(Graph &graph);
+    void FuseDWConvolutionAndPWConvolution(Graph &graph);
     void FusePoolingAndFakeQuantize(Graph &graph);
     void FuseConvolutionSumAndConvolutionSumActivation(Graph &graph);
     void FuseMVNAndSimpleOperation(Graph &graph);
+    void FuseColorConvertAndInterpolate(Graph &graph);
+    void FuseColorConvertAndSimpleOperation(Graph &graph);
     void FuseInterpolateAndSimpleOperation(Graph &graph);
+    void FuseInterpolateAndSum(Graph &graph);
     void FuseNormalizeL2AndSimpleOperation(Graph &graph);
     void FuseReduceAndSimpleOperation(Graph &graph);
 
@@ -44,11 +51,13 @@ private:
     void FuseConvolutionAndZeroPoints(Graph &graph);
     void FuseBroadcastAndEltwise(Graph &graph);
     void FuseEltwiseAndSimple(Graph &graph);
+    void FuseSoftmaxAndTopK(Graph &graph);
     void FusePerformedAsScaleShiftAndFakeQuantize(Graph &graph);
     void FuseClampAndFakeQuantize(Graph &graph);
     void MergeTransposeAndReorder(Graph &graph);
     void reshapeRnnSeq(Graph &graph);
     void RemoveSameConvert(Graph &graph);
+    void MinimizeReorders(Graph &graph);
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,71 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "hybrid_cores_arena.h"
+
+#include "node.h"
+
+#include <openvino/runtime/system_conf.hpp>
+#include <openvino/runtime/threading/cpu_streams_info.hpp>
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO) && (TBB_INTERFACE_VERSION >= 12020)
+#    include <tbb/info.h>
+#    define CPU_HYBRID_CORES_ARENA_SUPPORTED 1
+#else
+#    define CPU_HYBRID_CORES_ARENA_SUPPORTED 0
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+#if CPU_HYBRID_CORES_ARENA_SUPPORTED
+PCoresArena::PCoresArena(int coreType, int threadsNum)
+    : arena(tbb::task_arena::constraints{}.set_core_type(coreType).set_max_concurrency(threadsNum)),
+      concurrency(threadsNum) {}
+#endif
+
+PCoresArena::Ptr PCoresArena::create(const std::vector<std::vector<int>>& streamsInfoTable, int streamsNum) {
+#if CPU_HYBRID_CORES_ARENA_SUPPORTED
+    // a mixed stream is described by the ALL_PROC row followed by the rows of its parts on each core type
+    if (streamsNum != 1 || streamsInfoTable.size() < 2 || streamsInfoTable[0][PROC_TYPE] != ALL_PROC)
+        return nullptr;
+
+    int pCoresThreads = 0;
+    int eCoresThreads = 0;
+    for (size_t i = 1; i < streamsInfoTable.size() && streamsInfoTable[i][NUMBER_OF_STREAMS] == 0; i++) {
+        const auto& row = streamsInfoTable[i];
+        if (row[PROC_TYPE] == EFFICIENT_CORE_PROC)
+            eCoresThreads += row[THREADS_PER_STREAM];
+        else if (row[PROC_TYPE] == MAIN_CORE_PROC || row[PROC_TYPE] == HYPER_THREADING_PROC)
+            pCoresThreads += row[THREADS_PER_STREAM];
+    }
+    if (pCoresThreads == 0 || eCoresThreads == 0)
+        return nullptr;
+
+    // the core types are sorted from the least to the most performant
+    const auto coreTypes = tbb::info::core_types();
+    if (coreTypes.size() < 2)
+        return nullptr;
+
+    return std::make_shared<PCoresArena>(coreTypes.back(), pCoresThreads);
+#else
+    return nullptr;
+#endif
+}
+
+bool PCoresArena::isComputeBound(const Node& node) {
+    return one_of(node.getType(), Type::Convolution, Type::Deconvolution, Type::FullyConnected, Type::MatMul,
+                  Type::MHA);
+}
+
+void PCoresArena::execute(const std::function<void()>& f) {
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    arena.execute(f);
+#else
+    f();
+#endif
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
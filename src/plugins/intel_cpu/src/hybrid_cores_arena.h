@@ -0,0 +1,61 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_parallel.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+#    include <tbb/task_arena.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+class Node;
+
+/**
+ * @brief Executes the compute bound nodes of a stream spanning both the Performance and the Efficient cores on the
+ * Performance cores only. The work of a node is split evenly between the threads, so the slower Efficient cores
+ * stretch the critical path of the heavy nodes, while the memory bound nodes (e.g. Eltwise, Reorder) still benefit
+ * from all the cores of the stream.
+ */
+class PCoresArena {
+public:
+    typedef std::shared_ptr<PCoresArena> Ptr;
+
+    /**
+     * @brief Creates the arena for the stream described by the streams info table
+     * @return nullptr if the stream does not span different core types or the core types are not detected by TBB
+     */
+    static Ptr create(const std::vector<std::vector<int>>& streamsInfoTable, int streamsNum);
+
+    /**
+     * @brief Checks whether the node is executed on the Performance cores
+     */
+    static bool isComputeBound(const Node& node);
+
+    void execute(const std::function<void()>& f);
+
+    int getConcurrency() const {
+        return concurrency;
+    }
+
+#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO)
+    PCoresArena(int coreType, int threadsNum);
+
+private:
+    tbb::task_arena arena;
+#endif
+
+private:
+    int concurrency = 0;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -4,6 +4,7 @@
 
 #include "infer_request.h"
 #include "dnnl_extension_utils.h"
+#include <algorithm>
 #include <vector>
 #include <string>
 #include <map>
@@ -11,6 +12,7 @@
 #include "nodes/concat.h"
 #include "nodes/split.h"
 #include <ie_compound_blob.h>
+#include <ie_parallel.hpp>
 #include <ie_common.h>
 #include "exec_network.h"
 #include "itt.h"
@@ -32,6 +34,18 @@
 namespace ov {
 namespace intel_cpu {
 
+namespace {
+std::string getStateName(const node::MemoryInput& memoryNode) {
+    auto state_name = memoryNode.getId();
+
+    // Remove suffix with pair ID. Internal information.
+    auto suffix_idx = state_name.find("/id=");
+    if (suffix_idx != std::string::npos)
+        state_name = state_name.substr(0, suffix_idx);
+    return state_name;
+}
+}  // namespace
+
 void InferRequestBase::CreateInferRequest() {
     auto id = (execNetwork->_numRequests)++;
     profilingTask = openvino::itt::handle("INTEL_CPU_INFER_" + execNetwork->_name + "_" + std::to_string(id));
@@ -42,24 +56,17 @@ void InferRequestBase::CreateInferRequest() {
 
     initBlobs();
 
-    // Save all MemoryLayer data tensors. Will use insight about mechanics
-    // of MemoryLayer implementation. It uses output edge of MemoryLayer
-    // producer as storage for tensor to keep it between infer calls.
+    // Create the states of the MemoryLayers. The states are bound to the graph memory nodes on each inference,
+    // so the graph reads and updates the state buffers of the request directly.
     for (auto& node : graph->GetNodes()) {
         if (node->getType() == Type::MemoryInput) {
             auto memoryNode = dynamic_cast<node::MemoryInput*>(node.get());
             if (!memoryNode) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
-            auto state_store = memoryNode->getStore();
-            auto state_name = memoryNode->getId();
-
-            // Remove suffix with pair ID. Internal information.
-            auto suffix_idx = state_name.find("/id=");
-            if (suffix_idx != std::string::npos)
-                state_name = state_name.substr(0, suffix_idx);
-
-            memoryStates.emplace_back(new VariableState(state_name, state_store));
+            memoryStates.emplace_back(memoryNode->makeState(getStateName(*memoryNode),
+                                                           execNetwork->_cfg.maxStateReservedLength,
+                                                           execNetwork->_cfg.bindStateTensors));
         }
     }
 }
@@ -102,37 +109,10 @@ void InferRequestBase::PushStates() {
             if (!cur_node) {
                 IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
             }
-            auto cur_id = cur_node->getId();
+            const auto cur_name = getStateName(*cur_node);
             for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(cur_state_mem_buf, data_ptr, data_size);
-                }
-            }
-        }
-    }
-}
-
-void InferRequestBase::PullStates() {
-    for (auto &node : graph->GetNodes()) {
-        if (node->getType() == Type::MemoryInput) {
-            auto cur_node = dynamic_cast<node::MemoryInput*>(node.get());
-            if (!cur_node) {
-                IE_THROW() << "Cannot cast " << node->getName() << " to MemoryInput";
-            }
-            auto cur_id = cur_node->getId();
-            for (const auto& state : memoryStates) {
-                if (state->GetName() == cur_id) {
-                    auto cur_state_mem = cur_node->getStore();
-                    auto data_ptr = state->GetState()->cbuffer().as<void*>();
-                    auto data_size = state->GetState()->byteSize();
-                    auto cur_state_mem_buf = static_cast<uint8_t*>(cur_state_mem->getData());
-
-                    cpu_memcpy(data_ptr, cur_state_mem_buf, data_size);
+                if (state->GetName() == cur_name) {
+                    cur_node->assignState(std::static_pointer_cast<VariableState>(state));
                 }
             }
         }
@@ -159,6 +139,8 @@ void InferRequestBase::InferImpl() {
     graph = &(graphLock._graph);
 
     ThrowIfCanceled();
+    if (auto execTimeline = graph->getGraphContext()->getExecTimeline())
+        execTimeline->nextInference();
     convertBatchedInputBlobs();
 
     if (graph->hasDynamicInput()) {
@@ -167,6 +149,11 @@ void InferRequestBase::InferImpl() {
 
     execDataPreprocessing(_inputs);
 
+    if (!graphLock._graph._batchSlices.empty()) {
+        inferBatchSlices(graphLock._graph._batchSlices, *graphLock._graph._batchSplitter);
+        return;
+    }
+
     changeDefaultPtr();
 
     ThrowIfCanceled();
@@ -179,10 +166,6 @@ void InferRequestBase::InferImpl() {
 
     graph->Infer(this);
 
-    if (memoryStates.size() != 0) {
-        PullStates();
-    }
-
     ThrowIfCanceled();
 
     // update output control blocks, if any, in order to refresh internal buffers
@@ -195,6 +178,74 @@ void InferRequestBase::InferImpl() {
     graph->PullOutputData(_outputs);
 }
 
+void InferRequestBase::inferBatchSlices(std::deque<Graph>& slices, BatchSplitter& splitter) {
+    const size_t slicesNum = splitter.getSlicesNum();
+    auto denseBlob = [](const InferenceEngine::Blob::Ptr& blob, InferenceEngine::Precision precision) {
+        const auto& dims = blob->getTensorDesc().getDims();
+        auto dense = make_blob_with_precision(
+            InferenceEngine::TensorDesc(precision, dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size())));
+        dense->allocate();
+        return dense;
+    };
+    // the data is copied between the dense and the user blob of a different layout (e.g. ROI)
+    auto load = [this](const InferenceEngine::Blob::Ptr& dst, const InferenceEngine::Blob::Ptr& src) {
+        Memory srcMem(graph->getEngine(), MemoryDescUtils::convertToDnnlBlockedMemoryDesc(src->getTensorDesc()),
+                      src->cbuffer().as<const void*>(), false);
+        Memory dstMem(graph->getEngine(), MemoryDescUtils::convertToDnnlBlockedMemoryDesc(dst->getTensorDesc()),
+                      dst->buffer().as<void*>(), false);
+        dstMem.load(srcMem, false);
+    };
+
+    // the slices refer to the request blobs directly, so each slice graph reads and writes its part of the batch
+    std::vector<InferenceEngine::BlobMap> inputs(slicesNum);
+    for (const auto& input : _inputs) {
+        auto blob = input.second;
+        const auto inPrec = normToInputSupportedPrec(input);
+        if (inPrec != blob->getTensorDesc().getPrecision()) {
+            auto converted = denseBlob(blob, inPrec);
+            cpu_convert(blob->cbuffer().as<const void*>(), converted->buffer().as<void*>(),
+                        blob->getTensorDesc().getPrecision(), inPrec, blob->size());
+            blob = converted;
+        } else if (!BatchSplitter::isSliceable(blob)) {
+            auto dense = denseBlob(blob, inPrec);
+            load(dense, blob);
+            blob = dense;
+        }
+        for (size_t slice = 0; slice < slicesNum; slice++)
+            inputs[slice][input.first] = BatchSplitter::getSlice(blob, slice, slicesNum);
+    }
+
+    std::vector<InferenceEngine::BlobMap> outputs(slicesNum);
+    std::vector<std::pair<InferenceEngine::Blob::Ptr, InferenceEngine::Blob::Ptr>> denseOutputs;
+    for (const auto& output : _outputs) {
+        auto blob = output.second;
+        if (!BatchSplitter::isSliceable(blob)) {
+            auto dense = denseBlob(blob, blob->getTensorDesc().getPrecision());
+            denseOutputs.emplace_back(output.second, dense);
+            blob = dense;
+        }
+        for (size_t slice = 0; slice < slicesNum; slice++)
+            outputs[slice][output.first] = BatchSplitter::getSlice(blob, slice, slicesNum);
+    }
+
+    ThrowIfCanceled();
+
+    splitter.execute([&](size_t slice) {
+        auto& sliceGraph = slice == 0 ? *graph : slices[slice - 1];
+        if (slice != 0) {
+            if (auto execTimeline = sliceGraph.getGraphContext()->getExecTimeline())
+                execTimeline->nextInference();
+        }
+        for (const auto& input : inputs[slice])
+            sliceGraph.PushInputData(input.first, input.second);
+        sliceGraph.Infer(this);
+        sliceGraph.PullOutputData(outputs[slice]);
+    });
+
+    for (const auto& output : denseOutputs)
+        load(output.first, output.second);
+}
+
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestBase::GetPerformanceCounts() const {
     if (!graph || !graph->IsReady())
         IE_THROW() << "Graph is not ready!";
@@ -343,6 +394,9 @@ void InferRequestBase::changeDefaultPtr() {
                 outputMemMngr->setMemMngr(memMngr);
                 DEBUG_LOG("reset proxy ", outputMemMngr, ", actual ", controlBlock.currentMemMngr(), " graph ", graph, " inferrequest ", this);
                 DEBUG_LOG(name, ", blob ", controlBlock.blob(), ", tensor ", controlBlock.tensor());
+            } else if (auto userMemMngr = bindUserOutputMemory(name, inputPtrs)) {
+                outputMemMngr->setMemMngr(userMemMngr); // the graph writes directly to the user blob buffer
+                DEBUG_LOG("reset proxy ", outputMemMngr, ", user memory ", userMemMngr, " graph ", graph, " inferrequest ", this);
             } else {
                 outputMemMngr->reset(); // switch to the internal memory since memory sharing is no longer possible
             }
@@ -350,6 +404,43 @@ void InferRequestBase::changeDefaultPtr() {
     }
 }
 
+std::shared_ptr<IMemoryMngr> InferRequestBase::bindUserOutputMemory(const std::string& name,
+                                                                   const std::unordered_set<const void*>& inputPtrs) {
+    auto blobItr = _outputs.find(name);
+    if (blobItr == _outputs.end() || !blobItr->second) {
+        userOutputBindings.erase(name);
+        return nullptr;
+    }
+    const auto& blob = blobItr->second;
+    const auto& blobDesc = blob->getTensorDesc();
+    const auto& graphDesc = graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
+
+    // only a planar user blob of the same precision can be written by the graph directly
+    const auto& order = blobDesc.getBlockingDesc().getOrder();
+    const bool isPlanar = blobDesc.getLayout() != InferenceEngine::Layout::ANY &&
+        order.size() == blobDesc.getDims().size() && std::is_sorted(order.begin(), order.end());
+    void* ptr = blob->byteSize() ? static_cast<void*>(blob->buffer()) : nullptr;
+    if (!ptr || !isPlanar || blobDesc.getPrecision() != graphDesc.getPrecision() || inputPtrs.count(ptr)) {
+        userOutputBindings.erase(name);
+        return nullptr;
+    }
+
+    auto& binding = userOutputBindings[name];
+    // the blob can be reallocated by PullOutputData (e.g. by the user tensor allocator), so the binding is refreshed.
+    // The blobs keep their allocation when the shape shrinks, so the capacity of the same buffer is the largest size
+    // it has had, and a short output doesn't limit the following ones
+    const size_t size = blob->byteSize();
+    const bool sameBuffer = binding.memMngr && binding.blob.lock() == blob && binding.ptr == ptr;
+    if (!sameBuffer || binding.capacity < size || !binding.memMngr->hasExtBuffer()) {
+        binding.capacity = sameBuffer ? std::max(binding.capacity, size) : size;
+        binding.blob = blob;
+        binding.ptr = ptr;
+        binding.memMngr = std::make_shared<MemoryMngrWithReuse>();
+        binding.memMngr->setExtBuff(ptr, binding.capacity);
+    }
+    return binding.memMngr;
+}
+
 std::vector<InferenceEngine::IVariableStateInternal::Ptr> InferRequestBase::QueryState() {
     return memoryStates;
 }
@@ -768,7 +859,13 @@ void InferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob:
         }
 
         const auto &desc = graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
-        if (!isDynamic && blobDesc == MemoryDescUtils::convertToTensorDesc(desc)) {
+        const auto graphBlobDesc = MemoryDescUtils::convertToTensorDesc(desc);
+        // the layout enum may differ (e.g. BLOCKED vs NCHW) while the memory layout is the same
+        const bool isSameMemoryLayout = blobDesc == graphBlobDesc ||
+            (blobDesc.getPrecision() == graphBlobDesc.getPrecision() &&
+             blobDesc.getLayout() != InferenceEngine::Layout::ANY &&
+             blobDesc.getBlockingDesc() == graphBlobDesc.getBlockingDesc());
+        if (!isDynamic && isSameMemoryLayout) {
             externalPtr[name] = data;
         } else if (externalPtr.find(name) != externalPtr.end()) {
             externalPtr.erase(name);
@@ -782,6 +879,61 @@ void InferRequest::SetBlobsImpl(const std::string& name, const InferenceEngine::
     _batched_inputs[name] = batched_blob;
 }
 
+void InferRequest::convertBatchedInputBlob(const std::string& name, const InferenceEngine::BatchedBlob::Ptr& batched_blob) {
+    const size_t batch = batched_blob->size();
+    std::vector<const uint8_t*> itemPtrs(batch);
+    for (size_t i = 0; i < batch; i++) {
+        const auto item = InferenceEngine::as<InferenceEngine::MemoryBlob>(batched_blob->getBlob(i));
+        const auto& itemDesc = item ? item->getTensorDesc().getBlockingDesc() : InferenceEngine::BlockingDesc{};
+        const auto& offsets = itemDesc.getOffsetPaddingToData();
+        if (!item || std::any_of(offsets.begin(), offsets.end(), [](size_t offset) { return offset != 0; })) {
+            // the ROI items are combined (or rejected) by the default implementation
+            IInferRequestInternal::convertBatchedInputBlob(name, batched_blob);
+            return;
+        }
+        itemPtrs[i] = item->cbuffer().as<const uint8_t*>() + itemDesc.getOffsetPadding() * item->element_size();
+    }
+
+    const auto& itemTensorDesc = batched_blob->getBlob(0)->getTensorDesc();
+    const size_t itemSize = batched_blob->getBlob(0)->byteSize();
+    auto dims = itemTensorDesc.getDims();
+    dims[0] = batch;
+    auto blockedDims = itemTensorDesc.getBlockingDesc().getBlockDims();
+    blockedDims[0] = batch;
+    const InferenceEngine::TensorDesc batchedDesc(itemTensorDesc.getPrecision(), dims,
+                                                  {blockedDims, itemTensorDesc.getBlockingDesc().getOrder()});
+    const auto& batchedStrides = batchedDesc.getBlockingDesc().getStrides();
+    for (size_t i = 0; i < batch; i++) {
+        const auto& itemStrides = batched_blob->getBlob(i)->getTensorDesc().getBlockingDesc().getStrides();
+        if (!std::equal(itemStrides.begin() + 1, itemStrides.end(), batchedStrides.begin() + 1)) {
+            IInferRequestInternal::convertBatchedInputBlob(name, batched_blob);
+            return;
+        }
+    }
+
+    // the items are the consecutive parts of one buffer, e.g. the batch ROIs of one tensor, so they are used in place
+    bool isContiguous = true;
+    for (size_t i = 1; i < batch && isContiguous; i++)
+        isContiguous = itemPtrs[i] == itemPtrs[0] + i * itemSize;
+    if (isContiguous) {
+        SetBlob(name, make_blob_with_precision(batchedDesc, const_cast<uint8_t*>(itemPtrs[0])));
+        return;
+    }
+
+    // otherwise they are gathered into the blob allocated once and reused while the shape is the same,
+    // instead of the new blob on each inference
+    auto& batchedBlob = batchedInputBlobs[name];
+    if (!batchedBlob || batchedBlob->getTensorDesc() != batchedDesc) {
+        batchedBlob = InferenceEngine::as<InferenceEngine::MemoryBlob>(make_blob_with_precision(batchedDesc));
+        batchedBlob->allocate();
+    }
+    auto dst = batchedBlob->wmap().as<uint8_t*>();
+    parallel_for(batch, [&](size_t i) {
+        cpu_memcpy(dst + i * itemSize, itemPtrs[i], itemSize);
+    });
+    SetBlob(name, batchedBlob);
+}
+
 InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "GetBlob");
 
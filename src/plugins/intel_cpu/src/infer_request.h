@@ -5,9 +5,12 @@
 #pragma once
 
 #include "graph.h"
+#include "batch_splitter.h"
+#include <deque>
 #include <memory>
 #include <string>
 #include <map>
+#include <unordered_set>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include "cpu_tensor.h"
 
@@ -113,10 +116,21 @@ protected:
 
     std::unordered_map<std::string, OutputControlBlock> outputControlBlocks;
 
+    // binding of the user output blob buffer as the storage of a dynamic output, the memory manager falls back
+    // to the internal allocation if the produced output doesn't fit the user buffer
+    struct UserOutputBinding {
+        std::weak_ptr<InferenceEngine::Blob> blob;
+        void* ptr = nullptr;
+        size_t capacity = 0;  // the allocated size of the user buffer, not the size of the current output
+        std::shared_ptr<MemoryMngrWithReuse> memMngr = nullptr;
+    };
+    std::unordered_map<std::string, UserOutputBinding> userOutputBindings;
+
 private:
     void PushStates();
-    void PullStates();
     void redefineMemoryForInputNodes();
+    void inferBatchSlices(std::deque<Graph>& slices, BatchSplitter& splitter);
+    std::shared_ptr<IMemoryMngr> bindUserOutputMemory(const std::string& name, const std::unordered_set<const void*>& inputPtrs);
 
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
@@ -157,8 +171,11 @@ public:
 private:
     void PushInputData() override;
     void initBlobs() override;
+    void convertBatchedInputBlob(const std::string& name, const InferenceEngine::BatchedBlob::Ptr& batched_blob) override;
 
     std::unordered_map<std::string, std::shared_ptr<const ov::Node>> modelInputsMap;
+    // the blobs the items set by set_tensors are gathered into, kept between the inferences
+    std::unordered_map<std::string, InferenceEngine::MemoryBlob::Ptr> batchedInputBlobs;
     std::unordered_map<std::string, std::shared_ptr<const ov::Node>> modelOutputsMap;
 };
 
@@ -5,6 +5,7 @@
 #include "cpu_blocked_memory_desc.h"
 #include <cpu_memory.h>
 #include "dnnl_blocked_memory_desc.h"
+#include "utils/general_utils.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -124,7 +125,13 @@ size_t CpuBlockedMemoryDesc::getCurrentMemSizeImp() const {
             e_size += (getBlockDims()[j] - 1) * getStrides()[j];
     }
 
-    e_size *= getPrecision() == InferenceEngine::Precision::BIN ? 1 : getPrecision().size();
+    const auto& prc = getPrecision();
+    if (one_of(prc, InferenceEngine::Precision::U4, InferenceEngine::Precision::I4)) {
+        // two elements are packed per byte
+        e_size = div_up(e_size, 2);
+    } else {
+        e_size *= prc == InferenceEngine::Precision::BIN ? 1 : prc.size();
+    }
 
     return e_size;
 }
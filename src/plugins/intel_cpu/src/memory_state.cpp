@@ -3,18 +3,151 @@
 //
 
 #include "memory_state.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <numeric>
+
 #include "dnnl_extension_utils.h"
 #include "blob_factory.hpp"
+#include "nodes/common/cpu_convert.h"
+#include "utils/general_utils.h"
 
 using namespace InferenceEngine;
 
 namespace ov {
 namespace intel_cpu {
 
+VariableState::VariableState(std::string name,
+                             MemoryDescPtr desc,
+                             const dnnl::engine& eng,
+                             size_t maxReservedLength,
+                             bool bindTensors)
+    : InferenceEngine::IVariableStateInternal{name},
+      m_desc(desc),
+      m_eng(eng),
+      m_maxReservedLength(maxReservedLength),
+      m_bindTensors(bindTensors) {
+    // the dynamic dimensions start from their lower bounds, i.e. usually from the empty state
+    allocate(m_desc->getShape().getMinDims());
+    // default memory state is zero filled
+    m_memory->nullify();
+}
+
+void VariableState::allocate(const VectorDims& dims) {
+    auto reserveMngr = make_unique<MemoryMngrWithReserve>();
+    m_reserveMngr = reserveMngr.get();
+    m_mngr = std::make_shared<DnnlMemoryMngr>(std::move(reserveMngr));
+    updateMaxReserve(dims);
+    m_memory = std::make_shared<Memory>(m_eng, m_desc->cloneWithNewDims(dims), m_mngr);
+    m_boundTensor.reset();
+}
+
+bool VariableState::bind(const Blob::Ptr& newState) {
+    const auto& tensorDesc = newState->getTensorDesc();
+    if (tensorDesc.getPrecision() != m_desc->getPrecision() || newState->byteSize() == 0)
+        return false;
+    const auto& dims = tensorDesc.getDims();
+    if (!m_desc->cloneWithNewDims(dims)->isCompatible(MemoryDescUtils::convertToCpuBlockedMemoryDesc(tensorDesc)))
+        return false;
+
+    // the graph memory sharing the manager follows the new buffer, the buffer fits the dims, so it isn't reallocated
+    m_mngr->setExtBuff(newState->buffer().as<void*>(), newState->byteSize());
+    m_memory->redefineDesc(m_desc->cloneWithNewDims(dims));
+    m_boundTensor = newState;
+    return true;
+}
+
+void VariableState::updateMaxReserve(const VectorDims& dims) {
+    if (0 == m_maxReservedLength)
+        return;
+    const auto& shapeDims = m_desc->getShape().getDims();
+    const auto lengthAxis = std::find(shapeDims.begin(), shapeDims.end(), Shape::UNDEFINED_DIM) - shapeDims.begin();
+    size_t maxReserve = m_maxReservedLength * m_desc->getPrecision().size();
+    for (size_t i = 0; i < dims.size(); ++i) {
+        if (static_cast<ptrdiff_t>(i) != lengthAxis)
+            maxReserve *= dims[i];
+    }
+    m_reserveMngr->setMaxReserve(maxReserve);
+}
+
+void VariableState::redefine(const VectorDims& dims) {
+    if (m_memory->getStaticDims() == dims)
+        return;
+    updateMaxReserve(dims);
+    m_memory->redefineDesc(m_desc->cloneWithNewDims(dims));
+}
+
 void VariableState::Reset() {
-    std::memset(state->buffer(), 0, state->byteSize());
+    // the bound tensor keeps the state it has
+    if (m_boundTensor)
+        allocate(m_desc->getShape().getMinDims());
+    else
+        redefine(m_desc->getShape().getMinDims());
+    m_memory->nullify();
+}
+
+void VariableState::SetState(const Blob::Ptr& newState) {
+    const auto& tensorDesc = newState->getTensorDesc();
+    const auto& dims = tensorDesc.getDims();
+    if (!m_desc->getShape().isCompatible(dims)) {
+        IE_THROW() << "Can't set the state " << GetName() << ": the new state shape " << vec2str(dims)
+                   << " is incompatible with the state shape " << m_desc->getShape().toString();
+    }
+    if (m_bindTensors && bind(newState))
+        return;
+    if (m_boundTensor)
+        allocate(dims);
+    else
+        redefine(dims);
+
+    const void* srcData = newState->cbuffer().as<const void*>();
+    if (tensorDesc.getPrecision() == m_desc->getPrecision()) {
+        cpu_memcpy(m_memory->getData(), srcData, m_memory->getSize());
+    } else {
+        cpu_convert(srcData, m_memory->getData(), tensorDesc.getPrecision(), m_desc->getPrecision(), newState->size());
+    }
+}
+
+void VariableState::Truncate(int64_t axis, size_t length) {
+    const auto dims = m_memory->getStaticDims();
+    const auto rank = static_cast<int64_t>(dims.size());
+    if (axis < -rank || axis >= rank) {
+        IE_THROW() << "Can't truncate the state " << GetName() << ": the axis " << axis
+                   << " is out of the state rank " << rank;
+    }
+    const auto normAxis = static_cast<size_t>(axis < 0 ? axis + rank : axis);
+    auto newDims = dims;
+    newDims[normAxis] = length;
+    if (length > dims[normAxis] || !m_desc->getShape().isCompatible(newDims)) {
+        IE_THROW() << "Can't truncate the state " << GetName() << " of the shape " << vec2str(dims)
+                   << " to the length " << length << " along the axis " << axis;
+    }
+    if (length == dims[normAxis])
+        return;
+    // the bound tensor keeps the state it has, the blocked layouts are not split by the axis as the dims are
+    if (m_boundTensor || !m_memory->getDesc().hasLayoutType(LayoutType::ncsp)) {
+        IVariableStateInternal::Truncate(axis, length);
+        return;
+    }
+
+    // the leading rows stay in place, so the state with the unit dimensions before the axis (e.g. the KV-cache
+    // of a single sequence) isn't moved at all, only its dims are changed
+    const size_t outerSize = std::accumulate(dims.begin(), dims.begin() + normAxis, size_t(1), std::multiplies<size_t>());
+    const size_t innerBytes = std::accumulate(dims.begin() + normAxis + 1, dims.end(), m_desc->getPrecision().size(),
+                                              std::multiplies<size_t>());
+    auto data = static_cast<uint8_t*>(m_memory->getData());
+    for (size_t i = 1; i < outerSize; i++) {
+        std::memmove(data + i * length * innerBytes, data + i * dims[normAxis] * innerBytes, length * innerBytes);
+    }
+    redefine(newDims);
+}
+
+Blob::CPtr VariableState::GetState() const {
+    // the blob shares the state buffer, so it is valid until the next inference
+    return MemoryDescUtils::interpretAsBlob(*m_memory);
 }
 
 }   // namespace intel_cpu
 }   // namespace ov
-
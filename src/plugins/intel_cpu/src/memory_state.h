@@ -15,16 +15,62 @@
 namespace ov {
 namespace intel_cpu {
 
+/**
+ * @brief The state of the ReadValue/Assign pair of an infer request.
+ * The state data is kept in a growable buffer, which is bound to the graph memory nodes on each inference,
+ * so the state is neither copied into the graph nor back after the inference.
+ * With the tensors binding the buffer is the tensor set by SetState, until the state outgrows it.
+ * Truncate shrinks the state in the same buffer, moving only the kept part of the data.
+ */
 class VariableState : public InferenceEngine::IVariableStateInternal {
 public:
-    VariableState(std::string name, MemoryPtr storage)
-        : InferenceEngine::IVariableStateInternal{name} {
-        state = make_blob_with_precision(MemoryDescUtils::convertToTensorDesc(storage->getDesc()));
-        state->allocate();
-        cpu_memcpy(state->buffer(), storage->getData(), storage->getSize());
-    }
+    using Ptr = std::shared_ptr<VariableState>;
+
+    /**
+     * @param desc - the state memory descriptor, the shape may be dynamic
+     * @param maxReservedLength - the max length (along the first dynamic dimension) the buffer capacity is reserved
+     * in advance for, zero means no limit
+     * @param bindTensors - SetState binds the tensor as the state buffer instead of copying it, when it is possible
+     */
+    VariableState(std::string name,
+                  MemoryDescPtr desc,
+                  const dnnl::engine& eng,
+                  size_t maxReservedLength = 0,
+                  bool bindTensors = false);
 
     void Reset() override;
+    void SetState(const InferenceEngine::Blob::Ptr& newState) override;
+    InferenceEngine::Blob::CPtr GetState() const override;
+    void Truncate(int64_t axis, size_t length) override;
+
+    const MemoryDesc& getDesc() const {
+        return *m_desc;
+    }
+    MemoryPtr getMemory() const {
+        return m_memory;
+    }
+    MemoryMngrPtr getMemoryMngr() const {
+        return m_mngr;
+    }
+    /**
+     * @brief Changes the state dims keeping the data, the buffer is reallocated only if the capacity is exceeded
+     */
+    void redefine(const VectorDims& dims);
+
+private:
+    void allocate(const VectorDims& dims);
+    bool bind(const InferenceEngine::Blob::Ptr& newState);
+    void updateMaxReserve(const VectorDims& dims);
+
+    MemoryDescPtr m_desc;
+    dnnl::engine m_eng;
+    MemoryMngrWithReserve* m_reserveMngr = nullptr;
+    MemoryMngrPtr m_mngr;
+    MemoryPtr m_memory;
+    size_t m_maxReservedLength = 0;
+    bool m_bindTensors = false;
+    // the tensor the state buffer is bound to
+    InferenceEngine::Blob::Ptr m_boundTensor;
 };
 
 }   // namespace intel_cpu
@@ -0,0 +1,58 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "qgemm.hpp"
+
+#include "mlas.h"
+#include "openvino/core/parallel.hpp"
+#include "thread_pool.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+size_t mlas_qgemm_pack_get_size(const int64_t N, const int64_t K, const bool AIsSigned) {
+    return MlasGemmPackBSize(N, K, AIsSigned, true);
+}
+
+void mlas_qgemm_pack(const int64_t N,
+                     const int64_t K,
+                     const int64_t ldb,
+                     const bool AIsSigned,
+                     const int8_t* src,
+                     void* dst) {
+    MlasGemmPackB(N, K, reinterpret_cast<const uint8_t*>(src), ldb, AIsSigned, true, dst);
+}
+
+void mlas_qgemm_compute(const int64_t M,
+                        const int64_t N,
+                        const int64_t K,
+                        const void* A,
+                        const int64_t lda,
+                        const bool AIsSigned,
+                        const void* B,
+                        int32_t* C,
+                        const int64_t ldc,
+                        size_t thread_num) {
+    // the same pool of the OpenVINO threads as in SGEMM
+    ov::cpu::OVMlasThreadPool threadPool(0 == thread_num ? parallel_get_num_threads() : thread_num);
+    static const uint8_t zeroPointB = 0;
+    MLAS_GEMM_QUANT_SHAPE_PARAMS shape;
+    shape.M = M;
+    shape.N = N;
+    shape.K = K;
+    shape.AIsSigned = AIsSigned;
+    shape.BIsSigned = true;
+    MLAS_GEMM_QUANT_DATA_PARAMS qgemmParam;
+    qgemmParam.A = reinterpret_cast<const uint8_t*>(A);
+    qgemmParam.lda = lda;
+    qgemmParam.ZeroPointA = 0;
+    qgemmParam.B = B;
+    qgemmParam.ldb = N;
+    qgemmParam.ZeroPointB = &zeroPointB;
+    qgemmParam.BIsPacked = true;
+    qgemmParam.C = C;
+    qgemmParam.ldc = ldc;
+    MlasGemmBatch(shape, &qgemmParam, 1, &threadPool);
+}
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace intel_cpu {
+/**
+ * @brief  Computes the length in bytes for the packed matrix B buffer(QGEMM with signed B).
+ *
+ * @param N          Supplies the number of columns of matrix B.
+ * @param K          Supplies the number of rows of matrix B.
+ * @param AIsSigned  Supplies true for s8 matrix A, false for u8 one.
+ * @return           bytes of the packing buffer, 0 if the platform has no packed kernel for the precisions
+ */
+size_t mlas_qgemm_pack_get_size(const int64_t N, const int64_t K, const bool AIsSigned);
+
+/**
+ * @brief  Packs the contents of s8 matrix B
+ *
+ * @param N          Supplies the number of columns of matrix B and matrix C.
+ * @param K          Supplies the number of columns of matrix A and the number
+                     of rows of matrix B.
+ * @param ldb        Supplies the first dimension of matrix B.
+ * @param AIsSigned  Supplies true for s8 matrix A, false for u8 one.
+ * @param src        Supplies the address of planar matrix B
+ * @param dst        Supplies pointer to prePacked B buffer
+ */
+void mlas_qgemm_pack(const int64_t N,
+                     const int64_t K,
+                     const int64_t ldb,
+                     const bool AIsSigned,
+                     const int8_t* src,
+                     void* dst);
+
+/**
+ * @brief QGEMM with B matrix prepacked, the zero points of A and B are 0: C = A * B
+ *
+ * @param M            Supplies the number of rows of matrix A and matrix C.
+ * @param N            Supplies the number of columns of matrix B and matrix C.
+ * @param K            Supplies the number of columns of matrix A and the number
+                       of rows of matrix B.
+ * @param A            Supplies the address of u8 or s8 matrix A
+ * @param lda          Supplies the first dimension of matrix A.
+ * @param AIsSigned    Supplies true for s8 matrix A, false for u8 one.
+ * @param B            Supplies the address of prepacked matrix B
+ * @param C            Supplies the address of s32 matrix C
+ * @param ldc          Supplies the first dimension of matrix C.
+ * @param thread_num   0 for all threads, otherwise use thread_num
+ */
+void mlas_qgemm_compute(const int64_t M,
+                        const int64_t N,
+                        const int64_t K,
+                        const void* A,
+                        const int64_t lda,
+                        const bool AIsSigned,
+                        const void* B,
+                        int32_t* C,
+                        const int64_t ldc,
+                        size_t thread_num = 0);
+}  // namespace intel_cpu
+}  // namespace ov
@@ -342,6 +342,25 @@ void Node::selectPreferPrimitiveDescriptor(const std::vector<impl_desc_type>& pr
     selectPrimitiveDescriptorByIndex(0);
 }
 
+void Node::reserveScratchBuffer(size_t size) {
+    if (scratchBufferMem && scratchBufferSize >= size)
+        return;
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(Precision::U8, Shape(VectorDims{std::max<size_t>(size, 1)}));
+    // the shared buffer cannot be used when independent graph branches are executed concurrently
+    if (context->getConfig().enableParallelBranches) {
+        scratchBufferMem = std::make_shared<Memory>(getEngine(), desc);
+    } else {
+        scratchBufferMem = context->getScratchPad()->createScratchBufferMem(desc);
+    }
+    scratchBufferSize = size;
+}
+
+ScratchArena Node::getScratchArena() const {
+    if (!scratchBufferMem)
+        IE_THROW() << "Scratch buffer is not reserved for node " << getName();
+    return ScratchArena(reinterpret_cast<uint8_t*>(scratchBufferMem->getData()), scratchBufferSize);
+}
+
 bool Node::canBeInPlace() const {
     // TODO [DS]: enable inPlace for dynamic shapes
     if (isDynamicNode()) {
@@ -801,6 +820,13 @@ void Node::initDescriptor(const NodeConfig& config) {
     selectedPD->setConfig(updatedConfig);
 }
 
+namespace {
+// the weights shared across the compiled models are identified by the content, so the descriptor must be fully encoded
+std::string sharedWeightsDescSignature(const MemoryDesc& desc) {
+    return desc.getPrecision().name() + std::string("_") + desc.getShape().toString() + "_" + desc.serializeFormat();
+}
+}  // namespace
+
 void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
     size_t minSize = indx + 1;
     if (internalBlobMemory.size() < minSize) {
@@ -826,8 +852,18 @@ void Node::prepareMemory(const DnnlMemoryDescPtr& intDesc, size_t indx) {
     };
 
     MemoryPtr ptr;
+    auto sharedWeightCache = context->getSharedWeightsCache();
     auto weightCache = context->getWeightsCache();
-    if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
+    if (sharedWeightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
+        const uint64_t data_hash = sharedWeightCache->GetHashFunc().hash(
+                internalBlob->buffer(), internalBlob->byteSize());
+
+        const std::string string_hash = sharedWeightsDescSignature(*intDesc)
+                                        + "_" + std::to_string(internalBlob->byteSize())
+                                        + "_" + std::to_string(data_hash);
+
+        ptr = *sharedWeightCache->findOrCreate(string_hash, create);
+    } else if (weightCache != nullptr && memory::format_kind::blocked == intDesc->getDnnlDesc().get_format_kind()) {
         const auto& format = intDesc->serializeFormat();
         const uint64_t data_hash = weightCache->GetHashFunc().hash(
                 internalBlob->buffer(), internalBlob->byteSize());
@@ -893,8 +929,23 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     if (privateWeightCache.end() != itr) {
         ptr = itr->second;
     } else {
+        auto packedWeights = context->getPackedWeights();
+        auto sharedWeightCache = context->getSharedWeightsCache();
         auto weightCache = context->getWeightsCache();
-        if (weightCache != nullptr) {
+        // the weights repacked before the model export are used as is
+        if (packedWeights != nullptr)
+            ptr = packedWeights->find(getName() + "_" + sharedWeightsDescSignature(*dstWeightDesc), dstWeightDesc, getEngine());
+
+        if (ptr) {
+            DEBUG_LOG("Node ", getName(), " uses the imported packed weights ", format);
+        } else if (sharedWeightCache != nullptr) {
+            const std::string string_hash = sharedWeightsDescSignature(*dstWeightDesc)
+                                            + "_" + sharedWeightsDescSignature(*srcWeightDesc)
+                                            + "_" + std::to_string(edgeMem->getSize())
+                                            + "_" + std::to_string(sharedWeightCache->getContentHash(edgeMem));
+
+            ptr = *sharedWeightCache->findOrCreate(string_hash, create);
+        } else if (weightCache != nullptr) {
             const std::string string_hash = getName() + "_" + format
                                             + "_" + std::to_string(edgeMem->getSize())
                                             + "_" + std::to_string(reinterpret_cast<uint64_t>(edgeMem->getData()));
@@ -909,6 +960,12 @@ MemoryPtr Node::prepareWeightMemory(DnnlMemoryDescPtr dstWeightDesc, DnnlMemoryD
     return ptr;
 }
 
+void Node::exportPackedWeights(PackedWeights& packedWeights) const {
+    for (const auto& item : privateWeightCache) {
+        packedWeights.add(getName() + "_" + sharedWeightsDescSignature(item.second->getDesc()), item.second);
+    }
+}
+
 bool Node::isInPlace() const {
     if (inplace == InPlaceType::Unknown) {
         auto selected_pd = getSelectedPrimitiveDescriptor();
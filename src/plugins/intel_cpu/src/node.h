@@ -528,6 +528,11 @@ public:
         return internalBlobs;
     }
 
+    /**
+     * @brief Adds the weights repacked by the node to be stored together with the exported model
+     */
+    void exportPackedWeights(PackedWeights& packedWeights) const;
+
     /**
     * @brief Return scales and shift if nodes can be executed as ScaleShift, else raise exception
     * If node has only scale or shift value, fill missing value with default values
@@ -685,11 +690,27 @@ protected:
 
     MemoryPtr getScratchPadMem(const DnnlMemoryDescPtr& desc) {
         if (!scratchpadMem || !scratchpadMem->getDesc().isCompatible(*desc)) {
-            scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
+            // the shared scratchpad cannot be used when independent graph branches are executed concurrently
+            if (context->getConfig().enableParallelBranches) {
+                scratchpadMem = std::make_shared<Memory>(context->getEngine(), desc);
+            } else {
+                scratchpadMem = context->getScratchPad()->createScratchPadMem(desc);
+            }
         }
         return scratchpadMem;
     }
 
+    /**
+     * @brief Reserves the temporary memory of the node execution in the scratch buffer shared by all the nodes of the graph.
+     * Is supposed to be called from prepareParams with the peak size, the buffer content is not preserved between the executions.
+     */
+    void reserveScratchBuffer(size_t size);
+
+    /**
+     * @brief Returns the arena over the reserved scratch buffer, is valid for the current node execution only
+     */
+    ScratchArena getScratchArena() const;
+
     std::vector<VectorDims> lastInputDims = {};
 
     std::shared_ptr<IShapeInfer> shapeInference;
@@ -716,6 +737,8 @@ private:
     PerfCounters profiling;
 
     MemoryPtr scratchpadMem;
+    MemoryPtr scratchBufferMem;
+    size_t scratchBufferSize = 0;
 
     bool isEdgesEmpty(const std::vector<EdgeWeakPtr>& edges) const;
 
@@ -12,6 +12,9 @@
 #include <ie/ie_parallel.hpp>
 #include "kernels/x64/jit_kernel.hpp"
 #include "shape_inference/custom/color_convert.hpp"
+#include "utils/general_utils.h"
+#include "eltwise.h"
+#include "interpolate.h"
 
 using namespace InferenceEngine;
 using namespace dnnl::impl;
@@ -972,6 +975,144 @@ public:
 #endif
 }   // namespace i420
 
+/**
+ * The conversion with the following bilinear resize and per channel scale and shift: each output pixel is interpolated
+ * from the 4 input pixels converted on the fly, so only the resized image is written.
+ */
+class ResizeConverter : public Converter {
+public:
+    ResizeConverter(Node *node, InterpolateCoordTransMode coordTransMode);
+
+    void execute(dnnl::stream strm) override;
+
+private:
+    struct Tap {
+        size_t idx0, idx1;
+        float weight0, weight1;
+    };
+
+    std::vector<Tap> buildTaps(size_t inSize, size_t outSize) const;
+
+    InterpolateCoordTransMode _coordTransMode;
+    // indexed by the output channel
+    std::array<float, 3> _scales = {1.f, 1.f, 1.f};
+    std::array<float, 3> _shifts = {0.f, 0.f, 0.f};
+};
+
+ResizeConverter::ResizeConverter(Node *node, InterpolateCoordTransMode coordTransMode)
+    : Converter(node)
+    , _coordTransMode(coordTransMode) {
+    for (const auto& fusedNode : node->getFusedWith()) {
+        const auto eltwise = std::dynamic_pointer_cast<Eltwise>(fusedNode);
+        if (!eltwise)
+            IE_THROW() << "ColorConvert node with name '" << node->getName() << "' has unexpected fused node " << fusedNode->getName();
+        const auto& scales = eltwise->getScales();
+        const auto& shifts = eltwise->getShifts();
+        for (size_t c = 0; c < 3; c++) {
+            const float scale = scales.empty() ? 1.f : scales[scales.size() == 1 ? 0 : c];
+            const float shift = shifts.empty() ? 0.f : shifts[shifts.size() == 1 ? 0 : c];
+            _scales[c] *= scale;
+            _shifts[c] = _shifts[c] * scale + shift;
+        }
+    }
+}
+
+std::vector<ResizeConverter::Tap> ResizeConverter::buildTaps(size_t inSize, size_t outSize) const {
+    std::vector<Tap> taps(outSize);
+    const float scale = static_cast<float>(outSize) / static_cast<float>(inSize);
+    for (size_t o = 0; o < outSize; o++) {
+        float coord = static_cast<float>(o);
+        if (inSize != outSize) {
+            switch (_coordTransMode) {
+                case InterpolateCoordTransMode::half_pixel:
+                    coord = (coord + 0.5f) / scale - 0.5f;
+                    break;
+                case InterpolateCoordTransMode::pytorch_half_pixel:
+                    coord = outSize > 1 ? (coord + 0.5f) / scale - 0.5f : 0.f;
+                    break;
+                case InterpolateCoordTransMode::asymmetric:
+                    coord = coord / scale;
+                    break;
+                case InterpolateCoordTransMode::align_corners:
+                    coord = outSize > 1 ? coord * static_cast<float>(inSize - 1) / static_cast<float>(outSize - 1) : 0.f;
+                    break;
+                default:
+                    IE_THROW() << "ColorConvert node with name '" << _node->getName() << "' "
+                               << "doesn't support the coordinate transformation mode of the fused resize";
+            }
+        }
+        coord = std::min(std::max(coord, 0.f), static_cast<float>(inSize - 1));
+        auto& tap = taps[o];
+        tap.idx0 = static_cast<size_t>(coord);
+        tap.idx1 = std::min(tap.idx0 + 1, inSize - 1);
+        tap.weight1 = coord - static_cast<float>(tap.idx0);
+        tap.weight0 = 1.f - tap.weight1;
+    }
+    return taps;
+}
+
+void ResizeConverter::execute(dnnl::stream strm) {
+    const auto & dims = inputDims(0);
+    const auto & dstDims = outputDims(0);
+    const bool isNV12 = one_of(_node->getAlgorithm(), Algorithm::ColorConvertNV12toRGB, Algorithm::ColorConvertNV12toBGR);
+    const bool isSinglePlane = singlePlane();
+
+    const size_t batch_size = dims[N_DIM];
+    const size_t height = isSinglePlane ? dims[H_DIM] * 2 / 3 : dims[H_DIM];
+    const size_t width = dims[W_DIM];
+    const size_t OH = dstDims[H_DIM];
+    const size_t OW = dstDims[W_DIM];
+
+    // the chroma is subsampled by 2 in both dims: NV12 has the interleaved UV rows of the width elements,
+    // I420 has the separate U and V planes
+    const float* y = static_cast<const float*>(input(0));
+    const float* u = isSinglePlane ? y + width * height : static_cast<const float*>(input(1));
+    const float* v = isNV12 ? u + 1
+                            : isSinglePlane ? y + 5 * width * height / 4 : static_cast<const float*>(input(2));
+    const size_t stride_y = isSinglePlane ? height * width * 3 / 2 : height * width;
+    const size_t stride_uv = isSinglePlane ? stride_y : (isNV12 ? height * width / 2 : height * width / 4);
+    const size_t uvRow = isNV12 ? width : width / 2;
+    const size_t uvStep = isNV12 ? 2 : 1;
+    float* dst = static_cast<float*>(output(0));
+
+    const auto rowTaps = buildTaps(height, OH);
+    const auto colTaps = buildTaps(width, OW);
+
+    InferenceEngine::parallel_for2d(batch_size, OH, [&](size_t batch, size_t oh) {
+        const float* y_ptr = y + batch * stride_y;
+        const float* u_ptr = u + batch * stride_uv;
+        const float* v_ptr = v + batch * stride_uv;
+        float* out = dst + (batch * OH + oh) * OW * 3;
+        const auto& rowTap = rowTaps[oh];
+
+        const auto rgbAt = [&](size_t h, size_t w) {
+            const size_t uv_index = (h / 2) * uvRow + (w / 2) * uvStep;
+            return yuv_to_rgb<float>(y_ptr[h * width + w], u_ptr[uv_index], v_ptr[uv_index]);
+        };
+
+        for (size_t ow = 0; ow < OW; ow++) {
+            const auto& colTap = colTaps[ow];
+            // the clipping of the conversion isn't linear, so the converted pixels are interpolated
+            const auto p00 = rgbAt(rowTap.idx0, colTap.idx0);
+            const auto p01 = rgbAt(rowTap.idx0, colTap.idx1);
+            const auto p10 = rgbAt(rowTap.idx1, colTap.idx0);
+            const auto p11 = rgbAt(rowTap.idx1, colTap.idx1);
+            const auto interpolate = [&](float v00, float v01, float v10, float v11) {
+                return rowTap.weight0 * (colTap.weight0 * v00 + colTap.weight1 * v01) +
+                       rowTap.weight1 * (colTap.weight0 * v10 + colTap.weight1 * v11);
+            };
+            const std::array<float, 3> rgb = {
+                interpolate(std::get<0>(p00), std::get<0>(p01), std::get<0>(p10), std::get<0>(p11)),
+                interpolate(std::get<1>(p00), std::get<1>(p01), std::get<1>(p10), std::get<1>(p11)),
+                interpolate(std::get<2>(p00), std::get<2>(p01), std::get<2>(p10), std::get<2>(p11))};
+            for (size_t c = 0; c < 3; c++) {
+                const size_t oc = _colorFormat[c];
+                out[ow * 3 + oc] = rgb[c] * _scales[oc] + _shifts[oc];
+            }
+        }
+    });
+}
+
 }   // namespace
 
 ColorConvert::Converter::Converter(Node *node, const ColorFormat & colorFormat)
@@ -999,6 +1140,10 @@ const VectorDims & ColorConvert::Converter::inputDims(size_t idx) const {
     return _node->getParentEdgesAtPort(idx)[0]->getMemory().getStaticDims();
 }
 
+const VectorDims & ColorConvert::Converter::outputDims(size_t idx) const {
+    return _node->getChildEdgesAtPort(idx)[0]->getMemory().getStaticDims();
+}
+
 bool ColorConvert::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     Algorithm alg;
     std::tie(alg, errorMessage) = getAlgorithmFor(op);
@@ -1109,7 +1254,9 @@ void ColorConvert::createPrimitive() {
         IE_THROW() << getTypeStr() + " node with name '" + getName() + "' "
                    << "no optimal primitive descriptor selected";
 
-    if (!_impl) {
+    if (!_impl && withResize) {
+        _impl = std::unique_ptr<Converter>(new ResizeConverter(this, resizeCoordTransMode));
+    } else if (!_impl) {
         const auto & cfg = desc->getConfig();
         const auto precision = cfg.inConfs[0].getMemDesc()->getPrecision();
         const bool isSinglePlane = cfg.inConfs.size() == 1;
@@ -1141,6 +1288,26 @@ void ColorConvert::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+bool ColorConvert::canFuse(const NodePtr& node) const {
+    // the scale and shift is applied only by the conversion with the resize
+    return withResize && node->getType() == Type::Eltwise &&
+           one_of(node->getAlgorithm(), Algorithm::EltwiseAdd, Algorithm::EltwiseSubtract, Algorithm::EltwiseMultiply,
+                  Algorithm::EltwiseDivide, Algorithm::EltwiseMulAdd, Algorithm::EltwisePowerStatic) &&
+           node->getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+           node->canBePerformedAsScaleShift(this);
+}
+
+int ColorConvert::getFusingAxis() const {
+    return static_cast<int>(Converter::C_DIM);
+}
+
+bool ColorConvert::canFuseResize(const NodePtr& node) const {
+    const auto interpolate = std::dynamic_pointer_cast<const Interpolate>(node);
+    return interpolate && !withResize && fusedWith.empty() && !isDynamicNode() &&
+           getOriginalOutputPrecisionAtPort(0) == Precision::FP32 &&
+           interpolate->isLinearResizeNHWC();
+}
+
 }   // namespace node
 }   // namespace intel_cpu
 }   // namespace ov
@@ -6,6 +6,7 @@
 
 #include <node.h>
 #include <utils/multidim_map.hpp>
+#include "executors/interpolate.hpp"
 #include <functional>
 #include <tuple>
 #include <array>
@@ -27,6 +28,18 @@ public:
     bool created() const override;
     bool needPrepareParams() const override;
     void executeDynamicImpl(dnnl::stream strm) override;
+    bool canFuse(const NodePtr& node) const override;
+    int getFusingAxis() const override;
+
+    /**
+     * @brief Checks whether the following bilinear resize of the converted image can be computed by the node,
+     * so the full resolution image is not written to memory and read back by the Interpolate
+     */
+    bool canFuseResize(const NodePtr& node) const;
+    void fuseResize(InterpolateCoordTransMode coordTransMode) {
+        withResize = true;
+        resizeCoordTransMode = coordTransMode;
+    }
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
@@ -44,6 +57,9 @@ private:
 
     std::unique_ptr<Converter> _impl;
     SupportedImpls _supportedImpls;
+
+    bool withResize = false;
+    InterpolateCoordTransMode resizeCoordTransMode = InterpolateCoordTransMode::half_pixel;
 };
 
 class ColorConvert::Converter {
@@ -68,6 +84,7 @@ public:
     const void * input(size_t idx) const;
     void * output(size_t idx) const;
     const VectorDims & inputDims(size_t idx) const;
+    const VectorDims & outputDims(size_t idx) const;
     virtual void execute(dnnl::stream strm) = 0;
 
 protected:
@@ -556,6 +556,35 @@ struct ConvertFromBinPrecision {
 };
 
 
+#define INTEL_CPU_CVT_FROM_4BIT_LIST                                                                \
+    INTEL_CPU_CVT_FROM_BIN(FP32), INTEL_CPU_CVT_FROM_BIN(FP16), INTEL_CPU_CVT_FROM_BIN(BF16),       \
+    INTEL_CPU_CVT_FROM_BIN(U8), INTEL_CPU_CVT_FROM_BIN(I8), INTEL_CPU_CVT_FROM_BIN(I32)
+
+struct ConvertFrom4BitContext {
+    const void *srcPtr;
+    void *dstPtr;
+    size_t size;
+    bool isSigned;
+    bool converted;
+};
+
+template<typename T>
+struct ConvertFrom4BitPrecision {
+    void operator()(ConvertFrom4BitContext &ctx) {
+        auto src = static_cast<const uint8_t *>(ctx.srcPtr);
+        auto dst = static_cast<T *>(ctx.dstPtr);
+        const bool isSigned = ctx.isSigned;
+        // two elements are packed per byte, the first one is in the high half of the byte
+        parallel_for(ctx.size, [&](size_t i) {
+            int8_t val = (src[i / 2] >> (4 * ((i + 1) % 2))) & 0xF;
+            if (isSigned && (val & 0x08))
+                val |= 0xF0;
+            dst[i] = static_cast<T>(val);
+        });
+        ctx.converted = true;
+    }
+};
+
 void cpu_convert(const void *srcPtr, void *dstPtr, Precision srcPrc, Precision dstPrc, const size_t size) {
     cpu_convert(srcPtr, dstPtr, srcPrc, dstPrc, dstPrc, size);
 }
@@ -597,6 +626,17 @@ void cpu_convert(const void *srcPtr,
         if (!ctx.converted)
             IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " <bitsSize == " << srcPrc.bitsSize()
                                                              << "> precision to: " << dstPrc;
+    } else if (one_of(srcPrc, Precision::U4, Precision::I4)) {
+        ConvertFrom4BitContext ctx {
+                srcPtr,
+                dstPtr,
+                size,
+                srcPrc == Precision::I4,
+                false
+        };
+        OV_SWITCH(intel_cpu, ConvertFrom4BitPrecision, ctx, dstPrc, INTEL_CPU_CVT_FROM_4BIT_LIST);
+        if (!ctx.converted)
+            IE_THROW() << "cpu_convert can't convert from: " << srcPrc << " precision to: " << dstPrc;
     } else {
         ConvertContext ctx {
             srcPtr,
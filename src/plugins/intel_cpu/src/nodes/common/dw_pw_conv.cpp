@@ -0,0 +1,117 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dw_pw_conv.h"
+
+#include <ie_common.h>
+#include <ie_parallel.hpp>
+#include <onednn/dnnl.h>
+#include <oneapi/dnnl/dnnl.hpp>
+#include "utils/general_utils.h"
+
+#include <algorithm>
+
+using namespace InferenceEngine;
+
+namespace ov {
+namespace intel_cpu {
+
+bool DWPWConvolution::isSupportedActivation(Algorithm algorithm) {
+    return one_of(algorithm, Algorithm::EltwiseRelu, Algorithm::EltwiseClamp, Algorithm::EltwiseHswish);
+}
+
+DWPWConvolution::DWPWConvolution(const Params& params, const float* dwWeights, const float* dwBias,
+                                 const float* pwWeights, const float* pwBias)
+    : params(params),
+      dwWeights(params.KH * params.KW * params.C),
+      dwBias(params.C, 0.f),
+      pwWeights(pwWeights, pwWeights + params.OC * params.C),
+      pwBias(params.OC, 0.f) {
+    const size_t kernelSize = params.KH * params.KW;
+    for (size_t c = 0; c < params.C; c++) {
+        for (size_t k = 0; k < kernelSize; k++)
+            this->dwWeights[k * params.C + c] = dwWeights[c * kernelSize + k];
+    }
+    if (dwBias)
+        std::copy(dwBias, dwBias + params.C, this->dwBias.begin());
+    if (pwBias)
+        std::copy(pwBias, pwBias + params.OC, this->pwBias.begin());
+
+    // the depthwise tile and the output rows computed from it share the half of L2
+    const size_t rowSize = params.OW * (params.C + params.OC) * sizeof(float);
+    const size_t threadsNum = static_cast<size_t>(parallel_get_max_threads());
+    tileRows = std::max<size_t>(1, dnnl::utils::get_cache_size(2, true) / 2 / rowSize);
+    // but there must be enough tiles to load all the threads
+    tileRows = std::min(tileRows, std::max<size_t>(1, params.N * params.OH / threadsNum));
+    tileRows = std::min(tileRows, params.OH);
+    tileBuffers.resize(threadsNum * tileRows * params.OW * params.C);
+}
+
+void DWPWConvolution::activate(float* data, size_t count, const std::vector<Activation>& activations) {
+    for (const auto& activation : activations) {
+        switch (activation.algorithm) {
+        case Algorithm::EltwiseRelu:
+            for (size_t i = 0; i < count; i++)
+                data[i] = data[i] > 0.f ? data[i] : data[i] * activation.alpha;
+            break;
+        case Algorithm::EltwiseClamp:
+            for (size_t i = 0; i < count; i++)
+                data[i] = std::min(std::max(data[i], activation.alpha), activation.beta);
+            break;
+        case Algorithm::EltwiseHswish:
+            for (size_t i = 0; i < count; i++)
+                data[i] = data[i] * std::min(std::max(data[i] + 3.f, 0.f), 6.f) / 6.f;
+            break;
+        default:
+            IE_THROW() << "DWPWConvolution doesn't support the activation " << algToString(activation.algorithm);
+        }
+    }
+}
+
+void DWPWConvolution::exec(const float* src, float* dst) {
+    const auto& p = params;
+    const size_t tilesNum = div_up(p.OH, tileRows);
+
+    parallel_for2d(p.N, tilesNum, [&](size_t n, size_t tile) {
+        const size_t ohStart = tile * tileRows;
+        const size_t ohEnd = std::min(ohStart + tileRows, p.OH);
+        const size_t rows = (ohEnd - ohStart) * p.OW;
+        float* tileBuffer = tileBuffers.data() + parallel_get_thread_num() * tileRows * p.OW * p.C;
+
+        for (size_t oh = ohStart; oh < ohEnd; oh++) {
+            for (size_t ow = 0; ow < p.OW; ow++) {
+                float* out = tileBuffer + ((oh - ohStart) * p.OW + ow) * p.C;
+                std::copy(dwBias.begin(), dwBias.end(), out);
+                for (size_t kh = 0; kh < p.KH; kh++) {
+                    const ptrdiff_t ih = static_cast<ptrdiff_t>(oh * p.strideH + kh) - p.padT;
+                    if (ih < 0 || ih >= static_cast<ptrdiff_t>(p.IH))
+                        continue;
+                    for (size_t kw = 0; kw < p.KW; kw++) {
+                        const ptrdiff_t iw = static_cast<ptrdiff_t>(ow * p.strideW + kw) - p.padL;
+                        if (iw < 0 || iw >= static_cast<ptrdiff_t>(p.IW))
+                            continue;
+                        const float* in = src + ((n * p.IH + ih) * p.IW + iw) * p.C;
+                        const float* w = dwWeights.data() + (kh * p.KW + kw) * p.C;
+                        for (size_t c = 0; c < p.C; c++)
+                            out[c] += in[c] * w[c];
+                    }
+                }
+            }
+        }
+        activate(tileBuffer, rows * p.C, p.dwActivations);
+
+        // the pointwise convolution of the tile is [rows, C] x [OC, C]^T straight into the output rows
+        float* out = dst + (n * p.OH + ohStart) * p.OW * p.OC;
+        dnnl::sgemm('N', 'T', rows, p.OC, p.C, 1.f, tileBuffer, p.C, pwWeights.data(), p.C, 0.f, out, p.OC);
+        for (size_t r = 0; r < rows; r++) {
+            float* outRow = out + r * p.OC;
+            for (size_t oc = 0; oc < p.OC; oc++)
+                outRow[oc] += pwBias[oc];
+            activate(outRow, p.OC, p.pwActivations);
+        }
+    });
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
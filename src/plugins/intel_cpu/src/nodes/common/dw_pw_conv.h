@@ -0,0 +1,65 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu_types.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief The f32 depthwise convolution followed by the pointwise 1x1 convolution, both in nhwc.
+ * The output rows are computed by the tiles: the depthwise results of a tile are kept in a per thread buffer
+ * sized to stay in L2 and are immediately consumed by the GEMM of the pointwise convolution, so the
+ * intermediate tensor is never written to the memory.
+ */
+class DWPWConvolution {
+public:
+    struct Activation {
+        Algorithm algorithm;
+        float alpha;
+        float beta;
+    };
+
+    struct Params {
+        size_t N, C, IH, IW;
+        size_t OC, OH, OW;
+        size_t KH, KW;
+        size_t strideH, strideW;
+        ptrdiff_t padT, padL;
+        std::vector<Activation> dwActivations;
+        std::vector<Activation> pwActivations;
+    };
+
+    static bool isSupportedActivation(Algorithm algorithm);
+
+    /**
+     * @param dwWeights the depthwise weights [C, KH, KW]
+     * @param pwWeights the pointwise weights [OC, C]
+     * @param dwBias, pwBias the biases, may be nullptr
+     */
+    DWPWConvolution(const Params& params, const float* dwWeights, const float* dwBias,
+                    const float* pwWeights, const float* pwBias);
+
+    void exec(const float* src, float* dst);
+
+private:
+    static void activate(float* data, size_t count, const std::vector<Activation>& activations);
+
+    Params params;
+    size_t tileRows;
+    // the depthwise weights are transposed to [KH, KW, C] to have the channels innermost as in nhwc
+    std::vector<float> dwWeights;
+    std::vector<float> dwBias;
+    std::vector<float> pwWeights;
+    std::vector<float> pwBias;
+    std::vector<float> tileBuffers;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -401,6 +401,16 @@ void Concat::prepareParams() {
     }
 }
 
+bool Concat::isFirstInputPrefix() const {
+    if (isInPlace() || !canExecRef || canOptimizeNspc || inputPrecision != outputPrecision)
+        return false;
+    auto selected_pd = getSelectedPrimitiveDescriptor();
+    if (selected_pd == nullptr || !selected_pd->getConfig().outConfs[0].getMemDesc()->hasLayoutType(LayoutType::ncsp))
+        return false;
+    const auto& childDims = outputShapes[0].getDims();
+    return std::all_of(childDims.begin(), childDims.begin() + axis, [](size_t dim) { return dim == 1; });
+}
+
 size_t Concat::inverseOrder(const SizeVector& order, size_t axis) {
     for (size_t i = 0; i < order.size(); i++) {
         if (axis == order[i]) {
@@ -546,11 +556,16 @@ void Concat::execRef() {
             for (size_t a = 0; a < srcPtrs.size(); ++a) {
                 const auto inData = srcPtrs[a];
                 auto outputData = &dstPtr[dstOffset[a]];
+                // the input may already be a part of the output buffer
+                if (inData == outputData)
+                    continue;
                 std::memcpy(outputData, inData, nelemToCopy[a]);
             }
         } else {
             parallel_nt(nthr, [&](int ithr, int nthr) {
                 for (size_t a = 0; a < srcPtrs.size(); ++a) {
+                    if (srcPtrs[a] == dstPtr + dstOffset[a])
+                        continue;
                     size_t start = 0, end = 0;
                     splitter(nelemToCopy[a], nthr, ithr, start, end);
                     const uint8_t* i = srcPtrs[a] + start;
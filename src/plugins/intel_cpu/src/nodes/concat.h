@@ -34,6 +34,12 @@ public:
     bool needPrepareParams() const override;
     void prepareParams() override;
 
+    /**
+     * @brief Checks whether the output data starts with the first input data as is, i.e. the first input may share
+     * the output buffer and the concatenation just appends the other inputs
+     */
+    bool isFirstInputPrefix() const;
+
 private:
     size_t axis = 0;
     size_t reorderedAxis = 0;
@@ -13,6 +13,7 @@
 #include <graph.h>
 #include "cpu/x64/cpu_isa_traits.hpp"
 #include <common/c_types_map.hpp>
+#include <algorithm>
 #include <cstdlib>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
@@ -25,6 +26,7 @@
 #include <utils/general_utils.h>
 #include <ngraph/ops.hpp>
 #include <cpu/x64/jit_generator.hpp>
+#include "common/blocked_desc_creator.h"
 #include "common/cpu_convert.h"
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
@@ -430,6 +432,12 @@ void Convolution::getSupportedDescriptors() {
 
     int ndims = getInputShapeAtPort(0).getRank();
 
+    // the pointwise convolution fused into the depthwise one is computed by the plugin kernel
+    if (isDepthWise() && isFusedWith(Type::Convolution)) {
+        withPWConv = true;
+        return;
+    }
+
     withDWConv = isFusedWith(Type::Convolution);
     if (withDWConv && isDynamicNode()) {
         IE_THROW() << "DW convolution is fused into convolution node " << getName() << " with dynamic shape.";
@@ -724,6 +732,18 @@ void Convolution::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (withPWConv) {
+        auto& creatorsMap = BlockedDescCreator::getCommonCreators();
+        NodeConfig config;
+        for (size_t i = 0; i < getParentEdges().size(); i++) {
+            const auto layout = i == 0 ? LayoutType::nspc : LayoutType::ncsp;
+            config.inConfs.emplace_back(creatorsMap.at(layout)->createSharedDesc(Precision::FP32, getInputShapeAtPort(i)));
+        }
+        config.outConfs.emplace_back(creatorsMap.at(LayoutType::nspc)->createSharedDesc(Precision::FP32, getOutputShapeAtPort(0)));
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::gemm_any);
+        return;
+    }
+
     auto getBlockedMask = [](const std::shared_ptr<MemoryDesc>& memDesc, const bool isGrouped) {
         if (memDesc->getType() & MemoryDescType::Blocked && !isGrouped)
             return BlockedMemoryDesc::EMPTY_MASK;
@@ -997,6 +1017,11 @@ void Convolution::SetPostOpsAndZeroPoints(std::vector<dnnl::primitive_attr> &att
 }
 
 void Convolution::initDescriptor(const NodeConfig& config) {
+    if (withPWConv) {
+        Node::initDescriptor(config);
+        return;
+    }
+
     auto *selectedPD = getSelectedPrimitiveDescriptor();
 
     if (!selectedPD) {
@@ -1078,6 +1103,11 @@ std::shared_ptr<MemoryDesc> Convolution::getSrcMemDesc(const dnnl::primitive_des
 }
 
 bool Convolution::canFuse(const NodePtr& node) const {
+    if (isDepthWise() && isFusedWith(Type::Convolution)) {
+        // only the activations supported by the dw + pw kernel may follow the fused pointwise convolution
+        return node->getType() == Type::Eltwise && DWPWConvolution::isSupportedActivation(node->getAlgorithm()) &&
+               canFuseSimpleOperation(node);
+    }
     return canFuseSimpleOperation(node);
 }
 
@@ -1208,6 +1238,11 @@ InferenceEngine::Blob::Ptr Convolution::createInternalBlob(InferenceEngine::Size
 }
 
 void Convolution::prepareParams() {
+    if (withPWConv) {
+        prepareDWPWConv();
+        return;
+    }
+
     auto srcMemPtr = getParentEdgesAtPort(0)[0]->getMemoryPtr();
     auto wghMemPtr = getParentEdgesAtPort(1)[0]->getMemoryPtr();
     auto dstMemPtr = getOutputMemory();
@@ -1491,6 +1526,12 @@ void Convolution::ConvolutionSumExecutor::reorder_exec(std::unordered_map<int, d
 }
 
 void Convolution::execute(dnnl::stream strm) {
+    if (withPWConv) {
+        dwpwConv->exec(reinterpret_cast<const float*>(getParentEdgeAt(0)->getMemoryPtr()->getData()),
+                       reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->getData()));
+        return;
+    }
+
     if (!execPtr) {
         IE_THROW() << "Can't execute Convolution node with name: " << getName() << ", because executor is not compiled";
     }
@@ -1498,6 +1539,55 @@ void Convolution::execute(dnnl::stream strm) {
     execPtr->exec(primArgs, strm);
 }
 
+void Convolution::prepareDWPWConv() {
+    // the shapes and the weights are static, so the kernel is created once
+    if (dwpwConv)
+        return;
+
+    // fusedWith holds the activations of the depthwise convolution, the pointwise one and its activations
+    const auto pwConv = std::find_if(fusedWith.cbegin(), fusedWith.cend(), [](const NodePtr& node) {
+        return node->getType() == Type::Convolution;
+    });
+    auto getActivations = [&](std::vector<NodePtr>::const_iterator begin, std::vector<NodePtr>::const_iterator end) {
+        std::vector<DWPWConvolution::Activation> activations;
+        for (auto it = begin; it != end; it++) {
+            const auto eltwise = std::dynamic_pointer_cast<Eltwise>(*it);
+            if (!eltwise || !DWPWConvolution::isSupportedActivation(eltwise->getAlgorithm()))
+                IE_THROW() << "Unsupported operation " << (*it)->getName() << " is fused into convolution " << getName();
+            activations.push_back({eltwise->getAlgorithm(), eltwise->getAlpha(), eltwise->getBeta()});
+        }
+        return activations;
+    };
+
+    const auto& srcDims = getInputShapeAtPort(0).getStaticDims();
+    const auto& dstDims = getOutputShapeAtPort(0).getStaticDims();
+    DWPWConvolution::Params params;
+    params.N = srcDims[0];
+    params.C = srcDims[1];
+    params.IH = srcDims[2];
+    params.IW = srcDims[3];
+    params.OC = dstDims[1];
+    params.OH = dstDims[2];
+    params.OW = dstDims[3];
+    params.KH = weightDims[weightDims.size() - 2];
+    params.KW = weightDims[weightDims.size() - 1];
+    params.strideH = stride[0];
+    params.strideW = stride[1];
+    params.padT = paddingL[0];
+    params.padL = paddingL[1];
+    params.dwActivations = getActivations(fusedWith.cbegin(), pwConv);
+    params.pwActivations = getActivations(std::next(pwConv), fusedWith.cend());
+
+    auto getData = [&](size_t port) {
+        return reinterpret_cast<const float*>(getParentEdgeAt(port)->getMemoryPtr()->getData());
+    };
+    // the inputs of the pointwise convolution follow the ones of the depthwise convolution
+    const size_t pwWeightsPort = getOriginalInputsNumber();
+    const bool pwWithBias = getParentEdges().size() > pwWeightsPort + 1;
+    dwpwConv = std::make_shared<DWPWConvolution>(params, getData(1), withBiases ? getData(2) : nullptr,
+                                                 getData(pwWeightsPort), pwWithBias ? getData(pwWeightsPort + 1) : nullptr);
+}
+
 void Convolution::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
     if (withSumBroadcast) {
@@ -10,6 +10,7 @@
 #include <string>
 #include <vector>
 #include "common/dnnl_executor.h"
+#include "common/dw_pw_conv.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -125,10 +126,14 @@ private:
     VectorDims outputStaticShape() const;
     void appendLegacyZeroPointsArgs();
     void appendZeroPointsArgs();
+    void prepareDWPWConv();
 
     bool withBiases;
     bool withSum;
     bool withDWConv;
+    // the fused pointwise convolution of the depthwise one, computed by the plugin kernel instead of oneDNN
+    bool withPWConv = false;
+    std::shared_ptr<DWPWConvolution> dwpwConv;
     bool isGrouped;
     bool withSumBroadcast = false;
     bool preferLegacyPostOps = false;
@@ -25,10 +25,16 @@ bool SortScorePairDescend(const std::pair<float, T>& pair1,
     return (pair1.first > pair2.first) || (pair1.first == pair2.first && pair1.second < pair2.second);
 }
 
+// the (class, prior) pairs with the same score are ordered by the prior and then by the class, so the order is total
+// and the detections kept by keep_top_k don't depend on the order the classes were gathered in
 template <>
 bool SortScorePairDescend<std::pair<int, int>>(const std::pair<float, std::pair<int, int>>& pair1,
                                                const std::pair<float, std::pair<int, int>>& pair2) {
-    return (pair1.first > pair2.first) || (pair1.first == pair2.first && pair1.second.second < pair2.second.second);
+    if (pair1.first != pair2.first)
+        return pair1.first > pair2.first;
+    if (pair1.second.second != pair2.second.second)
+        return pair1.second.second < pair2.second.second;
+    return pair1.second.first < pair2.second.first;
 }
 
 } // namespace
@@ -305,9 +311,13 @@ void DetectionOutput::execute(dnnl::stream strm) {
 
         // combine detections of all class for this image and filter with global(image) topk(keep_topk)
         if (keepTopK > -1 && detectionsTotal > keepTopK) {
-            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap;
+            // each class writes its detections from the offset of the class, the order is the same for every run
+            std::vector<int> classOffsets(classesNum + 1, 0);
+            for (int c = 0; c < classesNum; ++c) {
+                classOffsets[c + 1] = classOffsets[c] + detectionsData[n * classesNum + c];
+            }
+            std::vector<std::pair<float, std::pair<int, int>>> confIndicesClassMap(detectionsTotal);
 
-            std::mutex mtx;
             parallel_for(classesNum, [&](int c) {
                 int detections = detectionsData[n * classesNum + c];
                 int *pindices = indicesData + n * classesNum * priorsNum + c * priorsNum;
@@ -316,14 +326,13 @@ void DetectionOutput::execute(dnnl::stream strm) {
 
                 for (int i = 0; i < detections; ++i) {
                     int pr = pindices[i];
-                    mtx.lock();
-                    confIndicesClassMap.push_back(std::make_pair(pconf[pr], std::make_pair(c, pr)));
-                    mtx.unlock();
+                    confIndicesClassMap[classOffsets[c] + i] = std::make_pair(pconf[pr], std::make_pair(c, pr));
                 }
             });
 
-            std::sort(confIndicesClassMap.begin(), confIndicesClassMap.end(),
-                      SortScorePairDescend<std::pair<int, int>>);
+            // only the keep_top_k best detections are ordered
+            std::partial_sort(confIndicesClassMap.begin(), confIndicesClassMap.begin() + keepTopK, confIndicesClassMap.end(),
+                              SortScorePairDescend<std::pair<int, int>>);
             confIndicesClassMap.resize(keepTopK);
 
             // Store the new indices. Assign to class back
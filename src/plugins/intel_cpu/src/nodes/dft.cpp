@@ -4,6 +4,7 @@
 
 #include "dft.h"
 
+#include <algorithm>
 #include <string>
 #include <thread>
 #include <vector>
@@ -273,23 +274,26 @@ void DFT::execute(dnnl::stream strm) {
         cpu_memcpy(dst, src, totalElements * sizeof(float));
     }
 
+    auto arena = getScratchArena();
+    float* fftBuffers = arena.allocate<float>(buffersThreadsNum * fftBufferLen);
+    float* dftBuffers = arena.allocate<float>(2 * dftBufferLen);
+
     // 1d case
     if (inputRank == 2) {
         size_t nComplex = outputShape[0];
         if (IsPowerOfTwo(nComplex)) {
-            std::vector<float> outputData(nComplex * 2);
             const float* resultBufPtr;
 
-            fft(dst, outputData.data(), nComplex * 2, inverse, true, &resultBufPtr);
+            fft(dst, fftBuffers, nComplex * 2, inverse, true, &resultBufPtr);
 
             if (resultBufPtr != dst) {
                 cpu_memcpy(dst, resultBufPtr, nComplex * 2 * sizeof(float));
             }
         } else {
-            naiveDFT(dst, nComplex * 2, inverse);
+            naiveDFT(dst, nComplex * 2, inverse, dftBuffers);
         }
     } else {
-        dftNd(dst, outputShape, outputStrides, axes, inverse);
+        dftNd(dst, outputShape, outputStrides, axes, inverse, fftBuffers, dftBuffers);
     }
 
     lastInverse = inverse;
@@ -299,7 +303,9 @@ void DFT::dftNd(float* output,
                 const VectorDims& outputShape,
                 const VectorDims& outputStrides,
                 const std::vector<int32_t>& axes,
-                bool inverse) const {
+                bool inverse,
+                float* fftBuffers,
+                float* dftBuffers) const {
     const std::vector<size_t> iterationRange(outputShape.begin(), outputShape.end() - 1);
     const size_t lastDimIndex = iterationRange.size() - 1;
     for (size_t axisIndex = 0; axisIndex < axes.size(); ++axisIndex) {
@@ -312,22 +318,22 @@ void DFT::dftNd(float* output,
             size_t parallelDimIndex = lastDimIndex == currentAxis ? lastDimIndex - 1 : lastDimIndex;
             do {
                 parallel_for(iterationRange[parallelDimIndex], [&](size_t dim) {
-                    std::vector<float> gatheredData(outputLen * 2);
+                    float* gatheredData = fftBuffers + parallel_get_thread_num() * fftBufferLen;
                     auto parallelIterationCounter = iterationCounter;
                     parallelIterationCounter[parallelDimIndex] = dim;
-                    gatherToBufferND(gatheredData.data(), output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
+                    gatherToBufferND(gatheredData, output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
                     const float* resultBufPtr;
-                    fft(gatheredData.data(), gatheredData.data() + outputLen, outputLen, inverse, false, &resultBufPtr);
+                    fft(gatheredData, gatheredData + outputLen, outputLen, inverse, false, &resultBufPtr);
                     applyBufferND(resultBufPtr, output, currentAxis, parallelIterationCounter, outputShape, outputStrides);
                 });
                 iterationCounter[parallelDimIndex] = iterationRange[parallelDimIndex] - 1;
             } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
         } else {
-            std::vector<float> gatheredData(outputLen);
+            float* gatheredData = dftBuffers + dftBufferLen;
             do {
-                gatherToBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
-                naiveDFT(gatheredData.data(), outputLen, inverse);
-                applyBufferND(gatheredData.data(), output, currentAxis, iterationCounter, outputShape, outputStrides);
+                gatherToBufferND(gatheredData, output, currentAxis, iterationCounter, outputShape, outputStrides);
+                naiveDFT(gatheredData, outputLen, inverse, dftBuffers);
+                applyBufferND(gatheredData, output, currentAxis, iterationCounter, outputShape, outputStrides);
             } while (nextIterationStep(iterationCounter, iterationRange, currentAxis));
         }
     }
@@ -412,8 +418,7 @@ void DFT::fft(float* inBuffer,
     *resultBuf = inBuffer;
 }
 
-void DFT::naiveDFT(float* data, size_t dataLength, bool inverse) const {
-    std::vector<float> outputBuffer(dataLength);
+void DFT::naiveDFT(float* data, size_t dataLength, bool inverse, float* outputBuffer) const {
     const size_t nComplex = dataLength / 2;
     const float reciprocalNComplex = 1.0f / nComplex;
     const auto& twiddles = twiddlesMapDFT.find(nComplex)->second;
@@ -424,7 +429,7 @@ void DFT::naiveDFT(float* data, size_t dataLength, bool inverse) const {
             auto arg = jit_args_dft();
 
             arg.src = data;
-            arg.dst = outputBuffer.data() + 2 * k;
+            arg.dst = outputBuffer + 2 * k;
             arg.twiddles = twiddles.data() + 2 * k * nComplex;
             arg.work_amount = nComplex;
             arg.index = k;
@@ -463,7 +468,7 @@ void DFT::naiveDFT(float* data, size_t dataLength, bool inverse) const {
     }
 
     parallel_for(nComplex, blockIteration);
-    cpu_memcpy(data, outputBuffer.data(), dataLength * sizeof(float));
+    cpu_memcpy(data, outputBuffer, dataLength * sizeof(float));
 }
 
 std::vector<float> DFT::generateTwiddlesDFT(size_t n_complex, bool inverse) const {
@@ -527,17 +532,27 @@ void DFT::prepareParams() {
     axes = getAxes();
     const auto outputShape = getChildEdgesAtPort(0)[0]->getMemory().getStaticDims();
 
+    fftBufferLen = 0;
+    dftBufferLen = 0;
     for (size_t axis : axes) {
         size_t nComplex = outputShape[axis];
         if (!IsPowerOfTwo(nComplex)) {
             hasDFT = true;
+            dftBufferLen = std::max(dftBufferLen, nComplex * 2);
         } else {
             hasFFT = true;
+            // the gathered data and the ping-pong buffer of the transform
+            fftBufferLen = std::max(fftBufferLen, nComplex * 4);
         }
     }
     if (mayiuse(cpu::x64::sse41)) {
         createJITKernels(hasDFT, hasFFT);
     }
+
+    // each thread takes its own FFT buffers, while the DFT is computed serially with the gathered data and the output buffers
+    buffersThreadsNum = parallel_get_max_threads();
+    reserveScratchBuffer(ScratchArena::alignedSize(buffersThreadsNum * fftBufferLen * sizeof(float)) +
+                         ScratchArena::alignedSize(2 * dftBufferLen * sizeof(float)));
 }
 
 std::vector<int32_t> DFT::getAxes() const {
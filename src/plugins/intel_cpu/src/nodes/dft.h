@@ -35,7 +35,9 @@ private:
                const VectorDims& outputShape,
                const VectorDims& outputStrides,
                const std::vector<int32_t>& axes,
-               bool inverse) const;
+               bool inverse,
+               float* fftBuffers,
+               float* dftBuffers) const;
 
     void fft(float* inBuffer,
              float* outBuffer,
@@ -43,7 +45,7 @@ private:
              bool inverse,
              bool parallelize,
              const float** resultBuf) const;
-    void naiveDFT(float* data, size_t dataLength, bool inverse) const;
+    void naiveDFT(float* data, size_t dataLength, bool inverse, float* outputBuffer) const;
 
     std::vector<float> generateTwiddlesDFT(size_t n_complex, bool inverse) const;
     void updateTwiddlesFFT(size_t n_complex, bool inverse);
@@ -55,6 +57,10 @@ private:
     std::unordered_map<size_t, std::vector<float>> twiddlesMapDFT;
 
     std::vector<int32_t> axes;
+    // the lengths (in floats) of the temporary buffers carved from the node scratch buffer
+    size_t fftBufferLen = 0;
+    size_t dftBufferLen = 0;
+    size_t buffersThreadsNum = 0;
     std::vector<size_t> inputShape;
     std::string layerErrorPrefix;
     const size_t DATA_INDEX = 0;
@@ -102,6 +102,13 @@ struct EltwiseEmitter<jit_power_static_emitter> {
     }
 };
 
+template<>
+struct EltwiseEmitter<jit_erf_emitter> {
+    void operator()(EltwiseEmitterContext & ctx) {
+        ctx.emitter = std::make_shared<jit_erf_emitter>(ctx.host, ctx.host_isa, ctx.exec_prc, ctx.opData.fastMath);
+    }
+};
+
 template<>
 struct EltwiseEmitter<jit_is_inf_emitter> {
     void operator()(EltwiseEmitterContext & ctx) {
@@ -1183,6 +1190,7 @@ struct EltwiseKey {
             seed = hash_combine(seed, eltwiseData.alpha);
             seed = hash_combine(seed, eltwiseData.beta);
             seed = hash_combine(seed, eltwiseData.gamma);
+            seed = hash_combine(seed, eltwiseData.fastMath);
             return seed;
         };
         std::for_each(eltwise_data.begin(), eltwise_data.end(), [&](const Eltwise::EltwiseData& item) {
@@ -1763,7 +1771,8 @@ bool Eltwise::EltwiseData::operator==(const EltwiseData &rhs) const noexcept {
            onednnAlgorithm == rhs.onednnAlgorithm &&
            alpha == rhs.alpha &&
            beta == rhs.beta &&
-           gamma == rhs.gamma;
+           gamma == rhs.gamma &&
+           fastMath == rhs.fastMath;
 }
 
 static Eltwise::executorPtr buildRefExecutor(const EltwiseKey& key) {
@@ -1827,6 +1836,8 @@ Eltwise::Eltwise(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CP
         IE_THROW(NotImplemented) << errorMessage;
     }
     initializers.at(op->get_type_info())(op, *this);
+    if (getAlgorithm() == Algorithm::EltwiseErf)
+        fastMath = context->getConfig().isFastMath("Erf");
 }
 
 size_t Eltwise::getOpInputsNum() const {
@@ -2291,7 +2302,7 @@ void Eltwise::prepareParams() {
     }
 
     if (!canSkipSearchInCache) {
-        EltwiseData thisOp{getAlgorithm(), getOneDnnAlgorithm(), getAlpha(), getBeta(), getGamma()};
+        EltwiseData thisOp{getAlgorithm(), getOneDnnAlgorithm(), getAlpha(), getBeta(), getGamma(), isFastMath()};
         EltwiseKey key = {{thisOp}, {getType()}, currentOutBlkDims, outOrder, dims_in, inpPrc, outPrc, dnnl::post_ops(), implType};
         fqDataPtrs.clear();
         for (const auto &node : fusedWith) {
@@ -2299,7 +2310,7 @@ void Eltwise::prepareParams() {
             if (node->getType() == Type::Eltwise) {
                 if (auto eltwise = std::dynamic_pointer_cast<Eltwise>(node)) {
                     key.eltwise_data.push_back({eltwise->getAlgorithm(), eltwise->getOneDnnAlgorithm(), eltwise->getAlpha(),
-                                                eltwise->getBeta(), eltwise->getGamma()});
+                                                eltwise->getBeta(), eltwise->getGamma(), eltwise->isFastMath()});
                 }
             } else if (node->getType() == Type::FakeQuantize) {
                 node->appendPostOps(key.postOps, {}, fqDataPtrs);
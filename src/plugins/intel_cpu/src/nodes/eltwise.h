@@ -87,6 +87,8 @@ public:
         float alpha;
         float beta;
         float gamma;
+        // the faster approximation of a lower accuracy is used
+        bool fastMath;
 
         bool operator==(const EltwiseData& rhs) const noexcept;
     };
@@ -121,6 +123,10 @@ public:
     float getAlpha() const { return alpha; }
     float getBeta() const { return beta; }
     float getGamma() const { return gamma; }
+    bool isFastMath() const { return fastMath; }
+    // the per-channel scales and shifts of the node fused as the scale-shift post-op, empty otherwise
+    const std::vector<float>& getScales() const { return scales; }
+    const std::vector<float>& getShifts() const { return shifts; }
 
     dnnl::algorithm getOneDnnAlgorithm() const { return onednnAlgorithm; }
 
@@ -172,6 +178,7 @@ private:
     float alpha = 0;
     float beta = 0;
     float gamma = 0;
+    bool fastMath = false;
 
     std::vector<float> scales = {};
     std::vector<float> shifts = {};
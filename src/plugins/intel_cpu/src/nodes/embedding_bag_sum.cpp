@@ -2,14 +2,21 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
+#include <type_traits>
 #include <dnnl_types.h>
 #include "ie_parallel.hpp"
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
+
+#if defined(OPENVINO_ARCH_X86_64)
+#include <xmmintrin.h>
+#endif
 
 using namespace InferenceEngine;
 
@@ -46,22 +53,99 @@ void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
     }
 }
 
+namespace {
+// the bf16 table rows are accumulated in fp32 and rounded once per bag
+template<typename T>
+struct EmbeddingAccumulator {
+    using type = T;
+};
+
+template<>
+struct EmbeddingAccumulator<bfloat16_t> {
+    using type = float;
+};
+
+// the number of the table rows which are prefetched ahead of the accumulated one
+constexpr size_t prefetchDistance = 4;
+constexpr size_t cacheLineSize = 64;
+
+inline void prefetchRow(const void* row, size_t rowSize) {
+#if defined(OPENVINO_ARCH_X86_64)
+    const char* ptr = reinterpret_cast<const char*>(row);
+    for (size_t offset = 0; offset < rowSize; offset += cacheLineSize) {
+        _mm_prefetch(ptr + offset, _MM_HINT_T0);
+    }
+#endif
+}
+
+template<typename T, typename A>
+inline void accumulateRow(A* dst, const T* src, size_t len, bool first, bool withWeight, A weight) {
+    if (withWeight) {
+        if (first) {
+            for (size_t i = 0lu; i < len; i++)
+                dst[i] = static_cast<A>(src[i]) * weight;
+        } else {
+            for (size_t i = 0lu; i < len; i++)
+                dst[i] += static_cast<A>(src[i]) * weight;
+        }
+    } else {
+        if (first) {
+            for (size_t i = 0lu; i < len; i++)
+                dst[i] = static_cast<A>(src[i]);
+        } else {
+            for (size_t i = 0lu; i < len; i++)
+                dst[i] += static_cast<A>(src[i]);
+        }
+    }
+}
+}   // namespace
+
+std::vector<size_t> EmbeddingBagSum::splitBagsByIndices(size_t bagsNum, size_t chunksNum) {
+    // the bag sizes may differ by orders of magnitude, so the bags are distributed by the indices number
+    // (plus one for the output row store) rather than by the bags number
+    std::vector<size_t> bagsCost(bagsNum + 1, 0lu);
+    const int* indices = nullptr;
+    size_t indicesSize = 0lu;
+    int weightsIdx = 0;
+    bool withWeights = _withWeights;
+    for (size_t obi = 0lu; obi < bagsNum; obi++) {
+        getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+        bagsCost[obi + 1] = bagsCost[obi] + (indices != nullptr ? indicesSize : 0lu) + 1lu;
+    }
+
+    std::vector<size_t> bounds(chunksNum + 1, bagsNum);
+    bounds[0] = 0lu;
+    for (size_t chunk = 1lu; chunk < chunksNum; chunk++) {
+        const size_t cost = bagsCost.back() * chunk / chunksNum;
+        bounds[chunk] = std::lower_bound(bagsCost.begin() + bounds[chunk - 1], bagsCost.end(), cost) - bagsCost.begin();
+        bounds[chunk] = std::min(bounds[chunk], bagsNum);
+    }
+    return bounds;
+}
+
 template<typename T>
 void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                                   const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
+    using AccT = typename EmbeddingAccumulator<T>::type;
+    constexpr bool separateAccumulator = !std::is_same<AccT, T>::value;
     std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
 
     initFromInputs();
 
     const size_t outputBagsNum = outMemory->getShape().getStaticDims()[0];
     auto *dstData = reinterpret_cast<T *>(outMemory->getData());
+    const size_t rowSize = _embDepth * sizeof(T);
 
-    auto threadBody = [&](const int ithr, const int nthr) {
-        size_t start(0lu), end(0lu);
-        splitter(outputBagsNum, nthr, ithr, start, end);
+    const size_t chunksNum = std::min(static_cast<size_t>(parallel_get_max_threads()), outputBagsNum);
+    const auto bounds = splitBagsByIndices(outputBagsNum, chunksNum);
+
+    parallel_for(chunksNum, [&](size_t chunk) {
+        const size_t start = bounds[chunk];
+        const size_t end = bounds[chunk + 1];
         if (start >= end)
             return;
 
+        std::vector<AccT> accBuffer(separateAccumulator ? _embDepth : 0lu);
         size_t indicesSize = 0lu;
         const int* indices = nullptr;
         int weightsIdx = 0lu;
@@ -73,39 +157,31 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
 
             if (indices != nullptr) {
                 withWeights = withWeights & _withWeights;
+                AccT* acc = separateAccumulator ? accBuffer.data() : reinterpret_cast<AccT*>(dstData + dstIndex);
 
-                size_t inIdx = 0lu;
-                if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
-                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
-                }
-                size_t srcIndex = indices[inIdx] * _embDepth;
-
-                if (withWeights) {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i] * weightsData[weightsIdx];
-                    }
-                    weightsIdx++;
-                } else {
-                    for (size_t i = 0lu; i < _embDepth; i++) {
-                        dstData[dstIndex + i] = srcData[srcIndex + i];
-                    }
+                for (size_t inIdx = 0lu; inIdx < std::min(prefetchDistance, indicesSize); inIdx++) {
+                    if (static_cast<size_t>(indices[inIdx]) < inDataDims[0])
+                        prefetchRow(srcData + indices[inIdx] * _embDepth, rowSize);
                 }
 
-                for (inIdx = 1lu; inIdx < indicesSize; inIdx++) {
+                for (size_t inIdx = 0lu; inIdx < indicesSize; inIdx++) {
                     if (static_cast<size_t>(indices[inIdx]) >= inDataDims[0]) {
                         IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
                     }
-                    size_t srcIndex = indices[inIdx] * _embDepth;
-
-                    if (withWeights) {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i] * weightsData[weightsIdx];
-                        }
+                    const size_t prefetchIdx = inIdx + prefetchDistance;
+                    if (prefetchIdx < indicesSize && static_cast<size_t>(indices[prefetchIdx]) < inDataDims[0])
+                        prefetchRow(srcData + indices[prefetchIdx] * _embDepth, rowSize);
+
+                    const size_t srcIndex = indices[inIdx] * _embDepth;
+                    accumulateRow(acc, srcData + srcIndex, _embDepth, inIdx == 0lu, withWeights,
+                                  withWeights ? static_cast<AccT>(weightsData[weightsIdx]) : AccT(0));
+                    if (withWeights)
                         weightsIdx++;
-                    } else {
-                        for (size_t i = 0lu; i < _embDepth; i++) {
-                            dstData[dstIndex + i] += srcData[srcIndex + i];
-                        }
+                }
+
+                if (separateAccumulator) {
+                    for (size_t i = 0lu; i < _embDepth; i++) {
+                        dstData[dstIndex + i] = static_cast<T>(acc[i]);
                     }
                 }
             } else {
@@ -114,9 +190,7 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
                 }
             }
         }
-    };
-
-    parallel_nt(0, threadBody);
+    });
 }
 
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
@@ -126,6 +200,10 @@ void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
                     reinterpret_cast<const float*>(weightsData), inDims, outMemory);
         }
+        case Precision::BF16: {
+            return processData<bfloat16_t>(reinterpret_cast<const bfloat16_t*>(srcData),
+                    reinterpret_cast<const bfloat16_t*>(weightsData), inDims, outMemory);
+        }
         case Precision::I8: {
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), inDims, outMemory);
@@ -38,6 +38,11 @@ protected:
             bool& withWeights) = 0;
 
     void prepareParams(const VectorDims& indexStaticShape);
+    /**
+     * @brief Splits the output bags into the contiguous chunks with the about equal total number of indices
+     * @return chunksNum + 1 chunk bounds
+     */
+    std::vector<size_t> splitBagsByIndices(size_t bagsNum, size_t chunksNum);
 
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
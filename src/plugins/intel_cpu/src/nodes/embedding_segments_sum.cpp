@@ -2,11 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <cmath>
 #include <vector>
 #include <string>
 #include "embedding_segments_sum.h"
 #include <ngraph/opsets/opset3.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
 
 using namespace InferenceEngine;
 
@@ -51,10 +53,10 @@ void EmbeddingSegmentsSum::initSupportedPrimitiveDescriptors() {
 
     std::string logPrefix = std::string("Layer EmbeddingBagSum with name '") + _layerName + "' ";
     static const std::set<Precision> supportedPrecisions =
-            {Precision::FP32, Precision::I8, Precision::U8, Precision::I32};
+            {Precision::FP32, Precision::BF16, Precision::I8, Precision::U8, Precision::I32};
 
     auto inDataPrecision = getOriginalInputPrecisionAtPort(EMB_TABLE_IDX);
-    if (inDataPrecision == Precision::BF16)
+    if (inDataPrecision == Precision::BF16 && !dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core))
         inDataPrecision = Precision::FP32;
     if (!supportedPrecisions.empty()) {
         if (supportedPrecisions.find(inDataPrecision) == supportedPrecisions.end())
@@ -102,14 +104,14 @@ void EmbeddingSegmentsSum::getIndices(size_t embIndex, const int*& indices, size
     size = 0;
     withWeight = true;
 
-    for (int si = 0; si < static_cast<int>(indicesSize_); si++) {
-        if (static_cast<size_t>(segmentIds_[si]) == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    // the segment ids are sorted, so the bag indices are contiguous
+    const int segmentId = static_cast<int>(embIndex);
+    const auto range = std::equal_range(segmentIds_, segmentIds_ + indicesSize_, segmentId);
+    if (range.first != range.second) {
+        const int si = static_cast<int>(range.first - segmentIds_);
+        size = range.second - range.first;
+        indices = indices_ + si;
+        weightsIdx = si;
     }
 
     // Empty bag
@@ -0,0 +1,162 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "acl_fullyconnected.hpp"
+#include "utils/precision_support.h"
+
+#include <algorithm>
+
+namespace ov {
+namespace intel_cpu {
+
+using namespace arm_compute;
+
+ACLFCTensorInfo getACLFCTensorInfo(const FCAttrs& fcAttrs,
+                                   const std::vector<MemoryDescPtr>& srcDescs,
+                                   const std::vector<MemoryDescPtr>& dstDescs) {
+    const auto& srcDims = srcDescs[0]->getShape().getStaticDims();
+    const auto& weiDims = srcDescs[1]->getShape().getStaticDims();
+    const auto& dstDims = dstDescs[0]->getShape().getStaticDims();
+    // the leading dimensions of the source and the destination are collapsed into M
+    const size_t K = srcDims.back();
+    const size_t M = vectorProduct(srcDims, srcDims.size() - 1);
+    const size_t N = weiDims[0];
+
+    // ACL expects the weights as [K, N] with transpose_weights disabled, they are prepacked by the node
+    TensorInfo srcTensorInfo = TensorInfo(shapeCast({M, K}), 1, precisionToAclDataType(srcDescs[0]->getPrecision()));
+    TensorInfo weiTensorInfo = TensorInfo(shapeCast({K, N}), 1, precisionToAclDataType(srcDescs[1]->getPrecision()));
+    TensorInfo dstTensorInfo = TensorInfo(shapeCast({vectorProduct(dstDims, dstDims.size() - 1), dstDims.back()}), 1,
+                                          precisionToAclDataType(dstDescs[0]->getPrecision()));
+    TensorInfo biasTensorInfo;
+    if (fcAttrs.withBiases) {
+        biasTensorInfo = TensorInfo(shapeCast({N}), 1, precisionToAclDataType(srcDescs[2]->getPrecision()));
+    }
+
+    return ACLFCTensorInfo{srcTensorInfo, weiTensorInfo, biasTensorInfo, dstTensorInfo};
+}
+
+FullyConnectedLayerInfo getACLFCLayerInfo() {
+    FullyConnectedLayerInfo fcInfo;
+    fcInfo.transpose_weights = false;
+    return fcInfo;
+}
+
+AclFCExecutor::AclFCExecutor(const ExecutorContext::CPtr context) : FCExecutor(context) {}
+
+bool AclFCExecutor::init(const FCAttrs& fcAttrs,
+                         const std::vector<MemoryDescPtr>& srcDescs,
+                         const std::vector<MemoryDescPtr>& dstDescs,
+                         const dnnl::primitive_attr &attr) {
+    this->fcAttrs = fcAttrs;
+    ACLFCTensorInfo aclFCTensorInfo = getACLFCTensorInfo(fcAttrs, srcDescs, dstDescs);
+
+    arm_compute::Status status = arm_compute::NEFullyConnectedLayer::validate(&aclFCTensorInfo.srcTensorInfo,
+                                                                              &aclFCTensorInfo.weiTensorInfo,
+                                                                              fcAttrs.withBiases ? &aclFCTensorInfo.biasTensorInfo : nullptr,
+                                                                              &aclFCTensorInfo.dstTensorInfo,
+                                                                              getACLFCLayerInfo());
+    if (!status) {
+        DEBUG_LOG("NEFullyConnectedLayer validation failed: ", status.error_description());
+        return false;
+    }
+
+    srcTensor.allocator()->init(aclFCTensorInfo.srcTensorInfo);
+    weiTensor.allocator()->init(aclFCTensorInfo.weiTensorInfo);
+    dstTensor.allocator()->init(aclFCTensorInfo.dstTensorInfo);
+    if (fcAttrs.withBiases)
+        biasTensor.allocator()->init(aclFCTensorInfo.biasTensorInfo);
+
+    fc = std::make_unique<arm_compute::NEFullyConnectedLayer>();
+    fc->configure(&srcTensor, &weiTensor, fcAttrs.withBiases ? &biasTensor : nullptr, &dstTensor, getACLFCLayerInfo());
+    return true;
+}
+
+void AclFCExecutor::exec(const std::vector<MemoryCPtr>& src, const std::vector<MemoryPtr>& dst, const void *post_ops_data_) {
+    srcTensor.allocator()->import_memory(src[0]->getData());
+    weiTensor.allocator()->import_memory(src[1]->getData());
+    dstTensor.allocator()->import_memory(dst[0]->getData());
+    if (fcAttrs.withBiases)
+        biasTensor.allocator()->import_memory(src[2]->getData());
+    // the first run also prepares the GEMM of ACL for the weights, the next runs reuse it
+    fc->run();
+
+    srcTensor.allocator()->free();
+    weiTensor.allocator()->free();
+    dstTensor.allocator()->free();
+    if (fcAttrs.withBiases)
+        biasTensor.allocator()->free();
+}
+
+bool AclFCExecutorBuilder::customIsSupported(const FCAttrs& fcAttrs,
+                                             const std::vector<MemoryDescPtr>& srcDescs,
+                                             const std::vector<MemoryDescPtr>& dstDescs) {
+    if (!one_of(srcDescs[0]->getShape().getRank(), 2u, 3u) || srcDescs[1]->getShape().getRank() != 2 ||
+        dstDescs[0]->getShape().getRank() != srcDescs[0]->getShape().getRank()) {
+        DEBUG_LOG("AclFCExecutor does not support dimension:",
+                  " src[0]=", srcDescs[0]->getShape().getRank(),
+                  " src[1]=", srcDescs[1]->getShape().getRank(),
+                  " dst[0]=", dstDescs[0]->getShape().getRank());
+        return false;
+    }
+
+    const auto precision = srcDescs[0]->getPrecision();
+    // fp16 arithmetic requires ARMv8.2 with FP16 vector instructions
+    if (!(one_of(precision, InferenceEngine::Precision::FP32, InferenceEngine::Precision::FP16) &&
+          hasHardwareSupport(precision) &&
+          srcDescs[1]->getPrecision() == precision &&
+          dstDescs[0]->getPrecision() == precision &&
+          (!fcAttrs.withBiases || srcDescs[2]->getPrecision() == precision))) {
+        DEBUG_LOG("AclFCExecutor does not support precisions:",
+                  " src[0]=", srcDescs[0]->getPrecision(),
+                  " src[1]=", srcDescs[1]->getPrecision(),
+                  " dst[0]=", dstDescs[0]->getPrecision());
+        return false;
+    }
+
+    for (const auto& desc : srcDescs) {
+        if (!desc->hasLayoutType(LayoutType::ncsp)) {
+            DEBUG_LOG("AclFCExecutor does not support layout: ", desc->serializeFormat());
+            return false;
+        }
+    }
+    if (!dstDescs[0]->hasLayoutType(LayoutType::ncsp)) {
+        DEBUG_LOG("AclFCExecutor does not support layout: ", dstDescs[0]->serializeFormat());
+        return false;
+    }
+
+    if (fcAttrs.withBiases) {
+        const auto& biasDims = srcDescs[2]->getShape().getDims();
+        const auto N = srcDescs[1]->getShape().getDims()[0];
+        bool isByChannel = biasDims.back() == N;
+        for (size_t i = 0; i < biasDims.size() - 1; i++) {
+            isByChannel = isByChannel && biasDims[i] == 1;
+        }
+        if (!isByChannel) {
+            DEBUG_LOG("AclFCExecutor supports per-channel bias only");
+            return false;
+        }
+    }
+
+    // the dynamic shapes are validated by init() when the executor is created for the actual shapes
+    const auto isStatic = [](const MemoryDescPtr& desc) { return desc->isDefined(); };
+    if (!std::all_of(srcDescs.begin(), srcDescs.end(), isStatic) || !dstDescs[0]->isDefined()) {
+        return true;
+    }
+
+    ACLFCTensorInfo aclFCTensorInfo = getACLFCTensorInfo(fcAttrs, srcDescs, dstDescs);
+    arm_compute::Status status = arm_compute::NEFullyConnectedLayer::validate(&aclFCTensorInfo.srcTensorInfo,
+                                                                              &aclFCTensorInfo.weiTensorInfo,
+                                                                              fcAttrs.withBiases ? &aclFCTensorInfo.biasTensorInfo : nullptr,
+                                                                              &aclFCTensorInfo.dstTensorInfo,
+                                                                              getACLFCLayerInfo());
+    if (!status) {
+        DEBUG_LOG("NEFullyConnectedLayer validation failed: ", status.error_description());
+        return false;
+    }
+
+    return true;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,72 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "nodes/executors/fullyconnected.hpp"
+#include "arm_compute/runtime/NEON/NEFunctions.h"
+#include "utils/debug_capabilities.h"
+#include "acl_utils.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+struct ACLFCTensorInfo {
+    arm_compute::TensorInfo srcTensorInfo;
+    arm_compute::TensorInfo weiTensorInfo;
+    arm_compute::TensorInfo biasTensorInfo;
+    arm_compute::TensorInfo dstTensorInfo;
+};
+
+ACLFCTensorInfo getACLFCTensorInfo(const FCAttrs& fcAttrs,
+                                   const std::vector<MemoryDescPtr>& srcDescs,
+                                   const std::vector<MemoryDescPtr>& dstDescs);
+
+arm_compute::FullyConnectedLayerInfo getACLFCLayerInfo();
+
+class AclFCExecutor : public FCExecutor {
+public:
+    explicit AclFCExecutor(const ExecutorContext::CPtr context);
+    bool init(const FCAttrs& fcAttrs,
+              const std::vector<MemoryDescPtr>& srcDescs,
+              const std::vector<MemoryDescPtr>& dstDescs,
+              const dnnl::primitive_attr &attr) override;
+    void exec(const std::vector<MemoryCPtr>& src,
+              const std::vector<MemoryPtr>& dst,
+              const void *post_ops_data_) override;
+
+    impl_desc_type getImplType() const override {
+        return implType;
+    }
+
+private:
+    FCAttrs fcAttrs;
+    impl_desc_type implType = impl_desc_type::gemm_acl;
+
+    arm_compute::Tensor srcTensor;
+    arm_compute::Tensor weiTensor;
+    arm_compute::Tensor biasTensor;
+    arm_compute::Tensor dstTensor;
+    std::unique_ptr<arm_compute::NEFullyConnectedLayer> fc = nullptr;
+};
+
+class AclFCExecutorBuilder : public FCExecutorBuilder {
+public:
+    static bool customIsSupported(const FCAttrs& fcAttrs,
+                                  const std::vector<MemoryDescPtr>& srcDescs,
+                                  const std::vector<MemoryDescPtr>& dstDescs);
+
+    bool isSupported(const FCAttrs& fcAttrs,
+                     const std::vector<MemoryDescPtr>& srcDescs,
+                     const std::vector<MemoryDescPtr>& dstDescs) const override {
+        return customIsSupported(fcAttrs, srcDescs, dstDescs);
+    }
+
+    FCExecutorPtr makeExecutor(const ExecutorContext::CPtr context) const override {
+        return std::make_shared<AclFCExecutor>(context);
+    }
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
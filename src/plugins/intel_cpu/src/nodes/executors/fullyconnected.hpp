@@ -0,0 +1,59 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "cpu_memory.h"
+#include "onednn/iml_type_mapper.h"
+#include "executor.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+struct FCAttrs {
+    bool withBiases = false;
+};
+
+/**
+ * @brief The executor of FullyConnected computing dst[M, N] = src[M, K] * weights[N, K]^T + bias[N],
+ * the leading dimensions of the source and the destination are collapsed into M.
+ * The weights are passed to exec() transposed to [K, N], the node prepacks them once into the weights cache.
+ */
+class FCExecutor {
+public:
+    explicit FCExecutor(const ExecutorContext::CPtr context) : context(context) {}
+
+    virtual bool init(const FCAttrs& fcAttrs,
+                      const std::vector<MemoryDescPtr>& srcDescs,
+                      const std::vector<MemoryDescPtr>& dstDescs,
+                      const dnnl::primitive_attr &attr) = 0;
+
+    virtual void exec(const std::vector<MemoryCPtr>& src,
+                      const std::vector<MemoryPtr>& dst,
+                      const void *post_ops_data_) = 0;
+    virtual ~FCExecutor() = default;
+    virtual impl_desc_type getImplType() const = 0;
+
+protected:
+    FCAttrs fcAttrs;
+    ExecutorContext::CPtr context;
+};
+
+using FCExecutorPtr = std::shared_ptr<FCExecutor>;
+using FCExecutorCPtr = std::shared_ptr<const FCExecutor>;
+
+class FCExecutorBuilder {
+public:
+    ~FCExecutorBuilder() = default;
+    virtual bool isSupported(const FCAttrs& fcAttrs,
+                             const std::vector<MemoryDescPtr>& srcDescs,
+                             const std::vector<MemoryDescPtr>& dstDescs) const = 0;
+    virtual FCExecutorPtr makeExecutor(const ExecutorContext::CPtr context) const = 0;
+};
+
+using FCExecutorBuilderPtr = std::shared_ptr<FCExecutorBuilder>;
+using FCExecutorBuilderCPtr = std::shared_ptr<const FCExecutorBuilder>;
+
+}   // namespace intel_cpu
+}   // namespace ov
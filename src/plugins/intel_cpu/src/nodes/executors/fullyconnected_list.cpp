@@ -0,0 +1,19 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "fullyconnected_list.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+const std::vector<FCExecutorDesc>& getFCExecutorsList() {
+    static std::vector<FCExecutorDesc> descs = {
+            OV_CPU_INSTANCE_ACL(ExecutorType::Acl, std::make_shared<AclFCExecutorBuilder>())
+    };
+
+    return descs;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,79 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "executor.hpp"
+
+#include "fullyconnected.hpp"
+#if defined(OV_CPU_WITH_ACL)
+#include "acl/acl_fullyconnected.hpp"
+#endif
+
+#include "onednn/iml_type_mapper.h"
+#include "common/primitive_cache.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+struct FCExecutorDesc {
+    ExecutorType executorType;
+    FCExecutorBuilderCPtr builder;
+};
+
+const std::vector<FCExecutorDesc>& getFCExecutorsList();
+
+class FCExecutorFactory : public ExecutorFactory {
+public:
+    FCExecutorFactory(const FCAttrs& fcAttrs,
+                      const std::vector<MemoryDescPtr>& srcDescs,
+                      const std::vector<MemoryDescPtr>& dstDescs,
+                      const ExecutorContext::CPtr context) : ExecutorFactory(context) {
+        for (auto& desc : getFCExecutorsList()) {
+            if (desc.builder->isSupported(fcAttrs, srcDescs, dstDescs)) {
+                supportedDescs.push_back(desc);
+            }
+        }
+    }
+
+    ~FCExecutorFactory() = default;
+    virtual FCExecutorPtr makeExecutor(const FCAttrs& fcAttrs,
+                                       const std::vector<MemoryDescPtr>& srcDescs,
+                                       const std::vector<MemoryDescPtr>& dstDescs,
+                                       const dnnl::primitive_attr &attr) {
+        auto build = [&](const FCExecutorDesc* desc) {
+            auto executor = desc->builder->makeExecutor(context);
+            if (executor->init(fcAttrs, srcDescs, dstDescs, attr)) {
+                return executor;
+            }
+            FCExecutorPtr ptr = nullptr;
+            return ptr;
+        };
+
+        if (chosenDesc) {
+            if (auto executor = build(chosenDesc)) {
+                return executor;
+            }
+        }
+
+        for (const auto& sd : supportedDescs) {
+            if (auto executor = build(&sd)) {
+                chosenDesc = &sd;
+                return executor;
+            }
+        }
+
+        IE_THROW() << "FCExecutorFactory: Supported executor is not found";
+    }
+
+private:
+    std::vector<FCExecutorDesc> supportedDescs;
+    const FCExecutorDesc* chosenDesc = nullptr;
+};
+
+using FCExecutorFactoryPtr = std::shared_ptr<FCExecutorFactory>;
+using FCExecutorFactoryCPtr = std::shared_ptr<const FCExecutorFactory>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -28,13 +28,20 @@
 #include "common/cpu_convert.h"
 #include "shape_inference/custom/fullyconnected.hpp"
 
+#include <cstring>
+#include <numeric>
 #include <string>
 #include <vector>
 
 #ifdef OV_CPU_WITH_MLAS
+#include "mlas/qgemm.hpp"
 #include "mlas/sgemm.hpp"
 #endif
 
+#if defined(OPENVINO_ARCH_X86_64)
+#include "kernels/x64/sparse_fc_kernel.hpp"
+#endif
+
 using namespace dnnl;
 using namespace InferenceEngine;
 
@@ -43,6 +50,17 @@ namespace intel_cpu {
 namespace node {
 namespace {
 
+template <typename T>
+float getSparseRate(const T* data, size_t size) {
+    size_t zerosCount = 0;
+    for (size_t i = 0; i < size; i++) {
+        if (data[i] == static_cast<T>(0)) {
+            zerosCount++;
+        }
+    }
+    return static_cast<float>(zerosCount) / static_cast<float>(size);
+}
+
 struct FCKey {
     DnnlMemoryDescCPtr inp0;
     DnnlMemoryDescCPtr inp1;
@@ -203,9 +221,10 @@ void FullyConnected::getSupportedDescriptors() {
     withBiases = getOriginalInputsNumber() == 3;
 
     useSparseWeights = useSparseWeightsDecompression();
+    useSparseWeightsJit = canUseSparseWeightsJit();
     useWeightsDecompressionImpl = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2) &&
                                   one_of(inputDataType, memory::data_type::f32, memory::data_type::bf16) &&
-                                  weightsDataType == memory::data_type::u8;
+                                  one_of(weightsDataType, memory::data_type::u8, memory::data_type::u4, memory::data_type::s4);
 
     // revert back outputDataType on special cases
     if (inputDataType == memory::data_type::f32) {
@@ -246,7 +265,7 @@ void FullyConnected::getSupportedDescriptors() {
 #if defined(OV_CPU_WITH_MLAS) && (defined(OPENVINO_ARCH_X86) || defined(OPENVINO_ARCH_X86_64))
     // MLAS doesn't support post-ops fusing and only supports FP32. INT8 is not enabled yet
     // Disable MLAS when FC could fuse post-ops
-    useMlas = !useSparseWeights && !useWeightsDecompressionImpl &&
+    useMlas = !useSparseWeights && !useSparseWeightsJit && !useWeightsDecompressionImpl &&
               (inputDataType == memory::data_type::f32 && weightsDataType == memory::data_type::f32) &&
               fusedWith.empty();
     auto wgtDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
@@ -267,15 +286,25 @@ void FullyConnected::getSupportedDescriptors() {
         useMlas = useMlas && isByChannel;
     }
 #endif
+#ifdef OV_CPU_WITH_MLAS
+    useMlasInt8 = !useMlas && !useSparseWeightsJit && canUseMlasInt8();
+#endif
 #ifdef CPU_DEBUG_CAPS
     // Select Sgemm type by ENV MLAS/ONEDNN, MLAS is used by default
     if (getenv("OV_CPU_FC_EXEC_TYPE")) {
         if (std::string(getenv("OV_CPU_FC_EXEC_TYPE")) != "MLAS") {
             useMlas = false;
+            useMlasInt8 = false;
         }
     }
 #endif
-    if (useMlas) return;
+#if defined(OV_CPU_WITH_ACL)
+    // ACL doesn't support post-ops fusing yet
+    fcAttrs.withBiases = withBiases;
+    useACL = !useMlas && !useMlasInt8 && !useSparseWeightsJit && fusedWith.empty() && !weightsNonTransposed &&
+             AclFCExecutorBuilder::customIsSupported(fcAttrs, getExecutorSrcDescs(), getExecutorDstDescs());
+#endif
+    if (useMlas || useSparseWeightsJit || useACL) return;
 
     for (auto format : getAvailableFormatsForDims(getInputShapeAtPort(0))) {
         auto in_candidate = dnnl::memory::desc(DnnlExtensionUtils::convertToDnnlDims(inDims), inputDataType, format);
@@ -306,8 +335,15 @@ void FullyConnected::prepackMLASWeight() {
             return _ptr;
         };
 
+        auto sharedWeightCache = context->getSharedWeightsCache();
         auto weightCache = context->getWeightsCache();
-        if (weightCache != nullptr) {
+        if (sharedWeightCache != nullptr) {
+            const std::string string_hash = "gemm_mlas_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                                            (weightsNonTransposed ? "F" : "T") + "_" + std::to_string(weightsMem->getSize()) +
+                                            "_" + std::to_string(sharedWeightCache->getContentHash(weightsMem));
+
+            ptr = *sharedWeightCache->findOrCreate(string_hash, create);
+        } else if (weightCache != nullptr) {
             std::string format = "gemm_mlas_" + std::to_string(N) + "_" + std::to_string(K);
             const std::string string_hash = getName() + "_" + format + "_" + std::to_string(weightsMem->getSize()) +
                                             "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMem->getData()));
@@ -329,7 +365,79 @@ void FullyConnected::prepackMLASWeight() {
 }
 #endif
 
+std::vector<MemoryDescPtr> FullyConnected::getExecutorSrcDescs() const {
+    // the executors expect the same precision of all the inputs and the output
+    const auto precision = getOriginalInputPrecisionAtPort(DATA_ID);
+    std::vector<MemoryDescPtr> srcDescs;
+    for (size_t i = 0; i < getOriginalInputsNumber(); i++) {
+        srcDescs.push_back(std::make_shared<CpuBlockedMemoryDesc>(precision, getInputShapeAtPort(i)));
+    }
+    return srcDescs;
+}
+
+std::vector<MemoryDescPtr> FullyConnected::getExecutorDstDescs() const {
+    return {std::make_shared<CpuBlockedMemoryDesc>(getOriginalInputPrecisionAtPort(DATA_ID), getOutputShapeAtPort(0))};
+}
+
+void FullyConnected::prepackExecutorWeight() {
+    if (!getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant())
+        IE_THROW() << "Weight input is not const for node " << getName() << ".";
+    auto weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weightsMem)
+        IE_THROW() << "Cannot get const weights edgeMem for node " << getName() << ".";
+
+    const auto& wgtDims = weightsMem->getStaticDims();
+    N = wgtDims[0];
+    K = wgtDims[1];
+
+    // the executors take the weights transposed to [K, N], so the transposition is done once for all the streams
+    auto create = [&]() {
+        const auto precision = weightsMem->getDesc().getPrecision();
+        const size_t elementSize = precision.size();
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine(),
+                                                  intel_cpu::CpuBlockedMemoryDesc(precision, intel_cpu::Shape(VectorDims{
+                                                      static_cast<size_t>(K), static_cast<size_t>(N)})));
+        const auto src = reinterpret_cast<const uint8_t*>(weightsMem->getData());
+        auto dst = reinterpret_cast<uint8_t*>(_ptr->getData());
+        parallel_for(N, [&](int64_t n) {
+            for (int64_t k = 0; k < K; k++) {
+                std::memcpy(dst + (k * N + n) * elementSize, src + (n * K + k) * elementSize, elementSize);
+            }
+        });
+        return _ptr;
+    };
+
+    const std::string format = "fc_executor_" + std::to_string(N) + "_" + std::to_string(K);
+    auto sharedWeightCache = context->getSharedWeightsCache();
+    auto weightCache = context->getWeightsCache();
+    if (sharedWeightCache != nullptr) {
+        const std::string string_hash = format + "_" + std::to_string(weightsMem->getSize()) +
+                                        "_" + std::to_string(sharedWeightCache->getContentHash(weightsMem));
+        packedWeightsPtr = *sharedWeightCache->findOrCreate(string_hash, create);
+    } else if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_" + format + "_" + std::to_string(weightsMem->getSize()) +
+                                        "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMem->getData()));
+        packedWeightsPtr = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        packedWeightsPtr = create();
+    }
+}
+
+void FullyConnected::executeExecutor() {
+    std::vector<MemoryCPtr> srcMemory = {getParentEdgeAt(DATA_ID)->getMemoryPtr(), packedWeightsPtr};
+    if (withBiases) {
+        srcMemory.push_back(getParentEdgeAt(BIAS_ID)->getMemoryPtr());
+    }
+    std::vector<MemoryPtr> dstMemory = {getChildEdgeAt(0)->getMemoryPtr()};
+    execPtrFC->exec(srcMemory, dstMemory, nullptr);
+}
+
 void FullyConnected::createPrimitive() {
+    if (useSparseWeightsJit) {
+        Node::createPrimitive();
+        prepackSparseWeights();
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     if (useMlas) {
         Node::createPrimitive();
@@ -337,6 +445,11 @@ void FullyConnected::createPrimitive() {
         return;
     }
 #endif
+    if (useACL) {
+        Node::createPrimitive();
+        prepackExecutorWeight();
+        return;
+    }
     setPostOps(attr, outDims);
     attr.set_scratchpad_mode(dnnl::scratchpad_mode::user);
     Node::createPrimitive();
@@ -360,6 +473,21 @@ void FullyConnected::prepareParams() {
     NodeDesc *selected_pd = getSelectedPrimitiveDescriptor();
     if (selected_pd == nullptr)
         IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
+    if (useSparseWeightsJit) {
+        outDims = dstMemPtr->getStaticDims();
+        M = std::accumulate(outDims.begin(), outDims.end() - 1, 1, std::multiplies<size_t>());
+        return;
+    }
+    if (useACL) {
+        std::vector<MemoryDescPtr> srcDescs;
+        for (size_t i = 0; i < getOriginalInputsNumber(); i++) {
+            srcDescs.push_back(getParentEdgesAtPort(i)[0]->getMemory().getDescPtr());
+        }
+        std::vector<MemoryDescPtr> dstDescs = {dstMemPtr->getDescPtr()};
+        execPtrFC = selected_pd->getExecutorFactoryAs<FCExecutorFactory>()->makeExecutor(fcAttrs, srcDescs, dstDescs, attr);
+        selected_pd->setImplementationType(execPtrFC->getImplType());
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     // M should be normalized and updated
     if (useMlas) {
@@ -371,6 +499,20 @@ void FullyConnected::prepareParams() {
         }
         return;
     }
+    // the small M is computed by MLAS, the bigger one by the oneDNN inner product prepared as usual
+    if (useMlasInt8) {
+        const auto& dstDims = dstMemPtr->getStaticDims();
+        M = std::accumulate(dstDims.begin(), dstDims.end() - 1, 1, std::multiplies<size_t>());
+        mlasInt8ForShape = M <= mlasInt8MaxM &&
+                           srcMemPtr->getDescWithType<BlockedMemoryDesc>()->hasLayoutType(LayoutType::ncsp) &&
+                           dstMemPtr->getDescWithType<BlockedMemoryDesc>()->hasLayoutType(LayoutType::ncsp);
+        if (mlasInt8ForShape) {
+            prepareMLASInt8();
+            mlasInt8Accumulator.resize(M * N);
+            selected_pd->setImplementationType(impl_desc_type::gemm_mlas);
+            return;
+        }
+    }
 #endif
     DnnlMemoryDescPtr weightDesc = MemoryDescUtils::convertToDnnlMemoryDesc(weightDescIP);
     DnnlMemoryDescCPtr biasDesc = nullptr;
@@ -529,15 +671,148 @@ void FullyConnected::executeMLAS() {
                        withBiases ? reinterpret_cast<float*>(biasMemPtr->getData()) : nullptr);
 }
 
+
+bool FullyConnected::canUseMlasInt8() const {
+#if defined(OPENVINO_ARCH_X86_64)
+    // the AMX kernels of oneDNN are faster for any M
+    if (dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx))
+        return false;
+#endif
+    if (!canBeExecutedInInt8() || useSparseWeights || weightsNonTransposed ||
+        outputDataType != memory::data_type::f32)
+        return false;
+    const auto& wgtDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    if (wgtDims.size() != 2)
+        return false;
+    if (withBiases) {
+        const auto& biasDims = getInputShapeAtPort(BIAS_ID).getStaticDims();
+        if (getOriginalInputPrecisionAtPort(BIAS_ID) != Precision::FP32 ||
+            std::accumulate(biasDims.begin(), biasDims.end(), size_t(1), std::multiplies<size_t>()) != wgtDims[0])
+            return false;
+    }
+    // the dequantization scales fused into the node are applied before the bias, as oneDNN does
+    if (!one_of(getDQScales().size(), 0u, 1u, wgtDims[0]))
+        return false;
+    // only the post-ops foldable into the per-channel scale and shift, e.g. the dequantization Multiply
+    for (const auto& node : fusedWith) {
+        const auto eltwise = std::dynamic_pointer_cast<Eltwise>(node);
+        if (!eltwise || eltwise->isSpecialConvolutionAddFusing() ||
+            (eltwise->getScales().empty() && eltwise->getShifts().empty()))
+            return false;
+        for (const auto& values : {eltwise->getScales(), eltwise->getShifts()}) {
+            if (!one_of(values.size(), 0u, 1u, wgtDims[0]))
+                return false;
+        }
+    }
+    const bool AIsSigned = getOriginalInputPrecisionAtPort(DATA_ID) == Precision::I8;
+    return mlas_qgemm_pack_get_size(wgtDims[0], wgtDims[1], AIsSigned) != 0;
+}
+
+void FullyConnected::prepareMLASInt8() {
+    if (mlasInt8PackedPtr)
+        return;
+    if (!getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant())
+        IE_THROW() << "Weight input is not const for node " << getName() << ".";
+    auto weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weightsMem)
+        IE_THROW() << "Cannot get const weights edgeMem for node " << getName() << ".";
+    const auto& wgtDims = weightsMem->getStaticDims();
+    N = wgtDims[0];
+    K = wgtDims[1];
+    const bool AIsSigned = getOriginalInputPrecisionAtPort(DATA_ID) == Precision::I8;
+
+    auto create = [&]() {
+        // QGEMM packs B given as [K, N] while the weights are [N, K]
+        const auto weightPtr = reinterpret_cast<const int8_t*>(weightsMem->getData());
+        std::vector<int8_t> transposed(N * K);
+        parallel_for(N, [&](int64_t n) {
+            for (int64_t k = 0; k < K; k++) {
+                transposed[k * N + n] = weightPtr[n * K + k];
+            }
+        });
+        const auto packedBsize = mlas_qgemm_pack_get_size(N, K, AIsSigned);
+        MemoryPtr _ptr =
+            std::make_shared<Memory>(getEngine(),
+                                     intel_cpu::CpuBlockedMemoryDesc(Precision::I8, intel_cpu::Shape{packedBsize}));
+        mlas_qgemm_pack(N, K, N, AIsSigned, transposed.data(), _ptr->getData());
+        return _ptr;
+    };
+
+    const std::string format = std::string("qgemm_mlas_") + (AIsSigned ? "s8_" : "u8_") + std::to_string(N) + "_" +
+                               std::to_string(K);
+    auto sharedWeightCache = context->getSharedWeightsCache();
+    auto weightCache = context->getWeightsCache();
+    if (sharedWeightCache != nullptr) {
+        const std::string string_hash = format + "_" + std::to_string(weightsMem->getSize()) +
+                                        "_" + std::to_string(sharedWeightCache->getContentHash(weightsMem));
+        mlasInt8PackedPtr = *sharedWeightCache->findOrCreate(string_hash, create);
+    } else if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_" + format + "_" + std::to_string(weightsMem->getSize()) +
+                                        "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMem->getData()));
+        mlasInt8PackedPtr = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        mlasInt8PackedPtr = create();
+    }
+
+    // y = (acc * dq_scale + bias) * scale + shift, the fused post-ops are folded into the scale and the shift
+    const auto& DQScales = getDQScales();
+    if (DQScales.size() == static_cast<size_t>(N))
+        mlasInt8DQScales = DQScales;
+    else
+        mlasInt8DQScales.assign(N, DQScales.size() == 1 ? DQScales[0] : 1.f);
+    mlasInt8Scales.assign(N, 1.f);
+    mlasInt8Shifts.assign(N, 0.f);
+    for (const auto& node : fusedWith) {
+        const auto eltwise = std::dynamic_pointer_cast<Eltwise>(node);
+        const auto& scales = eltwise->getScales();
+        const auto& shifts = eltwise->getShifts();
+        for (int64_t n = 0; n < N; n++) {
+            const float scale = scales.empty() ? 1.f : scales[scales.size() == 1 ? 0 : n];
+            const float shift = shifts.empty() ? 0.f : shifts[shifts.size() == 1 ? 0 : n];
+            mlasInt8Scales[n] *= scale;
+            mlasInt8Shifts[n] = mlasInt8Shifts[n] * scale + shift;
+        }
+    }
+}
+
+void FullyConnected::executeMLASInt8() {
+    const auto src = getParentEdgeAt(DATA_ID)->getMemoryPtr()->getData();
+    auto dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->getData());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->getData())
+                                 : nullptr;
+    const bool AIsSigned = getOriginalInputPrecisionAtPort(DATA_ID) == Precision::I8;
+    mlas_qgemm_compute(M, N, K, src, K, AIsSigned, mlasInt8PackedPtr->getData(), mlasInt8Accumulator.data(), N);
+    // M is small, so the dequantization is cheap compared to the GEMM
+    for (int64_t m = 0; m < M; m++) {
+        const int32_t* acc = &mlasInt8Accumulator[m * N];
+        float* out = dst + m * N;
+        for (int64_t n = 0; n < N; n++) {
+            out[n] = (static_cast<float>(acc[n]) * mlasInt8DQScales[n] + (bias ? bias[n] : 0.f)) * mlasInt8Scales[n] +
+                     mlasInt8Shifts[n];
+        }
+    }
+}
 #endif
 
 void FullyConnected::execute(dnnl::stream strm) {
+    if (useSparseWeightsJit) {
+        executeSparseWeightsJit();
+        return;
+    }
 #ifdef OV_CPU_WITH_MLAS
     if (useMlas) {
         executeMLAS();
         return;
     }
+    if (mlasInt8ForShape) {
+        executeMLASInt8();
+        return;
+    }
 #endif
+    if (useACL) {
+        executeExecutor();
+        return;
+    }
     if (!execPtr) {
         IE_THROW() << "Can't execute FullyConnected node with name: " << getName() << ", because executor is not compiled";
     }
@@ -606,9 +881,9 @@ void FullyConnected::setPostOps(dnnl::primitive_attr& attr, const VectorDims& di
     bool withAMX = selected_pd->getImplementationType() & impl_desc_type::amx;
     int icBlock = withAMX ? 2 : 1;
     if (!decompressionMultiply.empty())
-        dnnlpoc.appendDecompressionScales(decompressionMultiply, icBlock);
+        dnnlpoc.appendDecompressionScales(decompressionMultiply, icBlock, decompressionGroupsNum);
     if (!decompressionSubtract.empty())
-        dnnlpoc.appendDecompressionZeroPoints(decompressionSubtract, icBlock);
+        dnnlpoc.appendDecompressionZeroPoints(decompressionSubtract, icBlock, decompressionGroupsNum);
 
     for (size_t i = 0; i < fusedWith.size(); ++i) {
         auto& node = fusedWith[i];
@@ -640,6 +915,8 @@ const std::vector<impl_desc_type>& FullyConnected::getDefaultImplPriority() {
         impl_desc_type::unknown,
         impl_desc_type::acl,
         impl_desc_type::brgemm_sparse_avx512_amx,
+        impl_desc_type::jit_avx512_sparse,
+        impl_desc_type::jit_avx2_sparse,
         impl_desc_type::brgemm_avx512_amx,
         impl_desc_type::brgemm_avx512,
         impl_desc_type::brgemm_avx2,
@@ -773,19 +1050,37 @@ void FullyConnected::createDescriptor(const std::vector<MemoryDescPtr> &inputDes
 void FullyConnected::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
-    if (useMlas) {
+    if (useACL) {
+        const auto srcDescs = getExecutorSrcDescs();
+        const auto dstDescs = getExecutorDstDescs();
+        NodeConfig config;
+        config.inConfs.resize(srcDescs.size());
+        for (size_t i = 0; i < srcDescs.size(); i++) {
+            config.inConfs[i].setMemDesc(srcDescs[i]);
+        }
+        config.outConfs.resize(dstDescs.size());
+        config.outConfs[0].setMemDesc(dstDescs[0]);
+
+        auto factory = std::make_shared<FCExecutorFactory>(fcAttrs, srcDescs, dstDescs,
+                                                           std::make_shared<ExecutorContext>(context, getImplPriority()));
+        supportedPrimitiveDescriptors.emplace_back(config, impl_desc_type::gemm_acl, factory);
+        return;
+    }
+    if (useMlas || useSparseWeightsJit) {
         auto dataPrecision = getOriginalInputPrecisionAtPort(0);
+        const auto implType = useMlas ? impl_desc_type::gemm_mlas :
+                              sparseBlock == 16 ? impl_desc_type::jit_avx512_sparse : impl_desc_type::jit_avx2_sparse;
         if (withBiases) {
             addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
                             {LayoutType::ncsp, dataPrecision},
                             {LayoutType::ncsp, dataPrecision}},
                             {{LayoutType::ncsp, dataPrecision}},
-                            impl_desc_type::gemm_mlas);
+                            implType);
         } else {
             addSupportedPrimDesc({{LayoutType::ncsp, dataPrecision},
                 {LayoutType::ncsp, dataPrecision}},
                 {{LayoutType::ncsp, dataPrecision}},
-                impl_desc_type::gemm_mlas);
+                implType);
         }
         return;
     }
@@ -1045,17 +1340,7 @@ bool FullyConnected::useSparseWeightsDecompression() {
 
     auto weightsData = reinterpret_cast<const int8_t*>(blb->getData());
     auto elementsCount = blb->getDescWithType<BlockedMemoryDesc>()->getPaddedElementsCount();
-    size_t zerosCounts = 0;
-    for (size_t i = 0; i < elementsCount; i++) {
-        if (weightsData[i] == 0) {
-            zerosCounts++;
-        }
-    }
-
-    DEBUG_LOG(getName(), ", elementsCount = ", elementsCount, ", zerosCounts = ",
-        zerosCounts, ", nnzCount = ", elementsCount - zerosCounts);
-
-    weiSparseRate = static_cast<float>(zerosCounts) / static_cast<float>(elementsCount);
+    weiSparseRate = getSparseRate(weightsData, elementsCount);
 
     DEBUG_LOG(getName(), " | sparse rate = ", weiSparseRate * 100, "%, min sparse rate = ",
         minSparseRate * 100, "%, use sparse weights = ", weiSparseRate >= minSparseRate);
@@ -1067,6 +1352,134 @@ bool FullyConnected::useSparseWeightsDecompression() {
     return true;
 }
 
+bool FullyConnected::canUseSparseWeightsJit() {
+#if defined(OPENVINO_ARCH_X86_64)
+    // minSparseRate == 1 means that sparse feature is switched off
+    if (minSparseRate == 1.f || useSparseWeights || weightsNonTransposed || !fusedWith.empty())
+        return false;
+
+    using namespace dnnl::impl::cpu::x64;
+    if (!mayiuse(avx2))
+        return false;
+    sparseBlock = mayiuse(avx512_core) ? jit_uni_sparse_fc_kernel_f32<avx512_core>::block : jit_uni_sparse_fc_kernel_f32<avx2>::block;
+
+    if (getOriginalInputPrecisionAtPort(DATA_ID) != Precision::FP32 || getOriginalInputPrecisionAtPort(WEIGHTS_ID) != Precision::FP32 ||
+        getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+        return false;
+
+    const auto& weiDims = getInputShapeAtPort(WEIGHTS_ID).getStaticDims();
+    if (weiDims.size() != 2 || weiDims[0] % sparseBlock != 0 || !one_of(getInputShapeAtPort(DATA_ID).getRank(), 2u, 3u))
+        return false;
+
+    if (withBiases) {
+        const auto& biasDims = getInputShapeAtPort(BIAS_ID).getStaticDims();
+        if (std::accumulate(biasDims.begin(), biasDims.end(), size_t(1), std::multiplies<size_t>()) != weiDims[0] ||
+            biasDims.back() != weiDims[0])
+            return false;
+    }
+
+    const auto constNode = std::dynamic_pointer_cast<Input>(getParentEdgeAt(WEIGHTS_ID)->getParent());
+    if (!constNode)
+        return false;
+    auto blb = constNode->getMemoryPtr();
+    if (blb == nullptr)
+        IE_THROW() << "Cannot get const blob for node " << getName() << ".";
+
+    weiSparseRate = getSparseRate(reinterpret_cast<const float*>(blb->getData()), blb->getShape().getElementsCount());
+
+    DEBUG_LOG(getName(), " | sparse rate = ", weiSparseRate * 100, "%, min sparse rate = ",
+        minSparseRate * 100, "%, use sparse weights jit = ", weiSparseRate >= minSparseRate);
+
+    return weiSparseRate >= minSparseRate;
+#else
+    return false;
+#endif
+}
+
+void FullyConnected::prepackSparseWeights() {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (!getParentEdgeAt(WEIGHTS_ID)->getParent()->isConstant())
+        IE_THROW() << "Weight input is not const for node " << getName() << ".";
+    auto weightsMem = getParentEdgeAt(WEIGHTS_ID)->getMemoryPtr();
+    if (!weightsMem)
+        IE_THROW() << "Cannot get const weights edgeMem for node " << getName() << ".";
+
+    const auto& wgtDims = weightsMem->getStaticDims();
+    N = wgtDims[0];
+    K = wgtDims[1];
+
+    auto create = [&]() {
+        const float* weightPtr = reinterpret_cast<const float*>(weightsMem->getData());
+        const size_t packedSize = SparseFCWeights::getPackedSize(weightPtr, N, K, sparseBlock);
+        MemoryPtr _ptr = std::make_shared<Memory>(getEngine(),
+                                                  intel_cpu::CpuBlockedMemoryDesc(Precision::U8, intel_cpu::Shape{packedSize}));
+        SparseFCWeights::pack(weightPtr, N, K, sparseBlock, reinterpret_cast<uint8_t*>(_ptr->getData()));
+        return _ptr;
+    };
+
+    const std::string format = "sparse_fc_" + std::to_string(N) + "_" + std::to_string(K) + "_" + std::to_string(sparseBlock);
+    auto sharedWeightCache = context->getSharedWeightsCache();
+    auto weightCache = context->getWeightsCache();
+    if (sharedWeightCache != nullptr) {
+        const std::string string_hash = format + "_" + std::to_string(weightsMem->getSize()) +
+                                        "_" + std::to_string(sharedWeightCache->getContentHash(weightsMem));
+        sparsePackedPtr = *sharedWeightCache->findOrCreate(string_hash, create);
+    } else if (weightCache != nullptr) {
+        const std::string string_hash = getName() + "_" + format + "_" + std::to_string(weightsMem->getSize()) +
+                                        "_" + std::to_string(reinterpret_cast<uint64_t>(weightsMem->getData()));
+        sparsePackedPtr = *weightCache->findOrCreate(string_hash, create);
+    } else {
+        sparsePackedPtr = create();
+    }
+
+    using namespace dnnl::impl::cpu::x64;
+    sparseKernels.clear();
+    for (size_t rows = 1; rows <= jit_uni_sparse_fc_kernel::max_rows; rows++) {
+        std::shared_ptr<jit_uni_sparse_fc_kernel> kernel;
+        if (sparseBlock == jit_uni_sparse_fc_kernel_f32<avx512_core>::block) {
+            kernel = std::make_shared<jit_uni_sparse_fc_kernel_f32<avx512_core>>(jit_sparse_fc_conf{rows});
+        } else {
+            kernel = std::make_shared<jit_uni_sparse_fc_kernel_f32<avx2>>(jit_sparse_fc_conf{rows});
+        }
+        kernel->create_ker();
+        sparseKernels.push_back(kernel);
+    }
+#endif
+}
+
+void FullyConnected::executeSparseWeightsJit() {
+#if defined(OPENVINO_ARCH_X86_64)
+    const auto src = reinterpret_cast<const float*>(getParentEdgeAt(DATA_ID)->getMemoryPtr()->getData());
+    const auto bias = withBiases ? reinterpret_cast<const float*>(getParentEdgeAt(BIAS_ID)->getMemoryPtr()->getData()) : nullptr;
+    auto dst = reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->getData());
+
+    const auto packed = reinterpret_cast<const uint8_t*>(sparsePackedPtr->getData());
+    const auto offsets = SparseFCWeights::valuesOffsets(packed);
+    const auto masks = SparseFCWeights::masks(packed, N, sparseBlock);
+    const auto values = SparseFCWeights::values(packed, N, K, sparseBlock);
+
+    const size_t maxRows = jit_uni_sparse_fc_kernel::max_rows;
+    const size_t blocksNum = N / sparseBlock;
+    const size_t rowBlocksNum = div_up(M, maxRows);
+    // the row blocks of the same weights block are neighbours in the work, so a thread reuses the decompressed block
+    parallel_for2d(blocksNum, rowBlocksNum, [&](size_t b, size_t rb) {
+        const size_t row = rb * maxRows;
+        const size_t rows = std::min(maxRows, static_cast<size_t>(M) - row);
+
+        jit_args_sparse_fc args;
+        args.src = src + row * K;
+        args.masks = masks + b * K;
+        args.values = values + offsets[b];
+        args.bias = bias ? bias + b * sparseBlock : nullptr;
+        args.dst = dst + row * N + b * sparseBlock;
+        args.src_stride = K * sizeof(float);
+        args.dst_stride = N * sizeof(float);
+        args.k = K;
+        (*sparseKernels[rows - 1])(&args);
+    });
+#endif
+}
+
 void FullyConnected::fuseDecompressionMultiply(const NodePtr& constData) {
     fuseDecompressionConstant(constData, decompressionMultiply);
 }
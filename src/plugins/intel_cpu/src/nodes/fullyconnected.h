@@ -11,9 +11,13 @@
 #include <string>
 #include <vector>
 #include "common/dnnl_executor.h"
+#include "executors/fullyconnected_list.hpp"
 
 namespace ov {
 namespace intel_cpu {
+
+struct jit_uni_sparse_fc_kernel;
+
 namespace node {
 
 class FullyConnected : public Node {
@@ -66,6 +70,11 @@ public:
     void fuseDecompressionSubtract(const NodePtr& constData);
     const std::vector<float>& getDecompressionSubtract() const { return decompressionSubtract; }
 
+    /**
+     * @brief Sets the number of the IC groups the decompression parameters are defined for, 1 means per OC parameters
+     */
+    void setDecompressionGroupsNum(size_t groupsNum) { decompressionGroupsNum = groupsNum; }
+
 private:
     void createDescriptorInternal(const dnnl::memory::desc &inputDesc,
                                   const dnnl::memory::desc &outputDesc);
@@ -109,18 +118,53 @@ private:
     float minSparseRate = 1.f;
     float weiSparseRate = 0.f;
     bool useSparseWeightsDecompression();
+    // f32 sparse weights decompressed on the fly by the jit kernels, is used when there is no AMX
+    bool useSparseWeightsJit = false;
+    size_t sparseBlock = 0;
+    MemoryPtr sparsePackedPtr = nullptr;
+    std::vector<std::shared_ptr<jit_uni_sparse_fc_kernel>> sparseKernels;
+    bool canUseSparseWeightsJit();
+    void prepackSparseWeights();
+    void executeSparseWeightsJit();
+
     VectorDims expectedBiasDims {};
     bool useMlas = false;
-#ifdef OV_CPU_WITH_MLAS
     int64_t M, N, K;
+#ifdef OV_CPU_WITH_MLAS
     MemoryPtr mlasPackedPtr = nullptr;
     void executeMLAS();
     void prepackMLASWeight();
 #endif
+    // u8/s8 FC with s8 weights is computed by MLAS QGEMM for the small M where the setup of oneDNN inner product
+    // dominates, the bias and the fused per-channel scales and shifts are applied to the s32 result
+    static constexpr int64_t mlasInt8MaxM = 4;
+    bool useMlasInt8 = false;
+    bool mlasInt8ForShape = false;
+#ifdef OV_CPU_WITH_MLAS
+    MemoryPtr mlasInt8PackedPtr = nullptr;
+    std::vector<float> mlasInt8DQScales;
+    std::vector<float> mlasInt8Scales;
+    std::vector<float> mlasInt8Shifts;
+    std::vector<int32_t> mlasInt8Accumulator;
+    bool canUseMlasInt8() const;
+    void prepareMLASInt8();
+    void executeMLASInt8();
+#endif
+
+    // the executors of the executor factory, the ACL one on ARM
+    bool useACL = false;
+    FCAttrs fcAttrs;
+    FCExecutorPtr execPtrFC = nullptr;
+    MemoryPtr packedWeightsPtr = nullptr;
+    std::vector<MemoryDescPtr> getExecutorSrcDescs() const;
+    std::vector<MemoryDescPtr> getExecutorDstDescs() const;
+    void prepackExecutorWeight();
+    void executeExecutor();
 
     bool useWeightsDecompressionImpl = false;
     std::vector<float> decompressionSubtract;
     std::vector<float> decompressionMultiply;
+    size_t decompressionGroupsNum = 1;
 
     // FC with transposed weights
     bool weightsNonTransposed = false;
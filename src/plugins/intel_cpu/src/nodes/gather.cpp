@@ -2,7 +2,10 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <limits>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "ie_parallel.hpp"
@@ -14,6 +17,10 @@
 #include <partitioned_mem_mgr.h>
 #include "shape_inference/custom/gather.hpp"
 
+#if defined(OPENVINO_ARCH_X86_64)
+#include <emmintrin.h>
+#endif
+
 using namespace InferenceEngine;
 using namespace dnnl::impl::cpu;
 
@@ -23,6 +30,35 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+namespace {
+// the rows shorter than several cache lines are gathered well enough by the common reference loop
+constexpr uint64_t largeRowMinBytes = 256;
+constexpr uint64_t largeRowsMinNum = 4096;
+// the output which can't stay in the caches anyway is written bypassing them
+constexpr uint64_t streamingStoreMinBytes = 8 * 1024 * 1024;
+constexpr size_t prefetchDistance = 4;
+constexpr size_t cacheLineSize = 64;
+constexpr uint64_t invalidSrcOffset = std::numeric_limits<uint64_t>::max();
+
+inline void prefetchRow(const uint8_t* src, size_t size) {
+#if defined(OPENVINO_ARCH_X86_64)
+    for (size_t i = 0; i < size; i += cacheLineSize)
+        _mm_prefetch(reinterpret_cast<const char*>(src + i), _MM_HINT_T0);
+#endif
+}
+
+inline void copyRow(uint8_t* dst, const uint8_t* src, size_t size, bool streaming) {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (streaming) {
+        for (size_t i = 0; i < size; i += sizeof(__m128i))
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + i), _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i)));
+        return;
+    }
+#endif
+    cpu_memcpy(dst, src, size);
+}
+}  // namespace
+
 bool Gather::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!one_of(op->get_type_info(),
@@ -370,7 +406,11 @@ void Gather::execute(dnnl::stream strm) {
         return;
     }
 #endif
-    execReference();
+    if (isLargeRowsCase()) {
+        execLargeRows();
+    } else {
+        execReference();
+    }
 }
 
 void Gather::executeDynamicImpl(dnnl::stream strm) {
@@ -435,7 +475,11 @@ void Gather::executeDynamicImpl(dnnl::stream strm) {
         return;
     }
 #endif
-    execReference();
+    if (isLargeRowsCase()) {
+        execLargeRows();
+    } else {
+        execReference();
+    }
 }
 
 void Gather::initShortParams(threadExecParams& p, const uint64_t start) {
@@ -537,6 +581,65 @@ void Gather::execReference() {
     });
 }
 
+bool Gather::isLargeRowsCase() const {
+    return batchDims == 0 && afterAxisSizeInBytes >= largeRowMinBytes && specIndicesSize >= largeRowsMinNum;
+}
+
+void Gather::execLargeRows() {
+    const int32_t* srcIndices = reinterpret_cast<const int32_t*>(getParentEdgeAt(GATHER_INDICES)->getMemoryPtr()->getData());
+    const uint8_t* srcData = reinterpret_cast<const uint8_t*>(getParentEdgeAt(GATHER_DATA)->getMemoryPtr()->getData());
+    uint8_t* dstData = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->getData());
+
+    bool streaming = false;
+#if defined(OPENVINO_ARCH_X86_64)
+    // all the destination rows are aligned if the first one is, as the row size is a multiple of the vector
+    streaming = afterAxisSizeInBytes % sizeof(__m128i) == 0 && reinterpret_cast<uintptr_t>(dstData) % sizeof(__m128i) == 0 &&
+                betweenBatchAndAxisSize * specIdxAndAfterAxSizeB >= streamingStoreMinBytes;
+#endif
+
+    // with batchDims == 0 the indices are shared by all the outer rows, so the work is split across the indices
+    parallel_nt(0, [&](const int ithr, const int nthr) {
+        uint64_t start = 0lu, end = 0lu;
+        splitter(specIndicesSize, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        // the repeated and the close indices are processed one after another, so the source rows are reused from the cache
+        std::vector<std::pair<uint64_t, uint64_t>> rows; // {src offset, dst offset}
+        rows.reserve(end - start);
+        for (uint64_t j = start; j < end; j++) {
+            int ii = srcIndices[j];
+            if (ii < 0) {
+                if (reverseIndexing)
+                    ii += axisDim;
+                else
+                    ii = axisDim;
+            }
+            const size_t idx = ii;
+            rows.emplace_back(idx < static_cast<size_t>(axisDim) ? afterAxisSizeInBytes * idx : invalidSrcOffset, afterAxisSizeInBytes * j);
+        }
+        std::sort(rows.begin(), rows.end());
+
+        for (size_t i = 0; i < betweenBatchAndAxisSize; i++) {
+            const uint8_t* src = srcData + axisAndAfterAxisSizeInBytes * i;
+            uint8_t* dst = dstData + specIdxAndAfterAxSizeB * i;
+            for (size_t r = 0; r < rows.size(); r++) {
+                if (rows[r].first == invalidSrcOffset) {
+                    memset(dst + rows[r].second, 0, afterAxisSizeInBytes);
+                    continue;
+                }
+                if (r + prefetchDistance < rows.size() && rows[r + prefetchDistance].first != invalidSrcOffset)
+                    prefetchRow(src + rows[r + prefetchDistance].first, afterAxisSizeInBytes);
+                copyRow(dst + rows[r].second, src + rows[r].first, afterAxisSizeInBytes, streaming);
+            }
+        }
+#if defined(OPENVINO_ARCH_X86_64)
+        if (streaming)
+            _mm_sfence();
+#endif
+    });
+}
+
 bool Gather::created() const {
     return getType() == Type::Gather;
 }
@@ -55,6 +55,9 @@ protected:
 private:
     void initShortParams(threadExecParams& p, uint64_t start);
     void execReference();
+    bool isLargeRowsCase() const;
+    // Gathers many long rows (e.g. the embedding table lookup), the rows of each thread are copied in the source order.
+    void execLargeRows();
 
     bool isDataShapeStat = false;
     bool isIdxShapeStat = false;
@@ -19,6 +19,7 @@
 #include "common/cpu_memcpy.h"
 #include "common/cpu_convert.h"
 #include "utils/cpu_utils.hpp"
+#include "utils/huge_pages.h"
 #include <cpu/x64/jit_generator.hpp>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "shape_inference/shape_inference_pass_through.hpp"
@@ -394,6 +395,8 @@ void Input::cloneBlobIfRequired() {
     // read_model scenario with directly loaded original model still can have subnormals
     } else if (isBlobAligned() && (!needFlushDenormalsToZero || !hasSubnormals()) && !isWA()) {
         memoryPtr = std::make_shared<Memory>(getEngine(), memDesc, constOp->get_data_ptr());
+        // the constant may be memory mapped from the IR file, so the pages can only be hinted
+        hugePagesAdvice.reset(new HugePagesAdvice(constOp->get_data_ptr(), constOp->get_byte_size()));
     } else {
         memoryPtr = std::const_pointer_cast<const IMemory>(cloneBlob());
     }
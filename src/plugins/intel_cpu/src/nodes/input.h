@@ -8,6 +8,7 @@
 #include <node.h>
 #include <ngraph/op/constant.hpp>
 #include <string>
+#include "utils/huge_pages.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -47,6 +48,8 @@ private:
 
 private:
     std::shared_ptr<ngraph::op::Constant> constOp;
+    // is released before the constant, whose memory it advises
+    std::unique_ptr<HugePagesAdvice> hugePagesAdvice;
     MemoryCPtr memoryPtr;
     MemoryDescPtr extMemDesc = nullptr;
     bool isMeanImage = false;
@@ -15,6 +15,8 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "common/bfloat16.hpp"
 #include "common/cpu_memcpy.h"
+#include <ie_parallel.hpp>
+#include <oneapi/dnnl/dnnl.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <cpu/x64/cpu_isa_traits.hpp>
 #include <cpu/x64/jit_generator.hpp>
@@ -215,19 +217,6 @@ void Interaction::initSupportedPrimitiveDescriptors() {
     addSupportedPrimDesc(inPortConfigs, outPortConfigs, impl_desc_type::ref_any);
 }
 
-static inline void cat(uint8_t* out,
-                       const std::vector<const uint8_t*>& in,
-                       const std::vector<uint32_t>& feature_sizes,
-                       int64_t bs,
-                       size_t elemSize) {
-    size_t offset = 0;
-    for (size_t j = 0; j < feature_sizes.size(); j++) {
-        cpu_memcpy(out + offset * elemSize, in[j] + bs * feature_sizes[j] * elemSize,
-            feature_sizes[j] * elemSize);
-        offset += feature_sizes[j];
-    }
-}
-
 static inline void flat_triangle(const uint8_t* in, uint8_t* out, size_t size, size_t elemSize) {
     size_t offset = 0;
     for (size_t i = 1; i < size; i++) {
@@ -237,24 +226,29 @@ static inline void flat_triangle(const uint8_t* in, uint8_t* out, size_t size, s
 }
 
 void Interaction::execRef(dnnl::stream strm) {
-    using namespace dnnl;
     uint8_t* outFeaturesPtr = reinterpret_cast<uint8_t*>(getChildEdgesAtPort(0)[0]->getMemoryPtr()->getData());
     std::vector<const uint8_t*> inputPtrs(inputSizes);
     for (uint32_t n = 0; n < inputSizes; n++) {
         auto inPtr = reinterpret_cast<const uint8_t*>(getParentEdgeAt(n)->getMemoryPtr()->getData());
         inputPtrs[n] = inPtr;
     }
-    std::unordered_map<int, memory> mem_ags{{DNNL_ARG_SRC, inputMemPtr->getPrimitive()},
-                                            {DNNL_ARG_WEIGHTS, inputMemPtr->getPrimitive()},
-                                            {DNNL_ARG_DST, outputMemPtr->getPrimitive()}};
-    float* scales = fqScales.empty() ? nullptr : fqScales.data();
-    for (int64_t start = 0; start < static_cast<int64_t>(batchSize); start++) {
-        cat(reinterpret_cast<uint8_t*>(inputMemPtr->getData()), inputPtrs, featureSizes, start, dataPrecision.size());
-        prim.execute(strm, mem_ags);
-        flat_triangle(reinterpret_cast<const uint8_t*>(outputMemPtr->getData()),
-                      reinterpret_cast<uint8_t*>(flatMemPtr->getData()),
+    const float* scales = fqScales.empty() ? nullptr : fqScales.data();
+    const size_t threadBufferSize = inputSizes * featureSize + inputSizes * inputSizes + interactFeatureSize;
+    // the samples are split between the threads, the feature matrix of a sample stays in the L1 of its thread
+    parallel_for(batchSize, [&](size_t start) {
+        float* features = interactBuffers.data() + parallel_get_thread_num() * threadBufferSize;
+        float* products = features + inputSizes * featureSize;
+        float* flatProducts = products + inputSizes * inputSizes;
+        for (size_t n = 0; n < inputSizes; n++) {
+            cpu_convert(inputPtrs[n] + start * featureSize * dataPrecision.size(), features + n * featureSize,
+                        dataPrecision, Precision::FP32, featureSize);
+        }
+        dnnl::sgemm('N', 'T', inputSizes, inputSizes, featureSize, 1.f, features, featureSize,
+                    features, featureSize, 0.f, products, inputSizes);
+        flat_triangle(reinterpret_cast<const uint8_t*>(products),
+                      reinterpret_cast<uint8_t*>(flatProducts),
                       inputSizes,
-                      dataPrecision.size());
+                      sizeof(float));
         // in1 dense feature
         // in2 flatted interaction features
         if (moveFeatureKernel) {
@@ -266,12 +260,12 @@ void Interaction::execRef(dnnl::stream strm) {
         }
         if (moveInteractKernel) {
             jit_move_scale_call_args interArgs;
-            interArgs.p_in = flatMemPtr->getData();
+            interArgs.p_in = flatProducts;
             interArgs.p_out = outFeaturesPtr + (start * outputFeaturesLen + featureSize) * outputDataType.size();
             interArgs.p_scales = scales;
             (*moveInteractKernel)(&interArgs);
         }
-    }
+    });
 }
 
 void Interaction::execute(dnnl::stream strm) {
@@ -283,34 +277,14 @@ bool Interaction::created() const {
 }
 
 void Interaction::prepareParams() {
-    using namespace dnnl;
     const auto& denseFeatureDims = getParentEdgeAt(0)->getMemory().getStaticDims();
     batchSize = denseFeatureDims[0];
     featureSize = denseFeatureDims[1];
     inputSizes = inputShapes.size();
     interactFeatureSize = inputSizes * (inputSizes - 1) / 2;
     outputFeaturesLen = interactFeatureSize + featureSize;
-    std::vector<int64_t> lhsShape({static_cast<int64_t>(inputSizes), static_cast<int64_t>(featureSize)});
-    std::vector<int64_t> lhsStride({static_cast<int64_t>(featureSize), 1});
-    std::vector<int64_t> rhsShape({static_cast<int64_t>(featureSize), static_cast<int64_t>(inputSizes)});
-    std::vector<int64_t> rhsStride({1, static_cast<int64_t>(featureSize)});
-    std::vector<int64_t> resShape({static_cast<int64_t>(inputSizes), static_cast<int64_t>(inputSizes)});
-    std::vector<int64_t> resStride({static_cast<int64_t>(inputSizes), 1});
-    auto dataType = DnnlExtensionUtils::IEPrecisionToDataType(dataPrecision);
-    auto src_md = memory::desc(lhsShape, dataType, lhsStride);
-    auto weights_md = memory::desc(rhsShape, dataType, rhsStride);
-    auto dst_md = memory::desc(resShape, dataType, resStride);
-    primitive_attr matmul_attr;
-    auto matmul_pd = matmul::primitive_desc(getEngine(), src_md, weights_md, dst_md, matmul_attr);
-    prim = matmul(matmul_pd);
-    featureSizes.assign(inputSizes, featureSize);
-    auto initMemoryPtr = [&](const InferenceEngine::Precision &prc, const intel_cpu::Shape& shape,
-        MemoryPtr& ptr) {
-        ptr = std::make_shared<Memory>(getEngine(), intel_cpu::DnnlBlockedMemoryDesc(prc, shape));
-    };
-    initMemoryPtr(dataPrecision, intel_cpu::Shape{inputSizes, featureSize}, inputMemPtr);
-    initMemoryPtr(dataPrecision, intel_cpu::Shape{inputShapes.size(), inputShapes.size()}, outputMemPtr);
-    initMemoryPtr(dataPrecision, intel_cpu::Shape{interactFeatureSize}, flatMemPtr);
+    interactBuffers.resize(parallel_get_max_threads() *
+                           (inputSizes * featureSize + inputSizes * inputSizes + interactFeatureSize));
 
     jit_move_scale_compile_params jcp;
     jcp.src_prc = dataPrecision;
@@ -319,8 +293,9 @@ void Interaction::prepareParams() {
     jcp.broadcast_scales = fqScales.size() == 1;
     jcp.input_size = featureSize;
 
+    // the products are accumulated in fp32
     jit_move_scale_compile_params interJcp;
-    interJcp.src_prc = dataPrecision;
+    interJcp.src_prc = Precision::FP32;
     interJcp.dst_prc = outputDataType;
     interJcp.with_scales = !fqScales.empty();
     interJcp.broadcast_scales = fqScales.size() == 1;
@@ -345,12 +320,6 @@ void Interaction::prepareParams() {
     } else {
         THROW_ERROR << "cannot create jit eltwise kernel";
     }
-#ifdef CPU_DEBUG_CAPS
-    if (prim) {
-        auto pd = prim.get_primitive_desc();
-        DEBUG_LOG("verbose##", getName(), "##", DnnlExtensionUtils::query_pd_info(pd), "\n");
-    }
-#endif
 }
 
 void Interaction::executeDynamicImpl(dnnl::stream strm) {
@@ -60,17 +60,13 @@ public:
 
 private:
     void execRef(dnnl::stream strm);
-    dnnl::primitive prim;
     size_t batchSize = 0;
     size_t featureSize = 0;
     size_t inputSizes = 0;
     size_t outputFeaturesLen = 0;
     size_t interactFeatureSize = 0;
     std::string errorPrefix;
-    MemoryPtr inputMemPtr;
-    MemoryPtr flatMemPtr;
-    MemoryPtr outputMemPtr;
-    std::vector<uint32_t> featureSizes;
+    std::vector<float> interactBuffers;
     InferenceEngine::Precision dataPrecision;
     InferenceEngine::Precision outputDataType;
     std::vector<float> fqScales;
@@ -1974,7 +1974,8 @@ Interpolate::Interpolate(const std::shared_ptr<ngraph::Node>& op, const GraphCon
 }
 
 void Interpolate::getSupportedDescriptors() {
-    if (getParentEdges().size() != 2 && getParentEdges().size() != 3 && getParentEdges().size() != 4)
+    const size_t inputsNum = getParentEdges().size() - (withSum ? 1 : 0);
+    if (inputsNum != 2 && inputsNum != 3 && inputsNum != 4)
         // v4: data, target_shape, scale, axis(optional).
         // v11: data, size_or_scale, axis(optional)
         IE_THROW() << errorPrefix << " has incorrect number of input edges";
@@ -2036,7 +2037,7 @@ void Interpolate::initSupportedPrimitiveDescriptors() {
         outputPrecision = fusedWith[fusedWith.size() - 1]->getOriginalOutputPrecisionAtPort(DATA_ID);
     }
 
-    if (!mayiuse(cpu::x64::sse41)) {
+    if (!mayiuse(cpu::x64::sse41) || withSum) {
         inputPrecision = outputPrecision = Precision::FP32;
     }
 
@@ -2059,6 +2060,8 @@ void Interpolate::initSupportedPrimitiveDescriptors() {
             config.inConfs.resize(3);
         }
     }
+    if (withSum)
+        config.inConfs.resize(config.inConfs.size() + 1);
     auto& creatorsMap = BlockedDescCreator::getCommonCreators();
     auto pushDesc = [&](LayoutType dataFormat, impl_desc_type implDetail, bool is_version11, bool useAclExecutor = false) {
         config.inConfs[DATA_ID].setMemDesc(creatorsMap.at(dataFormat)->createSharedDesc(inputPrecision, getInputShapeAtPort(DATA_ID)));
@@ -2084,6 +2087,8 @@ void Interpolate::initSupportedPrimitiveDescriptors() {
         }
 
         config.outConfs[0].setMemDesc(creatorsMap.at(dataFormat)->createSharedDesc(outputPrecision, getOutputShapeAtPort(0)));
+        if (withSum)
+            config.inConfs[sumPort].setMemDesc(creatorsMap.at(dataFormat)->createSharedDesc(outputPrecision, getInputShapeAtPort(sumPort)));
 
         if (useAclExecutor) {
             std::vector<MemoryDescPtr> srcMemoryDescs;
@@ -2135,7 +2140,9 @@ void Interpolate::initSupportedPrimitiveDescriptors() {
         pushDesc(LayoutType::ncsp, ref, true);
     } else {
         const auto &dataMinDims = getInputShapeAtPort(DATA_ID).getMinDims();
-        bool isBlkApplied = getInputShapeAtPort(DATA_ID).getRank() > 1 && dataMinDims[1] != Shape::UNDEFINED_DIM && dataMinDims[1] > 1;
+        // the fused sum is implemented for the planar and by channel layouts only
+        bool isBlkApplied = getInputShapeAtPort(DATA_ID).getRank() > 1 && dataMinDims[1] != Shape::UNDEFINED_DIM && dataMinDims[1] > 1 &&
+                            !withSum;
 
 #if defined (OV_CPU_WITH_ACL)
         interpAttrs.hasPad = hasPad;
@@ -2520,7 +2527,12 @@ void Interpolate::execute(dnnl::stream strm) {
             src_data = src_data_origin;
         }
 
-        execPtr->exec(src_data, dst_data, postOpsDataPtrs.data());
+        if (withSum) {
+            const uint8_t *sum_data = reinterpret_cast<const uint8_t*>(getParentEdgeAt(sumPort)->getMemoryPtr()->getData());
+            execPtr->NNWithSum(src_data, sum_data, dst_data);
+        } else {
+            execPtr->exec(src_data, dst_data, postOpsDataPtrs.data());
+        }
     } else if (aclExecPtr) {
         aclExecPtr->exec({srcMemPtr}, {dstMemPtr}, postOpsDataPtrs.data());
     } else {
@@ -3346,6 +3358,43 @@ void Interpolate::InterpolateRefExecutor::NNRef(const uint8_t *in_ptr_, uint8_t
     });
 }
 
+void Interpolate::InterpolateExecutorBase::NNWithSum(const uint8_t *in_ptr_, const uint8_t *sum_ptr_, uint8_t *out_ptr_) {
+    const int B = srcDimPad5d[0], C = srcDimPad5d[1], ID = srcDimPad5d[2], IH = srcDimPad5d[3], IW = srcDimPad5d[4];
+    const int OD = dstDim5d[2], OH = dstDim5d[3], OW = dstDim5d[4];
+    const int *index_d = static_cast<const int*>(&auxTable[0]);
+    const int *index_h = static_cast<const int*>(&auxTable[OD]);
+    const int *index_w = static_cast<const int*>(&auxTable[OD + OH]);
+
+    const float *in_ptr_f32 = reinterpret_cast<const float *>(in_ptr_);
+    const float *sum_ptr_f32 = reinterpret_cast<const float *>(sum_ptr_);
+    float *out_ptr_f32 = reinterpret_cast<float *>(out_ptr_);
+
+    if (configured_for_layout == InterpolateLayoutType::by_channel) {
+        parallel_for3d(B, OD, OH, [&](size_t b, size_t od, size_t oh) {
+            const float *in_ptr = in_ptr_f32 + (IW * IH * ID * b + IW * IH * index_d[od] + IW * index_h[oh]) * C;
+            const size_t outOffset = (OW * OH * OD * b + OW * OH * od + OW * oh) * C;
+            const float *sum_ptr = sum_ptr_f32 + outOffset;
+            float *out_ptr = out_ptr_f32 + outOffset;
+            for (int ow = 0; ow < OW; ow++) {
+                const float *in_ptr_w = in_ptr + index_w[ow] * C;
+                for (int c = 0; c < C; c++) {
+                    out_ptr[ow * C + c] = in_ptr_w[c] + sum_ptr[ow * C + c];
+                }
+            }
+        });
+    } else {
+        parallel_for4d(B, C, OD, OH, [&](size_t b, size_t c, size_t od, size_t oh) {
+            const float *in_ptr = in_ptr_f32 + (IW * IH * ID * C * b + IW * IH * ID * c + IW * IH * index_d[od] + IW * index_h[oh]);
+            const size_t outOffset = OW * OH * OD * C * b + OW * OH * OD * c + OW * OH * od + OW * oh;
+            const float *sum_ptr = sum_ptr_f32 + outOffset;
+            float *out_ptr = out_ptr_f32 + outOffset;
+            for (int ow = 0; ow < OW; ow++) {
+                out_ptr[ow] = in_ptr[index_w[ow]] + sum_ptr[ow];
+            }
+        });
+    }
+}
+
 void Interpolate::InterpolateRefExecutor::linearOnnxRef(const uint8_t *in_ptr_, uint8_t *out_ptr_, int B, int C, int ID, int IH, int IW,
                                                                   int OD, int OH, int OW) {
     std::vector<int*> indexPtr(MAX_INPUT_INTERPOLATE, 0);
@@ -3960,7 +4009,7 @@ size_t Interpolate::getSpatialDimsNum(const Dim rank) {
 }
 
 bool Interpolate::canFuse(const NodePtr& node) const {
-    if (!mayiuse(cpu::x64::sse41) ||
+    if (!mayiuse(cpu::x64::sse41) || withSum ||
         interpAttrs.mode == InterpolateMode::linear ||
         interpAttrs.mode == InterpolateMode::bilinear_pillow ||
         interpAttrs.mode == InterpolateMode::bicubic_pillow) {
@@ -3970,6 +4019,37 @@ bool Interpolate::canFuse(const NodePtr& node) const {
     return canFuseSimpleOperation(node);
 }
 
+bool Interpolate::canFuseSum() const {
+#if defined(OV_CPU_WITH_ACL)
+    return false;
+#else
+    const auto rank = getOutputShapeAtPort(0).getRank();
+    return interpAttrs.mode == InterpolateMode::nearest && !hasPad && !NCHWAsNHWC && !withSum && fusedWith.empty() &&
+           (rank == 4 || rank == 5) && !isDynamicNode() && getOriginalInputPrecisionAtPort(DATA_ID) == Precision::FP32;
+#endif
+}
+
+bool Interpolate::isLinearResizeNHWC() const {
+    if (isDynamicNode() || !fusedWith.empty() || withSum || shapeCalcMode != InterpolateShapeCalcMode::sizes)
+        return false;
+    // the pads are checked directly as the hasPad flag is set only with the descriptors
+    const auto isNonZero = [](int pad) { return pad != 0; };
+    if (std::any_of(interpAttrs.padBegin.begin(), interpAttrs.padBegin.end(), isNonZero) ||
+        std::any_of(interpAttrs.padEnd.begin(), interpAttrs.padEnd.end(), isNonZero))
+        return false;
+    // without the antialiasing the linear mode is the same bilinear interpolation as linear_onnx
+    if (!one_of(interpAttrs.mode, InterpolateMode::linear, InterpolateMode::linear_onnx) ||
+        (interpAttrs.mode == InterpolateMode::linear && interpAttrs.antialias) ||
+        interpAttrs.coordTransMode == InterpolateCoordTransMode::tf_half_pixel_for_nn)
+        return false;
+    if (getOriginalInputPrecisionAtPort(DATA_ID) != Precision::FP32 || getOriginalOutputPrecisionAtPort(0) != Precision::FP32)
+        return false;
+
+    const auto& srcDims = getInputShapeAtPort(DATA_ID).getStaticDims();
+    const auto& dstDims = getOutputShapeAtPort(0).getStaticDims();
+    return srcDims.size() == 4 && srcDims[0] == dstDims[0] && srcDims[3] == dstDims[3];
+}
+
 bool Interpolate::created() const {
     return getType() == Type::Interpolate;
 }
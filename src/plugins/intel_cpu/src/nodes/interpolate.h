@@ -90,6 +90,23 @@ public:
         return false;
     }
     bool canFuse(const NodePtr& node) const override;
+    /**
+     * @brief Checks whether the addition of a tensor of the output shape can be done while the interpolated values are stored,
+     * so the interpolated tensor is not written to memory and read back by the Eltwise
+     */
+    bool canFuseSum() const;
+    void fuseSum(size_t port) {
+        withSum = true;
+        sumPort = port;
+    }
+    /**
+     * @brief Checks whether the node is a static f32 linear resize of the H and W dims of an nhwc tensor to the given sizes,
+     * so the producer of the tensor can compute the interpolated values itself
+     */
+    bool isLinearResizeNHWC() const;
+    InterpolateCoordTransMode getCoordTransMode() const {
+        return interpAttrs.coordTransMode;
+    }
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
 
@@ -119,6 +136,8 @@ private:
                                 const std::vector<float> &dataScales);
 
             virtual void exec(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_) = 0;
+            // nearest neighbor with the fused addition of the tensor of the output shape, f32 planar and by channel layouts
+            void NNWithSum(const uint8_t *in_ptr_, const uint8_t *sum_ptr_, uint8_t *out_ptr_);
             virtual ~InterpolateExecutorBase() = default;
             VectorDims getSrcDimPad5d() const { return srcDimPad5d; }
 
@@ -230,6 +249,9 @@ private:
     bool hasPad = false;
     InterpolateShapeCalcMode shapeCalcMode = InterpolateShapeCalcMode::sizes;
 
+    bool withSum = false;
+    size_t sumPort = 0;
+
     bool isAxesSpecified = false;
     std::vector<int> axes;
     std::vector<float> scales;
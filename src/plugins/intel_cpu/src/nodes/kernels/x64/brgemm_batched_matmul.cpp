@@ -0,0 +1,65 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "brgemm_batched_matmul.hpp"
+
+#include <common/primitive_hashing_utils.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <ie_common.h>
+#include <ie_parallel.hpp>
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::cpu::x64;
+
+namespace ov {
+namespace intel_cpu {
+
+constexpr size_t BrgemmBatchedMatMul::maxMN;
+constexpr size_t BrgemmBatchedMatMul::maxK;
+constexpr size_t BrgemmBatchedMatMul::minBatch;
+
+size_t BrgemmBatchedMatMul::Key::hash() const {
+    size_t seed = 0;
+    seed = hash_combine(seed, M);
+    seed = hash_combine(seed, N);
+    seed = hash_combine(seed, K);
+    return seed;
+}
+
+bool BrgemmBatchedMatMul::Key::operator==(const Key& rhs) const {
+    return M == rhs.M && N == rhs.N && K == rhs.K;
+}
+
+BrgemmBatchedMatMul::BrgemmBatchedMatMul(const Key& key) : m_key(key) {
+    const auto isa = mayiuse(avx512_core) ? avx512_core : avx2;
+    brgemm_t brgDesc;
+    brgemm_strides_t strides {static_cast<dnnl_dim_t>(key.M * key.K), static_cast<dnnl_dim_t>(key.K * key.N)};
+    auto status = brgemm_desc_init(&brgDesc, isa, brgemm_strd, data_type::f32, data_type::f32,
+                                   false, false, brgemm_row_major, 1.f, 0.f,
+                                   key.K, key.N, key.N, key.M, key.N, key.K, &strides);
+    if (status != dnnl_success)
+        IE_THROW() << "Cannot initialize the batched brgemm descriptor, dnnl_status: " << status;
+
+    brgemm_kernel_t* brgKernel = nullptr;
+    status = brgemm_kernel_create(&brgKernel, brgDesc);
+    if (status != dnnl_success)
+        IE_THROW() << "Cannot create the batched brgemm kernel, dnnl_status: " << status;
+    m_kernel.reset(brgKernel);
+}
+
+bool BrgemmBatchedMatMul::isApplicable(size_t M, size_t N, size_t K, size_t batch) {
+    // the matmul primitive parallelizes the big matrices well, while the batch is the only parallel dimension for the tiny ones
+    return mayiuse(avx2) && batch >= minBatch && M <= maxMN && N <= maxMN && K <= maxK && M * N * K > 0;
+}
+
+void BrgemmBatchedMatMul::execute(const float* src0, const float* src1, float* dst,
+                                  const std::vector<size_t>& src0Offsets, const std::vector<size_t>& src1Offsets) const {
+    const size_t dstStride = m_key.M * m_key.N;
+    parallel_for(src0Offsets.size(), [&](size_t b) {
+        brgemm_kernel_execute(m_kernel.get(), 1, src0 + src0Offsets[b], src1 + src1Offsets[b], nullptr, dst + b * dstStride);
+    });
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,56 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/brgemm/brgemm.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Batched multiplication of the small f32 row-major matrices [M, K] x [K, N] = [M, N].
+ * A single register blocked brgemm microkernel is generated for the matrices shape and the batch items are
+ * distributed across the threads, each item is computed by one kernel call.
+ * Is used instead of the oneDNN matmul primitive for the shapes with many tiny batch items (e.g. the per head attention),
+ * where the primitive is not able to load all the cores.
+ */
+class BrgemmBatchedMatMul {
+public:
+    struct Key {
+        size_t M;
+        size_t N;
+        size_t K;
+
+        size_t hash() const;
+        bool operator==(const Key& rhs) const;
+    };
+
+    explicit BrgemmBatchedMatMul(const Key& key);
+
+    /**
+     * @brief Checks whether the batched brgemm is expected to be faster than the matmul primitive for the shape
+     */
+    static bool isApplicable(size_t M, size_t N, size_t K, size_t batch);
+
+    /**
+     * @brief Computes the batch items, the output items are dense and the inputs items are located by the offsets (in elements)
+     */
+    void execute(const float* src0, const float* src1, float* dst,
+                 const std::vector<size_t>& src0Offsets, const std::vector<size_t>& src1Offsets) const;
+
+    static constexpr size_t maxMN = 128;
+    static constexpr size_t maxK = 512;
+    static constexpr size_t minBatch = 2;
+
+private:
+    Key m_key;
+    std::unique_ptr<dnnl::impl::cpu::x64::brgemm_kernel_t> m_kernel;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
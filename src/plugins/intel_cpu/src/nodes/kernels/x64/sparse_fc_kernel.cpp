@@ -0,0 +1,224 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sparse_fc_kernel.hpp"
+
+#include <cstring>
+#include <ie_parallel.hpp>
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_args_sparse_fc, field)
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+constexpr size_t valuesAlignment = 64;
+
+size_t countBlockNonZeros(const float* weights, size_t K, size_t block, size_t b) {
+    size_t count = 0;
+    for (size_t j = 0; j < block; j++) {
+        const float* row = weights + (b * block + j) * K;
+        for (size_t k = 0; k < K; k++) {
+            if (row[k] != 0.f)
+                count++;
+        }
+    }
+    return count;
+}
+}  // namespace
+
+size_t SparseFCWeights::valuesOffset(size_t N, size_t K, size_t block) {
+    const size_t offset = masksOffset(N, block) + N / block * K * sizeof(uint16_t);
+    return div_up(offset, valuesAlignment) * valuesAlignment;
+}
+
+size_t SparseFCWeights::getPackedSize(const float* weights, size_t N, size_t K, size_t block) {
+    const size_t blocksNum = N / block;
+    std::vector<size_t> nonZeros(blocksNum);
+    parallel_for(blocksNum, [&](size_t b) {
+        nonZeros[b] = countBlockNonZeros(weights, K, block, b);
+    });
+    size_t valuesNum = block;
+    for (const auto count : nonZeros)
+        valuesNum += count;
+    return valuesOffset(N, K, block) + valuesNum * sizeof(float);
+}
+
+void SparseFCWeights::pack(const float* weights, size_t N, size_t K, size_t block, uint8_t* packed) {
+    const size_t blocksNum = N / block;
+    auto offsets = reinterpret_cast<uint64_t*>(packed);
+    auto masksPtr = reinterpret_cast<uint16_t*>(packed + masksOffset(N, block));
+    auto valuesPtr = reinterpret_cast<float*>(packed + valuesOffset(N, K, block));
+
+    offsets[0] = 0;
+    for (size_t b = 0; b < blocksNum; b++)
+        offsets[b + 1] = offsets[b] + countBlockNonZeros(weights, K, block, b);
+
+    parallel_for(blocksNum, [&](size_t b) {
+        uint16_t* blockMasks = masksPtr + b * K;
+        float* blockValues = valuesPtr + offsets[b];
+        for (size_t k = 0; k < K; k++) {
+            uint16_t mask = 0;
+            for (size_t j = 0; j < block; j++) {
+                const float value = weights[(b * block + j) * K + k];
+                if (value != 0.f) {
+                    mask |= static_cast<uint16_t>(1 << j);
+                    *blockValues++ = value;
+                }
+            }
+            blockMasks[k] = mask;
+        }
+    });
+    std::memset(valuesPtr + offsets[blocksNum], 0, block * sizeof(float));
+}
+
+constexpr size_t jit_uni_sparse_fc_kernel::max_rows;
+
+template <cpu_isa_t isa>
+constexpr size_t jit_uni_sparse_fc_kernel_f32<isa>::block;
+
+template <cpu_isa_t isa>
+jit_uni_sparse_fc_kernel_f32<isa>::jit_uni_sparse_fc_kernel_f32(jit_sparse_fc_conf jcp)
+    : jit_uni_sparse_fc_kernel(jcp), jit_generator(jit_name()) {}
+
+template <cpu_isa_t isa>
+void jit_uni_sparse_fc_kernel_f32<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sparse_fc_kernel_f32<isa>::generate() {
+    this->preamble();
+
+    const size_t rows = jcp_.rows;
+    // the rows addresses for the strides up to 3 * stride
+    auto row_ptr = [&](const Xbyak::Reg64& base, size_t r) {
+        switch (r) {
+        case 0:
+            return ptr[base];
+        case 1:
+            return ptr[base + reg_stride];
+        case 2:
+            return ptr[base + reg_stride * 2];
+        default:
+            return ptr[base + reg_stride3];
+        }
+    };
+
+    mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+    mov(reg_masks, ptr[reg_params + GET_OFF(masks)]);
+    mov(reg_values, ptr[reg_params + GET_OFF(values)]);
+    mov(reg_bias, ptr[reg_params + GET_OFF(bias)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_k, ptr[reg_params + GET_OFF(k)]);
+    mov(reg_stride, ptr[reg_params + GET_OFF(src_stride)]);
+    lea(reg_stride3, ptr[reg_stride + reg_stride * 2]);
+
+    if (isa == avx2) {
+        mov(reg_table, l_perm_table);
+        uni_vmovups(vmm_bits, ptr[rip + l_lane_bits]);
+    }
+
+    Xbyak::Label l_no_bias;
+    Xbyak::Label l_init_end;
+    test(reg_bias, reg_bias);
+    jz(l_no_bias, T_NEAR);
+    for (size_t r = 0; r < rows; r++)
+        uni_vmovups(Vmm(r), ptr[reg_bias]);
+    jmp(l_init_end, T_NEAR);
+    L(l_no_bias);
+    for (size_t r = 0; r < rows; r++)
+        uni_vpxor(Vmm(r), Vmm(r), Vmm(r));
+    L(l_init_end);
+
+    Xbyak::Label l_loop;
+    Xbyak::Label l_skip;
+    Xbyak::Label l_loop_end;
+    L(l_loop);
+    {
+        cmp(reg_k, 0);
+        je(l_loop_end, T_NEAR);
+
+        movzx(reg_mask.cvt32(), word[reg_masks]);
+        test(reg_mask.cvt32(), reg_mask.cvt32());
+        jz(l_skip, T_NEAR);
+
+        expand_weights();
+        popcnt(reg_count.cvt32(), reg_mask.cvt32());
+        lea(reg_values, ptr[reg_values + reg_count * sizeof(float)]);
+
+        for (size_t r = 0; r < rows; r++) {
+            uni_vbroadcastss(vmm_src, row_ptr(reg_src, r));
+            uni_vfmadd231ps(Vmm(r), vmm_wei, vmm_src);
+        }
+
+        L(l_skip);
+        add(reg_src, sizeof(float));
+        add(reg_masks, sizeof(uint16_t));
+        dec(reg_k);
+        jmp(l_loop, T_NEAR);
+    }
+    L(l_loop_end);
+
+    mov(reg_stride, ptr[reg_params + GET_OFF(dst_stride)]);
+    lea(reg_stride3, ptr[reg_stride + reg_stride * 2]);
+    for (size_t r = 0; r < rows; r++)
+        uni_vmovups(row_ptr(reg_dst, r), Vmm(r));
+
+    this->postamble();
+
+    if (isa == avx2)
+        emit_tables();
+}
+
+template <>
+void jit_uni_sparse_fc_kernel_f32<avx512_core>::expand_weights() {
+    kmovw(k_mask, reg_mask.cvt32());
+    vexpandps(vmm_wei | k_mask | T_z, ptr[reg_values]);
+}
+
+template <>
+void jit_uni_sparse_fc_kernel_f32<avx2>::expand_weights() {
+    // there is no expand instruction on avx2, so the compacted values are spread by the permutation of the mask
+    // and the lanes of the zero weights are cleared
+    uni_vmovups(vmm_wei, ptr[reg_values]);
+    mov(reg_count, reg_mask);
+    shl(reg_count, 5);
+    vmovdqu(vmm_perm, ptr[reg_table + reg_count]);
+    vpermps(vmm_wei, vmm_perm, vmm_wei);
+
+    const Xbyak::Xmm xmm_lanes(vmm_lanes.getIdx());
+    vmovd(xmm_lanes, reg_mask.cvt32());
+    vpbroadcastd(vmm_lanes, xmm_lanes);
+    vpand(vmm_lanes, vmm_lanes, vmm_bits);
+    vpcmpeqd(vmm_lanes, vmm_lanes, vmm_bits);
+    vandps(vmm_wei, vmm_wei, vmm_lanes);
+}
+
+template <cpu_isa_t isa>
+void jit_uni_sparse_fc_kernel_f32<isa>::emit_tables() {
+    // for every mask the lane j takes the compacted value number popcount(mask & ((1 << j) - 1))
+    align(64);
+    L(l_perm_table);
+    for (uint32_t mask = 0; mask < (1u << block); mask++) {
+        uint32_t index = 0;
+        for (uint32_t j = 0; j < block; j++) {
+            dd((mask & (1u << j)) ? index++ : 0);
+        }
+    }
+    L(l_lane_bits);
+    for (uint32_t j = 0; j < block; j++)
+        dd(1u << j);
+}
+
+template struct jit_uni_sparse_fc_kernel_f32<avx2>;
+template struct jit_uni_sparse_fc_kernel_f32<avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
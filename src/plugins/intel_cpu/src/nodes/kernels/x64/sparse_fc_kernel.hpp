@@ -0,0 +1,131 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief The f32 FullyConnected weights [N, K] packed for the decompression on the fly.
+ * The output channels are split into the blocks of the vector length, for each input channel of a block
+ * the bitmask of the non zero weights is stored along with the compacted non zero values.
+ * Layout: {blocksNum + 1 values offsets (in elements)} {blocksNum * K masks} {values}, the values are padded
+ * by a vector to allow the whole vector loads of the last compacted values.
+ */
+class SparseFCWeights {
+public:
+    /**
+     * @brief Returns the size in bytes of the packed weights
+     */
+    static size_t getPackedSize(const float* weights, size_t N, size_t K, size_t block);
+    static void pack(const float* weights, size_t N, size_t K, size_t block, uint8_t* packed);
+
+    static const uint64_t* valuesOffsets(const uint8_t* packed) {
+        return reinterpret_cast<const uint64_t*>(packed);
+    }
+    static const uint16_t* masks(const uint8_t* packed, size_t N, size_t block) {
+        return reinterpret_cast<const uint16_t*>(packed + masksOffset(N, block));
+    }
+    static const float* values(const uint8_t* packed, size_t N, size_t K, size_t block) {
+        return reinterpret_cast<const float*>(packed + valuesOffset(N, K, block));
+    }
+
+private:
+    static size_t masksOffset(size_t N, size_t block) {
+        return (N / block + 1) * sizeof(uint64_t);
+    }
+    static size_t valuesOffset(size_t N, size_t K, size_t block);
+};
+
+struct jit_sparse_fc_conf {
+    // the number of the src rows computed by one kernel call, up to jit_uni_sparse_fc_kernel::max_rows
+    size_t rows;
+};
+
+struct jit_args_sparse_fc {
+    const float* src;
+    const uint16_t* masks;
+    const float* values;
+    const float* bias;
+    float* dst;
+
+    size_t src_stride;      // in bytes
+    size_t dst_stride;      // in bytes
+    size_t k;
+};
+
+struct jit_uni_sparse_fc_kernel {
+    void (*ker_)(const jit_args_sparse_fc*);
+
+    void operator()(const jit_args_sparse_fc* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_sparse_fc_kernel(jit_sparse_fc_conf jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_sparse_fc_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    static constexpr size_t max_rows = 4;
+
+    jit_sparse_fc_conf jcp_;
+};
+
+/**
+ * @brief Computes dst[rows, block] = src[rows, K] x W[K, block] + bias for one output channels block of the packed
+ * weights. The weights vector of each input channel is expanded from the compacted values by its mask
+ * (vexpandps on avx512, a permutation table on avx2) and the input channels with no non zero weights are skipped.
+ */
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_sparse_fc_kernel_f32 : public jit_uni_sparse_fc_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_sparse_fc_kernel_f32)
+
+    explicit jit_uni_sparse_fc_kernel_f32(jit_sparse_fc_conf jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+    static constexpr size_t block = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(float);
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+
+    void expand_weights();
+    void emit_tables();
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_masks = r9;
+    Xbyak::Reg64 reg_values = r10;
+    Xbyak::Reg64 reg_bias = r11;
+    Xbyak::Reg64 reg_dst = r12;
+    Xbyak::Reg64 reg_stride = r13;
+    Xbyak::Reg64 reg_stride3 = r14;
+    Xbyak::Reg64 reg_k = r15;
+    Xbyak::Reg64 reg_mask = rax;
+    Xbyak::Reg64 reg_count = rbx;
+    Xbyak::Reg64 reg_table = rdx;
+
+    Xbyak::Label l_perm_table;
+    Xbyak::Label l_lane_bits;
+
+    Vmm vmm_wei = Vmm(4);
+    Vmm vmm_src = Vmm(5);
+    Vmm vmm_perm = Vmm(6);
+    Vmm vmm_lanes = Vmm(7);
+    Vmm vmm_bits = Vmm(8);
+
+    Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -9,6 +9,7 @@
 #include "cpu_types.h"
 #include "eltwise.h"
 
+#include <functional>
 #include <numeric>
 #include <string>
 #include <vector>
@@ -23,6 +24,9 @@
 #include <common/primitive_hashing_utils.hpp>
 #include <cpu/x64/cpu_isa_traits.hpp>
 #include "shape_inference/custom/matmul.hpp"
+#if defined(OPENVINO_ARCH_X86_64)
+#include "kernels/x64/brgemm_batched_matmul.hpp"
+#endif
 using namespace dnnl;
 using namespace InferenceEngine;
 
@@ -235,6 +239,35 @@ static VectorDims getStridesAndModifyShape(Shape& shape, const bool transpose) {
     return strides;
 }
 
+/* The same for the input produced by the fused Transpose with the given order:
+ * the data is dense in the layout of the Transpose input, so the stride of each dim is
+ * the stride of the source dim it is taken from, e.g. for the order (0, 2, 1, 3)
+ * the shape (2, 12, 128, 64) gets the strides (98304, 64, 768, 1)
+ */
+static VectorDims getPermutedStridesAndModifyShape(Shape& shape, const VectorDims& order, const bool transpose) {
+    const auto rank = shape.getRank();
+    auto dims = shape.getStaticDims();
+
+    VectorDims srcDims(rank);
+    for (size_t i = 0; i < rank; i++)
+        srcDims[order[i]] = dims[i];
+    VectorDims srcStrides(rank, 1);
+    for (size_t i = rank - 1; i > 0; i--)
+        srcStrides[i - 1] = srcStrides[i] * srcDims[i];
+
+    VectorDims strides(rank);
+    for (size_t i = 0; i < rank; i++)
+        strides[i] = srcStrides[order[i]];
+
+    if (transpose && rank > 1) {
+        std::swap(dims[rank - 2], dims[rank - 1]);
+        std::swap(strides[rank - 2], strides[rank - 1]);
+        shape = Shape{dims};
+    }
+
+    return strides;
+}
+
 dnnl::memory::desc MatMul::getBiasDescFrom(const DnnlMemoryDescCPtr outMemDesc) {
     // oneDNN matmul requires shape for bias desc to be the same rank
     VectorDims biasDims(outMemDesc->getShape().getRank(), 1);
@@ -246,17 +279,10 @@ dnnl::memory::desc MatMul::getBiasDescFrom(const DnnlMemoryDescCPtr outMemDesc)
     return dnnl::memory::desc(DnnlExtensionUtils::convertToDnnlDims(biasDims), bdt, memory::format_tag::any);
 }
 
-void MatMul::getSupportedDescriptors() {
-    if (getParentEdges().size() != getOriginalInputsNumber())
-        IE_THROW()  << errorPrefix << " has incorrect number of input edges for layer " << getName();
-    if (getChildEdges().empty())
-        IE_THROW()  << errorPrefix << " has incorrect number of output edges for layer " << getName();
-
-    withBiases = getOriginalInputsNumber() == 3;
-
-    auto firstInPortPrec = getOriginalInputPrecisionAtPort(0);
-    auto secondInPortPrec = getOriginalInputPrecisionAtPort(1);
-    auto outPortPrec = getOriginalOutputPrecisionAtPort(0);
+void MatMul::getExecPrecisions(Precision& firstInPortPrec, Precision& secondInPortPrec, Precision& outPortPrec) const {
+    firstInPortPrec = getOriginalInputPrecisionAtPort(0);
+    secondInPortPrec = getOriginalInputPrecisionAtPort(1);
+    outPortPrec = getOriginalOutputPrecisionAtPort(0);
 
     if (firstInPortPrec.size() != secondInPortPrec.size())
         firstInPortPrec = secondInPortPrec = getMaxPrecision(getOriginalInputPrecisions());
@@ -266,6 +292,24 @@ void MatMul::getSupportedDescriptors() {
          !one_of(secondInPortPrec , Precision::I8, Precision::BF16, Precision::FP16, Precision::FP32))) {
         outPortPrec = firstInPortPrec = secondInPortPrec = Precision::FP32;
     }
+}
+
+std::array<Precision, 2> MatMul::getExecInputPrecisions() const {
+    Precision firstInPortPrec, secondInPortPrec, outPortPrec;
+    getExecPrecisions(firstInPortPrec, secondInPortPrec, outPortPrec);
+    return {firstInPortPrec, secondInPortPrec};
+}
+
+void MatMul::getSupportedDescriptors() {
+    if (getParentEdges().size() != getOriginalInputsNumber())
+        IE_THROW()  << errorPrefix << " has incorrect number of input edges for layer " << getName();
+    if (getChildEdges().empty())
+        IE_THROW()  << errorPrefix << " has incorrect number of output edges for layer " << getName();
+
+    withBiases = getOriginalInputsNumber() == 3;
+
+    Precision firstInPortPrec, secondInPortPrec, outPortPrec;
+    getExecPrecisions(firstInPortPrec, secondInPortPrec, outPortPrec);
 
     Precision postOpsPrec = outPortPrec;
     if (!fusedWith.empty()) {
@@ -327,8 +371,10 @@ void MatMul::getSupportedDescriptors() {
 
     auto staticOutputShape = outputShape.isStatic() ? outputShape : Shape(shapeInferGeneric(staticInputShapes).front());
 
-    const VectorDims inStrides0 = getStridesAndModifyShape(staticInputShapes[0], transposeIn[0]);
-    const VectorDims inStrides1 = getStridesAndModifyShape(staticInputShapes[1], transposeIn[1]);
+    const VectorDims inStrides0 = inputOrder[0].empty() ? getStridesAndModifyShape(staticInputShapes[0], transposeIn[0])
+                                                        : getPermutedStridesAndModifyShape(staticInputShapes[0], inputOrder[0], transposeIn[0]);
+    const VectorDims inStrides1 = inputOrder[1].empty() ? getStridesAndModifyShape(staticInputShapes[1], transposeIn[1])
+                                                        : getPermutedStridesAndModifyShape(staticInputShapes[1], inputOrder[1], transposeIn[1]);
 
     inDataDesc[0] = std::make_shared<DnnlBlockedMemoryDesc>(firstInPortPrec, staticInputShapes[0], inStrides0);
     inDataDesc[1] = std::make_shared<DnnlBlockedMemoryDesc>(secondInPortPrec, staticInputShapes[1], inStrides1);
@@ -512,6 +558,9 @@ void MatMul::prepareParams() {
     if (selected_pd == nullptr)
         IE_THROW()  << errorPrefix << " did not set preferable primitive descriptor";
 
+    if (prepareBrgemmBatched(src0MemPtr, src1MemPtr, dstMemPtr))
+        return;
+
     DnnlMemoryDescPtr src0TransposedDesc;
     DnnlMemoryDescPtr src1TransposedDesc;
 
@@ -610,7 +659,74 @@ void MatMul::prepareParams() {
 #endif
 }
 
+bool MatMul::prepareBrgemmBatched(const MemoryPtr& src0MemPtr, const MemoryPtr& src1MemPtr, const MemoryPtr& dstMemPtr) {
+    brgemmBatchedPtr = nullptr;
+#if defined(OPENVINO_ARCH_X86_64)
+    // only the plain f32 matrices without transposition and post ops are supported
+    if (withBiases || !fusedWith.empty() || transposeIn[0] || transposeIn[1] ||
+        !inputOrder[0].empty() || !inputOrder[1].empty())
+        return false;
+    for (const auto& memPtr : {src0MemPtr, src1MemPtr, dstMemPtr}) {
+        const auto& desc = memPtr->getDesc();
+        if (desc.getPrecision() != Precision::FP32 || !desc.hasLayoutType(LayoutType::ncsp))
+            return false;
+    }
+
+    const auto& src0Dims = src0MemPtr->getStaticDims();
+    const auto& src1Dims = src1MemPtr->getStaticDims();
+    const auto& dstDims = dstMemPtr->getStaticDims();
+    const size_t rank = dstDims.size();
+    if (rank < 3)
+        return false;
+
+    const size_t M = dstDims[rank - 2];
+    const size_t N = dstDims[rank - 1];
+    const size_t K = src0Dims[rank - 1];
+    const size_t batch = std::accumulate(dstDims.begin(), dstDims.end() - 2, size_t(1), std::multiplies<size_t>());
+    if (!BrgemmBatchedMatMul::isApplicable(M, N, K, batch))
+        return false;
+
+    // the broadcasted batch dimensions of the inputs are taken into account by the per item offsets
+    const std::array<std::reference_wrapper<const VectorDims>, 2> srcDims{std::cref(src0Dims), std::cref(src1Dims)};
+    for (size_t i = 0; i < srcDims.size(); i++) {
+        const auto& dims = srcDims[i].get();
+        auto& offsets = brgemmBatchOffsets[i];
+        offsets.assign(batch, 0);
+        size_t stride = dims[rank - 2] * dims[rank - 1];
+        size_t innerBatch = 1;
+        for (size_t d = rank - 2; d-- > 0;) {
+            if (dims[d] != 1) {
+                for (size_t b = 0; b < batch; b++)
+                    offsets[b] += (b / innerBatch) % dstDims[d] * stride;
+            }
+            stride *= dims[d];
+            innerBatch *= dstDims[d];
+        }
+    }
+
+    BrgemmBatchedMatMul::Key key{M, N, K};
+    auto builder = [](const BrgemmBatchedMatMul::Key& key) -> std::shared_ptr<BrgemmBatchedMatMul> {
+        return std::make_shared<BrgemmBatchedMatMul>(key);
+    };
+    auto cache = context->getParamsCache();
+    brgemmBatchedPtr = cache->getOrCreate(key, builder).first;
+    execPtr = nullptr;
+    return brgemmBatchedPtr != nullptr;
+#else
+    return false;
+#endif
+}
+
 void MatMul::execute(dnnl::stream strm) {
+#if defined(OPENVINO_ARCH_X86_64)
+    if (brgemmBatchedPtr) {
+        brgemmBatchedPtr->execute(reinterpret_cast<const float*>(getParentEdgeAt(0)->getMemoryPtr()->getData()),
+                                  reinterpret_cast<const float*>(getParentEdgeAt(1)->getMemoryPtr()->getData()),
+                                  reinterpret_cast<float*>(getChildEdgeAt(0)->getMemoryPtr()->getData()),
+                                  brgemmBatchOffsets[0], brgemmBatchOffsets[1]);
+        return;
+    }
+#endif
     if (execPtr) {
         execPtr->exec(primArgs, strm);
     } else {
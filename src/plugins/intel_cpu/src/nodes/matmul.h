@@ -14,6 +14,9 @@
 
 namespace ov {
 namespace intel_cpu {
+
+class BrgemmBatchedMatMul;
+
 namespace node {
 
 class MatMul : public Node {
@@ -45,6 +48,20 @@ public:
     const std::vector<impl_desc_type>& getDefaultImplPriority() override;
     bool canBeExecutedInInt8() const override;
 
+    /**
+     * @brief The input at the port is the output of the Transpose with the given order, which is not executed:
+     * the data keeps the layout of the Transpose input and is read through the permuted strides.
+     */
+    void fuseInputTranspose(size_t port, const VectorDims& order) {
+        inputOrder[port] = order;
+    }
+
+    /**
+     * @brief The precisions of the data inputs the node is executed with: the inputs of different sizes are
+     * converted to the biggest precision, the ones that cannot be handled natively to fp32.
+     */
+    std::array<InferenceEngine::Precision, 2> getExecInputPrecisions() const;
+
 protected:
     AttrPtr initPrimitiveAttr() override;
     AttrPtr initPrimitiveAttr(const VectorDims& dims);
@@ -52,6 +69,15 @@ protected:
 private:
     using executorPtr = std::shared_ptr<DnnlExecutor>;
     executorPtr execPtr = nullptr;
+
+    // the tiny matrices with a big batch are computed by the batched brgemm instead of the matmul primitive
+    bool prepareBrgemmBatched(const MemoryPtr& src0MemPtr, const MemoryPtr& src1MemPtr, const MemoryPtr& dstMemPtr);
+    std::shared_ptr<BrgemmBatchedMatMul> brgemmBatchedPtr = nullptr;
+    std::array<std::vector<size_t>, 2> brgemmBatchOffsets;
+
+    void getExecPrecisions(InferenceEngine::Precision& firstInPortPrec,
+                           InferenceEngine::Precision& secondInPortPrec,
+                           InferenceEngine::Precision& outPortPrec) const;
     dnnl::memory::desc getBiasDescFrom(const DnnlMemoryDescCPtr outMemDesc);
     std::pair<Shape, Shape> makeDummyInputShapes(const Shape& in0, const Shape& in1) const;
 
@@ -64,6 +90,9 @@ private:
     /* whether to transpose input */
     std::array<bool, 2> transposeIn;
 
+    /* the order of the fused input Transpose, empty if there is none */
+    std::array<VectorDims, 2> inputOrder;
+
     std::array<DnnlBlockedMemoryDescPtr, 2> inDataDesc;
     DnnlBlockedMemoryDescPtr outDataDesc;
 };
@@ -6,6 +6,7 @@
 #include <dnnl_types.h>
 #include <dnnl_extension_utils.h>
 #include "memory.hpp"
+#include "concat.h"
 #include "common/cpu_convert.h"
 #include "common/cpu_memcpy.h"
 #include "utils/general_utils.h"
@@ -31,11 +32,6 @@ MemoryNode::MemoryNode(const std::shared_ptr<ngraph::Node>& op) {
 
 bool MemoryOutput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::Assign::get_type_info_static(),
                 ngraph::op::v6::Assign::get_type_info_static())) {
@@ -88,11 +84,6 @@ void MemoryOutput::execute(dnnl::stream strm)  {
 
 bool MemoryInput::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         if (!one_of(op->get_type_info(),
                 ngraph::op::v3::ReadValue::get_type_info_static(),
                 ngraph::op::v6::ReadValue::get_type_info_static())) {
@@ -119,11 +110,66 @@ MemoryInput::MemoryInput(const std::shared_ptr<ngraph::Node>& op, const GraphCon
 void MemoryInput::createPrimitive() {
     Input::createPrimitive();
 
-    dataStore = std::make_shared<Memory>(getEngine(), getChildEdgeAt(0)->getMemory().getDesc());
+    // the node has its own state until the infer request binds the one of its own
+    assignState(makeState(getId()));
+}
 
-    // default memory state is zero filled
-    if (dataStore->getDesc().hasDefinedMaxSize())
-        dataStore->nullify();
+VariableState::Ptr MemoryInput::makeState(const std::string& name, size_t maxReservedLength, bool bindTensors) const {
+    const auto selectedPd = getSelectedPrimitiveDescriptor();
+    if (selectedPd == nullptr)
+        IE_THROW() << "Preferable primitive descriptor is not set for node " << getName() << ".";
+    return std::make_shared<VariableState>(name,
+                                           selectedPd->getConfig().outConfs[0].getMemDesc(),
+                                           getEngine(),
+                                           maxReservedLength,
+                                           bindTensors);
+}
+
+void MemoryInput::assignState(const VariableState::Ptr& state) {
+    m_state = state;
+    if (isStateView()) {
+        m_stateAppendMngr->setMemMngr(m_state->getMemoryMngr());
+        m_stateViewMngr->setMemMngr(m_state->getMemoryMngr());
+    }
+    if (isDynamicNode()) {
+        redefineOutputMemory({m_state->getMemory()->getStaticDims()});
+    }
+}
+
+namespace {
+bool isStateAppendedInPlace(const MemoryInput& memInput, const Concat& concat) {
+    if (!memInput.isDynamicNode() || memInput.getChildEdges().size() != 1 || !concat.isFirstInputPrefix())
+        return false;
+    for (const auto& edge : concat.getChildEdgesAtPort(0)) {
+        auto memOutput = dynamic_cast<MemoryOutput*>(edge->getChild().get());
+        if (memOutput && memOutput->getId() == memInput.getId())
+            return true;
+    }
+    return false;
+}
+}  // namespace
+
+MemoryMngrPtr MemoryInput::getStateMemMngr(const Edge& edge) {
+    const auto parent = edge.getParent();
+    const auto child = edge.getChild();
+    Concat* concat = nullptr;
+    if (parent->getType() == Type::MemoryInput && edge.getOutputNum() == 0) {
+        concat = dynamic_cast<Concat*>(child.get());
+    } else if (parent->getType() == Type::Concatenation && edge.getInputNum() == 0) {
+        concat = dynamic_cast<Concat*>(parent.get());
+    }
+    if (concat == nullptr)
+        return nullptr;
+
+    auto memInput = dynamic_cast<MemoryInput*>(concat->getParentEdgesAtPort(0)[0]->getParent().get());
+    if (memInput == nullptr || !isStateAppendedInPlace(*memInput, *concat))
+        return nullptr;
+
+    if (!memInput->isStateView()) {
+        memInput->m_stateViewMngr = std::make_shared<ProxyMemoryMngr>();
+        memInput->m_stateAppendMngr = std::make_shared<ProxyMemoryMngr>();
+    }
+    return parent.get() == memInput ? memInput->m_stateViewMngr : memInput->m_stateAppendMngr;
 }
 
 /**
@@ -153,22 +199,26 @@ MemoryInput::~MemoryInput() {
     MemoryNodeVirtualEdge::remove(this, holder);
 }
 
-MemoryPtr MemoryInput::getStore() {
-    return dataStore;
-}
-
 void MemoryInput::storeState(const IMemory &new_state) {
+    m_state->redefine(new_state.getStaticDims());
+    const auto& stateMem = m_state->getMemory();
+    // the state appended in place is already there
+    if (stateMem->getData() == new_state.getData())
+        return;
     // TODO: Should be next one call:
     //           dataStore.load(new_state, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(*dataStore, new_state);
+    simple_copy(*stateMem, new_state);
 }
 
 void MemoryInput::execute(dnnl::stream strm) {
+    // the output is a view of the state buffer
+    if (isStateView())
+        return;
     // TODO: Should be simple call of:
     //           dst_mem.load(dataStore, false);
     //       But because of performance reason we use simple manual copy
-    simple_copy(getChildEdgeAt(0)->getMemory(), *dataStore);
+    simple_copy(getChildEdgeAt(0)->getMemory(), *m_state->getMemory());
 }
 
 MemoryNodeVirtualEdge::Holder* MemoryNodeVirtualEdge::registerInput(MemoryInput * node) {
@@ -8,6 +8,8 @@
 #include <cpu_types.h>
 #include "ie_algorithm.hpp"
 #include "input.h"
+#include "memory_state.h"
+#include "proxy_mem_mgr.h"
 #include <node.h>
 #include <string>
 #include <memory>
@@ -23,7 +25,7 @@ class MemoryNode {
     explicit MemoryNode(std::string id) : _id(id) {}
     explicit MemoryNode(const std::shared_ptr<ngraph::Node>& op);
     virtual ~MemoryNode() = default;
-    std::string getId() {
+    std::string getId() const {
         return _id;
     }
     virtual void setInputNode(Node *) = 0;
@@ -68,6 +70,11 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void createPrimitive() override {}
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
+    bool needShapeInfer() const override { return false; }
+    bool needPrepareParams() const override { return false; }
     bool created() const override {
         return getType() == Type::MemoryOutput;
     }
@@ -97,14 +104,41 @@ public:
         return true;
     }
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override {
+        execute(strm);
+    }
 
     void createPrimitive() override;
 
     void setInputNode(Node* node) override {}
     void storeState(const IMemory& mem);
-    MemoryPtr getStore();
- private:
-    MemoryPtr dataStore;
+
+    /**
+     * @brief Creates a zero filled state compatible with the node
+     */
+    VariableState::Ptr makeState(const std::string& name, size_t maxReservedLength = 0, bool bindTensors = false) const;
+    /**
+     * @brief Binds the state the node reads and the sibling MemoryOutput writes during the next inferences
+     */
+    void assignState(const VariableState::Ptr& state);
+
+    /**
+     * @brief Returns the memory manager the edge is to be allocated with, if the edge data is kept in the state buffer directly.
+     * It is the case of a dynamic ReadValue -> Concat -> Assign chain, where the Concat output is appended to the
+     * state in place and the ReadValue output is a view of the state, so the state is not copied at all.
+     * @return nullptr if the edge is not a part of such a chain
+     */
+    static MemoryMngrPtr getStateMemMngr(const Edge& edge);
+
+private:
+    bool isStateView() const {
+        return m_stateViewMngr != nullptr;
+    }
+
+    VariableState::Ptr m_state;
+    // the proxies of the ReadValue output and the Concat output, both of them are switched to the bound state buffer
+    ProxyMemoryMngrPtr m_stateViewMngr;
+    ProxyMemoryMngrPtr m_stateAppendMngr;
     MemoryNodeVirtualEdge::Holder* holder = nullptr;
 };
 
@@ -679,11 +679,6 @@ bool MHA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::s
             return false;
         }
 
-        if (isDynamicNgraphNode(op)) {
-            errorMessage = "Doesn't support op with dynamic shapes";
-            return false;
-        }
-
         bool supportedPrecisions = true;
         if (!(mha->get_input_element_type(0) == element::i8 &&
               mha->get_input_element_type(1) == element::f32 &&
@@ -736,9 +731,12 @@ bool MHA::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::s
             return false;
         }
 
-        if (mha->get_input_shape(0).size() != 4) {
-            errorMessage = "Doesn't support inputs with rank != 4";
-            return false;
+        for (size_t i = 0; i < mha->get_input_size(); i++) {
+            const auto& rank = mha->get_input_partial_shape(i).rank();
+            if (rank.is_dynamic() || rank.get_length() != 4) {
+                errorMessage = "Doesn't support inputs with rank != 4";
+                return false;
+            }
         }
     } catch (...) {
         return false;
@@ -920,6 +918,13 @@ void MHA::prepareParams() {
     strTranspose2In0 = memDescTranspose2In0->getStrides();
     strOut = memDescOut->getStrides();
 
+    // the kernels are rebuilt for the new shapes, so the ones required only by the previous shapes must not be kept
+    brgCopyAKernel0.reset();
+    brgCopyBKernel0.reset();
+    brgCopyBKernel1.reset();
+    convertReorderKernel.reset();
+    convertTransposeKernel.reset();
+
     std::vector<size_t> orderTranspose0 = {0, 2, 1, 3};
     dimsMatMul0In0 = transpose(dimsTranspose0In0, orderTranspose0);
 
@@ -931,6 +936,11 @@ void MHA::prepareParams() {
     std::vector<size_t> orderTranspose2 = {0, 2, 1, 3};
     dimsMatMul1In1 = transpose(dimsTranspose2In0, orderTranspose2);
 
+    // the query length may differ from the key/value one, the mask is broadcasted along the heads and the query length
+    if (dimsAddIn1[3] != dimsMatMul0In1[3] || (dimsAddIn1[0] != dimsMatMul0In0[0] && dimsAddIn1[0] != 1)) {
+        THROW_ERROR << "has unsupported attention mask shape";
+    }
+
     bool isAMXSupported = mayiuse(avx512_core_amx);
 
     size_t numThreads = parallel_get_max_threads();
@@ -975,7 +985,7 @@ void MHA::prepareParams() {
                 brgemmCtx.M = M_;
                 brgemmCtx.N = N_;
                 brgemmCtx.K = K_;
-                brgemmCtx.LDA = batch1 * K0;
+                brgemmCtx.LDA = strTranspose0In0[1];
                 brgemmCtx.LDB = rnd_up(N0, N0_blk);
                 brgemmCtx.LDC = N0;
                 brgemmCtx.dt_in0 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg0Prc));
@@ -1039,8 +1049,8 @@ void MHA::prepareParams() {
                 brgemmCtx.N = N_;
                 brgemmCtx.K = K_;
                 brgemmCtx.LDA = K1;
-                brgemmCtx.LDB = brg1PrcIn1 == Precision::FP32 ? batch1 * N1 : rnd_up(N1, N1_blk);
-                brgemmCtx.LDC = accPrecision1 == outputPrecision ? batch1 * N1 : N1;
+                brgemmCtx.LDB = brg1PrcIn1 == Precision::FP32 ? strTranspose2In0[1] : rnd_up(N1, N1_blk);
+                brgemmCtx.LDC = accPrecision1 == outputPrecision ? strOut[1] : N1;
                 brgemmCtx.dt_in0 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg1PrcIn0));
                 brgemmCtx.dt_in1 = static_cast<dnnl_data_type_t>(DnnlExtensionUtils::IEPrecisionToDataType(brg1PrcIn1));
                 brgemmCtx.beta = beta;
@@ -1058,7 +1068,7 @@ void MHA::prepareParams() {
 
     auto& brgemmCtx1 = brgCtxs1[brg1BaseIdx];
     if (brgemmCtx1.is_with_amx || brg1PrcIn1 == Precision::I8 || brg1PrcIn1 == Precision::BF16) {
-        init_brgemm_copy_b(brgCopyBKernel1, batch1 * N1, N1_blk, N1_tail, brgemmCtx1.LDB, brgemmCtx1.K,
+        init_brgemm_copy_b(brgCopyBKernel1, strTranspose2In0[1], N1_blk, N1_tail, brgemmCtx1.LDB, brgemmCtx1.K,
             brgemmCtx1.is_with_amx, brgemmCtx1.dt_in0, brgemmCtx1.dt_in1);
     }
 
@@ -1070,23 +1080,22 @@ void MHA::prepareParams() {
     bufferCompensation0Size = rnd_up(N0, N0_blk);
     bufferCompensation1Size = rnd_up(N1, N1_blk);
 
-    if (brgCopyAKernel0) {
-        bufferMatMul0In0.resize(numThreads * bufferMatMul0In0Size);
-    }
-    bufferMatMul0In1.resize(numThreads * bufferMatMul0In1Size);
-    bufferMatMul0Out.resize(numThreads * bufferMatMul0OutSize);
-    bufferMatMul1In1.resize(numThreads * bufferMatMul1In1Size);
-    bufferMatMul1Out.resize(numThreads * bufferMatMul1OutSize);
-    if (brgemmCtx0.is_with_comp) {
-        bufferCompensation0.resize(numThreads * bufferCompensation0Size);
-    }
-    if (brgemmCtx1.is_with_comp) {
-        bufferCompensation1.resize(numThreads * bufferCompensation1Size);
-    }
-
-    if (brgemmCtx0.is_with_amx || brgemmCtx1.is_with_amx) {
-        wsp.resize(numThreads * wsp_size_per_thread);
-    }
+    buffersThreadsNum = numThreads;
+    withCompensation0 = brgemmCtx0.is_with_comp;
+    withCompensation1 = brgemmCtx1.is_with_comp;
+    withWsp = brgemmCtx0.is_with_amx || brgemmCtx1.is_with_amx;
+
+    size_t scratchSize = ScratchArena::alignedSize(numThreads * bufferMatMul0In1Size) +
+                         ScratchArena::alignedSize(numThreads * bufferMatMul0OutSize) +
+                         ScratchArena::alignedSize(numThreads * bufferMatMul1In1Size) +
+                         ScratchArena::alignedSize(numThreads * bufferMatMul1OutSize);
+    if (withCompensation0)
+        scratchSize += ScratchArena::alignedSize(numThreads * bufferCompensation0Size * sizeof(int32_t));
+    if (withCompensation1)
+        scratchSize += ScratchArena::alignedSize(numThreads * bufferCompensation1Size * sizeof(int32_t));
+    if (withWsp)
+        scratchSize += ScratchArena::alignedSize(numThreads * wsp_size_per_thread * sizeof(size_t));
+    reserveScratchBuffer(scratchSize);
 
     {
         jit_mul_add_softmax_compile_params jcp;
@@ -1122,7 +1131,7 @@ void MHA::prepareParams() {
         jcp.with_scales = !fqScales3.empty();
         jcp.broadcast_scales = fqScales3.size() == 1;
         jcp.src_stride = N1;
-        jcp.dst_stride = batch1 * N1;
+        jcp.dst_stride = strOut[1];
 
 #if defined(OPENVINO_ARCH_X86_64)
         if (mayiuse(cpu_isa_t::avx512_core)) {
@@ -1223,18 +1232,28 @@ void MHA::mhaImpl() {
 
     auto outPrcSize = outputPrecision.size();
 
+    // the allocation order and sizes match the reservation in prepareParams
+    auto arena = getScratchArena();
+    auto bufferMatMul0In1 = arena.allocate<uint8_t>(buffersThreadsNum * bufferMatMul0In1Size);
+    auto bufferMatMul0Out = arena.allocate<uint8_t>(buffersThreadsNum * bufferMatMul0OutSize);
+    auto bufferMatMul1In1 = arena.allocate<uint8_t>(buffersThreadsNum * bufferMatMul1In1Size);
+    auto bufferMatMul1Out = arena.allocate<uint8_t>(buffersThreadsNum * bufferMatMul1OutSize);
+    auto bufferCompensation0 = withCompensation0 ? arena.allocate<int32_t>(buffersThreadsNum * bufferCompensation0Size) : nullptr;
+    auto bufferCompensation1 = withCompensation1 ? arena.allocate<int32_t>(buffersThreadsNum * bufferCompensation1Size) : nullptr;
+    auto wspBuffer = withWsp ? arena.allocate<size_t>(buffersThreadsNum * wsp_size_per_thread) : nullptr;
+
     parallel_for2d(dimsMatMul0Out[0], dimsMatMul0Out[1], [&](size_t i0, size_t i1) {
         size_t threadNum = parallel_get_thread_num();
 
         auto pTranspose0In0_aux = pTranspose0In0 + (i0 * strTranspose0In0[0] + i1 * strTranspose0In0[2]) * inputPrecisions[0].size(); // order 0213
         auto pTranspose1In0_aux = pTranspose1In0 + (i0 * strTranspose1In0[0] + i1 * strTranspose1In0[2]) * inputPrecisions[1].size(); // order 0231
 
-        auto pAddIn1_aux = pAddIn1 + i0 * strAddIn1[0]; // order 0231
+        auto pAddIn1_aux = pAddIn1 + (dimsAddIn1[0] == 1 ? 0 : i0 * strAddIn1[0]); // order 0231
 
-        auto bufferMatMul0In1_local = reinterpret_cast<uint8_t*>(bufferMatMul0In1.data() + threadNum * bufferMatMul0In1Size);
-        auto bufferMatMul0Out_local = reinterpret_cast<uint8_t*>(bufferMatMul0Out.data() + threadNum * bufferMatMul0OutSize);
-        auto bufferMatMul1In1_local = reinterpret_cast<uint8_t*>(bufferMatMul1In1.data() + threadNum * bufferMatMul1In1Size);
-        auto bufferMatMul1Out_local = reinterpret_cast<uint8_t*>(bufferMatMul1Out.data() + threadNum * bufferMatMul1OutSize);
+        auto bufferMatMul0In1_local = bufferMatMul0In1 + threadNum * bufferMatMul0In1Size;
+        auto bufferMatMul0Out_local = bufferMatMul0Out + threadNum * bufferMatMul0OutSize;
+        auto bufferMatMul1In1_local = bufferMatMul1In1 + threadNum * bufferMatMul1In1Size;
+        auto bufferMatMul1Out_local = bufferMatMul1Out + threadNum * bufferMatMul1OutSize;
 
         auto pTranspose1Out_aux = brgCopyBKernel0 ? bufferMatMul1In1_local
                                                   : bufferMatMul0In1_local;
@@ -1252,14 +1271,14 @@ void MHA::mhaImpl() {
                       {strTranspose1In0[3], strTranspose1In0[1]});
         }
 
-        auto bufferCompensation0_aux = !bufferCompensation0.empty()
-            ? bufferCompensation0.data() + threadNum * bufferCompensation0Size
+        auto bufferCompensation0_aux = bufferCompensation0
+            ? bufferCompensation0 + threadNum * bufferCompensation0Size
             : nullptr;
-        auto bufferCompensation1_aux = !bufferCompensation1.empty()
-            ? bufferCompensation1.data() + threadNum * bufferCompensation1Size
+        auto bufferCompensation1_aux = bufferCompensation1
+            ? bufferCompensation1 + threadNum * bufferCompensation1Size
             : nullptr;
 
-        auto wsp_local = !wsp.empty() ? wsp.data() + threadNum * wsp_size_per_thread : nullptr;
+        auto wsp_local = wspBuffer ? wspBuffer + threadNum * wsp_size_per_thread : nullptr;
 
         auto pMatMul0In1 = reinterpret_cast<uint8_t*>(pTranspose1Out_aux);
         if (brgCopyBKernel0) {
@@ -1313,7 +1332,7 @@ void MHA::mhaImpl() {
             const bool is_M_tail = (M - mb * M_blk < M_blk);
             auto cur_M_blk = is_M_tail ? M_tail : M_blk;
 
-            auto pMatMul0In0 = pTranspose0In0_aux + (mb * M_blk * batch1 * K0) * inputPrecisions[0].size();
+            auto pMatMul0In0 = pTranspose0In0_aux + (mb * M_blk * strTranspose0In0[1]) * inputPrecisions[0].size();
 
             // TODO: matrix A copy should be performed to enable AMX matmuls for arbitrary shapes
             // if (brgCopyAKernel0) {
@@ -1381,7 +1400,7 @@ void MHA::mhaImpl() {
             auto pOut_aux = pout + (i0 * strOut[0] + i1 * strOut[2]) * outPrcSize;
 
             auto pMatMul1Out = outputPrecision == Precision::FP32
-                ? pOut_aux + (mb * M_blk * batch1 * N1) * outPrcSize
+                ? pOut_aux + (mb * M_blk * strOut[1]) * outPrcSize
                 : bufferMatMul1Out_local;
 
             size_t brgIdx1 = getBrgIdx(0, 0, 0);
@@ -1409,7 +1428,7 @@ void MHA::mhaImpl() {
             if (convertReorderKernel) {
                 jit_convert_reorder_call_args call_args;
                 call_args.p_in = pMatMul1Out;
-                call_args.p_out = pOut_aux + (mb * M_blk * batch1 * N1) * outPrcSize;
+                call_args.p_out = pOut_aux + (mb * M_blk * strOut[1]) * outPrcSize;
                 call_args.p_scales = fqScales3.data();
                 call_args.outter_work_amount = cur_M_blk;
 
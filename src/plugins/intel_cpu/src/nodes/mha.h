@@ -206,14 +206,11 @@ private:
     size_t bufferCompensation1Size = 0;
     size_t wsp_size_per_thread = 4 * 1024;
 
-    std::vector<uint8_t> bufferMatMul0In0;
-    std::vector<uint8_t> bufferMatMul0In1;
-    std::vector<uint8_t> bufferMatMul0Out;
-    std::vector<uint8_t> bufferMatMul1In1;
-    std::vector<uint8_t> bufferMatMul1Out;
-    std::vector<int32_t> bufferCompensation0;
-    std::vector<int32_t> bufferCompensation1;
-    std::vector<size_t> wsp;
+    // the per thread buffers are allocated in the node scratch buffer
+    size_t buffersThreadsNum = 0;
+    bool withCompensation0 = false;
+    bool withCompensation1 = false;
+    bool withWsp = false;
 
     bool isMulFirst;
     InferenceEngine::Precision fqPrc2;
@@ -2249,6 +2249,10 @@ void MVN::MVNJitExecutor::mvn_pln(const uint8_t* src_data, uint8_t* dst_data, co
                 });
             }
         });
+    } else if (N * C < static_cast<size_t>(parallel_get_max_threads()) && C2 >= 2 * SPLIT_MIN_CHUNK_LEN) {
+        // there are less channels than threads, e.g. LayerNorm of one token, so the threads share the channels
+        const size_t chunksNum = std::min(div_up(static_cast<size_t>(parallel_get_max_threads()), N * C), C2 / SPLIT_MIN_CHUNK_LEN);
+        mvn_pln_split(src_data, dst_data, post_ops_data_, shape5d, blk_size, chunksNum);
     } else {
         parallel_for2d(N, C, [&](size_t b, size_t c) {
             size_t cb = b * C3;
@@ -2293,6 +2297,82 @@ void MVN::MVNJitExecutor::mvn_pln(const uint8_t* src_data, uint8_t* dst_data, co
     }
 }
 
+void MVN::MVNJitExecutor::mvn_pln_split(const uint8_t* src_data, uint8_t* dst_data, const void *post_ops_data_, const VectorDims& shape5d,
+                                        size_t blk_size, size_t chunksNum) {
+    const size_t C = shape5d[1];
+    const size_t NC = shape5d[0] * C;
+    const size_t C2 = shape5d[2] * shape5d[3] * shape5d[4];
+    const size_t chunkLen = rnd_up(div_up(C2, chunksNum), blk_size);
+    chunksNum = div_up(C2, chunkLen);
+
+    // the mean and the sum of the squared deviations of each chunk are computed while the chunk is in the cache
+    // and merged into the channel ones as in the parallel Welford algorithm, so the data is read from the memory
+    // once for the statistics and once for the normalization
+    std::vector<float> chunkMean(NC * chunksNum);
+    std::vector<float> chunkM2(NC * chunksNum, 0.f);
+    parallel_for2d(NC, chunksNum, [&](size_t bc, size_t chunk) {
+        const size_t start = chunk * chunkLen;
+        const size_t len = std::min(chunkLen, C2 - start);
+        float sum = 0.f;
+        auto arg = jit_mvn_call_args();
+        arg.src = src_data + (bc * C2 + start) * src_data_size;
+        arg.sum = static_cast<float*>(&sum);
+        arg.work_amount = static_cast<size_t>(len / blk_size);
+        arg.rt_shape_size = static_cast<size_t>(len % blk_size);
+        arg.oc_off = static_cast<size_t>((bc % C) * sizeof(float));
+        arg.post_op_data = post_ops_data_;
+        (*mvn_mean_kernel)(&arg);
+
+        float mean = sum / static_cast<float>(len);
+        chunkMean[bc * chunksNum + chunk] = mean;
+        if (mvnAttrs.normalizeVariance_) {
+            float m2 = 0.f;
+            arg.mean = static_cast<float*>(&mean);
+            arg.variance = static_cast<float*>(&m2);
+            (*mvn_variance_kernel)(&arg);
+            chunkM2[bc * chunksNum + chunk] = m2;
+        }
+    });
+
+    std::vector<float> means(NC);
+    std::vector<float> variances(NC, 1.f);
+    for (size_t bc = 0; bc < NC; bc++) {
+        float mean = 0.f;
+        for (size_t chunk = 0; chunk < chunksNum; chunk++)
+            mean += chunkMean[bc * chunksNum + chunk] * static_cast<float>(std::min(chunkLen, C2 - chunk * chunkLen));
+        mean /= static_cast<float>(C2);
+        means[bc] = mean;
+
+        if (mvnAttrs.normalizeVariance_) {
+            float m2 = 0.f;
+            for (size_t chunk = 0; chunk < chunksNum; chunk++) {
+                const float delta = chunkMean[bc * chunksNum + chunk] - mean;
+                m2 += chunkM2[bc * chunksNum + chunk] + delta * delta * static_cast<float>(std::min(chunkLen, C2 - chunk * chunkLen));
+            }
+            if (mvnAttrs.epsMode_ == INSIDE_SQRT)
+                variances[bc] = 1.f / sqrtf(m2 / static_cast<float>(C2) + mvnAttrs.epsValue_);
+            else if (mvnAttrs.epsMode_ == OUTSIDE_SQRT)
+                variances[bc] = 1.f / (sqrtf(m2 / static_cast<float>(C2)) + mvnAttrs.epsValue_);
+        }
+    }
+
+    parallel_for2d(NC, chunksNum, [&](size_t bc, size_t chunk) {
+        const size_t start = chunk * chunkLen;
+        const size_t len = std::min(chunkLen, C2 - start);
+        auto arg = jit_mvn_call_args();
+        arg.src = src_data + (bc * C2 + start) * src_data_size;
+        arg.dst = dst_data + (bc * C2 + start) * dst_data_size;
+        arg.mean = &means[bc];
+        if (mvnAttrs.normalizeVariance_)
+            arg.variance = &variances[bc];
+        arg.work_amount = static_cast<size_t>(len / blk_size);
+        arg.rt_shape_size = static_cast<size_t>(len % blk_size);
+        arg.oc_off = static_cast<size_t>((bc % C) * sizeof(float));
+        arg.post_op_data = post_ops_data_;
+        (*mvn_kernel)(&arg);
+    });
+}
+
 void MVN::MVNRefExecutor::mvn_ref(const uint8_t* src_data, uint8_t* dst_data, const VectorDims& shape5d) {
     const float *src_data_ptr = reinterpret_cast<const float *>(src_data);
     float *dst_data_ptr = reinterpret_cast<float *>(dst_data);
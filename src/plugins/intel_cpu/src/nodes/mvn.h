@@ -136,10 +136,16 @@ private:
             void mvn_pln(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_, const VectorDims& shape5d);
             void mvn_blk(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_, const VectorDims& shape5d);
             void mvn_nspc(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_, const VectorDims& shape5d);
+            // the planar per channel case with a few long channels, each channel is split between the threads
+            void mvn_pln_split(const uint8_t *in_ptr_, uint8_t *out_ptr_, const void *post_ops_data_, const VectorDims& shape5d,
+                               size_t blk_size, size_t chunksNum);
 
             std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_mean_kernel;
             std::shared_ptr<jit_uni_mvn_mean_variance_kernel> mvn_variance_kernel;
             std::shared_ptr<jit_uni_mvn_kernel> mvn_kernel;
+
+            // the shortest part of a channel worth computing by a separate thread
+            static constexpr size_t SPLIT_MIN_CHUNK_LEN = 2048;
     };
 
     class MVNRefExecutor : public MVNExecutorBase {
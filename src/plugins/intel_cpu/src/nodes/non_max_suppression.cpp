@@ -554,6 +554,18 @@ private:
 };
 #endif
 
+namespace {
+// the number of the candidates since which the suppression is done by the IoU bitmask matrix
+constexpr size_t iouMaskMinBoxes = 1024;
+// the sequential loop compares a candidate with at most max_output_boxes_per_class selected boxes and stops once they
+// are selected, while even the first tile of the bitmask rows costs the IoU of the tile with all the candidates, so
+// the bitmask is used for the bigger outputs only
+constexpr size_t iouMaskMinOutBoxes = 64;
+// the number of the candidates whose IoU bitmask rows are computed at once
+constexpr size_t iouMaskTileSize = 256;
+constexpr size_t iouMaskWordBits = 64;
+}  // namespace
+
 bool NonMaxSuppression::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
         using NonMaxSuppressionV9 = ngraph::op::v9::NonMaxSuppression;
@@ -1007,7 +1019,18 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
 
         int io_selection_size = 0;
         size_t sortedBoxSize = sorted_boxes.size();
-        if (sortedBoxSize > 0) {
+        if (sortedBoxSize >= iouMaskMinBoxes && maxOutputBoxesPerClass >= iouMaskMinOutBoxes) {
+            parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
+                          [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
+                              return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
+                          });
+            int offset = batch_idx*numClasses*maxOutputBoxesPerClass + class_idx*maxOutputBoxesPerClass;
+            for (auto candidate_idx : nmsByIoUMask(boxesPtr, sorted_boxes, maxOutputBoxesPerClass)) {
+                filtBoxes[offset + io_selection_size] =
+                    filteredBoxes(sorted_boxes[candidate_idx].first, batch_idx, class_idx, sorted_boxes[candidate_idx].second);
+                io_selection_size++;
+            }
+        } else if (sortedBoxSize > 0) {
             parallel_sort(sorted_boxes.begin(), sorted_boxes.end(),
                           [](const std::pair<float, int>& l, const std::pair<float, int>& r) {
                               return (l.first > r.first || ((l.first == r.first) && (l.second < r.second)));
@@ -1079,6 +1102,80 @@ void NonMaxSuppression::nmsWithoutSoftSigma(const float *boxes, const float *sco
     });
 }
 
+std::vector<size_t> NonMaxSuppression::nmsByIoUMask(const float *boxes, const std::vector<std::pair<float, int>> &sortedBoxes,
+                                                     size_t maxOutBoxes) const {
+    const size_t n = sortedBoxes.size();
+    // the corner coordinates and the areas are computed once, the same way as in intersectionOverUnion
+    std::vector<float> ymin(n), xmin(n), ymax(n), xmax(n), area(n);
+    const bool centerEncoding = boxEncodingType == NMSBoxEncodeType::CENTER;
+    parallel_for(n, [&](size_t i) {
+        const float *box = boxes + sortedBoxes[i].second * 4;
+        if (centerEncoding) {
+            ymin[i] = box[1] - box[3] / 2.f;
+            xmin[i] = box[0] - box[2] / 2.f;
+            ymax[i] = box[1] + box[3] / 2.f;
+            xmax[i] = box[0] + box[2] / 2.f;
+        } else {
+            ymin[i] = (std::min)(box[0], box[2]);
+            xmin[i] = (std::min)(box[1], box[3]);
+            ymax[i] = (std::max)(box[0], box[2]);
+            xmax[i] = (std::max)(box[1], box[3]);
+        }
+        area[i] = (ymax[i] - ymin[i]) * (xmax[i] - xmin[i]);
+    });
+
+    const float threshold = iouThreshold;
+    auto iouMaskWord = [&](size_t i, size_t jStart, size_t jEnd) {
+        uint64_t bits = 0;
+        for (size_t j = jStart; j < jEnd; j++) {
+            float iou = 0.f;
+            if (area[i] > 0.f && area[j] > 0.f) {
+                const float intersection =
+                    (std::max)((std::min)(ymax[i], ymax[j]) - (std::max)(ymin[i], ymin[j]), 0.f) *
+                    (std::max)((std::min)(xmax[i], xmax[j]) - (std::max)(xmin[i], xmin[j]), 0.f);
+                iou = intersection / (area[i] + area[j] - intersection);
+            }
+            bits |= static_cast<uint64_t>(iou >= threshold) << (j % iouMaskWordBits);
+        }
+        return bits;
+    };
+
+    const size_t words = div_up(n, iouMaskWordBits);
+    std::vector<uint64_t> suppressed(words, 0);
+    std::vector<uint64_t> tileMask(iouMaskTileSize * words);
+    auto isSuppressed = [&](size_t i) {
+        return (suppressed[i / iouMaskWordBits] >> (i % iouMaskWordBits)) & 1;
+    };
+
+    std::vector<size_t> selected;
+    for (size_t tileStart = 0; tileStart < n && selected.size() < maxOutBoxes; tileStart += iouMaskTileSize) {
+        const size_t tileEnd = (std::min)(n, tileStart + iouMaskTileSize);
+        // the row i keeps the candidates after i suppressed by the candidate i, the rows of the already suppressed
+        // candidates are never used
+        parallel_for(tileEnd - tileStart, [&](size_t t) {
+            const size_t i = tileStart + t;
+            if (isSuppressed(i))
+                return;
+            uint64_t *mask = &tileMask[t * words];
+            for (size_t w = (i + 1) / iouMaskWordBits; w < words; w++) {
+                const size_t jStart = (std::max)(i + 1, w * iouMaskWordBits);
+                const size_t jEnd = (std::min)(n, (w + 1) * iouMaskWordBits);
+                mask[w] = iouMaskWord(i, jStart, jEnd);
+            }
+        });
+
+        for (size_t i = tileStart; i < tileEnd && selected.size() < maxOutBoxes; i++) {
+            if (isSuppressed(i))
+                continue;
+            selected.push_back(i);
+            const uint64_t *mask = &tileMask[(i - tileStart) * words];
+            for (size_t w = (i + 1) / iouMaskWordBits; w < words; w++)
+                suppressed[w] |= mask[w];
+        }
+    }
+    return selected;
+}
+
 void NonMaxSuppression::checkPrecision(const Precision& prec, const std::vector<Precision>& precList,
                                                            const std::string& name, const std::string& type) {
     if (std::find(precList.begin(), precList.end(), prec) == precList.end())
@@ -97,6 +97,13 @@ public:
     void nmsWithoutSoftSigma(const float *boxes, const float *scores, const SizeVector &boxesStrides,
                              const SizeVector &scoresStrides, std::vector<filteredBoxes> &filtBoxes);
 
+    /**
+     * @brief Hard suppression of the sorted candidates by the tiles of the IoU bitmask matrix. The bitmask rows of a tile
+     * of candidates are computed in parallel, after that the tile is scanned sequentially to select the boxes.
+     * @return the selected candidates indexes in the sorted candidates, in the selection order
+     */
+    std::vector<size_t> nmsByIoUMask(const float *boxes, const std::vector<std::pair<float, int>> &sortedBoxes, size_t maxOutBoxes) const;
+
     void executeDynamicImpl(dnnl::stream strm) override;
 
     bool isExecutable() const override;
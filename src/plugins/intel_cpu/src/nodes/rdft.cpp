@@ -180,6 +180,29 @@ bool RDFT::created() const {
     return getType() == Type::RDFT;
 }
 
+struct RDFTTwiddlesKey {
+    bool isInverse;
+    size_t signalSize;
+    size_t outputSize;
+    enum dft_type type;
+
+    size_t hash() const {
+        using namespace dnnl::impl::primitive_hashing;
+
+        size_t seed = 0;
+        seed = hash_combine(seed, isInverse);
+        seed = hash_combine(seed, signalSize);
+        seed = hash_combine(seed, outputSize);
+        seed = hash_combine(seed, static_cast<int>(type));
+        return seed;
+    }
+
+    bool operator==(const RDFTTwiddlesKey& rhs) const {
+        return isInverse == rhs.isInverse && signalSize == rhs.signalSize && outputSize == rhs.outputSize &&
+               type == rhs.type;
+    }
+};
+
 void RDFT::prepareParams() {
     if (axesChanged()) {
         const auto& axesMem = getParentEdgeAt(AXES_INDEX)->getMemoryPtr();
@@ -220,8 +243,24 @@ void RDFT::prepareParams() {
         }
     }
 
+    // the twiddles are the plan of the transform: with the dynamic signal length they are taken from the cache
+    // when the length comes back instead of being recomputed on each shape change
     const auto& outputShape = getChildEdgeAt(0)->getMemory().getStaticDims();
-    twiddles = executor->generateTwiddles(signalSizes, outputShape, axes);
+    auto cache = context->getParamsCache();
+    auto buildTwiddles = [this](const RDFTTwiddlesKey& key) -> RDFTTwiddlesPtr {
+        return std::make_shared<const std::vector<float>>(executor->generateTwiddles(key.signalSize, key.outputSize, key.type));
+    };
+    twiddles.resize(axes.size());
+    for (size_t i = 0; i < axes.size(); i++) {
+        RDFTTwiddlesKey key{};
+        key.isInverse = inverse;
+        key.signalSize = static_cast<size_t>(signalSizes[i]);
+        key.outputSize = outputShape[axes[i]];
+        key.type = complex_to_complex;
+        if (i == axes.size() - 1)
+            key.type = inverse ? complex_to_real : real_to_complex;
+        twiddles[i] = cache->getOrCreate(key, buildTwiddles).first;
+    }
 }
 
 bool RDFT::axesChanged() const {
@@ -306,7 +345,7 @@ static void adjustInputSize(VectorDims& inputShape,
 }
 
 void RDFTExecutor::execute(float* inputPtr, float* outputPtr,
-                           const std::vector<std::vector<float>>& twiddles,
+                           const std::vector<RDFTTwiddlesPtr>& twiddles,
                            size_t rank, const std::vector<int>& axes,
                            std::vector<int> signalSizes,
                            VectorDims inputShape, const VectorDims& outputShape,
@@ -314,11 +353,12 @@ void RDFTExecutor::execute(float* inputPtr, float* outputPtr,
     adjustInputSize(inputShape, signalSizes, outputShape, axes, isInverse);
 
     if (rank == 1) {
-        auto twiddlesPtr = twiddles[0].data();
+        // a single transform, so all the threads work inside it
+        auto twiddlesPtr = twiddles[0]->data();
         dftCommon(inputPtr, twiddlesPtr, outputPtr,
                    inputShape[0], signalSizes[0], outputShape[0],
                    isInverse ? complex_to_real : real_to_complex,
-                   canUseFFT(signalSizes[0]), false);
+                   canUseFFT(signalSizes[0]), true);
     } else {
         if (!isInverse)
             rdftNd(inputPtr, outputPtr, twiddles, axes, signalSizes, inputShape, inputStrides, outputShape, outputStrides);
@@ -467,14 +507,14 @@ void RDFTExecutor::fft(float* input, const float* twiddlesPtr, float* output,
     size_t numBlocks = 0;
     size_t blockSize = 0;
 
-    auto blockIteration = [&] (size_t block) {
+    auto blockIteration = [&] (size_t block, size_t pairStart, size_t pairEnd) {
         size_t inputOffset = block * blockSize;
         size_t outputOffset = block * blockSize / 2;
         float cos = twiddlesPtr[2 * block];
         float sin = twiddlesPtr[2 * block + 1];
         if (isInverse)
             sin = -sin;
-        for (size_t pair = 0; pair < blockSize / 2; pair++) {
+        for (size_t pair = pairStart; pair < pairEnd; pair++) {
             float evenReal = inputPtr[2 * (inputOffset + pair)];
             float evenImag = inputPtr[2 * (inputOffset + pair) + 1];
             float oddReal = inputPtr[2 * (inputOffset + blockSize / 2 + pair)];
@@ -497,11 +537,17 @@ void RDFTExecutor::fft(float* input, const float* twiddlesPtr, float* output,
         if (numBlocks == signalSize / 2 && outputSize == signalSize && type != complex_to_real) {
             outputPtr = output;
         }
+        const size_t pairsNum = blockSize / 2;
         if (parallelize) {
-            parallel_for(numBlocks, blockIteration);
+            // the first stages have less blocks than threads, so the pairs of a block are split between the threads
+            const size_t chunksNum = std::min(pairsNum, div_up(static_cast<size_t>(parallel_get_max_threads()), numBlocks));
+            const size_t chunkSize = div_up(pairsNum, chunksNum);
+            parallel_for2d(numBlocks, chunksNum, [&](size_t block, size_t chunk) {
+                blockIteration(block, chunk * chunkSize, std::min(pairsNum, (chunk + 1) * chunkSize));
+            });
         } else {
             for (size_t block = 0; block < numBlocks; block++) {
-                blockIteration(block);
+                blockIteration(block, 0, pairsNum);
             }
         }
         twiddlesPtr += numBlocks * 2;
@@ -616,7 +662,7 @@ void RDFTExecutor::dftOnAxis(enum dft_type type,
 
 // N-dimensional real DFT
 void RDFTExecutor::rdftNd(float* inputPtr, float* outputPtr,
-                          const std::vector<std::vector<float>>& twiddles,
+                          const std::vector<RDFTTwiddlesPtr>& twiddles,
                           const std::vector<int>& axes,
                           const std::vector<int>& signalSizes,
                           const VectorDims& inputShape,
@@ -626,7 +672,7 @@ void RDFTExecutor::rdftNd(float* inputPtr, float* outputPtr,
     const std::vector<size_t> iterationRange(outputShape.begin(), outputShape.end() - 1);
 
     dftOnAxis(real_to_complex, inputPtr, outputPtr,
-                twiddles.back().data(), axes.back(),
+                twiddles.back()->data(), axes.back(),
                 signalSizes.back(),
                 inputShape, inputStrides,
                 outputShape, outputStrides,
@@ -636,7 +682,7 @@ void RDFTExecutor::rdftNd(float* inputPtr, float* outputPtr,
     for (size_t i = 0; i < axes.size() - 1; i++) {
         auto axis = axes[i];
         dftOnAxis(complex_to_complex, inputPtr, outputPtr,
-                    twiddles[i].data(), axis,
+                    twiddles[i]->data(), axis,
                     signalSizes[i],
                     outputShape, outputStrides,
                     outputShape, outputStrides,
@@ -646,7 +692,7 @@ void RDFTExecutor::rdftNd(float* inputPtr, float* outputPtr,
 
 // N-dimensional real inverse DFT
 void RDFTExecutor::irdftNd(float* inputPtr, float* outputPtr,
-                           const std::vector<std::vector<float>>& twiddles,
+                           const std::vector<RDFTTwiddlesPtr>& twiddles,
                            const std::vector<int>& axes,
                            const std::vector<int>& signalSizes,
                            const VectorDims& inputShape,
@@ -657,7 +703,7 @@ void RDFTExecutor::irdftNd(float* inputPtr, float* outputPtr,
 
     if (axes.size() == 1) {
         dftOnAxis(complex_to_real, inputPtr, outputPtr,
-                    twiddles[0].data(), axes[0],
+                    twiddles[0]->data(), axes[0],
                     signalSizes[0],
                     inputShape, originalInputStrides,
                     outputShape, outputStrides,
@@ -683,7 +729,7 @@ void RDFTExecutor::irdftNd(float* inputPtr, float* outputPtr,
     for (size_t i = 0; i < axes.size() - 1; i++) {
         auto axis = axes[i];
         dftOnAxis(complex_to_complex, inputPtr, output,
-                    twiddles[i].data(), axis,
+                    twiddles[i]->data(), axis,
                     signalSizes[i],
                     inputShape, originalInputStrides,
                     inputShape, inputStrides,
@@ -691,7 +737,7 @@ void RDFTExecutor::irdftNd(float* inputPtr, float* outputPtr,
         inputPtr = output;
     }
     dftOnAxis(complex_to_real, inputPtr, outputPtr,
-                twiddles.back().data(), axes.back(),
+                twiddles.back()->data(), axes.back(),
                 signalSizes.back(),
                 inputShape, inputStrides,
                 outputShape, outputStrides,
@@ -710,30 +756,12 @@ std::vector<float> RDFTExecutor::generateTwiddlesFFT(size_t N) {
     return twiddles;
 }
 
-std::vector<float> RDFTExecutor::generateTwiddlesCommon(size_t signalSize, size_t outputSize,
-                                                          enum dft_type type, bool useFFT) {
-    if (useFFT) {
+std::vector<float> RDFTExecutor::generateTwiddles(size_t signalSize, size_t outputSize, enum dft_type type) {
+    if (canUseFFT(signalSize)) {
         return generateTwiddlesFFT(signalSize);
     }
     return generateTwiddlesDFT(signalSize, outputSize, type);
 }
-
-std::vector<std::vector<float>> RDFTExecutor::generateTwiddles(const std::vector<int>& signalSizes,
-                                                               const std::vector<size_t>& outputShape,
-                                                               const std::vector<int>& axes) {
-    std::vector<std::vector<float>> twiddles;
-    twiddles.reserve(axes.size());
-    for (size_t i = 0; i < axes.size(); i++) {
-        auto axis = axes[i];
-        size_t N = signalSizes[i];
-        size_t K = outputShape[axis];
-        auto type = complex_to_complex;
-        if (i == axes.size() - 1)
-            type = isInverse ? complex_to_real : real_to_complex;
-        twiddles.push_back(generateTwiddlesCommon(N, K, type, canUseFFT(N)));
-    }
-    return twiddles;
-}
 #if defined(OPENVINO_ARCH_X86_64)
 struct RDFTJitExecutor : public RDFTExecutor {
     RDFTJitExecutor(bool inverse, NodeDesc* primDesc) : RDFTExecutor(inverse) {
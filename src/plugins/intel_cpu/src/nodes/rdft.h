@@ -14,19 +14,20 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+using RDFTTwiddlesPtr = std::shared_ptr<const std::vector<float>>;
+
 struct RDFTExecutor {
     public:
         RDFTExecutor(bool inverse) : isInverse(inverse) {}
         void execute(float* inputPtr, float* outputPtr,
-                     const std::vector<std::vector<float>>& twiddles,
+                     const std::vector<RDFTTwiddlesPtr>& twiddles,
                      size_t rank, const std::vector<int>& axes,
                      std::vector<int> signalSizes,
                      VectorDims inputShape, const VectorDims& outputShape,
                      const VectorDims& inputStrides, const VectorDims& outputStrides);
 
-        std::vector<std::vector<float>> generateTwiddles(const std::vector<int>& signalSizes,
-                                                         const std::vector<size_t>& outputShape,
-                                                         const std::vector<int>& axes);
+        // the twiddle factors of the transform along one axis, they depend only on the sizes and the type
+        std::vector<float> generateTwiddles(size_t signalSize, size_t outputSize, enum dft_type type);
 
     protected:
         bool isInverse;
@@ -52,7 +53,7 @@ struct RDFTExecutor {
                          const VectorDims& outputStrides,
                          const std::vector<size_t>& iteration_range);
         void rdftNd(float* inputPtr, float* outputPtr,
-                    const std::vector<std::vector<float>>& twiddles,
+                    const std::vector<RDFTTwiddlesPtr>& twiddles,
                     const std::vector<int>& axes,
                     const std::vector<int>& signalSizes,
                     const VectorDims& inputShape,
@@ -60,7 +61,7 @@ struct RDFTExecutor {
                     const VectorDims& outputShape,
                     const VectorDims& outputStrides);
         void irdftNd(float* inputPtr, float* outputPtr,
-                     const std::vector<std::vector<float>>& twiddles,
+                     const std::vector<RDFTTwiddlesPtr>& twiddles,
                      const std::vector<int>& axes,
                      const std::vector<int>& signalSizes,
                      const VectorDims& inputShape,
@@ -69,8 +70,6 @@ struct RDFTExecutor {
                      const VectorDims& outputStrides);
         virtual std::vector<float> generateTwiddlesDFT(size_t inputSize, size_t outputSize, enum dft_type type) = 0;
         std::vector<float> generateTwiddlesFFT(size_t N);
-        std::vector<float> generateTwiddlesCommon(size_t inputSize, size_t outputSize,
-                                                  enum dft_type type, bool useFFT);
 };
 
 class RDFT : public Node {
@@ -98,7 +97,8 @@ private:
     bool inverse;
     std::vector<int> axes;
     std::vector<int> signalSizes;
-    std::vector<std::vector<float>> twiddles;
+    // the twiddles of each axis, shared with the other RDFT nodes of the same sizes through the params cache
+    std::vector<RDFTTwiddlesPtr> twiddles;
     std::shared_ptr<RDFTExecutor> executor;
     bool isAxesConstant = false;
     bool isSignalSizesConstant = false;
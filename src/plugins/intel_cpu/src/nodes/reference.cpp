@@ -9,7 +9,18 @@
 #include "openvino/runtime/tensor.hpp"
 #include "common/blocked_desc_creator.h"
 #include <ngraph/opsets/opset1.hpp>
+#include <openvino/op/util/binary_elementwise_arithmetic.hpp>
+#include <openvino/op/util/binary_elementwise_comparison.hpp>
+#include <openvino/op/util/binary_elementwise_logical.hpp>
+#include <openvino/op/util/unary_elementwise_arithmetic.hpp>
+#include <openvino/opsets/opset12.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/general_utils.h"
+#include <ie_parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <unordered_set>
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -19,6 +30,102 @@ namespace ov {
 namespace intel_cpu {
 namespace node {
 
+namespace {
+// the smaller outputs are evaluated by a single thread, since the threads wake up costs more than the evaluation
+constexpr size_t parallelEvaluationThreshold = 4096;
+
+bool isElementwiseOp(const std::shared_ptr<ngraph::Node>& op) {
+    // the custom ops derived from the elementwise base classes may still index the tensors by their full shapes, so
+    // only the core ops are evaluated by the chunks
+    static const std::unordered_set<ov::DiscreteTypeInfo> elementwiseOps = {
+        ov::opset12::Abs::get_type_info_static(),
+        ov::opset12::Acos::get_type_info_static(),
+        ov::opset12::Acosh::get_type_info_static(),
+        ov::opset12::Asin::get_type_info_static(),
+        ov::opset12::Asinh::get_type_info_static(),
+        ov::opset12::Atan::get_type_info_static(),
+        ov::opset12::Atanh::get_type_info_static(),
+        ov::opset12::Ceiling::get_type_info_static(),
+        ov::opset12::Cos::get_type_info_static(),
+        ov::opset12::Cosh::get_type_info_static(),
+        ov::opset12::Erf::get_type_info_static(),
+        ov::opset12::Exp::get_type_info_static(),
+        ov::opset12::Floor::get_type_info_static(),
+        ov::opset12::Log::get_type_info_static(),
+        ov::opset12::Negative::get_type_info_static(),
+        ov::opset12::Relu::get_type_info_static(),
+        ov::opset12::Sigmoid::get_type_info_static(),
+        ov::opset12::Sign::get_type_info_static(),
+        ov::opset12::Sin::get_type_info_static(),
+        ov::opset12::Sinh::get_type_info_static(),
+        ov::opset12::Sqrt::get_type_info_static(),
+        ov::opset12::Tan::get_type_info_static(),
+        ov::opset12::Tanh::get_type_info_static(),
+        ov::opset12::Add::get_type_info_static(),
+        ov::opset12::Divide::get_type_info_static(),
+        ov::opset12::FloorMod::get_type_info_static(),
+        ov::opset12::Maximum::get_type_info_static(),
+        ov::opset12::Minimum::get_type_info_static(),
+        ov::opset12::Mod::get_type_info_static(),
+        ov::opset12::Multiply::get_type_info_static(),
+        ov::opset12::Power::get_type_info_static(),
+        ov::opset12::SquaredDifference::get_type_info_static(),
+        ov::opset12::Subtract::get_type_info_static(),
+        ov::opset12::Equal::get_type_info_static(),
+        ov::opset12::Greater::get_type_info_static(),
+        ov::opset12::GreaterEqual::get_type_info_static(),
+        ov::opset12::Less::get_type_info_static(),
+        ov::opset12::LessEqual::get_type_info_static(),
+        ov::opset12::NotEqual::get_type_info_static(),
+        ov::opset12::LogicalAnd::get_type_info_static(),
+        ov::opset12::LogicalOr::get_type_info_static(),
+        ov::opset12::LogicalXor::get_type_info_static(),
+    };
+    if (!elementwiseOps.count(op->get_type_info()))
+        return false;
+    if (op->get_output_size() != 1)
+        return false;
+    // the sub byte precisions cannot be split by the elements
+    for (const auto& input : op->inputs()) {
+        if (input.get_element_type().bitwidth() < 8)
+            return false;
+    }
+    if (op->get_output_element_type(0).bitwidth() < 8)
+        return false;
+
+    if (ov::is_type<ov::op::util::UnaryElementwiseArithmetic>(op))
+        return true;
+
+    ov::op::AutoBroadcastSpec autob;
+    if (const auto arithmetic = ov::as_type_ptr<const ov::op::util::BinaryElementwiseArithmetic>(op)) {
+        autob = arithmetic->get_autob();
+    } else if (const auto comparison = ov::as_type_ptr<const ov::op::util::BinaryElementwiseComparison>(op)) {
+        autob = comparison->get_autob();
+    } else if (const auto logical = ov::as_type_ptr<const ov::op::util::BinaryElementwiseLogical>(op)) {
+        autob = logical->get_autob();
+    } else {
+        return false;
+    }
+    return one_of(autob.m_type, ov::op::AutoBroadcastType::NONE, ov::op::AutoBroadcastType::NUMPY);
+}
+
+// the part [start, end) of the tensor along the axis of the output, all the outer dimensions are units
+ov::Tensor getChunk(const ov::Tensor& tensor, size_t outputRank, size_t axis, size_t start, size_t end) {
+    const auto& shape = tensor.get_shape();
+    // the inputs are aligned to the output by the innermost dimensions
+    if (shape.size() + axis < outputRank)
+        return tensor;
+    const size_t tensorAxis = axis + shape.size() - outputRank;
+    if (shape[tensorAxis] == 1)
+        return tensor;
+
+    auto chunkShape = shape;
+    chunkShape[tensorAxis] = end - start;
+    const size_t stride = tensor.get_byte_size() / shape[tensorAxis];
+    return ov::Tensor(tensor.get_element_type(), chunkShape, static_cast<uint8_t*>(tensor.data()) + start * stride);
+}
+}  // namespace
+
 Reference::Reference(const std::shared_ptr<ngraph::Node>& op, const GraphContext::CPtr context,
                                          const std::string& errorMessage) :
         Node(op, context, NgraphShapeInferFactory(op, FULL_PORT_MASK)), ngraphOp(op), additionalErrorMessage(errorMessage) {
@@ -34,6 +141,7 @@ Reference::Reference(const std::shared_ptr<ngraph::Node>& op, const GraphContext
     if (ov::is_type<ngraph::op::v8::RandomUniform>(ngraphOp)) {
         constant = ConstantType::NoConst;
     }
+    isElementwise = isElementwiseOp(ngraphOp);
 }
 
 void Reference::getSupportedDescriptors() {}
@@ -62,7 +170,7 @@ void Reference::createPrimitive() {}
 void Reference::execute(dnnl::stream strm) {
     auto inputs = prepareInputs();
     auto outputs = prepareOutputs();
-    if (!ngraphOp->evaluate(outputs, inputs)) {
+    if (!evaluate(outputs, inputs)) {
         IE_THROW() << "Evaluation failed on node of type: " << std::string(ngraphOp->get_type_name()) << " name: " << getName();
     }
 }
@@ -89,7 +197,7 @@ void Reference::executeDynamicImpl(dnnl::stream strm) {
             "Unexpected shape infer result status during the inference of a node with type " <<
             getTypeStr() << " and name " << getName();
     }
-    if (!ngraphOp->evaluate(outputs, inputs)) {
+    if (!evaluate(outputs, inputs)) {
         IE_THROW() << "Evaluation failed on node of type: " << std::string(ngraphOp->get_type_name()) << " name: " << getName();
     }
     if (ShapeInferStatus::skip == result.status) {
@@ -111,6 +219,34 @@ void Reference::executeDynamicImpl(dnnl::stream strm) {
     }
 }
 
+bool Reference::evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const {
+    if (!isElementwise || outputs.front().get_size() < parallelEvaluationThreshold)
+        return ngraphOp->evaluate(outputs, inputs);
+
+    const auto& outputShape = outputs.front().get_shape();
+    const auto axis = std::distance(outputShape.begin(),
+                                    std::find_if(outputShape.begin(), outputShape.end(), [](size_t dim) {
+                                        return dim > 1;
+                                    }));
+    const size_t workAmount = outputShape[axis];
+    std::atomic<bool> evaluated{true};
+    parallel_nt(static_cast<int>(std::min<size_t>(workAmount, parallel_get_max_threads())), [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(workAmount, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        ov::TensorVector chunkInputs;
+        chunkInputs.reserve(inputs.size());
+        for (const auto& input : inputs)
+            chunkInputs.push_back(getChunk(input, outputShape.size(), axis, start, end));
+        ov::TensorVector chunkOutputs{getChunk(outputs.front(), outputShape.size(), axis, start, end)};
+        if (!ngraphOp->evaluate(chunkOutputs, chunkInputs))
+            evaluated = false;
+    });
+    return evaluated;
+}
+
 bool Reference::created() const {
     return getType() == Type::Reference;
 }
@@ -27,10 +27,14 @@ public:
 private:
     ov::TensorVector prepareInputs() const;
     ov::TensorVector prepareOutputs() const;
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const;
 
 private:
     const std::shared_ptr<ngraph::Node> ngraphOp;
     const std::string additionalErrorMessage;
+    // the output elements are computed independently from the elements of the inputs broadcasted by numpy rules,
+    // so the evaluation is split between the threads by the outermost non unit dimension
+    bool isElementwise = false;
 };
 
 }   // namespace node
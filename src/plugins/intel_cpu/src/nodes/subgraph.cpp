@@ -117,6 +117,57 @@ bool SnippetKey::operator==(const SnippetKey& rhs) const {
     return true;
 }
 
+// the kernel compiled with the runtime data offsets depends on the layouts and the innermost (tile) dimensions only
+struct SnippetKernelKey {
+    Snippet::SnippetAttrs attrs;
+    size_t tensorRank;
+    size_t tileRank;
+    std::vector<VectorDims> tileDims;
+
+    size_t hash() const;
+    bool operator==(const SnippetKernelKey& rhs) const;
+};
+
+size_t SnippetKernelKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& order : attrs.inMemOrders)
+        seed = get_vector_hash(seed, order);
+    for (const auto& prec : attrs.inMemPrecs)
+        seed = hash_combine(seed, prec.getPrecVal());
+    for (const auto& order : attrs.outMemOrders)
+        seed = get_vector_hash(seed, order);
+    for (const auto& prec : attrs.outMemPrecs)
+        seed = hash_combine(seed, prec.getPrecVal());
+    seed = hash_combine(seed, attrs.bodyHash);
+    seed = hash_combine(seed, tensorRank);
+    seed = hash_combine(seed, tileRank);
+    for (const auto& dims : tileDims)
+        seed = get_vector_hash(seed, dims);
+
+    return seed;
+}
+
+bool SnippetKernelKey::operator==(const SnippetKernelKey& rhs) const {
+    return attrs.bodyHash == rhs.attrs.bodyHash &&
+           attrs.inMemOrders == rhs.attrs.inMemOrders &&
+           attrs.inMemPrecs == rhs.attrs.inMemPrecs &&
+           attrs.outMemOrders == rhs.attrs.outMemOrders &&
+           attrs.outMemPrecs == rhs.attrs.outMemPrecs &&
+           tensorRank == rhs.tensorRank &&
+           tileRank == rhs.tileRank &&
+           tileDims == rhs.tileDims;
+}
+
+struct SnippetKernel {
+    // owns the generated code
+    std::shared_ptr<snippets::op::Subgraph> snippet;
+    snippets::Schedule schedule;
+    size_t bufferScratchpadSize;
+};
+
 snippets::op::Subgraph::BlockedShapeVector getBlockedShapes(const std::vector<std::vector<size_t>>& memBlockedDims,
         const std::vector<std::vector<size_t>>& memOrders, const std::vector<InferenceEngine::Precision>& memPrecs) {
     size_t numShapes = memBlockedDims.size();
@@ -162,6 +213,10 @@ void Snippet::copy_snippet() const {
     snippetAttrs.snippet = std::make_shared<snippets::op::Subgraph>(subgraph_node_inputs, new_body);
     ov::copy_runtime_info(original_snippet, snippetAttrs.snippet);
     snippetAttrs.snippet->set_friendly_name(original_snippet->get_friendly_name());
+#ifdef CPU_DEBUG_CAPS
+    const auto& snippetsPerfCount = context->getConfig().debugCaps.snippetsPerfCount;
+    snippetAttrs.snippet->set_perf_count(!snippetsPerfCount.empty() && std::stoi(snippetsPerfCount));
+#endif
 #if defined(OPENVINO_ARCH_X86_64)
     snippetAttrs.snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
 #else
@@ -360,7 +415,7 @@ void Snippet::prepareParams() {
 
     auto builder = [this](const SnippetKey& key) -> std::shared_ptr<SnippetExecutor> {
         std::shared_ptr<SnippetExecutor> executor = std::make_shared<SnippetJitExecutor>(key.attrs, is_canonicalized,
-            is_dynamic, context->getConfig().inferencePrecision == ov::element::bf16);
+            is_dynamic, context->getConfig().inferencePrecision == ov::element::bf16, context->getParamsCache());
         is_canonicalized = true;
         return executor;
     };
@@ -371,6 +426,9 @@ void Snippet::prepareParams() {
     if (!execPtr) {
         IE_THROW() << "Executor is not created for node " << getName() << ".";
     }
+    // the executor may be shared between the nodes through the cache, so the Buffers memory is owned by the node
+    if (execPtr->getBufferScratchpadSize() > 0)
+        reserveScratchBuffer(execPtr->getBufferScratchpadSize());
 }
 
 bool Snippet::needPrepareParams() const {
@@ -416,14 +474,20 @@ void Snippet::execute(dnnl::stream strm) {
     for (size_t i = 0; i < outputNum; i++)
         dstMemPtrs[i] = getChildEdgeAt(i)->getMemoryPtr();
 
-    execPtr->exec(srcMemPtrs, dstMemPtrs);
+    uint8_t* bufferScratchpad = nullptr;
+    if (const auto bufferScratchpadSize = execPtr->getBufferScratchpadSize()) {
+        auto arena = getScratchArena();
+        bufferScratchpad = arena.allocate<uint8_t>(bufferScratchpadSize);
+    }
+    execPtr->exec(srcMemPtrs, dstMemPtrs, bufferScratchpad);
 }
 
 void Snippet::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
-void Snippet::SnippetJitExecutor::exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
+void Snippet::SnippetJitExecutor::exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs,
+                                       uint8_t* bufferScratchpad) {
     if (schedule.ptr == nullptr) {
         IE_THROW() << "Snippet can't use Optimized implementation and can't fallback to reference";
     }
@@ -440,44 +504,51 @@ void Snippet::SnippetJitExecutor::exec(const std::vector<MemoryPtr>& inMemPtrs,
     initStartMemoryOffsets();
 
     if (tensorRank == rank6D) {
-        schedule_6d(inMemPtrs, outMemPtrs);
+        schedule_6d(inMemPtrs, outMemPtrs, bufferScratchpad);
     } else {
-        schedule_nt(inMemPtrs, outMemPtrs);
+        schedule_nt(inMemPtrs, outMemPtrs, bufferScratchpad);
     }
 }
 
+size_t Snippet::SnippetJitExecutor::getBufferScratchpadSize() const {
+    return buffer_scratchpad_size * parallel_get_max_threads();
+}
+
 void Snippet::SnippetJitExecutor::update_ptrs(jit_snippets_call_args& call_args,
-    const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
+    const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs, uint8_t* bufferScratchpad) {
     for (size_t i = 0; i < inMemPtrs.size(); i++)
         call_args.src_ptrs[i] = reinterpret_cast<const uint8_t*>(inMemPtrs[i]->getData()) + start_offset_in[i];
 
     for (size_t i = 0; i < outMemPtrs.size(); i++)
         call_args.dst_ptrs[i] = reinterpret_cast<uint8_t*>(outMemPtrs[i]->getData()) + start_offset_out[i];
 
+    call_args.data_offsets = dataOffsets.data();
+
     if (buffer_scratchpad_size > 0) {
-        call_args.buffer_scratchpad_ptr =
-                reinterpret_cast<uint8_t*>(buffer_scratchpad.data()) + parallel_get_thread_num() * buffer_scratchpad_size;
+        call_args.buffer_scratchpad_ptr = bufferScratchpad + parallel_get_thread_num() * buffer_scratchpad_size;
     }
 }
 
-void Snippet::SnippetJitExecutor::schedule_6d(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
+void Snippet::SnippetJitExecutor::schedule_6d(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs,
+                                              uint8_t* bufferScratchpad) {
     const auto& dom = exec_domain;
     // < N, C, H, W > < 1, 1, N, C*H*W>
     parallel_for5d(dom[0], dom[1], dom[2], dom[3], dom[4],
         [&](int64_t d0, int64_t d1, int64_t d2, int64_t d3, int64_t d4) {
             int64_t indexes[] = {d0, d1, d2, d3, d4};
             jit_snippets_call_args call_args;
-            update_ptrs(call_args, inMemPtrs, outMemPtrs);
+            update_ptrs(call_args, inMemPtrs, outMemPtrs, bufferScratchpad);
 
             schedule.get_callable<kernel>()(indexes, &call_args);
         });
 }
 
-void Snippet::SnippetJitExecutor::schedule_nt(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) {
+void Snippet::SnippetJitExecutor::schedule_nt(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs,
+                                              uint8_t* bufferScratchpad) {
     const auto& work_size = exec_domain;
     parallel_nt(0, [&](const int ithr, const int nthr) {
         jit_snippets_call_args call_args;
-        update_ptrs(call_args, inMemPtrs, outMemPtrs);
+        update_ptrs(call_args, inMemPtrs, outMemPtrs, bufferScratchpad);
 
         size_t start = 0, end = 0;
         splitter(harnessWorkAmount, nthr, ithr, start, end);
@@ -498,7 +569,8 @@ void Snippet::SnippetJitExecutor::schedule_nt(const std::vector<MemoryPtr>& inMe
 Snippet::SnippetExecutor::SnippetExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16)
     : snippetAttrs(attrs), is_canonicalized(is_canonicalized), is_dynamic(is_dynamic), enforceBF16(enforceBF16) {}
 
-Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16) :
+Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16,
+                                                const MultiCachePtr& kernelCache) :
     SnippetExecutor(attrs, is_canonicalized, is_dynamic, enforceBF16) {
     numInput = snippetAttrs.inMemBlockedDims.size();
     numOutput = snippetAttrs.outMemBlockedDims.size();
@@ -517,6 +589,7 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool
         snippet_for_generation = std::make_shared<ov::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
         ov::copy_runtime_info(snippetAttrs.snippet, snippet_for_generation);
         snippet_for_generation->set_friendly_name(snippetAttrs.snippet->get_friendly_name());
+        snippet_for_generation->set_perf_count(snippetAttrs.snippet->is_perf_count());
         auto host_isa = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core) ?
             dnnl::impl::cpu::x64::avx512_core : dnnl::impl::cpu::x64::avx2;
         snippet_for_generation->set_generator(std::make_shared<CPUGenerator>(host_isa));
@@ -599,13 +672,59 @@ Snippet::SnippetJitExecutor::SnippetJitExecutor(const SnippetAttrs& attrs, bool
     snippet_for_generation->set_master_shape(ov::PartialShape(masterShape));
     snippet_for_generation->set_tile_rank(tileRank);
 
+    // the dynamic elementwise subgraph gets the kernel independent of the outer dimensions, so the shapes differing
+    // in these dimensions only (e.g. the batch or the sequence length) share it
+    runtimeDataOffsets = is_dynamic && kernelCache && !snippet_for_generation->has_domain_sensitive_ops();
+
     // generate
     jit_snippets_compile_args jcp;
     jcp.master_shape = masterShape;
     jcp.tile_rank = tileRank;
-    generate(&jcp);
-    buffer_scratchpad_size = snippet_for_generation->get_buffer_scratchpad_size();
-    buffer_scratchpad.resize(buffer_scratchpad_size * parallel_get_max_threads(), 0);
+    jcp.runtime_data_offsets = runtimeDataOffsets;
+    if (runtimeDataOffsets) {
+        initDataOffsets();
+
+        SnippetKernelKey key = {snippetAttrs, tensorRank, tileRank, {}};
+        auto getTileDims = [this](const VectorDims& dims) {
+            return VectorDims(dims.end() - tileRank, dims.end());
+        };
+        key.tileDims.push_back(getTileDims(masterShape));
+        for (const auto& shape : normInputShapes)
+            key.tileDims.push_back(getTileDims(shape));
+        for (const auto& shape : normOutputShapes)
+            key.tileDims.push_back(getTileDims(shape));
+
+        auto builder = [this, &jcp](const SnippetKernelKey&) -> std::shared_ptr<SnippetKernel> {
+            generate(&jcp);
+            return std::make_shared<SnippetKernel>(SnippetKernel{snippet_for_generation, schedule,
+                                                                 snippet_for_generation->get_buffer_scratchpad_size()});
+        };
+        const auto kernel = kernelCache->getOrCreate(key, builder).first;
+        snippet_for_generation = kernel->snippet;
+        schedule = kernel->schedule;
+        buffer_scratchpad_size = kernel->bufferScratchpadSize;
+    } else {
+        generate(&jcp);
+        buffer_scratchpad_size = snippet_for_generation->get_buffer_scratchpad_size();
+    }
+}
+
+void Snippet::SnippetJitExecutor::initDataOffsets() {
+    // the same strides as the kernel calculates at the compilation: the distance between the consecutive elements of
+    // the dimension in bytes or zero for the unit dimension, the last dimension is processed by the kernel itself
+    const size_t offsetRank = tensorRank - 1;
+    dataOffsets.assign((numInput + numOutput) * offsetRank, 0);
+    auto calculateOffsets = [offsetRank](const VectorDims& shape, size_t dataSize, size_t* offsets) {
+        size_t step = dataSize;
+        for (size_t k = offsetRank; k > 0; k--) {
+            step *= shape[k];
+            offsets[k - 1] = shape[k - 1] != 1 ? step : 0;
+        }
+    };
+    for (size_t i = 0; i < numInput; i++)
+        calculateOffsets(normInputShapes[i], dataSize[i], &dataOffsets[i * offsetRank]);
+    for (size_t i = 0; i < numOutput; i++)
+        calculateOffsets(normOutputShapes[i], dataSize[numInput + i], &dataOffsets[(numInput + i) * offsetRank]);
 }
 
 ov::PartialShape Snippet::SnippetJitExecutor::canonicalizeBody(bool reshape) {
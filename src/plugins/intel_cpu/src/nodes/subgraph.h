@@ -86,7 +86,11 @@ private:
     class SnippetExecutor {
         public:
             SnippetExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16);
-            virtual void exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) = 0;
+            // the buffer scratchpad is the node scratch buffer, so the consecutive subgraphs share the same memory
+            virtual void exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs,
+                              uint8_t* bufferScratchpad) = 0;
+            // the size of the buffer scratchpad for all the threads
+            virtual size_t getBufferScratchpadSize() const { return 0; }
             virtual ~SnippetExecutor() = default;
 
         protected:
@@ -100,8 +104,12 @@ private:
 
     class SnippetJitExecutor : public SnippetExecutor {
         public:
-            SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16);
-            void exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs) override;
+            // the kernels of the dynamic subgraphs are shared through the cache between the shapes they are valid for
+            SnippetJitExecutor(const SnippetAttrs& attrs, bool is_canonicalized, bool is_dynamic, bool enforceBF16,
+                               const MultiCachePtr& kernelCache);
+            void exec(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs,
+                      uint8_t* bufferScratchpad) override;
+            size_t getBufferScratchpadSize() const override;
 
             bool schedule_created();
 
@@ -118,10 +126,12 @@ private:
             bool optimizeExecDomain(std::vector<VectorDims>&, std::vector<VectorDims>&, VectorDims&, size_t&) const;
 
             void generate(const jit_snippets_compile_args*);
-            inline void update_ptrs(jit_snippets_call_args&, const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs);
+            void initDataOffsets();
+            inline void update_ptrs(jit_snippets_call_args&, const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs,
+                                    uint8_t* bufferScratchpad);
             // Evaluates generated snippet using parallel backend
-            void schedule_6d(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs);
-            void schedule_nt(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs);
+            void schedule_6d(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs, uint8_t* bufferScratchpad);
+            void schedule_nt(const std::vector<MemoryPtr>& inMemPtrs, const std::vector<MemoryPtr>& outMemPtrs, uint8_t* bufferScratchpad);
 
             std::shared_ptr<snippets::op::Subgraph> snippet_for_generation;
 
@@ -149,8 +159,11 @@ private:
             std::vector<ptrdiff_t> start_offset_in = {};
             std::vector<ptrdiff_t> start_offset_out = {};
 
-            // Buffer scratchpad
-            std::vector<uint8_t> buffer_scratchpad = {};
+            // the kernel takes the byte offsets of the scheduler dimensions of each input and output at runtime
+            bool runtimeDataOffsets = false;
+            std::vector<size_t> dataOffsets = {};
+
+            // Buffer scratchpad size per thread
             size_t buffer_scratchpad_size = 0;
     };
 };
@@ -4,6 +4,7 @@
 
 #include "tensoriterator.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -145,6 +146,32 @@ private:
     int iter_count;
 };
 
+// Binds the body output memory to the iteration chunk of the concatenated output, so the body writes the iteration
+// result in place instead of the copy after the iteration
+class PortChunkBindHelper : public PortMapHelper {
+public:
+    PortChunkBindHelper(const MemoryPtr &from, const MemoryPtr &to, const PortMap &slice_rule)
+                        : from(from), to(to), reverse(slice_rule.stride < 0) {
+        iter_count = to->getStaticDims()[slice_rule.axis] / std::abs(slice_rule.stride);
+        chunk_size_in_byte = from->getSize();
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        const int chunk_idx = reverse ? iter_count - 1 - iter : iter;
+        from->getMemoryMngr()->setExtBuff(static_cast<uint8_t *>(to->getData()) + chunk_size_in_byte * chunk_idx,
+                                          chunk_size_in_byte);
+    }
+
+private:
+    MemoryPtr from;
+    MemoryPtr to;
+    size_t chunk_size_in_byte = 0;
+    int iter_count = 0;
+    bool reverse;
+};
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(MultiCachePtr cache, const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) {
@@ -247,6 +274,30 @@ void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
     move_data();
 }
 
+void DynamicBuffer::bind(const dnnl::engine& eng, const int iter) {
+    // the chunk size is known after the first iteration only,
+    // the chunk has to be dense (nothing before the axis) and fit in the current buffer
+    if (!binding_allowed || iter == 0 || count != 1lu || !mem_holder_buffer || check_buffer()) {
+        unbind(eng);
+        return;
+    }
+
+    from->getMemoryMngr()->setExtBuff(reinterpret_cast<uint8_t*>(mem_holder_buffer->getData()) + chunk_offset_in_byte,
+                                      chunk_unit_in_byte);
+    bound = true;
+}
+
+void DynamicBuffer::unbind(const dnnl::engine& eng) {
+    if (!bound)
+        return;
+
+    // the buffer may be reallocated, so the body output gets its own memory back
+    if (!unbound_holder || unbound_holder->getSize() < from->getSize())
+        unbound_holder = std::make_shared<Memory>(eng, from->getDescPtr());
+    from->getMemoryMngr()->setExtBuff(unbound_holder->getData(), unbound_holder->getSize());
+    bound = false;
+}
+
 void DynamicBuffer::reset(int max_iter_count_) {
     max_iter_count = max_iter_count_;
 }
@@ -332,8 +383,10 @@ void DynamicBuffer::move_data() {
     const auto src_stride = abs(map_rule.stride) * len;
     const auto dst_stride = chunk_stride_in_byte;
 
-    copy(reinterpret_cast<const uint8_t*>(from->getData()), reinterpret_cast<uint8_t*>(mem_holder_buffer->getData()) + chunk_offset_in_byte,
-         src_stride, dst_stride, count, chunk_unit_in_byte);
+    auto dst = reinterpret_cast<uint8_t*>(mem_holder_buffer->getData()) + chunk_offset_in_byte;
+    // the bound body output has written the data in place already
+    if (from->getData() != dst)
+        copy(reinterpret_cast<const uint8_t*>(from->getData()), dst, src_stride, dst_stride, count, chunk_unit_in_byte);
 
     // adjust for next execution
     num_execs++;
@@ -426,6 +479,7 @@ void TensorIterator::getSupportedDescriptors() {
         if (outNode != outMap.end()) {
             auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
             output_mem.push_back(outMem);
+            output_const.push_back(outNode->second->getParentEdgeAt(0)->getParent()->isConstant());
         }
     }
 
@@ -557,8 +611,9 @@ void TensorIterator::prepareParams() {
         prepareLoopBodyCurrentIteration();
 
         if (!isDynamicNode()) {
-            prepareOutputPorts();
+            // the back edges read the body outputs of the previous iteration, so they go before the outputs binding
             prepareBackEdges();
+            prepareOutputPorts();
         }
 
         // reset local states of DynamicBuffer
@@ -613,6 +668,8 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
             mapper->execute(strm, i);
         for (auto &mapper : back_mappers)
             mapper->execute(strm, i);
+        for (auto& buffer : buffers)
+            buffer->bind(eng, i);
 
         sub_graph.Infer();
 
@@ -651,8 +708,15 @@ void TensorIterator::prepareOutputPorts() {
         auto to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
         auto &from_mem = output_mem[map_rule.to];
 
-        if (map_rule.axis == -1)
+        if (map_rule.axis == -1) {
             last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(context->getParamsCache(), from_mem, to_mem, eng));
+            continue;
+        }
+
+        const auto& to_dims = to_mem->getStaticDims();
+        const bool dense_chunks = std::all_of(to_dims.begin(), to_dims.begin() + map_rule.axis, [](size_t dim) { return dim == 1; });
+        if (dense_chunks && canBindBodyOutput(map_rule))
+            before_mappers.emplace_back(std::make_shared<PortChunkBindHelper>(from_mem, to_mem, map_rule));
         else
             after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(context->getParamsCache(), from_mem, to_mem, false, map_rule, eng));
     }
@@ -688,6 +752,7 @@ void TensorIterator::prepareDynamicBuffers() {
             auto to_mems = getToMemories(this, map_rule.from);
             auto &from_mem = output_mem[map_rule.to];
             buffers.emplace_back(std::make_shared<DynamicBuffer>(from_mem, to_mems, map_rule));
+            buffers.back()->allow_binding(canBindBodyOutput(map_rule));
         }
     }
 }
@@ -787,6 +852,33 @@ bool TensorIterator::checkForInputAndBodyShapesInequality() const {
     return false;
 }
 
+bool TensorIterator::canBindBodyOutput(const PortMap& rule) const {
+    // the body output memory may be pointed to the concatenated output only if nobody else uses this memory
+    const auto& from_mem = output_mem[rule.to];
+    if (output_const[rule.to] || !from_mem->getDesc().hasLayoutType(LayoutType::ncsp) ||
+        from_mem->getDesc().getPrecision() != getBaseMemDescAtOutputPort(rule.from)->getPrecision())
+        return false;
+
+    const auto sliced_usages = std::count_if(outputPortMap.begin(), outputPortMap.end(), [&](const PortMap& map_rule) {
+        return map_rule.to == rule.to && map_rule.axis != -1;
+    });
+    if (sliced_usages != 1)
+        return false;
+
+    const auto mem_mngr = from_mem->getMemoryMngr();
+    for (size_t i = 0; i < output_mem.size(); i++) {
+        if (static_cast<int>(i) != rule.to && output_mem[i]->getMemoryMngr() == mem_mngr)
+            return false;
+    }
+    for (const auto& mems : input_mems) {
+        for (const auto& mem : mems) {
+            if (mem->getMemoryMngr() == mem_mngr)
+                return false;
+        }
+    }
+    return true;
+}
+
 int TensorIterator::getNumIteration(const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap) const {
     const auto isIterable = [](const PortMap& rule) {
         return rule.axis != -1;
@@ -68,6 +68,13 @@ public:
 
     void execute(const dnnl::engine& eng, const int iter);
     void transfer(const Node* node);
+    /**
+     * @brief Binds the body output memory to the next chunk of the buffer before the iteration, so the body writes
+     * the iteration result directly to the buffer. If the chunk is not known yet or the body reallocates its output,
+     * the data are copied as usual.
+     */
+    void bind(const dnnl::engine& eng, const int iter);
+    void allow_binding(bool allowed) { binding_allowed = allowed; }
 
     void reset(int max_iter_count_);   // reset local
 
@@ -79,6 +86,7 @@ private:
     MemoryPtr create_buffer(const dnnl::engine& eng);
     void move_buffer(const MemoryPtr& new_buffer);
     void move_data();
+    void unbind(const dnnl::engine& eng);
 
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
 
@@ -99,6 +107,10 @@ private:
     size_t elem_size = 0lu;
 
     MemoryPtr mem_holder_buffer;
+
+    bool binding_allowed = false;
+    bool bound = false;
+    MemoryPtr unbound_holder;   // the own memory of the body output, when it's not bound to the buffer
 };
 
 class TensorIterator : public Node {
@@ -137,12 +149,14 @@ private:
     void reshapeSubgraphInput();
     void reshapeAndFillOutput(dnnl::stream strm);
     bool checkForInputAndBodyShapesInequality() const;
+    bool canBindBodyOutput(const PortMap& rule) const;
     int getNumIteration(const std::vector<PortMap>& inputPortMap, const std::vector<PortMap>& outputPortMap) const;
 
     ExtensionManager::Ptr ext_mng;
     Graph sub_graph;
     std::vector<std::vector<MemoryPtr>> input_mems;
     std::vector<MemoryPtr> output_mem;
+    std::vector<bool> output_const;
 
     std::vector<std::shared_ptr<PortMapHelper>>
         first_mappers,   /// < Applied once before loop
@@ -14,10 +14,13 @@
 #include <ngraph/op/topk.hpp>
 #include <ie_ngraph_utils.hpp>
 #include <algorithm>
+#include <cmath>
+#include <numeric>
 
 #include <cpu/x64/jit_generator.hpp>
 #include <cpu/x64/jit_uni_eltwise.hpp>
 #include "common/cpu_memcpy.h"
+#include "utils/bfloat16.hpp"
 
 #include <ngraph/opsets/opset1.hpp>
 
@@ -1935,6 +1938,9 @@ void TopK::initSupportedPrimitiveDescriptors() {
         {LayoutType::nCsp8c, LayoutType::nCsp8c}
 #endif
     };
+    // the fused softmax normalizes the output values in the planar layout only
+    if (with_softmax)
+        dataFomats.resize(1);
 
     for (const auto &df : dataFomats) {
         addSupportedPrimDesc({{df.first, dataPrecision}, {LayoutType::ncsp, Precision::I32}},
@@ -2061,6 +2067,28 @@ void TopK::prepareParams() {
         dim = static_cast<int>(src_dims[axis]);
         before_num = count(src_dims, 0, axis);
     }
+
+    prepare_partition_select();
+}
+
+void TopK::prepare_partition_select() {
+    // A few long rows can't load all the cores when each row is processed by a single thread, so the rows are split
+    // into the chunks, the candidates are selected in each chunk in parallel and merged after that.
+    const size_t rows = count(src_dims, 0, axis);
+    const size_t axis_len = src_dims[axis];
+    const size_t nthr = parallel_get_max_threads();
+    partition_select = layout == TopKLayoutType::topk_ncsp && axis == static_cast<int>(src_dims.size() - 1) &&
+                       axis_len >= PARTITION_SELECT_MIN_AXIS_DIM && top_k > 0 && rows < nthr;
+    if (!partition_select) {
+        vec_partition_idx.clear();
+        return;
+    }
+
+    partition_rows = rows;
+    // each chunk is expected to be several times longer than k, otherwise the merge dominates
+    const size_t min_chunk_len = std::max<size_t>(4 * top_k, 4096);
+    partition_chunks = std::max<size_t>(1, std::min(div_up(nthr, rows), axis_len / min_chunk_len));
+    vec_partition_idx.resize(rows * axis_len);
 }
 
 void TopK::createPrimitive() {
@@ -2145,7 +2173,9 @@ void TopK::execute(dnnl::stream strm) {
     uint8_t *dst_data = reinterpret_cast<uint8_t *>(dstMemPtr->getData());
     uint8_t *dst_idx = reinterpret_cast<uint8_t *>(dstIndexesMemPtr->getData());
 
-    if (jit_mode) {
+    if (partition_select) {
+        topk_partition_select_process(src_data, dst_data, dst_idx);
+    } else if (jit_mode) {
         topk_process(src_data, dst_data, dst_idx);
     } else {
         if (layout == TopKLayoutType::topk_ncsp) {
@@ -2157,6 +2187,53 @@ void TopK::execute(dnnl::stream strm) {
             IE_THROW() << errorPrefix <<  "only support plain layout on machine w/o sse42.";
         }
     }
+
+    if (with_softmax)
+        softmax_normalize(reinterpret_cast<const float *>(src_data), reinterpret_cast<float *>(dst_data));
+}
+
+void TopK::softmax_normalize(const float* src_data, float* dst_data) {
+    const size_t outer = count(src_dims, 0, axis);
+    const size_t axis_len = src_dims[axis];
+    const size_t inner = count(src_dims, axis + 1);
+    const size_t k = static_cast<size_t>(top_k);
+    if (k == 0 || outer * inner == 0)
+        return;
+
+    // the maximum of the whole axis is among the selected elements
+    const size_t rows = outer * inner;
+    std::vector<float> max_values(rows);
+    parallel_for2d(outer, inner, [&](size_t o, size_t i) {
+        const float* top = dst_data + o * k * inner + i;
+        float max_value = top[0];
+        for (size_t j = 1; j < k; j++)
+            max_value = std::max(max_value, top[j * inner]);
+        max_values[o * inner + i] = max_value;
+    });
+
+    // a few long rows are summed by the chunks in parallel
+    const size_t nthr = parallel_get_max_threads();
+    const size_t chunks = std::max<size_t>(1, std::min(div_up(nthr, rows), axis_len / SOFTMAX_MIN_CHUNK_LEN));
+    const size_t chunk_len = div_up(axis_len, chunks);
+    std::vector<float> sums(rows * chunks, 0.f);
+    parallel_for3d(outer, inner, chunks, [&](size_t o, size_t i, size_t c) {
+        const size_t start = c * chunk_len;
+        const size_t end = std::min(axis_len, start + chunk_len);
+        const float* src = src_data + o * axis_len * inner + i;
+        const float max_value = max_values[o * inner + i];
+        float sum = 0.f;
+        for (size_t a = start; a < end; a++)
+            sum += std::exp(src[a * inner] - max_value);
+        sums[(o * inner + i) * chunks + c] = sum;
+    });
+
+    parallel_for2d(outer, inner, [&](size_t o, size_t i) {
+        const size_t row = o * inner + i;
+        const float sum = std::accumulate(sums.begin() + row * chunks, sums.begin() + (row + 1) * chunks, 0.f);
+        float* top = dst_data + o * k * inner + i;
+        for (size_t j = 0; j < k; j++)
+            top[j * inner] = std::exp(top[j * inner] - max_values[row]) / sum;
+    });
 }
 
 void TopK::topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
@@ -2440,6 +2517,88 @@ void TopK::topk_ref_process(const float* src_data, float* dst_data, int32_t* dst
     });
 }
 
+void TopK::topk_partition_select_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr) {
+    auto out_idx = reinterpret_cast<int32_t *>(out_idx_ptr);
+    const auto precision = getSelectedPrimitiveDescriptor()->getConfig().inConfs[TOPK_DATA].getMemDesc()->getPrecision();
+    switch (precision) {
+    case Precision::FP32:
+        topk_partition_select(reinterpret_cast<const float *>(in_ptr), reinterpret_cast<float *>(out_ptr), out_idx);
+        break;
+    case Precision::BF16:
+        topk_partition_select(reinterpret_cast<const bfloat16_t *>(in_ptr), reinterpret_cast<bfloat16_t *>(out_ptr), out_idx);
+        break;
+    case Precision::I32:
+        topk_partition_select(reinterpret_cast<const int32_t *>(in_ptr), reinterpret_cast<int32_t *>(out_ptr), out_idx);
+        break;
+    case Precision::I8:
+        topk_partition_select(reinterpret_cast<const int8_t *>(in_ptr), reinterpret_cast<int8_t *>(out_ptr), out_idx);
+        break;
+    case Precision::U8:
+        topk_partition_select(reinterpret_cast<const uint8_t *>(in_ptr), reinterpret_cast<uint8_t *>(out_ptr), out_idx);
+        break;
+    default:
+        IE_THROW() << errorPrefix << " has unsupported precision " << precision;
+    }
+}
+
+template <typename T>
+void TopK::topk_partition_select(const T* src_data, T* dst_data, int32_t* dst_idx) {
+    const size_t axis_len = src_dims[axis];
+    const size_t k = static_cast<size_t>(top_k);
+    const size_t chunk_len = div_up(axis_len, partition_chunks);
+    const bool max_mode = mode_max;
+    // the equal values are ordered by the index, so the result is stable and doesn't depend on the chunks number
+    auto make_compare = [max_mode](const T* row) {
+        return [row, max_mode](int32_t a, int32_t b) {
+            if (row[a] == row[b])
+                return a < b;
+            return max_mode ? row[a] > row[b] : row[a] < row[b];
+        };
+    };
+
+    parallel_for2d(partition_rows, partition_chunks, [&](size_t r, size_t c) {
+        const size_t start = c * chunk_len;
+        const size_t end = std::min(axis_len, start + chunk_len);
+        if (start >= end)
+            return;
+        int32_t* idx = vec_partition_idx.data() + r * axis_len + start;
+        for (size_t i = start; i < end; i++)
+            idx[i - start] = static_cast<int32_t>(i);
+        if (end - start > k)
+            std::nth_element(idx, idx + k, idx + (end - start), make_compare(src_data + r * axis_len));
+    });
+
+    parallel_for(partition_rows, [&](size_t r) {
+        const T* row = src_data + r * axis_len;
+        int32_t* idx = vec_partition_idx.data() + r * axis_len;
+        // the chunks candidates are gathered at the beginning of the row buffer
+        size_t candidates = 0;
+        for (size_t c = 0; c < partition_chunks; c++) {
+            const size_t start = c * chunk_len;
+            const size_t end = std::min(axis_len, start + chunk_len);
+            if (start >= end)
+                break;
+            const size_t chunk_k = std::min(k, end - start);
+            std::copy(idx + start, idx + start + chunk_k, idx + candidates);
+            candidates += chunk_k;
+        }
+
+        auto compare = make_compare(row);
+        if (candidates > k)
+            std::nth_element(idx, idx + k, idx + candidates, compare);
+        if (sort_index)
+            std::sort(idx, idx + k);
+        else
+            std::sort(idx, idx + k, compare);
+
+        for (size_t i = 0; i < k; i++) {
+            if (dst_data)
+                dst_data[r * k + i] = row[idx[i]];
+            dst_idx[r * k + i] = idx[i];
+        }
+    });
+}
+
 inline int TopK::count(const VectorDims& dims, size_t start_ind, size_t end_ind) {
     size_t count = 1;
     for (size_t i = start_ind; i < end_ind; i++)
@@ -98,6 +98,20 @@ public:
 
     static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node> &op, std::string &errorMessage) noexcept;
 
+    int getAxis() const {
+        return axis;
+    }
+    bool isModeMax() const {
+        return mode_max;
+    }
+    /**
+     * @brief The input Softmax is dropped from the graph: the softmax and the max mode TopK select the same elements,
+     * so the logits are selected and only the k output values are normalized.
+     */
+    void fuseInputSoftmax() {
+        with_softmax = true;
+    }
+
 private:
     void topk_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *dst_idx);
     void topk_ref(const float *in_ptr, float *out_ptr, int32_t *dst_idx);
@@ -110,18 +124,28 @@ private:
     void calc_dims_size(const VectorDims &layout_dims);
     void topk_ref_process(const float* src_data, float* dst_data, int32_t* dst_idx,
                    const VectorDims &in_dims, std::function<float(float, float)> compare) const;
+    template <typename T>
+    void topk_partition_select(const T* src_data, T* dst_data, int32_t* dst_idx);
+    void topk_partition_select_process(const uint8_t *in_ptr, uint8_t *out_ptr, uint8_t *out_idx_ptr);
+    void prepare_partition_select();
     void preset_params();
     void prepare_original_idx();
+    void softmax_normalize(const float* src_data, float* dst_data);
 
     bool topk_innermost = false;
     bool jit_mode = false;
     bool sort_index = false;
     bool stable = false;
     bool mode_max = false;
+    bool with_softmax = false;
     int axis = 0;
     static const size_t TOPK_DATA = 0;
     static const size_t TOPK_K = 1;
     static const size_t TOPK_INDEX = 1;
+    // the minimal axis length to select the top k elements by the parallel partitioning along the axis
+    static const size_t PARTITION_SELECT_MIN_AXIS_DIM = 32768;
+    // the minimal length of the axis part summed by one thread for the normalizer of the fused softmax
+    static const size_t SOFTMAX_MIN_CHUNK_LEN = 4096;
     size_t O = 0, A = 0, I = 0;
     size_t blk_size = 0;
     size_t data_size = 0;
@@ -130,6 +154,10 @@ private:
     int dim = 0, before_num = 0;
     bool bubble_inplace = false;
     bool preset_params_done = false;
+    bool partition_select = false;
+    size_t partition_rows = 0;
+    size_t partition_chunks = 0;
+    std::vector<int32_t> vec_partition_idx;
 
     VectorDims src_dims, dst_dims;
     TopKLayoutType layout = TopKLayoutType::topk_ncsp;
@@ -5,6 +5,10 @@
 #include "unique.hpp"
 
 #include "ie_parallel.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <type_traits>
 #include <openvino/op/unique.hpp>
 #include "common/cpu_memcpy.h"
 #include <shape_inference/shape_inference_internal_dyn.hpp>
@@ -15,6 +19,45 @@ using namespace ov::intel_cpu::node;
 
 #define THROW_ERROR IE_THROW() << getTypeStr() << " node with name '" << getName() << "' "
 
+namespace {
+template <typename T>
+typename std::enable_if<std::is_floating_point<T>::value, bool>::type isNaN(T value) {
+    return std::isnan(value);
+}
+
+template <typename T>
+typename std::enable_if<!std::is_floating_point<T>::value, bool>::type isNaN(T) {
+    return false;
+}
+
+// Sorts the chunks of the range in parallel and then merges them pairwise
+template <typename Iterator, typename Compare>
+void parallelSort(Iterator first, Iterator last, Compare comp) {
+    const size_t len = std::distance(first, last);
+    const size_t chunksNum = std::min<size_t>(parallel_get_max_threads(), len / 4096);
+    if (chunksNum < 2) {
+        std::sort(first, last, comp);
+        return;
+    }
+    std::vector<size_t> bounds(chunksNum + 1);
+    for (size_t c = 0; c <= chunksNum; c++) {
+        bounds[c] = len * c / chunksNum;
+    }
+    parallel_for(chunksNum, [&](size_t c) {
+        std::sort(first + bounds[c], first + bounds[c + 1], comp);
+    });
+    for (size_t step = 1; step < chunksNum; step *= 2) {
+        parallel_for((chunksNum + 2 * step - 1) / (2 * step), [&](size_t pair) {
+            const size_t left = 2 * step * pair;
+            const size_t middle = std::min(left + step, chunksNum);
+            const size_t right = std::min(left + 2 * step, chunksNum);
+            if (middle < right)
+                std::inplace_merge(first + bounds[left], first + bounds[middle], first + bounds[right], comp);
+        });
+    }
+}
+}  // namespace
+
 bool Unique::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!ov::is_type<op::v10::Unique>(op)) {
@@ -178,88 +221,53 @@ void Unique::flattenTensorExec() {
     if (definedOutputs[OCCURRENCES_NUM]) {
         occurTmpPtr = occurTmp.data();
     }
-    uniqueLen = inputLen;
 
-    if (sorted) {
-        cpu_parallel_memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
+    // The positions sorted by the value and then by the position make the groups of the equal elements,
+    // each group starting with the first occurrence of its value. A NaN is not equal to any value, so each NaN is
+    // a group of its own, the NaNs follow all the numbers in the order of their positions
+    std::vector<int32_t> order(inputLen);
+    parallel_for(inputLen, [&](size_t i) {
+        order[i] = static_cast<int32_t>(i);
+    });
+    parallelSort(order.begin(), order.end(), [srcDataPtr](int32_t lhs, int32_t rhs) {
+        const bool lhsNaN = isNaN(srcDataPtr[lhs]);
+        const bool rhsNaN = isNaN(srcDataPtr[rhs]);
+        if (lhsNaN || rhsNaN)
+            return lhsNaN == rhsNaN ? lhs < rhs : rhsNaN;
+        return srcDataPtr[lhs] < srcDataPtr[rhs] || (!(srcDataPtr[rhs] < srcDataPtr[lhs]) && lhs < rhs);
+    });
+    std::vector<size_t> groupsBegin;
+    for (size_t i = 0; i < inputLen; i++) {
+        if (i == 0 || !(srcDataPtr[order[i]] == srcDataPtr[order[i - 1]]))
+            groupsBegin.push_back(i);
+    }
+    uniqueLen = groupsBegin.size();
+    groupsBegin.push_back(inputLen);
+
+    // The unique elements follow the order of the values or the order of their first occurrences
+    std::vector<int32_t> groupsOrder(uniqueLen);
+    std::iota(groupsOrder.begin(), groupsOrder.end(), 0);
+    if (!sorted) {
+        parallelSort(groupsOrder.begin(), groupsOrder.end(), [&](int32_t lhs, int32_t rhs) {
+            return order[groupsBegin[lhs]] < order[groupsBegin[rhs]];
+        });
+    }
 
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
+    parallel_for(uniqueLen, [&](size_t u) {
+        const size_t begin = groupsBegin[groupsOrder[u]];
+        const size_t end = groupsBegin[groupsOrder[u] + 1];
+        uniDataTmpPtr[u] = srcDataPtr[order[begin]];
+        if (firstTmpPtr) {
+            firstTmpPtr[u] = order[begin];
         }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (size_t i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (size_t j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
-            }
+        if (inToOutTmpPtr) {
+            for (size_t i = begin; i < end; i++)
+                inToOutTmpPtr[order[i]] = static_cast<int32_t>(u);
         }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (size_t j = 0; j < uniqueLen; j++) {
-                for (size_t i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
-            }
-        }
-    } else {
-        uniDataTmpPtr[0] = srcDataPtr[0];
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            firstTmpPtr[0] = 0;
-        }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            inToOutTmpPtr[0] = 0;
-        }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
-        }
-        uniqueLen = 1;
-
-        for (size_t i = 1; i < inputLen; i++) {
-            bool found = false;
-            size_t j = 0;
-            for (; j < uniqueLen; j++) {
-                if (uniDataTmpPtr[j] == srcDataPtr[i]) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                uniDataTmpPtr[uniqueLen] = srcDataPtr[i];
-                if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                    firstTmpPtr[uniqueLen] = i;
-                }
-                uniqueLen++;
-            } else {
-                if (definedOutputs[OCCURRENCES_NUM]) {
-                    occurTmpPtr[j]++;
-                }
-            }
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = j;
-            }
+        if (occurTmpPtr) {
+            occurTmpPtr[u] = static_cast<int32_t>(end - begin);
         }
-    }
+    });
 
     redefineOutputMemory({ {uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
 
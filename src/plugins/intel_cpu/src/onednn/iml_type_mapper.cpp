@@ -115,6 +115,8 @@ const char* impl_type_to_string(impl_desc_type type) {
     CASE(brgemm_uni);
     CASE(brgemm_avx512_amx);
     CASE(brgemm_sparse_avx512_amx);
+    CASE(jit_avx512_sparse);
+    CASE(jit_avx2_sparse);
     CASE(acl);
     CASE(dw_acl);
     CASE(gemm_acl);
@@ -97,6 +97,9 @@ enum impl_desc_type {
     brgemm_avx512_amx  = brgemm  | avx512 | amx,
     brgemm_sparse_avx512_amx = brgemm | sparse | avx512 | amx,
 
+    jit_avx512_sparse  = jit | avx512 | sparse,
+    jit_avx2_sparse    = jit | avx2 | sparse,
+
     dw_acl             = _dw | acl,
     gemm_acl           = gemm | acl,
     winograd_acl       = winograd | acl,
@@ -20,10 +20,13 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "openvino/pass/pass_profile.hpp"
 
 #include <transformations/utils/utils.hpp>
 #include <ie_ngraph_utils.hpp>
 
+#include <chrono>
+
 #include "performance_heuristics.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "weights_cache.hpp"
@@ -490,6 +493,15 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     auto config = orig_config;
 
+    // the durations of the stages in milliseconds reported by ov::intel_cpu::compilation_stages
+    std::map<std::string, double> stages;
+    auto stageStart = std::chrono::steady_clock::now();
+    auto finishStage = [&](const char* stage) {
+        const auto now = std::chrono::steady_clock::now();
+        stages[stage] = std::chrono::duration<double, std::milli>(now - stageStart).count();
+        stageStart = now;
+    };
+
     CNNNetwork clonedNetwork = InferenceEngine::details::cloneNetwork(network);
     const bool enableLPT = shouldEnableLPT(config, engConfig);
     auto nGraphFunc = clonedNetwork.getFunction();
@@ -499,8 +511,31 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     DEBUG_LOG(PrintableModel(*nGraphFunc, "org_"));
 
-    Transformations transformations(nGraphFunc, enableLPT, inferencePrecision, isLegacyAPI(), snippetsMode, engConfig);
-    transformations.UpToLpt();
+    // the transformations follow the properties passed with the model as well
+    Config transformationsConfig = engConfig;
+    transformationsConfig.readProperties(config, modelType);
+    // the profile of the transformations is collected along with the performance counters
+    std::unique_ptr<ov::pass::PassProfiler> passProfiler;
+    if (transformationsConfig.collectPerfCounters)
+        passProfiler.reset(new ov::pass::PassProfiler());
+    Transformations transformations(nGraphFunc, enableLPT, inferencePrecision, isLegacyAPI(), snippetsMode, transformationsConfig);
+    // the repeated compilations of the same model with the different runtime properties skip the most expensive
+    // transformations, the model is reused from the point the streams are calculated on
+    std::string transformedModelKey;
+#ifndef CPU_DEBUG_CAPS
+    // the transformations filters and the IR dumps of the debug capabilities expect the transformations to run
+    if (transformationsConfig.transformedModelsCacheCapacity > 0)
+        transformedModelKey = TransformedModelsCache::getKey(nGraphFunc, enableLPT, inferencePrecision, isLegacyAPI(),
+                                                             snippetsMode, transformationsConfig);
+#endif
+    if (transformedModelKey.empty() || !transformedModels.restore(transformedModelKey, nGraphFunc)) {
+        transformations.UpToLpt();
+        if (!transformedModelKey.empty())
+            transformedModels.store(transformedModelKey,
+                                    nGraphFunc,
+                                    transformationsConfig.transformedModelsCacheCapacity);
+    }
+    finishStage("transformations");
 
     if (!is_cpu_map_available()) {
         ApplyPerformanceHints(config, nGraphFunc);
@@ -512,6 +547,7 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     conf.readProperties(config, modelType);
     CalculateStreams(conf, nGraphFunc);
+    finishStage("streams");
 
     transformations.PostLpt();
     transformations.Snippets();
@@ -527,9 +563,13 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
     }
 
     transformations.CpuSpecificOpSet();
+    finishStage("cpu_transformations");
 
     DEBUG_LOG(PrintableModel(*nGraphFunc, "cpu_"));
 
+    const std::string transformationsProfile = passProfiler ? passProfiler->to_json() : std::string{};
+    passProfiler.reset();
+
     // SSE runtime check is needed for some ATOM machine, which is x86-64 but w/o SSE
     static Xbyak::util::Cpu cpu;
     if (cpu.has(Xbyak::util::Cpu::tSSE)) {
@@ -542,7 +582,10 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    execNetwork->setTransformationsProfile(transformationsProfile);
+    execNetwork->addCompilationStages(stages);
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -617,6 +660,8 @@ Parameter Engine::GetConfig(const std::string& name, const std::map<std::string,
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
     } else if (name == ov::hint::execution_mode) {
         return engConfig.executionMode;
+    } else if (name == ov::hint::model_priority) {
+        return engConfig.modelPriority;
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -708,9 +753,20 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
                                                     RW_property(ov::hint::enable_cpu_pinning.name()),
                                                     RW_property(ov::hint::scheduling_core_type.name()),
                                                     RW_property(ov::hint::enable_hyper_threading.name()),
+                                                    RW_property(ov::hint::model_priority.name()),
                                                     RW_property(ov::device::id.name()),
                                                     RW_property(ov::intel_cpu::denormals_optimization.name()),
                                                     RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+                                                    RW_property(ov::intel_cpu::weights_numa_placement.name()),
+                                                    RW_property(ov::intel_cpu::huge_pages.name()),
+                                                    RW_property(ov::intel_cpu::batch_split.name()),
+                                                    RW_property(ov::intel_cpu::minimize_reorders.name()),
+                                                    RW_property(ov::intel_cpu::fast_math_ops.name()),
+                                                    RW_property(ov::intel_cpu::enable_exec_timeline.name()),
+                                                    RW_property(ov::intel_cpu::exec_timeline_capacity.name()),
+                                                    RW_property(ov::intel_cpu::warmup_shapes.name()),
+                                                    RW_property(ov::intel_cpu::max_state_reserved_length.name()),
+                                                    RW_property(ov::intel_cpu::bind_state_tensors.name()),
         };
 
         std::vector<ov::PropertyName> supportedProperties;
@@ -753,6 +809,26 @@ Parameter Engine::GetMetric(const std::string& name, const std::map<std::string,
         return decltype(ov::intel_cpu::denormals_optimization)::value_type(engConfig.denormalsOptMode == Config::DenormalsOptMode::DO_On);
     } else if (name == ov::intel_cpu::sparse_weights_decompression_rate) {
         return decltype(ov::intel_cpu::sparse_weights_decompression_rate)::value_type(engConfig.fcSparseWeiDecompressionRate);
+    } else if (name == ov::intel_cpu::weights_numa_placement) {
+        return decltype(ov::intel_cpu::weights_numa_placement)::value_type(engConfig.weightsNumaPlacement);
+    } else if (name == ov::intel_cpu::huge_pages) {
+        return decltype(ov::intel_cpu::huge_pages)::value_type(engConfig.hugePagesMode);
+    } else if (name == ov::intel_cpu::batch_split) {
+        return decltype(ov::intel_cpu::batch_split)::value_type(engConfig.batchSplit);
+    } else if (name == ov::intel_cpu::minimize_reorders) {
+        return decltype(ov::intel_cpu::minimize_reorders)::value_type(engConfig.minimizeReorders);
+    } else if (name == ov::intel_cpu::fast_math_ops) {
+        return decltype(ov::intel_cpu::fast_math_ops)::value_type(engConfig.getFastMathOps());
+    } else if (name == ov::intel_cpu::enable_exec_timeline) {
+        return decltype(ov::intel_cpu::enable_exec_timeline)::value_type(engConfig.collectExecTimeline);
+    } else if (name == ov::intel_cpu::exec_timeline_capacity) {
+        return decltype(ov::intel_cpu::exec_timeline_capacity)::value_type(engConfig.execTimelineCapacity);
+    } else if (name == ov::intel_cpu::warmup_shapes) {
+        return decltype(ov::intel_cpu::warmup_shapes)::value_type(engConfig.getWarmupShapes());
+    } else if (name == ov::intel_cpu::max_state_reserved_length) {
+        return decltype(ov::intel_cpu::max_state_reserved_length)::value_type(engConfig.maxStateReservedLength);
+    } else if (name == ov::intel_cpu::bind_state_tensors) {
+        return decltype(ov::intel_cpu::bind_state_tensors)::value_type(engConfig.bindStateTensors);
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -813,6 +889,14 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
                                             const std::map<std::string, std::string>& config) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "ImportNetwork");
 
+    std::map<std::string, double> stages;
+    auto stageStart = std::chrono::steady_clock::now();
+    auto finishStage = [&](const char* stage) {
+        const auto now = std::chrono::steady_clock::now();
+        stages[stage] = std::chrono::duration<double, std::milli>(now - stageStart).count();
+        stageStart = now;
+    };
+
     CNNNetworkDeserializer deserializer(networkModel,
         [this](const std::string& model, const Blob::CPtr& weights) {
             return GetCore()->ReadNetwork(model, weights, true);
@@ -820,6 +904,9 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
 
     CNNNetwork cnnnetwork;
     deserializer >> cnnnetwork;
+    auto packedWeights = PackedWeights::deserialize(networkModel);
+    auto selectedDescriptors = SelectedDescriptors::deserialize(networkModel);
+    finishStage("cache_read");
 
     auto function = cnnnetwork.getFunction();
     Config::ModelType modelType = getModelType(function);
@@ -827,12 +914,15 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     conf.readProperties(config, modelType);
 
     CalculateStreams(conf, function, true);
+    finishStage("streams");
 
-    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this(), packedWeights,
+                                                     selectedDescriptors);
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
     SetExeNetworkInfo(execNetwork, cnnnetwork.getFunction());
+    execNetwork->addCompilationStages(stages);
 
     return execNetwork;
 }
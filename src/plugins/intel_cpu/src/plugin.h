@@ -6,6 +6,7 @@
 
 #include "exec_network.h"
 #include "cpu_streams_calculation.hpp"
+#include "transformed_models_cache.h"
 
 #include <string>
 #include <map>
@@ -62,6 +63,8 @@ private:
     bool streamsExplicitlySetForEngine = false;
     const std::string deviceFullName;
 
+    TransformedModelsCache transformedModels;
+
     std::shared_ptr<void> specialSetup;
 };
 
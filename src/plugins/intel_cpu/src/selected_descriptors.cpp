@@ -0,0 +1,132 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "selected_descriptors.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "node.h"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+const char selectedDescriptorsTag[] = "CPU_SELECTED_DESCRIPTORS";
+
+void writeSize(std::ostream& ostream, uint64_t size) {
+    ostream.write(reinterpret_cast<const char*>(&size), sizeof size);
+}
+
+uint64_t readSize(std::istream& istream) {
+    uint64_t size = 0;
+    istream.read(reinterpret_cast<char*>(&size), sizeof size);
+    if (!istream)
+        IE_THROW(NetworkNotRead) << "The selected descriptors section is corrupted";
+    return size;
+}
+
+void writeString(std::ostream& ostream, const std::string& str) {
+    writeSize(ostream, str.size());
+    ostream.write(str.data(), str.size());
+}
+
+std::string readString(std::istream& istream) {
+    std::string str(readSize(istream), '\0');
+    istream.read(&str[0], str.size());
+    if (!istream)
+        IE_THROW(NetworkNotRead) << "The selected descriptors section is corrupted";
+    return str;
+}
+
+// The set of the supported descriptors is identified by their implementation types, the selected one also by
+// the precisions and the layouts of its ports. The dimensions and the in-place ports are not taken into account,
+// since the selected descriptor is redefined by the graph after the selection.
+std::string descriptorsSignature(const Node& node, size_t index) {
+    const auto& descs = node.getSupportedPrimitiveDescriptors();
+    std::ostringstream signature;
+    signature << descs.size();
+    for (const auto& desc : descs)
+        signature << "_" << impl_type_to_string(desc.getImplementationType());
+
+    const auto& config = descs[index].getConfig();
+    auto portSignature = [&signature](const PortConfig& port) {
+        const auto& desc = port.getMemDesc();
+        signature << "_" << desc->getPrecision().name() << ":" << desc->serializeFormat();
+    };
+    std::for_each(config.inConfs.begin(), config.inConfs.end(), portSignature);
+    signature << "|";
+    std::for_each(config.outConfs.begin(), config.outConfs.end(), portSignature);
+    return signature.str();
+}
+}  // namespace
+
+void SelectedDescriptors::add(const Node& node) {
+    const auto selectedPD = node.getSelectedPrimitiveDescriptor();
+    if (selectedPD == nullptr)
+        return;
+
+    Record record;
+    record.index = static_cast<uint64_t>(selectedPD - node.getSupportedPrimitiveDescriptors().data());
+    record.signature = descriptorsSignature(node, record.index);
+
+    std::lock_guard<std::mutex> lock(guard);
+    records[node.getName()] = std::move(record);
+}
+
+bool SelectedDescriptors::restore(Node& node) const {
+    std::lock_guard<std::mutex> lock(guard);
+    auto found = records.find(node.getName());
+    if (found == records.end() || found->second.index >= node.getSupportedPrimitiveDescriptors().size())
+        return false;
+
+    const auto& record = found->second;
+    if (descriptorsSignature(node, record.index) != record.signature)
+        return false;
+
+    node.selectPrimitiveDescriptorByIndex(static_cast<int>(record.index));
+    return true;
+}
+
+size_t SelectedDescriptors::size() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return records.size();
+}
+
+void SelectedDescriptors::serialize(std::ostream& ostream) const {
+    std::lock_guard<std::mutex> lock(guard);
+    ostream.write(selectedDescriptorsTag, sizeof selectedDescriptorsTag);
+    writeSize(ostream, records.size());
+    for (const auto& item : records) {
+        writeString(ostream, item.first);
+        writeSize(ostream, item.second.index);
+        writeString(ostream, item.second.signature);
+    }
+}
+
+SelectedDescriptors::Ptr SelectedDescriptors::deserialize(std::istream& istream) {
+    const auto pos = istream.tellg();
+    char tag[sizeof selectedDescriptorsTag] = {};
+    istream.read(tag, sizeof tag);
+    if (!istream || !std::equal(std::begin(tag), std::end(tag), std::begin(selectedDescriptorsTag))) {
+        // the model was exported without the selected descriptors, the following data belongs to the next reader
+        istream.clear();
+        istream.seekg(pos);
+        return nullptr;
+    }
+
+    auto result = std::make_shared<SelectedDescriptors>();
+    auto recordsNum = readSize(istream);
+    for (uint64_t i = 0; i < recordsNum; i++) {
+        auto name = readString(istream);
+        Record record;
+        record.index = readSize(istream);
+        record.signature = readString(istream);
+        result->records.emplace(std::move(name), std::move(record));
+    }
+    return result;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
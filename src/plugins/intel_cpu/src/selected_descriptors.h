@@ -0,0 +1,59 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ov {
+namespace intel_cpu {
+
+class Node;
+
+/**
+ * The primitive descriptors selected for the graph nodes, which are stored together with the exported model,
+ * so the imported model skips the selection of the optimal primitive descriptors.
+ * The records are identified by the node name and are restored only if the supported primitive descriptors
+ * of the node match the exported ones, otherwise the node selects the descriptor as usual.
+ *
+ * Is a thread safe
+ */
+class SelectedDescriptors {
+public:
+    typedef std::shared_ptr<SelectedDescriptors> Ptr;
+    typedef std::shared_ptr<const SelectedDescriptors> CPtr;
+
+    void add(const Node& node);
+
+    /**
+     * @brief Selects the recorded primitive descriptor of the node, returns false if there is no such record
+     * or the supported primitive descriptors of the node don't match it
+     */
+    bool restore(Node& node) const;
+
+    size_t size() const;
+
+    void serialize(std::ostream& ostream) const;
+    /**
+     * @brief Reads the records written by serialize(), returns nullptr if the stream contains no records section
+     * and leaves the stream at the same position
+     */
+    static Ptr deserialize(std::istream& istream);
+
+private:
+    struct Record {
+        uint64_t index = 0;
+        std::string signature;
+    };
+
+    mutable std::mutex guard;
+    std::map<std::string, Record> records;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -4,6 +4,7 @@
 #include "serialize.h"
 
 #include <openvino/pass/serialize.hpp>
+#include <openvino/runtime/shared_stream_buffer.hpp>
 
 #include <pugixml.hpp>
 
@@ -12,6 +13,17 @@ using namespace InferenceEngine;
 namespace ov {
 namespace intel_cpu {
 namespace {
+    // Blob over the memory of a shared cache entry, the constants of the imported network reference it without a copy
+    class SharedBlob : public TBlob<std::uint8_t> {
+    public:
+        SharedBlob(const TensorDesc& desc, const char* data, std::shared_ptr<void> owner)
+            : TBlob<std::uint8_t>(desc, reinterpret_cast<std::uint8_t*>(const_cast<char*>(data))),
+              _owner(std::move(owner)) {}
+
+    private:
+        std::shared_ptr<void> _owner;
+    };
+
     std::string to_string(InferenceEngine::Layout layout) {
         std::stringstream ss;
         ss << layout;
@@ -116,6 +128,8 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
     OPENVINO_SUPPRESS_DEPRECATED_START
     ov::pass::StreamSerialize serializer(_ostream, getCustomOpSets(), serializeInputsAndOutputs);
     OPENVINO_SUPPRESS_DEPRECATED_END
+    // the blob is read back by the IR frontend only, the binary encoding saves the XML parsing on the import
+    serializer.set_format(ov::pass::Serialize::Format::BINARY);
     serializer.run_on_model(std::const_pointer_cast<ngraph::Function>(network.getFunction()));
 }
 
@@ -146,10 +160,15 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
     // read blob content
     _istream.seekg(hdr.consts_offset);
     if (hdr.consts_size) {
-        dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(
-            InferenceEngine::TensorDesc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C));
-        dataBlob->allocate();
-        _istream.read(dataBlob->buffer(), hdr.consts_size);
+        InferenceEngine::TensorDesc desc(InferenceEngine::Precision::U8, {hdr.consts_size}, InferenceEngine::Layout::C);
+        auto sharedBuffer = dynamic_cast<ov::SharedStreamBuffer*>(_istream.rdbuf());
+        if (sharedBuffer && sharedBuffer->available() >= hdr.consts_size) {
+            dataBlob = std::make_shared<SharedBlob>(desc, sharedBuffer->current(), sharedBuffer->get_owner());
+        } else {
+            dataBlob = InferenceEngine::make_shared_blob<std::uint8_t>(desc);
+            dataBlob->allocate();
+            _istream.read(dataBlob->buffer(), hdr.consts_size);
+        }
     }
 
     // read XML content
@@ -4,16 +4,53 @@
 
 #include "shape_inference_ngraph.hpp"
 #include <memory>
+#include <common/primitive_hashing_utils.hpp>
 #include "memory_accessor.hpp"
 
 using namespace ov::intel_cpu;
 
+size_t NgraphShapeInfer::ResultKey::hash() const {
+    using namespace dnnl::impl::primitive_hashing;
+    size_t seed = 0;
+    for (const auto& dims : input_shapes) {
+        seed = get_vector_hash(seed, dims);
+    }
+    return get_vector_hash(seed, data);
+}
+
 IShapeInfer::Result
 NgraphShapeInfer::infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
         const std::unordered_map<size_t, MemoryPtr>& data_dependency) {
     const auto& iranks = m_shape_infer->get_input_ranks();
     IE_ASSERT(iranks.size() <= input_shapes.size()) << "Too few input shapes passed to Shape infer.";
+
+    // the data dependent inputs are taken in the port order, their sizes are defined by the input shapes
+    ResultKey key;
+    key.input_shapes.reserve(input_shapes.size());
+    for (const auto& shape : input_shapes) {
+        key.input_shapes.push_back(shape.get());
+    }
+    bool memoized = true;
+    for (size_t port = 0; port < input_shapes.size() && memoized; port++) {
+        auto data = data_dependency.find(port);
+        if (data == data_dependency.end())
+            continue;
+        const auto size = data->second->getSize();
+        if (key.data.size() + size > max_key_data_size) {
+            memoized = false;
+        } else {
+            const auto ptr = static_cast<const uint8_t*>(data->second->getData());
+            key.data.insert(key.data.end(), ptr, ptr + size);
+        }
+    }
+    if (memoized) {
+        if (auto cached = m_results_cache.get(key)) {
+            m_last_result = cached;
+            return cached->result;
+        }
+    }
+
     std::vector<StaticShapeRef> input_static_shapes;
 
     input_static_shapes.reserve(input_shapes.size());
@@ -41,5 +78,10 @@ NgraphShapeInfer::infer(
                        });
     }
 
+    m_last_result = std::make_shared<CachedResult>(
+        CachedResult{result, m_shape_infer->get_pads_begin(), m_shape_infer->get_pads_end()});
+    if (memoized) {
+        m_results_cache.put(key, m_last_result);
+    }
     return result;
 }
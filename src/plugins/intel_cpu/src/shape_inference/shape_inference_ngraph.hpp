@@ -6,6 +6,7 @@
 
 #include "shape_inference_cpu.hpp"
 #include "shape_inference.hpp"
+#include "cache/lru_cache.h"
 #include <ie_ngraph_utils.hpp>
 
 namespace ov {
@@ -14,12 +15,15 @@ namespace intel_cpu {
 /**
  * This class wraps core specific shape inference class to implement CPU plugin specific interface.
  *
+ * The results are memoized by the input shapes and the values of the data dependent inputs, so the dynamic shapes
+ * cycling over a few signatures (e.g. the sequence lengths of the subsequent requests) are inferred once each.
  */
 class NgraphShapeInfer : public IShapeInfer {
 public:
     NgraphShapeInfer(std::shared_ptr<IStaticShapeInfer> shape_infer, IShapeInfer::port_mask_t port_mask)
         : m_shape_infer(shape_infer),
-          m_port_mask(port_mask) {}
+          m_port_mask(port_mask),
+          m_results_cache(results_cache_capacity) {}
 
     Result infer(
         const std::vector<std::reference_wrapper<const VectorDims>>& input_shapes,
@@ -27,17 +31,40 @@ public:
 
     // infer may generate padding as by-product, these APIs is designed to retrieve them back
     const ov::CoordinateDiff& get_pads_begin() override {
-        return m_shape_infer->get_pads_begin();
+        return m_last_result ? m_last_result->pads_begin : m_shape_infer->get_pads_begin();
     }
     const ov::CoordinateDiff& get_pads_end() override {
-        return m_shape_infer->get_pads_end();
+        return m_last_result ? m_last_result->pads_end : m_shape_infer->get_pads_end();
     }
     port_mask_t get_port_mask() const override {
         return m_port_mask;
     }
 private:
+    // the values of the data dependent inputs above the limit are not copied to the key, the result is not memoized
+    static constexpr size_t max_key_data_size = 256;
+    static constexpr size_t results_cache_capacity = 16;
+
+    struct ResultKey {
+        std::vector<VectorDims> input_shapes;
+        std::vector<uint8_t> data;
+
+        size_t hash() const;
+        bool operator==(const ResultKey& rhs) const {
+            return input_shapes == rhs.input_shapes && data == rhs.data;
+        }
+    };
+
+    struct CachedResult {
+        Result result;
+        ov::CoordinateDiff pads_begin;
+        ov::CoordinateDiff pads_end;
+    };
+
     std::shared_ptr<IStaticShapeInfer> m_shape_infer;
     IShapeInfer::port_mask_t m_port_mask;
+    LruCache<ResultKey, std::shared_ptr<const CachedResult>> m_results_cache;
+    // the result of the last infer call, its pads are returned by get_pads_begin/get_pads_end
+    std::shared_ptr<const CachedResult> m_last_result;
 };
 
 } // namespace intel_cpu
@@ -0,0 +1,33 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "convert_gelu_to_tanh.hpp"
+
+#include <openvino/op/gelu.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+#include "itt.hpp"
+
+ov::intel_cpu::ConvertGeluToTanh::ConvertGeluToTanh() {
+    MATCHER_SCOPE(ConvertGeluToTanh);
+    auto gelu = ngraph::pattern::wrap_type<ov::op::v0::Gelu, ov::op::v7::Gelu>();
+
+    ngraph::matcher_pass_callback callback = [](ngraph::pattern::Matcher& m) {
+        const auto root = m.get_match_root();
+        if (const auto gelu = ov::as_type_ptr<ov::op::v7::Gelu>(root)) {
+            if (gelu->get_approximation_mode() == ov::op::GeluApproximationMode::TANH)
+                return false;
+        }
+
+        const auto geluTanh = std::make_shared<ov::op::v7::Gelu>(root->input_value(0), ov::op::GeluApproximationMode::TANH);
+        geluTanh->set_friendly_name(root->get_friendly_name());
+        ngraph::copy_runtime_info(root, geluTanh);
+        ngraph::replace_node(root, geluTanh);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(gelu, matcher_name);
+    this->register_matcher(m, callback);
+}
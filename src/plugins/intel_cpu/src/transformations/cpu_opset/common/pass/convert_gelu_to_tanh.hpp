@@ -0,0 +1,22 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Replaces the erf based Gelu with the tanh approximation, which is computed by the cheaper polynomials
+ */
+class ConvertGeluToTanh: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ConvertGeluToTanh", "0");
+    ConvertGeluToTanh();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -161,14 +161,14 @@ ov::intel_cpu::MHAFloatFusion::MHAFloatFusion() {
 ov::intel_cpu::MHAFloatFusion2::MHAFloatFusion2() {
     MATCHER_SCOPE(MHAFloatFusion2);
 
-    auto in0 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
-    auto in1 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
-    auto in3 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto in0 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto in1 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto in3 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
     auto in4 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in5 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in6 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in7 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
-    auto in8 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto in8 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
     auto in9 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in10 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto transpose0 = std::make_shared<ngraph::opset3::Transpose>(in0, in4);
@@ -187,16 +187,8 @@ ov::intel_cpu::MHAFloatFusion2::MHAFloatFusion2() {
         auto add_in1 = pattern_to_output.at(in3);
         auto transpose2_in = pattern_to_output.at(in8);
 
-        if (transpose0_in.get_shape() != transpose1_in.get_shape() || transpose0_in.get_shape() != transpose2_in.get_shape()) {
-            return false;
-        }
-
-        if (transpose0_in.get_shape().size() != 4) {
-            return false;
-        }
-
-        auto expected_add_shape = Shape({transpose0_in.get_shape()[0], 1, 1, transpose0_in.get_shape()[1]});
-        if (add_in1.get_shape() != expected_add_shape) {
+        if (!valid_input_shapes(transpose0_in.get_partial_shape(), transpose1_in.get_partial_shape(),
+                                transpose2_in.get_partial_shape(), add_in1.get_partial_shape())) {
             return false;
         }
 
@@ -444,13 +436,13 @@ ov::intel_cpu::MHAQuantFusion::MHAQuantFusion() {
 ov::intel_cpu::MHAQuantFusion2::MHAQuantFusion2() {
     MATCHER_SCOPE(MHAQuantFusion2);
 
-    auto in0 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
-    auto in1 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto in0 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
+    auto in1 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
     auto in2 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
-    auto in3 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto in3 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
     auto in4 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in5 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
-    auto in8 = ngraph::pattern::any_input(ngraph::pattern::has_static_shape());
+    auto in8 = ngraph::pattern::any_input(ngraph::pattern::has_static_rank());
     auto in9 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto in10 = ngraph::pattern::wrap_type<ngraph::opset4::Constant>();
     auto transpose0 = std::make_shared<ngraph::opset3::Transpose>(in0, in4);
@@ -481,16 +473,8 @@ ov::intel_cpu::MHAQuantFusion2::MHAQuantFusion2() {
         auto add_in1 = pattern_to_output.at(in3);
         auto transpose2_in = pattern_to_output.at(in8);
 
-        if (transpose0_in.get_shape() != transpose1_in.get_shape() || transpose0_in.get_shape() != transpose2_in.get_shape()) {
-            return false;
-        }
-
-        if (transpose0_in.get_shape().size() != 4) {
-            return false;
-        }
-
-        auto expected_add_shape = Shape({transpose0_in.get_shape()[0], 1, 1, transpose0_in.get_shape()[1]});
-        if (add_in1.get_shape() != expected_add_shape) {
+        if (!valid_input_shapes(transpose0_in.get_partial_shape(), transpose1_in.get_partial_shape(),
+                                transpose2_in.get_partial_shape(), add_in1.get_partial_shape())) {
             return false;
         }
 
@@ -498,8 +482,8 @@ ov::intel_cpu::MHAQuantFusion2::MHAQuantFusion2() {
         if (auto mul_node = ngraph::as_type_ptr<ngraph::opset3::Multiply>(pattern_to_output.at(mul).get_node_shared_ptr())) {
             mul_scales = ngraph::as_type_ptr<ngraph::opset4::Constant>(mul_node->get_input_node_shared_ptr(1))->cast_vector<float>();
 
-            auto expected_shape = ngraph::Shape({1, transpose0_in.get_shape()[2], 1, 1});
-            if (mul_scales.size() != 1 && mul_node->get_input_shape(1) != expected_shape) {
+            auto expected_shape = ov::PartialShape({1, transpose0_in.get_partial_shape()[2], 1, 1});
+            if (mul_scales.size() != 1 && !mul_node->get_input_partial_shape(1).compatible(expected_shape)) {
                 return false;
             }
         } else {
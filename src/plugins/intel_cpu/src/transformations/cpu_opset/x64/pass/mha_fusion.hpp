@@ -23,6 +23,31 @@ protected:
 
         return true;
     }
+
+    // Query [B, Lq, H, S], key [B, Lk, H, S] and value [B, Lk, H, Sv] may have the dynamic dimensions, the query
+    // length may differ from the key/value one (e.g. a decoder step attending to the past tokens).
+    // The attention mask is broadcasted along the heads and the query length: [B, 1, 1, Lk] or [1, 1, 1, Lk].
+    bool valid_input_shapes(const ov::PartialShape& query, const ov::PartialShape& key, const ov::PartialShape& value,
+                            const ov::PartialShape& mask) {
+        for (const auto& shape : {query, key, value, mask}) {
+            if (shape.rank().is_dynamic() || shape.rank().get_length() != 4)
+                return false;
+        }
+
+        if (!query[0].compatible(key[0]) || !query[0].compatible(value[0]))
+            return false;
+        if (!query[2].compatible(key[2]) || !query[2].compatible(value[2]))
+            return false;
+        if (!query[3].compatible(key[3]) || !key[1].compatible(value[1]))
+            return false;
+
+        if (!mask[0].compatible(query[0]) && mask[0] != 1)
+            return false;
+        if (mask[1] != 1 || mask[2] != 1)
+            return false;
+        // the mask is not broadcasted along the key length
+        return mask[3].compatible(key[1]) && (mask[3] != 1 || key[1] == 1);
+    }
 };
 
 class MHAFloatFusion: public MHAFusionBase {
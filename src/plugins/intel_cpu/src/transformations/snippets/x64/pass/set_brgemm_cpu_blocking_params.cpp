@@ -17,6 +17,7 @@
 #include <cpu/x64/cpu_isa_traits.hpp>
 
 #include "cpu_shape.h"
+#include "onednn/dnnl.h"
 #include "utils/general_utils.h"
 
 
@@ -56,7 +57,20 @@ pass::SetBrgemmCPUBlockingParams::SetBrgemmCPUBlockingParams() {
 
         // Ticket: 113745
         // TODO: extend block size selection heuristics
-        const size_t brgemm_block_size_m = 32;
+        // The M block of the rows of the attention matrix (the output of the first Brgemm and the input of the second one)
+        // is stored in the Buffers between the Brgemms. The block is reduced for the long sequences, so these Buffers stay
+        // in L2 instead of streaming through the memory. Both Brgemms of MHA get the same block size, since the sequence is
+        // N of the first one and K of the second one, so their M Loops are still fused.
+        const size_t brgemm_block_size_m = [&]() {
+            // AMX tiles have 16 rows
+            const size_t min_block_size_m = input_1_precision != ov::element::f32 ? 16 : 8;
+            const size_t row_size = std::max(K, N) * sizeof(float);
+            const size_t buffers_cache_size = dnnl::utils::get_cache_size(2, true) / 2;
+            size_t block_size_m = 32;
+            while (block_size_m > min_block_size_m && block_size_m * row_size > buffers_cache_size)
+                block_size_m /= 2;
+            return block_size_m;
+        }();
         const size_t brgemm_block_size_k = [&]() {
             if (input_1_precision != ov::element::f32)
                 return K;
@@ -4,6 +4,8 @@
 #include "snippets_mark_skipped.hpp"
 
 #include "snippets/pass/tokenization.hpp"
+#include "snippets/pass/collapse_subgraph.hpp"
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
 #include "snippets/op/subgraph.hpp"
 #include "snippets/utils.hpp"
 
@@ -190,6 +192,16 @@ inline bool isSuitableReduceParent(const std::shared_ptr<const Node> &node) {
     bool out_is_f32 = node->get_output_element_type(0) == ov::element::f32;
     return is_suitable_reduce && is_not_min_max && out_is_f32;
 }
+// The reduction over the last dimension of the tokenized chain (e.g. the normalization blocks) joins the Subgraph,
+// so it's not a fusing parent of the Reduce node
+inline bool isSuitableSnippetsReduce(const std::shared_ptr<const Node> &node) {
+    if (!snippets::pass::ReduceToSnippetsReduce::is_supported_reduce(node))
+        return false;
+    const auto parent = node->get_input_node_shared_ptr(0);
+    return !ov::is_type<ov::op::v0::Parameter>(parent) && !ov::is_type<ov::op::v0::Constant>(parent) &&
+           snippets::pass::GetSnippetsNodeType(parent) != snippets::pass::SnippetsNodeType::SkippedByPlugin &&
+           snippets::pass::TokenizeSnippets::AppropriateForSubgraph(parent);
+}
 // Subtract as ZeroPoints for Convolution
 bool isSuitableSubtractAsZeroPointsParent(const std::shared_ptr<const Node> &node) {
     const bool is_suitable_node = ov::is_type<ov::op::v1::Subtract>(node);
@@ -390,6 +402,18 @@ bool isSuitableParentForFusingSumActivation(const std::shared_ptr<const Node> &n
     }
     return getNumNonConstInputs(node) == 2 && num_conv_parents >=1;
 }
+// FuseInterpolateAndSum: the addition of a tensor of the nearest Interpolate output shape is done by the Interpolate
+bool isSuitableInterpolateSumChild(const std::shared_ptr<const Node> &node) {
+    if (!ov::is_type<ov::op::v1::Add>(node) || node->get_output_partial_shape(0).is_dynamic() ||
+        node->get_input_partial_shape(0) != node->get_input_partial_shape(1))
+        return false;
+    for (const auto& input : node->input_values()) {
+        const auto interpolate = ov::as_type_ptr<ov::op::v4::Interpolate>(input.get_node_shared_ptr());
+        if (interpolate && interpolate->get_attrs().mode == ov::op::v4::Interpolate::InterpolateMode::NEAREST)
+            return true;
+    }
+    return false;
+}
 bool isSuitableChildForFusingSumActivation(const std::shared_ptr<const Node> &node) {
     return SupportsFusingWithConvolution_SumActivation(node);
 }
@@ -485,6 +509,8 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
         } else if (isSuitableBinaryConvolutionParent(node)) {
             SetNodeFusingType(node, NodeFusingType::FusedWithBinaryConvolution);
             channelAxis = DEFAULT_AXIS;
+        } else if (isSuitableSnippetsReduce(node)) {
+            channelAxis = DEFAULT_AXIS;
         } else if (isSuitableReduceParent(node)) {
             const auto reduce = std::dynamic_pointer_cast<const ov::op::util::ArithmeticReductionKeepDims>(node);
             channelAxis = getChannelAxis(reduce->get_reduction_axes(), reduce->get_keep_dims());
@@ -518,6 +544,8 @@ bool SnippetsMarkSkipped::run_on_model(const std::shared_ptr<ov::Model> &m) {
                         PropagateIfHasOnlyChild(node, fusingChainType);
                 } else if (isSuitableChildForFusingSimple(node, channelAxis)) {
                     PropagateIfHasOnlyChild(node, fusingChainType);
+                } else if (fusingChainType == NodeFusingType::FusedWithMisc && isSuitableInterpolateSumChild(node)) {
+                    SetNodeFusingType(node, NodeFusingType::FusedTerminator);
                 } else if (fusingChainType == NodeFusingType::FusedWithConvolution ||
                            fusingChainType == NodeFusingType::FusedWithBinaryConvolution) {
                     if (isSuitableParentForFusingSumActivation(node)) {
@@ -28,6 +28,7 @@
 #include "transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp"
 #include "transformations/common_optimizations/augru_cell_fusion.hpp"
 #include "transformations/common_optimizations/common_optimizations.hpp"
+#include "transformations/common_optimizations/matmul_horizontal_fusion.hpp"
 #include "transformations/common_optimizations/wrap_interpolate_into_transposes.hpp"
 #include "transformations/common_optimizations/matmul_const_transposes_extraction.hpp"
 #include "transformations/control_flow/unroll_tensor_iterator.hpp"
@@ -97,6 +98,7 @@
 #include "transformations/cpu_opset/convert_to_cpu_specific_opset.hpp"
 #include "transformations/snippets/x64/pass/snippets_mark_skipped.hpp"
 #include "transformations/cpu_opset/x64/pass/convert_to_interaction.hpp"
+#include "transformations/cpu_opset/x64/pass/mha_fusion.hpp"
 #include "transformations/cpu_opset/arm/pass/convert_group_conv.hpp"
 #include "transformations/cpu_opset/arm/pass/convert_group_conv1d.hpp"
 #include "transformations/cpu_opset/arm/pass/convert_reduce_multi_axis.hpp"
@@ -106,6 +108,7 @@
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
 #include "transformations/cpu_opset/common/pass/move_eltwise_up_data_movement.hpp"
 #include "transformations/cpu_opset/common/pass/swap_convert_transpose.hpp"
+#include "transformations/cpu_opset/common/pass/convert_gelu_to_tanh.hpp"
 
 // Snippets
 #include "snippets/pass/tokenization.hpp"
@@ -113,6 +116,8 @@
 #include "snippets/pass/collapse_subgraph.hpp"
 #include "snippets/pass/common_optimizations.hpp"
 #include "snippets/pass/extract_reshapes_from_mha.hpp"
+#include "snippets/pass/reduce_to_snippets_reduce.hpp"
+#include "snippets/pass/transpose_decomposition.hpp"
 
 // Misc
 #include "nodes/mvn.h"
@@ -208,8 +213,9 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
         CPU_REGISTER_PASS_COMMON(manager, ov::pass::MarkDequantizationSubgraph, defaultPrecisions);
     } else {
         // MarkDequantizationSubgraph is used even in non-LPT pipeline on X64 platforms
-        // in order to keep compressed u8 MatMul weights with decompression operations as is
-        CPU_REGISTER_PASS_X64(manager, ov::pass::MarkDequantizationSubgraph, ov::element::TypeVector{ov::element::u8}, true);
+        // in order to keep compressed u8/u4/i4 MatMul weights with decompression operations as is
+        CPU_REGISTER_PASS_X64(manager, ov::pass::MarkDequantizationSubgraph,
+                              ov::element::TypeVector{ov::element::u8, ov::element::u4, ov::element::i4}, true);
         CPU_SET_CALLBACK_X64(manager, [](const_node_ptr &node) -> bool {
             auto get_single_consumer = [](const_node_ptr &node) -> std::shared_ptr<ov::Node> {
                 const auto consumers = node->get_output_target_inputs(0);
@@ -222,6 +228,13 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
             if (!consumer)
                 return true;
 
+            // the group-wise decompressed weights are reshaped to the MatMul weights shape
+            if (ov::is_type<ov::opset1::Reshape>(consumer)) {
+                consumer = get_single_consumer(consumer);
+                if (!consumer)
+                    return true;
+            }
+
             if (ov::is_type<ov::opset1::MatMul>(consumer)) {
                 return false;
             } else if (ov::is_type<ov::opset1::Transpose>(consumer)) {
@@ -243,10 +256,13 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
             {ov::element::u32,     ov::element::i32},
             {ov::element::f64,     ov::element::f32},
             {ov::element::f16,     ov::element::f32},
-            {ov::element::boolean, ov::element::u8},
-            {ov::element::i4,      ov::element::i8},
-            {ov::element::u4,      ov::element::u8}
+            {ov::element::boolean, ov::element::u8}
         };
+        // the compressed 4-bit weights are kept packed on the platforms supporting their decompression in FullyConnected
+        if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx2)) {
+            map.insert({ov::element::i4, ov::element::i8});
+            map.insert({ov::element::u4, ov::element::u8});
+        }
         // @todo should we always convert to f32 regardless of hardware support, as it is done for f16?
         if (!dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core))
             map.insert({ov::element::bf16, ov::element::f32});
@@ -258,6 +274,7 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
 
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::AUGRUCellFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::CommonOptimizations);
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::MatMulHorizontalFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::WrapInterpolateIntoTransposes);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::TransposeSinking);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConvertSequenceToTensorIterator);
@@ -304,6 +321,16 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
     CPU_REGISTER_PASS_ARM(manager, DecomposeIntegerDivide);
     CPU_REGISTER_PASS_X86(manager, DecomposeIntegerDivide);
 
+    // the outputs of Split are in-place only if the outer dims are 1 (e.g. a single token), otherwise the split
+    // copies the whole output of the fused MatMul
+    CPU_SET_CALLBACK_COMMON(manager,
+        [](const_node_ptr &node) -> bool {
+            const auto& shape = node->get_output_partial_shape(0);
+            return shape.rank().is_dynamic() ||
+                   !std::all_of(shape.begin(), shape.end() - 1, [](const ov::Dimension& dim) { return dim == 1; });
+        },
+        ov::pass::MatMulHorizontalFusion);
+
     // SpaceToDepth/ DepthToSpace node implementation supports only equal input/output tensors with rank <= 5
     CPU_SET_CALLBACK_COMMON(manager,
         [](const_node_ptr &node) -> bool {
@@ -543,7 +570,22 @@ void Transformations::PostLpt() {
     CPU_SET_CALLBACK_COMMON(postLPTPassManager,
         [](const_node_ptr &node) -> bool {
             // UnrollTI transformation is disabled by default, is turned on by LowLatency transformation
-            return node->get_rt_info().count("UNROLL_TI") == 0;
+            if (node->get_rt_info().count("UNROLL_TI") != 0)
+                return false;
+            // The stateful TensorIterator made by LowLatency2 processing a short chunk of the time steps per inference
+            // is unrolled, so the steps are fused and executed without the per iteration overhead of the TensorIterator node
+            const auto ti = ov::as_type_ptr<const ov::op::v0::TensorIterator>(node);
+            if (!ti || ti->get_num_iterations() < 1 || ti->get_num_iterations() > 16)
+                return true;
+            bool has_state = false;
+            for (const auto& in : ti->get_input_descriptions()) {
+                if (!std::dynamic_pointer_cast<ov::op::util::SubGraphOp::MergedInputDescription>(in))
+                    continue;
+                if (!ov::as_type_ptr<ov::op::util::ReadValueBase>(ti->get_input_node_shared_ptr(in->m_input_index)))
+                    return true;
+                has_state = true;
+            }
+            return !has_state;
         },
         ov::pass::UnrollTensorIterator);
     CPU_REGISTER_PASS_COMMON(postLPTPassManager, MoveEltwiseUpThroughDataMov);
@@ -556,10 +598,23 @@ void Transformations::PostLpt() {
         },
         MoveEltwiseUpThroughDataMov);
 
+    if (config.isFastMath("Gelu"))
+        CPU_REGISTER_PASS_COMMON(postLPTPassManager, ConvertGeluToTanh);
+
     CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::ConstantFolding);
 
     CPU_REGISTER_PASS_X64(postLPTPassManager, FuseFQtoInteraction);
 
+    // Snippets tokenize the MHA pattern of the static shapes only, the dynamic one (e.g. the decoder attention
+    // with the growing key/value length) is executed by the fused MHA node
+    CPU_REGISTER_PASS_X64(postLPTPassManager, MHAFusion);
+    CPU_SET_CALLBACK_X64(postLPTPassManager,
+        [](const_node_ptr &node) -> bool {
+            std::string errorMessage;
+            return !node->is_dynamic() || !node::MHA::isSupportedOperation(node, errorMessage);
+        },
+        MHAFloatFusion, MHAFloatFusion2, MHAQuantFusion, MHAQuantFusion2);
+
     // Execute before snippets. Otherwise FQ will be converted to Subgraph
     CPU_REGISTER_PASS_X64(postLPTPassManager, ConvertFqRnnToQuantizedRnn);
     postLPTPassManager.run_passes(model);
@@ -664,8 +719,30 @@ void Transformations::MainSnippets(void) {
             return !is_supported_matmul(n) || is_unsupported_parallel_work_amount(n, n->get_output_shape(0));
         }, snippets::pass::ExtractReshapesFromMHA);
         CPU_SET_CALLBACK_X64(snippetsManager,
-            [](const std::shared_ptr<const ov::Node>& n) -> bool {
-                if (n->is_dynamic())
+            [this](const std::shared_ptr<const ov::Node>& n) -> bool {
+                // the kernels of the dynamic subgraphs take the outer dimensions at runtime, while the innermost one
+                // defines the loops of the kernel
+                auto has_static_innermost_dim = [](const ov::PartialShape& shape) {
+                    return shape.rank().is_static() && (shape.size() == 0 || shape.rbegin()->is_static());
+                };
+                auto is_supported_dynamic = [&]() {
+                    if (!config.dynamicSnippets)
+                        return false;
+                    for (const auto& in : n->inputs()) {
+                        if (!has_static_innermost_dim(in.get_partial_shape()))
+                            return false;
+                    }
+                    for (const auto& out : n->outputs()) {
+                        if (!has_static_innermost_dim(out.get_partial_shape()))
+                            return false;
+                    }
+                    return true;
+                };
+                if (n->is_dynamic() && !is_supported_dynamic())
+                    return true;
+                // the snippets emitters are created from the op only, so the fast approximation of Erf is left to
+                // the Eltwise node
+                if (ov::is_type<const ov::op::v0::Erf>(n) && config.isFastMath("Erf"))
                     return true;
                 // CPU Plugin support Swish in Subgraph via conversion to SwichCPU which assumes second input to be constant
                 const bool is_unsupported_swish =
@@ -673,16 +750,36 @@ void Transformations::MainSnippets(void) {
                         !ov::is_type<const ov::op::v0::Constant>(n->get_input_node_shared_ptr(1));
                 if (is_unsupported_swish)
                     return true;
+                // the Transpose keeping the innermost dimension starts the Subgraph: its consumers read the transposed data
+                // directly from the input by the vector loads, so the transposed tensor is not materialized
+                auto is_fusable_transpose = [](const std::shared_ptr<const ov::Node>& n) {
+                    if (n->get_output_target_inputs(0).size() != 1 ||
+                        ov::is_type<const snippets::op::Subgraph>(n->get_input_node_shared_ptr(0)))
+                        return false;
+                    const auto order = ov::as_type_ptr<const ov::op::v0::Constant>(n->get_input_node_shared_ptr(1));
+                    if (!order)
+                        return false;
+                    const auto consumer = n->get_output_target_inputs(0).begin()->get_node();
+                    return snippets::pass::TransposeDecomposition::is_vectorized_order(order->cast_vector<int>()) &&
+                           !ov::is_type<const ov::op::v0::Result>(consumer) && !ov::is_type<const ov::op::v0::MatMul>(consumer);
+                };
                 // todo: general tokenization flow is not currently supported for these operations.
                 //  they can be tokenized only as a part of complex patterns
                 const bool is_disabled_tokenization = (ov::is_type<const ov::op::v1::Softmax>(n) ||
                                                        ov::is_type<const ov::op::v8::Softmax>(n) ||
                                                        ov::is_type<const ov::op::v0::MatMul>(n) ||
-                                                       ov::is_type<const ov::op::v1::Transpose>(n) ||
+                                                       (ov::is_type<const ov::op::v1::Transpose>(n) && !is_fusable_transpose(n)) ||
                                                        ov::is_type<const ov::op::v1::Broadcast>(n) ||
                                                        ov::is_type<const ov::op::v3::Broadcast>(n));
                 if (is_disabled_tokenization)
                     return true;
+                // the standalone reduction is executed by the Reduce node, while the one consuming the tokenized chain
+                // (e.g. the normalization blocks) joins the Subgraph
+                const bool is_standalone_reduce =
+                        snippets::pass::ReduceToSnippetsReduce::is_supported_reduce(n) &&
+                        !ov::is_type<const snippets::op::Subgraph>(n->get_input_node_shared_ptr(0));
+                if (is_standalone_reduce)
+                    return true;
                 const auto& inputs = n->inputs();
                 // todo: clarify whether we can evaluate snippets on const paths
                 const bool has_only_const_inputs = std::all_of(inputs.begin(), inputs.end(),
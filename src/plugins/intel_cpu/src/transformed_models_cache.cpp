@@ -0,0 +1,115 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "transformed_models_cache.h"
+
+#include <algorithm>
+#include <sstream>
+
+#include "openvino/pass/manager.hpp"
+#include "transformations/hash.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+// Replaces the operations of the target model with the ones of the source model having the same inputs and outputs.
+// The target keeps its parameters and results, since the CNNNetwork info refers to them.
+bool replaceModelBody(const std::shared_ptr<ov::Model>& target, const std::shared_ptr<ov::Model>& source) {
+    const auto& params = target->get_parameters();
+    const auto& results = target->get_results();
+    if (params.size() != source->get_parameters().size() || results.size() != source->get_results().size())
+        return false;
+
+    for (size_t i = 0; i < params.size(); i++) {
+        const auto& sourceParam = source->get_parameters()[i];
+        params[i]->set_element_type(sourceParam->get_element_type());
+        params[i]->set_partial_shape(sourceParam->get_partial_shape());
+        params[i]->get_rt_info() = sourceParam->get_rt_info();
+        params[i]->output(0).get_rt_info() = sourceParam->output(0).get_rt_info();
+        params[i]->validate_and_infer_types();
+        for (auto& input : sourceParam->output(0).get_target_inputs())
+            input.replace_source_output(params[i]->output(0));
+    }
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto& sourceResult = source->get_results()[i];
+        results[i]->input(0).replace_source_output(sourceResult->input_value(0));
+        results[i]->get_rt_info() = sourceResult->get_rt_info();
+        results[i]->validate_and_infer_types();
+    }
+
+    const auto sinks = target->get_sinks();
+    for (const auto& sink : sinks)
+        target->remove_sink(sink);
+    target->add_sinks(source->get_sinks());
+    const auto variables = target->get_variables();
+    for (const auto& variable : variables)
+        target->remove_variable(variable);
+    target->add_variables(source->get_variables());
+    target->get_rt_info() = source->get_rt_info();
+    return true;
+}
+}  // namespace
+
+std::string TransformedModelsCache::getKey(const std::shared_ptr<ov::Model>& model,
+                                           const bool enableLPT,
+                                           const ov::element::Type inferencePrecision,
+                                           const bool isLegacyAPI,
+                                           const Config::SnippetsMode snippetsMode,
+                                           const Config& config) {
+    uint64_t hash = 0;
+    ov::pass::Manager manager;
+    manager.register_pass<ov::pass::Hash>(hash);
+    manager.run_passes(model);
+
+    std::stringstream key;
+    key << hash;
+    // the runtime info is not serialized completely by the hash pass, though the transformations rely on it
+    for (const auto& op : model->get_ordered_ops()) {
+        for (const auto& rtInfo : op->get_rt_info()) {
+            key << ';' << rtInfo.first << '=';
+            rtInfo.second.print(key);
+        }
+    }
+    key << '|' << enableLPT << '|' << inferencePrecision << '|' << isLegacyAPI << '|' << static_cast<int>(snippetsMode)
+        << '|' << config.executionMode << '|' << config.getFastMathOps() << '|' << config.dynamicSnippets;
+    return key.str();
+}
+
+bool TransformedModelsCache::restore(const std::string& key, const std::shared_ptr<ov::Model>& model) {
+    std::shared_ptr<ov::Model> transformedModel;
+    {
+        std::lock_guard<std::mutex> lock{guard};
+        auto it = std::find_if(entries.begin(), entries.end(), [&key](const Entry& entry) {
+            return entry.first == key;
+        });
+        if (it == entries.end())
+            return false;
+        entries.splice(entries.begin(), entries, it);
+        transformedModel = it->second;
+    }
+    // the constants of the clone share the data with the stored model
+    return replaceModelBody(model, transformedModel->clone());
+}
+
+void TransformedModelsCache::store(const std::string& key, const std::shared_ptr<ov::Model>& model, size_t capacity) {
+    auto transformedModel = model->clone();
+    std::lock_guard<std::mutex> lock{guard};
+    const bool stored = std::any_of(entries.begin(), entries.end(), [&key](const Entry& entry) {
+        return entry.first == key;
+    });
+    if (stored)
+        return;
+    entries.emplace_front(key, transformedModel);
+    while (entries.size() > capacity)
+        entries.pop_back();
+}
+
+size_t TransformedModelsCache::size() const {
+    std::lock_guard<std::mutex> lock{guard};
+    return entries.size();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,59 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+
+#include "config.h"
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * The models transformed up to LPT by the recent compilations, so the repeated compilations of the same model with
+ * the different runtime properties (streams, hints, affinity, etc.) skip the most expensive transformations.
+ * The least recently used model is dropped once the capacity is exceeded.
+ *
+ * Is a thread safe
+ */
+class TransformedModelsCache {
+public:
+    /**
+     * @brief Identifies the result of the transformations up to LPT: the model itself and the properties these
+     * transformations depend on. The runtime properties are not a part of the key, since the model is transformed
+     * before the streams are calculated.
+     */
+    static std::string getKey(const std::shared_ptr<ov::Model>& model,
+                              const bool enableLPT,
+                              const ov::element::Type inferencePrecision,
+                              const bool isLegacyAPI,
+                              const Config::SnippetsMode snippetsMode,
+                              const Config& config);
+
+    /**
+     * @brief Replaces the operations of the model with the ones of the stored transformed model, the model keeps its
+     * parameters and results. Returns false if there is no model stored by the key
+     */
+    bool restore(const std::string& key, const std::shared_ptr<ov::Model>& model);
+
+    void store(const std::string& key, const std::shared_ptr<ov::Model>& model, size_t capacity);
+
+    size_t size() const;
+
+private:
+    using Entry = std::pair<std::string, std::shared_ptr<ov::Model>>;
+
+    mutable std::mutex guard;
+    // the most recently used first
+    std::list<Entry> entries;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -58,6 +58,10 @@ void DebugCapsConfig::readProperties() {
         summaryPerf = envVarValue;
     }
 
+    if ((envVarValue = readEnv("OV_CPU_SNIPPETS_PERF_COUNT"))) {
+        snippetsPerfCount = envVarValue;
+    }
+
     if ((envVarValue = readEnv("OV_CPU_DISABLE")))
         disable.parseAndSet(envVarValue);
 
@@ -0,0 +1,251 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "huge_pages.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#    include <sys/mman.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+namespace {
+thread_local ov::intel_cpu::HugePagesMode currentMode = ov::intel_cpu::HugePagesMode::DISABLED;
+}  // namespace
+
+HugePagesScope::HugePagesScope(ov::intel_cpu::HugePagesMode mode) : prevMode(currentMode) {
+    currentMode = mode;
+}
+
+HugePagesScope::~HugePagesScope() {
+    currentMode = prevMode;
+}
+
+HugePagesAdvice::HugePagesAdvice(const void* ptr, size_t size)
+    : ptr(ptr), size(size), advised(adviseHugePages(ptr, size)) {}
+
+HugePagesAdvice::~HugePagesAdvice() {
+    if (advised)
+        unadviseHugePages(ptr, size);
+}
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+namespace {
+constexpr uintptr_t hugePageSize = 2 * 1024 * 1024;
+
+struct Region {
+    size_t size;
+    bool explicitPages;  // allocated from the hugetlbfs pool, so the whole region is backed
+    bool owned;          // allocated by allocateHugePages, otherwise only advised
+    size_t advices;      // the same region may be advised by several owners (e.g. a constant shared by the streams)
+};
+
+struct Registry {
+    std::mutex guard;
+    std::map<uintptr_t, Region> regions;
+};
+
+Registry& getRegistry() {
+    // is never destroyed, since the memory may be released by the static objects destructors
+    static auto* registry = new Registry();
+    return *registry;
+}
+
+void registerRegion(const void* ptr, const Region& region) {
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.guard);
+    auto found = registry.regions.find(reinterpret_cast<uintptr_t>(ptr));
+    if (found != registry.regions.end() && !found->second.owned && !region.owned && found->second.size == region.size) {
+        found->second.advices++;
+        return;
+    }
+    registry.regions[reinterpret_cast<uintptr_t>(ptr)] = region;
+}
+
+struct AlignedRange {
+    uintptr_t begin;
+    uintptr_t end;
+};
+
+// the huge pages entirely covered by the region
+AlignedRange getAlignedRange(const void* ptr, size_t size) {
+    const auto begin = reinterpret_cast<uintptr_t>(ptr);
+    return {(begin + hugePageSize - 1) / hugePageSize * hugePageSize, (begin + size) / hugePageSize * hugePageSize};
+}
+
+void* mapExplicitPages(size_t size) {
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+    return ptr == MAP_FAILED ? nullptr : ptr;
+}
+
+void* mapTransparentPages(size_t size) {
+    // the mapping is over allocated to align it on the huge page, which the kernel does not guarantee
+    const size_t mappedSize = size + hugePageSize;
+    void* raw = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED)
+        return nullptr;
+
+    const auto begin = reinterpret_cast<uintptr_t>(raw);
+    const auto alignedBegin = (begin + hugePageSize - 1) / hugePageSize * hugePageSize;
+    if (alignedBegin > begin)
+        munmap(raw, alignedBegin - begin);
+    const auto tailSize = begin + mappedSize - (alignedBegin + size);
+    if (tailSize)
+        munmap(reinterpret_cast<void*>(alignedBegin + size), tailSize);
+
+    void* ptr = reinterpret_cast<void*>(alignedBegin);
+    if (madvise(ptr, size, MADV_HUGEPAGE) != 0) {
+        // THP is disabled in the kernel, the regular allocation is cheaper to manage
+        munmap(ptr, size);
+        return nullptr;
+    }
+    return ptr;
+}
+}  // namespace
+
+void* allocateHugePages(size_t size) {
+    const auto mode = currentMode;
+    if (mode == ov::intel_cpu::HugePagesMode::DISABLED || size < hugePageSize)
+        return nullptr;
+
+    const size_t alignedSize = (size + hugePageSize - 1) / hugePageSize * hugePageSize;
+    if (mode == ov::intel_cpu::HugePagesMode::HUGETLBFS) {
+        if (void* ptr = mapExplicitPages(alignedSize)) {
+            registerRegion(ptr, {alignedSize, true, true, 0});
+            return ptr;
+        }
+        // the pool is not configured or exhausted, the transparent huge pages are tried instead
+    }
+    if (void* ptr = mapTransparentPages(alignedSize)) {
+        registerRegion(ptr, {alignedSize, false, true, 0});
+        return ptr;
+    }
+    return nullptr;
+}
+
+void freeHugePages(void* ptr) {
+    if (!ptr)
+        return;
+
+    size_t size = 0;
+    {
+        auto& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.guard);
+        auto found = registry.regions.find(reinterpret_cast<uintptr_t>(ptr));
+        if (found == registry.regions.end() || !found->second.owned)
+            return;
+        size = found->second.size;
+        registry.regions.erase(found);
+    }
+    munmap(ptr, size);
+}
+
+bool adviseHugePages(const void* ptr, size_t size) {
+    if (currentMode == ov::intel_cpu::HugePagesMode::DISABLED || !ptr)
+        return false;
+
+    const auto range = getAlignedRange(ptr, size);
+    if (range.end <= range.begin)
+        return false;
+
+    if (madvise(reinterpret_cast<void*>(range.begin), range.end - range.begin, MADV_HUGEPAGE) != 0)
+        return false;
+    registerRegion(reinterpret_cast<void*>(range.begin), {range.end - range.begin, false, false, 1});
+    return true;
+}
+
+void unadviseHugePages(const void* ptr, size_t size) {
+    if (!ptr)
+        return;
+
+    const auto range = getAlignedRange(ptr, size);
+    auto& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.guard);
+    auto found = registry.regions.find(range.begin);
+    if (found == registry.regions.end() || found->second.owned || found->second.size != range.end - range.begin)
+        return;
+    if (--found->second.advices == 0)
+        registry.regions.erase(found);
+}
+
+uint64_t getHugePagesBackedSize() {
+    uint64_t backedSize = 0;
+    std::vector<std::pair<uintptr_t, uintptr_t>> transparentRegions;
+    {
+        auto& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.guard);
+        for (const auto& item : registry.regions) {
+            if (item.second.explicitPages)
+                backedSize += item.second.size;
+            else
+                transparentRegions.emplace_back(item.first, item.first + item.second.size);
+        }
+    }
+    if (transparentRegions.empty())
+        return backedSize;
+
+    // the transparent huge pages may be split or not yet collapsed, so the kernel statistics of the mappings are used
+    std::ifstream smaps("/proc/self/smaps");
+    std::string line;
+    uintptr_t vmaBegin = 0;
+    uintptr_t vmaEnd = 0;
+    auto parseHugeSize = [&](const char* key) -> uint64_t {
+        const size_t keyLen = std::char_traits<char>::length(key);
+        unsigned long long sizeKb = 0;  // NOLINT
+        if (line.compare(0, keyLen, key) != 0 || sscanf(line.c_str() + keyLen, "%llu", &sizeKb) != 1)
+            return 0;
+        return static_cast<uint64_t>(sizeKb) * 1024;
+    };
+    while (std::getline(smaps, line)) {
+        unsigned long long begin = 0, end = 0;  // NOLINT
+        // the mapping header is "begin-end perms offset dev inode path", the other lines are the mapping fields
+        if (sscanf(line.c_str(), "%llx-%llx ", &begin, &end) == 2) {
+            vmaBegin = static_cast<uintptr_t>(begin);
+            vmaEnd = static_cast<uintptr_t>(end);
+            continue;
+        }
+        const uint64_t hugeSize = parseHugeSize("AnonHugePages:") + parseHugeSize("FilePmdMapped:");
+        if (!hugeSize)
+            continue;
+        uint64_t overlap = 0;
+        for (const auto& region : transparentRegions) {
+            const auto overlapBegin = std::max(region.first, vmaBegin);
+            const auto overlapEnd = std::min(region.second, vmaEnd);
+            if (overlapEnd > overlapBegin)
+                overlap += overlapEnd - overlapBegin;
+        }
+        // the adjacent mappings of the same flags are merged, so a mapping may include other memory
+        backedSize += std::min(hugeSize, overlap);
+    }
+    return backedSize;
+}
+#else
+void* allocateHugePages(size_t size) {
+    return nullptr;
+}
+
+void freeHugePages(void* ptr) {}
+
+bool adviseHugePages(const void* ptr, size_t size) {
+    return false;
+}
+
+void unadviseHugePages(const void* ptr, size_t size) {}
+
+uint64_t getHugePagesBackedSize() {
+    return 0;
+}
+#endif
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,82 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <openvino/runtime/intel_cpu/properties.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Sets the huge pages mode of the memory allocated by the current thread for the lifetime of the object
+ * (e.g. the memory allocated during a graph compilation).
+ */
+class HugePagesScope {
+public:
+    explicit HugePagesScope(ov::intel_cpu::HugePagesMode mode);
+    ~HugePagesScope();
+
+    HugePagesScope(const HugePagesScope&) = delete;
+    HugePagesScope& operator=(const HugePagesScope&) = delete;
+
+private:
+    ov::intel_cpu::HugePagesMode prevMode;
+};
+
+/**
+ * @brief Allocates the memory backed with the huge pages according to the mode of the current thread scope.
+ * The size is rounded up to the huge page size.
+ * @param size size of the memory in bytes
+ * @return pointer to the memory aligned on the huge page, or nullptr if the huge pages are disabled or not applicable
+ * (e.g. unsupported OS or the size is smaller than a huge page), so the caller falls back to the regular allocation
+ */
+void* allocateHugePages(size_t size);
+
+/**
+ * @brief Releases the memory allocated by allocateHugePages
+ */
+void freeHugePages(void* ptr);
+
+/**
+ * @brief Hints the kernel to back the existing memory region (e.g. a memory mapped file) with the huge pages.
+ * Only the huge pages entirely covered by the region are affected.
+ * @return true if the hint has been applied, false otherwise (e.g. unsupported OS or no complete huge pages)
+ */
+bool adviseHugePages(const void* ptr, size_t size);
+
+/**
+ * @brief Stops accounting the memory region advised by adviseHugePages, must be called before the region is released
+ */
+void unadviseHugePages(const void* ptr, size_t size);
+
+/**
+ * @brief Advises the huge pages for the memory region for the lifetime of the object, the owner of the region keeps
+ * the object until the region is released
+ */
+class HugePagesAdvice {
+public:
+    HugePagesAdvice(const void* ptr, size_t size);
+    ~HugePagesAdvice();
+
+    HugePagesAdvice(const HugePagesAdvice&) = delete;
+    HugePagesAdvice& operator=(const HugePagesAdvice&) = delete;
+
+private:
+    const void* ptr;
+    size_t size;
+    bool advised;
+};
+
+/**
+ * @brief Returns the size (in bytes) of the memory allocated or advised by the functions above and actually backed
+ * with the huge pages at the moment
+ */
+uint64_t getHugePagesBackedSize();
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,72 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+
+#if defined(__linux__)
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+#if defined(__linux__) && defined(SYS_mbind)
+namespace {
+// the values are defined in numaif.h which is not available without libnuma installed
+constexpr int MPOL_BIND_POLICY = 2;
+constexpr int MPOL_INTERLEAVE_POLICY = 3;
+constexpr unsigned MPOL_MF_MOVE_FLAG = 1u << 1;
+
+bool applyMemoryPolicy(void* ptr, size_t size, int mode, const std::vector<int>& numaNodeIds) {
+    if (!ptr || !size || numaNodeIds.empty())
+        return false;
+
+    const auto pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = reinterpret_cast<uintptr_t>(ptr);
+    const auto alignedBegin = (begin + pageSize - 1) / pageSize * pageSize;
+    const auto alignedEnd = (begin + size) / pageSize * pageSize;
+    if (alignedEnd <= alignedBegin)
+        return false;
+
+    constexpr size_t bitsPerWord = sizeof(unsigned long) * 8;  // NOLINT
+    int maxNodeId = 0;
+    for (auto id : numaNodeIds) {
+        if (id < 0)
+            return false;
+        maxNodeId = std::max(maxNodeId, id);
+    }
+    std::vector<unsigned long> nodeMask(maxNodeId / bitsPerWord + 1, 0);  // NOLINT
+    for (auto id : numaNodeIds) {
+        nodeMask[id / bitsPerWord] |= 1ul << (id % bitsPerWord);
+    }
+
+    const long res = syscall(SYS_mbind, alignedBegin, alignedEnd - alignedBegin, mode,  // NOLINT
+                             nodeMask.data(), nodeMask.size() * bitsPerWord + 1, MPOL_MF_MOVE_FLAG);
+    return res == 0;
+}
+}  // namespace
+
+bool bindMemoryToNumaNode(void* ptr, size_t size, int numaNodeId) {
+    return applyMemoryPolicy(ptr, size, MPOL_BIND_POLICY, {numaNodeId});
+}
+
+bool interleaveMemoryOnNumaNodes(void* ptr, size_t size, const std::vector<int>& numaNodeIds) {
+    return applyMemoryPolicy(ptr, size, MPOL_INTERLEAVE_POLICY, numaNodeIds);
+}
+#else
+bool bindMemoryToNumaNode(void* ptr, size_t size, int numaNodeId) {
+    return false;
+}
+
+bool interleaveMemoryOnNumaNodes(void* ptr, size_t size, const std::vector<int>& numaNodeIds) {
+    return false;
+}
+#endif
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,34 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Binds the pages of the memory region to the NUMA node. The pages already touched are migrated.
+ * Only the pages entirely covered by the region are affected.
+ * @param ptr pointer to the beginning of the region
+ * @param size size of the region in bytes
+ * @param numaNodeId target NUMA node id
+ * @return true if the policy has been applied, false otherwise (e.g. unsupported OS or no complete pages)
+ */
+bool bindMemoryToNumaNode(void* ptr, size_t size, int numaNodeId);
+
+/**
+ * @brief Interleaves the pages of the memory region across the NUMA nodes. The pages already touched are migrated.
+ * Only the pages entirely covered by the region are affected.
+ * @param ptr pointer to the beginning of the region
+ * @param size size of the region in bytes
+ * @param numaNodeIds NUMA node ids to interleave the pages across
+ * @return true if the policy has been applied, false otherwise (e.g. unsupported OS or no complete pages)
+ */
+bool interleaveMemoryOnNumaNodes(void* ptr, size_t size, const std::vector<int>& numaNodeIds);
+
+}   // namespace intel_cpu
+}   // namespace ov
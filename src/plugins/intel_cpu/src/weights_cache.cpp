@@ -5,13 +5,21 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <algorithm>
 #include <memory>
 
+#include "utils/general_utils.h"
+#include "utils/numa_utils.h"
+
 namespace ov {
 namespace intel_cpu {
 
 const SimpleDataHash WeightsSharing::simpleCRC;
 
+WeightsSharing::WeightsSharing(ov::intel_cpu::WeightsNumaPlacement placement)
+    : numaPlacementEnabled(getAvailableNUMANodes().size() > 1),
+      numaPlacement(placement) {}
+
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MemoryInfo::Ptr & memory,
@@ -46,6 +54,7 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
             newPtr = create();
+            placeMemory(newPtr);
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -71,10 +80,105 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
-SocketsWeights::SocketsWeights() {
+void WeightsSharing::setNumaNodeId(int id) {
+    int expected = -1;
+    numaNodeId.compare_exchange_strong(expected, id);
+}
+
+int WeightsSharing::getNumaNodeId() const {
+    return numaNodeId.load();
+}
+
+void WeightsSharing::placeMemory(const MemoryPtr& memory) const {
+    if (!numaPlacementEnabled || !memory || !memory->isAllocated())
+        return;
+
+    if (numaPlacement == ov::intel_cpu::WeightsNumaPlacement::INTERLEAVE) {
+        interleaveMemoryOnNumaNodes(memory->getData(), memory->getSize(), getAvailableNUMANodes());
+    } else {
+        const int nodeId = numaNodeId.load();
+        if (nodeId >= 0)
+            bindMemoryToNumaNode(memory->getData(), memory->getSize(), nodeId);
+    }
+}
+
+size_t WeightsSharing::getTotalMemorySize() const {
+    std::unique_lock<std::mutex> lock(guard);
+    size_t totalSize = 0;
+    for (const auto& item : sharedWeights) {
+        if (!item.second)
+            continue;
+        if (auto memory = item.second->sharedMemory.lock())
+            totalSize += memory->getSize();
+    }
+    return totalSize;
+}
+
+uint64_t WeightsSharing::getContentHash(const MemoryCPtr& memory) const {
+    std::unique_lock<std::mutex> lock(hashGuard);
+    auto found = contentHashes.find(memory.get());
+    if (found != contentHashes.end() && found->second.memory.lock() == memory)
+        return found->second.hash;
+
+    // drop the entries of the released memory objects, since their addresses may be reused
+    for (auto it = contentHashes.begin(); it != contentHashes.end();) {
+        if (it->second.memory.expired())
+            it = contentHashes.erase(it);
+        else
+            ++it;
+    }
+
+    const uint64_t hash = simpleCRC.hash(static_cast<const unsigned char*>(memory->getData()), memory->getSize());
+    contentHashes[memory.get()] = {memory, hash};
+    return hash;
+}
+
+SocketsWeights::SocketsWeights(ov::intel_cpu::WeightsNumaPlacement placement) : _placement(placement) {
     int num_sockets = get_num_sockets();
+    if (placement == ov::intel_cpu::WeightsNumaPlacement::INTERLEAVE) {
+        // a single copy of the weights is shared by all the sockets
+        auto cache = std::make_shared<WeightsSharing>(placement);
+        for (int socket_id = 0; socket_id < num_sockets; socket_id++)
+            _cache_map[socket_id] = cache;
+        return;
+    }
     for (int socket_id = 0; socket_id < num_sockets; socket_id++)
-         _cache_map[socket_id] = std::make_shared<WeightsSharing>();
+         _cache_map[socket_id] = std::make_shared<WeightsSharing>(placement);
+}
+
+SocketsWeights::Ptr SocketsWeights::getGlobal(ov::intel_cpu::WeightsNumaPlacement placement) {
+    static std::mutex globalGuard;
+    static std::map<ov::intel_cpu::WeightsNumaPlacement, std::weak_ptr<SocketsWeights>> globalWeights;
+
+    std::lock_guard<std::mutex> lock(globalGuard);
+    auto& weakPtr = globalWeights[placement];
+    auto ptr = weakPtr.lock();
+    if (!ptr) {
+        ptr = std::make_shared<SocketsWeights>(placement);
+        weakPtr = ptr;
+    }
+    return ptr;
+}
+
+std::map<std::string, uint64_t> SocketsWeights::getMemoryStatistics() const {
+    std::map<std::string, uint64_t> statistics;
+    if (_cache_map.empty())
+        return statistics;
+
+    if (_placement == ov::intel_cpu::WeightsNumaPlacement::INTERLEAVE) {
+        const auto numaNodes = getAvailableNUMANodes();
+        const uint64_t totalSize = _cache_map.begin()->second->getTotalMemorySize();
+        for (auto node : numaNodes)
+            statistics[std::to_string(node)] = totalSize / numaNodes.size();
+        return statistics;
+    }
+
+    for (const auto& item : _cache_map) {
+        // the replica is not bound until a stream of the socket creates it, so the socket id is used as a fallback
+        const int nodeId = item.second->getNumaNodeId();
+        statistics[std::to_string(nodeId >= 0 ? nodeId : item.first)] += item.second->getTotalMemorySize();
+    }
+    return statistics;
 }
 
 WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) {
@@ -91,5 +195,87 @@ const WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) const {
     return found->second;
 }
 
+namespace {
+const char packedWeightsTag[] = "CPU_PACKED_WEIGHTS";
+
+void writeSize(std::ostream& ostream, uint64_t size) {
+    ostream.write(reinterpret_cast<const char*>(&size), sizeof size);
+}
+
+uint64_t readSize(std::istream& istream) {
+    uint64_t size = 0;
+    istream.read(reinterpret_cast<char*>(&size), sizeof size);
+    if (!istream)
+        IE_THROW(NetworkNotRead) << "The packed weights section is corrupted";
+    return size;
+}
+}  // namespace
+
+void PackedWeights::add(const std::string& key, const MemoryCPtr& memory) {
+    std::lock_guard<std::mutex> lock(guard);
+    auto& record = records[key];
+    record.exported = memory;
+    record.size = memory->getSize();
+}
+
+MemoryPtr PackedWeights::find(const std::string& key, const MemoryDescPtr& desc, const dnnl::engine& eng) const {
+    std::lock_guard<std::mutex> lock(guard);
+    auto found = records.find(key);
+    if (found == records.end() || !found->second.data || found->second.size != desc->getCurrentMemSize())
+        return nullptr;
+
+    auto& record = found->second;
+    if (!record.imported)
+        record.imported = std::make_shared<Memory>(eng, desc, record.data);
+    return record.imported;
+}
+
+size_t PackedWeights::size() const {
+    std::lock_guard<std::mutex> lock(guard);
+    return records.size();
+}
+
+void PackedWeights::serialize(std::ostream& ostream) const {
+    std::lock_guard<std::mutex> lock(guard);
+    ostream.write(packedWeightsTag, sizeof packedWeightsTag);
+    writeSize(ostream, records.size());
+    for (const auto& item : records) {
+        writeSize(ostream, item.first.size());
+        ostream.write(item.first.data(), item.first.size());
+        writeSize(ostream, item.second.size);
+        const auto& memory = item.second.exported ? item.second.exported : item.second.imported;
+        ostream.write(reinterpret_cast<const char*>(memory->getData()), item.second.size);
+    }
+}
+
+PackedWeights::Ptr PackedWeights::deserialize(std::istream& istream) {
+    const auto pos = istream.tellg();
+    char tag[sizeof packedWeightsTag] = {};
+    istream.read(tag, sizeof tag);
+    if (!istream || !std::equal(std::begin(tag), std::end(tag), std::begin(packedWeightsTag))) {
+        // the model was exported without the packed weights, the following data belongs to the next reader
+        istream.clear();
+        istream.seekg(pos);
+        return nullptr;
+    }
+
+    auto result = std::make_shared<PackedWeights>();
+    auto recordsNum = readSize(istream);
+    for (uint64_t i = 0; i < recordsNum; i++) {
+        std::string key(readSize(istream), '\0');
+        istream.read(&key[0], key.size());
+
+        Record record;
+        record.size = readSize(istream);
+        record.data = std::make_shared<DnnlMemoryMngr>(make_unique<MemoryMngrWithReuse>());
+        record.data->resize(record.size);
+        istream.read(reinterpret_cast<char*>(record.data->getRawPtr()), record.size);
+        if (!istream)
+            IE_THROW(NetworkNotRead) << "The packed weights section is corrupted";
+        result->records.emplace(std::move(key), std::move(record));
+    }
+    return result;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "cpu_memory.h"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #include <unordered_map>
 #include <functional>
@@ -13,6 +14,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <iostream>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -70,6 +72,12 @@ class WeightsSharing {
 public:
     typedef std::shared_ptr<WeightsSharing> Ptr;
 
+    WeightsSharing() = default;
+    /**
+     * @param placement the NUMA placement policy applied to the memory of the created weights
+     */
+    explicit WeightsSharing(ov::intel_cpu::WeightsNumaPlacement placement);
+
     class SharedMemory {
     public:
         typedef std::shared_ptr<SharedMemory> Ptr;
@@ -94,11 +102,41 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * @brief Sets the NUMA node the weights are bound to in case of REPLICATE placement.
+     * Only the first call takes effect, since the weights may be already bound.
+     */
+    void setNumaNodeId(int numaNodeId);
+    int getNumaNodeId() const;
+
+    /**
+     * @brief Returns the size (in bytes) of the weights memory currently alive in the cache
+     */
+    size_t getTotalMemorySize() const;
+
+    /**
+     * @brief Returns the content hash of the memory data. The hash is computed once per memory object
+     * and memorized while the memory is alive, so the graphs of all the streams reuse it.
+     */
+    uint64_t getContentHash(const MemoryCPtr& memory) const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
+    void placeMemory(const MemoryPtr& memory) const;
+
+    struct ContentHashInfo {
+        std::weak_ptr<const IMemory> memory;
+        uint64_t hash;
+    };
+
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    mutable std::mutex hashGuard;
+    mutable std::unordered_map<const IMemory*, ContentHashInfo> contentHashes;
+    bool numaPlacementEnabled = false;
+    ov::intel_cpu::WeightsNumaPlacement numaPlacement = ov::intel_cpu::WeightsNumaPlacement::REPLICATE;
+    std::atomic<int> numaNodeId{-1};
     static const SimpleDataHash simpleCRC;
 };
 
@@ -109,13 +147,69 @@ protected:
  */
 class SocketsWeights {
 public:
-    SocketsWeights();
+    typedef std::shared_ptr<SocketsWeights> Ptr;
+
+    explicit SocketsWeights(ov::intel_cpu::WeightsNumaPlacement placement = ov::intel_cpu::WeightsNumaPlacement::REPLICATE);
+
+    /**
+     * @brief Returns the process-wide weights registry for the given placement.
+     * The registry is alive while at least one compiled model refers to it and the cached weights
+     * themselves are released as soon as the last graph using them is destroyed.
+     */
+    static Ptr getGlobal(ov::intel_cpu::WeightsNumaPlacement placement);
 
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * @brief Returns the size (in bytes) of the cached weights memory per NUMA node id
+     */
+    std::map<std::string, uint64_t> getMemoryStatistics() const;
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
+    ov::intel_cpu::WeightsNumaPlacement _placement;
+};
+
+/**
+ * The repacked weights of the graph nodes, which are stored together with the exported model,
+ * so the imported model reuses them instead of reordering the original weights again.
+ * The records are identified by the node name and the repacked weights descriptor signature.
+ *
+ * Is a thread safe
+ */
+class PackedWeights {
+public:
+    typedef std::shared_ptr<PackedWeights> Ptr;
+    typedef std::shared_ptr<const PackedWeights> CPtr;
+
+    void add(const std::string& key, const MemoryCPtr& memory);
+
+    /**
+     * @brief Returns the memory of the record wrapped with the given descriptor, or nullptr if there is no
+     * such record or its size doesn't match the descriptor. The memory is created once and shared by the callers.
+     */
+    MemoryPtr find(const std::string& key, const MemoryDescPtr& desc, const dnnl::engine& eng) const;
+
+    size_t size() const;
+
+    void serialize(std::ostream& ostream) const;
+    /**
+     * @brief Reads the records written by serialize(), returns nullptr if the stream contains no records section
+     * and leaves the stream at the same position
+     */
+    static Ptr deserialize(std::istream& istream);
+
+private:
+    struct Record {
+        MemoryCPtr exported;
+        MemoryMngrPtr data;
+        size_t size = 0;
+        MemoryPtr imported;
+    };
+
+    mutable std::mutex guard;
+    mutable std::map<std::string, Record> records;
 };
 
 }   // namespace intel_cpu
@@ -12,6 +12,7 @@
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
 #include "openvino/runtime/intel_cpu/properties.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
 #include "functional_test_utils/skip_tests_config.hpp"
 
 namespace {
@@ -37,9 +38,28 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkSupportedPropertiesAreAvailable
         RO_property(ov::hint::enable_cpu_pinning.name()),
         RO_property(ov::hint::scheduling_core_type.name()),
         RO_property(ov::hint::enable_hyper_threading.name()),
+        RO_property(ov::hint::model_priority.name()),
         RO_property(ov::execution_devices.name()),
         RO_property(ov::intel_cpu::denormals_optimization.name()),
         RO_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RO_property(ov::intel_cpu::weights_numa_placement.name()),
+        RO_property(ov::intel_cpu::weights_memory_per_numa_node.name()),
+        RO_property(ov::intel_cpu::huge_pages.name()),
+        RO_property(ov::intel_cpu::huge_pages_memory_size.name()),
+        RO_property(ov::intel_cpu::batch_split.name()),
+        RO_property(ov::intel_cpu::batch_split_slices.name()),
+        RO_property(ov::intel_cpu::minimize_reorders.name()),
+        RO_property(ov::intel_cpu::fast_math_ops.name()),
+        RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+        RO_property(ov::intel_cpu::memory_statistics.name()),
+        RO_property(ov::intel_cpu::enable_exec_timeline.name()),
+        RO_property(ov::intel_cpu::exec_timeline_capacity.name()),
+        RO_property(ov::intel_cpu::exec_timeline.name()),
+        RO_property(ov::intel_cpu::transformations_profile.name()),
+        RO_property(ov::intel_cpu::compilation_stages.name()),
+        RO_property(ov::intel_cpu::warmup_shapes.name()),
+        RO_property(ov::intel_cpu::max_state_reserved_length.name()),
+        RO_property(ov::intel_cpu::bind_state_tensors.name()),
     };
 
     ov::Core ie;
@@ -144,6 +164,136 @@ TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSparseWeigthsDecompression
     ASSERT_NO_THROW(ov::CompiledModel compiledModel = core.compile_model(model, deviceName));
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckWeightsNumaPlacement) {
+    ov::Core core;
+
+    core.set_property(deviceName, ov::intel_cpu::weights_numa_placement(ov::intel_cpu::WeightsNumaPlacement::INTERLEAVE));
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName, ov::num_streams(2));
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::weights_numa_placement), ov::intel_cpu::WeightsNumaPlacement::INTERLEAVE);
+    ASSERT_NO_THROW(compiledModel.get_property(ov::intel_cpu::weights_memory_per_numa_node));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckMemoryStatistics) {
+    ov::Core core;
+
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName, ov::num_streams(2));
+    std::map<std::string, uint64_t> statistics;
+    ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::memory_statistics));
+    for (const auto& category : {"weights", "weights_cache", "activations", "activations.peak", "scratchpad", "total", "total.peak"})
+        ASSERT_EQ(statistics.count(category), 1) << category;
+    ASSERT_GE(statistics["total.peak"], statistics["total"]);
+    ASSERT_GE(statistics["activations.peak"], statistics["activations"]);
+    ASSERT_GT(statistics["total"], 0);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckHugePages) {
+    ov::Core core;
+
+    // the huge pages may be unavailable in the environment, then the regular pages are used silently
+    core.set_property(deviceName, ov::intel_cpu::huge_pages(ov::intel_cpu::HugePagesMode::HUGETLBFS));
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::huge_pages), ov::intel_cpu::HugePagesMode::HUGETLBFS);
+    ASSERT_NO_THROW(compiledModel.get_property(ov::intel_cpu::huge_pages_memory_size));
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckBatchSplit) {
+    ov::Core core;
+
+    ov::AnyMap config = {ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY), ov::intel_cpu::batch_split(true)};
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName, config);
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::batch_split));
+    // the slices number depends on the batch of the model and the cores number
+    uint32_t slicesNum = 0;
+    ASSERT_NO_THROW(slicesNum = compiledModel.get_property(ov::intel_cpu::batch_split_slices));
+    ASSERT_GE(slicesNum, 1);
+    ASSERT_NO_THROW(compiledModel.create_infer_request().infer());
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckFastMathOps) {
+    ov::Core core;
+
+    ASSERT_THROW(core.set_property(deviceName, ov::intel_cpu::fast_math_ops("Gelu,Unknown")), ov::Exception);
+    core.set_property(deviceName, ov::intel_cpu::fast_math_ops("Gelu, Erf"));
+    ASSERT_EQ(core.get_property(deviceName, ov::intel_cpu::fast_math_ops), "Erf,Gelu");
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::fast_math_ops), "Erf,Gelu");
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckSharedRuntimeCacheStatistics) {
+    ov::Core core;
+
+    ov::AnyMap config = {ov::num_streams(4), {InferenceEngine::PluginConfigInternalParams::KEY_CPU_SHARED_RUNTIME_CACHE, "YES"}};
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName, config);
+    std::map<std::string, uint64_t> statistics;
+    ASSERT_NO_THROW(statistics = compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics));
+    ASSERT_EQ(statistics.count("hits"), 1);
+    ASSERT_EQ(statistics.count("misses"), 1);
+    ASSERT_EQ(statistics.count("evictions"), 1);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExecTimeline) {
+    ov::Core core;
+
+    core.set_property(deviceName, ov::intel_cpu::enable_exec_timeline(true));
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+    ASSERT_TRUE(compiledModel.get_property(ov::intel_cpu::enable_exec_timeline));
+    compiledModel.create_infer_request().infer();
+
+    std::string timeline;
+    ASSERT_NO_THROW(timeline = compiledModel.get_property(ov::intel_cpu::exec_timeline));
+    ASSERT_NE(timeline.find("\"traceEvents\""), std::string::npos);
+    ASSERT_NE(timeline.find("\"cat\":\"Execution\""), std::string::npos);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExecTimelineCapacity) {
+    ov::Core core;
+
+    ASSERT_EQ(core.get_property(deviceName, ov::intel_cpu::exec_timeline_capacity), 1u << 16);
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName,
+                                                         ov::num_streams(1),
+                                                         ov::intel_cpu::enable_exec_timeline(true),
+                                                         ov::intel_cpu::exec_timeline_capacity(2));
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::exec_timeline_capacity), 2u);
+    auto inferRequest = compiledModel.create_infer_request();
+    for (int i = 0; i < 3; i++)
+        inferRequest.infer();
+
+    // only the latest events are kept
+    const std::string timeline = compiledModel.get_property(ov::intel_cpu::exec_timeline);
+    const std::string eventTag = "\"ph\":\"X\"";
+    size_t eventsNum = 0;
+    for (auto pos = timeline.find(eventTag); pos != std::string::npos; pos = timeline.find(eventTag, pos + 1))
+        eventsNum++;
+    ASSERT_EQ(eventsNum, 2u);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckTransformationsProfile) {
+    ov::Core core;
+
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::transformations_profile), "");
+
+    compiledModel = core.compile_model(model, deviceName, ov::enable_profiling(true));
+    std::string profile;
+    ASSERT_NO_THROW(profile = compiledModel.get_property(ov::intel_cpu::transformations_profile));
+    ASSERT_NE(profile.find("\"nodes_before\""), std::string::npos);
+    ASSERT_NE(profile.find("\"children\":[{"), std::string::npos);
+}
+
+TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckCompilationStages) {
+    ov::Core core;
+
+    ov::CompiledModel compiledModel = core.compile_model(model, deviceName);
+    std::map<std::string, double> stages;
+    ASSERT_NO_THROW(stages = compiledModel.get_property(ov::intel_cpu::compilation_stages));
+    for (const auto& stage : {"transformations", "streams", "cpu_transformations", "graph", "graph.replicate",
+                              "graph.init", "graph.allocate", "graph.primitives"}) {
+        ASSERT_EQ(stages.count(stage), 1) << stage;
+        ASSERT_GE(stages[stage], 0.0) << stage;
+    }
+    ASSERT_EQ(stages.count("warmup"), 0);
+}
+
 const auto bf16_if_can_be_emulated = InferenceEngine::with_cpu_x86_avx512_core() ? ov::element::bf16 : ov::element::f32;
 
 TEST_F(OVClassConfigTestCPU, smoke_CpuExecNetworkCheckExecutionModeIsAvailableInCoreAndModel) {
@@ -44,9 +44,20 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginAllSupportedPropertiesAreAvailable) {
         RW_property(ov::hint::enable_cpu_pinning.name()),
         RW_property(ov::hint::scheduling_core_type.name()),
         RW_property(ov::hint::enable_hyper_threading.name()),
+        RW_property(ov::hint::model_priority.name()),
         RW_property(ov::device::id.name()),
         RW_property(ov::intel_cpu::denormals_optimization.name()),
         RW_property(ov::intel_cpu::sparse_weights_decompression_rate.name()),
+        RW_property(ov::intel_cpu::weights_numa_placement.name()),
+        RW_property(ov::intel_cpu::huge_pages.name()),
+        RW_property(ov::intel_cpu::batch_split.name()),
+        RW_property(ov::intel_cpu::minimize_reorders.name()),
+        RW_property(ov::intel_cpu::fast_math_ops.name()),
+        RW_property(ov::intel_cpu::enable_exec_timeline.name()),
+        RW_property(ov::intel_cpu::exec_timeline_capacity.name()),
+        RW_property(ov::intel_cpu::warmup_shapes.name()),
+        RW_property(ov::intel_cpu::max_state_reserved_length.name()),
+        RW_property(ov::intel_cpu::bind_state_tensors.name()),
     };
 
     ov::Core ie;
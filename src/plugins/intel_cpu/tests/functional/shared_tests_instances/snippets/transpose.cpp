@@ -31,6 +31,17 @@ INSTANTIATE_TEST_SUITE_P(smoke_Snippets_TransposeMul, TransposeMul,
                                  ::testing::Values(ov::test::utils::DEVICE_CPU)),
                          TransposeMul::getTestCaseName);
 
+// the innermost dimension keeps its place, so the transposed input is read by the vector loads
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_TransposeMul_Vectorized, TransposeMul,
+                         ::testing::Combine(
+                                 ::testing::Values(ov::PartialShape {2, 31, 3, 17}),
+                                 ::testing::ValuesIn(std::vector<ov::PartialShape>{{2, 3, 31, 17}, {1, 3, 1, 17}}),
+                                 ::testing::Values(std::vector<int> {0, 2,  1, 3}),
+                                 ::testing::Values(1), // Transpose
+                                 ::testing::Values(1), // Tokenized Transpose
+                                 ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                         TransposeMul::getTestCaseName);
+
 }  // namespace
 } // namespace snippets
 } // namespace test
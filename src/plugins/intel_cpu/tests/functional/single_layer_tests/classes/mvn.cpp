@@ -170,6 +170,8 @@ const std::vector<InputShape>& inputShapes_2D() {
     static const std::vector<InputShape> inputShapes_2D = {
         { {}, {{1, 32}}},
         { {}, {{16, 64}}},
+        // the long channel split between the threads
+        { {}, {{1, 5000}}},
 
         {
             // dynamic
@@ -163,5 +163,30 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagOffsetsSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(ov::test::utils::DEVICE_CPU)),
         EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+std::vector<ElementType> bf16NetPrecisions() {
+    if (InferenceEngine::with_cpu_x86_avx512_core())
+        return {ElementType::bf16};
+    return {};
+}
+
+const std::vector<InputShape> input_shapes_bf16 = {
+        {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{5, 64}, {10, 35}}},
+        {{5, 64}, {{5, 64}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_bf16, EmbeddingBagOffsetsSumLayerCPUTest,
+        ::testing::Combine(
+                ::testing::Combine(
+                        ::testing::ValuesIn(input_shapes_bf16),
+                        ::testing::ValuesIn(indices),
+                        ::testing::ValuesIn(offsets),
+                        ::testing::ValuesIn(default_index),
+                        ::testing::ValuesIn(with_weights),
+                        ::testing::ValuesIn(with_default_index)),
+                ::testing::ValuesIn(bf16NetPrecisions()),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(ov::test::utils::DEVICE_CPU)),
+        EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
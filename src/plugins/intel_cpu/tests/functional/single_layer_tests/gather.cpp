@@ -307,6 +307,36 @@ INSTANTIATE_TEST_SUITE_P(smoke_dynamic_1D, GatherLayerTestCPU,
                     ::testing::Values(additionalConfig[0])),
                 GatherLayerTestCPU::getTestCaseName);
 
+///// Embedding table /////
+const std::vector<std::vector<ov::test::InputShape>> embeddingInputShapes = {
+    { { {}, { {1000, 256} } }, { {}, { {4096} } } },
+    { { {}, { {300, 2, 128} } }, { {}, { {5000} } } },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_static_embedding, GatherLayerTestCPU,
+                ::testing::Combine(
+                    ::testing::ValuesIn(embeddingInputShapes),
+                    ::testing::Values(std::tuple<int, int>{0, 0}),
+                    ::testing::Values(ElementType::f32, ElementType::i8),
+                    ::testing::Values(true),
+                    ::testing::Values(cpuParamsRef),
+                    ::testing::Values(additionalConfig[0])),
+                GatherLayerTestCPU::getTestCaseName);
+
+const std::vector<std::vector<ov::test::InputShape>> embeddingInputShapesAxis1 = {
+    { { {}, { {4, 500, 256} } }, { {}, { {4096} } } },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_static_embedding_axis1, GatherLayerTestCPU,
+                ::testing::Combine(
+                    ::testing::ValuesIn(embeddingInputShapesAxis1),
+                    ::testing::Values(std::tuple<int, int>{1, 0}),
+                    ::testing::Values(ElementType::f32),
+                    ::testing::Values(true),
+                    ::testing::Values(cpuParamsRef),
+                    ::testing::Values(additionalConfig[0])),
+                GatherLayerTestCPU::getTestCaseName);
+
 ///// 4D JIT /////
 std::vector<std::vector<ov::test::InputShape>> get4DShapesJitStat(int maxBatchDims) {
     std::vector<std::vector<ov::test::InputShape>> result = {};
@@ -0,0 +1,87 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPULayerTestsDefinitions {
+namespace FullyConnected {
+
+using FullyConnectedACLTestParams = std::tuple<InputShape,  // data shape
+                                               size_t,      // output channels
+                                               bool>;       // with bias
+
+// The FullyConnected without the fused post-ops runs on the ACL executor with the prepacked weights, the results are
+// compared with the reference ones for the static shapes and for the dynamic shapes recreating the executor
+class FullyConnectedACLLayerCPUTest : public testing::WithParamInterface<FullyConnectedACLTestParams>,
+                                      virtual public SubgraphBaseTest,
+                                      public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FullyConnectedACLTestParams>& obj) {
+        InputShape inputShape;
+        size_t outputChannels;
+        bool withBias;
+        std::tie(inputShape, outputChannels, withBias) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({inputShape.first}) << "_TS=";
+        for (const auto& shape : inputShape.second) {
+            result << ov::test::utils::vec2str(shape) << "_";
+        }
+        result << "N=" << outputChannels << "_withBias=" << withBias;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        InputShape inputShape;
+        size_t outputChannels;
+        bool withBias;
+        std::tie(inputShape, outputChannels, withBias) = GetParam();
+        init_input_shapes({inputShape});
+
+        configuration.insert(ov::hint::inference_precision(ov::element::f32));
+        updateSelectedType("acl", ov::element::f32, configuration);
+
+        const auto inputChannels = static_cast<size_t>(inputShape.first.rbegin()->get_length());
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0])};
+        const auto weights = ngraph::builder::makeConstant<float>(ov::element::f32, {outputChannels, inputChannels},
+                                                                  {}, true, 1.f, -1.f);
+        std::shared_ptr<ov::Node> fc = std::make_shared<ov::op::v0::MatMul>(params[0], weights, false, true);
+        if (withBias) {
+            const auto bias = ngraph::builder::makeConstant<float>(ov::element::f32, {outputChannels}, {}, true);
+            fc = std::make_shared<ov::op::v1::Add>(fc, bias);
+        }
+        function = makeNgraphFunction(ov::element::f32, params, fc, "FullyConnectedACL");
+    }
+};
+
+TEST_P(FullyConnectedACLLayerCPUTest, CompareWithRefs) {
+    run();
+    CheckPluginRelatedResults(compiledModel, "FullyConnected");
+}
+
+namespace {
+
+const std::vector<InputShape> inputShapes = {
+    {{}, {{4, 64}}},
+    {{}, {{2, 3, 32}}},
+    {{-1, 64}, {{1, 64}, {9, 64}, {1, 64}}},
+    {{-1, -1, 16}, {{1, 5, 16}, {3, 2, 16}, {1, 5, 16}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedACL, FullyConnectedACLLayerCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(1, 24),
+                                            ::testing::Values(false, true)),
+                         FullyConnectedACLLayerCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace FullyConnected
+}  // namespace CPULayerTestsDefinitions
@@ -1170,6 +1170,35 @@ const auto testParams = ::testing::Combine(matMulParams,
 
 INSTANTIATE_TEST_SUITE_P(smoke_MM_Static, MatMulLayerCPUTest, testParams, MatMulLayerCPUTest::getTestCaseName);
 
+// many tiny batch items, computed by the batched brgemm
+const std::vector<ShapeRelatedParams> IS_SmallBatched = {
+    {static_shapes_to_test_representation({{2, 12, 64, 64}, {2, 12, 64, 64}}), {false, false}},
+    {static_shapes_to_test_representation({{24, 7, 16}, {1, 16, 9}}), {false, false}},
+    {static_shapes_to_test_representation({{3, 1, 5, 33}, {1, 4, 33, 17}}), {false, false}},
+    {
+        {
+            {{-1, -1, -1, -1}, {{1, 16, 1, 64}, {1, 16, 5, 64}, {4, 16, 32, 64}}},
+            {{-1, -1, -1, -1}, {{1, 16, 64, 7}, {1, 16, 64, 7}, {4, 16, 64, 129}}}
+        },
+        {false, false}
+    },
+};
+
+const auto matMulParamsSmallBatched = ::testing::Combine(::testing::ValuesIn(IS_SmallBatched),
+                                             ::testing::Values(ElementType::f32),
+                                             ::testing::Values(ElementType::undefined),
+                                             ::testing::Values(ElementType::undefined),
+                                             ::testing::Values(helpers::InputLayerType::PARAMETER),
+                                             ::testing::Values(ov::test::utils::DEVICE_CPU),
+                                             ::testing::Values(emptyAdditionalConfig));
+
+const auto testParamsSmallBatched = ::testing::Combine(matMulParamsSmallBatched,
+                                           ::testing::Values(MatMulNodeType::MatMul),
+                                           ::testing::Values(emptyFusingSpec),
+                                           ::testing::ValuesIn(filterSpecificParams()));
+
+INSTANTIATE_TEST_SUITE_P(smoke_MM_SmallBatched, MatMulLayerCPUTest, testParamsSmallBatched, MatMulLayerCPUTest::getTestCaseName);
+
 
 const auto matMulParamsDynamic = ::testing::Combine(::testing::ValuesIn(IS_Dynamic),
                                              ::testing::ValuesIn(netPRCs),
@@ -187,7 +187,7 @@ protected:
         configuration.insert(additionalConfig.begin(), additionalConfig.end());
 
         cpuNodeType = "FullyConnected";
-        selectedType = makeSelectedTypeStr(selectedType, element::i8);
+        selectedType = makeSelectedTypeStr(selectedType, inType == element::f32 ? element::f32 : element::i8);
 
         ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(inType, inShapeA)};
         auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<opset1::Parameter>(params));
@@ -230,6 +230,17 @@ std::vector<CPUSpecificParams> filterSpecificParams(bool sparseExpected) {
     return specificParams;
 }
 
+std::vector<CPUSpecificParams> filterSparseJitSpecificParams() {
+    std::vector<CPUSpecificParams> specificParams;
+    if (with_cpu_x86_avx512_core()) {
+        specificParams.push_back(CPUSpecificParams{{}, {}, {}, "jit_avx512_sparse"});
+    } else if (with_cpu_x86_avx2()) {
+        specificParams.push_back(CPUSpecificParams{{}, {}, {}, "jit_avx2_sparse"});
+    }
+
+    return specificParams;
+}
+
 /* ============= FullyConnected ============= */
 namespace fullyConnected {
 
@@ -285,6 +296,18 @@ const auto testParams2D_i8_sparse_smoke = ::testing::Combine(::testing::ValuesIn
 INSTANTIATE_TEST_SUITE_P(smoke_FC_2D_I8_sparse, MatMulSparseCPUTest, testParams2D_i8_sparse_smoke,
     MatMulSparseCPUTest::getTestCaseName);
 
+const auto testParams2D_f32_sparse_smoke = ::testing::Combine(::testing::ValuesIn(IS2D_sparse_smoke),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(emptyFusingSpec),
+                                                   ::testing::ValuesIn(filterSparseJitSpecificParams()),
+                                                   ::testing::Values(SparseRate50),
+                                                   ::testing::Values(0.7));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_2D_FP32_sparse, MatMulSparseCPUTest, testParams2D_f32_sparse_smoke,
+    MatMulSparseCPUTest::getTestCaseName);
+
 const std::vector<ShapeRelatedParams> IS3D_sparse_smoke = {
     {static_shapes_to_test_representation({{1, 64, 64}, {64, 64}}), {false, true}},
     {static_shapes_to_test_representation({{3, 71, 64}, {64, 64}}), {false, true}},
@@ -333,6 +356,18 @@ const auto testParams3D_i8_sparse_smoke = ::testing::Combine(::testing::ValuesIn
 INSTANTIATE_TEST_SUITE_P(smoke_FC_3D_I8_sparse, MatMulSparseCPUTest, testParams3D_i8_sparse_smoke,
     MatMulSparseCPUTest::getTestCaseName);
 
+const auto testParams3D_f32_sparse_smoke = ::testing::Combine(::testing::ValuesIn(IS3D_sparse_smoke),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(ElementType::f32),
+                                                   ::testing::Values(emptyFusingSpec),
+                                                   ::testing::ValuesIn(filterSparseJitSpecificParams()),
+                                                   ::testing::Values(SparseRate50),
+                                                   ::testing::Values(0.7));
+
+INSTANTIATE_TEST_SUITE_P(smoke_FC_3D_FP32_sparse, MatMulSparseCPUTest, testParams3D_f32_sparse_smoke,
+    MatMulSparseCPUTest::getTestCaseName);
+
 } // namespace fullyConnected
 
 } // namespace
@@ -438,4 +438,27 @@ const auto nmsParams = ::testing::Combine(::testing::ValuesIn(inShapeParams),
 
 INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest, NmsLayerCPUTest, nmsParams, NmsLayerCPUTest::getTestCaseName);
 
+// the hard suppression of many candidates is done by the IoU bitmask, unless few boxes are selected per class
+const std::vector<InputShapeParams> inShapeParamsManyBoxes = {
+    InputShapeParams{std::vector<ov::Dimension>{-1, -1, -1}, std::vector<TargetShapeParams>{TargetShapeParams{1, 3000, 2},
+                                                                                            TargetShapeParams{2, 1100, 1}}},
+};
+
+const auto nmsParamsManyBoxes = ::testing::Combine(::testing::ValuesIn(inShapeParamsManyBoxes),
+                                                   ::testing::Combine(::testing::Values(ElementType::f32),
+                                                                      ::testing::Values(ElementType::i32),
+                                                                      ::testing::Values(ElementType::f32)),
+                                                   ::testing::Values(10, 300),
+                                                   ::testing::Combine(::testing::ValuesIn(threshold),
+                                                                      ::testing::Values(0.0f),
+                                                                      ::testing::Values(0.0f)),
+                                                   ::testing::Values(ngraph::helpers::InputLayerType::CONSTANT),
+                                                   ::testing::ValuesIn(encodType),
+                                                   ::testing::Values(true),
+                                                   ::testing::Values(element::i32),
+                                                   ::testing::Values(ov::test::utils::DEVICE_CPU)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NmsLayerCPUTest_ManyBoxes, NmsLayerCPUTest, nmsParamsManyBoxes, NmsLayerCPUTest::getTestCaseName);
+
 } // namespace CPULayerTestsDefinitions
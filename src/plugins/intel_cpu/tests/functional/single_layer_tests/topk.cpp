@@ -427,6 +427,48 @@ INSTANTIATE_TEST_CASE_P(smoke_Top1_dynamic, TopKLayerCPUTest,
         ::testing::ValuesIn(additionalConfig)),
     TopKLayerCPUTest::getTestCaseName);
 
+
+// the long axis is split between the threads
+const std::vector<int64_t> k_long_axis = {5, 1000};
+
+std::vector<ov::test::InputShape> inputShapes_long_axis = {
+    {{}, {{1, 2, 1, 40000}}},
+};
+
+std::vector<ov::test::InputShape> inputShapesDynamic_long_axis = {
+    {{1, {1, 2}, 1, -1}, {{1, 1, 1, 65536}, {1, 2, 1, 40000}, {1, 2, 1, 2000}}}
+};
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_long_axis, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::ValuesIn(k_long_axis),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapes_long_axis)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_CASE_P(smoke_TopK_long_axis_dynamic, TopKLayerCPUTest,
+    ::testing::Combine(
+        ::testing::Combine(
+            ::testing::Values(1000),
+            ::testing::Values(3),
+            ::testing::ValuesIn(modes),
+            ::testing::ValuesIn(sortTypeStable),
+            ::testing::ValuesIn(netPrecisions),
+            ::testing::Values(ElementType::undefined),
+            ::testing::Values(ElementType::undefined),
+            ::testing::ValuesIn(inputShapesDynamic_long_axis)),
+        ::testing::Values(CPUSpecificParams({nchw, x}, {nchw, nchw}, {}, {})),
+        ::testing::Values(additionalConfig[0])),
+    TopKLayerCPUTest::getTestCaseName);
+
 } // namespace
 
 } // namespace CPULayerTestsDefinitions
@@ -138,6 +138,59 @@ TEST_P(UniqueLayerTestCPU, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "Unique");
 }
 
+// A NaN is not equal to any value including itself, so each NaN makes a unique element of its own, the sorted NaNs
+// follow all the numbers in the order of their positions
+class UniqueNaNLayerTestCPU : public testing::WithParamInterface<bool>, public CPUTestsBase, public testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<bool>& obj) {
+        return std::string("sorted=") + (obj.param ? "True" : "False");
+    }
+
+protected:
+    static void checkValues(const ov::Tensor& tensor, const std::vector<float>& expected) {
+        ASSERT_EQ(tensor.get_size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            const float actual = tensor.data<float>()[i];
+            if (std::isnan(expected[i]))
+                ASSERT_TRUE(std::isnan(actual)) << "at " << i;
+            else
+                ASSERT_EQ(expected[i], actual) << "at " << i;
+        }
+    }
+
+    static void checkIndices(const ov::Tensor& tensor, const std::vector<int32_t>& expected) {
+        ASSERT_EQ(std::vector<int32_t>(tensor.data<int32_t>(), tensor.data<int32_t>() + tensor.get_size()), expected);
+    }
+};
+
+TEST_P(UniqueNaNLayerTestCPU, NaNsAreDistinct) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const bool sorted = GetParam();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    std::vector<float> data{2.f, nan, 1.f, 2.f, nan, 1.f};
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{data.size()});
+    auto unique = std::make_shared<ov::op::v10::Unique>(param, sorted, ov::element::i32, ov::element::i32);
+    auto model = std::make_shared<ov::Model>(unique->outputs(), ov::ParameterVector{param}, "UniqueNaN");
+
+    ov::Core core;
+    auto inferRequest = core.compile_model(model, ov::test::utils::DEVICE_CPU).create_infer_request();
+    inferRequest.set_input_tensor(ov::Tensor(ov::element::f32, ov::Shape{data.size()}, data.data()));
+    inferRequest.infer();
+
+    if (sorted) {
+        checkValues(inferRequest.get_output_tensor(0), {1.f, 2.f, nan, nan});
+        checkIndices(inferRequest.get_output_tensor(1), {2, 0, 1, 4});
+        checkIndices(inferRequest.get_output_tensor(2), {1, 2, 0, 1, 3, 0});
+        checkIndices(inferRequest.get_output_tensor(3), {2, 2, 1, 1});
+    } else {
+        checkValues(inferRequest.get_output_tensor(0), {2.f, nan, 1.f, nan});
+        checkIndices(inferRequest.get_output_tensor(1), {0, 1, 2, 4});
+        checkIndices(inferRequest.get_output_tensor(2), {0, 1, 2, 0, 3, 2});
+        checkIndices(inferRequest.get_output_tensor(3), {2, 1, 2, 1});
+    }
+}
+
 namespace {
 
 const std::vector<ElementType> dataPrecisionSmoke = {
@@ -280,5 +333,9 @@ INSTANTIATE_TEST_SUITE_P(nightly_dynamic, UniqueLayerTestCPU,
                                  ::testing::ValuesIn(getCPUInfo()),
                                  ::testing::Values(additionalConfig[0])),
                          UniqueLayerTestCPU::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_NaN, UniqueNaNLayerTestCPU,
+                         ::testing::Values(true, false),
+                         UniqueNaNLayerTestCPU::getTestCaseName);
 } // namespace
 } // namespace CPULayerTestsDefinitions
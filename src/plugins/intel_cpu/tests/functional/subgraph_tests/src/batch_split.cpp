@@ -0,0 +1,166 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the request is split by the batch into the slices executed concurrently):
+/*
+ *  Parameter[N, C, H, W]   Parameter[N, C, H, W]
+ *             \              /
+ *                  Add
+ *                   |
+ *               Softmax(C)
+ *                   |
+ *        Reshape[N, C * H * W] (optional, the hardcoded batch prevents the splitting)
+ *                   |
+ *                 Result
+ */
+
+using BatchSplitParams = std::tuple<ov::Shape,      // input shape
+                                    bool>;          // reshape with the hardcoded batch
+
+class BatchSplitCPUTest : public testing::WithParamInterface<BatchSplitParams>,
+                          virtual public SubgraphBaseTest,
+                          public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<BatchSplitParams>& obj) {
+        ov::Shape inputShape;
+        bool withReshape;
+        std::tie(inputShape, withReshape) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::vec2str(inputShape) << "_";
+        result << "withReshape=" << withReshape;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::Shape inputShape;
+        bool withReshape;
+        std::tie(inputShape, withReshape) = this->GetParam();
+        configuration.insert(ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY));
+        configuration.insert(ov::intel_cpu::batch_split(true));
+
+        init_input_shapes(static_shapes_to_test_representation({inputShape, inputShape}));
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputShape),
+                                   std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputShape)};
+
+        auto add = std::make_shared<ov::op::v1::Add>(params[0], params[1]);
+        std::shared_ptr<ov::Node> result = std::make_shared<ov::op::v1::Softmax>(add, 1);
+        if (withReshape) {
+            const auto batch = static_cast<int64_t>(inputShape[0]);
+            const auto targetShape = ov::op::v0::Constant::create(ov::element::i64, {2}, std::vector<int64_t>{batch, -1});
+            result = std::make_shared<ov::op::v1::Reshape>(result, targetShape, false);
+        }
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(result)}, params, "BatchSplit");
+    }
+};
+
+TEST_P(BatchSplitCPUTest, CompareWithRefs) {
+    run();
+    const auto slicesNum = compiledModel.get_property(ov::intel_cpu::batch_split_slices);
+    const auto withReshape = std::get<1>(GetParam());
+    if (withReshape)
+        ASSERT_EQ(slicesNum, 1);
+    else
+        ASSERT_GE(slicesNum, 1);
+}
+
+namespace {
+
+const std::vector<ov::Shape> inputShapes = {
+    {8, 16, 7, 7},
+    {6, 3, 10, 10},
+    {7, 5, 4, 4},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_BatchSplit_CPU, BatchSplitCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values(false, true)),
+                         BatchSplitCPUTest::getTestCaseName);
+
+}  // namespace
+
+// Subgraph (the results of the split request are compared with the ones of the request compiled without splitting):
+/*
+ *    Parameter[8, 16, 10]
+ *             |
+ *   MatMul(Constant[10, 12])
+ *             |
+ *   Softmax(2 or 0, the latter mixes the elements of the batch and prevents the splitting)
+ *             |
+ *          Result
+ */
+class BatchSplitAccuracyCPUTest : public testing::WithParamInterface<int64_t>,
+                                  public CPUTestsBase,
+                                  public testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<int64_t>& obj) {
+        return "softmaxAxis=" + std::to_string(obj.param);
+    }
+
+protected:
+    std::shared_ptr<ov::Model> makeModel(int64_t softmaxAxis) {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputShape);
+        auto weights = ngraph::builder::makeConstant<float>(ov::element::f32, {10, 12}, {}, true);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(matMul, softmaxAxis);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(softmax)},
+                                           ov::ParameterVector{param}, "BatchSplitAccuracy");
+    }
+
+    ov::Tensor infer(ov::CompiledModel& compiledModel, const ov::Tensor& input) {
+        auto inferRequest = compiledModel.create_infer_request();
+        inferRequest.set_input_tensor(input);
+        inferRequest.infer();
+        auto output = inferRequest.get_output_tensor();
+        ov::Tensor result(output.get_element_type(), output.get_shape());
+        output.copy_to(result);
+        return result;
+    }
+
+    const ov::Shape inputShape{8, 16, 10};
+};
+
+TEST_P(BatchSplitAccuracyCPUTest, CompareWithUnsplit) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto softmaxAxis = GetParam();
+    const auto model = makeModel(softmaxAxis);
+    ov::Core core;
+    auto splitModel = core.compile_model(model, ov::test::utils::DEVICE_CPU,
+                                         ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY),
+                                         ov::intel_cpu::batch_split(true));
+    auto unsplitModel = core.compile_model(model, ov::test::utils::DEVICE_CPU,
+                                           ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY),
+                                           ov::intel_cpu::batch_split(false));
+    if (softmaxAxis == 0)
+        ASSERT_EQ(splitModel.get_property(ov::intel_cpu::batch_split_slices), 1);
+    ASSERT_EQ(unsplitModel.get_property(ov::intel_cpu::batch_split_slices), 1);
+
+    const auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, inputShape, 10, -5, 1000);
+    const auto expected = infer(unsplitModel, input);
+    const auto actual = infer(splitModel, input);
+    ASSERT_EQ(expected.get_shape(), actual.get_shape());
+    for (size_t i = 0; i < expected.get_size(); ++i) {
+        ASSERT_NEAR(expected.data<float>()[i], actual.data<float>()[i], 1e-5f) << "at " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_BatchSplitAccuracy_CPU, BatchSplitAccuracyCPUTest,
+                         ::testing::Values(2, 0),
+                         BatchSplitAccuracyCPUTest::getTestCaseName);
+
+}  // namespace SubgraphTestsDefinitions
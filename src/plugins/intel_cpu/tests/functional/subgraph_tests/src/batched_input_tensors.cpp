@@ -0,0 +1,74 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "common_test_utils/test_constants.hpp"
+#include "openvino/opsets/opset8.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace SubgraphTestsDefinitions {
+
+// The items set by set_tensors are either used in place, when they are the consecutive parts of one buffer, or
+// gathered into the batched blob kept by the infer request between the inferences while the batch is the same
+class BatchedInputTensorsCPUTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        auto param = std::make_shared<ov::opset8::Parameter>(ov::element::f32, ov::PartialShape{-1, 2, 2, 2});
+        param->set_layout("N...");
+        auto add = std::make_shared<ov::opset8::Add>(param, ov::opset8::Constant::create(ov::element::f32, {1}, {1}));
+        auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::opset8::Result>(add)},
+                                                 ov::ParameterVector{param});
+        inferRequest = core.compile_model(model, ov::test::utils::DEVICE_CPU).create_infer_request();
+    }
+
+    // sets the items of the given batch starting from the chunks of the buffer with the given stride, fills them with
+    // the values unique for the inference, the item and the element, and checks the results of the inference
+    void inferItems(size_t batch, size_t chunksStride, float base) {
+        buffer.assign(batch * chunksStride * itemSize, -1.f);
+        std::vector<ov::Tensor> items;
+        for (size_t i = 0; i < batch; i++)
+            items.emplace_back(ov::element::f32, itemShape, &buffer[i * chunksStride * itemSize]);
+        inferRequest.set_input_tensors(items);
+        for (size_t i = 0; i < batch; i++) {
+            auto data = items[i].data<float>();
+            for (size_t j = 0; j < itemSize; j++)
+                data[j] = base + i * itemSize + j;
+        }
+
+        inferRequest.infer();
+        const auto output = inferRequest.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), (ov::Shape{batch, 2, 2, 2}));
+        const auto actual = output.data<float>();
+        for (size_t i = 0; i < batch * itemSize; i++)
+            ASSERT_EQ(actual[i], base + i + 1) << "batch " << batch << ", index " << i;
+    }
+
+    const ov::Shape itemShape{1, 2, 2, 2};
+    const size_t itemSize = ov::shape_size(itemShape);
+    std::vector<float> buffer;
+    ov::Core core;
+    ov::InferRequest inferRequest;
+};
+
+TEST_F(BatchedInputTensorsCPUTest, smoke_ConsecutiveItems) {
+    for (float base : {0.f, 100.f})
+        inferItems(4, 1, base);
+}
+
+TEST_F(BatchedInputTensorsCPUTest, smoke_ScatteredItems) {
+    inferItems(4, 2, 0.f);
+    // the gathered blob is reused for the same batch and reallocated for the other one
+    inferItems(4, 2, 100.f);
+    inferItems(2, 3, 200.f);
+    inferItems(4, 2, 300.f);
+}
+
+TEST_F(BatchedInputTensorsCPUTest, smoke_ConsecutiveAndScatteredItems) {
+    inferItems(3, 2, 0.f);
+    inferItems(3, 1, 100.f);
+    inferItems(3, 2, 200.f);
+}
+
+}  // namespace SubgraphTestsDefinitions
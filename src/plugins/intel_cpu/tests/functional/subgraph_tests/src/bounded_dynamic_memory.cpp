@@ -0,0 +1,61 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+
+/*This test runs the following subgraph:
+
+                 param [1, 1..32, 16]
+                   |
+                Multiply
+                 /    \
+              Relu   Sigmoid
+                 \    /
+                 Concat
+                   |
+                Multiply
+                   |
+                 Result
+
+The main purpose of the test is to check the memory reuse for the dynamic edges with upper bounded shapes,
+which are served by the views into a single arena computed for the upper bounds.
+*/
+
+using namespace InferenceEngine;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+class BoundedDynamicMemoryCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{1, {1, 32}, 16}, {{1, 4, 16}, {1, 32, 16}, {1, 9, 16}, {1, 32, 16}, {1, 1, 16}}};
+        init_input_shapes({input_shape});
+
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+
+        auto mul_const = ngraph::builder::makeConstant(precision, {1}, std::vector<float>({2.0f}));
+        auto mul_1 = ngraph::builder::makeEltwise(params.front(), mul_const, ngraph::helpers::EltwiseTypes::MULTIPLY);
+        auto relu = ngraph::builder::makeActivation(mul_1, precision, ngraph::helpers::ActivationTypes::Relu);
+        auto sigmoid = ngraph::builder::makeActivation(mul_1, precision, ngraph::helpers::ActivationTypes::Sigmoid);
+        auto concat = ngraph::builder::makeConcat({relu, sigmoid}, 1);
+        auto mul_2 = ngraph::builder::makeEltwise(concat, mul_const, ngraph::helpers::EltwiseTypes::MULTIPLY);
+
+        ngraph::ResultVector results = {std::make_shared<ngraph::opset3::Result>(mul_2)};
+        function = std::make_shared<ov::Model>(results, params, "BoundedDynamicMemory");
+    }
+};
+
+TEST_F(BoundedDynamicMemoryCPUTest, smoke_CompareWithRefs) {
+    run();
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,93 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// The linear resize and the per channel scale and shift of the converted image are computed by the ColorConvert node
+//    Y [1,96,128,1]   UV [1,48,64,2]
+//           \          /
+//           NV12toRGB
+//               |
+//      Interpolate(linear, sizes)
+//               |
+//      Subtract(mean) -> Multiply(scale)
+using ColorConvertResizeParams = std::tuple<ov::Shape,                                              // output size
+                                            ov::op::util::InterpolateBase::CoordinateTransformMode>;  // coordinate transformation
+
+class ColorConvertResize : public testing::WithParamInterface<ColorConvertResizeParams>,
+                           virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ColorConvertResizeParams>& obj) {
+        ov::Shape size;
+        ov::op::util::InterpolateBase::CoordinateTransformMode coordTransMode;
+        std::tie(size, coordTransMode) = obj.param;
+
+        std::ostringstream result;
+        result << "size=" << ov::test::utils::vec2str(size) << "_coordTransMode=" << coordTransMode;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        // the scale and shift must stay the Eltwise nodes instead of a snippet
+        configuration.insert({InferenceEngine::PluginConfigInternalParams::KEY_SNIPPETS_MODE,
+                              InferenceEngine::PluginConfigInternalParams::DISABLE});
+        ov::Shape size;
+        ov::op::util::InterpolateBase::CoordinateTransformMode coordTransMode;
+        std::tie(size, coordTransMode) = GetParam();
+        const ov::Shape yShape{1, 96, 128, 1}, uvShape{1, 48, 64, 2};
+        init_input_shapes(ov::test::static_shapes_to_test_representation({yShape, uvShape}));
+
+        auto y = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, yShape);
+        auto uv = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, uvShape);
+        auto rgb = std::make_shared<ov::op::v8::NV12toRGB>(y, uv);
+
+        ov::op::util::InterpolateBase::InterpolateAttrs attrs(ov::op::util::InterpolateBase::InterpolateMode::LINEAR,
+                                                              ov::op::util::InterpolateBase::ShapeCalcMode::SIZES,
+                                                              {0, 0, 0, 0},
+                                                              {0, 0, 0, 0});
+        attrs.coordinate_transformation_mode = coordTransMode;
+        auto sizes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, size);
+        auto axes = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{2}, {1, 2});
+        auto resize = std::make_shared<ov::op::v11::Interpolate>(rgb, sizes, axes, attrs);
+
+        auto mean = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {123.7f, 116.3f, 103.5f});
+        auto scale = ov::op::v0::Constant::create(ov::element::f32, ov::Shape{1, 1, 1, 3}, {0.017f, 0.018f, 0.0175f});
+        auto subtract = std::make_shared<ov::op::v1::Subtract>(resize, mean);
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(subtract, scale);
+        function = std::make_shared<ov::Model>(multiply, ov::ParameterVector{y, uv}, "ColorConvertResize");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); i++) {
+            // the values of the full byte range hit the clipping of the conversion
+            auto tensor = ov::test::utils::create_and_fill_tensor(funcInputs[i].get_element_type(), targetInputStaticShapes[i], 255, 0, 1);
+            inputs.insert({funcInputs[i].get_node_shared_ptr(), tensor});
+        }
+    }
+};
+
+TEST_P(ColorConvertResize, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Interpolate", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ColorConvertResize, ColorConvertResize,
+                         ::testing::Combine(::testing::Values(ov::Shape{64, 64}, ov::Shape{150, 200}),
+                                            ::testing::Values(ov::op::util::InterpolateBase::CoordinateTransformMode::HALF_PIXEL,
+                                                              ov::op::util::InterpolateBase::CoordinateTransformMode::ALIGN_CORNERS)),
+                         ColorConvertResize::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
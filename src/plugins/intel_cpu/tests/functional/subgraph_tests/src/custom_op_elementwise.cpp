@@ -0,0 +1,125 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <openvino/op/util/binary_elementwise_arithmetic.hpp>
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace CPULayerTestsDefinitions {
+
+// The elementwise op unknown to the plugin, so it is executed by the Reference node split between the threads
+class CustomOpElementwise : public ov::op::util::BinaryElementwiseArithmetic {
+public:
+    OPENVINO_OP("CustomOpElementwise", "extension", ov::op::util::BinaryElementwiseArithmetic);
+
+    CustomOpElementwise() = default;
+    CustomOpElementwise(const ov::Output<ov::Node>& arg0, const ov::Output<ov::Node>& arg1)
+        : BinaryElementwiseArithmetic(arg0, arg1, ov::op::AutoBroadcastType::NUMPY) {
+        constructor_validate_and_infer_types();
+    }
+
+    std::shared_ptr<ov::Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override {
+        OPENVINO_ASSERT(new_args.size() == 2, "Incorrect number of new arguments: ", new_args.size(), ". 2 is expected.");
+
+        return std::make_shared<CustomOpElementwise>(new_args[0], new_args[1]);
+    }
+
+    // out = 2 * in_0 + in_1 with the numpy broadcasting
+    bool evaluate(ov::TensorVector& outputs, const ov::TensorVector& inputs) const override {
+        const auto& outShape = outputs[0].get_shape();
+        auto out = outputs[0].data<float>();
+        const size_t outSize = ov::shape_size(outShape);
+        for (size_t i = 0; i < outSize; i++) {
+            float value = 0.f;
+            for (size_t in = 0; in < inputs.size(); in++) {
+                const auto& inShape = inputs[in].get_shape();
+                size_t inOffset = 0;
+                size_t outRest = i;
+                size_t inStride = 1;
+                for (size_t d = 0; d < inShape.size(); d++) {
+                    const size_t outDim = outShape[outShape.size() - 1 - d];
+                    const size_t inDim = inShape[inShape.size() - 1 - d];
+                    if (inDim != 1)
+                        inOffset += (outRest % outDim) * inStride;
+                    outRest /= outDim;
+                    inStride *= inDim;
+                }
+                value += (in == 0 ? 2.f : 1.f) * inputs[in].data<const float>()[inOffset];
+            }
+            out[i] = value;
+        }
+        return true;
+    }
+
+    bool evaluate(ov::TensorVector& output_values,
+                  const ov::TensorVector& input_values,
+                  const ov::EvaluationContext& evaluationContext) const override {
+        return evaluate(output_values, input_values);
+    }
+
+    bool has_evaluate() const override {
+        return get_input_element_type(0) == ov::element::f32;
+    }
+};
+
+using CustomOpElementwiseCPUTestParams = std::tuple<ov::Shape,      // first input shape
+                                                    ov::Shape>;     // second input shape
+
+class CustomOpElementwiseCPUTest : public testing::WithParamInterface<CustomOpElementwiseCPUTestParams>,
+                                   virtual public SubgraphBaseTest,
+                                   public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<CustomOpElementwiseCPUTestParams>& obj) {
+        ov::Shape firstShape, secondShape;
+        std::tie(firstShape, secondShape) = obj.param;
+
+        std::ostringstream result;
+        result << "IS0=" << ov::test::utils::vec2str(firstShape) << "_";
+        result << "IS1=" << ov::test::utils::vec2str(secondShape);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = utils::DEVICE_CPU;
+
+        ov::Shape firstShape, secondShape;
+        std::tie(firstShape, secondShape) = this->GetParam();
+        init_input_shapes(static_shapes_to_test_representation({firstShape, secondShape}));
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, firstShape),
+                                   std::make_shared<ov::op::v0::Parameter>(ov::element::f32, secondShape)};
+        auto custom_op = std::make_shared<CustomOpElementwise>(params[0], params[1]);
+
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(custom_op)};
+        function = std::make_shared<ov::Model>(results, params, "CustomOpElementwise");
+    }
+};
+
+TEST_P(CustomOpElementwiseCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Reference", 1);
+}
+
+namespace {
+
+const std::vector<CustomOpElementwiseCPUTestParams> inputShapes = {
+    // the small output is evaluated by a single thread
+    {{2, 3, 4}, {2, 3, 4}},
+    {{8, 16, 32, 32}, {8, 16, 32, 32}},
+    {{8, 16, 32, 32}, {1, 16, 1, 1}},
+    {{1, 16, 32, 32}, {16, 1, 32}},
+    {{32, 32}, {1, 3, 32, 32}},
+    {{1, 1, 64, 128}, {1, 1, 1, 128}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_CustomOpElementwise, CustomOpElementwiseCPUTest,
+                         ::testing::ValuesIn(inputShapes),
+                         CustomOpElementwiseCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace CPULayerTestsDefinitions
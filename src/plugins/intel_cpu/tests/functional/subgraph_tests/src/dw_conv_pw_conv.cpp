@@ -0,0 +1,66 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/layer_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace ngraph;
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// The depthwise 3x3 with the channels not aligned to the vector length followed by the pointwise 1x1,
+// both with the activations, are computed by one Convolution node
+class DWConvPWConv : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{}, {{2, 20, 29, 31}}};
+        init_input_shapes({input_shape});
+
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+        auto dw_conv_weights = ngraph::builder::makeConstant(precision, std::vector<size_t>{20, 1, 1, 3, 3}, std::vector<float>{}, true);
+        auto dw_conv = ngraph::builder::makeGroupConvolution(params[0],
+                                                             dw_conv_weights,
+                                                             precision,
+                                                             std::vector<size_t>{2, 2},
+                                                             ov::CoordinateDiff{1, 1},
+                                                             ov::CoordinateDiff{1, 1},
+                                                             std::vector<size_t>{1, 1},
+                                                             ngraph::op::PadType::EXPLICIT,
+                                                             true);
+        auto dw_activation = std::make_shared<ov::op::v0::Clamp>(dw_conv, 0., 6.);
+
+        auto pw_conv_weights = ngraph::builder::makeConstant(precision, std::vector<size_t>{36, 20, 1, 1}, std::vector<float>{}, true);
+        auto pw_conv = ngraph::builder::makeConvolution(dw_activation,
+                                                        pw_conv_weights,
+                                                        precision,
+                                                        std::vector<size_t>{1, 1},
+                                                        std::vector<size_t>{1, 1},
+                                                        ov::CoordinateDiff{0, 0},
+                                                        ov::CoordinateDiff{0, 0},
+                                                        std::vector<size_t>{1, 1},
+                                                        ngraph::op::PadType::EXPLICIT,
+                                                        36,
+                                                        true);
+        auto pw_activation = std::make_shared<ov::op::v4::HSwish>(pw_conv);
+        function = std::make_shared<ov::Model>(pw_activation, params, "DWConvPWConv");
+    }
+};
+
+TEST_F(DWConvPWConv, smoke_CompareWithRefs) {
+    run();
+    if (InferenceEngine::with_cpu_x86_avx2()) {
+        CheckNumberOfNodesWithType(compiledModel, "Convolution", 1);
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,81 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+/*This test runs the following subgraph:
+
+                 param1      param2
+                    |           |
+                 Multiply   Transpose
+                    \          /
+                     \        /
+                       Concat
+                         |
+                     Transpose
+                         |
+                       Result
+
+The input shapes alternate between a few values, so the dynamic execution plans recorded for the
+input shapes signatures are replayed (or evicted when the cache capacity is too small).
+*/
+
+using namespace InferenceEngine;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using DynamicExecPlansParams = std::string;  // CPU_EXEC_PLANS_CACHE_CAPACITY value
+
+class DynamicExecPlansCPUTest : public testing::WithParamInterface<DynamicExecPlansParams>,
+                                virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynamicExecPlansParams>& obj) {
+        std::ostringstream result;
+        result << "PlansCapacity=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_EXEC_PLANS_CACHE_CAPACITY, GetParam()});
+
+        const auto precision = ov::element::f32;
+        std::vector<InputShape> input_shapes{
+            {{1, -1, 8}, {{1, 5, 8}, {1, 12, 8}, {1, 5, 8}, {1, 7, 8}, {1, 12, 8}, {1, 5, 8}}},
+            {{1, 8, -1}, {{1, 8, 3}, {1, 8, 3}, {1, 8, 3}, {1, 8, 1}, {1, 8, 3}, {1, 8, 3}}}};
+        init_input_shapes(input_shapes);
+
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+
+        auto mul_const = ngraph::builder::makeConstant(precision, {1}, std::vector<float>({2.0f}));
+        auto mul = ngraph::builder::makeEltwise(params[0], mul_const, ngraph::helpers::EltwiseTypes::MULTIPLY);
+        auto order_1 = ov::op::v0::Constant::create(ov::element::i64, {3}, {0, 2, 1});
+        auto transpose_1 = std::make_shared<ov::op::v1::Transpose>(params[1], order_1);
+        auto concat = ngraph::builder::makeConcat({mul, transpose_1}, 1);
+        auto order_2 = ov::op::v0::Constant::create(ov::element::i64, {3}, {0, 2, 1});
+        auto transpose_2 = std::make_shared<ov::op::v1::Transpose>(concat, order_2);
+
+        ngraph::ResultVector results = {std::make_shared<ngraph::opset3::Result>(transpose_2)};
+        function = std::make_shared<ov::Model>(results, params, "DynamicExecPlans");
+    }
+};
+
+TEST_P(DynamicExecPlansCPUTest, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicExecPlans_CPU,
+                         DynamicExecPlansCPUTest,
+                         ::testing::Values("0", "1", "16"),
+                         DynamicExecPlansCPUTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
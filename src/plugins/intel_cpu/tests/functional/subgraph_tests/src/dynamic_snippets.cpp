@@ -0,0 +1,93 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the dynamic elementwise chain with the static innermost dimension is tokenized into the snippets Subgraph,
+// its kernel is reused for all the outer dimensions, e.g. the batch and the sequence length):
+/*
+ *  Parameter[?, ?, C]   Parameter[?, 1, C]
+ *             \              /
+ *                  Add
+ *                   |
+ *               Multiply(Constant[C])
+ *                   |
+ *                  Relu
+ *                   |
+ *                 Result
+ */
+
+class DynamicSnippetsCPUTest : public testing::WithParamInterface<std::vector<InputShape>>,
+                               virtual public SubgraphBaseTest,
+                               public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<std::vector<InputShape>>& obj) {
+        std::ostringstream result;
+        for (const auto& shape : obj.param) {
+            result << "IS=" << ov::test::utils::partialShape2str({shape.first}) << "_TS=(";
+            for (const auto& item : shape.second) {
+                result << ov::test::utils::vec2str(item) << "_";
+            }
+            result << ")_";
+        }
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_DYNAMIC_SNIPPETS, PluginConfigParams::YES});
+
+        init_input_shapes(GetParam());
+        ov::ParameterVector params;
+        for (const auto& shape : inputDynamicShapes)
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape));
+
+        const auto channels = static_cast<size_t>(inputDynamicShapes[0].rbegin()->get_length());
+        std::vector<float> scales(channels);
+        for (size_t c = 0; c < channels; c++)
+            scales[c] = 0.5f + 0.25f * static_cast<float>(c % 4);
+
+        auto add = std::make_shared<ov::op::v1::Add>(params[0], params[1]);
+        auto scale = ov::op::v0::Constant::create(ov::element::f32, {channels}, scales);
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(add, scale);
+        auto relu = std::make_shared<ov::op::v0::Relu>(multiply);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(relu)}, params, "DynamicSnippets");
+    }
+};
+
+TEST_P(DynamicSnippetsCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+}
+
+namespace {
+
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {
+        {{-1, -1, 64}, {{1, 10, 64}, {2, 17, 64}, {1, 10, 64}, {4, 1, 64}}},
+        {{-1, 1, 64}, {{1, 1, 64}, {2, 1, 64}, {1, 1, 64}, {4, 1, 64}}},
+    },
+    {
+        // the tail of the innermost dimension
+        {{-1, -1, 19}, {{3, 5, 19}, {1, 33, 19}, {3, 5, 19}}},
+        {{-1, 1, 19}, {{3, 1, 19}, {1, 1, 19}, {3, 1, 19}}},
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynamicSnippets_CPU, DynamicSnippetsCPUTest,
+                         ::testing::ValuesIn(inputShapes),
+                         DynamicSnippetsCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,124 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <iterator>
+#include <map>
+#include <sstream>
+
+#include "openvino/openvino.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+/*This test runs the following subgraph:
+
+                 param
+                   |
+                  Conv
+                   |
+                  Relu
+                   |
+                 MatMul
+                   |
+                 Result
+
+The compiled model is exported together with the repacked weights and the selected primitive descriptors and imported
+back. The main purpose of the test is to check that the imported model using the exported repacked weights and
+primitive descriptors produces the same results, selects the same primitives and that both are kept on the repeated
+export.
+*/
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class ExportImportPackedWeightsCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    std::shared_ptr<ov::Model> makeModel() {
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, ov::Shape{1, 16, 8, 8});
+        auto conv = ngraph::builder::makeConvolution(param, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ov::op::PadType::EXPLICIT, 32);
+        auto relu = ngraph::builder::makeActivation(conv, precision, ngraph::helpers::ActivationTypes::Relu);
+        auto reshape = std::make_shared<ov::op::v1::Reshape>(
+            relu, ov::op::v0::Constant::create(ov::element::i64, {2}, std::vector<int64_t>{1, 32 * 8 * 8}), false);
+        auto weights = ngraph::builder::makeConstant<float>(precision, {32 * 8 * 8, 64}, {}, true);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(reshape, weights);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(matMul)},
+                                           ov::ParameterVector{param}, "ExportImportPackedWeights");
+    }
+
+    void compareOutputs(ov::CompiledModel& compiledModel, ov::CompiledModel& importedModel) {
+        ov::Tensor inputTensor(precision, compiledModel.input().get_shape());
+        auto inputData = inputTensor.data<float>();
+        for (size_t i = 0; i < inputTensor.get_size(); ++i) {
+            inputData[i] = static_cast<float>(i % 13) - 6.0f;
+        }
+
+        auto inferRequest = compiledModel.create_infer_request();
+        inferRequest.set_input_tensor(inputTensor);
+        inferRequest.infer();
+        auto importedInferRequest = importedModel.create_infer_request();
+        importedInferRequest.set_input_tensor(inputTensor);
+        importedInferRequest.infer();
+
+        auto expected = inferRequest.get_output_tensor();
+        auto actual = importedInferRequest.get_output_tensor();
+        ASSERT_EQ(expected.get_shape(), actual.get_shape());
+        for (size_t i = 0; i < expected.get_size(); ++i) {
+            ASSERT_EQ(expected.data<float>()[i], actual.data<float>()[i]);
+        }
+    }
+
+    const ov::element::Type precision = ov::element::f32;
+};
+
+TEST_F(ExportImportPackedWeightsCPUTest, smoke_CompareWithOriginal) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto model = makeModel();
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU);
+    std::stringstream exportedModel;
+    compiledModel.export_model(exportedModel);
+
+    auto importedModel = core.import_model(exportedModel, ov::test::utils::DEVICE_CPU);
+    std::stringstream reexportedModel;
+    importedModel.export_model(reexportedModel);
+    ASSERT_EQ(exportedModel.str().size(), reexportedModel.str().size());
+
+    std::map<std::string, std::string> primitiveTypes;
+    for (const auto& op : compiledModel.get_runtime_model()->get_ops()) {
+        primitiveTypes[op->get_friendly_name()] = op->get_rt_info().at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>();
+    }
+    for (const auto& op : importedModel.get_runtime_model()->get_ops()) {
+        ASSERT_EQ(primitiveTypes.at(op->get_friendly_name()),
+                  op->get_rt_info().at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>()) << op->get_friendly_name();
+    }
+
+    compareOutputs(compiledModel, importedModel);
+}
+
+// The blob exported before the packed weights were stored ends with the model itself. The import must not consume
+// the data following it, e.g. the next submodel of the HETERO blob.
+TEST_F(ExportImportPackedWeightsCPUTest, smoke_ImportWithoutPackedWeights) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(), ov::test::utils::DEVICE_CPU);
+    std::stringstream exportedModel;
+    compiledModel.export_model(exportedModel);
+
+    auto blob = exportedModel.str();
+    const auto packedWeightsPos = blob.rfind("CPU_PACKED_WEIGHTS");
+    ASSERT_NE(packedWeightsPos, std::string::npos);
+    const std::string nextBlob = "THE DATA OF THE NEXT BLOB IN THE STREAM";
+    std::stringstream legacyModel(blob.substr(0, packedWeightsPos) + nextBlob);
+
+    auto importedModel = core.import_model(legacyModel, ov::test::utils::DEVICE_CPU);
+    std::string rest((std::istreambuf_iterator<char>(legacyModel)), std::istreambuf_iterator<char>());
+    ASSERT_EQ(nextBlob, rest);
+
+    compareOutputs(compiledModel, importedModel);
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,96 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include <common_test_utils/ov_tensor_utils.hpp>
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the activation is computed by the faster approximation enabled by ov::intel_cpu::fast_math_ops):
+/*
+ *  Parameter[f32]
+ *       |
+ *  Gelu(ERF) / Erf
+ *       |
+ *     Result
+ */
+
+using FastMathActivationParams = std::tuple<ov::Shape,      // input shape
+                                            std::string>;   // activation op type
+
+class FastMathActivationCPUTest : public testing::WithParamInterface<FastMathActivationParams>,
+                                  virtual public SubgraphBaseTest,
+                                  public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<FastMathActivationParams>& obj) {
+        ov::Shape inputShape;
+        std::string opType;
+        std::tie(inputShape, opType) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::vec2str(inputShape) << "_";
+        result << "Op=" << opType;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::Shape inputShape;
+        std::string opType;
+        std::tie(inputShape, opType) = this->GetParam();
+        configuration.insert(ov::hint::execution_mode(ov::hint::ExecutionMode::PERFORMANCE));
+        configuration.insert(ov::hint::inference_precision(ov::element::f32));
+        configuration.insert(ov::intel_cpu::fast_math_ops(opType));
+        // the approximations have the absolute error below 5e-4
+        abs_threshold = 1e-3;
+
+        init_input_shapes(static_shapes_to_test_representation({inputShape}));
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputShape);
+
+        std::shared_ptr<ov::Node> activation;
+        if (opType == "Gelu")
+            activation = std::make_shared<ov::op::v7::Gelu>(param, ov::op::GeluApproximationMode::ERF);
+        else
+            activation = std::make_shared<ov::op::v0::Erf>(param);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(activation)},
+                                               ov::ParameterVector{param}, "FastMathActivation");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& param = function->get_parameters().front();
+        // the range covers the saturated tails of the functions
+        const auto tensor = ov::test::utils::create_and_fill_tensor(param->get_element_type(), targetInputStaticShapes.front(),
+                                                                    20, -10, 100);
+        inputs.insert({param, tensor});
+    }
+};
+
+TEST_P(FastMathActivationCPUTest, CompareWithRefs) {
+    run();
+    // the fast Erf is not tokenized into the snippets Subgraph
+    if (std::get<1>(GetParam()) == "Erf")
+        CheckNumberOfNodesWithType(compiledModel, "Eltwise", 1);
+}
+
+namespace {
+
+const std::vector<ov::Shape> inputShapes = {
+    {1, 64, 16, 16},
+    {2, 3, 7, 5},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_FastMathActivation_CPU, FastMathActivationCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::Values("Gelu", "Erf")),
+                         FastMathActivationCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
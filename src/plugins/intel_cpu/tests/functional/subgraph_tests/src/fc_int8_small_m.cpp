@@ -0,0 +1,95 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+/*This test runs the following subgraph:
+
+                 param          weights
+                   |               |
+              FakeQuantize    FakeQuantize (per output channel)
+                    \            /
+                       MatMul
+                         |
+                        Add (bias)
+                         |
+                       Result
+
+The low precision transformations turn it into the u8 x s8 FullyConnected with the per-channel dequantization scales
+and the bias. The rows up to 4 are computed by MLAS QGEMM, the bigger batch by oneDNN. The test checks that both
+produce the same rows.
+*/
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class FullyConnectedInt8SmallMCPUTest : public ::testing::TestWithParam<size_t>, public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<size_t>& obj) {
+        return "M=" + std::to_string(obj.param);
+    }
+
+protected:
+    std::shared_ptr<ov::Model> makeModel() {
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, ov::PartialShape{-1, static_cast<int64_t>(K)});
+        auto fqData = ngraph::builder::makeFakeQuantize(param, precision, 256, {}, {0.f}, {2.55f}, {0.f}, {2.55f});
+        std::vector<float> low(N), high(N);
+        for (size_t n = 0; n < N; n++) {
+            high[n] = 0.5f + 0.05f * static_cast<float>(n);
+            low[n] = -high[n] * 128.f / 127.f;
+        }
+        auto weights = ngraph::builder::makeConstant<float>(precision, {N, K}, {}, true);
+        auto fqWeights = ngraph::builder::makeFakeQuantize(weights, precision, 256, {N, 1}, low, high, low, high);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(fqData, fqWeights, false, true);
+        auto bias = ngraph::builder::makeConstant<float>(precision, {1, N}, {}, true);
+        auto add = std::make_shared<ov::op::v1::Add>(matMul, bias);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(add)},
+                                           ov::ParameterVector{param}, "FullyConnectedInt8SmallM");
+    }
+
+    ov::Tensor infer(ov::InferRequest& inferRequest, size_t rows) {
+        ov::Tensor inputTensor(precision, {rows, K});
+        auto inputData = inputTensor.data<float>();
+        for (size_t i = 0; i < inputTensor.get_size(); ++i) {
+            inputData[i] = static_cast<float>(i % 29) * 0.09f;
+        }
+        inferRequest.set_input_tensor(inputTensor);
+        inferRequest.infer();
+        auto output = inferRequest.get_output_tensor();
+        ov::Tensor result(output.get_element_type(), output.get_shape());
+        output.copy_to(result);
+        return result;
+    }
+
+    const ov::element::Type precision = ov::element::f32;
+    const size_t K = 64;
+    const size_t N = 32;
+};
+
+TEST_P(FullyConnectedInt8SmallMCPUTest, CompareWithBigBatch) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const size_t M = GetParam();
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(), ov::test::utils::DEVICE_CPU);
+    auto inferRequest = compiledModel.create_infer_request();
+    // the input values depend on the position only, so the first M rows of both inputs are equal
+    const auto expected = infer(inferRequest, 29);
+    const auto actual = infer(inferRequest, M);
+
+    ASSERT_EQ(actual.get_shape(), (ov::Shape{M, N}));
+    for (size_t i = 0; i < actual.get_size(); ++i) {
+        const float ref = expected.data<float>()[i];
+        ASSERT_NEAR(ref, actual.data<float>()[i], 1e-4f * std::max(1.f, std::abs(ref))) << "at " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_FullyConnectedInt8SmallM, FullyConnectedInt8SmallMCPUTest,
+                         ::testing::Values(1, 2, 3, 4),
+                         FullyConnectedInt8SmallMCPUTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,103 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the upsampling step of the FPN like decoders):
+/*
+ *  Parameter[low resolution]
+ *         |
+ *    Interpolate (nearest)   Parameter[high resolution]
+ *              \              /
+ *               \            /
+ *                  Add (fused into Interpolate)
+ *                   |
+ *                 Result
+ */
+
+using InterpolateSumParams = std::tuple<ov::Shape,                                      // low resolution input shape
+                                        ov::op::v4::Interpolate::NearestMode>;          // nearest mode
+
+class InterpolateSumCPUTest : public testing::WithParamInterface<InterpolateSumParams>,
+                              virtual public SubgraphBaseTest,
+                              public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<InterpolateSumParams>& obj) {
+        ov::Shape inputShape;
+        ov::op::v4::Interpolate::NearestMode nearestMode;
+        std::tie(inputShape, nearestMode) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::vec2str(inputShape) << "_";
+        result << "nearestMode=" << nearestMode;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::Shape inputShape;
+        ov::op::v4::Interpolate::NearestMode nearestMode;
+        std::tie(inputShape, nearestMode) = this->GetParam();
+
+        ov::Shape outputShape = inputShape;
+        std::vector<int64_t> axes;
+        std::vector<int64_t> sizes;
+        for (size_t i = 2; i < inputShape.size(); i++) {
+            outputShape[i] *= 2;
+            axes.push_back(i);
+            sizes.push_back(outputShape[i]);
+        }
+        init_input_shapes(static_shapes_to_test_representation({inputShape, outputShape}));
+
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputShape),
+                                   std::make_shared<ov::op::v0::Parameter>(ov::element::f32, outputShape)};
+
+        ov::op::v4::Interpolate::InterpolateAttrs attrs;
+        attrs.mode = ov::op::v4::Interpolate::InterpolateMode::NEAREST;
+        attrs.shape_calculation_mode = ov::op::v4::Interpolate::ShapeCalcMode::SIZES;
+        attrs.coordinate_transformation_mode = ov::op::v4::Interpolate::CoordinateTransformMode::ASYMMETRIC;
+        attrs.nearest_mode = nearestMode;
+        auto sizesNode = ov::op::v0::Constant::create(ov::element::i64, {sizes.size()}, sizes);
+        auto scalesNode = ov::op::v0::Constant::create(ov::element::f32, {sizes.size()}, std::vector<float>(sizes.size(), 2.f));
+        auto axesNode = ov::op::v0::Constant::create(ov::element::i64, {axes.size()}, axes);
+        auto interpolate = std::make_shared<ov::op::v4::Interpolate>(params[0], sizesNode, scalesNode, axesNode, attrs);
+        auto add = std::make_shared<ov::op::v1::Add>(interpolate, params[1]);
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(add)}, params, "InterpolateSum");
+    }
+};
+
+TEST_P(InterpolateSumCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 0);
+}
+
+namespace {
+
+const std::vector<ov::Shape> inputShapes = {
+    {1, 16, 10, 10},
+    {2, 3, 7, 5},
+    {1, 8, 3, 4, 5},
+};
+
+const std::vector<ov::op::v4::Interpolate::NearestMode> nearestModes = {
+    ov::op::v4::Interpolate::NearestMode::FLOOR,
+    ov::op::v4::Interpolate::NearestMode::ROUND_PREFER_CEIL,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_InterpolateSum_CPU, InterpolateSumCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(nearestModes)),
+                         InterpolateSumCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
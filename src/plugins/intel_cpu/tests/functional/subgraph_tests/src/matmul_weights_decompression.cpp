@@ -30,6 +30,9 @@ namespace SubgraphTestsDefinitions {
  *             Matmul
  *               |
  *              Bias
+ *
+ * In the group-wise case the weights of [OC, G, IC / G] shape are decompressed with [OC, G, 1] parameters
+ * and reshaped to [OC, IC] before the MatMul with transposed weights.
  */
 using MatmulWeightsDecompressionParams = std::tuple<std::vector<InputShape>,  // input shapes
                                                     ov::test::ElementType,    // weights precision
@@ -38,7 +41,8 @@ using MatmulWeightsDecompressionParams = std::tuple<std::vector<InputShape>,  //
                                                     bool,                     // reshape on decompression constants
                                                     std::map<std::string, std::string>,  // additional config
                                                     fusingSpecificParams,
-                                                    bool>; // should use decompression implementation
+                                                    bool,     // should use decompression implementation
+                                                    size_t>;  // decompression group size, 0 means per output channel
 
 class MatmulWeightsDecompression : public testing::WithParamInterface<MatmulWeightsDecompressionParams>,
                                   virtual public SubgraphBaseTest,
@@ -53,6 +57,7 @@ public:
         std::map<std::string, std::string> additional_config;
         fusingSpecificParams fusing_params;
         bool should_fuse;
+        size_t group_size;
 
         std::tie(inputShapes,
                  weights_precision,
@@ -61,7 +66,8 @@ public:
                  reshape_on_decompression,
                  additional_config,
                  fusing_params,
-                 should_fuse) = obj.param;
+                 should_fuse,
+                 group_size) = obj.param;
 
         std::ostringstream result;
         for (const auto& shape : inputShapes) {
@@ -82,6 +88,7 @@ public:
         result << "transpose_weights=" << transpose << "_";
         result << "decompression_subtract=" << decompression_sub << "_";
         result << "reshape_on_decompression=" << reshape_on_decompression << "_";
+        result << "group_size=" << group_size << "_";
 
         result << "config=(";
         for (const auto& configEntry : additional_config) {
@@ -94,6 +101,47 @@ public:
     }
 
 protected:
+    static std::shared_ptr<ov::Node> makeWeightsConstant(const ov::element::Type precision, const ov::Shape& shape) {
+        if (precision == ov::element::u4 || precision == ov::element::i4) {
+            const int low = precision == ov::element::i4 ? -8 : 0;
+            std::vector<int8_t> values(ov::shape_size(shape));
+            for (size_t i = 0; i < values.size(); i++)
+                values[i] = static_cast<int8_t>(low + static_cast<int>((i * 7 + i / 5) % 16));
+            return std::make_shared<ov::opset10::Constant>(precision, shape, values);
+        }
+        return ngraph::builder::makeConstant<uint8_t>(precision, shape, {}, true);
+    }
+
+    std::shared_ptr<ov::Model> initGroupSubgraph(std::vector<ov::PartialShape>& inputShapes,
+                                                 const ov::element::Type data_precision,
+                                                 const ov::element::Type weights_precision,
+                                                 const bool add_subtract,
+                                                 const size_t group_size) {
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(data_precision, inputShapes[0])};
+        const auto matmul_shape = inputShapes[1].to_shape();
+        const size_t input_channels = *(matmul_shape.rbegin() + 1);
+        const size_t output_channels = *matmul_shape.rbegin();
+        const ov::Shape weights_shape{output_channels, input_channels / group_size, group_size};
+
+        auto weights = makeWeightsConstant(weights_precision, weights_shape);
+        weights->set_friendly_name("Compressed_weights");
+        std::shared_ptr<ov::Node> mul_parent = std::make_shared<ngraph::opset1::Convert>(weights, data_precision);
+
+        const ov::Shape scaleshift_shape{output_channels, input_channels / group_size, 1};
+        if (add_subtract) {
+            auto shift_const = makeWeightsConstant(weights_precision, scaleshift_shape);
+            auto shift_convert = std::make_shared<ngraph::opset1::Convert>(shift_const, data_precision);
+            mul_parent = std::make_shared<ov::opset10::Subtract>(mul_parent, shift_convert);
+        }
+        auto scale_const = ngraph::builder::makeConstant<float>(data_precision, scaleshift_shape, {}, true);
+        auto multiply = std::make_shared<ov::opset10::Multiply>(mul_parent, scale_const);
+
+        auto reshape_const = ov::opset10::Constant::create(ov::element::i32, {2}, {output_channels, input_channels});
+        auto reshape = std::make_shared<ov::opset10::Reshape>(multiply, reshape_const, false);
+        auto matMul = builder::makeMatMul(params[0], reshape, false, true);
+        return makeNgraphFunction(data_precision, params, matMul, "MatmulGroupWeightsDecompression");
+    }
+
     std::shared_ptr<ov::Model> initSubgraph(std::vector<ov::PartialShape>& inputShapes,
                                                 const ov::element::Type data_precision,
                                                 const ov::element::Type weights_precision,
@@ -110,7 +158,7 @@ protected:
         };
 
         auto weights_shape = transpose_if_necessary(inputShapes[1].to_shape());
-        auto weights = ngraph::builder::makeConstant<uint8_t>(weights_precision, weights_shape, {}, true);
+        auto weights = makeWeightsConstant(weights_precision, weights_shape);
         weights->set_friendly_name("Compressed_weights");
         auto weights_convert = std::make_shared<ngraph::opset1::Convert>(weights, data_precision);
 
@@ -119,7 +167,7 @@ protected:
         auto scaleshift_target_shape = transpose_if_necessary(ov::Shape{1, output_channels});
         auto scaleshift_const_shape = reshape_on_decompression ? ov::Shape{output_channels} : scaleshift_target_shape;
         if (add_subtract) {
-            auto shift_const = ngraph::builder::makeConstant<uint8_t>(weights_precision, scaleshift_const_shape, {}, true);
+            auto shift_const = makeWeightsConstant(weights_precision, scaleshift_const_shape);
             std::shared_ptr<ov::Node> shift_convert = std::make_shared<ngraph::opset1::Convert>(shift_const, data_precision);
             if (reshape_on_decompression) {
                 auto shift_reshape_const = ov::opset10::Constant::create(ov::element::i32, {scaleshift_target_shape.size()}, scaleshift_target_shape);
@@ -162,6 +210,7 @@ protected:
         std::map<std::string, std::string> additional_config;
         fusingSpecificParams fusing_params;
         bool should_fuse;
+        size_t group_size;
 
         std::tie(inputShapes,
                  weights_precision,
@@ -170,7 +219,8 @@ protected:
                  reshape_on_decompression,
                  additional_config,
                  fusing_params,
-                 should_fuse) = GetParam();
+                 should_fuse,
+                 group_size) = GetParam();
 
         configuration.insert(additional_config.begin(), additional_config.end());
         std::tie(postOpMgrPtr, fusedOps) = fusing_params;
@@ -179,7 +229,12 @@ protected:
         ElementType netType = element::f32;
         inType = outType = netType;
 
-        function = initSubgraph(inputDynamicShapes, netType, weights_precision, transpose_weights, decompression_sub, reshape_on_decompression);
+        if (group_size > 0) {
+            function = initGroupSubgraph(inputDynamicShapes, netType, weights_precision, decompression_sub, group_size);
+        } else {
+            function = initSubgraph(inputDynamicShapes, netType, weights_precision, transpose_weights, decompression_sub,
+                                    reshape_on_decompression);
+        }
     }
 
     void checkResults() {
@@ -235,7 +290,7 @@ bool shouldUseDecompressionKernelBasic() {
     return shouldUseDecompressionKernelBig();
 }
 
-const std::vector<ov::test::ElementType> weights_precisions = {ov::element::u8};
+const std::vector<ov::test::ElementType> weights_precisions = {ov::element::u8, ov::element::u4, ov::element::i4};
 const std::vector<std::vector<InputShape>> input_shapes_basic = {
     {{{-1, -1, -1}, {{1, 4, 16}, {10, 16, 16}}}, {{}, {{16, 32}}}},
     {{{}, {{1, 4, 16}}}, {{}, {{1, 16, 32}}}},
@@ -266,7 +321,8 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_basic,
                                             ::testing::Values(true),
                                             ::testing::ValuesIn(filterAdditionalConfigBasic()),
                                             ::testing::ValuesIn(fusingParamsSet),
-                                            ::testing::Values(shouldUseDecompressionKernelBasic())),
+                                            ::testing::Values(shouldUseDecompressionKernelBasic()),
+                                            ::testing::Values(0)),
                          MatmulWeightsDecompression::getTestCaseName);
 
 INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_big,
@@ -278,7 +334,8 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_big,
                                             ::testing::Values(true),
                                             ::testing::ValuesIn(filterAdditionalConfigBig()),
                                             ::testing::ValuesIn(fusingParamsSet),
-                                            ::testing::Values(shouldUseDecompressionKernelBig())),
+                                            ::testing::Values(shouldUseDecompressionKernelBig()),
+                                            ::testing::Values(0)),
                          MatmulWeightsDecompression::getTestCaseName);
 
 const std::vector<std::vector<InputShape>> input_shapes_corner_cases_basic = {
@@ -302,7 +359,8 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_corner_cases_basic,
                                             ::testing::ValuesIn(reshape_on_decompression),
                                             ::testing::ValuesIn(filterAdditionalConfigBasic()),
                                             ::testing::Values(emptyFusingSpec),
-                                            ::testing::Values(shouldUseDecompressionKernelBasic())),
+                                            ::testing::Values(shouldUseDecompressionKernelBasic()),
+                                            ::testing::Values(0)),
                          MatmulWeightsDecompression::getTestCaseName);
 
 INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_corner_cases_big,
@@ -314,7 +372,27 @@ INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_corner_cases_big,
                                             ::testing::ValuesIn(reshape_on_decompression),
                                             ::testing::ValuesIn(filterAdditionalConfigBig()),
                                             ::testing::Values(emptyFusingSpec),
-                                            ::testing::Values(shouldUseDecompressionKernelBig())),
+                                            ::testing::Values(shouldUseDecompressionKernelBig()),
+                                            ::testing::Values(0)),
+                         MatmulWeightsDecompression::getTestCaseName);
+
+const std::vector<std::vector<InputShape>> input_shapes_group = {
+    {{{-1, -1, -1}, {{1, 4, 128}, {1, 1, 128}}}, {{}, {{128, 64}}}},
+    {{{}, {{2, 7, 256}}}, {{}, {{256, 96}}}},
+};
+const std::vector<ov::test::ElementType> group_weights_precisions = {ov::element::u4, ov::element::i4};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MatMulCompressedWeights_group,
+                         MatmulWeightsDecompression,
+                         ::testing::Combine(::testing::ValuesIn(input_shapes_group),
+                                            ::testing::ValuesIn(group_weights_precisions),
+                                            ::testing::Values(false),
+                                            ::testing::ValuesIn(add_decompression_sub),
+                                            ::testing::Values(false),
+                                            ::testing::ValuesIn(filterAdditionalConfigBasic()),
+                                            ::testing::Values(emptyFusingSpec),
+                                            ::testing::Values(shouldUseDecompressionKernelBasic()),
+                                            ::testing::Values(32)),
                          MatmulWeightsDecompression::getTestCaseName);
 } // namespace
 
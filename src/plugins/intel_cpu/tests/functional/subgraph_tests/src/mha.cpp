@@ -116,13 +116,8 @@ static std::shared_ptr<ov::Model> initMHASubgraph1(std::vector<ov::PartialShape>
     ngraphParam.push_back(transpose2Param);
 
     std::vector<ov::Shape> constantShapes;
-    constantShapes.push_back(ov::Shape({inputDynamicShapes[0].get_shape().size()}));
-    constantShapes.push_back(ov::Shape({inputDynamicShapes[0].get_shape().size()}));
-    constantShapes.push_back(ov::Shape({1, inputDynamicShapes[0].get_shape()[2], 1, 1}));
-    constantShapes.push_back(ov::Shape({2}));
-    constantShapes.push_back(ov::Shape({4}));
-    constantShapes.push_back(ov::Shape({inputDynamicShapes[0].get_shape().size()}));
-    constantShapes.push_back(ov::Shape({inputDynamicShapes[0].get_shape().size()}));
+    constantShapes.push_back(ov::Shape({inputDynamicShapes[0].size()}));
+    constantShapes.push_back(ov::Shape({inputDynamicShapes[0].size()}));
 
     std::vector<int64_t> transpose0ConstData = {0, 2, 1, 3};
     auto transpose0Const = ngraph::builder::makeConstant(ElementType::i64, constantShapes[0], transpose0ConstData);
@@ -301,6 +296,32 @@ INSTANTIATE_TEST_SUITE_P(smoke_MHA_BF16, MHATest,
                                  ::testing::Values(ov::test::utils::DEVICE_CPU)),
                          MHATest::getTestCaseName);
 
+// The query length differs from the key/value one, as at the decoder steps attending to the past tokens
+std::vector<std::vector<InputShape>> inputShapesDynamic = {
+    {
+        {{-1, -1, 16, 64}, {{2, 1, 16, 64}, {2, 1, 16, 64}, {2, 8, 16, 64}, {2, 1, 16, 64}}},
+        {{-1, -1, 16, 64}, {{2, 8, 16, 64}, {2, 9, 16, 64}, {2, 8, 16, 64}, {2, 33, 16, 64}}},
+        {{-1, 1, 1, -1}, {{2, 1, 1, 8}, {1, 1, 1, 9}, {2, 1, 1, 8}, {2, 1, 1, 33}}},
+        {{-1, -1, 16, 64}, {{2, 8, 16, 64}, {2, 9, 16, 64}, {2, 8, 16, 64}, {2, 33, 16, 64}}}
+    },
+    {
+        {{1, -1, 13, 80}, {{1, 40, 13, 80}, {1, 1, 13, 80}, {1, 7, 13, 80}}},
+        {{1, -1, 13, 80}, {{1, 40, 13, 80}, {1, 41, 13, 80}, {1, 7, 13, 80}}},
+        {{1, 1, 1, -1}, {{1, 1, 1, 40}, {1, 1, 1, 41}, {1, 1, 1, 7}}},
+        {{1, -1, 13, 80}, {{1, 40, 13, 80}, {1, 41, 13, 80}, {1, 7, 13, 80}}}
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MHA_Dynamic, MHATest,
+                        ::testing::Combine(
+                                ::testing::ValuesIn(inputShapesDynamic),
+                                ::testing::Values(std::vector<ElementType>{ ElementType::f32, ElementType::f32, ElementType::f32, ElementType::f32 }),
+                                ::testing::ValuesIn(matMulIn0Precisions),
+                                ::testing::Values(1),
+                                ::testing::Values(ExpectedNodes{{"MHA", 1}}),
+                                ::testing::Values(ov::test::utils::DEVICE_CPU)),
+                        MHATest::getTestCaseName);
+
 } // namespace
 
 static std::shared_ptr<ov::Model> initMHAQuantSubgraph0(std::vector<ov::PartialShape>& inputDynamicShapes, std::vector<ElementType>& inputPrecisions,
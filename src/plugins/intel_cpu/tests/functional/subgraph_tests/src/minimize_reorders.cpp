@@ -0,0 +1,118 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/ov_tensor_utils.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the layouts selected by the convolutions may require reorders for the layers around them, the results
+// of the model compiled with the layouts revision are compared with the ones of the model compiled without it):
+/*
+ *     Parameter[1, 8, 14, 14]
+ *             |
+ *        Convolution
+ *         /        \
+ *   Softmax(1)   Convolution
+ *       |           |
+ *     Result      MVN(1, 2, 3)
+ *                   |
+ *                 Result
+ */
+class MinimizeReordersCPUTest : public testing::WithParamInterface<ov::element::Type>,
+                                public CPUTestsBase,
+                                public testing::Test {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ov::element::Type>& obj) {
+        return "inferPrc=" + obj.param.get_type_name();
+    }
+
+protected:
+    std::shared_ptr<ov::Model> makeModel() {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputShape);
+        auto conv1 = ngraph::builder::makeConvolution(param, ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 16);
+        auto softmax = std::make_shared<ov::op::v8::Softmax>(conv1, 1);
+        auto conv2 = ngraph::builder::makeConvolution(conv1, ov::element::f32, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 16);
+        auto axes = ov::op::v0::Constant::create(ov::element::i64, {3}, std::vector<int64_t>{1, 2, 3});
+        auto mvn = std::make_shared<ov::op::v6::MVN>(conv2, axes, true, 1e-5f, ov::op::MVNEpsMode::INSIDE_SQRT);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(softmax),
+                                                            std::make_shared<ov::op::v0::Result>(mvn)},
+                                           ov::ParameterVector{param}, "MinimizeReorders");
+    }
+
+    static size_t countReorders(const ov::CompiledModel& compiledModel) {
+        size_t count = 0;
+        for (const auto& node : compiledModel.get_runtime_model()->get_ops()) {
+            const auto& rtInfo = node->get_rt_info();
+            const auto it = rtInfo.find(ExecGraphInfoSerialization::LAYER_TYPE);
+            if (it != rtInfo.end() && it->second.as<std::string>() == "Reorder")
+                count++;
+        }
+        return count;
+    }
+
+    static std::vector<ov::Tensor> infer(ov::CompiledModel& compiledModel, const ov::Tensor& input) {
+        auto inferRequest = compiledModel.create_infer_request();
+        inferRequest.set_input_tensor(input);
+        inferRequest.infer();
+        std::vector<ov::Tensor> results;
+        for (size_t i = 0; i < compiledModel.outputs().size(); i++) {
+            auto output = inferRequest.get_output_tensor(i);
+            ov::Tensor result(output.get_element_type(), output.get_shape());
+            output.copy_to(result);
+            results.push_back(result);
+        }
+        return results;
+    }
+
+    const ov::Shape inputShape{1, 8, 14, 14};
+};
+
+TEST_P(MinimizeReordersCPUTest, CompareWithDefaultLayouts) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto inferencePrecision = GetParam();
+    if (inferencePrecision == ov::element::bf16 && !InferenceEngine::with_cpu_x86_avx512_core())
+        GTEST_SKIP();
+
+    const auto model = makeModel();
+    ov::Core core;
+    auto revisedModel = core.compile_model(model, ov::test::utils::DEVICE_CPU,
+                                           ov::hint::inference_precision(inferencePrecision),
+                                           ov::intel_cpu::minimize_reorders(true));
+    auto defaultModel = core.compile_model(model, ov::test::utils::DEVICE_CPU,
+                                           ov::hint::inference_precision(inferencePrecision));
+    ASSERT_TRUE(revisedModel.get_property(ov::intel_cpu::minimize_reorders));
+    ASSERT_FALSE(defaultModel.get_property(ov::intel_cpu::minimize_reorders));
+    // the revision keeps the selected layouts if none of the alternatives reduces the reorders
+    ASSERT_LE(countReorders(revisedModel), countReorders(defaultModel));
+
+    const auto input = ov::test::utils::create_and_fill_tensor(ov::element::f32, inputShape, 10, -5, 1000);
+    const auto expected = infer(defaultModel, input);
+    const auto actual = infer(revisedModel, input);
+    ASSERT_EQ(expected.size(), actual.size());
+    const float threshold = inferencePrecision == ov::element::bf16 ? 2e-2f : 1e-5f;
+    for (size_t i = 0; i < expected.size(); ++i) {
+        ASSERT_EQ(expected[i].get_shape(), actual[i].get_shape());
+        for (size_t j = 0; j < expected[i].get_size(); ++j) {
+            const float ref = expected[i].data<float>()[j];
+            ASSERT_NEAR(ref, actual[i].data<float>()[j], threshold * std::max(1.f, std::abs(ref)))
+                << "output " << i << " at " << j;
+        }
+    }
+}
+
+namespace {
+
+INSTANTIATE_TEST_SUITE_P(smoke_MinimizeReorders_CPU, MinimizeReordersCPUTest,
+                         ::testing::Values(ov::element::f32, ov::element::bf16),
+                         MinimizeReordersCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
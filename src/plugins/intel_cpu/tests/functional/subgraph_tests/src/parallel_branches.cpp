@@ -0,0 +1,89 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+/*This test runs the following subgraph:
+
+                        param
+                       /     \
+                      /       \
+                   Conv       Conv
+                    |           |
+                   Relu      Sigmoid
+                    |           |
+                   Conv       Conv
+                    |  \       / |
+                    |   \     /  |
+                    |    Add     |
+                    |     |      |
+                  Result Result Result
+
+The main purpose of the test is to check that the concurrent execution of the independent branches
+of one infer request produces the same results as the sequential one, even though the intermediate
+tensors of both towers may share memory due to the memory reuse.
+*/
+
+using namespace InferenceEngine;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+using ParallelBranchesParams = std::string;  // CPU_PARALLEL_BRANCHES value
+
+class ParallelBranchesCPUTest : public testing::WithParamInterface<ParallelBranchesParams>,
+                                virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ParallelBranchesParams>& obj) {
+        std::ostringstream result;
+        result << "ParallelBranches=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_PARALLEL_BRANCHES, GetParam()});
+
+        const auto precision = ov::element::f32;
+        ov::test::InputShape input_shape{{}, {{1, 8, 16, 16}}};
+        init_input_shapes({input_shape});
+
+        ov::ParameterVector params;
+        for (auto&& shape : inputDynamicShapes) {
+            params.push_back(std::make_shared<ov::op::v0::Parameter>(precision, shape));
+        }
+
+        auto makeTower = [&](ngraph::helpers::ActivationTypes activation) {
+            auto conv1 = ngraph::builder::makeConvolution(params.front(), precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                          ov::op::PadType::EXPLICIT, 16);
+            auto act = ngraph::builder::makeActivation(conv1, precision, activation);
+            return ngraph::builder::makeConvolution(act, precision, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                    ov::op::PadType::EXPLICIT, 16);
+        };
+
+        auto tower_1 = makeTower(ngraph::helpers::ActivationTypes::Relu);
+        auto tower_2 = makeTower(ngraph::helpers::ActivationTypes::Sigmoid);
+        auto add = ngraph::builder::makeEltwise(tower_1, tower_2, ngraph::helpers::EltwiseTypes::ADD);
+
+        ngraph::ResultVector results = {std::make_shared<ngraph::opset3::Result>(tower_1),
+                                        std::make_shared<ngraph::opset3::Result>(add),
+                                        std::make_shared<ngraph::opset3::Result>(tower_2)};
+        function = std::make_shared<ov::Model>(results, params, "ParallelBranches");
+    }
+};
+
+TEST_P(ParallelBranchesCPUTest, CompareWithRefs) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelBranches_CPU,
+                         ParallelBranchesCPUTest,
+                         ::testing::Values(PluginConfigParams::YES, PluginConfigParams::NO),
+                         ParallelBranchesCPUTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
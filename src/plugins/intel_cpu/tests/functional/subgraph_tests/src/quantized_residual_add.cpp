@@ -0,0 +1,107 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+using namespace InferenceEngine;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (the residual connection of the quantized model after the dequantization is moved by LPT to one branch):
+/*
+ *  Parameter[u8]
+ *       |
+ *    Convert
+ *       |
+ *    Multiply     Parameter[u8]
+ *       |              |
+ *       |           Convert
+ *        \            /
+ *         \          /
+ *             Add
+ *              |
+ *         FakeQuantize
+ *              |
+ *            Result
+ */
+// Both Convert nodes are merged into the consumers, so the whole chain reads the quantized operands
+// and is executed by a single Eltwise node.
+
+using QuantizedResidualAddParams = std::tuple<ov::Shape,              // input shape
+                                              ov::element::Type>;     // quantized inputs precision
+
+class QuantizedResidualAddCPUTest : public testing::WithParamInterface<QuantizedResidualAddParams>,
+                                    virtual public SubgraphBaseTest,
+                                    public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<QuantizedResidualAddParams>& obj) {
+        ov::Shape inputShape;
+        ov::element::Type inputPrecision;
+        std::tie(inputShape, inputPrecision) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::vec2str(inputShape) << "_";
+        result << "Prc=" << inputPrecision;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        ov::Shape inputShape;
+        ov::element::Type inputPrecision;
+        std::tie(inputShape, inputPrecision) = this->GetParam();
+        // the chain is checked for the Eltwise node, otherwise it is tokenized into the snippets Subgraph
+        configuration.insert({PluginConfigInternalParams::KEY_SNIPPETS_MODE, PluginConfigInternalParams::DISABLE});
+
+        init_input_shapes(static_shapes_to_test_representation({inputShape, inputShape}));
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(inputPrecision, inputShape),
+                                   std::make_shared<ov::op::v0::Parameter>(inputPrecision, inputShape)};
+
+        ov::Shape scaleShape(inputShape.size(), 1);
+        scaleShape[1] = inputShape[1];
+        std::vector<float> scales(inputShape[1]);
+        for (size_t c = 0; c < scales.size(); c++)
+            scales[c] = 0.5f + 0.25f * static_cast<float>(c % 4);
+
+        auto fullPath = std::make_shared<ov::op::v0::Convert>(params[0], ov::element::f32);
+        auto scale = ov::op::v0::Constant::create(ov::element::f32, scaleShape, scales);
+        auto dequantized = std::make_shared<ov::op::v1::Multiply>(fullPath, scale);
+        auto emptyPath = std::make_shared<ov::op::v0::Convert>(params[1], ov::element::f32);
+        auto add = std::make_shared<ov::op::v1::Add>(dequantized, emptyPath);
+        auto fq = ngraph::builder::makeFakeQuantize(add, ov::element::f32, 256, {}, {0.f}, {255.f}, {0.f}, {255.f});
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(fq)}, params, "QuantizedResidualAdd");
+    }
+};
+
+TEST_P(QuantizedResidualAddCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Convert", 0);
+    CheckNumberOfNodesWithType(compiledModel, "Eltwise", 1);
+}
+
+namespace {
+
+const std::vector<ov::Shape> inputShapes = {
+    {1, 16, 10, 10},
+    {2, 3, 7, 5},
+};
+
+const std::vector<ov::element::Type> inputPrecisions = {
+    ov::element::u8,
+    ov::element::i8,
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_QuantizedResidualAdd_CPU, QuantizedResidualAddCPUTest,
+                         ::testing::Combine(::testing::ValuesIn(inputShapes),
+                                            ::testing::ValuesIn(inputPrecisions)),
+                         QuantizedResidualAddCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
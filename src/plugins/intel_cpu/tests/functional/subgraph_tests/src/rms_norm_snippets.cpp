@@ -0,0 +1,87 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/builders.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+// Subgraph (RMSNorm as exported from PyTorch, the whole block including the reduction is tokenized into a single
+// snippets Subgraph):
+/*
+ *        Parameter[N, S, C]
+ *         /           \
+ *        |          Power(2)
+ *        |             |
+ *        |        ReduceMean(-1, keep_dims)
+ *        |             |
+ *        |          Add(eps)
+ *        |             |
+ *        |           Sqrt
+ *         \           /
+ *            Divide
+ *              |
+ *         Multiply(Constant[C])
+ *              |
+ *            Result
+ */
+
+class RMSNormSnippetsCPUTest : public testing::WithParamInterface<ov::Shape>,
+                               virtual public SubgraphBaseTest,
+                               public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ov::Shape>& obj) {
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::vec2str(obj.param);
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto inputShape = GetParam();
+
+        init_input_shapes(static_shapes_to_test_representation({inputShape}));
+        ov::ParameterVector params{std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputShape)};
+
+        const auto channels = inputShape.back();
+        std::vector<float> gamma(channels);
+        for (size_t c = 0; c < channels; c++)
+            gamma[c] = 0.5f + 0.25f * static_cast<float>(c % 4);
+
+        auto power = std::make_shared<ov::op::v1::Power>(params[0], ov::op::v0::Constant::create(ov::element::f32, {}, {2.f}));
+        auto mean = std::make_shared<ov::op::v1::ReduceMean>(power, ov::op::v0::Constant::create(ov::element::i64, {1}, {-1}), true);
+        auto add = std::make_shared<ov::op::v1::Add>(mean, ov::op::v0::Constant::create(ov::element::f32, {}, {1e-5f}));
+        auto sqrt = std::make_shared<ov::op::v0::Sqrt>(add);
+        auto divide = std::make_shared<ov::op::v1::Divide>(params[0], sqrt);
+        auto scale = std::make_shared<ov::op::v1::Multiply>(divide, ov::op::v0::Constant::create(ov::element::f32, {channels}, gamma));
+
+        function = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(scale)}, params, "RMSNorm");
+    }
+};
+
+TEST_P(RMSNormSnippetsCPUTest, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+    CheckNumberOfNodesWithType(compiledModel, "Reduce", 0);
+}
+
+namespace {
+
+const std::vector<ov::Shape> inputShapes = {
+    {1, 128, 64},
+    {2, 16, 256},
+    // the tail of the reduced dimension
+    {3, 7, 35},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_RMSNormSnippets_CPU, RMSNormSnippetsCPUTest,
+                         ::testing::ValuesIn(inputShapes),
+                         RMSNormSnippetsCPUTest::getTestCaseName);
+
+}  // namespace
+}  // namespace SubgraphTestsDefinitions
@@ -0,0 +1,70 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+/*This test runs the following subgraph:
+
+                 param
+                   |
+                  Conv
+                   |
+                  Relu
+                   |
+                  Conv
+                   |
+                 Result
+
+Before the reference comparison the same model is compiled with another streams config, as well as a model of
+the same topology and node names but with other weights values. The main purpose of the test is to check that
+the process-wide weights registry shares the repacked weights by the content only.
+*/
+
+using namespace InferenceEngine;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+class SharedWeightsAcrossModelsCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    static std::shared_ptr<ov::Model> makeModel() {
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, ov::Shape{1, 16, 10, 10});
+        auto conv1 = ngraph::builder::makeConvolution(param, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 32);
+        conv1->set_friendly_name("conv1");
+        auto relu = ngraph::builder::makeActivation(conv1, precision, ngraph::helpers::ActivationTypes::Relu);
+        auto conv2 = ngraph::builder::makeConvolution(relu, precision, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 16);
+        conv2->set_friendly_name("conv2");
+
+        ngraph::ResultVector results = {std::make_shared<ngraph::opset3::Result>(conv2)};
+        return std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "SharedWeightsAcrossModels");
+    }
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_SHARE_WEIGHTS_ACROSS_MODELS, PluginConfigParams::YES});
+        init_input_shapes(static_shapes_to_test_representation({{1, 16, 10, 10}}));
+        function = makeModel();
+    }
+};
+
+TEST_F(SharedWeightsAcrossModelsCPUTest, smoke_CompareWithRefs) {
+    ov::AnyMap config = configuration;
+    // the compiled models are kept alive, so the registry still holds their weights during the reference comparison
+    auto otherStreamsConfig = config;
+    otherStreamsConfig.insert(ov::num_streams(2));
+    auto sameModel = core->compile_model(function, targetDevice, otherStreamsConfig);
+    auto otherModel = core->compile_model(makeModel(), targetDevice, config);
+    sameModel.create_infer_request().infer();
+    otherModel.create_infer_request().infer();
+
+    run();
+}
+
+} // namespace SubgraphTestsDefinitions
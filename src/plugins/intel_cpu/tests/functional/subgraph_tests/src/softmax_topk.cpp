@@ -0,0 +1,76 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// The Softmax followed by the max mode TopK on the same axis is computed by the TopK node normalizing only
+// the selected values
+using SoftmaxTopKParams = std::tuple<ov::Shape,  // input shape
+                                     int64_t>;   // axis
+
+class SoftmaxTopK : public testing::WithParamInterface<SoftmaxTopKParams>,
+                    virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SoftmaxTopKParams>& obj) {
+        ov::Shape shape;
+        int64_t axis;
+        std::tie(shape, axis) = obj.param;
+
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::vec2str(shape) << "_axis=" << axis;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        ov::Shape shape;
+        int64_t axis;
+        std::tie(shape, axis) = GetParam();
+        init_input_shapes(ov::test::static_shapes_to_test_representation({shape}));
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto softmax = std::make_shared<ov::op::v1::Softmax>(param, axis);
+        auto k = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{}, {5});
+        auto topk = std::make_shared<ov::op::v11::TopK>(softmax, k, axis, ov::op::TopKMode::MAX, ov::op::TopKSortType::SORT_VALUES);
+        ov::ResultVector results{std::make_shared<ov::op::v0::Result>(topk->output(0)),
+                                 std::make_shared<ov::op::v0::Result>(topk->output(1))};
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "SoftmaxTopK");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        // the distinct values make the indices of the top elements unambiguous
+        ov::Tensor tensor(ov::element::f32, targetInputStaticShapes.front());
+        std::vector<int> data(tensor.get_size());
+        std::iota(data.begin(), data.end(), 0);
+        std::shuffle(data.begin(), data.end(), std::mt19937(0));
+        auto* tensorData = tensor.data<float>();
+        for (size_t i = 0; i < data.size(); i++)
+            tensorData[i] = data[i] * 1e-3f;
+        inputs.insert({function->inputs()[0].get_node_shared_ptr(), tensor});
+    }
+};
+
+TEST_P(SoftmaxTopK, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "Softmax", 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SoftmaxTopK, SoftmaxTopK,
+                         ::testing::Combine(::testing::Values(ov::Shape{2, 50000}, ov::Shape{3, 1000, 7}),
+                                            ::testing::Values(1)),
+                         SoftmaxTopK::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,90 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset6.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+/*This test runs the following subgraph:
+
+                 param [1, 8]
+                   |
+    ReadValue      |
+         \         |
+          \        |
+               Add
+           /       \
+      Assign      Result
+
+Two sessions share one infer request, each session keeps its state in its own tensor. With the bound state tensors
+the request accumulates the state in place in the tensor of the current session, so switching the sessions by
+set_state doesn't copy the states and the other session's state stays intact.
+*/
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class StatefulBindStateCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static std::shared_ptr<ov::Model> makeModel() {
+        const auto precision = ov::element::f32;
+        const ov::Shape shape{1, 8};
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, shape);
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{shape, precision, "acc"});
+        auto init = ngraph::builder::makeConstant(precision, shape, std::vector<float>(8, 0.0f));
+        auto readValue = std::make_shared<ov::opset6::ReadValue>(init, variable);
+        auto add = std::make_shared<ov::op::v1::Add>(readValue, param);
+        auto assign = std::make_shared<ov::opset6::Assign>(add, variable);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(add)},
+                                           ov::SinkVector{assign}, ov::ParameterVector{param}, "StatefulBindState");
+    }
+
+    static void check(const ov::Tensor& tensor, float expected) {
+        auto data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_size(); ++i) {
+            ASSERT_FLOAT_EQ(data[i], expected);
+        }
+    }
+};
+
+TEST_F(StatefulBindStateCPUTest, smoke_TwoSessions) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(), ov::test::utils::DEVICE_CPU, ov::intel_cpu::bind_state_tensors(true));
+    auto inferRequest = compiledModel.create_infer_request();
+    auto state = inferRequest.query_state().front();
+
+    ov::Tensor input(ov::element::f32, ov::Shape{1, 8});
+    std::fill_n(input.data<float>(), input.get_size(), 1.0f);
+    inferRequest.set_input_tensor(input);
+
+    std::vector<ov::Tensor> sessions;
+    for (float init : {0.0f, 100.0f}) {
+        sessions.emplace_back(ov::element::f32, ov::Shape{1, 8});
+        std::fill_n(sessions.back().data<float>(), sessions.back().get_size(), init);
+    }
+
+    for (size_t step = 1; step <= 3; ++step) {
+        for (size_t session = 0; session < sessions.size(); ++session) {
+            state.set_state(sessions[session]);
+            inferRequest.infer();
+            const float expected = session * 100.0f + step;
+            check(inferRequest.get_output_tensor(), expected);
+            check(sessions[session], expected);
+            check(state.get_state(), expected);
+        }
+    }
+    check(sessions[0], 3.0f);
+
+    // the reset state doesn't touch the session state
+    state.reset();
+    inferRequest.infer();
+    check(inferRequest.get_output_tensor(), 1.0f);
+    check(sessions[1], 103.0f);
+}
+
+} // namespace SubgraphTestsDefinitions
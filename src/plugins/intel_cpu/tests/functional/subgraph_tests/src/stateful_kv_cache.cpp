@@ -0,0 +1,122 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/opsets/opset6.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+/*This test runs the following subgraph:
+
+                 param [1, -1, 2, 4]
+                   |
+    ReadValue      |
+         \         |
+          \        |
+            Concat (axis 1)
+           /       \
+      Assign      Result
+
+The state grows on each inference, the Concat appends the input to the state buffer in place and the ReadValue
+output is a view of the state. The main purpose of the test is to check that the accumulated state is correct
+across the state buffer reallocations, as well as after the state reset, the explicit state setting and the state
+truncation dropping the last tokens.
+*/
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class StatefulKVCacheCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static std::shared_ptr<ov::Model> makeModel() {
+        const auto precision = ov::element::f32;
+        const ov::PartialShape stateShape{1, -1, 2, 4};
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, stateShape);
+        auto variable = std::make_shared<ov::op::util::Variable>(ov::op::util::VariableInfo{stateShape, precision, "kv"});
+        auto init = ngraph::builder::makeConstant(precision, {1, 1, 2, 4}, std::vector<float>(8, 0.0f));
+        auto readValue = std::make_shared<ov::opset6::ReadValue>(init, variable);
+        auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{readValue, param}, 1);
+        auto assign = std::make_shared<ov::opset6::Assign>(concat, variable);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(concat)},
+                                           ov::SinkVector{assign}, ov::ParameterVector{param}, "StatefulKVCache");
+    }
+
+    static void check(const ov::Tensor& tensor, const std::vector<float>& expected) {
+        ASSERT_EQ(tensor.get_shape(), (ov::Shape{1, expected.size() / 8, 2, 4}));
+        auto data = tensor.data<float>();
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_FLOAT_EQ(data[i], expected[i]);
+        }
+    }
+
+    static void run(const ov::AnyMap& config) {
+        ov::Core core;
+        auto compiledModel = core.compile_model(makeModel(), ov::test::utils::DEVICE_CPU, config);
+        auto inferRequest = compiledModel.create_infer_request();
+
+        std::vector<float> expected;
+        float value = 0.0f;
+        auto infer = [&](size_t length) {
+            ov::Tensor inputTensor(ov::element::f32, ov::Shape{1, length, 2, 4});
+            auto inputData = inputTensor.data<float>();
+            for (size_t i = 0; i < inputTensor.get_size(); ++i) {
+                inputData[i] = value;
+                expected.push_back(value);
+                value += 1.0f;
+            }
+            inferRequest.set_input_tensor(inputTensor);
+            inferRequest.infer();
+        };
+
+        for (size_t length : {3, 1, 1, 5, 1, 16}) {
+            infer(length);
+            check(inferRequest.get_output_tensor(), expected);
+            auto states = inferRequest.query_state();
+            ASSERT_EQ(states.size(), 1);
+            check(states.front().get_state(), expected);
+        }
+
+        inferRequest.reset_state();
+        expected.clear();
+        infer(2);
+        check(inferRequest.get_output_tensor(), expected);
+
+        ov::Tensor stateTensor(ov::element::f32, ov::Shape{1, 3, 2, 4});
+        expected.clear();
+        for (size_t i = 0; i < stateTensor.get_size(); ++i) {
+            stateTensor.data<float>()[i] = -value;
+            expected.push_back(-value);
+        }
+        inferRequest.query_state().front().set_state(stateTensor);
+        infer(1);
+        check(inferRequest.get_output_tensor(), expected);
+
+        auto state = inferRequest.query_state().front();
+        ASSERT_THROW(state.truncate(1, 5), ov::Exception);
+        state.truncate(-3, 2);
+        expected.resize(2 * 8);
+        check(state.get_state(), expected);
+        infer(3);
+        check(inferRequest.get_output_tensor(), expected);
+    }
+};
+
+TEST_F(StatefulKVCacheCPUTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run({});
+}
+
+TEST_F(StatefulKVCacheCPUTest, smoke_MaxReservedLength) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run({ov::intel_cpu::max_state_reserved_length(4)});
+}
+
+TEST_F(StatefulKVCacheCPUTest, smoke_BindStateTensors) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    run({ov::intel_cpu::bind_state_tensors(true)});
+}
+
+} // namespace SubgraphTestsDefinitions
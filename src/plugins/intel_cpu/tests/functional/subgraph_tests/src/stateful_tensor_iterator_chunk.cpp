@@ -0,0 +1,72 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "openvino/pass/low_latency.hpp"
+#include "openvino/pass/manager.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// The TensorIterator made stateful by LowLatency2 and processing a chunk of the time steps per inference is unrolled
+//    X [1,4,16]      H [1,16] -> ReadValue
+//          \          /
+//    TensorIterator(axis 1, body: H' = tanh(X * W + H * R))  -> Assign
+using StatefulTensorIteratorChunkParams = size_t;  // time steps per inference
+
+class StatefulTensorIteratorChunk : public testing::WithParamInterface<StatefulTensorIteratorChunkParams>,
+                                    virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<StatefulTensorIteratorChunkParams>& obj) {
+        std::ostringstream result;
+        result << "steps=" << obj.param;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        const size_t steps = GetParam();
+        const size_t hidden = 16;
+        init_input_shapes(ov::test::static_shapes_to_test_representation({{1, steps, hidden}, {1, hidden}}));
+
+        auto x = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, steps, hidden});
+        auto h = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, hidden});
+
+        auto body_x = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 1, hidden});
+        auto body_h = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, hidden});
+        auto squeeze = std::make_shared<ov::op::v0::Squeeze>(body_x, ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {1}));
+        auto w = ngraph::builder::makeConstant<float>(ov::element::f32, ov::Shape{hidden, hidden}, {}, true);
+        auto r = ngraph::builder::makeConstant<float>(ov::element::f32, ov::Shape{hidden, hidden}, {}, true);
+        auto sum = std::make_shared<ov::op::v1::Add>(std::make_shared<ov::op::v0::MatMul>(squeeze, w),
+                                                     std::make_shared<ov::op::v0::MatMul>(body_h, r));
+        auto body_out = std::make_shared<ov::op::v0::Tanh>(sum);
+        auto body = std::make_shared<ov::Model>(ov::OutputVector{body_out}, ov::ParameterVector{body_x, body_h});
+
+        auto ti = std::make_shared<ov::op::v0::TensorIterator>();
+        ti->set_body(body);
+        ti->set_sliced_input(body_x, x, 0, 1, 1, -1, 1);
+        ti->set_merged_input(body_h, h, body_out);
+        auto out = ti->get_iter_value(body_out, -1);
+        function = std::make_shared<ov::Model>(ov::OutputVector{out}, ov::ParameterVector{x, h}, "StatefulTensorIteratorChunk");
+
+        ov::pass::Manager manager;
+        manager.register_pass<ov::pass::LowLatency2>(false);
+        manager.run_passes(function);
+    }
+};
+
+TEST_P(StatefulTensorIteratorChunk, CompareWithRefs) {
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "TensorIterator", 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_StatefulTensorIteratorChunk, StatefulTensorIteratorChunk,
+                         ::testing::Values(4, 8),
+                         StatefulTensorIteratorChunk::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,66 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "ngraph_functions/utils/ngraph_helpers.hpp"
+#include "ngraph_functions/builders.hpp"
+#include "cpp_interfaces/interface/ie_internal_plugin_config.hpp"
+
+/*This test runs the following subgraph:
+
+                 param
+                   |
+              FakeQuantize
+                   |
+                  Conv
+                   |
+                  Relu
+                   |
+                  Conv
+                   |
+                 Result
+
+Before the reference comparison the same model is compiled with other streams and hints configs, so the model
+compiled by the comparison is restored from the models transformed up to LPT kept by the plugin. The main purpose
+of the test is to check that the restored model keeps the inputs and outputs of the compiled one.
+*/
+
+using namespace InferenceEngine;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+class TransformedModelsCacheCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration.insert({PluginConfigInternalParams::KEY_CPU_TRANSFORMED_MODELS_CACHE_CAPACITY, "2"});
+        init_input_shapes(static_shapes_to_test_representation({{1, 16, 10, 10}}));
+
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, ov::Shape{1, 16, 10, 10});
+        auto fq = ngraph::builder::makeFakeQuantize(param, precision, 256, {}, {0.f}, {2.55f}, {0.f}, {2.55f});
+        auto conv1 = ngraph::builder::makeConvolution(fq, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 32);
+        auto relu = ngraph::builder::makeActivation(conv1, precision, ngraph::helpers::ActivationTypes::Relu);
+        auto conv2 = ngraph::builder::makeConvolution(relu, precision, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1},
+                                                      ov::op::PadType::EXPLICIT, 16);
+
+        ngraph::ResultVector results = {std::make_shared<ngraph::opset3::Result>(conv2)};
+        function = std::make_shared<ov::Model>(results, ov::ParameterVector{param}, "TransformedModelsCache");
+    }
+};
+
+TEST_F(TransformedModelsCacheCPUTest, smoke_CompareWithRefs) {
+    auto otherStreamsConfig = configuration;
+    otherStreamsConfig.insert(ov::num_streams(2));
+    core->compile_model(function, targetDevice, otherStreamsConfig).create_infer_request().infer();
+    auto otherHintConfig = configuration;
+    otherHintConfig.insert(ov::hint::performance_mode(ov::hint::PerformanceMode::THROUGHPUT));
+    core->compile_model(function, targetDevice, otherHintConfig).create_infer_request().infer();
+
+    run();
+}
+
+} // namespace SubgraphTestsDefinitions
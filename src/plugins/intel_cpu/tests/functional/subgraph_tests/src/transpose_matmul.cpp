@@ -0,0 +1,89 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+// The Transposes of the attention inputs are not executed: MatMul reads their inputs through the permuted strides
+//    Q [2,16,12,32]   K [2,16,12,32]
+//         |                |
+//   [FakeQuantize]   [FakeQuantize]       (i8 case)
+//         |                |
+//    Transpose(0,2,1,3) Transpose(0,2,3,1) or Transpose(0,2,1,3) with transpose_b
+//          \              /
+//              MatMul
+// In the bf16 and i8 cases the Transpose is only skipped if MatMul consumes its output in the same precision,
+// otherwise it is executed and the inputs are converted after it.
+using TransposeMatMulParams = std::tuple<bool,                // transpose_b
+                                         ov::element::Type>;  // f32, bf16 inference precision or i8 quantized
+
+class TransposeMatMul : public testing::WithParamInterface<TransposeMatMulParams>,
+                        virtual public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<TransposeMatMulParams>& obj) {
+        bool transposeB;
+        ov::element::Type precision;
+        std::tie(transposeB, precision) = obj.param;
+        std::ostringstream result;
+        result << "transpose_b=" << transposeB << "_precision=" << precision;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        bool transposeB;
+        std::tie(transposeB, precision) = GetParam();
+        if (precision == ov::element::bf16) {
+            configuration.insert({ov::hint::inference_precision.name(), ov::element::bf16});
+            rel_threshold = 1e-2f;
+        } else {
+            configuration.insert({ov::hint::inference_precision.name(), ov::element::f32});
+        }
+        const ov::Shape shape{2, 16, 12, 32};
+        init_input_shapes(ov::test::static_shapes_to_test_representation({shape, shape}));
+
+        auto q = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto k = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        ov::Output<ov::Node> qInput = q;
+        ov::Output<ov::Node> kInput = k;
+        if (precision == ov::element::i8) {
+            // the quantization intervals are the ones of u8 and i8, so the dequantized values are exact
+            qInput = ngraph::builder::makeFakeQuantize(q, ov::element::f32, 256, {}, {0.f}, {25.5f}, {0.f}, {25.5f});
+            kInput = ngraph::builder::makeFakeQuantize(k, ov::element::f32, 256, {}, {-12.8f}, {12.7f},
+                                                       {-12.8f}, {12.7f});
+            abs_threshold = 1e-2f;
+        }
+        auto qOrder = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 2, 1, 3});
+        auto kOrder = transposeB ? ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 2, 1, 3})
+                                 : ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, {0, 2, 3, 1});
+        auto qTranspose = std::make_shared<ov::op::v1::Transpose>(qInput, qOrder);
+        auto kTranspose = std::make_shared<ov::op::v1::Transpose>(kInput, kOrder);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(qTranspose, kTranspose, false, transposeB);
+        function = std::make_shared<ov::Model>(matMul, ov::ParameterVector{q, k}, "TransposeMatMul");
+    }
+
+    ov::element::Type precision;
+};
+
+TEST_P(TransposeMatMul, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (precision == ov::element::bf16 && !InferenceEngine::with_cpu_x86_bfloat16())
+        GTEST_SKIP();
+
+    run();
+    if (precision == ov::element::f32)
+        CheckNumberOfNodesWithType(compiledModel, "Reorder", 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_TransposeMatMul, TransposeMatMul,
+                         ::testing::Combine(::testing::Values(false, true),
+                                            ::testing::Values(ov::element::f32, ov::element::bf16, ov::element::i8)),
+                         TransposeMatMul::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
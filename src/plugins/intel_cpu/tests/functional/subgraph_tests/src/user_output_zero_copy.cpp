@@ -0,0 +1,66 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+/*This test runs the following subgraph:
+
+                 param [1, -1, 16]
+                   |
+                Multiply
+                   |
+                 Result
+
+The output tensor is set by the user with the upper bound capacity, so the graph may write the dynamic output
+directly to the user tensor memory. The main purpose of the test is to check that the results are correct and
+the user tensor memory is kept for both the shrinking and the growing output shapes.
+*/
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class UserOutputZeroCopyCPUTest : public ::testing::Test, public CPUTestsBase {};
+
+TEST_F(UserOutputZeroCopyCPUTest, smoke_DynamicOutput) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    const auto precision = ov::element::f32;
+    auto param = std::make_shared<ov::op::v0::Parameter>(precision, ov::PartialShape{1, -1, 16});
+    auto mul_const = ngraph::builder::makeConstant(precision, {1}, std::vector<float>({2.0f}));
+    auto mul = ngraph::builder::makeEltwise(param, mul_const, ngraph::helpers::EltwiseTypes::MULTIPLY);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(mul)},
+                                             ov::ParameterVector{param}, "UserOutputZeroCopy");
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(model, ov::test::utils::DEVICE_CPU);
+    auto inferRequest = compiledModel.create_infer_request();
+
+    constexpr size_t maxLength = 32;
+    ov::Tensor outputTensor(precision, ov::Shape{1, maxLength, 16});
+    const void* outputPtr = outputTensor.data();
+    inferRequest.set_output_tensor(outputTensor);
+
+    for (size_t length : {7, 32, 3, 19}) {
+        ov::Tensor inputTensor(precision, ov::Shape{1, length, 16});
+        auto inputData = inputTensor.data<float>();
+        for (size_t i = 0; i < inputTensor.get_size(); ++i) {
+            inputData[i] = static_cast<float>(i % 97) - 48.0f;
+        }
+        inferRequest.set_input_tensor(inputTensor);
+        inferRequest.infer();
+
+        auto result = inferRequest.get_output_tensor();
+        ASSERT_EQ(result.get_shape(), (ov::Shape{1, length, 16}));
+        ASSERT_EQ(result.data(), outputPtr);
+        auto resultData = result.data<float>();
+        for (size_t i = 0; i < result.get_size(); ++i) {
+            ASSERT_FLOAT_EQ(resultData[i], 2.0f * inputData[i]);
+        }
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,78 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/openvino.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "ngraph_functions/builders.hpp"
+
+/*This test runs the following subgraph:
+
+                 param [-1, 32]
+                   |
+                 MatMul
+                   |
+                  Relu
+                   |
+                 Result
+
+The model is compiled with the warm-up shapes profiles, so the executors for these shapes are created at the
+compilation stage and stored in the runtime cache. The main purpose of the test is to check that the inferences of
+the warmed up shapes do not miss the runtime cache.
+*/
+
+using namespace CPUTestUtils;
+
+namespace SubgraphTestsDefinitions {
+
+class WarmUpShapesCPUTest : public ::testing::Test, public CPUTestsBase {
+protected:
+    static std::shared_ptr<ov::Model> makeModel() {
+        const auto precision = ov::element::f32;
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, ov::PartialShape{-1, 32});
+        param->set_friendly_name("input");
+        auto weights = ngraph::builder::makeConstant<float>(precision, {32, 16}, {}, true);
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+        auto relu = ngraph::builder::makeActivation(matMul, precision, ngraph::helpers::ActivationTypes::Relu);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(relu)},
+                                           ov::ParameterVector{param}, "WarmUpShapes");
+    }
+};
+
+TEST_F(WarmUpShapesCPUTest, smoke_NoCacheMissesForWarmedUpShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    auto compiledModel = core.compile_model(makeModel(), ov::test::utils::DEVICE_CPU,
+                                            ov::num_streams(1),
+                                            ov::intel_cpu::warmup_shapes("input[4,32];input[17,32]"));
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::warmup_shapes), "input[4,32];input[17,32]");
+
+    const auto missesAfterWarmUp = compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics).at("misses");
+    ASSERT_GT(missesAfterWarmUp, 0);
+
+    auto inferRequest = compiledModel.create_infer_request();
+    for (size_t batch : {17, 4}) {
+        ov::Tensor inputTensor(ov::element::f32, ov::Shape{batch, 32});
+        std::fill_n(inputTensor.data<float>(), inputTensor.get_size(), 1.0f);
+        inferRequest.set_input_tensor(inputTensor);
+        inferRequest.infer();
+        ASSERT_EQ(inferRequest.get_output_tensor().get_shape(), (ov::Shape{batch, 16}));
+    }
+    ASSERT_EQ(compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics).at("misses"), missesAfterWarmUp);
+}
+
+TEST_F(WarmUpShapesCPUTest, smoke_WrongWarmUpShapes) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    ov::Core core;
+    ASSERT_THROW(core.compile_model(makeModel(), ov::test::utils::DEVICE_CPU, ov::intel_cpu::warmup_shapes("input[4,32")),
+                 ov::Exception);
+    ASSERT_THROW(core.compile_model(makeModel(), ov::test::utils::DEVICE_CPU, ov::intel_cpu::warmup_shapes("input[4,31]")),
+                 ov::Exception);
+    ASSERT_THROW(core.compile_model(makeModel(), ov::test::utils::DEVICE_CPU, ov::intel_cpu::warmup_shapes("unknown[4,32]")),
+                 ov::Exception);
+}
+
+} // namespace SubgraphTestsDefinitions
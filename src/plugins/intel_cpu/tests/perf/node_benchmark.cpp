@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "node_benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/core.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace perf {
+
+namespace {
+
+constexpr char benchmarked_node_name[] = "benchmarked_node";
+
+double get_env(const char* name, double default_value) {
+    const char* value = std::getenv(name);
+    return value ? std::stod(value) : default_value;
+}
+
+double get_size(const ov::PartialShape& shape) {
+    return static_cast<double>(ov::shape_size(shape.to_shape()));
+}
+
+}  // namespace
+
+std::shared_ptr<ov::Model> make_single_node_model(const std::shared_ptr<ov::Node>& node,
+                                                  const ov::ParameterVector& parameters) {
+    node->set_friendly_name(benchmarked_node_name);
+    ov::ResultVector results;
+    for (const auto& output : node->outputs())
+        results.push_back(std::make_shared<ov::op::v0::Result>(output));
+    return std::make_shared<ov::Model>(results, parameters, node->get_type_name());
+}
+
+std::string NodeBenchmark::getTestCaseName(const ::testing::TestParamInfo<NodeBenchmarkParams>& obj) {
+    NodeCase node;
+    ov::Shape shape;
+    ov::element::Type precision;
+    std::tie(node, shape, precision) = obj.param;
+
+    std::ostringstream result;
+    result << node.name << "_IS=";
+    for (size_t i = 0; i < shape.size(); i++)
+        result << (i ? "x" : "") << shape[i];
+    result << "_Prc=" << precision;
+    return result.str();
+}
+
+void NodeBenchmark::run() {
+    NodeCase node;
+    ov::Shape shape;
+    ov::element::Type precision;
+    std::tie(node, shape, precision) = GetParam();
+
+    const auto model = node.make_model(shape);
+    ov::AnyMap config = {ov::enable_profiling(true),
+                         ov::hint::performance_mode(ov::hint::PerformanceMode::LATENCY),
+                         ov::hint::inference_precision(precision)};
+    const auto threads = static_cast<int32_t>(get_env("OV_CPU_PERF_THREADS", 0));
+    if (threads > 0)
+        config.emplace(ov::inference_num_threads(threads));
+
+    ov::Core core;
+    auto compiled_model = core.compile_model(model, "CPU", config);
+    auto request = compiled_model.create_infer_request();
+    for (const auto& input : compiled_model.inputs()) {
+        auto tensor = request.get_tensor(input);
+        auto data = tensor.data<float>();
+        // moderate values keep the transcendental functions away from the special cases
+        for (size_t i = 0; i < tensor.get_size(); i++)
+            data[i] = static_cast<float>(i % 97) / 97.f - 0.5f;
+    }
+
+    auto get_node_info = [&request]() {
+        for (const auto& info : request.get_profiling_info()) {
+            if (info.node_name == benchmarked_node_name)
+                return info;
+        }
+        OPENVINO_THROW("The benchmarked node is not executed, it is probably optimized out");
+    };
+
+    // warming up
+    for (size_t i = 0; i < 3; i++)
+        request.infer();
+
+    const auto min_time = std::chrono::duration<double, std::milli>(get_env("OV_CPU_PERF_MIN_TIME_MS", 200));
+    std::vector<double> times_us;
+    const auto start = std::chrono::steady_clock::now();
+    while (times_us.size() < 10 || std::chrono::steady_clock::now() - start < min_time) {
+        request.infer();
+        times_us.push_back(static_cast<double>(get_node_info().real_time.count()));
+    }
+    std::sort(times_us.begin(), times_us.end());
+    const double time_us = std::max(times_us[times_us.size() / 2], 1.0);
+
+    const auto node_info = get_node_info();
+    const auto element_size = static_cast<double>(compiled_model.get_property(ov::hint::inference_precision).size());
+    double elements = 0;
+    for (const auto& input : model->inputs())
+        elements += get_size(input.get_partial_shape());
+    double output_elements = 0;
+    for (const auto& output : model->outputs())
+        output_elements += get_size(output.get_partial_shape());
+    const double bytes = (elements + output_elements) * element_size;
+    const double flops = output_elements * node.flops_per_element;
+    // bytes or flops per microsecond make the thousands of GB/s or GFLOP/s
+    const double gbps = bytes / time_us / 1e3;
+    const double gflops = flops / time_us / 1e3;
+
+    std::ostringstream report;
+    report << std::fixed << std::setprecision(2)
+           << getTestCaseName(::testing::TestParamInfo<NodeBenchmarkParams>(GetParam(), 0)) << ": "
+           << node_info.exec_type << ", " << time_us << " us, " << gbps << " GB/s, " << gflops << " GFLOP/s";
+    RecordProperty("exec_type", node_info.exec_type);
+    RecordProperty("time_us", std::to_string(time_us));
+    RecordProperty("gbps", std::to_string(gbps));
+    RecordProperty("gflops", std::to_string(gflops));
+
+    const double peak_gbps = get_env("OV_CPU_PERF_PEAK_GBPS", 0);
+    const double peak_gflops = get_env("OV_CPU_PERF_PEAK_GFLOPS", 0);
+    if (peak_gbps > 0) {
+        // the attainable performance is limited by the bandwidth for the data movement nodes
+        double roofline = 100.0 * gbps / peak_gbps;
+        if (flops > 0 && peak_gflops > 0) {
+            const double attainable_gflops = std::min(peak_gflops, flops / bytes * peak_gbps);
+            roofline = 100.0 * gflops / attainable_gflops;
+        }
+        report << ", " << roofline << " % of roofline";
+        RecordProperty("roofline", std::to_string(roofline));
+    }
+    std::cout << report.str() << std::endl;
+}
+
+}  // namespace perf
+}  // namespace intel_cpu
+}  // namespace ov
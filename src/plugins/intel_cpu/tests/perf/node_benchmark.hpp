@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <gtest/gtest.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <tuple>
+
+#include "openvino/core/model.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace perf {
+
+/**
+ * @brief The benchmarked node: the builder of the model with the single operation and the estimation of its work
+ */
+struct NodeCase {
+    std::string name;
+    std::function<std::shared_ptr<ov::Model>(const ov::Shape&)> make_model;
+    // arithmetic operations per element of the output, 0 for the data movement nodes
+    double flops_per_element;
+};
+
+// node, input shape, inference precision
+using NodeBenchmarkParams = std::tuple<NodeCase, ov::Shape, ov::element::Type>;
+
+/**
+ * @brief Compiles the single node model on CPU and measures the execution time of the node reported by the profiling
+ *
+ * The bytes are the compulsory traffic of the node (all the inputs read and the outputs written once in the inference
+ * precision), the GFLOP/s and GB/s are compared with the roofline of the machine set through the environment:
+ *  - OV_CPU_PERF_PEAK_GFLOPS, OV_CPU_PERF_PEAK_GBPS - the peaks of the machine, the roofline is not reported without
+ *  - OV_CPU_PERF_MIN_TIME_MS - the minimal duration of the measurement of each case, 200 ms by default
+ *  - OV_CPU_PERF_THREADS - the number of the inference threads, all the cores by default
+ * The ISA is capped by ONEDNN_MAX_CPU_ISA, the implementation actually executed is reported.
+ */
+class NodeBenchmark : public ::testing::TestWithParam<NodeBenchmarkParams> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<NodeBenchmarkParams>& obj);
+
+protected:
+    void run();
+};
+
+/**
+ * @brief Wraps the benchmarked operation into the model, the operation is found in the profiling by its name
+ */
+std::shared_ptr<ov::Model> make_single_node_model(const std::shared_ptr<ov::Node>& node,
+                                                  const ov::ParameterVector& parameters);
+
+}  // namespace perf
+}  // namespace intel_cpu
+}  // namespace ov
@@ -0,0 +1,111 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <numeric>
+#include <vector>
+
+#include "node_benchmark.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/gather.hpp"
+#include "openvino/op/interpolate.hpp"
+#include "openvino/op/mvn.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/sigmoid.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/transpose.hpp"
+
+using namespace ov::intel_cpu::perf;
+
+namespace {
+
+std::shared_ptr<ov::op::v0::Parameter> make_parameter(const ov::Shape& shape) {
+    return std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+}
+
+const std::vector<NodeCase> nodes = {
+    {"Add",
+     [](const ov::Shape& shape) {
+         auto lhs = make_parameter(shape);
+         auto rhs = make_parameter(shape);
+         return make_single_node_model(std::make_shared<ov::op::v1::Add>(lhs, rhs), {lhs, rhs});
+     },
+     1},
+    {"Sigmoid",
+     [](const ov::Shape& shape) {
+         auto data = make_parameter(shape);
+         return make_single_node_model(std::make_shared<ov::op::v0::Sigmoid>(data), {data});
+     },
+     // exp, add and div
+     3},
+    {"Interpolate",
+     [](const ov::Shape& shape) {
+         auto data = make_parameter(shape);
+         ov::op::v11::Interpolate::InterpolateAttrs attrs;
+         attrs.mode = ov::op::v11::Interpolate::InterpolateMode::LINEAR_ONNX;
+         attrs.shape_calculation_mode = ov::op::v11::Interpolate::ShapeCalcMode::SCALES;
+         auto scales = ov::op::v0::Constant::create(ov::element::f32, {2}, {2.f, 2.f});
+         auto axes = ov::op::v0::Constant::create(ov::element::i64, {2}, {2, 3});
+         return make_single_node_model(std::make_shared<ov::op::v11::Interpolate>(data, scales, axes, attrs),
+                                       {data});
+     },
+     // 4 taps of the bilinear interpolation weighted and summed
+     7},
+    {"Reorder",
+     [](const ov::Shape& shape) {
+         auto data = make_parameter(shape);
+         // the planar Transpose with this order is executed as the Reorder nhwc => nchw
+         auto order = ov::op::v0::Constant::create(ov::element::i64, {4}, {0, 3, 1, 2});
+         return make_single_node_model(std::make_shared<ov::op::v1::Transpose>(data, order), {data});
+     },
+     0},
+    {"Gather",
+     [](const ov::Shape& shape) {
+         auto data = make_parameter(shape);
+         // all the channels in the reverse order
+         std::vector<int64_t> indices(shape[1]);
+         std::iota(indices.rbegin(), indices.rend(), 0);
+         auto indices_node = ov::op::v0::Constant::create(ov::element::i64, {indices.size()}, indices);
+         auto axis = ov::op::v0::Constant::create(ov::element::i64, {}, {1});
+         return make_single_node_model(std::make_shared<ov::op::v8::Gather>(data, indices_node, axis), {data});
+     },
+     0},
+    {"MVN",
+     [](const ov::Shape& shape) {
+         auto data = make_parameter(shape);
+         auto axes = ov::op::v0::Constant::create(ov::element::i64, {2}, {2, 3});
+         auto mvn = std::make_shared<ov::op::v6::MVN>(data, axes, true, 1e-9f, ov::op::MVNEpsMode::INSIDE_SQRT);
+         return make_single_node_model(mvn, {data});
+     },
+     // mean, variance, subtraction and scaling
+     5},
+    {"Softmax",
+     [](const ov::Shape& shape) {
+         auto data = make_parameter(shape);
+         return make_single_node_model(std::make_shared<ov::op::v1::Softmax>(data, 1), {data});
+     },
+     // max, subtraction, exp, sum and scaling
+     5},
+};
+
+const std::vector<ov::Shape> shapes = {
+    {1, 64, 56, 56},
+    {1, 256, 14, 14},
+    {8, 128, 64, 64},
+};
+
+const std::vector<ov::element::Type> precisions = {ov::element::f32, ov::element::bf16};
+
+TEST_P(NodeBenchmark, Throughput) {
+    run();
+}
+
+INSTANTIATE_TEST_SUITE_P(CpuNodes,
+                         NodeBenchmark,
+                         ::testing::Combine(::testing::ValuesIn(nodes),
+                                            ::testing::ValuesIn(shapes),
+                                            ::testing::ValuesIn(precisions)),
+                         NodeBenchmark::getTestCaseName);
+
+}  // namespace
@@ -8,6 +8,7 @@
 #include <gmock/gmock.h>
 
 #include "cache/lru_cache.h"
+#include "cache/concurrent_lru_cache.h"
 #include "cache/multi_cache.h"
 
 using namespace ov::intel_cpu;
@@ -104,6 +105,45 @@ public:
 };
 }// namespace
 
+TEST(ConcurrentLruCacheTests, Get) {
+    constexpr int capacity = 64;
+    ConcurrentLruCache<IntKey, int> cache(capacity, 4);
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i <= capacity; ++i) {
+        const int result = cache.get({i});
+        // the records are distributed between the shards unevenly, so some of them may be already evicted
+        ASSERT_TRUE(result == i || result == int());
+    }
+    ASSERT_EQ(cache.get({2 * capacity}), int());
+}
+
+TEST(ConcurrentLruCacheTests, Evict) {
+    constexpr int capacity = 16;
+    ConcurrentLruCache<IntKey, int> cache(capacity, 4);
+    for (int i = 0; i < 4 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_GE(cache.getEvictionsNumber(), static_cast<size_t>(3 * capacity));
+
+    ASSERT_NO_THROW(cache.evict(capacity));
+    for (int i = 0; i < 4 * capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ConcurrentLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < 10; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+        ASSERT_EQ(cache.get({i}), int());
+    }
+    ASSERT_NO_THROW(cache.evict(5));
+}
+
 TEST(CacheEntryTests, GetOrCreate) {
     using testing::_;
     using ValueType = std::shared_ptr<int>;
@@ -379,3 +419,62 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, Statistics) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 10;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NE(cache.getOrCreate(IntKey{i % capacity}, intBuilder).first, IntValueType());
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        ASSERT_NE(cache.getOrCreate(IntKey{i}, intBuilder).first, IntValueType());
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits, static_cast<size_t>(capacity));
+    ASSERT_EQ(statistics.misses, static_cast<size_t>(2 * capacity));
+    ASSERT_EQ(statistics.evictions, static_cast<size_t>(capacity));
+}
+
+TEST(MultiCacheTests, SmokeThreadSafeShared) {
+    using IntValueType = std::shared_ptr<int>;
+    using StrValueType = std::shared_ptr<std::string>;
+
+    constexpr int capacity = 100;
+    constexpr size_t numThreads = 30;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+    auto strBuilder = [&](const StringKey& key) { return std::make_shared<std::string>(key.data); };
+
+    MultiCache cache(capacity, true);
+
+    auto testRoutine = [&]() {
+        for (int j = 0; j < 10; ++j) {
+            for (int i = 0; i < capacity; ++i) {
+                auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+                ASSERT_NE(intResult.first, IntValueType());
+                ASSERT_EQ(*intResult.first, i);
+                auto strResult = cache.getOrCreate(StringKey{std::to_string(i)}, strBuilder);
+                ASSERT_NE(strResult.first, StrValueType());
+                ASSERT_EQ(*strResult.first, std::to_string(i));
+            }
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto statistics = cache.getStatistics();
+    ASSERT_EQ(statistics.hits + statistics.misses, 2 * 10 * capacity * numThreads);
+    // the same key may be built concurrently by several threads, but most of the lookups must hit
+    ASSERT_GT(statistics.hits, statistics.misses);
+}
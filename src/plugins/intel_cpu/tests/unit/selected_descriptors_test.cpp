@@ -0,0 +1,101 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <sstream>
+
+#include "graph_context.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "node.h"
+#include "selected_descriptors.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+// The node producing one output with a descriptor per given implementation type
+class FakeNode : public Node {
+public:
+    FakeNode(const std::string& name, const GraphContext::CPtr& context, std::vector<impl_desc_type> implTypes)
+        : Node("Fake", name, context), implTypes(std::move(implTypes)) {}
+
+    void getSupportedDescriptors() override {}
+
+    void initSupportedPrimitiveDescriptors() override {
+        auto desc = std::make_shared<CpuBlockedMemoryDesc>(InferenceEngine::Precision::FP32, Shape(VectorDims{1, 8}));
+        for (const auto implType : implTypes) {
+            supportedPrimitiveDescriptors.emplace_back(NodeConfig({}, {PortConfig(desc)}), implType);
+        }
+    }
+
+    void execute(dnnl::stream) override {}
+
+    bool created() const override {
+        return true;
+    }
+
+private:
+    std::vector<impl_desc_type> implTypes;
+};
+
+class SelectedDescriptorsTest : public ::testing::Test {
+protected:
+    std::shared_ptr<FakeNode> makeNode(const std::string& name, std::vector<impl_desc_type> implTypes) {
+        auto node = std::make_shared<FakeNode>(name, context, std::move(implTypes));
+        node->initSupportedPrimitiveDescriptors();
+        return node;
+    }
+
+    int selectedIndex(const Node& node) {
+        return static_cast<int>(node.getSelectedPrimitiveDescriptor() - node.getSupportedPrimitiveDescriptors().data());
+    }
+
+    GraphContext::CPtr context = std::make_shared<GraphContext>(Config{}, nullptr, nullptr, false);
+    const std::vector<impl_desc_type> implTypes{impl_desc_type::ref_any, impl_desc_type::jit_avx2};
+};
+}  // namespace
+
+TEST_F(SelectedDescriptorsTest, RestoreNonDefaultDescriptor) {
+    auto defaultNode = makeNode("node", implTypes);
+    defaultNode->selectOptimalPrimitiveDescriptor();
+    ASSERT_NE(defaultNode->getSelectedPrimitiveDescriptor(), nullptr);
+    const int forcedIndex = 1 - selectedIndex(*defaultNode);
+
+    auto exportedNode = makeNode("node", implTypes);
+    exportedNode->selectPrimitiveDescriptorByIndex(forcedIndex);
+    SelectedDescriptors exported;
+    exported.add(*exportedNode);
+    std::stringstream stream;
+    exported.serialize(stream);
+
+    auto imported = SelectedDescriptors::deserialize(stream);
+    ASSERT_NE(imported, nullptr);
+    ASSERT_EQ(imported->size(), 1u);
+
+    auto importedNode = makeNode("node", implTypes);
+    ASSERT_TRUE(imported->restore(*importedNode));
+    ASSERT_EQ(selectedIndex(*importedNode), forcedIndex);
+
+    // the descriptors of the node don't match the exported ones
+    auto changedNode = makeNode("node", {impl_desc_type::ref_any, impl_desc_type::gemm_any});
+    ASSERT_FALSE(imported->restore(*changedNode));
+    ASSERT_EQ(changedNode->getSelectedPrimitiveDescriptor(), nullptr);
+
+    auto otherNode = makeNode("other", implTypes);
+    ASSERT_FALSE(imported->restore(*otherNode));
+}
+
+TEST_F(SelectedDescriptorsTest, DeserializeKeepsStreamPositionWithoutSection) {
+    const std::string nextBlob = "THE DATA OF THE NEXT BLOB IN THE STREAM";
+    std::stringstream stream(nextBlob);
+    ASSERT_EQ(SelectedDescriptors::deserialize(stream), nullptr);
+    std::string rest((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    ASSERT_EQ(nextBlob, rest);
+
+    // the stream is shorter than the section tag
+    std::stringstream shortStream("CPU");
+    ASSERT_EQ(SelectedDescriptors::deserialize(shortStream), nullptr);
+    ASSERT_EQ(shortStream.tellg(), 0);
+}
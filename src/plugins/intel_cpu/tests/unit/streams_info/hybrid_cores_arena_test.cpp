@@ -0,0 +1,87 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_system_conf.h>
+
+#include <common_test_utils/test_common.hpp>
+
+#include "hybrid_cores_arena.h"
+
+using namespace testing;
+using namespace ov;
+
+namespace {
+
+struct PCoresArenaTestCase {
+    int streams;
+    std::vector<std::vector<int>> streams_info_table;
+    bool mixed_stream;
+    int p_cores_threads;
+};
+
+class PCoresArenaTests : public ov::test::TestsCommon,
+                         public testing::WithParamInterface<std::tuple<PCoresArenaTestCase>> {
+public:
+    void SetUp() override {
+        const auto& test_data = std::get<0>(GetParam());
+
+        auto arena = ov::intel_cpu::PCoresArena::create(test_data.streams_info_table, test_data.streams);
+
+        if (!test_data.mixed_stream) {
+            ASSERT_EQ(arena, nullptr);
+        } else if (arena) {
+            // the arena is not created when the core types are not detected on the test machine
+            ASSERT_EQ(arena->getConcurrency(), test_data.p_cores_threads);
+        }
+    }
+};
+
+PCoresArenaTestCase _1sockets_latency_mixed = {
+    1,
+    {{1, ALL_PROC, 20, 0, 0}, {0, MAIN_CORE_PROC, 6, 0, 0}, {0, EFFICIENT_CORE_PROC, 8, 0, 0},
+     {0, HYPER_THREADING_PROC, 6, 0, 0}},
+    true,
+    12,
+};
+
+PCoresArenaTestCase _1sockets_latency_p_cores = {
+    1,
+    {{1, MAIN_CORE_PROC, 6, 0, 0}},
+    false,
+    0,
+};
+
+PCoresArenaTestCase _1sockets_latency_p_cores_ht = {
+    1,
+    {{1, ALL_PROC, 12, 0, 0}, {0, MAIN_CORE_PROC, 6, 0, 0}, {0, HYPER_THREADING_PROC, 6, 0, 0}},
+    false,
+    0,
+};
+
+PCoresArenaTestCase _1sockets_throughput = {
+    4,
+    {{2, MAIN_CORE_PROC, 3, 0, 0}, {2, EFFICIENT_CORE_PROC, 4, 0, 0}},
+    false,
+    0,
+};
+
+PCoresArenaTestCase _2sockets_latency = {
+    1,
+    {{1, ALL_PROC, 208, -1, -1}, {0, MAIN_CORE_PROC, 52, 0, 0}, {0, MAIN_CORE_PROC, 52, 1, 1},
+     {0, HYPER_THREADING_PROC, 52, 0, 0}, {0, HYPER_THREADING_PROC, 52, 1, 1}},
+    false,
+    0,
+};
+
+TEST_P(PCoresArenaTests, PCoresArena) {}
+
+INSTANTIATE_TEST_SUITE_P(PCoresArenaTable,
+                         PCoresArenaTests,
+                         testing::Values(_1sockets_latency_mixed,
+                                         _1sockets_latency_p_cores,
+                                         _1sockets_latency_p_cores_ht,
+                                         _1sockets_throughput,
+                                         _2sockets_latency));
+}  // namespace
@@ -0,0 +1,118 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/op/sigmoid.hpp"
+#include "transformed_models_cache.h"
+
+using namespace ov::intel_cpu;
+
+namespace {
+class TransformedModelsCacheTest : public ::testing::Test {
+protected:
+    template <typename Op>
+    static std::shared_ptr<ov::Model> makeModel(const ov::Shape& shape = {1, 8}) {
+        auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+        auto op = std::make_shared<Op>(param);
+        return std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(op)},
+                                           ov::ParameterVector{param});
+    }
+
+    static std::string getKey(const std::shared_ptr<ov::Model>& model,
+                              const Config& config = {},
+                              const ov::element::Type inferencePrecision = ov::element::f32,
+                              const bool enableLPT = true) {
+        return TransformedModelsCache::getKey(model, enableLPT, inferencePrecision, false, Config::SnippetsMode::Enable,
+                                              config);
+    }
+
+    static bool hasOp(const std::shared_ptr<ov::Model>& model, const ov::DiscreteTypeInfo& type) {
+        for (const auto& op : model->get_ops()) {
+            if (op->get_type_info() == type)
+                return true;
+        }
+        return false;
+    }
+
+    const size_t capacity = 2;
+    TransformedModelsCache cache;
+};
+}  // namespace
+
+TEST_F(TransformedModelsCacheTest, RestoreStoredModel) {
+    const auto model = makeModel<ov::op::v0::Relu>();
+    const auto key = getKey(model);
+    ASSERT_FALSE(cache.restore(key, model));
+
+    // the stored model stands for the result of the transformations
+    cache.store(key, makeModel<ov::op::v0::Sigmoid>(), capacity);
+    ASSERT_EQ(cache.size(), 1u);
+
+    const auto param = model->get_parameters()[0];
+    const auto result = model->get_results()[0];
+    ASSERT_TRUE(cache.restore(key, model));
+    EXPECT_TRUE(hasOp(model, ov::op::v0::Sigmoid::get_type_info_static()));
+    EXPECT_FALSE(hasOp(model, ov::op::v0::Relu::get_type_info_static()));
+    // the model keeps its parameters and results
+    EXPECT_EQ(model->get_parameters()[0], param);
+    EXPECT_EQ(model->get_results()[0], result);
+}
+
+TEST_F(TransformedModelsCacheTest, KeyIgnoresRuntimeProperties) {
+    const auto model = makeModel<ov::op::v0::Relu>();
+    const auto key = getKey(model);
+
+    Config runtimeConfig;
+    runtimeConfig.streamExecutorConfig._streams = 4;
+    runtimeConfig.perfHintsConfig.ovPerfHint = "THROUGHPUT";
+    runtimeConfig.perfHintsConfig.ovPerfHintNumRequests = 8;
+    runtimeConfig.enableCpuPinning = false;
+    const auto runtimeKey = getKey(model, runtimeConfig);
+    ASSERT_EQ(runtimeKey, key);
+
+    cache.store(key, makeModel<ov::op::v0::Sigmoid>(), capacity);
+    ASSERT_TRUE(cache.restore(runtimeKey, model));
+}
+
+TEST_F(TransformedModelsCacheTest, KeyDependsOnModelAndTransformationsConfig) {
+    const auto model = makeModel<ov::op::v0::Relu>();
+    const auto key = getKey(model);
+    cache.store(key, makeModel<ov::op::v0::Sigmoid>(), capacity);
+
+    Config accuracyConfig;
+    accuracyConfig.executionMode = ov::hint::ExecutionMode::ACCURACY;
+    const std::vector<std::string> changedKeys = {
+        getKey(makeModel<ov::op::v0::Sigmoid>()),
+        getKey(makeModel<ov::op::v0::Relu>({2, 8})),
+        getKey(model, accuracyConfig),
+        getKey(model, {}, ov::element::bf16),
+        getKey(model, {}, ov::element::f32, false),
+        TransformedModelsCache::getKey(model, true, ov::element::f32, true, Config::SnippetsMode::Enable, {}),
+        TransformedModelsCache::getKey(model, true, ov::element::f32, false, Config::SnippetsMode::Disable, {}),
+    };
+    for (const auto& changedKey : changedKeys) {
+        EXPECT_NE(changedKey, key);
+        EXPECT_FALSE(cache.restore(changedKey, makeModel<ov::op::v0::Relu>()));
+    }
+}
+
+TEST_F(TransformedModelsCacheTest, DropsLeastRecentlyUsedModel) {
+    const auto firstKey = getKey(makeModel<ov::op::v0::Relu>());
+    const auto secondKey = getKey(makeModel<ov::op::v0::Sigmoid>());
+    const auto thirdKey = getKey(makeModel<ov::op::v0::Relu>({2, 8}));
+    cache.store(firstKey, makeModel<ov::op::v0::Sigmoid>(), capacity);
+    cache.store(secondKey, makeModel<ov::op::v0::Sigmoid>(), capacity);
+    // the first model becomes the most recently used one
+    ASSERT_TRUE(cache.restore(firstKey, makeModel<ov::op::v0::Relu>()));
+
+    cache.store(thirdKey, makeModel<ov::op::v0::Sigmoid>({2, 8}), capacity);
+    ASSERT_EQ(cache.size(), capacity);
+    EXPECT_FALSE(cache.restore(secondKey, makeModel<ov::op::v0::Sigmoid>()));
+    EXPECT_TRUE(cache.restore(firstKey, makeModel<ov::op::v0::Relu>()));
+    EXPECT_TRUE(cache.restore(thirdKey, makeModel<ov::op::v0::Relu>({2, 8})));
+}
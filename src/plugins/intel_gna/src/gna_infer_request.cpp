@@ -4,6 +4,8 @@
 
 #include "gna_infer_request.hpp"
 
+#include <threading/ie_executor_manager.hpp>
+
 #include "gna_plugin.hpp"
 
 namespace ov {
@@ -25,6 +27,13 @@ GNAInferRequest::GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
     CreateInferRequest();
 }
 
+GNAInferRequest::~GNAInferRequest() {
+    // Wait() consumes the completion, while the executor may still be running the task of the request
+    if (_done.valid()) {
+        _done.wait();
+    }
+}
+
 void GNAInferRequest::InferImpl() {
     // execute input pre-processing.
     execDataPreprocessing(_inputs);
@@ -56,31 +65,80 @@ void GNAInferRequest::StartAsyncImpl() {
 
     CallCleanupAndRethrowOnException(std::move(queue_call));
 
-    // workaround to unblock callback-based flows
-    if (_callback) {
-        auto res = Wait(InferenceEngine::InferRequest::WaitMode::RESULT_READY);
+    if (!_callback) {
+        return;
+    }
+    auto complete = [this]() {
         std::exception_ptr exceptionPtr;
-        if (res != InferenceEngine::StatusCode::OK) {
-            try {
+        try {
+            auto res = WaitForRequest(MAX_TIMEOUT);
+            if (res != InferenceEngine::StatusCode::OK) {
                 IE_EXCEPTION_SWITCH(
                     res,
                     ExceptionType,
                     InferenceEngine::details::ThrowNow<ExceptionType>{IE_LOCATION_PARAM} <<= std::stringstream{});
-            } catch (...) {
-                exceptionPtr = std::current_exception();
             }
+        } catch (...) {
+            exceptionPtr = std::current_exception();
         }
-        _callback(exceptionPtr);
+        return exceptionPtr;
+    };
+    // the requests of the stateful models are executed one by one, so the callback is called right away
+    if (!plg->IsStateless()) {
+        _callback(complete());
+        return;
     }
+
+    // the outputs are exported and the callback is called by the completion executor, so the caller quantizes the
+    // inputs of the next request while the device executes this one, the executor completes the requests in the
+    // order of their submission as the device does
+    auto completion = std::make_shared<std::promise<void>>();
+    auto done = std::make_shared<std::promise<void>>();
+    _completion = completion->get_future();
+    _done = done->get_future().share();
+    InferenceEngine::executorManager()->getExecutor("GNACompletion")->run([this, complete, completion, done]() {
+        auto exceptionPtr = complete();
+        // the request may be destroyed right after Wait() returns, so the callback is called first
+        try {
+            _callback(exceptionPtr);
+        } catch (...) {
+            if (!exceptionPtr)
+                exceptionPtr = std::current_exception();
+        }
+        if (exceptionPtr) {
+            completion->set_exception(exceptionPtr);
+        } else {
+            completion->set_value();
+        }
+        done->set_value();
+    });
 }
 
 InferenceEngine::StatusCode GNAInferRequest::Wait(int64_t millis_timeout) {
+    if (_completion.valid()) {
+        ValidateAndConfigureTimeout(millis_timeout);
+        if (_completion.wait_for(std::chrono::milliseconds(millis_timeout)) != std::future_status::ready) {
+            return InferenceEngine::RESULT_NOT_READY;
+        }
+        // rethrows the error of the request
+        _completion.get();
+        return InferenceEngine::OK;
+    }
+
     if (!IsRequestIndexValid()) {
         return InferenceEngine::INFER_NOT_STARTED;
     }
 
     ValidateAndConfigureTimeout(millis_timeout);
 
+    return WaitForRequest(millis_timeout);
+}
+
+InferenceEngine::StatusCode GNAInferRequest::WaitForRequest(int64_t millis_timeout) {
+    if (!IsRequestIndexValid()) {
+        return InferenceEngine::INFER_NOT_STARTED;
+    }
+
     if (IsRequestCompleted()) {
         return InferenceEngine::OK;
     }
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <future>
 #include <memory>
 
 #include "cpp_interfaces/interface/ie_iinfer_request_internal.hpp"
@@ -22,6 +23,8 @@ public:
     GNAInferRequest(const std::shared_ptr<GNAPlugin>& plg,
                     InferenceEngine::InputsDataMap network_inputs,
                     InferenceEngine::OutputsDataMap network_outputs);
+    ~GNAInferRequest() override;
+
     /**
      * @brief Infers specified input(s) in synchronous mode
      * @note blocks all method of InferRequest while request is ongoing (running or waiting in queue)
@@ -52,6 +55,7 @@ protected:
 
 private:
     void CreateInferRequest();
+    InferenceEngine::StatusCode WaitForRequest(int64_t millis_timeout);
     InferenceEngine::StatusCode HandleRequestWaitStatus(const RequestStatus& request_status);
     void ValidateAndConfigureTimeout(int64_t& millis_timeout);
     void CallCleanupAndRethrowOnException(std::function<void()>&& function_to_invoke);
@@ -61,6 +65,10 @@ private:
 
     uint32_t _infer_request_idx = kRequestIndexInvalid;
     std::shared_ptr<GNAPlugin> plg;
+    // set when the request is completed and the callback is called by the completion executor
+    std::future<void> _completion;
+    // set when the completion executor is done with the request
+    std::shared_future<void> _done;
 };
 
 }  // namespace intel_gna
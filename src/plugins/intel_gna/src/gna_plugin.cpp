@@ -12,6 +12,7 @@
 #include <ie_common.h>
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <gna/gna_config.hpp>
@@ -796,8 +797,10 @@ void GNAPlugin::DumpXNNToFile() const {
 }
 
 uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap& inputs, InferenceEngine::BlobMap& result) {
-    if (config.GetParameter(ov::intel_gna::execution_mode.name()).as<std::string>() == "GNA_HW" &&
-        !gnadevice->isHwAvailable()) {
+    // the same check as the GNA_HW execution mode, without building the property value on every request
+    const bool hwExecutionMode = config.pluginGna2AccMode == Gna2AccelerationModeHardware && !config.swExactMode &&
+                                 !gnaFlags->sw_fp32;
+    if (hwExecutionMode && !gnadevice->isHwAvailable()) {
         THROW_GNA_EXCEPTION << "Execution mode GNA_HW is set, but hardware acceleration is unavailable";
     }
     auto freeWorker = requestWorkerPool_->findFreeModelWorker();
@@ -817,9 +820,20 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap& inputs, Infer
 
     auto index = freeWorker->representingIndex();
 
+    for (auto& output : outputs_.Get()) {
+        if (output.orientation == kDnnUnknownOrientation) {
+            // should not happen in user code however might happen if there any non executable network based
+            // integration of GNAPlugin instance
+            THROW_GNA_EXCEPTION << "network not loaded : output orientation not set";
+        }
+    }
+
+    const auto inputConversionStart = std::chrono::steady_clock::now();
     int inputNum = 0;
     for (auto& input : inputs) {
-        std::string input_name = input.first;
+        const std::string& input_name = input.first;
+        // the inputs are looked up by the name in a vector, so the description is found once per request
+        auto& inputDesc = inputs_ptr_->at(input_name);
         InferenceEngine::Layout input_layout = input.second->getTensorDesc().getLayout();
 
         if (input_layout != InferenceEngine::Layout::C && input_layout != InferenceEngine::Layout::NC &&
@@ -838,33 +852,25 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap& inputs, Infer
         auto is1D = input_layout == InferenceEngine::Layout::C;
         auto is3D = input_layout == InferenceEngine::Layout::CHW;
 
-        if (inputs_ptr_->at(input_name).ptrs.empty()) {
+        if (inputDesc.ptrs.empty()) {
             // should not happen in user code however might happen if there any non executable network based integration
             // of GNAPlugin instance
             THROW_GNA_EXCEPTION << "network not loaded : input pointer for " << input_name << " not set";
         }
 
-        if (inputs_ptr_->at(input_name).ptrs[index] == nullptr) {
+        if (inputDesc.ptrs[index] == nullptr) {
             // should not happen in user code however might happen if there any non executable network based integration
             // of GNAPlugin instance
             THROW_GNA_EXCEPTION << "network not loaded : input pointer for (" << input_name << " at inferRequest #"
                                 << index << " not set";
         }
-        const auto inputOrientation = inputs_ptr_->at(input_name).orientation;
+        const auto inputOrientation = inputDesc.orientation;
         if (inputOrientation == kDnnUnknownOrientation) {
             // should not happen in user code however might happen if there any non executable network based integration
             // of GNAPlugin instance
             THROW_GNA_EXCEPTION << "network not loaded : input orientation for " << input_name << " not set";
         }
 
-        for (auto& output : outputs_.Get()) {
-            if (output.orientation == kDnnUnknownOrientation) {
-                // should not happen in user code however might happen if there any non executable network based
-                // integration of GNAPlugin instance
-                THROW_GNA_EXCEPTION << "network not loaded : output orientation not set";
-            }
-        }
-
         auto dims = input.second->getTensorDesc().getDims();
         auto importedElements =
             is1D ? dims[0] : InferenceEngine::details::product(std::next(std::begin(dims)), std::end(dims));
@@ -874,19 +880,19 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap& inputs, Infer
         auto importedElementSizeBytes = gnaFlags->sw_fp32 ? 4 : (gnaFlags->input_low_precision ? 1 : 2);
         auto importedBytes = importedElements * importedFrames * importedElementSizeBytes;
 
-        if (inputs_ptr_->at(input_name).get_required_size() < importedBytes) {
+        if (inputDesc.get_required_size() < importedBytes) {
             THROW_GNA_EXCEPTION << "Cannot import input frames for :" << input_name
-                                << ", allocated size: " << inputs_ptr_->at(input_name).get_required_size()
+                                << ", allocated size: " << inputDesc.get_required_size()
                                 << ", but input blob size: " << importedBytes;
         }
 
         // Perform pre-processing on CPU.
         // When we need to perform pre-processing on CPU using ngraph model we copy user input to the buffer,
         // then set preprocessing output blob as gna input blob.
-        std::shared_ptr<ov::Model> model = inputs_ptr_->at(input_name).pre_post_process_model;
+        std::shared_ptr<ov::Model> model = inputDesc.pre_post_process_model;
         Blob::Ptr buff_blob = nullptr;
         TensorDesc buff_tensor_desc(input.second->getTensorDesc());
-        buff_tensor_desc.setPrecision(inputs_ptr_->at(input_name).tensor_precision);
+        buff_tensor_desc.setPrecision(inputDesc.tensor_precision);
 
         if (model) {
             // WA: evaluate gather with int16 precision as fp16
@@ -896,14 +902,14 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap& inputs, Infer
             buff_blob = make_blob_with_precision(buff_tensor_desc);
             buff_blob->allocate();
         } else {
-            buff_blob = make_blob_with_precision(buff_tensor_desc, inputs_ptr_->at(input_name).ptrs[index]);
+            buff_blob = make_blob_with_precision(buff_tensor_desc, inputDesc.ptrs[index]);
         }
 
         m_input_output_handler.import_frames(
             buff_blob->buffer(),
             input.second->cbuffer().as<float*>(),
             input.second->getTensorDesc().getPrecision(),
-            gnaFlags->sw_fp32 ? kScaleFactorDefault : inputs_ptr_->at(input_name).scale_factor,
+            gnaFlags->sw_fp32 ? kScaleFactorDefault : inputDesc.scale_factor,
             inputOrientation,
             importedFrames,
             targetGroups,
@@ -916,12 +922,17 @@ uint32_t GNAPlugin::QueueInference(const InferenceEngine::BlobMap& inputs, Infer
             Precision output_prc = buff_blob->getTensorDesc().getPrecision();
             SizeVector output_dims = model->get_result()->get_shape();
             TensorDesc output_desc(output_prc, output_dims, InferenceEngine::Layout::ANY);
-            Blob::Ptr output_blob = make_blob_with_precision(output_desc, inputs_ptr_->at(input_name).ptrs[index]);
+            Blob::Ptr output_blob = make_blob_with_precision(output_desc, inputDesc.ptrs[index]);
             PrePostProcess(buff_blob, output_blob, model);
         }
 
         ++inputNum;
     }
+    if (gnaFlags->performance_counting) {
+        inputConversionTime_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                     std::chrono::steady_clock::now() - inputConversionStart)
+                                     .count();
+    }
 
     if (!freeWorker->enqueueRequest()) {
         THROW_GNA_EXCEPTION << "Error with enqueueing inference request";
@@ -986,6 +997,7 @@ RequestStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
     // TODO test
     dnn->WriteInputAndOutputTextGNA(*worker.model());
 #endif
+    const auto outputConversionStart = std::chrono::steady_clock::now();
     for (auto&& outputBlobIt : requestResult) {
         const std::string& output_name = outputBlobIt.first;
         Blob::Ptr output_blob = outputBlobIt.second;
@@ -1100,9 +1112,18 @@ RequestStatus GNAPlugin::WaitFor(uint32_t request_idx, int64_t millisTimeout) {
 #endif
         }
     }
+    if (gnaFlags->performance_counting) {
+        outputConversionTime_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                                      std::chrono::steady_clock::now() - outputConversionStart)
+                                      .count();
+    }
     return RequestStatus::kCompleted;
 }
 
+bool GNAPlugin::IsStateless() const {
+    return m_graph_compiler->memory_connection.empty();
+}
+
 void GNAPlugin::Reset() {
     m_graph_compiler->Reset();
 }
@@ -1316,7 +1337,17 @@ void GNAPlugin::Export(std::ostream& outStream) {
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> GNAPlugin::GetPerformanceCounts() {
     if (gnaFlags->performance_counting) {
         std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> perfMap;
-        gnadevice->getGnaPerfCounters(perfMap);
+        if (gnadevice) {
+            gnadevice->getGnaPerfCounters(perfMap);
+        }
+        InferenceEngine::InferenceEngineProfileInfo info;
+        info.status = InferenceEngine::InferenceEngineProfileInfo::EXECUTED;
+        info.execution_index = 0;
+        // Host
+        info.cpu_uSec = info.realTime_uSec = inputConversionTime_us.load();
+        perfMap["2.1 Input conversion time on host"] = info;
+        info.cpu_uSec = info.realTime_uSec = outputConversionTime_us.load();
+        perfMap["2.2 Output conversion time on host"] = info;
         return perfMap;
     } else {
         return {};
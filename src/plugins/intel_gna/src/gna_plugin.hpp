@@ -9,6 +9,7 @@
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <cpp_interfaces/interface/ie_iplugin_internal.hpp>
 #include <legacy/ie_util_internal.hpp>
+#include <atomic>
 #include <list>
 #include <map>
 #include <memory>
@@ -80,6 +81,13 @@ protected:
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     bool trivialTopology = false;
 
+    /**
+     * @brief time of the quantization of the inputs and the dequantization of the outputs of the last request on host,
+     * the requests running in parallel write them while the counters are read
+     */
+    std::atomic<uint64_t> inputConversionTime_us{0};
+    std::atomic<uint64_t> outputConversionTime_us{0};
+
 public:
     explicit GNAPlugin(const std::map<std::string, std::string>& configMap);
     /**
@@ -108,6 +116,10 @@ public:
     uint32_t QueueInference(const InferenceEngine::BlobMap& input, InferenceEngine::BlobMap& result);
     bool Wait(uint32_t idx);
     RequestStatus WaitFor(uint32_t idx, int64_t millisTimeout);
+    /**
+     * @brief Returns true if the model has no memory layers, so its requests are independent of each other
+     */
+    bool IsStateless() const;
 
     InferenceEngine::Parameter GetConfig(
         const std::string& name,
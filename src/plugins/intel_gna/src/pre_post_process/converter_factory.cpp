@@ -10,6 +10,9 @@
 #ifdef HAVE_AVX2
 #    include "hw_accelerated_converter_avx2.hpp"
 #endif
+#ifdef HAVE_SSE42
+#    include "hw_accelerated_converter_sse42.hpp"
+#endif
 
 namespace ov {
 namespace intel_gna {
@@ -19,12 +22,15 @@ std::shared_ptr<HwAcceleratedDataConverter> ConverterFactory::create_converter()
 #ifdef HAVE_AVX2
     if (InferenceEngine::with_cpu_x86_avx2()) {
         return std::make_shared<HwAcceleratedDataConverterAvx>();
-    } else {
-        return nullptr;
     }
-#else
-    return nullptr;
 #endif  // HAVE_AVX2
+#ifdef HAVE_SSE42
+    // the low-power hosts without AVX2 (e.g. Atom) support SSE4.2
+    if (InferenceEngine::with_cpu_x86_sse42()) {
+        return std::make_shared<HwAcceleratedDataConverterSse42>();
+    }
+#endif  // HAVE_SSE42
+    return nullptr;
 }
 }  // namespace pre_post_processing
 }  // namespace intel_gna
@@ -30,6 +30,24 @@ T FloatToInt(float src) {
     return static_cast<T>(value);
 }
 
+/**
+ * @brief Stores the block of the converted values starting at the index of the source matrix to the transposed matrix
+ */
+template <typename T>
+inline void store_transposed(T* ptr_dst,
+                             const T* values,
+                             size_t num_values,
+                             size_t index,
+                             size_t num_rows,
+                             size_t num_columns) {
+    for (size_t j = 0; j < num_values; j++, index++) {
+        size_t target_column = index / num_columns;
+        size_t target_row = index % num_columns;
+        // target number of rows == source number of columns
+        ptr_dst[target_row * num_rows + target_column] = values[j];
+    }
+}
+
 template <typename T, typename U>
 inline void unscale_transpose_and_cast(T* ptr_dst,
                                        const U* ptr_src,
@@ -8,7 +8,9 @@
 
 #    include <immintrin.h>
 
+#    include <cstring>
 #    include <limits>
+#    include <type_traits>
 
 #    include "data_conversion_helpers.hpp"
 
@@ -16,6 +18,22 @@ namespace ov {
 namespace intel_gna {
 namespace pre_post_processing {
 
+namespace {
+
+inline __m256i load_as_int32(const int8_t* ptr_src) {
+    return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr_src)));
+}
+
+inline __m256i load_as_int32(const int16_t* ptr_src) {
+    return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr_src)));
+}
+
+inline __m256i load_as_int32(const int32_t* ptr_src) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(ptr_src));
+}
+
+}  // namespace
+
 template <typename T>
 void convert_matrix_fp32_to_int_avx(T* ptr_dst,
                                     const float* ptr_src,
@@ -26,8 +44,7 @@ void convert_matrix_fp32_to_int_avx(T* ptr_dst,
     const size_t num_elements = num_rows * num_columns;
     size_t moves = num_elements / 8;
     size_t mod = num_elements % 8;
-    size_t i, j;
-    size_t index = 0;
+    size_t i;
 
     __m256 v, zero, half, neg_half, scale_factors, mask, rounding_values, min, max, values;
 
@@ -39,7 +56,7 @@ void convert_matrix_fp32_to_int_avx(T* ptr_dst,
     min = _mm256_set1_ps(static_cast<float>(std::numeric_limits<T>::min()));
 
     for (i = 0; i < moves; i++) {
-        v = _mm256_load_ps(&ptr_src[i * 8]);
+        v = _mm256_loadu_ps(&ptr_src[i * 8]);
 
         // rounding_values = (v>0) ? 0.5f : -0.5f;
         mask = _mm256_cmp_ps(v, zero, _CMP_LT_OQ);
@@ -52,32 +69,31 @@ void convert_matrix_fp32_to_int_avx(T* ptr_dst,
         values = _mm256_min_ps(values, max);
         values = _mm256_max_ps(values, min);
 
-        // cast
+        // cast, the values are in the range of T already, so the saturating packs keep them as is
+        __m256i int32_values = _mm256_cvttps_epi32(values);
+        __m128i int16_values =
+            _mm_packs_epi32(_mm256_castsi256_si128(int32_values), _mm256_extracti128_si256(int32_values, 1));
+        alignas(16) uint8_t converted[16];
+        if (std::is_same<T, int8_t>::value) {
+            _mm_store_si128(reinterpret_cast<__m128i*>(converted), _mm_packs_epi16(int16_values, int16_values));
+        } else {
+            _mm_store_si128(reinterpret_cast<__m128i*>(converted), int16_values);
+        }
+
         if (transpose) {
-            for (j = 0; j < 8; j++, index++) {
-                size_t target_column = index / num_columns;
-                size_t target_row = index % num_columns;
-                // target number of rows == source number of columns
-                size_t target_index = target_row * num_rows + target_column;
-                ptr_dst[target_index] = static_cast<T>(values.m256_f32[j]);
-            }
+            store_transposed(ptr_dst, reinterpret_cast<const T*>(converted), 8, i * 8, num_rows, num_columns);
         } else {
-            for (j = 0; j < 8; j++)
-                ptr_dst[i * 8 + j] = static_cast<T>(values.m256_f32[j]);
+            std::memcpy(&ptr_dst[i * 8], converted, 8 * sizeof(T));
         }
     }
 
-    if (transpose) {
-        for (i = 0; i < mod; i++, index++) {
-            size_t target_column = index / num_columns;
-            size_t target_row = index % num_columns;
-            // target number of rows == source number of columns
-            size_t target_index = target_row * num_rows + target_column;
-            ptr_dst[target_index] = FloatToInt<T>(ptr_src[moves * 8 + i] * scale_factor);
-        }
-    } else {
-        for (i = 0; i < mod; i++, index++) {
-            ptr_dst[moves * 8 + i] = FloatToInt<T>(ptr_src[moves * 8 + i] * scale_factor);
+    for (i = 0; i < mod; i++) {
+        const size_t index = moves * 8 + i;
+        const T value = FloatToInt<T>(ptr_src[index] * scale_factor);
+        if (transpose) {
+            store_transposed(ptr_dst, &value, 1, index, num_rows, num_columns);
+        } else {
+            ptr_dst[index] = value;
         }
     }
 }
@@ -110,50 +126,29 @@ void convert_matrix_int_to_fp32_avx(float* ptr_dst,
     const size_t num_elements = num_rows * num_columns;
     size_t moves = num_elements / 8;
     size_t mod = num_elements % 8;
-    size_t i, j;
-    size_t index = 0;
+    size_t i;
 
-    __m256 v, scale_factors, values;
+    __m256 scale_factors, values;
     scale_factors = _mm256_set1_ps(scale_factor);
     for (i = 0; i < moves; i++) {
-        if (std::is_same<T, int8_t>::value) {
-            __m256i int32_values = _mm256_cvtepi8_epi32(*reinterpret_cast<const __m128i*>(&ptr_src[i * 8]));
-            v = _mm256_cvtepi32_ps(int32_values);
-        } else if (std::is_same<T, int16_t>::value) {
-            __m256i int32_values = _mm256_cvtepi16_epi32(*reinterpret_cast<const __m128i*>(&ptr_src[i * 8]));
-            v = _mm256_cvtepi32_ps(int32_values);
-        } else if (std::is_same<T, int32_t>::value) {
-            v = _mm256_cvtepi32_ps(*reinterpret_cast<const __m256i*>(&ptr_src[i * 8]));
-        } else {
-            THROW_GNA_EXCEPTION
-                << "Type not supported: AVX2 matrix conversion available only for int8, int16 and int32";
-        }
-
         // values = v * 1/scale_factors
-        values = _mm256_div_ps(v, scale_factors);
+        values = _mm256_div_ps(_mm256_cvtepi32_ps(load_as_int32(&ptr_src[i * 8])), scale_factors);
         if (transpose) {
-            for (j = 0; j < 8; j++, index++) {
-                size_t target_column = index / num_columns;
-                size_t target_row = index % num_columns;
-                // target number of rows == source number of columns
-                size_t target_index = target_row * num_rows + target_column;
-                ptr_dst[target_index] = values.m256_f32[j];
-            }
+            alignas(32) float converted[8];
+            _mm256_store_ps(converted, values);
+            store_transposed(ptr_dst, converted, 8, i * 8, num_rows, num_columns);
         } else {
-            _mm256_store_ps(&ptr_dst[i * 8], values);
+            _mm256_storeu_ps(&ptr_dst[i * 8], values);
         }
     }
-    if (transpose) {
-        for (i = 0; i < mod; i++, index++) {
-            size_t target_column = index / num_columns;
-            size_t target_row = index % num_columns;
-            // target number of rows == source number of columns
-            size_t target_index = target_row * num_rows + target_column;
-            ptr_dst[target_index] = static_cast<float>(ptr_src[moves * 8 + i] / scale_factor);
-        }
-    } else {
-        for (i = 0; i < mod; i++, index++) {
-            ptr_dst[moves * 8 + i] = static_cast<float>(ptr_src[moves * 8 + i] / scale_factor);
+
+    for (i = 0; i < mod; i++) {
+        const size_t index = moves * 8 + i;
+        const float value = static_cast<float>(ptr_src[index] / scale_factor);
+        if (transpose) {
+            store_transposed(ptr_dst, &value, 1, index, num_rows, num_columns);
+        } else {
+            ptr_dst[index] = value;
         }
     }
 }
@@ -0,0 +1,187 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifdef HAVE_SSE42
+
+#    include "hw_accelerated_converter_sse42.hpp"
+
+#    include <smmintrin.h>
+
+#    include <cstring>
+#    include <limits>
+#    include <type_traits>
+
+#    include "data_conversion_helpers.hpp"
+
+namespace ov {
+namespace intel_gna {
+namespace pre_post_processing {
+
+namespace {
+
+inline __m128i load_as_int32(const int8_t* ptr_src) {
+    int32_t packed;
+    std::memcpy(&packed, ptr_src, sizeof(packed));
+    return _mm_cvtepi8_epi32(_mm_cvtsi32_si128(packed));
+}
+
+inline __m128i load_as_int32(const int16_t* ptr_src) {
+    return _mm_cvtepi16_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(ptr_src)));
+}
+
+inline __m128i load_as_int32(const int32_t* ptr_src) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(ptr_src));
+}
+
+}  // namespace
+
+template <typename T>
+void convert_matrix_fp32_to_int_sse42(T* ptr_dst,
+                                      const float* ptr_src,
+                                      const size_t num_rows,
+                                      const size_t num_columns,
+                                      const float scale_factor,
+                                      bool transpose) {
+    const size_t num_elements = num_rows * num_columns;
+    size_t moves = num_elements / 4;
+    size_t mod = num_elements % 4;
+    size_t i;
+
+    __m128 v, zero, half, neg_half, scale_factors, mask, rounding_values, min, max, values;
+
+    zero = _mm_setzero_ps();
+    half = _mm_set1_ps(0.5f);
+    neg_half = _mm_set1_ps(-0.5f);
+    scale_factors = _mm_set1_ps(scale_factor);
+    max = _mm_set1_ps(static_cast<float>(std::numeric_limits<T>::max()));
+    min = _mm_set1_ps(static_cast<float>(std::numeric_limits<T>::min()));
+
+    for (i = 0; i < moves; i++) {
+        v = _mm_loadu_ps(&ptr_src[i * 4]);
+
+        // rounding_values = (v>0) ? 0.5f : -0.5f;
+        mask = _mm_cmplt_ps(v, zero);
+        rounding_values = _mm_blendv_ps(half, neg_half, mask);
+
+        // values = v * scale_factors +  rounding_values
+        values = _mm_add_ps(_mm_mul_ps(v, scale_factors), rounding_values);
+
+        // shrink to <-32768.0f, 32767.0f>
+        values = _mm_min_ps(values, max);
+        values = _mm_max_ps(values, min);
+
+        // cast, the values are in the range of T already, so the saturating packs keep them as is
+        __m128i int32_values = _mm_cvttps_epi32(values);
+        __m128i int16_values = _mm_packs_epi32(int32_values, int32_values);
+        alignas(16) uint8_t converted[16];
+        if (std::is_same<T, int8_t>::value) {
+            _mm_store_si128(reinterpret_cast<__m128i*>(converted), _mm_packs_epi16(int16_values, int16_values));
+        } else {
+            _mm_store_si128(reinterpret_cast<__m128i*>(converted), int16_values);
+        }
+
+        if (transpose) {
+            store_transposed(ptr_dst, reinterpret_cast<const T*>(converted), 4, i * 4, num_rows, num_columns);
+        } else {
+            std::memcpy(&ptr_dst[i * 4], converted, 4 * sizeof(T));
+        }
+    }
+
+    for (i = 0; i < mod; i++) {
+        const size_t index = moves * 4 + i;
+        const T value = FloatToInt<T>(ptr_src[index] * scale_factor);
+        if (transpose) {
+            store_transposed(ptr_dst, &value, 1, index, num_rows, num_columns);
+        } else {
+            ptr_dst[index] = value;
+        }
+    }
+}
+
+void HwAcceleratedDataConverterSse42::convert_matrix_fp32_to_int16_no_zero_padding(int16_t* ptr_dst,
+                                                                                   const float* ptr_src,
+                                                                                   const size_t num_rows,
+                                                                                   const size_t num_columns,
+                                                                                   const float scale_factor,
+                                                                                   bool transpose) const {
+    convert_matrix_fp32_to_int_sse42(ptr_dst, ptr_src, num_rows, num_columns, scale_factor, transpose);
+}
+
+void HwAcceleratedDataConverterSse42::convert_matrix_fp32_to_int8_no_zero_padding(int8_t* ptr_dst,
+                                                                                  const float* ptr_src,
+                                                                                  const size_t num_rows,
+                                                                                  const size_t num_columns,
+                                                                                  const float scale_factor,
+                                                                                  bool transpose) const {
+    convert_matrix_fp32_to_int_sse42(ptr_dst, ptr_src, num_rows, num_columns, scale_factor, transpose);
+}
+
+template <typename T>
+void convert_matrix_int_to_fp32_sse42(float* ptr_dst,
+                                      const T* ptr_src,
+                                      size_t num_rows,
+                                      size_t num_columns,
+                                      float scale_factor,
+                                      bool transpose) {
+    const size_t num_elements = num_rows * num_columns;
+    size_t moves = num_elements / 4;
+    size_t mod = num_elements % 4;
+    size_t i;
+
+    __m128 scale_factors, values;
+    scale_factors = _mm_set1_ps(scale_factor);
+    for (i = 0; i < moves; i++) {
+        // values = v * 1/scale_factors
+        values = _mm_div_ps(_mm_cvtepi32_ps(load_as_int32(&ptr_src[i * 4])), scale_factors);
+        if (transpose) {
+            alignas(16) float converted[4];
+            _mm_store_ps(converted, values);
+            store_transposed(ptr_dst, converted, 4, i * 4, num_rows, num_columns);
+        } else {
+            _mm_storeu_ps(&ptr_dst[i * 4], values);
+        }
+    }
+
+    for (i = 0; i < mod; i++) {
+        const size_t index = moves * 4 + i;
+        const float value = static_cast<float>(ptr_src[index] / scale_factor);
+        if (transpose) {
+            store_transposed(ptr_dst, &value, 1, index, num_rows, num_columns);
+        } else {
+            ptr_dst[index] = value;
+        }
+    }
+}
+
+void HwAcceleratedDataConverterSse42::convert_matrix_int32_to_fp32_no_zero_padding(float* ptr_dst,
+                                                                                   const int32_t* ptr_src,
+                                                                                   size_t num_rows,
+                                                                                   size_t num_columns,
+                                                                                   float scale_factor,
+                                                                                   bool transpose) const {
+    convert_matrix_int_to_fp32_sse42(ptr_dst, ptr_src, num_rows, num_columns, scale_factor, transpose);
+}
+
+void HwAcceleratedDataConverterSse42::convert_matrix_int16_to_fp32_no_zero_padding(float* ptr_dst,
+                                                                                   const int16_t* ptr_src,
+                                                                                   size_t num_rows,
+                                                                                   size_t num_columns,
+                                                                                   float scale_factor,
+                                                                                   bool transpose) const {
+    convert_matrix_int_to_fp32_sse42(ptr_dst, ptr_src, num_rows, num_columns, scale_factor, transpose);
+}
+
+void HwAcceleratedDataConverterSse42::convert_matrix_int8_to_fp32_no_zero_padding(float* ptr_dst,
+                                                                                  const int8_t* ptr_src,
+                                                                                  size_t num_rows,
+                                                                                  size_t num_columns,
+                                                                                  float scale_factor,
+                                                                                  bool transpose) const {
+    convert_matrix_int_to_fp32_sse42(ptr_dst, ptr_src, num_rows, num_columns, scale_factor, transpose);
+}
+}  // namespace pre_post_processing
+}  // namespace intel_gna
+}  // namespace ov
+
+#endif  // HAVE_SSE42
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <atomic>
+
 #include "subrequest.hpp"
 
 namespace ov {
@@ -66,7 +68,7 @@ public:
     bool isCompleted() const override;
 
 private:
-    RequestStatus status_{RequestStatus::kNone};
+    std::atomic<RequestStatus> status_{RequestStatus::kNone};
     uint32_t requestID_{0};
     EnqueueHandler enqueueHandler_;
     WaitHandler waitHandler_;
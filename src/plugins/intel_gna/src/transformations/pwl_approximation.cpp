@@ -5,7 +5,10 @@
 #include "pwl_approximation.hpp"
 
 #include <iostream>
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <ngraph/pattern/op/or.hpp>
 #include <ngraph/pattern/op/wrap_type.hpp>
 #include <ngraph/rt_info.hpp>
@@ -296,6 +299,60 @@ std::vector<details::Pwl> pwl_search(const details::Function<T>& activation_func
     return pwl;
 }
 
+template <typename T>
+std::vector<double> get_parameters(const details::Function<T>& activation_function) {
+    return {};
+}
+
+template <>
+std::vector<double> get_parameters<ngraph::opset8::Power>(
+    const details::Function<ngraph::opset8::Power>& activation_function) {
+    return {activation_function.m_exponent, activation_function.m_scale, activation_function.m_shift};
+}
+
+// The number of the searches kept per activation type, the least recently used one is dropped once it is exceeded
+static constexpr size_t PWL_SEARCH_CACHE_CAPACITY = 64;
+
+// The segments depend only on the activation, its parameters, the bounds and the allowed error, so they are computed
+// once per process and reused by the next activations and models with the same ones
+template <typename T>
+std::vector<details::Pwl> cached_pwl_search(const details::Function<T>& activation_function,
+                                            double lower_bound,
+                                            double upper_bound,
+                                            double allowed_err_pct,
+                                            double& err_pct) {
+    using Key = std::vector<double>;
+    using Entry = std::pair<Key, std::pair<std::vector<details::Pwl>, double>>;
+    static std::mutex mutex;
+    // the most recently used first
+    static std::list<Entry> entries;
+    static std::map<Key, typename std::list<Entry>::iterator> cache;
+
+    auto key = get_parameters<T>(activation_function);
+    key.insert(key.end(), {lower_bound, upper_bound, allowed_err_pct});
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        auto it = cache.find(key);
+        if (it != cache.end()) {
+            entries.splice(entries.begin(), entries, it->second);
+            err_pct = it->second->second.second;
+            return it->second->second.first;
+        }
+    }
+
+    auto segments = pwl_search<T>(activation_function, lower_bound, upper_bound, allowed_err_pct, err_pct);
+    std::lock_guard<std::mutex> lock{mutex};
+    if (cache.find(key) == cache.end()) {
+        entries.emplace_front(key, std::make_pair(segments, err_pct));
+        cache.emplace(std::move(key), entries.begin());
+        if (entries.size() > PWL_SEARCH_CACHE_CAPACITY) {
+            cache.erase(entries.back().first);
+            entries.pop_back();
+        }
+    }
+    return segments;
+}
+
 template <typename T>
 std::pair<double, double> get_bounds(const std::shared_ptr<ngraph::Node>& fake_quantize) {
     auto fq = std::dynamic_pointer_cast<ngraph::opset8::FakeQuantize>(fake_quantize);
@@ -332,7 +389,7 @@ bool pwl_search(const std::shared_ptr<T>& node,
     double lower_bound = 0;
     double upper_bound = 0;
     std::tie(lower_bound, upper_bound) = get_bounds<T>(fake_quantize);
-    segments = pwl_search<T>(details::Function<T>(), lower_bound, upper_bound, allowed_err_pct, err_pct);
+    segments = cached_pwl_search<T>(details::Function<T>(), lower_bound, upper_bound, allowed_err_pct, err_pct);
     if (segments.size() <= 2) {
         return false;
     }
@@ -386,11 +443,12 @@ static bool pwl_search_power(const std::shared_ptr<ngraph::Node>& node,
         return true;
     }
 
-    segments = pwl_search<ngraph::opset8::Power>(details::Function<ngraph::opset8::Power>(exponent, scale, offset),
-                                                 lower_bound,
-                                                 upper_bound,
-                                                 allowed_err_pct > 0.015 ? 0.015 : allowed_err_pct,
-                                                 err_pct);
+    segments = cached_pwl_search<ngraph::opset8::Power>(
+        details::Function<ngraph::opset8::Power>(exponent, scale, offset),
+        lower_bound,
+        upper_bound,
+        allowed_err_pct > 0.015 ? 0.015 : allowed_err_pct,
+        err_pct);
     if (segments.size() <= 2) {
         return false;
     }
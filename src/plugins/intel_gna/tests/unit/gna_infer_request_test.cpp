@@ -7,6 +7,10 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <thread>
 #include <vector>
 
 #include "any_copy.hpp"
@@ -179,6 +183,49 @@ TEST_F(GNAInferRequestTest, start_async_wait_check_recovery_after_wait_error) {
     EXPECT_EQ(OK, request->Wait(0));
 }
 
+TEST_F(GNAInferRequestTest, start_async_with_callback) {
+    auto request = CreateRequest();
+    SetExpectOnEnqueue();
+    SetExpectOnWait();
+    std::promise<std::exception_ptr> callback_called;
+    request->SetCallback([&](std::exception_ptr exception) {
+        callback_called.set_value(exception);
+    });
+    EXPECT_NO_THROW(request->StartAsync());
+    EXPECT_EQ(OK, request->Wait(InferRequest::WaitMode::RESULT_READY));
+    EXPECT_EQ(nullptr, callback_called.get_future().get());
+}
+
+TEST_F(GNAInferRequestTest, start_async_with_callback_wait_returns_after_callback) {
+    auto request = CreateRequest();
+    SetExpectOnEnqueue();
+    SetExpectOnWait();
+    std::atomic<bool> callback_returned{false};
+    request->SetCallback([&](std::exception_ptr) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        callback_returned = true;
+    });
+    EXPECT_NO_THROW(request->StartAsync());
+    EXPECT_EQ(OK, request->Wait(InferRequest::WaitMode::RESULT_READY));
+    EXPECT_TRUE(callback_returned);
+    // the request is destroyed right after the wait, while the executor still holds the task
+    request.reset();
+}
+
+TEST_F(GNAInferRequestTest, start_async_with_callback_wait_error) {
+    auto request = CreateRequest();
+    SetExpectOnEnqueue();
+    SetExpectOnWait(Gna2StatusUnknownError);
+    std::promise<std::exception_ptr> callback_called;
+    request->SetCallback([&](std::exception_ptr exception) {
+        callback_called.set_value(exception);
+    });
+    EXPECT_NO_THROW(request->StartAsync());
+    EXPECT_THROW(request->Wait(InferRequest::WaitMode::RESULT_READY), std::exception);
+    EXPECT_NE(nullptr, callback_called.get_future().get());
+    EXPECT_EQ(INFER_NOT_STARTED, request->Wait(0));
+}
+
 TEST_F(GNAInferRequestTest, infer) {
     auto request = CreateRequest();
     SetExpectOnEnqueue();
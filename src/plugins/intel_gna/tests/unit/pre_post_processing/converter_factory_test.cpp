@@ -9,18 +9,24 @@
 
 using namespace ov::intel_gna::pre_post_processing;
 
+namespace {
+bool with_converter_isa() {
+    bool supported = false;
 #ifdef HAVE_AVX2
-TEST(ConverterFactoryTests, TestAvx2Supported) {
-    // if compiled with AVX2 support, must return valid converter when AVX2 available at runtime
-    if (InferenceEngine::with_cpu_x86_avx2()) {
+    supported |= InferenceEngine::with_cpu_x86_avx2();
+#endif  // HAVE_AVX2
+#ifdef HAVE_SSE42
+    supported |= InferenceEngine::with_cpu_x86_sse42();
+#endif  // HAVE_SSE42
+    return supported;
+}
+}  // namespace
+
+TEST(ConverterFactoryTests, TestConverterSupported) {
+    // must return valid converter if compiled with AVX2 or SSE4.2 support and it is available at runtime
+    if (with_converter_isa()) {
         EXPECT_NE(ConverterFactory::create_converter(), nullptr);
     } else {
         EXPECT_EQ(ConverterFactory::create_converter(), nullptr);
     }
 }
-#else
-TEST(ConverterFactoryTests, TestConverterFactoryReturnsNullptr) {
-    // if compiled without AVX2 support, ConverterFactory must return nullptr
-    EXPECT_EQ(ConverterFactory::create_converter(), nullptr);
-}
-#endif  // HAVE_AVX2
\ No newline at end of file
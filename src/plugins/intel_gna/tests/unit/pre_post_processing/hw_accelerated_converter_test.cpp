@@ -0,0 +1,130 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+#include <ie_system_conf.h>
+
+#include <memory>
+#include <vector>
+
+#include "common_test_utils/data_utils.hpp"
+#include "pre_post_process/data_conversion_helpers.hpp"
+#ifdef HAVE_AVX2
+#    include "pre_post_process/hw_accelerated_converter_avx2.hpp"
+#endif
+#ifdef HAVE_SSE42
+#    include "pre_post_process/hw_accelerated_converter_sse42.hpp"
+#endif
+
+using namespace ov::intel_gna::pre_post_processing;
+
+namespace testing {
+
+typedef std::tuple<size_t,  // number of rows
+                   size_t,  // number of columns
+                   bool     // transpose
+                   >
+    HwAcceleratedConverterParams;
+
+// Checks each of the converters compiled in against the scalar conversion, as the factory returns only the best one
+class HwAcceleratedConverterTest : public ::testing::TestWithParam<HwAcceleratedConverterParams> {
+public:
+    void SetUp() override {
+        std::tie(num_rows, num_columns, transpose) = GetParam();
+#ifdef HAVE_AVX2
+        if (InferenceEngine::with_cpu_x86_avx2()) {
+            converters.push_back(std::make_shared<HwAcceleratedDataConverterAvx>());
+        }
+#endif  // HAVE_AVX2
+#ifdef HAVE_SSE42
+        if (InferenceEngine::with_cpu_x86_sse42()) {
+            converters.push_back(std::make_shared<HwAcceleratedDataConverterSse42>());
+        }
+#endif  // HAVE_SSE42
+        if (converters.empty()) {
+            GTEST_SKIP() << "No accelerated converter is available";
+        }
+    }
+
+    size_t target_index(size_t index) const {
+        return transpose ? (index % num_columns) * num_rows + index / num_columns : index;
+    }
+
+protected:
+    size_t num_rows = 0;
+    size_t num_columns = 0;
+    bool transpose = false;
+    std::vector<std::shared_ptr<HwAcceleratedDataConverter>> converters;
+};
+
+TEST_P(HwAcceleratedConverterTest, Fp32ToInt16) {
+    const size_t size = num_rows * num_columns;
+    const float scale_factor = 8.0f;
+    std::vector<float> input(size);
+    ov::test::utils::fill_data_random(input.data(), size, 10000, -5000);
+    std::vector<int16_t> reference(size);
+    for (size_t i = 0; i < size; ++i) {
+        reference[target_index(i)] = FloatToInt<int16_t>(input[i] * scale_factor);
+    }
+    for (const auto& converter : converters) {
+        std::vector<int16_t> output(size);
+        converter->convert_matrix_fp32_to_int16_no_zero_padding(output.data(),
+                                                                input.data(),
+                                                                num_rows,
+                                                                num_columns,
+                                                                scale_factor,
+                                                                transpose);
+        EXPECT_EQ(reference, output);
+    }
+}
+
+TEST_P(HwAcceleratedConverterTest, Fp32ToInt8) {
+    const size_t size = num_rows * num_columns;
+    const float scale_factor = 4.0f;
+    std::vector<float> input(size);
+    ov::test::utils::fill_data_random(input.data(), size, 100, -50);
+    std::vector<int8_t> reference(size);
+    for (size_t i = 0; i < size; ++i) {
+        reference[target_index(i)] = FloatToInt<int8_t>(input[i] * scale_factor);
+    }
+    for (const auto& converter : converters) {
+        std::vector<int8_t> output(size);
+        converter->convert_matrix_fp32_to_int8_no_zero_padding(output.data(),
+                                                               input.data(),
+                                                               num_rows,
+                                                               num_columns,
+                                                               scale_factor,
+                                                               transpose);
+        EXPECT_EQ(reference, output);
+    }
+}
+
+TEST_P(HwAcceleratedConverterTest, Int16ToFp32) {
+    const size_t size = num_rows * num_columns;
+    const float scale_factor = 16.0f;
+    std::vector<int16_t> input(size);
+    ov::test::utils::fill_data_random(input.data(), size, 4000, -2000);
+    std::vector<float> reference(size);
+    for (size_t i = 0; i < size; ++i) {
+        reference[target_index(i)] = input[i] / scale_factor;
+    }
+    for (const auto& converter : converters) {
+        std::vector<float> output(size);
+        converter->convert_matrix_int16_to_fp32_no_zero_padding(output.data(),
+                                                                input.data(),
+                                                                num_rows,
+                                                                num_columns,
+                                                                scale_factor,
+                                                                transpose);
+        EXPECT_EQ(reference, output);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(HwAcceleratedConverterTestSuite,
+                         HwAcceleratedConverterTest,
+                         ::testing::Combine(::testing::Values(1, 3, 8),     // number of rows
+                                            ::testing::Values(5, 16, 33),  // number of columns
+                                            ::testing::Bool()));           // transpose
+
+}  // namespace testing
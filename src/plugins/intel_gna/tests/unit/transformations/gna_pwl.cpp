@@ -246,6 +246,13 @@ TEST(GnaPwlTest, Sigmoid) {
     test_instance.run();
 }
 
+TEST(GnaPwlTest, SigmoidSegmentsReused) {
+    for (double max_error_percent : {1.0, 1.0, 0.5}) {
+        GnaPWlTestsFixture<ngraph::opset9::Sigmoid> test_instance({1, 100}, -10.0, 10.0, max_error_percent);
+        test_instance.run();
+    }
+}
+
 TEST(GnaPwlTest, Tanh) {
     GnaPWlTestsFixture<ngraph::opset9::Tanh> test_instance({1, 32}, -5.0, 5.0, 1.0);
     test_instance.run();
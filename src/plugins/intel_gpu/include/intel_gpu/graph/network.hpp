@@ -17,6 +17,7 @@
 #include "intel_gpu/runtime/lru_cache.hpp"
 #include "intel_gpu/runtime/shape_predictor.hpp"
 
+#include <algorithm>
 #include <map>
 #include <vector>
 #include <unordered_map>
@@ -70,13 +71,16 @@ public:
         using Ptr = std::shared_ptr<VariableState>;
 
         VariableState(cldnn::memory_ptr mem = nullptr) :
-            memory { std::move(mem) }, is_set { false } {
+            memory { std::move(mem) }, is_set { false }, capacity { memory ? memory->get_layout().count() : 0 } {
         }
-        void set_memory(cldnn::memory_ptr new_mem) {
+        /// @brief Sets the state memory, capacity is the elements count of the underlying buffer if it is larger than the memory layout
+        void set_memory(cldnn::memory_ptr new_mem, size_t new_capacity = 0) {
             memory = new_mem;
+            capacity = std::max(new_capacity, memory ? memory->get_layout().count() : 0);
         }
         cldnn::memory_ptr memory;
         bool is_set;
+        size_t capacity;
     };
     using variables_states_map = std::map<std::string, VariableState::Ptr>;
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <map>
 #include <sstream>
 #include <stdexcept>
 #include <type_traits>
@@ -14,6 +15,7 @@
 
 namespace cldnn {
 struct memory;
+class kernels_cache;
 
 class BinaryOutputBuffer : public OutputBuffer<BinaryOutputBuffer> {
 public:
@@ -59,6 +61,15 @@ public:
         return _const_data_map[net_id][prim_id];
     }
 
+    // The kernels caches are keyed by their position in the stream, which is the same for all the networks loaded from it
+    void addKernelsCache(const std::streamoff pos, const std::shared_ptr<kernels_cache> cache) {
+        _kernels_cache_map[pos] = cache;
+    }
+    std::shared_ptr<kernels_cache> getKernelsCache(const std::streamoff pos) const {
+        auto it = _kernels_cache_map.find(pos);
+        return it != _kernels_cache_map.end() ? it->second : nullptr;
+    }
+
     std::streampos tellg() { return _stream.tellg(); }
     void seekg(std::streampos pos) { _stream.seekg(pos); }
 
@@ -66,6 +77,7 @@ private:
     std::istream& _stream;
     void* _impl_params;
     std::vector<std::unordered_map<std::string, std::shared_ptr<memory>>> _const_data_map;
+    std::map<std::streamoff, std::shared_ptr<kernels_cache>> _kernels_cache_map;
 };
 
 template <typename T>
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/core/node.hpp"
+#include "openvino/op/op.hpp"
+
+namespace ov {
+namespace intel_gpu {
+namespace op {
+
+/// \brief Computes softmax(scale * Q x K^T + attn_mask) x V for the rank 4 Q [B, H, L, D], K [B, H, S, D] and V [B, H, S, Dv]
+class ScaledDotProductAttention : public ov::op::Op {
+public:
+    OPENVINO_OP("ScaledDotProductAttention", "gpu_opset");
+
+    ScaledDotProductAttention() = default;
+
+    ScaledDotProductAttention(const ov::Output<Node>& Q,
+                              const ov::Output<Node>& K,
+                              const ov::Output<Node>& V,
+                              float scale,
+                              bool is_causal);
+
+    ScaledDotProductAttention(const ov::Output<Node>& Q,
+                              const ov::Output<Node>& K,
+                              const ov::Output<Node>& V,
+                              const ov::Output<Node>& attn_mask,
+                              float scale,
+                              bool is_causal);
+
+    bool visit_attributes(ov::AttributeVisitor &visitor) override;
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ov::OutputVector& new_args) const override;
+
+    float get_scale() const { return m_scale; }
+    bool get_causal() const { return m_is_causal; }
+
+protected:
+    float m_scale = 1.0f;
+    bool m_is_causal = false;
+};
+
+}   // namespace op
+}   // namespace intel_gpu
+}   // namespace ov
@@ -6,6 +6,7 @@
 
 #include "openvino/runtime/iasync_infer_request.hpp"
 #include "intel_gpu/plugin/sync_infer_request.hpp"
+#include "intel_gpu/plugin/requests_merger.hpp"
 #include <string>
 #include <map>
 
@@ -18,7 +19,8 @@ public:
     AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& infer_request,
                       const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                       const std::shared_ptr<ov::threading::ITaskExecutor>& wait_executor,
-                      const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor);
+                      const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+                      const RequestsMerger::Ptr& requests_merger = nullptr);
 
     ~AsyncInferRequest() override;
 
@@ -27,6 +29,8 @@ public:
 private:
     std::shared_ptr<SyncInferRequest> m_infer_request;
     std::shared_ptr<ov::threading::ITaskExecutor> m_wait_executor;
+    RequestsMerger::Ptr m_requests_merger;
+    std::future<void> m_merged_infer;
 };
 
 }  // namespace intel_gpu
@@ -22,6 +22,7 @@ enum class TensorType {
     BT_IMG_SHARED,
     BT_SURF_SHARED,
     BT_DX_BUF_SHARED,
+    BT_HOST_SHARED,
 };
 
 #define TensorValue(val) static_cast<cldnn::tensor::value_type>(val)
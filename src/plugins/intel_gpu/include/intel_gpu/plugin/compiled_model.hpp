@@ -8,12 +8,14 @@
 #include "intel_gpu/plugin/graph.hpp"
 #include "intel_gpu/plugin/plugin.hpp"
 #include "intel_gpu/plugin/remote_context.hpp"
+#include "intel_gpu/plugin/requests_merger.hpp"
 #include "intel_gpu/runtime/execution_config.hpp"
 
 #include <vector>
 #include <map>
 #include <set>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 
@@ -68,6 +70,9 @@ private:
     std::vector<ov::Output<const ov::Node>> m_outputs;
     std::vector<std::shared_ptr<Graph>> m_graphs;
     bool m_loaded_from_cache;
+    // Shared by the async requests of the model and released with the last of them
+    mutable std::weak_ptr<RequestsMerger> m_requests_merger;
+    mutable std::mutex m_requests_merger_mutex;
 };
 
 }  // namespace intel_gpu
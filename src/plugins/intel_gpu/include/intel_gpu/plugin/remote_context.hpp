@@ -23,6 +23,7 @@
 #include "intel_gpu/plugin/common_utils.hpp"
 
 #include <string>
+#include <list>
 #include <map>
 #include <memory>
 #include <atomic>
@@ -50,6 +51,14 @@ public:
     cldnn::memory::ptr try_get_cached_memory(size_t hash);
     void add_to_cache(size_t hash, cldnn::memory::ptr memory);
 
+    // The released memory of the internal remote tensors is kept up to the pool capacity and reused by the next
+    // tensors with the same layout and allocation type instead of the new driver allocations. Only the memory
+    // without the other owners is pooled, so it must be moved into return_to_pool
+    void set_memory_pool_capacity(size_t bytes);
+    size_t get_memory_pool_capacity() const;
+    cldnn::memory::ptr try_get_pooled_memory(const cldnn::layout& layout, cldnn::allocation_type type);
+    void return_to_pool(cldnn::memory::ptr memory);
+
 private:
     std::shared_ptr<RemoteContextImpl> get_this_shared_ptr();
 
@@ -72,6 +81,11 @@ private:
     cldnn::LruCache<size_t, cldnn::memory::ptr> m_memory_cache = cldnn::LruCache<size_t, cldnn::memory::ptr>(cache_capacity);
     std::mutex m_cache_mutex;
 
+    std::list<cldnn::memory::ptr> m_pooled_memory;
+    size_t m_pooled_bytes = 0;
+    size_t m_pool_capacity = 0;
+    mutable std::mutex m_pool_mutex;
+
     ov::AnyMap properties;
 };
 
@@ -76,6 +76,8 @@ private:
 
     bool is_shared() const;
     bool supports_caching() const;
+    bool supports_pooling() const;
+    cldnn::allocation_type get_allocation_type() const;
     void update_strides();
     void init_properties();
 };
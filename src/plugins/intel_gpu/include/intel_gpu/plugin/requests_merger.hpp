@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "intel_gpu/plugin/sync_infer_request.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ov {
+namespace intel_gpu {
+
+/// @brief Merges the concurrent inference requests of one compiled model with the dynamic batch dimension.
+/// The requests submitted within the merge timeout of the first one and having the same input shapes except the batch
+/// are concatenated along the batch, executed once by the shape agnostic kernels and the outputs are split back.
+class RequestsMerger {
+public:
+    using Ptr = std::shared_ptr<RequestsMerger>;
+
+    RequestsMerger(std::shared_ptr<SyncInferRequest> merged_request,
+                   std::shared_ptr<ov::threading::ITaskExecutor> task_executor,
+                   std::chrono::microseconds timeout);
+    ~RequestsMerger();
+
+    /// @brief Checks that every input and output of the model has the dynamic batch dimension which can be merged
+    static bool is_applicable(const std::vector<ov::Output<const ov::Node>>& inputs,
+                              const std::vector<ov::Output<const ov::Node>>& outputs);
+
+    void attach() { m_attached_requests++; }
+    void detach() { m_attached_requests--; }
+
+    /// @brief Queues the request, the returned future is ready when its outputs are written
+    std::future<void> submit(SyncInferRequest& request);
+
+private:
+    struct Job {
+        SyncInferRequest* request;
+        size_t batch;
+        std::chrono::steady_clock::time_point arrival;
+        std::promise<void> promise;
+    };
+
+    void run();
+    std::vector<std::shared_ptr<Job>> take_compatible_jobs();
+    bool is_mergeable(const SyncInferRequest& request, size_t& batch) const;
+    bool is_compatible(const SyncInferRequest& lhs, const SyncInferRequest& rhs) const;
+    bool infer_merged(const std::vector<std::shared_ptr<Job>>& jobs);
+    void infer_separately(const std::shared_ptr<Job>& job);
+
+    std::shared_ptr<SyncInferRequest> m_merged_request;
+    std::shared_ptr<ov::threading::ITaskExecutor> m_task_executor;
+    std::chrono::microseconds m_timeout;
+    std::vector<std::shared_ptr<ov::ITensor>> m_merged_inputs;
+
+    std::deque<std::shared_ptr<Job>> m_jobs;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::atomic<size_t> m_attached_requests{0};
+    // Cleared when the outputs of the model are found not to follow the batch of the inputs
+    std::atomic<bool> m_enabled{true};
+    bool m_stop = false;
+    std::thread m_worker;
+};
+
+}  // namespace intel_gpu
+}  // namespace ov
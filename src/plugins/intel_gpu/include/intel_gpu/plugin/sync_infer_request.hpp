@@ -76,6 +76,10 @@ private:
     std::shared_ptr<ov::threading::IStreamsExecutor> m_stream_executor = nullptr;
     bool m_enable_profiling = false;
     bool m_use_external_queue = false;
+    size_t m_kernels_profiling_interval = 0;
+    size_t m_infer_count = 0;
+    size_t m_request_id = 0;
+    bool m_profile_kernels = false;
 
     std::vector<cldnn::event::ptr> prepare_input(const std::string& name, const ov::Output<const ov::Node>& port, const TensorWrapper& user_tensor_wrapper);
     std::vector<cldnn::event::ptr> prepare_output(const std::string& name, const ov::Output<const ov::Node>& port, const TensorWrapper& user_tensor_wrapper);
@@ -101,6 +105,8 @@ private:
     void allocate_output(const ov::Output<const ov::Node>& port, const std::string& name);
     cldnn::event::ptr copy_output_data(cldnn::memory::ptr src, const ov::ITensor& dst) const;
 
+    void dump_kernels_profiling(const std::vector<cldnn::kernel_profiling_record>& records) const;
+
     void init_mappings(bool is_legacy_api);
     bool is_batched_input(const ov::Output<const ov::Node>& port) const;
 };
@@ -17,6 +17,7 @@ public:
     void reset() override;
     void set_state(const ov::SoPtr<ov::ITensor>& state) override;
     const ov::SoPtr<ov::ITensor>& get_state() const override;
+    void truncate(int64_t axis, size_t length) override;
 
 private:
     cldnn::network::VariableState::Ptr m_variable_state;
@@ -0,0 +1,77 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+#include "primitive.hpp"
+#include <vector>
+
+namespace cldnn {
+
+/// @brief Fused scaled dot product attention primitive.
+/// @details Computes softmax(scale * Q x K^T + mask) x V without materializing the scores matrix,
+///          Q(B,H,L,D) K(B,H,S,D) V(B,H,S,Dv) = Out(B,H,L,Dv)
+/// @n
+/// @n@b Requirements:
+/// @n - @c query, key, value - the rank 4 tensors with the same batch and heads number
+/// @n - @c optional: attention mask broadcastable to (B,H,L,S), added to the scaled scores
+struct scaled_dot_product_attention : public primitive_base<scaled_dot_product_attention> {
+    CLDNN_DECLARE_PRIMITIVE(scaled_dot_product_attention)
+
+    scaled_dot_product_attention() : primitive_base("", {}) {}
+
+    /// @brief Constructs scaled_dot_product_attention primitive.
+    /// @param id This primitive id.
+    /// @param inputs Query, key, value and the optional attention mask primitive ids.
+    /// @param scale Multiplier applied to the Q x K^T scores.
+    /// @param is_causal Masks out the keys following the query position.
+    scaled_dot_product_attention(const primitive_id& id,
+                                 const std::vector<input_info>& inputs,
+                                 const float scale,
+                                 const bool is_causal,
+                                 const padding& output_padding = padding())
+        : primitive_base(id, inputs, {output_padding}),
+          scale(scale),
+          is_causal(is_causal) {
+        if (inputs.size() != 3 && inputs.size() != 4) {
+            throw std::invalid_argument("Invalid inputs count - scaled_dot_product_attention expects either three or four inputs");
+        }
+    }
+
+    /// @brief Multiplier applied to the Q x K^T scores.
+    float scale = 1.0f;
+    /// @brief Masks out the keys following the query position.
+    bool is_causal = false;
+
+    bool has_attn_mask() const { return input_size() == 4; }
+
+    size_t hash() const override {
+        size_t seed = primitive::hash();
+        seed = hash_combine(seed, scale);
+        seed = hash_combine(seed, is_causal);
+        return seed;
+    }
+
+    bool operator==(const primitive& rhs) const override {
+        if (!compare_common_params(rhs))
+            return false;
+
+        auto rhs_casted = downcast<const scaled_dot_product_attention>(rhs);
+
+        return scale == rhs_casted.scale &&
+               is_causal == rhs_casted.is_causal;
+    }
+
+    void save(BinaryOutputBuffer& ob) const override {
+        primitive_base<scaled_dot_product_attention>::save(ob);
+        ob << scale;
+        ob << is_causal;
+    }
+
+    void load(BinaryInputBuffer& ib) override {
+        primitive_base<scaled_dot_product_attention>::load(ib);
+        ib >> scale;
+        ib >> is_causal;
+    }
+};
+}  // namespace cldnn
@@ -68,6 +68,14 @@ public:
     /// Create shared memory object using user-supplied 2D image @p img using specified @p layout
     memory_ptr share_image(const layout& layout, shared_handle img);
 
+    /// Create shared memory object accessing user host buffer @p host_ptr in place using specified @p layout
+    /// @note User is responsible for buffer deallocation. Buffer lifetime should be bigger than lifetime of the memory object.
+    memory_ptr share_host_memory(const layout& layout, void* host_ptr);
+
+    /// Checks if the host buffer of @p size bytes at @p host_ptr can be accessed by the device without copies, which requires
+    /// the memory shared with the host and the page aligned buffer
+    bool can_share_host_memory(const void* host_ptr, size_t size) const;
+
     /// Create shared memory object over specified @p plane of video decoder surface @p surf using specified @p layout
 #ifdef _WIN32
     memory_ptr share_surface(const layout& layout, shared_handle surf, uint32_t plane);
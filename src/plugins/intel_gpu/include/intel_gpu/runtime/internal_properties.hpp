@@ -56,6 +56,50 @@ static constexpr Property<size_t, PropertyMutability::RW> max_dynamic_batch{"DYN
 static constexpr Property<bool, PropertyMutability::RW> nv12_two_inputs{"GPU_NV12_TWO_INPUTS"};
 static constexpr Property<float, PropertyMutability::RW> buffers_preallocation_ratio{"GPU_BUFFERS_PREALLOCATION_RATIO"};
 
+/**
+ * @brief Path to the tuning cache file with the kernels selected for the device, the default cache next to the plugin library is used if empty
+ */
+static constexpr Property<std::string, PropertyMutability::RW> tuning_cache_path{"GPU_TUNING_CACHE_PATH"};
+
+/**
+ * @brief Allows the fp16 scaled dot product attention kernels to accumulate the scores and the softmax sums in fp16 instead of fp32
+ */
+static constexpr Property<bool, PropertyMutability::RW> sdpa_fp16_accumulation{"GPU_SDPA_FP16_ACCUMULATION"};
+
+/**
+ * @brief Time in microseconds the concurrent infer requests of a model with the dynamic batch wait to be merged into one execution,
+ * the requests are executed separately if 0
+ */
+static constexpr Property<size_t, PropertyMutability::RW> requests_merge_timeout{"GPU_REQUESTS_MERGE_TIMEOUT"};
+
+/**
+ * @brief Every Nth inference of each infer request records the device timestamps of its kernels and writes them to
+ * a Chrome trace file, the queue synchronization is not changed, the kernels are not profiled if 0
+ */
+static constexpr Property<size_t, PropertyMutability::RW> kernels_profiling_interval{"GPU_KERNELS_PROFILING_INTERVAL"};
+
+/**
+ * @brief Directory for the Chrome trace files of the sampled kernels profiling, the current directory is used if empty
+ */
+static constexpr Property<std::string, PropertyMutability::RW> kernels_profiling_path{"GPU_KERNELS_PROFILING_PATH"};
+
+/**
+ * @brief Size in bytes of the released internal remote tensors memory the remote context keeps for the new tensors
+ * with the same layout and allocation type, the memory is not pooled if 0
+ */
+static constexpr Property<size_t, PropertyMutability::RW> remote_tensors_pool_size{"GPU_REMOTE_TENSORS_POOL_SIZE"};
+
+/**
+ * @brief Keeps the quantized convolutions in fp16 when the reorders to and from their fp16 neighbours would cost more
+ * than the int8 execution saves, the precision of all the quantized layers follows the model if false
+ */
+static constexpr Property<bool, PropertyMutability::RW> plan_layers_precision{"GPU_PLAN_LAYERS_PRECISION"};
+
+/**
+ * @brief The number of the dynamic shape buffers reallocations made by the compiled model so far
+ */
+static constexpr Property<size_t, PropertyMutability::RO> buffers_reallocations_num{"GPU_BUFFERS_REALLOCATIONS_NUM"};
+
 }  // namespace intel_gpu
 }  // namespace ov
 
@@ -50,6 +50,29 @@ struct scalar_desc {
     ValueT v;
 };
 
+inline bool operator==(const scalar_desc& lhs, const scalar_desc& rhs) {
+    if (lhs.t != rhs.t)
+        return false;
+
+    switch (lhs.t) {
+        case scalar_desc::Types::UINT8: return lhs.v.u8 == rhs.v.u8;
+        case scalar_desc::Types::UINT16: return lhs.v.u16 == rhs.v.u16;
+        case scalar_desc::Types::UINT32: return lhs.v.u32 == rhs.v.u32;
+        case scalar_desc::Types::UINT64: return lhs.v.u64 == rhs.v.u64;
+        case scalar_desc::Types::INT8: return lhs.v.s8 == rhs.v.s8;
+        case scalar_desc::Types::INT16: return lhs.v.s16 == rhs.v.s16;
+        case scalar_desc::Types::INT32: return lhs.v.s32 == rhs.v.s32;
+        case scalar_desc::Types::INT64: return lhs.v.s64 == rhs.v.s64;
+        case scalar_desc::Types::FLOAT32: return lhs.v.f32 == rhs.v.f32;
+        case scalar_desc::Types::FLOAT64: return lhs.v.f64 == rhs.v.f64;
+        default: return false;
+    }
+}
+
+inline bool operator!=(const scalar_desc& lhs, const scalar_desc& rhs) {
+    return !(lhs == rhs);
+}
+
 using scalars_desc = std::vector<scalar_desc>;
 
 
@@ -114,6 +137,26 @@ struct kernel_arguments_data {
     const scalars_desc* scalars = nullptr;
 };
 
+/// @brief Checks if both arguments sets refer to the same memory objects, the scalars are not compared
+inline bool same_memory_arguments(const kernel_arguments_data& lhs, const kernel_arguments_data& rhs) {
+    return lhs.inputs == rhs.inputs &&
+           lhs.intermediates == rhs.intermediates &&
+           lhs.outputs == rhs.outputs &&
+           lhs.weights == rhs.weights &&
+           lhs.recurrent == rhs.recurrent &&
+           lhs.hidden == rhs.hidden &&
+           lhs.cell == rhs.cell &&
+           lhs.bias == rhs.bias &&
+           lhs.weights_zero_points == rhs.weights_zero_points &&
+           lhs.activations_zero_points == rhs.activations_zero_points &&
+           lhs.compensation == rhs.compensation &&
+           lhs.lookup_table == rhs.lookup_table &&
+           lhs.scale_table == rhs.scale_table &&
+           lhs.slope == rhs.slope &&
+           lhs.shape_info == rhs.shape_info &&
+           lhs.fused_op_inputs == rhs.fused_op_inputs;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // KernelString
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -71,6 +71,9 @@ struct memory {
 
     virtual event::ptr copy_from(stream& /* stream */, const memory& /* other */, bool blocking = true) = 0;
     virtual event::ptr copy_from(stream& /* stream */, const void* /* host_ptr */, bool blocking = true) = 0;
+    /// @brief Copies @p size bytes of the host buffer starting at @p src_offset to this memory starting at @p dst_offset
+    virtual event::ptr copy_from(stream& /* stream */, const void* /* host_ptr */, size_t /* src_offset */, size_t /* dst_offset */,
+                                 size_t /* size */, bool blocking = true) = 0;
 
     virtual event::ptr copy_to(stream& stream, memory& other, bool blocking = true) { return other.copy_from(stream, *this, blocking); }
     virtual event::ptr copy_to(stream& /* stream */, void* /* host_ptr */, bool blocking = true) = 0;
@@ -115,6 +118,10 @@ struct simple_attached_memory : memory {
     event::ptr copy_from(stream& /* stream */, const void* /* host_ptr */, bool /* blocking */) override {
         OPENVINO_THROW("[GPU] copy_from is not implemented for simple_attached_memory");
     }
+    event::ptr copy_from(stream& /* stream */, const void* /* host_ptr */, size_t /* src_offset */, size_t /* dst_offset */,
+                         size_t /* size */, bool /* blocking */) override {
+        OPENVINO_THROW("[GPU] copy_from is not implemented for simple_attached_memory");
+    }
     event::ptr copy_to(stream& /* stream */, memory& /* other */, bool /* blocking */) override {
         OPENVINO_THROW("[GPU] copy_to is not implemented for simple_attached_memory");
     }
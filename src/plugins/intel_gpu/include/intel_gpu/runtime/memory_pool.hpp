@@ -78,6 +78,8 @@ struct padded_pool_comparer {
 //         * no: goto 4
 //     4 take next (allocations are sorted in increasing order) allocation. if there is no more allocations, create new
 //     allocation otherwise go t
+//     5 the new allocations of dynamic shapes are rounded up to the power of two size class, so the record
+//     is reused by the following inferences with close shapes instead of growing the pool
 // - padded buffers - not implemented yet
 // - images 2d - not implemented yet
 // - images 2d arrays - not implemented yet
@@ -92,6 +94,7 @@ class memory_pool {
 
     memory_ptr alloc_memory(const layout& layout, allocation_type type, bool reset = true);
     static bool has_conflict(const memory_set&, const std::set<primitive_id>&, uint32_t network_id);
+    uint64_t get_size_class(uint64_t bytes_count) const;
 
     std::multimap<uint64_t, memory_record> _non_padded_pool;
     std::map<layout, std::list<memory_record>, padded_pool_comparer> _padded_pool;
@@ -107,14 +110,16 @@ public:
                           const std::set<primitive_id>& restrictions,
                           allocation_type type,
                           bool reusable = true,
-                          bool reset = true);  // get from pool or create memory allocation
+                          bool reset = true,
+                          bool is_dynamic = false);  // get from pool or create memory allocation
     memory_ptr get_memory(const layout& layout, allocation_type type, bool reset = true);
     memory_ptr get_from_non_padded_pool(const layout& layout,
                                         const primitive_id& id,
                                         uint32_t network_id,
                                         const std::set<primitive_id>&,
                                         allocation_type type,
-                                        bool reset = true);
+                                        bool reset = true,
+                                        bool is_dynamic = false);
     memory_ptr get_from_padded_pool(const layout& layout,
                                     const primitive_id& id,
                                     uint32_t network_id,
@@ -131,6 +136,12 @@ public:
         return _non_padded_pool.size();
     }
 
+    // the size of the pool record backing the memory, it exceeds the memory size when rounded up to the size class
+    size_t get_capacity(const memory& memory, uint32_t network_id) const;
+
+    // the number of records and the allocated bytes of each pool
+    std::map<std::string, uint64_t> get_statistics() const;
+
     void dump(uint32_t id);
 };
 
@@ -6,6 +6,7 @@
 
 #include "layout.hpp"
 
+#include <atomic>
 #include <deque>
 
 namespace cldnn {
@@ -17,7 +18,7 @@ public:
     ShapePredictor(const engine* engine, float buffers_preallocation_ratio)
         : _engine(engine)
         , _buffers_preallocation_ratio(buffers_preallocation_ratio) {
-        static_assert(_max_deque_size >= 2, "[GPU] Deque is supposed to contain at least 2 elements for prediction");
+        static_assert(_iterations_shapes_num >= 2, "[GPU] Deque is supposed to contain at least 2 elements for prediction");
     }
 
     ShapePredictor(const engine* engine,
@@ -30,7 +31,7 @@ public:
         , _max_per_iter_size(max_per_iter_size)
         , _max_per_dim_diff(max_per_dim_diff)
         , _buffers_preallocation_ratio(buffers_preallocation_ratio) {
-        static_assert(_max_deque_size >= 2, "[GPU] Deque is supposed to contain at least 2 elements for prediction");
+        static_assert(_iterations_shapes_num >= 2, "[GPU] Deque is supposed to contain at least 2 elements for prediction");
     }
 
 
@@ -40,8 +41,10 @@ public:
 ///        `_next_iters_preallocation_count` iterations, in case if per-iteration buffer size is less than
 ///        `_max_per_iter_size` and difference between shapes is less than `_max_per_dim_diff`; the second
 ///        operation mode is percentage preallocation - this mode can be configured with
-///        ov::intel_gpu::buffers_preallocation_ratio property, it increases buffer size by
-///        `_buffers_preallocation_ratio` value unconditionally.
+///        ov::intel_gpu::buffers_preallocation_ratio property, it increases by `_buffers_preallocation_ratio`
+///        the `_preallocation_quantile` of the buffer sizes seen among the last `_max_deque_size` iterations
+///        (or the current size if it is larger), so the alternating short and long shapes share one buffer.
+///        The quantile based size falls back to the current one if it doesn't fit the device memory.
 /// \param id Primitive id.
 /// \param current_shape Primitive's shape on current iteration.
 /// \param dt_size Primitive's data_type size.
@@ -54,20 +57,26 @@ public:
                                                            bool can_reuse_buffer);
     bool can_preallocate(size_t desired_buffer_size);
 
+    // the number of the predictions requested for the buffers that can't be reused, i.e. reallocations
+    size_t get_reallocations_num() const { return _reallocations_num; }
+
 private:
     void add_shape(const std::string& id, const ov::Shape& shape);
 
-    static constexpr size_t _max_deque_size = 3;
+    static constexpr size_t _max_deque_size = 32;
     std::map<std::string, std::deque<ov::Shape>> _shapes_info;
     const engine* _engine;
+    std::atomic<size_t> _reallocations_num{0};
 
     // Iterations mode preallocation
+    static constexpr size_t _iterations_shapes_num = 3;
     const size_t _next_iters_preallocation_count = 10;
     const size_t _max_per_iter_size = 16 * 1024; // 16KB => maximum preallocation size is 16KB * 10iters = 160KB
     const size_t _max_per_dim_diff = 2;
 
     // Percentage mode preallocation
     const float _buffers_preallocation_ratio = 1.0f;
+    const float _preallocation_quantile = 0.9f;
 };
 
 }  // namespace cldnn
@@ -10,6 +10,7 @@
 #include "execution_config.hpp"
 
 #include <memory>
+#include <string>
 #include <vector>
 
 #ifdef ENABLE_ONEDNN_FOR_GPU
@@ -18,6 +19,19 @@
 
 namespace cldnn {
 
+/// @brief Device execution of one kernel recorded by the stream
+struct kernel_profiling_record {
+    std::string layer_id;
+    std::string kernel_name;
+    std::vector<size_t> gws;
+    std::vector<size_t> lws;
+    /// @brief Total size of the memory bound to the kernel arguments
+    size_t memory_bytes;
+    /// @brief Device timestamps in nanoseconds
+    uint64_t start;
+    uint64_t end;
+};
+
 class stream {
 public:
     using ptr = std::shared_ptr<stream>;
@@ -41,6 +55,12 @@ public:
     virtual event::ptr create_user_event(bool set) = 0;
     virtual event::ptr create_base_event() = 0;
 
+    /// @brief Records the device timestamps of the kernels enqueued until stop_kernels_profiling() call
+    /// without changing the synchronization of the stream
+    virtual void start_kernels_profiling() {}
+    /// @brief Waits for the recorded kernels and returns their executions in the enqueue order
+    virtual std::vector<kernel_profiling_record> stop_kernels_profiling() { return {}; }
+
     QueueTypes get_queue_type() const { return queue_type; }
 
     static QueueTypes detect_queue_type(engine_types engine_type, void* queue_handle);
@@ -6,6 +6,8 @@
 #include <mutex>
 #include <atomic>
 #include <unordered_set>
+#include <unordered_map>
+#include <algorithm>
 #include <future>
 #include "intel_gpu/runtime/utils.hpp"
 
@@ -20,19 +22,29 @@ public:
         if (_stop_compilation)
             return;
 
-        auto promise = std::make_shared<std::promise<void>>();
-
         std::lock_guard<std::mutex> lock(_mutex);
-        futures.emplace_back(promise->get_future());
+        // the shape requested again before its compilation started gets the higher priority
+        auto pending_it = _pending_tasks.find(key);
+        if (pending_it != _pending_tasks.end()) {
+            pending_it->second.frequency++;
+            return;
+        }
 
-        if (_task_keys.find(key) == _task_keys.end()) {
-            _task_keys.insert(key);
-            if (_task_executor != nullptr) {
-                _task_executor->run([task, promise] {
-                    task();
-                    promise->set_value();
-                });
+        if (_task_keys.find(key) == _task_keys.end() && _task_executor != nullptr) {
+            // the least requested shape is dropped to keep the queue bounded, it's compiled again if requested later
+            if (_pending_tasks.size() >= _max_pending_tasks) {
+                auto least_requested = find_most_requested(false);
+                _task_keys.erase(least_requested->first);
+                _pending_tasks.erase(least_requested);
             }
+
+            auto promise = std::make_shared<std::promise<void>>();
+            futures.emplace_back(promise->get_future());
+            _task_keys.insert(key);
+            _pending_tasks.emplace(key, PendingTask{std::move(task), promise, 1});
+            _task_executor->run([this] {
+                run_most_requested_task();
+            });
         }
     }
 
@@ -60,12 +72,15 @@ public:
             return;
 
         _stop_compilation = true;
+        std::shared_ptr<ov::threading::IStreamsExecutor> task_executor;
         {
             std::lock_guard<std::mutex> lock(_mutex);
-            if (_task_executor != nullptr)
-                _task_executor.reset();
+            task_executor = std::move(_task_executor);
             _task_keys.clear();
+            _pending_tasks.clear();
         }
+        // the executor is joined out of the lock, since its queued jobs take it to pick the pending task
+        task_executor.reset();
     }
 
     void wait_all() override {
@@ -75,12 +90,43 @@ public:
     }
 
 private:
+    struct PendingTask {
+        Task task;
+        std::shared_ptr<std::promise<void>> promise;
+        size_t frequency;
+    };
+    using PendingTasks = std::unordered_map<kernel_impl_params, PendingTask, kernel_impl_params::Hasher>;
+
+    PendingTasks::iterator find_most_requested(bool most) {
+        return std::max_element(_pending_tasks.begin(), _pending_tasks.end(),
+                                [most](const PendingTasks::value_type& a, const PendingTasks::value_type& b) {
+                                    return most ? a.second.frequency < b.second.frequency : a.second.frequency > b.second.frequency;
+                                });
+    }
+
+    // each executor job compiles the most requested of the pending shapes rather than the one it was created for
+    void run_most_requested_task() {
+        PendingTask pending_task;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (_pending_tasks.empty())
+                return;
+            auto most_requested = find_most_requested(true);
+            pending_task = std::move(most_requested->second);
+            _pending_tasks.erase(most_requested);
+        }
+        pending_task.task();
+        pending_task.promise->set_value();
+    }
+
+    static constexpr size_t _max_pending_tasks = 100;
     ov::threading::IStreamsExecutor::Config _task_executor_config;
     std::shared_ptr<ov::threading::IStreamsExecutor> _task_executor;
     std::mutex _mutex;
     std::unordered_set<kernel_impl_params, kernel_impl_params::Hasher> _task_keys;
     std::atomic_bool _stop_compilation{false};
     std::vector<std::future<void>> futures;
+    PendingTasks _pending_tasks;
 };
 
 std::unique_ptr<ICompilationContext> ICompilationContext::create(ov::threading::IStreamsExecutor::Config task_executor_config) {
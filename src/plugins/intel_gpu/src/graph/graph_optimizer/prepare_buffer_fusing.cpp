@@ -16,6 +16,7 @@
 #include "non_max_suppression_inst.h"
 #include "experimental_detectron_roi_feature_extractor_inst.hpp"
 #include "border_inst.h"
+#include "gemm_inst.h"
 
 #include "pass_manager.h"
 #include "program_helpers.h"
@@ -323,6 +324,63 @@ void concat_in_place_optimization::update_in_place_concat_paddings(
         lower_padd[concat_axis_legacy] += input_length;
     }
 }
+
+bool crop_in_place_optimization::match(const crop_node& node) {
+    GPU_DEBUG_GET_INSTANCE(debug_config);
+    GPU_DEBUG_IF(debug_config->disable_runtime_buffer_fusing) {
+        return false;
+    }
+    if (!node.is_dynamic() || node.is_output() || node.has_fused_primitives() || node.is_in_shape_of_subgraph() ||
+        node.is_constant() || node.get_users().empty())
+        return false;
+
+    const auto& input = node.get_dependency(0);
+    const auto& input_layout = input.get_output_layout();
+    if (input.is_constant() || input_layout.data_padding || input_layout.data_padding.get_dynamic_pad_dims() != tensor(0) ||
+        !format::is_default_format(input_layout.format) || !format::is_default_format(node.get_output_layout().format))
+        return false;
+
+    // the users read the crop through the dynamic padding of their input
+    for (auto user : node.get_users()) {
+        if (!user->is_type<eltwise>() && !user->is_type<activation>() && !user->is_type<reorder>() &&
+            !user->is_type<permute>() && !user->is_type<gemm>())
+            return false;
+        if (user->get_preferred_impl_type() == impl_types::onednn)
+            return false;
+    }
+    return true;
+}
+
+bool crop_in_place_optimization::match(const program_node& node, const kernel_impl_params& crop_params) {
+    if (!node.is_type<crop>() || !node.can_be_optimized() || crop_params.input_offsets.empty())
+        return false;
+
+    const auto& input_layout = crop_params.get_input_layout(0);
+    const auto& crop_layout = crop_params.get_output_layout();
+    if (input_layout.is_dynamic() || crop_layout.is_dynamic() || input_layout.data_padding)
+        return false;
+
+    // the crop must be inside the input, what is expressed by the non negative paddings
+    const auto& offsets = crop_params.input_offsets[0];
+    const auto upper = input_layout.get_tensor() - crop_layout.get_tensor() - offsets;
+    const auto is_negative = [](tensor::value_type size) { return size < 0; };
+    return std::none_of(offsets.raw.begin(), offsets.raw.end(), is_negative) &&
+           std::none_of(upper.raw.begin(), upper.raw.end(), is_negative);
+}
+
+void crop_in_place_optimization::optimize(crop_node& node) {
+    auto crop_layout = node.get_output_layout();
+    // the cropped axis is known only with the actual offsets
+    crop_layout.data_padding.set_dynamic_pad(tensor(1));
+    node.set_output_layout(crop_layout);
+    node.get_dependency(0).can_share_buffer(false);
+    node.can_be_optimized(true);
+}
+
+void crop_in_place_optimization::update_in_place_crop_padding(layout& crop_layout, const layout& input_layout, const tensor& offsets) {
+    const auto upper = input_layout.get_tensor() - crop_layout.get_tensor() - offsets;
+    crop_layout.data_padding = padding(offsets.sizes(), upper.sizes(), 0.f, crop_layout.data_padding.get_dynamic_pad_dims());
+}
 }  // namespace cldnn
 
 static bool can_reshape_be_optimized(const reshape_node& node) {
@@ -453,6 +511,14 @@ void prepare_buffer_fusing::run(program& p) {
         if (!node->is_valid_output_layout())
             continue;
 
+        // in-place crop of the dynamic shape is done at runtime
+        if (node->is_type<crop>() && node->is_dynamic()) {
+            auto& crop_node = node->as<crop>();
+            if (crop_in_place_optimization::match(crop_node))
+                crop_in_place_optimization::optimize(crop_node);
+            continue;
+        }
+
         if (!can_optimize(node))
             continue;
 
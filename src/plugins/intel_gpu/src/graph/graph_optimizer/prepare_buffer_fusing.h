@@ -6,6 +6,7 @@
 #include "program_helpers.h"
 
 #include "concatenation_inst.h"
+#include "crop_inst.h"
 
 #include <utility>
 #include <list>
@@ -59,4 +60,15 @@ struct concat_in_place_optimization : pattern_match_optimization_typed<concat_in
     }
 };
 
+struct crop_in_place_optimization {
+    // Performs in-place crop optimization of the dynamic shape crops.
+    // The output of the crop gets the dynamic padding, so its users are built with the shape agnostic kernels
+    // which read the padding at runtime. Then the crop reuses the input buffer with the padding given by the actual
+    // offsets and doesn't execute its kernel, unless the runtime check fails.
+    static bool match(const crop_node& node);
+    static bool match(const program_node& node, const kernel_impl_params& crop_params);
+    static void optimize(crop_node& node);
+    static void update_in_place_crop_padding(layout& crop_layout, const layout& input_layout, const tensor& offsets);
+};
+
 } // namespace cldnn
\ No newline at end of file
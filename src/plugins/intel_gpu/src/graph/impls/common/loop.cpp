@@ -92,17 +92,20 @@ struct loop_impl : typed_primitive_impl<loop> {
         const auto& concatenated_output_mem_mappings = instance.concatenated_output_mem_mappings;
 
         // If there are concatenated_output_mem_mappings or backedge_memory_mappings we need to wait for
-        // previous tasks before accessing memory in get_sliced_mem() and setup_iteration() functions
+        // previous tasks before accessing memory in slice_mem() and setup_iteration() functions
         if (!concatenated_input_mem_mappings.empty() || !instance.backedge_memory_mappings.empty()) {
             for (auto& e : events) {
                 e->wait();
             }
         }
 
-        // Set sliced input data
+        // Slice the inputs of all the iterations before the first one is enqueued, so the body networks
+        // of the iterations are enqueued one after another without waiting
         for (size_t i = 0; i < concatenated_input_mem_mappings.size(); ++i) {
             const auto& concatenated_input = concatenated_input_mem_mappings.at(i);
-            memory::ptr mem = concatenated_input.get_sliced_mem(0);
+            const auto num_sliced = std::min<int64_t>(std::max<int64_t>(trip_count, 1), concatenated_input.sliced_mems.size());
+            concatenated_input.slice_mem(num_sliced);
+            memory::ptr mem = concatenated_input.sliced_mems.at(0);
             if (mem) {
                 body_network->set_input_data(concatenated_input.sliced_data_prim->id(), mem);
             } else {
@@ -117,7 +120,7 @@ struct loop_impl : typed_primitive_impl<loop> {
             // Copy & Set sliced input memory
             for (size_t i = 0; i < concatenated_input_mem_mappings.size(); ++i) {
                 const auto& concatenated_input = concatenated_input_mem_mappings.at(i);
-                memory::ptr mem = concatenated_input.get_sliced_mem(current_iteration_idx);
+                memory::ptr mem = concatenated_input.sliced_mems.at(current_iteration_idx);
                 if (mem) {
                     concatenated_input.sliced_data_prim->set_output_memory(mem);
                 } else {
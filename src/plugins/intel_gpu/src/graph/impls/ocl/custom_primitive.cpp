@@ -72,6 +72,10 @@ struct custom_gpu_primitive_impl : typed_primitive_impl<custom_gpu_primitive> {
         _cached_kernel_id = kernels_cache.get_cached_kernel_id(_kernels[0]);
     }
 
+    std::vector<std::string> get_cached_kernel_ids() const override {
+        return {_cached_kernel_id};
+    }
+
     void set_arguments_impl(custom_gpu_primitive_inst& instance) override {
         auto& stream = instance.get_network().get_stream();
         kernel_arguments_data args;
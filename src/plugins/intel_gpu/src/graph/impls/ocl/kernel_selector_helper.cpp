@@ -46,6 +46,7 @@
 #include "runtime/kernels_cache.hpp"
 #include "kernel_base.h"
 
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -1304,6 +1305,9 @@ void set_params(const kernel_impl_params& param_info, kernel_selector::params& p
     params.engineInfo.maxThreadsPerExecutionUnit = device_info.num_threads_per_eu > 0 ? device_info.num_threads_per_eu : 7;
     params.engineInfo.maxThreadsPerDevice = params.engineInfo.maxThreadsPerExecutionUnit * device_info.execution_units_count;
     params.engineInfo.driverVersion = device_info.driver_version;
+    std::stringstream device_id;
+    device_id << "0x" << std::hex << device_info.device_id;
+    params.engineInfo.deviceId = device_id.str();
     params.engineInfo.supportedSimdSizes = device_info.supported_simd_sizes;
     params.engineInfo.vendor_id = device_info.vendor_id;
 
@@ -1428,6 +1432,7 @@ void set_optional_params(const program& program, kernel_selector::optional_param
                                         program.get_config().get_property(ov::intel_gpu::allow_static_input_reorder);
     params.allowInputReordering = false;
     params.allowOutputReordering = false;
+    params.tuningCachePath = program.get_config().get_property(ov::intel_gpu::tuning_cache_path);
 }
 
 }  // namespace cldnn
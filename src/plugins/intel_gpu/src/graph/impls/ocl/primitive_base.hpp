@@ -18,6 +18,7 @@
 #include "register.hpp"
 #include "implementation_map.hpp"
 #include "concatenation_inst.h"
+#include "crop_inst.h"
 
 #include <vector>
 #include <list>
@@ -39,6 +40,14 @@ struct typed_primitive_impl_ocl : public typed_primitive_impl<PType> {
     // a pair of batch program hash and kernel entry hash of each ocl impl.
     std::pair<std::string, std::string> kernel_dump_info;
 
+    // The arguments last set to each kernel, so the unchanged buffers and scalars are not set to the kernels again on each execution.
+    // They are not copied with the impl as the kernels are cloned.
+    struct kernel_arguments_snapshot {
+        kernel_arguments_data args;
+        scalars_desc scalars;
+    };
+    std::vector<kernel_arguments_snapshot> _arguments_snapshots;
+
     typed_primitive_impl_ocl() : _kernel_data({}), _cached_kernel_ids({}), _kernels({}) {}
 
     typed_primitive_impl_ocl(const typed_primitive_impl_ocl<PType>& other)
@@ -80,8 +89,9 @@ struct typed_primitive_impl_ocl : public typed_primitive_impl<PType> {
 
     template<typename ImplType>
     static std::unique_ptr<primitive_impl> create(const typed_program_node<PType>& arg, const kernel_impl_params& impl_param) {
-        // concat buffer fusing for dynamic shape is adaptively applied at runtime. So we need to build dynamic impl at build time.
-        if (impl_param.can_be_optimized() && !(impl_param.is_type<concatenation>() && impl_param.is_dynamic())) {
+        // concat and crop buffer fusing for dynamic shape is adaptively applied at runtime. So we need to build dynamic impl at build time.
+        if (impl_param.can_be_optimized() &&
+            !((impl_param.is_type<concatenation>() || impl_param.is_type<crop>()) && impl_param.is_dynamic())) {
             return make_unique<ImplType>(kernel_selector::kernel_data{});
         }
         auto kernel_params = ImplType::get_kernel_params(ImplType::static_canonicalize_shapes(impl_param));
@@ -137,6 +147,7 @@ protected:
         }
 
         _kernels.clear();
+        _arguments_snapshots.clear();
         if (!_kernel_data.kernels.empty()) {
             auto compiled_kernels = kernels_cache.get_kernels(params);
             _kernels.insert(_kernels.begin(), compiled_kernels.begin(), compiled_kernels.end());
@@ -151,6 +162,7 @@ protected:
             return;
         }
         _kernels.clear();
+        _arguments_snapshots.clear();
 
         _kernels.reserve(_cached_kernel_ids.size());
         for (size_t k = 0; k < _cached_kernel_ids.size(); ++k) {
@@ -162,6 +174,10 @@ protected:
         _cached_kernel_ids = kernels_cache.get_cached_kernel_ids(_kernels);
     }
 
+    std::vector<std::string> get_cached_kernel_ids() const override {
+        return is_cpu() ? std::vector<std::string>{} : _cached_kernel_ids;
+    }
+
     std::vector<kernel::ptr> get_kernels() const override {
         return _kernels;
     }
@@ -192,19 +208,29 @@ protected:
                                                                         "[GPU] Likely some issue with empty tensor handling happened");
 
         stream& stream = instance.get_network().get_stream();
+        auto args = get_arguments(instance);
+        for (const auto& m : instance.get_intermediates_memories()) {
+            args.intermediates.push_back(m);
+        }
+
+        _arguments_snapshots.resize(_kernels.size());
         for (size_t kd_idx = 0; kd_idx < _kernel_data.kernels.size(); ++kd_idx) {
             if (_kernel_data.kernels[kd_idx].skip_execution) {
                 continue;
             }
 
-            auto args = get_arguments(instance);
-            args.scalars = &_kernel_data.kernels[kd_idx].params.scalars;
-
-            for (const auto& m : instance.get_intermediates_memories()) {
-                args.intermediates.push_back(m);
+            const auto& params = _kernel_data.kernels[kd_idx].params;
+            auto& snapshot = _arguments_snapshots[kd_idx];
+            if (snapshot.args.scalars != nullptr && same_memory_arguments(snapshot.args, args) && snapshot.scalars == params.scalars) {
+                continue;
             }
 
-            stream.set_arguments(*_kernels[kd_idx], _kernel_data.kernels[kd_idx].params, args);
+            args.scalars = &params.scalars;
+            stream.set_arguments(*_kernels[kd_idx], params, args);
+
+            snapshot.args = args;
+            snapshot.scalars = params.scalars;
+            snapshot.args.scalars = &snapshot.scalars;
         }
     }
 
@@ -215,6 +241,8 @@ protected:
 
         stream& stream = instance.get_network().get_stream();
 
+        // The arguments set by the caller are not tracked
+        _arguments_snapshots.clear();
         for (size_t k = 0; k < _kernels.size(); ++k) {
             if (_kernel_data.kernels[k].skip_execution)
                 continue;
@@ -251,22 +279,23 @@ protected:
                                                                         "[GPU] Compiled kernels count: ", _kernels.size(), "\n",
                                                                         "[GPU] KernelData count: ", _kernel_data.kernels.size(), "\n",
                                                                         "[GPU] Likely some issue with empty tensor handling happened");
+        // If any user of the prim's users is CPU implementation or network's output, set prim as a output event (event won't be nullptr)
+        const bool needs_completion_event = instance.needs_completion_event();
+
+        // The arguments are the same for all the kernels except for the scalars
+        auto args = get_arguments(instance);
+        for (const auto& m : instance.get_intermediates_memories()) {
+            args.intermediates.push_back(m);
+        }
+
         for (size_t kd_idx = 0; kd_idx < _kernel_data.kernels.size(); ++kd_idx) {
             if (_kernel_data.kernels[kd_idx].skip_execution)
                 continue;
             std::vector<event::ptr> new_events;
 
-            // If any user of the prim's users is CPU implementation or network's output, set prim as a output event (event won't be nullptr)
-            bool needs_completion_event = instance.needs_completion_event();
-
             auto& params = _kernel_data.kernels[kd_idx].params;
-            auto args = get_arguments(instance);
             args.scalars = &params.scalars;
 
-            for (const auto& m : instance.get_intermediates_memories()) {
-                args.intermediates.push_back(m);
-            }
-
             const auto& gws = params.workGroups.global;
             const auto& lws = params.workGroups.local;
 
@@ -308,6 +337,7 @@ protected:
         OPENVINO_ASSERT(kernels.size() == 1, "Only the kernels of the single primitive should be allowed.");
         auto& kernel_vec = kernels.begin()->second;
         _kernels.clear();
+        _arguments_snapshots.clear();
         _kernels.resize(kernel_vec.size());
         for (auto& k : kernel_vec) {
             auto sub_kernel_idx = k.second;
@@ -67,6 +67,7 @@ void register_implementations() {
     REGISTER_OCL(roi_align);
     REGISTER_OCL(roi_pooling);
     REGISTER_OCL(roll);
+    REGISTER_OCL(scaled_dot_product_attention);
     REGISTER_OCL(scatter_update);
     REGISTER_OCL(scatter_nd_update);
     REGISTER_OCL(scatter_elements_update);
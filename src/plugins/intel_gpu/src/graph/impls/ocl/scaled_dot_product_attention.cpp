@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "primitive_base.hpp"
+
+#include "scaled_dot_product_attention_inst.h"
+#include "sdpa/sdpa_kernel_selector.h"
+#include "sdpa/sdpa_kernel_base.h"
+
+namespace cldnn {
+namespace ocl {
+
+struct scaled_dot_product_attention_impl : typed_primitive_impl_ocl<scaled_dot_product_attention> {
+    using parent = typed_primitive_impl_ocl<scaled_dot_product_attention>;
+    using parent::parent;
+    using kernel_selector_t = kernel_selector::sdpa_kernel_selector;
+    using kernel_params_t = std::pair<kernel_selector::sdpa_params, kernel_selector::sdpa_optional_params>;
+
+    DECLARE_OBJECT_TYPE_SERIALIZATION(cldnn::ocl::scaled_dot_product_attention_impl)
+
+    std::unique_ptr<primitive_impl> clone() const override {
+        return make_unique<scaled_dot_product_attention_impl>(*this);
+    }
+
+    static kernel_params_t get_kernel_params(const kernel_impl_params& impl_param, bool is_shape_agnostic = false) {
+        const auto& primitive = impl_param.typed_desc<scaled_dot_product_attention>();
+        auto params = get_default_params<kernel_selector::sdpa_params>(impl_param, is_shape_agnostic);
+        for (size_t i = 1; i < impl_param.input_layouts.size(); i++)
+            params.inputs.push_back(convert_data_tensor(impl_param.get_input_layout(i)));
+        auto optional_params = get_default_optional_params<kernel_selector::sdpa_optional_params>(impl_param.get_program());
+
+        params.scale = primitive->scale;
+        params.is_causal = primitive->is_causal;
+        params.fp16_accumulation = impl_param.get_program().get_config().get_property(ov::intel_gpu::sdpa_fp16_accumulation);
+
+        return {params, optional_params};
+    }
+
+    void update_dispatch_data(const kernel_impl_params& impl_param) override {
+        auto kernel_params = get_kernel_params(impl_param, true);
+        (_kernel_data.update_dispatch_data_func)(kernel_params.first, _kernel_data);
+    }
+};
+
+namespace detail {
+
+attach_scaled_dot_product_attention_impl::attach_scaled_dot_product_attention_impl() {
+    auto types = {
+        data_types::f32,
+        data_types::f16,
+    };
+
+    auto formats = {
+        format::bfyx,
+    };
+
+    implementation_map<scaled_dot_product_attention>::add(impl_types::ocl,
+                                                          shape_types::any,
+                                                          typed_primitive_impl_ocl<scaled_dot_product_attention>::create<scaled_dot_product_attention_impl>,
+                                                          types,
+                                                          formats);
+}
+
+}  // namespace detail
+}  // namespace ocl
+}  // namespace cldnn
+
+BIND_BINARY_BUFFER_WITH_TYPE(cldnn::ocl::scaled_dot_product_attention_impl)
+BIND_BINARY_BUFFER_WITH_TYPE(cldnn::scaled_dot_product_attention)
@@ -458,11 +458,11 @@ private:
             mem_lock<uint8_t> concat_mem_lock{ concatenated_mem, stream };
             int64_t iteration_offset = bytes_iteration_initial_offset;
             for (const auto& sliced_mem : sliced_mems) {
+                mem_lock<uint8_t, mem_lock_type::read> sliced_mem_lock{ sliced_mem, stream };
                 for (int64_t batch = 0; batch < batch_size; ++batch) {
                     const int64_t src_offset = batch * bytes_iteration;
                     const int64_t dst_offset = batch * bytes_batch_stride + iteration_offset;
-                    mem_lock<uint8_t> sliced_mem_lock{ sliced_mem, stream };
-                    uint8_t* src = sliced_mem_lock.data() + src_offset;
+                    const uint8_t* src = sliced_mem_lock.data() + src_offset;
                     uint8_t* dst = concat_mem_lock.data() + dst_offset;
                     std::copy(src, src + bytes_iteration, dst);
                 }
@@ -492,6 +492,21 @@ private:
             return sliced_mems.at(iteration);
         }
 
+        // Copies the slices of the first num_iterations iterations at once. Each lock of the memory waits for
+        // the commands enqueued before, so the slicing inside the iterations would wait for the previous ones.
+        void slice_mem(int64_t num_iterations) const {
+            mem_lock<uint8_t, mem_lock_type::read> from_lock{ concatenated_mem, stream };
+            for (int64_t iteration = 0; iteration < num_iterations; ++iteration) {
+                mem_lock<uint8_t, mem_lock_type::write> to_lock{ sliced_mems.at(iteration), stream };
+                const int64_t iteration_offset = bytes_iteration_initial_offset + bytes_iteration_stride * iteration;
+                for (int64_t batch = 0; batch < batch_size; ++batch) {
+                    const auto src = from_lock.begin() + batch * bytes_batch_stride + iteration_offset;
+                    const auto dst = to_lock.begin() + batch * bytes_iteration;
+                    std::copy(src, src + bytes_iteration, dst);
+                }
+            }
+        }
+
         const int64_t axis;
         std::shared_ptr<primitive_inst> concat_data_prim;
         std::shared_ptr<primitive_inst> sliced_data_prim;
@@ -66,6 +66,7 @@ struct primitive_impl {
     virtual void init_kernels(const kernels_cache& kernels_cache, const kernel_impl_params& params) = 0;
     virtual void init_by_cached_kernels(const kernels_cache&) {}
     virtual void set_cached_kernel_ids(const kernels_cache&) {}
+    virtual std::vector<std::string> get_cached_kernel_ids() const { return {}; }
     virtual std::unique_ptr<primitive_impl> clone() const = 0;
     virtual std::vector<std::shared_ptr<cldnn::kernel_string>> get_kernels_source() { return {}; }
     virtual void reset_kernels_source() {}
@@ -146,8 +147,8 @@ public:
         return true;
     }
     primitive_type_id type() const { return _type; }
-    primitive_id id() const { return _id; }
-    primitive_id org_id() const { return _org_id; }
+    const primitive_id& id() const { return _id; }
+    const primitive_id& org_id() const { return _org_id; }
     bool can_be_optimized() const { return _can_be_optimized; }
     void set_can_be_optimized(bool optimized) {
         // TODO: consolidate to _impl_param in the future
@@ -198,6 +199,10 @@ public:
         _impl->init_by_cached_kernels(kernels_cache);
     }
 
+    std::vector<std::string> get_cached_kernel_ids() const {
+        return _impl->get_cached_kernel_ids();
+    }
+
     void set_arguments();
 
     void validate() const {
@@ -213,6 +218,7 @@ public:
     void build_deps();
     void do_runtime_skip_reorder();
     void do_runtime_in_place_concat();
+    void do_runtime_in_place_crop();
     void configure_shape_of_dependencies();
 
     memory::ptr fused_memory(size_t dep_id) const {
@@ -417,8 +417,10 @@ network::network(cldnn::BinaryInputBuffer& ib, const ExecutionConfig& config, st
                                                   mem_preallocation_params.buffers_preallocation_ratio));
     }
 
-    kernels_cache kernels_cache(get_engine(), config, 0, nullptr, {""});
-    ib >> kernels_cache;
+    const std::streamoff kernels_cache_pos = ib.tellg();
+    auto kernels_cache = std::make_shared<cldnn::kernels_cache>(get_engine(), config, 0, program::make_task_executor(config),
+                                                                std::vector<std::string>{""});
+    ib >> *kernels_cache;
 
     int num_data_nodes;
     ib >> num_data_nodes;
@@ -446,11 +448,28 @@ network::network(cldnn::BinaryInputBuffer& ib, const ExecutionConfig& config, st
     _outputs.clear();
     _output_chains.clear();
 
+    std::vector<std::string> cached_kernel_ids;
     for (const auto& p_inst : insts_to_allocate) {
         ib >> *p_inst;
         _primitives[p_inst->id()] = p_inst;
+        if (p_inst->get_impl() != nullptr) {
+            auto ids = p_inst->get_cached_kernel_ids();
+            cached_kernel_ids.insert(cached_kernel_ids.end(), ids.begin(), ids.end());
+        }
+    }
+
+    // Only the binaries of the kernels used by the network are built, once for all the streams:
+    // the secondary streams clone their kernels from the programs built by the primary one
+    auto primary_kernels_cache = ib.getKernelsCache(kernels_cache_pos);
+    if (!is_primary_stream && primary_kernels_cache) {
+        kernels_cache = primary_kernels_cache;
+    } else {
+        kernels_cache->build_cached_kernels(cached_kernel_ids);
+        ib.addKernelsCache(kernels_cache_pos, kernels_cache);
+    }
+    for (const auto& p_inst : insts_to_allocate) {
         if (p_inst->get_impl() != nullptr)
-            p_inst->init_by_cached_kernels(kernels_cache);
+            p_inst->init_by_cached_kernels(*kernels_cache);
     }
 
     std::vector<primitive_id> exec_order_ids;
@@ -1566,7 +1585,7 @@ void network::execute_primitive(const std::shared_ptr<primitive_inst>& primitive
     // 2) Profiling mode is enabled
     // 3) Primitive has CPU user or primitive is output
     if (get_stream().get_queue_type() == QueueTypes::out_of_order || _enable_profiling || primitive->needs_completion_event()) {
-        auto id = primitive->id();
+        const auto& id = primitive->id();
         _events.insert({id, ev});
     }
 }
@@ -1694,15 +1713,32 @@ void network::assign_variables_memories() {
 
 void network::update_variable_memory(const std::string& variable_id, const cldnn::layout& layout) {
     auto it = _variables_states.find(variable_id);
+    const bool can_reuse = it != _variables_states.end() && it->second->memory && layout.count() <= it->second->capacity;
+
+    // The growing states (e.g. the KV-cache extended by every generated token) are allocated ahead of the predicted
+    // sizes, so the following iterations reinterpret the same buffer instead of reallocating it. Only the reallocations
+    // are recorded, since read_value and assign of the same variable update it with the previous and the new shapes
+    auto alloc_layout = layout;
+    if (!can_reuse && format::is_simple_data_format(layout.format) && layout.data_padding == padding()) {
+        const auto dt_size = data_type_traits::size_of(layout.data_type);
+        auto prealloc_info = _shape_predictor->predict_preallocation_shape("variable:" + variable_id, layout.get_shape(), dt_size, false);
+        if (prealloc_info.first && _shape_predictor->can_preallocate(ov::shape_size(prealloc_info.second) * dt_size))
+            alloc_layout.set_partial_shape(prealloc_info.second);
+    }
+    auto allocate_state_memory = [&](cldnn::network::VariableState& state) {
+        auto mem = get_engine().allocate_memory(alloc_layout, false);
+        state.set_memory(get_engine().reinterpret_buffer(*mem, layout), alloc_layout.count());
+    };
+
     if (it == _variables_states.end()) {
-        cldnn::network::VariableState::Ptr variable_state = std::make_shared<cldnn::network::VariableState>(get_engine().allocate_memory(layout, false));
+        cldnn::network::VariableState::Ptr variable_state = std::make_shared<cldnn::network::VariableState>();
+        allocate_state_memory(*variable_state);
         _variables_states.insert({variable_id, variable_state});
     } else {
-        bool can_reuse = it->second->memory && layout.count() <= it->second->memory->get_layout().count();
         if (can_reuse)
-            it->second->set_memory(get_engine().reinterpret_buffer(*it->second->memory, layout));
+            it->second->set_memory(get_engine().reinterpret_buffer(*it->second->memory, layout), it->second->capacity);
         else
-            it->second->set_memory(get_engine().allocate_memory(layout, false));
+            allocate_state_memory(*it->second);
         it->second->is_set = false;
     }
     for (auto primitive : _variable_state_primitives) {
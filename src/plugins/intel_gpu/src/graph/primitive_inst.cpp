@@ -143,14 +143,15 @@ static memory::ptr get_memory_from_pool(engine& _engine,
                                 allocation_type type,
                                 bool reusable_across_network,
                                 bool reset = true,
-                                memory* curr_memory = nullptr) {
+                                memory* curr_memory = nullptr,
+                                bool is_dynamic = false) {
     OPENVINO_ASSERT(!layout.is_dynamic() || layout.has_upper_bound(),
                     "[GPU] Can't allocate output for dynamic layout without upper bound");
     // Use layout with max tensor for dynamic shape with upper bound
     if (_node.get_program().get_config().get_property(ov::intel_gpu::enable_memory_pool)) {
         if (curr_memory != nullptr)
             pool.release_memory(curr_memory, _node.id(), net_id);
-        return pool.get_memory(layout, _node.id(), net_id, _node.get_memory_dependencies(), type, reusable_across_network, reset);
+        return pool.get_memory(layout, _node.id(), net_id, _node.get_memory_dependencies(), type, reusable_across_network, reset, is_dynamic);
     }
     return pool.get_memory(layout, type, reset);
 }
@@ -422,6 +423,10 @@ event::ptr primitive_inst::realloc_if_needed() {
         return ev;
     }
 
+    // The runtime in-place crop reuses the input buffer in on_execute()
+    if (_node->is_type<crop>() && can_be_optimized())
+        return ev;
+
     auto current_shape = actual_layout.get_shape();
     auto& sp = get_network().get_shape_predictor();
     auto dt_size = data_type_traits::size_of(actual_layout.data_type);
@@ -448,6 +453,13 @@ event::ptr primitive_inst::realloc_if_needed() {
         _outputs = allocate_outputs(&updated_params, need_reset_output_memory(), true);
         // TODO : need to handle multiple outputs
         max_output_layout_size = updated_params.output_layouts[0].count();
+        // the memory pool rounds the dynamic buffers up to the size class, the whole capacity is used by the following shapes
+        const auto& output_layout = updated_params.output_layouts[0];
+        if (format::is_simple_data_format(output_layout.format) && output_layout.data_type != data_types::bin &&
+            _outputs[0]->get_layout().data_padding == padding()) {
+            const auto capacity = _network.get_memory_pool().get_capacity(*_outputs[0], get_network_id());
+            max_output_layout_size = std::max(max_output_layout_size, capacity / dt_size);
+        }
     }
     _mem_allocated = true;
     // intermediate memory allocation is required for primitives consisting of multiple kernels in dynamic case
@@ -468,11 +480,11 @@ event::ptr primitive_inst::realloc_if_needed() {
                 bool need_reset = false;
                 if (i < _intermediates_memory.size()) {
                     _intermediates_memory[i] = allocate_internal_buffer(i, need_reset);
-                    max_intermediates_memory_sizes[i] = _intermediates_memory[i]->size();
+                    max_intermediates_memory_sizes[i] = _network.get_memory_pool().get_capacity(*_intermediates_memory[i], get_network_id());
                 } else {
                     // i-th layout has not been allocated yet
                     _intermediates_memory.push_back(allocate_internal_buffer(i, need_reset));
-                    max_intermediates_memory_sizes.push_back(_intermediates_memory[i]->size());
+                    max_intermediates_memory_sizes.push_back(_network.get_memory_pool().get_capacity(*_intermediates_memory[i], get_network_id()));
                 }
             }
         }
@@ -569,6 +581,11 @@ bool primitive_inst::update_impl() {
         return shape_changed();
     }
 
+    // Without the async compilation the dynamic impl is used until the shape changes, so the impls cache is not checked for it
+    if (_impl != nullptr && _impl->is_dynamic() && !shape_changed() && !use_async_compilation()) {
+        return false;
+    }
+
     if (!_node->is_type<data>() && !(_node->is_type<mutable_data>() && _node->get_dependencies().empty())) {
         // Update param if fake_alignment is available
         auto updated_params = _node->type()->get_fake_aligned_params(*_impl_params);
@@ -757,12 +774,35 @@ void primitive_inst::do_runtime_in_place_concat() {
     GPU_DEBUG_TRACE_DETAIL << "[In place concat] " << concat_inst->id() << ": can_be_optimized " << std::endl;
 }
 
+void primitive_inst::do_runtime_in_place_crop() {
+    GPU_DEBUG_GET_INSTANCE(debug_config);
+    GPU_DEBUG_IF(debug_config->disable_runtime_buffer_fusing) {
+        return;
+    }
+    if (!_node->is_type<crop>() || !_node->can_be_optimized())
+        return;
+
+    auto& crop_layout = _impl_params->output_layouts[0];
+    if (!crop_in_place_optimization::match(*_node, *_impl_params)) {
+        // the kernel writes the crop to its own buffer, the users still read it through the dynamic padding
+        crop_layout.data_padding = padding(tensor(0).sizes(), tensor(0).sizes(), 0.f, crop_layout.data_padding.get_dynamic_pad_dims());
+        set_can_be_optimized(false);
+        GPU_DEBUG_TRACE_DETAIL << "[In place crop] " << id() << " cannot be optimized " << std::endl;
+        return;
+    }
+
+    crop_in_place_optimization::update_in_place_crop_padding(crop_layout, _impl_params->get_input_layout(0), _impl_params->input_offsets[0]);
+    set_can_be_optimized(true);
+    GPU_DEBUG_TRACE_DETAIL << "[In place crop] " << id() << ": can_be_optimized with "
+                           << crop_layout.to_string() << std::endl;
+}
+
 bool primitive_inst::has_inner_networks() const {
     return (_impl_params->inner_nets.size() > 0);
 }
 
 event::ptr primitive_inst::execute(const std::vector<event::ptr>& events) {
-    const auto primitive_id = id();
+    const auto& primitive_id = id();
     OPENVINO_ASSERT(_has_valid_input, primitive_id, " has invalid/unset input");
     GPU_DEBUG_GET_INSTANCE(debug_config);
     bool need_args_update = false;
@@ -771,6 +811,7 @@ event::ptr primitive_inst::execute(const std::vector<event::ptr>& events) {
         do_runtime_in_place_concat();
         OPENVINO_ASSERT(_node != nullptr, "[GPU] Invalid primitive_inst object for dynamic shapes case: program_node can't be null");
         update_shape();
+        do_runtime_in_place_crop();
 
         // Check successor reorder if layouts are same
         // Need to set can_be_optimized for user reorder at predecessor because
@@ -839,9 +880,9 @@ event::ptr primitive_inst::execute(const std::vector<event::ptr>& events) {
     on_execute();
     GPU_DEBUG_TRACE << id() << ": execute " << _impl->get_kernel_name() << std::endl;
 
-    if (_exec_deps.empty() && dependencies.empty()) {
-        dependencies = events;
-    } else {
+    // The events of the network are passed as is (without the copy per primitive) if there are no own dependencies
+    const bool use_network_events = _exec_deps.empty() && dependencies.empty();
+    if (!use_network_events) {
         auto queue_type = get_network().get_stream().get_queue_type();
         // Prepare dependencies events in case of OOO queue, CPU implementation,
         // or optimized_out impl which has CPU users (needs_completion_event() && !is_output() condition)
@@ -850,7 +891,7 @@ event::ptr primitive_inst::execute(const std::vector<event::ptr>& events) {
             for (auto& input : _exec_deps) {
                 if (input->is_input() && queue_type != QueueTypes::out_of_order)
                     continue;
-                auto id = input->id();
+                const auto& id = input->id();
                 try {
                     // if the requested event does not exists it means that it has not been executed, so the processing_order is
                     // wrong or synchronization failed.
@@ -865,7 +906,7 @@ event::ptr primitive_inst::execute(const std::vector<event::ptr>& events) {
 
     {
         GPU_DEBUG_PROFILED_STAGE(instrumentation::pipeline_stage::inference);
-        auto ev = _impl->execute(dependencies, *this);
+        auto ev = _impl->execute(use_network_events ? events : dependencies, *this);
 
         GPU_DEBUG_IF(!debug_config->dump_profiling_data.empty()) {
             get_network().get_stream().wait_for_events({ev});
@@ -1091,7 +1132,8 @@ memory::ptr primitive_inst::allocate_internal_buffer(size_t idx, bool reset) {
                              alloc_type,
                              reuse_internal_buf,
                              reset,
-                             _intermediates_memory.size() > idx ? _intermediates_memory[idx].get() : nullptr);
+                             _intermediates_memory.size() > idx ? _intermediates_memory[idx].get() : nullptr,
+                             _node->is_dynamic());
     GPU_DEBUG_LOG << " [" << _network.get_id() << ":" << _node->id() << ": internal buf " << idx << "] " << alloc_type
                   << " " << ret_mem->buffer_ptr() << std::endl;
     return ret_mem;
@@ -1315,7 +1357,8 @@ memory::ptr primitive_inst::allocate_output(engine& _engine, memory_pool& pool,
                                     alloc_type,
                                     reusable_across_network,
                                     reset,
-                                    curr_memory);
+                                    curr_memory,
+                                    runtime_alloc && _node.is_dynamic_output_layout());
     }
 }
 
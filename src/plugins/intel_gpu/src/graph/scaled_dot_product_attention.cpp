@@ -0,0 +1,69 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "scaled_dot_product_attention_inst.h"
+#include "primitive_type_base.h"
+#include "json_object.h"
+#include <string>
+
+namespace cldnn {
+GPU_DEFINE_PRIMITIVE_TYPE_ID(scaled_dot_product_attention)
+
+layout scaled_dot_product_attention_inst::calc_output_layout(scaled_dot_product_attention_node const& node,
+                                                             kernel_impl_params const& impl_param) {
+    auto desc = impl_param.typed_desc<scaled_dot_product_attention>();
+    auto query_layout = impl_param.get_input_layout(0);
+    auto value_layout = impl_param.get_input_layout(2);
+    auto output_type = desc->output_data_types[0].value_or(query_layout.data_type);
+
+    // (B, H, L, D) x (B, H, S, Dv) -> (B, H, L, Dv), the heads are mapped to the feature dimension
+    auto output_size = query_layout.get_tensor();
+    output_size.spatial[0] = value_layout.spatial(0);
+
+    return layout(output_type, query_layout.format, output_size);
+}
+
+template<typename ShapeType>
+std::vector<layout> scaled_dot_product_attention_inst::calc_output_layouts(scaled_dot_product_attention_node const& /*node*/,
+                                                                           const kernel_impl_params& impl_param) {
+    auto desc = impl_param.typed_desc<scaled_dot_product_attention>();
+    auto query_layout = impl_param.get_input_layout(0);
+    auto value_layout = impl_param.get_input_layout(2);
+    auto output_type = desc->output_data_types[0].value_or(query_layout.data_type);
+
+    ShapeType output_shape = query_layout.get<ShapeType>();
+    auto value_shape = value_layout.get<ShapeType>();
+    OPENVINO_ASSERT(output_shape.size() == 4 && value_shape.size() == 4,
+                    "[GPU] scaled_dot_product_attention expects the rank 4 query and value, got ", output_shape.size(), " and ", value_shape.size());
+    output_shape[3] = value_shape[3];
+
+    return { layout{output_shape, output_type, query_layout.format, desc->output_paddings[0]} };
+}
+
+template std::vector<layout>
+scaled_dot_product_attention_inst::calc_output_layouts<ov::PartialShape>(scaled_dot_product_attention_node const& node,
+                                                                         const kernel_impl_params& impl_param);
+
+std::string scaled_dot_product_attention_inst::to_string(scaled_dot_product_attention_node const& node) {
+    auto desc = node.get_primitive();
+    auto node_info = node.desc_to_json();
+    std::stringstream primitive_description;
+
+    json_composite sdpa_info;
+    sdpa_info.add("query", node.input(0).id());
+    sdpa_info.add("key", node.input(1).id());
+    sdpa_info.add("value", node.input(2).id());
+    if (desc->has_attn_mask())
+        sdpa_info.add("attn_mask", node.input(3).id());
+    sdpa_info.add("scale", desc->scale);
+    sdpa_info.add("is_causal", desc->is_causal ? "true" : "false");
+    node_info->add("scaled_dot_product_attention info", sdpa_info);
+    node_info->dump(primitive_description);
+
+    return primitive_description.str();
+}
+
+scaled_dot_product_attention_inst::typed_primitive_inst(network& network, scaled_dot_product_attention_node const& node)
+    : parent(network, node) {}
+}  // namespace cldnn
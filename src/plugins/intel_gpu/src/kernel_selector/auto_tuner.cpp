@@ -65,16 +65,18 @@ TuningCache::TuningCache(const std::string& cacheFilePath)
     auto cacheObj = impl->cache.GetObject();
 
     // Update to new format with version markers
-    if (!cacheObj.HasMember(version2Marker)) {
-        auto newName = rapidjson::Value(version2Marker, impl->cache.GetAllocator());
-        auto newObj = rapidjson::Value(rapidjson::Type::kObjectType);
-        cacheObj.AddMember(newName, newObj, impl->cache.GetAllocator());
+    for (auto marker : {version2Marker, version3Marker}) {
+        if (!cacheObj.HasMember(marker)) {
+            auto newName = rapidjson::Value(marker, impl->cache.GetAllocator());
+            auto newObj = rapidjson::Value(rapidjson::Type::kObjectType);
+            cacheObj.AddMember(newName, newObj, impl->cache.GetAllocator());
+        }
     }
 
     bool needsV1 = false;
     for (auto& member : cacheObj) {
         std::string nameStr = member.name.GetString();
-        if (nameStr != version1Marker && nameStr != version2Marker) {
+        if (nameStr != version1Marker && nameStr != version2Marker && nameStr != version3Marker) {
             needsV1 = true;
         }
     }
@@ -89,7 +91,7 @@ TuningCache::TuningCache(const std::string& cacheFilePath)
         for (auto it = cacheObj.begin(); it != cacheObj.end();) {
             auto& member = *it;
             std::string nameStr = member.name.GetString();
-            if (nameStr != version1Marker && nameStr != version2Marker) {
+            if (nameStr != version1Marker && nameStr != version2Marker && nameStr != version3Marker) {
                 auto newName = rapidjson::Value(rapidjson::Type::kStringType);
                 auto newValue = rapidjson::Value(rapidjson::Type::kObjectType);
                 newName.Swap(member.name);
@@ -106,9 +108,11 @@ TuningCache::TuningCache(const std::string& cacheFilePath)
 TuningCache::TuningCache()
     : impl(new Impl()) {
     impl->cache.SetObject();
-    auto v2Name = rapidjson::Value(version2Marker, impl->cache.GetAllocator());
-    auto v2Obj = rapidjson::Value(rapidjson::Type::kObjectType);
-    impl->cache.AddMember(v2Name, v2Obj, impl->cache.GetAllocator());
+    for (auto marker : {version2Marker, version3Marker}) {
+        auto name = rapidjson::Value(marker, impl->cache.GetAllocator());
+        auto obj = rapidjson::Value(rapidjson::Type::kObjectType);
+        impl->cache.AddMember(name, obj, impl->cache.GetAllocator());
+    }
 }
 
 TuningCache::Entry TuningCache::LoadKernel(const Params& params) {
@@ -117,8 +121,12 @@ TuningCache::Entry TuningCache::LoadKernel(const Params& params) {
 
 TuningCache::Entry TuningCache::LoadKernel(const Params& params, uint32_t computeUnitsCount) {
     bool oldVersion = false;
+    // Try to load from version 3 stored for the device
+    auto result = LoadKernel_v3(params);
+    if (!std::get<0>(result).empty())
+        return result;
     // Try to load from version 2
-    auto result = LoadKernel_v2(params, computeUnitsCount);
+    result = LoadKernel_v2(params, computeUnitsCount);
     // Try to load from version 1
     if (std::get<0>(result).empty()) {
         auto result_v1 = LoadKernel_v1(params, computeUnitsCount);
@@ -180,10 +188,77 @@ TuningCache::Entry TuningCache::LoadKernel_v2(const Params& params, uint32_t com
     return std::make_tuple(prog[0].GetString(), prog[1].GetInt());
 }
 
-std::tuple<std::string, int> AutoTuner::LoadKernelOffline(const Params& params) {
+TuningCache::Entry TuningCache::LoadKernel_v3(const Params& params) {
+    Entry result = std::make_tuple<std::string, int>("", 0);
+    if (params.engineInfo.deviceId.empty())
+        return result;
+
+    auto kTypeStr = toString(params.GetType());
+    auto paramStr = params.to_cache_string_v2();
+
+    auto v3It = impl->cache.FindMember(version3Marker);
+    if (v3It == impl->cache.MemberEnd())
+        return result;
+
+    auto deviceIt = v3It->value.FindMember(params.engineInfo.deviceId.c_str());
+    if (deviceIt == v3It->value.MemberEnd())
+        return result;
+
+    auto kTypeIt = deviceIt->value.FindMember(kTypeStr.c_str());
+    if (kTypeIt == deviceIt->value.MemberEnd())
+        return result;
+
+    auto paramIt = kTypeIt->value.FindMember(paramStr.c_str());
+    if (paramIt == kTypeIt->value.MemberEnd())
+        return result;
+
+    auto& prog = paramIt->value;
+    return std::make_tuple(prog[0].GetString(), prog[1].GetInt());
+}
+
+void TuningCache::StoreKernel(const Params& params, const std::string& kernelName, int autoTuneIndex) {
+    if (params.engineInfo.deviceId.empty())
+        throw std::runtime_error("Tuning cache: the kernel can't be stored for the unknown device.");
+
+    auto& allocator = impl->cache.GetAllocator();
+    auto findOrAdd = [&allocator](rapidjson::Value& obj, const std::string& name) -> rapidjson::Value& {
+        auto it = obj.FindMember(name.c_str());
+        if (it != obj.MemberEnd())
+            return it->value;
+        obj.AddMember(rapidjson::Value(name.c_str(), allocator), rapidjson::Value(rapidjson::Type::kObjectType), allocator);
+        return obj[name.c_str()];
+    };
+
+    auto& deviceObj = findOrAdd(impl->cache[version3Marker], params.engineInfo.deviceId);
+    auto& kTypeObj = findOrAdd(deviceObj, toString(params.GetType()));
+
+    auto paramStr = params.to_cache_string_v2();
+    auto entry = rapidjson::Value(rapidjson::Type::kArrayType);
+    entry.PushBack(rapidjson::Value(kernelName.c_str(), allocator), allocator);
+    entry.PushBack(rapidjson::Value(autoTuneIndex), allocator);
+
+    auto paramIt = kTypeObj.FindMember(paramStr.c_str());
+    if (paramIt != kTypeObj.MemberEnd())
+        paramIt->value = entry;
+    else
+        kTypeObj.AddMember(rapidjson::Value(paramStr.c_str(), allocator), entry, allocator);
+}
+
+void TuningCache::Save(const std::string& cacheFilePath) const {
+    std::ofstream tuningFile(cacheFilePath);
+    if (!tuningFile || !tuningFile.good())
+        throw std::runtime_error("Tuning file: " + cacheFilePath + " could not be written!");
+
+    rapidjson::StringBuffer buffer;
+    rapidjson::PrettyWriter<rapidjson::StringBuffer> writer(buffer);
+    impl->cache.Accept(writer);
+    tuningFile << buffer.GetString();
+}
+
+std::tuple<std::string, int> AutoTuner::LoadKernelOffline(const Params& params, const std::string& cacheFilePath) {
     std::lock_guard<std::mutex> lock(mutex);
     static const uint32_t defaultComputeUnits = 24;
-    TuningCache* deviceCache = TuningCache::get();
+    TuningCache* deviceCache = TuningCache::get(cacheFilePath);
     if (!deviceCache)
         return {};
     auto result = deviceCache->LoadKernel(params);
@@ -193,10 +268,24 @@ std::tuple<std::string, int> AutoTuner::LoadKernelOffline(const Params& params)
     return result;
 }
 
-TuningCache* TuningCache::get() {
+TuningCache* TuningCache::get(const std::string& cacheFilePath) {
     static std::mutex m;
-    static std::shared_ptr<TuningCache> cache_instance = nullptr;
+    static std::map<std::string, std::shared_ptr<TuningCache>> cache_instances;
     std::lock_guard<std::mutex> lock(m);
+
+    if (!cacheFilePath.empty()) {
+        auto& cache_instance = cache_instances[cacheFilePath];
+        if (!cache_instance) {
+            try {
+                cache_instance = std::make_shared<kernel_selector::TuningCache>(cacheFilePath);
+            } catch (...) {
+                cache_instance = std::make_shared<kernel_selector::TuningCache>();
+            }
+        }
+        return cache_instance.get();
+    }
+
+    auto& cache_instance = cache_instances[""];
     std::string path = "cache.json";
 #ifdef _WIN32
     char module_path[MAX_PATH];
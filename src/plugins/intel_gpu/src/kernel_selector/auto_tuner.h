@@ -36,23 +36,31 @@ public:
     // Overrides the compute units count in params.
     Entry LoadKernel(const Params& params, uint32_t computeUnitsCount);
 
-    static TuningCache* get();
+    // Stores the kernel and its auto tune index for specified params. The entries are keyed by the device ID of params.
+    void StoreKernel(const Params& params, const std::string& kernelName, int autoTuneIndex);
+    // Writes tuning cache to file, so the stored kernels are picked up by the following loads.
+    void Save(const std::string& cacheFilePath) const;
+
+    // Returns the cache read from cacheFilePath, or from cache.json next to the plugin library if the path is empty.
+    static TuningCache* get(const std::string& cacheFilePath = "");
 
 private:
     Entry LoadKernel_v1(const Params& params, uint32_t computeUnitsCount);
     Entry LoadKernel_v2(const Params& params, uint32_t computeUnitsCount);
+    Entry LoadKernel_v3(const Params& params);
 
     class Impl;
     std::shared_ptr<Impl> impl;
 
     static constexpr const char* version1Marker = "version_1";
     static constexpr const char* version2Marker = "version_2";
+    static constexpr const char* version3Marker = "version_3";
 };
 
 class AutoTuner {
 public:
     AutoTuner() = default;
-    std::tuple<std::string, int> LoadKernelOffline(const Params& params);
+    std::tuple<std::string, int> LoadKernelOffline(const Params& params, const std::string& cacheFilePath = "");
 
 private:
     std::mutex mutex;  // Mutex to synchronize cache updates
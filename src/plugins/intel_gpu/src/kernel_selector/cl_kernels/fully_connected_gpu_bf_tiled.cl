@@ -121,7 +121,10 @@ KERNEL(fc)(
     uint weights_offset = out_f * INPUT_ELEMENTS_COUNT;
 
 #if COMPRESSED_WEIGHTS
-    #if DECOMPRESSION_SCALE_LENGTH > 1 && DECOMPRESSION_SCALE_LENGTH % SIMD == 0
+    #if DECOMPRESSION_SCALE_GROUPS_NUM > 1
+        // the group scales are read when the weights are decompressed, see GET_DECOMPRESSION_SCALE
+        ACCUMULATOR_VEC_TYPE d_scale = 0;
+    #elif DECOMPRESSION_SCALE_LENGTH > 1 && DECOMPRESSION_SCALE_LENGTH % SIMD == 0
         ACCUMULATOR_VEC_TYPE d_scale = BLOCK_READN(ACCUMULATOR_TYPE, TILE_OFM, decompression_scale, out_f);
     #elif DECOMPRESSION_SCALE_LENGTH > 1 && DECOMPRESSION_SCALE_LENGTH % SIMD != 0
         ACCUMULATOR_VEC_TYPE d_scale = 0;
@@ -134,7 +137,7 @@ KERNEL(fc)(
         ACCUMULATOR_VEC_TYPE d_scale = decompression_scale[0];
     #endif
 
-    #if !DECOMPRESSION_ZP_TERM
+    #if !DECOMPRESSION_ZP_TERM || DECOMPRESSION_ZP_GROUPS_NUM > 1
         ACCUMULATOR_VEC_TYPE d_zp = 0;
     #elif DECOMPRESSION_ZP_LENGTH > 1 && DECOMPRESSION_ZP_LENGTH % SIMD == 0
         ACCUMULATOR_VEC_TYPE d_zp = BLOCK_READN(ACCUMULATOR_TYPE, TILE_OFM, decompression_zp, out_f);
@@ -151,6 +154,22 @@ KERNEL(fc)(
 
     ACCUMULATOR_TYPE* ds = (ACCUMULATOR_TYPE*)(&d_scale);
     ACCUMULATOR_TYPE* dzp = (ACCUMULATOR_TYPE*)(&d_zp);
+
+    // The decompression constants of the weight at the input channel k of the fi-th output feature tile,
+    // the features of the tail tile are clamped to stay within the constants
+    #define DECOMPRESSION_OFM(fi) min(out_f + (fi) * SIMD + sglid, (uint)TILE_OUT_F_NUM - 1)
+    #if DECOMPRESSION_SCALE_GROUPS_NUM > 1
+        #define GET_DECOMPRESSION_SCALE(fi, k) \
+            TO_ACCUMULATOR_TYPE(decompression_scale[DECOMPRESSION_OFM(fi) * DECOMPRESSION_SCALE_GROUPS_NUM + (k) / DECOMPRESSION_SCALE_GROUP_SIZE])
+    #else
+        #define GET_DECOMPRESSION_SCALE(fi, k) ds[fi]
+    #endif
+    #if DECOMPRESSION_ZP_TERM && DECOMPRESSION_ZP_GROUPS_NUM > 1
+        #define GET_DECOMPRESSION_ZP(fi, k) \
+            TO_ACCUMULATOR_TYPE(decompression_zp[DECOMPRESSION_OFM(fi) * DECOMPRESSION_ZP_GROUPS_NUM + (k) / DECOMPRESSION_ZP_GROUP_SIZE])
+    #else
+        #define GET_DECOMPRESSION_ZP(fi, k) dzp[fi]
+    #endif
 #endif
 
 #if REALIGN_FP16_OFFSET
@@ -160,7 +179,10 @@ KERNEL(fc)(
         INPUT0_TYPE tmp_input = input[input_offset + get_sub_group_local_id() % TILE_B * TILE_IN_B_PITCH];
         ACCUMULATOR_VEC_TYPE tmp_wei = TO_ACCUMULATOR_VEC_TYPE(BLOCK_READN(FILTER_TYPE, TILE_OFM, weights, weights_offset));
         #if COMPRESSED_WEIGHTS
-            tmp_wei = (tmp_wei - d_zp) * d_scale;
+            ACCUMULATOR_TYPE* w = (ACCUMULATOR_TYPE*)(&tmp_wei);
+            unroll_for(uint fi = 0; fi < TILE_OFM; ++fi) {
+                w[fi] = (w[fi] - GET_DECOMPRESSION_ZP(fi, 0)) * GET_DECOMPRESSION_SCALE(fi, 0);
+            }
         #endif
         unroll_for(uint bi = 0; bi < TILE_B; ++bi) {
             acc[bi] = _sub_group_shuffle(tmp_input, bi) * tmp_wei;
@@ -191,9 +213,10 @@ KERNEL(fc)(
             wei = TO_FILTER_VEC_TYPE(FILTER_BLOCK_READ(weights, weights_offset));
             #if COMPRESSED_WEIGHTS
                 ACCUMULATOR_TYPE* w = (ACCUMULATOR_TYPE*)(&wei);
+                const uint k = ni * TILE_IFM * SIMD + ki * TILE_K + REALIGN_FP16_OFFSET;
                 unroll_for(uint kii = 0; kii < TILE_K; ++kii) {
                     unroll_for(uint fi = 0; fi < TILE_OFM; ++fi) {
-                        w[kii * TILE_OFM + fi] = (w[kii * TILE_OFM + fi] - dzp[fi]) * ds[fi];
+                        w[kii * TILE_OFM + fi] = (w[kii * TILE_OFM + fi] - GET_DECOMPRESSION_ZP(fi, k + kii)) * GET_DECOMPRESSION_SCALE(fi, k + kii);
                     }
                 }
             #endif
@@ -228,9 +251,10 @@ KERNEL(fc)(
             wei = TO_FILTER_VEC_TYPE(FILTER_BLOCK_READ(weights, weights_offset));
             #if COMPRESSED_WEIGHTS
                 ACCUMULATOR_TYPE* w = (ACCUMULATOR_TYPE*)(&wei);
+                const uint k = iterations * TILE_IFM * SIMD + ki * TILE_K + REALIGN_FP16_OFFSET;
                 unroll_for(uint kii = 0; kii < TILE_K; ++kii) {
                     unroll_for(uint fi = 0; fi < TILE_OFM; ++fi) {
-                        w[kii * TILE_OFM + fi] = (w[kii * TILE_OFM + fi] - dzp[fi]) * ds[fi];
+                        w[kii * TILE_OFM + fi] = (w[kii * TILE_OFM + fi] - GET_DECOMPRESSION_ZP(fi, k + kii)) * GET_DECOMPRESSION_SCALE(fi, k + kii);
                     }
                 }
             #endif
@@ -369,3 +393,7 @@ KERNEL(fc)(
 #undef USE_BLOCK_WRITE
 
 #undef MAIN_LOOP_ELEMENTS_COUNT
+
+#undef DECOMPRESSION_OFM
+#undef GET_DECOMPRESSION_SCALE
+#undef GET_DECOMPRESSION_ZP
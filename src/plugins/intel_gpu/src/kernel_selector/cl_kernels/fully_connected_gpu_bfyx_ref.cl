@@ -39,12 +39,18 @@ KERNEL(fc)(
             const uint filter_idx = GET_FILTER_INDEX(FILTER, 0, oym, y, 0, 0);
             #if COMPRESSED_WEIGHTS
                 ACCUMULATOR_TYPE filter_compressed = TO_ACCUMULATOR_TYPE(weights[filter_idx]);
-                #if DECOMPRESSION_ZP_TERM
+                #if DECOMPRESSION_ZP_TERM && DECOMPRESSION_ZP_GROUPS_NUM > 1
+                    ACCUMULATOR_TYPE zp = TO_ACCUMULATOR_TYPE(decompression_zp[oym * DECOMPRESSION_ZP_GROUPS_NUM + y / DECOMPRESSION_ZP_GROUP_SIZE]);
+                #elif DECOMPRESSION_ZP_TERM
                     ACCUMULATOR_TYPE zp = TO_ACCUMULATOR_TYPE(decompression_zp[DECOMPRESSION_ZP_GET_INDEX_SAFE(0, oym, 0, 0)]);
                 #else
                     ACCUMULATOR_TYPE zp = ACCUMULATOR_VAL_ZERO;
                 #endif
-                DECOMPRESSION_SCALE_TYPE scale = decompression_scale[DECOMPRESSION_SCALE_GET_INDEX_SAFE(0, oym, 0, 0)];
+                #if DECOMPRESSION_SCALE_GROUPS_NUM > 1
+                    DECOMPRESSION_SCALE_TYPE scale = decompression_scale[oym * DECOMPRESSION_SCALE_GROUPS_NUM + y / DECOMPRESSION_SCALE_GROUP_SIZE];
+                #else
+                    DECOMPRESSION_SCALE_TYPE scale = decompression_scale[DECOMPRESSION_SCALE_GET_INDEX_SAFE(0, oym, 0, 0)];
+                #endif
                 ACCUMULATOR_TYPE filter_val = (TO_ACCUMULATOR_TYPE(filter_compressed) - TO_ACCUMULATOR_TYPE(zp)) * scale;
                 dotProd += (ACCUMULATOR_TYPE)(input[input0_idx]) * (ACCUMULATOR_TYPE)(filter_val);
             #else
@@ -70,13 +76,21 @@ KERNEL(fc)(
                 const uint filter_idx = GET_FILTER_INDEX(FILTER, 0, ofm, ifm, y, x);
                 #if COMPRESSED_WEIGHTS
                     FILTER_TYPE filter_compressed = weights[filter_idx];
-                    #if DECOMPRESSION_ZP_TERM
+                    // the input channel index within the flattened weights row selects the decompression group
+                    const uint k = (ifm * INPUT0_SIZE_Y + y) * INPUT0_SIZE_X + x;
+                    #if DECOMPRESSION_ZP_TERM && DECOMPRESSION_ZP_GROUPS_NUM > 1
+                        ACCUMULATOR_TYPE zp = decompression_zp[ofm * DECOMPRESSION_ZP_GROUPS_NUM + k / DECOMPRESSION_ZP_GROUP_SIZE];
+                    #elif DECOMPRESSION_ZP_TERM
                         ACCUMULATOR_TYPE zp = decompression_zp[DECOMPRESSION_ZP_GET_INDEX_SAFE(0, ofm, 0, 0)];
                     #else
                         ACCUMULATOR_TYPE zp = ACCUMULATOR_VAL_ZERO;
                     #endif
 
-                    DECOMPRESSION_SCALE_TYPE scale = decompression_scale[DECOMPRESSION_SCALE_GET_INDEX_SAFE(0, ofm, 0, 0)];
+                    #if DECOMPRESSION_SCALE_GROUPS_NUM > 1
+                        DECOMPRESSION_SCALE_TYPE scale = decompression_scale[ofm * DECOMPRESSION_SCALE_GROUPS_NUM + k / DECOMPRESSION_SCALE_GROUP_SIZE];
+                    #else
+                        DECOMPRESSION_SCALE_TYPE scale = decompression_scale[DECOMPRESSION_SCALE_GET_INDEX_SAFE(0, ofm, 0, 0)];
+                    #endif
                     ACCUMULATOR_TYPE filter_val = (TO_ACCUMULATOR_TYPE(filter_compressed) - TO_ACCUMULATOR_TYPE(zp)) * scale;
                     dotProd += (ACCUMULATOR_TYPE)(input[input0_idx]) * (ACCUMULATOR_TYPE)(filter_val);
                 #else
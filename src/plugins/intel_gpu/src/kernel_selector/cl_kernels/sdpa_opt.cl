@@ -0,0 +1,109 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "include/batch_headers/fetch_data.cl"
+
+// The mask dimensions of size 1 are broadcast
+#define MASK_DIM(dim, size) ((size) == 1 ? 0 : (dim))
+
+// Every work item computes one query row, the work group goes over the keys and the values by the tiles shared
+// in the local memory and keeps the running maximum and sum of the softmax, so the scores matrix is never stored.
+__attribute__((reqd_work_group_size(Q_BLOCK_SIZE, 1, 1)))
+KERNEL(sdpa_opt)(
+    OPTIONAL_SHAPE_INFO_ARG
+    const __global INPUT0_TYPE* query,
+    const __global INPUT1_TYPE* key,
+    const __global INPUT2_TYPE* value,
+#if HAS_ATTN_MASK
+    const __global INPUT3_TYPE* attn_mask,
+#endif
+    __global OUTPUT_TYPE* output)
+{
+    const uint l = (uint)get_global_id(0);
+    const uint lid = (uint)get_local_id(0);
+    const uint h = (uint)get_global_id(1);
+    const uint b = (uint)get_global_id(2);
+    const uint kv_h = h / KV_HEADS_GROUP;
+
+    const int query_len = INPUT0_SIZE_Y;
+    const int kv_len = INPUT1_SIZE_Y;
+    const bool active = (int)l < query_len;
+
+    __local INPUT1_TYPE key_tile[KV_BLOCK_SIZE * HEAD_SIZE];
+    __local INPUT2_TYPE value_tile[KV_BLOCK_SIZE * V_HEAD_SIZE];
+
+    ACCUMULATOR_TYPE q[HEAD_SIZE];
+    ACCUMULATOR_TYPE acc[V_HEAD_SIZE];
+    for (uint d = 0; d < HEAD_SIZE; d++)
+        q[d] = active ? TO_ACCUMULATOR_TYPE(query[INPUT0_GET_INDEX(b, h, l, d)]) * TO_ACCUMULATOR_TYPE(SCALE_FACTOR)
+                      : ACCUMULATOR_VAL_ZERO;
+    for (uint d = 0; d < V_HEAD_SIZE; d++)
+        acc[d] = ACCUMULATOR_VAL_ZERO;
+
+    ACCUMULATOR_TYPE max_val = ACCUMULATOR_VAL_MIN;
+    ACCUMULATOR_TYPE sum = ACCUMULATOR_VAL_ZERO;
+
+    // The keys are aligned to the end of the queries, as for the cached keys of the previous tokens
+    int kv_end = kv_len;
+    int group_kv_end = kv_len;
+#if IS_CAUSAL
+    const int group_last = min((int)(l - lid) + Q_BLOCK_SIZE, query_len) - 1;
+    kv_end = clamp((int)l + kv_len - query_len + 1, 0, kv_len);
+    group_kv_end = clamp(group_last + kv_len - query_len + 1, 0, kv_len);
+#endif
+
+    for (int kv_start = 0; kv_start < group_kv_end; kv_start += KV_BLOCK_SIZE) {
+        const int tile_len = min(KV_BLOCK_SIZE, group_kv_end - kv_start);
+
+        for (int i = lid; i < tile_len * HEAD_SIZE; i += Q_BLOCK_SIZE)
+            key_tile[i] = key[INPUT1_GET_INDEX(b, kv_h, kv_start + i / HEAD_SIZE, i % HEAD_SIZE)];
+        for (int i = lid; i < tile_len * V_HEAD_SIZE; i += Q_BLOCK_SIZE)
+            value_tile[i] = value[INPUT2_GET_INDEX(b, kv_h, kv_start + i / V_HEAD_SIZE, i % V_HEAD_SIZE)];
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        const int row_tile_len = min(tile_len, kv_end - kv_start);
+        if (active && row_tile_len > 0) {
+            ACCUMULATOR_TYPE scores[KV_BLOCK_SIZE];
+            ACCUMULATOR_TYPE tile_max = max_val;
+            for (int s = 0; s < row_tile_len; s++) {
+                ACCUMULATOR_TYPE score = ACCUMULATOR_VAL_ZERO;
+                for (uint d = 0; d < HEAD_SIZE; d++)
+                    score += q[d] * TO_ACCUMULATOR_TYPE(key_tile[s * HEAD_SIZE + d]);
+#if HAS_ATTN_MASK
+                score += TO_ACCUMULATOR_TYPE(attn_mask[INPUT3_GET_INDEX(MASK_DIM(b, INPUT3_BATCH_NUM),
+                                                                        MASK_DIM(h, INPUT3_FEATURE_NUM),
+                                                                        MASK_DIM(l, INPUT3_SIZE_Y),
+                                                                        MASK_DIM(kv_start + s, INPUT3_SIZE_X))]);
+#endif
+                scores[s] = score;
+                tile_max = max(tile_max, score);
+            }
+
+            // Rescale what was accumulated for the previous tiles to the new maximum
+            const ACCUMULATOR_TYPE correction = native_exp(max_val - tile_max);
+            sum *= correction;
+            for (uint d = 0; d < V_HEAD_SIZE; d++)
+                acc[d] *= correction;
+
+            for (int s = 0; s < row_tile_len; s++) {
+                const ACCUMULATOR_TYPE p = native_exp(scores[s] - tile_max);
+                sum += p;
+                for (uint d = 0; d < V_HEAD_SIZE; d++)
+                    acc[d] += p * TO_ACCUMULATOR_TYPE(value_tile[s * V_HEAD_SIZE + d]);
+            }
+            max_val = tile_max;
+        }
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (!active)
+        return;
+
+    for (uint d = 0; d < V_HEAD_SIZE; d++)
+        output[OUTPUT_GET_INDEX(b, h, l, d)] = TO_OUTPUT_TYPE(acc[d] / sum);
+}
+
+#undef MASK_DIM
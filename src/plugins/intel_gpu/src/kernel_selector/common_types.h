@@ -96,6 +96,7 @@ enum class KernelType {
     MULTICLASS_NMS,
     UNIQUE_COUNT,
     UNIQUE_GATHER,
+    SDPA,
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -13,8 +13,10 @@
 #include <vector>
 #include <tuple>
 #include <set>
+#include <algorithm>
 #include <iostream>
 #include "intel_gpu/runtime/debug_configuration.hpp"
+#include "intel_gpu/runtime/utils.hpp"
 
 // #define ENABLE_ENV
 // #define ENABLE_ENV_PRINT
@@ -31,6 +33,34 @@ namespace kernel_selector {
 
 AutoTuner kernel_selector_base::autoTuner;
 
+// The number of the params signatures remembered by each selector, the dynamic shapes add a signature per shape
+static constexpr size_t selectedKernelsCapacity = 1024;
+
+static size_t GetSelectionKey(const Params& params, const optional_params& options) {
+    size_t seed = 0;
+    seed = cldnn::hash_combine(seed, params.GetType());
+    seed = cldnn::hash_combine(seed, params.engineInfo.deviceId);
+    seed = cldnn::hash_combine(seed, params.engineInfo.driverVersion);
+    seed = cldnn::hash_combine(seed, params.engineInfo.computeUnitsCount);
+    seed = cldnn::hash_combine(seed, params.forceImplementation);
+    seed = cldnn::hash_combine(seed, params.is_shape_agnostic);
+    seed = cldnn::hash_combine(seed, params.to_string());
+    seed = cldnn::hash_combine(seed, params.to_cache_string_v2());
+    if (auto base = dynamic_cast<const base_params*>(&params)) {
+        for (const auto& fused_op : base->fused_ops) {
+            seed = cldnn::hash_combine(seed, fused_op.GetType());
+            seed = cldnn::hash_combine(seed, fused_op.output_tensor.GetDType());
+            seed = cldnn::hash_combine(seed, fused_op.dep_size);
+        }
+    }
+    seed = cldnn::hash_range(seed, options.inputLayouts.begin(), options.inputLayouts.end());
+    seed = cldnn::hash_range(seed, options.outputLayouts.begin(), options.outputLayouts.end());
+    seed = cldnn::hash_combine(seed, options.allowStaticInputReordering);
+    seed = cldnn::hash_combine(seed, options.allowInputReordering);
+    seed = cldnn::hash_combine(seed, options.allowOutputReordering);
+    return seed;
+}
+
 #ifdef ENABLE_ENV
 std::string strip(const std::string str) {
     size_t start = str.find_first_not_of(' ');
@@ -58,7 +88,7 @@ static void AddToForceMap(ForceList& force_list, bool force_or_deny, const char*
 }
 #endif
 
-kernel_selector_base::kernel_selector_base() {
+kernel_selector_base::kernel_selector_base() : selectedKernels(selectedKernelsCapacity) {
 #ifdef ENABLE_ENV
     AddToForceMap(forceKernels, true, "CL_DNN_FORCE_KERNELS");
     AddToForceMap(forceKernels, false, "CL_DNN_DENY_KERNELS");
@@ -76,7 +106,30 @@ KernelsData kernel_selector_base::GetNaiveBestKernel(const KernelList& all_impls
     KernelsData kernelsData;
     std::string kernelName;
 
+    // The implementation selected for the same params signature before is tried first. All the implementations are
+    // scanned only when there is none or it doesn't accept these params.
+    const auto selectionKey = GetSelectionKey(params, options);
+    const auto selectedName = selectedKernels.get(selectionKey);
+    if (!selectedName.empty()) {
+        auto implementation = std::find_if(all_impls.begin(), all_impls.end(), [&](const std::shared_ptr<KernelBase>& impl) {
+            return impl != nullptr && impl->GetName() == selectedName;
+        });
+        if (implementation != all_impls.end()) {
+            try {
+                KernelsData kds = (*implementation)->GetKernelsData(params, options);
+                if (kds.size() && kds[0].kernels.size()) {
+                    kernelsData = kds;
+                    kernelName = selectedName;
+                }
+            } catch (std::runtime_error& ex) {
+                GPU_DEBUG_TRACE << "layerID: " << params.layerID << " kernel: " << selectedName << " - " << ex.what() << std::endl;
+            }
+        }
+    }
+
     for (const auto& implementation : all_impls) {
+        if (!kernelsData.empty())
+            break;
         // TODO: Unify this check with the Validate virtual method. Make
         // sure that the method is called here only, not in all the
         // GetKernelsData implementations.
@@ -99,6 +152,7 @@ KernelsData kernel_selector_base::GetNaiveBestKernel(const KernelList& all_impls
     if (kernelsData.size()) {
         kernelsData[0].kernelName = kernelName;
         kernelsData[0].kernels[0].params.layerID = params.layerID;
+        selectedKernels.add(selectionKey, kernelName);
     }
 
     return kernelsData;
@@ -116,7 +170,7 @@ KernelsData kernel_selector_base::GetAutoTuneBestKernel(const Params& params, co
     bool int8_kernel = kernel_params.inputs[0].GetDType() == Datatype::INT8 || kernel_params.inputs[0].GetDType() == Datatype::UINT8;
     std::tuple<std::string, int> cachedKernelConfig;
     if (!int8_kernel) {  // Try to load kernel/config from offline cache
-        cachedKernelConfig = autoTuner.LoadKernelOffline(params);
+        cachedKernelConfig = autoTuner.LoadKernelOffline(params, options.tuningCachePath);
     }
     bool hashFoundInCache = !std::get<0>(cachedKernelConfig).empty();
 
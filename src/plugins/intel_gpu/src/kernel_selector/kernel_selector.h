@@ -6,6 +6,7 @@
 
 #include "kernel_selector_common.h"
 #include "auto_tuner.h"
+#include "intel_gpu/runtime/lru_cache.hpp"
 #include <vector>
 #include <memory>
 #include <string>
@@ -48,6 +49,10 @@ protected:
     KernelList implementations;
     ForceList forceKernels;
 
+    // the name of the implementation selected by GetNaiveBestKernel for the hash of the params signature, so the
+    // repeated layers and the shapes seen recently don't scan all the implementations again
+    mutable cldnn::LruCacheThreadSafe<size_t, std::string> selectedKernels;
+
     static AutoTuner autoTuner;
 };
 }  // namespace kernel_selector
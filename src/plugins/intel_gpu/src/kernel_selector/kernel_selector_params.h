@@ -718,6 +718,7 @@ struct optional_params {
         false;  // allow kernel to ask graph compiler to reorder the input data before executing its
     bool allowOutputReordering =
         false;  // allow kernel to ask graph compiler to reorder the output data before executing the next kernel
+    std::string tuningCachePath = "";  // the tuning cache file used instead of the default one next to the plugin library
 
     virtual ParamsKey GetSupportedKey() const;
 
@@ -23,12 +23,24 @@ JitConstants FullyConnectedKernelBase::GetJitConstants(const fully_connected_par
     }
 
     if (params.compressed) {
+        // The decompression constants are either per output channel or split into the groups along the input
+        // channels, e.g. [OFM, IFM / group_size] for the group quantized weights
+        const size_t ofm = params.weights.OFM().v;
+        const size_t ifm = params.weights.LogicalSize() / ofm;
+        auto add_groups_jit = [&](const std::string& name, const DataTensor& tensor) {
+            const size_t groups_num = std::max<size_t>(tensor.LogicalSize() / ofm, 1);
+            jit.AddConstants({MakeJitConstant(name + "_GROUPS_NUM", groups_num)});
+            jit.AddConstants({MakeJitConstant(name + "_GROUP_SIZE", ifm / groups_num)});
+        };
+
         jit.AddConstants({MakeJitConstant("COMPRESSED_WEIGHTS", 1)});
         jit.AddConstants({MakeJitConstant("DECOMPRESSION_SCALE_TERM", 1)});
         jit.AddConstants({MakeJitConstant("DECOMPRESSION_SCALE", params.decompression_scale)});
+        add_groups_jit("DECOMPRESSION_SCALE", params.decompression_scale);
         if (params.has_decompression_zp) {
             jit.AddConstants({MakeJitConstant("DECOMPRESSION_ZP_TERM", 1)});
             jit.AddConstants({MakeJitConstant("DECOMPRESSION_ZP", params.decompression_zero_point)});
+            add_groups_jit("DECOMPRESSION_ZP", params.decompression_zero_point);
         }
     }
 
@@ -169,6 +181,20 @@ bool FullyConnectedKernelBase::Validate(const Params& p, const optional_params&)
             return false;
     }
 
+    if (params.compressed) {
+        // the groups of the decompression constants must split the input channels evenly
+        const size_t ofm = params.weights.OFM().v;
+        const size_t ifm = params.weights.LogicalSize() / ofm;
+        auto is_valid_groups = [&](const DataTensor& tensor) {
+            const size_t groups_num = tensor.LogicalSize() / ofm;
+            return groups_num <= 1 || ifm % groups_num == 0;
+        };
+        if (!is_valid_groups(params.decompression_scale))
+            return false;
+        if (params.has_decompression_zp && !is_valid_groups(params.decompression_zero_point))
+            return false;
+    }
+
     return true;
 }
 
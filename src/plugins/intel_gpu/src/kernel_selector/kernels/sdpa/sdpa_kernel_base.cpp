@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sdpa_kernel_base.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector {
+bool SDPAKernelBase::Validate(const Params& p, const optional_params& o) const {
+    if (p.GetType() != KernelType::SDPA || o.GetType() != KernelType::SDPA)
+        return false;
+
+    const sdpa_params& params = static_cast<const sdpa_params&>(p);
+    if (params.inputs.size() != 3 && params.inputs.size() != 4)
+        return false;
+
+    // The query and the key share the head size, the head sizes are unrolled into the kernel so must be static
+    const auto& query = params.inputs[0];
+    const auto& key = params.inputs[1];
+    const auto& value = params.inputs[2];
+    if (query.X().is_dynamic || key.X().is_dynamic || value.X().is_dynamic)
+        return false;
+
+    if (query.X().v != key.X().v)
+        return false;
+
+    // The key and value heads are shared by the equal groups of the query heads
+    if (query.Feature().is_dynamic || key.Feature().is_dynamic || value.Feature().is_dynamic)
+        return false;
+
+    if (key.Feature().v == 0 || key.Feature().v != value.Feature().v || query.Feature().v % key.Feature().v != 0)
+        return false;
+
+    return true;
+}
+
+Datatype SDPAKernelBase::GetAccumulatorType(const sdpa_params& params) const {
+    if (params.fp16_accumulation && params.inputs[0].GetDType() == Datatype::F16)
+        return Datatype::F16;
+
+    return Datatype::F32;
+}
+
+JitConstants SDPAKernelBase::GetJitConstants(const sdpa_params& params) const {
+    JitConstants jit = MakeBaseParamsJitConstants(params);
+
+    jit.AddConstants({
+        MakeJitConstant("HEAD_SIZE", params.inputs[0].X().v),
+        MakeJitConstant("V_HEAD_SIZE", params.inputs[2].X().v),
+        MakeJitConstant("KV_HEADS_GROUP", params.inputs[0].Feature().v / params.inputs[1].Feature().v),
+        MakeJitConstant("SCALE_FACTOR", params.scale),
+        MakeJitConstant("IS_CAUSAL", params.is_causal),
+        MakeJitConstant("HAS_ATTN_MASK", params.inputs.size() == 4),
+    });
+    jit.Merge(MakeTypeJitConstants(GetAccumulatorType(params), "ACCUMULATOR"));
+
+    return jit;
+}
+}  // namespace kernel_selector
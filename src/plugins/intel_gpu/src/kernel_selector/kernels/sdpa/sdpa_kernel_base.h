@@ -0,0 +1,42 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "kernel_base_opencl.h"
+#include "kernel_selector_params.h"
+
+namespace kernel_selector {
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// sdpa_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct sdpa_params : public base_params {
+    sdpa_params() : base_params(KernelType::SDPA) {}
+
+    float scale = 1.0f;
+    bool is_causal = false;
+    bool fp16_accumulation = false;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// sdpa_optional_params
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+struct sdpa_optional_params : optional_params {
+    sdpa_optional_params() : optional_params(KernelType::SDPA) {}
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// SDPAKernelBase
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+class SDPAKernelBase : public KernelBaseOpenCL {
+public:
+    using KernelBaseOpenCL::KernelBaseOpenCL;
+    virtual ~SDPAKernelBase() {}
+
+protected:
+    bool Validate(const Params& p, const optional_params& o) const override;
+    virtual JitConstants GetJitConstants(const sdpa_params& params) const;
+    Datatype GetAccumulatorType(const sdpa_params& params) const;
+};
+}  // namespace kernel_selector
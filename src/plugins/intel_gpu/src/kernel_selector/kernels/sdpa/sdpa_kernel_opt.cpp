@@ -0,0 +1,122 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sdpa_kernel_opt.h"
+#include "kernel_selector_utils.h"
+
+#include <algorithm>
+
+namespace kernel_selector {
+
+namespace {
+// The query rows processed by one work group, they share the key and value tiles loaded into the local memory
+constexpr size_t query_block_size = 16;
+// The head sizes are kept in the private memory of the work items
+constexpr size_t max_head_size = 256;
+
+size_t GetKVBlockSize(const sdpa_params& params) {
+    const size_t head_sizes = params.inputs[1].X().v * BytesPerElement(params.inputs[1].GetDType()) +
+                              params.inputs[2].X().v * BytesPerElement(params.inputs[2].GetDType());
+    size_t kv_block_size = 16;
+    while (kv_block_size > 1 && params.engineInfo.maxLocalMemSize != 0 &&
+           kv_block_size * head_sizes > params.engineInfo.maxLocalMemSize / 2)
+        kv_block_size /= 2;
+
+    return kv_block_size;
+}
+
+CommonDispatchData SetDefault(const sdpa_params& params) {
+    CommonDispatchData dispatchData;
+
+    const auto& query = params.inputs[0];
+    dispatchData.gws = { Align(query.Y().v, query_block_size), query.Feature().v, query.Batch().v };
+    dispatchData.lws = { query_block_size, 1, 1 };
+
+    return dispatchData;
+}
+}  // namespace
+
+ParamsKey SDPAKernelOpt::GetSupportedKey() const {
+    ParamsKey k;
+    k.EnableInputDataType(Datatype::F16);
+    k.EnableInputDataType(Datatype::F32);
+
+    k.EnableOutputDataType(Datatype::F16);
+    k.EnableOutputDataType(Datatype::F32);
+
+    k.EnableInputLayout(DataLayout::bfyx);
+    k.EnableOutputLayout(DataLayout::bfyx);
+
+    k.EnableDifferentTypes();
+    k.EnableTensorOffset();
+    k.EnableTensorPitches();
+    k.EnableBatching();
+    k.EnableDynamicShapesSupport();
+    return k;
+}
+
+bool SDPAKernelOpt::Validate(const Params& p, const optional_params& o) const {
+    if (!Parent::Validate(p, o))
+        return false;
+
+    const sdpa_params& params = static_cast<const sdpa_params&>(p);
+    if (params.inputs[0].X().v > max_head_size || params.inputs[2].X().v > max_head_size)
+        return false;
+
+    return true;
+}
+
+JitConstants SDPAKernelOpt::GetJitConstants(const sdpa_params& params) const {
+    auto jit = Parent::GetJitConstants(params);
+
+    jit.AddConstants({
+        MakeJitConstant("Q_BLOCK_SIZE", query_block_size),
+        MakeJitConstant("KV_BLOCK_SIZE", GetKVBlockSize(params)),
+    });
+
+    return jit;
+}
+
+KernelsData SDPAKernelOpt::GetKernelsData(const Params& params, const optional_params& options) const {
+    if (!Validate(params, options))
+        return {};
+
+    KernelData kd = KernelData::Default<sdpa_params>(params);
+    const auto& prim_params = static_cast<const sdpa_params&>(params);
+
+    auto dispatchData = SetDefault(prim_params);
+    auto entry_point = GetEntryPoint(kernelName, prim_params.layerID, params, options);
+    auto jit = CreateJit(kernelName, GetJitConstants(prim_params), entry_point);
+
+    kd.update_dispatch_data_func = [](const Params& params, KernelData& kd) {
+        const auto& prim_params = static_cast<const sdpa_params&>(params);
+        auto dispatchData = SetDefault(prim_params);
+        OPENVINO_ASSERT(kd.kernels.size() == 1, "[GPU] Invalid kernels size for update dispatch data func");
+        kd.kernels[0].params.workGroups.global = dispatchData.gws;
+        kd.kernels[0].params.workGroups.local = dispatchData.lws;
+        kd.kernels[0].skip_execution = KernelData::SkipKernelExecution(prim_params);
+    };
+
+    auto& kernel = kd.kernels[0];
+    FillCLKernelData(kernel,
+                     dispatchData,
+                     params.engineInfo,
+                     kernelName,
+                     jit,
+                     entry_point,
+                     EXE_MODE_DEFAULT,
+                     false,
+                     false,
+                     static_cast<int>(prim_params.inputs.size()),
+                     0,
+                     1,
+                     prim_params.has_dynamic_tensors());
+
+    return {kd};
+}
+
+KernelsPriority SDPAKernelOpt::GetKernelsPriority(const Params& /*params*/, const optional_params& /*options*/) const {
+    return FORCE_PRIORITY_1;
+}
+}  // namespace kernel_selector
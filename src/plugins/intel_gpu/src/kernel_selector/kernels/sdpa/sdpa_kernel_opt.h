@@ -0,0 +1,24 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "sdpa_kernel_base.h"
+
+namespace kernel_selector {
+class SDPAKernelOpt : public SDPAKernelBase {
+public:
+    using Parent = SDPAKernelBase;
+    SDPAKernelOpt() : SDPAKernelBase("sdpa_opt") {}
+    virtual ~SDPAKernelOpt() {}
+
+    KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+    KernelsPriority GetKernelsPriority(const Params& params, const optional_params& options) const override;
+    ParamsKey GetSupportedKey() const override;
+
+protected:
+    bool Validate(const Params& p, const optional_params& o) const override;
+    JitConstants GetJitConstants(const sdpa_params& params) const override;
+};
+}  // namespace kernel_selector
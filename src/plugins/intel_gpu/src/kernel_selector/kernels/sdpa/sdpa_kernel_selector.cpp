@@ -0,0 +1,16 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sdpa_kernel_selector.h"
+#include "sdpa_kernel_opt.h"
+
+namespace kernel_selector {
+sdpa_kernel_selector::sdpa_kernel_selector() {
+    Attach<SDPAKernelOpt>();
+}
+
+KernelsData sdpa_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const {
+    return GetNaiveBestKernel(params, options, KernelType::SDPA);
+}
+}  // namespace kernel_selector
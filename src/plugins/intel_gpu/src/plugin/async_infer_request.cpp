@@ -4,6 +4,7 @@
 
 #include "intel_gpu/plugin/async_infer_request.hpp"
 #include "intel_gpu/runtime/itt.hpp"
+#include "openvino/runtime/threading/immediate_executor.hpp"
 #include <memory>
 
 namespace ov {
@@ -12,10 +13,12 @@ namespace intel_gpu {
 AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& infer_request,
                                      const std::shared_ptr<ov::threading::ITaskExecutor>& task_executor,
                                      const std::shared_ptr<ov::threading::ITaskExecutor>& wait_executor,
-                                     const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor)
+                                     const std::shared_ptr<ov::threading::ITaskExecutor>& callback_executor,
+                                     const RequestsMerger::Ptr& requests_merger)
     : ov::IAsyncInferRequest(infer_request, task_executor, callback_executor)
     , m_infer_request(infer_request)
-    , m_wait_executor(wait_executor) {
+    , m_wait_executor(wait_executor)
+    , m_requests_merger(requests_merger) {
     m_infer_request->set_task_executor(task_executor);
     if (infer_request->use_external_queue()) {
         m_pipeline.clear();
@@ -24,6 +27,18 @@ AsyncInferRequest::AsyncInferRequest(const std::shared_ptr<SyncInferRequest>& in
                             OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "AsyncInferRequest::WaitPipeline");
                             m_infer_request->wait_notify();
                         });
+    } else if (m_requests_merger) {
+        m_requests_merger->attach();
+        m_pipeline.clear();
+        m_pipeline.emplace_back(std::make_shared<ov::threading::ImmediateExecutor>(),
+                        [this] {
+                            m_merged_infer = m_requests_merger->submit(*m_infer_request);
+                        });
+        m_pipeline.emplace_back(wait_executor,
+                        [this] {
+                            OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "AsyncInferRequest::WaitMergedInfer");
+                            m_merged_infer.get();
+                        });
     }
 }
 void AsyncInferRequest::start_async() {
@@ -36,6 +51,8 @@ void AsyncInferRequest::start_async() {
 
 AsyncInferRequest::~AsyncInferRequest() {
     stop_and_wait();
+    if (m_requests_merger)
+        m_requests_merger->detach();
 }
 
 }  // namespace intel_gpu
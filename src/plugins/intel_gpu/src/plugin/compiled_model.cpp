@@ -40,6 +40,13 @@ std::shared_ptr<ov::threading::ITaskExecutor> create_task_executor(const std::sh
             ov::threading::IStreamsExecutor::Config{"Intel GPU plugin executor", config.get_property(ov::num_streams)});
     }
 }
+
+void reserve_remote_tensors_pool(RemoteContextImpl& context, const ExecutionConfig& config) {
+    // The pool of the shared context serves all the models compiled on it, so it keeps the largest requested capacity
+    auto pool_size = config.get_property(ov::intel_gpu::remote_tensors_pool_size);
+    if (pool_size > context.get_memory_pool_capacity())
+        context.set_memory_pool_capacity(pool_size);
+}
 }  // namespace
 
 CompiledModel::CompiledModel(std::shared_ptr<ov::Model> model,
@@ -63,6 +70,7 @@ CompiledModel::CompiledModel(std::shared_ptr<ov::Model> model,
         auto graph = n == 0 ? graph_base : std::make_shared<Graph>(graph_base, n);
         m_graphs.push_back(graph);
     }
+    reserve_remote_tensors_pool(*m_context, m_config);
 }
 
 CompiledModel::CompiledModel(cldnn::BinaryInputBuffer ib,
@@ -155,17 +163,37 @@ CompiledModel::CompiledModel(cldnn::BinaryInputBuffer ib,
     auto pos = ib.tellg();
     for (uint16_t n = 0; n < m_config.get_property(ov::num_streams); n++) {
         ib.seekg(pos);
-        auto graph = std::make_shared<Graph>(ib, context, m_config, 0);
+        // The graphs of the secondary streams reuse the constants and the kernels loaded for the first one
+        auto graph = std::make_shared<Graph>(ib, context, m_config, n);
         m_graphs.push_back(graph);
     }
+    reserve_remote_tensors_pool(*m_context, m_config);
 }
 
 std::shared_ptr<ov::IAsyncInferRequest> CompiledModel::create_infer_request() const {
-    auto sync_request = create_sync_infer_request();
-    auto async_infer_request = std::make_shared<AsyncInferRequest>(std::static_pointer_cast<SyncInferRequest>(sync_request),
+    auto sync_request = std::static_pointer_cast<SyncInferRequest>(create_sync_infer_request());
+
+    RequestsMerger::Ptr requests_merger = nullptr;
+    auto merge_timeout = m_config.get_property(ov::intel_gpu::requests_merge_timeout);
+    if (merge_timeout > 0 &&
+        !sync_request->use_external_queue() &&
+        RequestsMerger::is_applicable(inputs(), outputs()) &&
+        get_graph(0)->get_network()->get_variables_state_info().empty()) {
+        std::lock_guard<std::mutex> lock(m_requests_merger_mutex);
+        requests_merger = m_requests_merger.lock();
+        if (!requests_merger) {
+            requests_merger = std::make_shared<RequestsMerger>(std::static_pointer_cast<SyncInferRequest>(create_sync_infer_request()),
+                                                               get_task_executor(),
+                                                               std::chrono::microseconds(merge_timeout));
+            m_requests_merger = requests_merger;
+        }
+    }
+
+    auto async_infer_request = std::make_shared<AsyncInferRequest>(sync_request,
                                                                    get_task_executor(),
                                                                    m_wait_executor,
-                                                                   get_callback_executor());
+                                                                   get_callback_executor(),
+                                                                   requests_merger);
     return async_infer_request;
 }
 
@@ -223,6 +251,8 @@ void CompiledModel::export_model(std::ostream& model) const {
 
     if (is_dynamic) {
         ov::pass::StreamSerialize serializer(model, {}, ov::pass::Serialize::Version::UNSPECIFIED);
+        // the blob is read back by the IR frontend only, the binary encoding saves the XML parsing on the import
+        serializer.set_format(ov::pass::Serialize::Format::BINARY);
         serializer.run_on_model(m_model);
     } else {
         get_graph(0)->export_model(ob);
@@ -306,6 +336,13 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
         return decltype(ov::optimal_number_of_infer_requests)::value_type {nr};
     } else if (name == ov::execution_devices) {
         return decltype(ov::execution_devices)::value_type{m_context->get_device_name()};
+    } else if (name == ov::intel_gpu::buffers_reallocations_num) {
+        size_t reallocations_num = 0;
+        for (const auto& graph : m_graphs) {
+            if (auto network = graph->get_network())
+                reallocations_num += network->get_shape_predictor().get_reallocations_num();
+        }
+        return decltype(ov::intel_gpu::buffers_reallocations_num)::value_type {reallocations_num};
     }
 
     auto actual_name = name;
@@ -277,6 +277,48 @@ std::shared_ptr<ov::Model> Graph::get_runtime_model(std::vector<cldnn::primitive
         return inputs;
     };
 
+    // The bytes of the inputs and the output and the arithmetic operations of the primitives with the known estimation
+    auto add_work_estimation = [&](const cldnn::primitive_info& prim_info, std::map<std::string, std::string>& info) {
+        std::vector<cldnn::layout> inputs;
+        for (auto& dep : prim_info.c_dependencies) {
+            auto dep_it = std::find_if(primitives_info.begin(), primitives_info.end(), [&](cldnn::primitive_info& entry) {
+                return entry.original_id == dep;
+            });
+            if (dep_it == primitives_info.end() || !dep_it->output_layout.is_static())
+                return;
+            inputs.push_back(dep_it->output_layout);
+        }
+        const auto& output = prim_info.output_layout;
+        if (!output.is_static())
+            return;
+
+        int64_t bytes = static_cast<int64_t>(output.bytes_count());
+        for (auto& input : inputs)
+            bytes += static_cast<int64_t>(input.bytes_count());
+        info[ov::exec_model_info::ESTIMATED_BYTES] = std::to_string(bytes);
+
+        const auto output_elements = static_cast<int64_t>(output.count());
+        const auto output_shape = output.get_shape();
+        if ((prim_info.type_id == "convolution" || prim_info.type_id == "fully_connected") && inputs.size() > 1 &&
+            output_shape.size() > 1) {
+            // the weights are [output features, multiply-adds per output element]
+            const auto features =
+                static_cast<int64_t>(prim_info.type_id == "fully_connected" ? output_shape.back() : output_shape[1]);
+            if (features > 0)
+                info[ov::exec_model_info::ESTIMATED_FLOPS] =
+                    std::to_string(2 * output_elements * (static_cast<int64_t>(inputs[1].count()) / features));
+        } else if (prim_info.type_id == "gemm" && inputs.size() > 1 && !output_shape.empty() &&
+                   output_shape.back() > 0 && output_elements > 0) {
+            // [..., M, K] x [..., K, N] = [..., M, N]
+            const auto rows = output_elements / static_cast<int64_t>(output_shape.back());
+            info[ov::exec_model_info::ESTIMATED_FLOPS] =
+                std::to_string(2 * output_elements * (static_cast<int64_t>(inputs[0].count()) / rows));
+        } else if (prim_info.type_id == "eltwise") {
+            info[ov::exec_model_info::ESTIMATED_FLOPS] =
+                std::to_string(output_elements * static_cast<int64_t>(1 + prim_info.c_fused_ids.size()));
+        }
+    };
+
     auto create_ov_node = [&](const cldnn::primitive_info& prim_info) {
         const auto& user_ids = prim_info.c_users;
         size_t output_size = user_ids.size();
@@ -347,6 +389,9 @@ std::shared_ptr<ov::Model> Graph::get_runtime_model(std::vector<cldnn::primitive
         }
         info[ov::exec_model_info::PERF_COUNTER] = exec_time;
 
+        if (prim_info.type_id != "input_layout" && prim_info.type_id != "data")
+            add_work_estimation(prim_info, info);
+
         for (auto&& kvp : info) {
             return_node->get_rt_info()[kvp.first] = kvp.second;
             if (is_output)
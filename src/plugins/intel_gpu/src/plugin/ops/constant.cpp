@@ -19,10 +19,14 @@
 #include "openvino/op/roi_align.hpp"
 #include "openvino/op/variadic_split.hpp"
 #include "openvino/op/util/op_types.hpp"
+#include "intel_gpu/op/fully_connected.hpp"
+#include "intel_gpu/op/fully_connected_compressed.hpp"
 
 #include "intel_gpu/primitives/data.hpp"
 #include "intel_gpu/runtime/debug_configuration.hpp"
 
+#include <algorithm>
+
 namespace ov {
 namespace intel_gpu {
 
@@ -65,8 +69,13 @@ static cldnn::tensor getConstTensor(const ov::Shape constDims) {
 
 struct ConstProperties {
     bool needsBatchInterpretation;
+    bool isWeightsOnly;
 };
 
+// The weights are read directly from the constant buffer (the mapped weights file when the model is read from IR)
+// by the bounded chunks, so the driver stages at most one chunk in the host memory at a time
+static constexpr size_t weights_upload_chunk_size = 64 * 1024 * 1024;
+
 static void create_data(ProgramBuilder& p, const ov::Shape& constDims, const std::shared_ptr<ov::op::v0::Constant>& op, const ConstProperties& props) {
     cldnn::tensor constTensor = getConstTensor(constDims);
     auto constFormat = cldnn::format::get_default_format(constDims.size());
@@ -98,13 +107,27 @@ static void create_data(ProgramBuilder& p, const ov::Shape& constDims, const std
         p.profiling_ids.push_back(initialconstPrimID);
     } else {
         GPU_DEBUG_LOG << "[" << initialconstPrimID << ": constant]" << std::endl;
-        cldnn::memory::ptr mem = p.get_engine().allocate_memory(constLayout, false);
-        auto& stream = p.get_engine().get_service_stream();
-        cldnn::mem_lock<char> lock{mem, stream};
-        auto buf = lock.data();
+        auto& engine = p.get_engine();
+        auto& stream = engine.get_service_stream();
         auto bufSize = constLayout.bytes_count();
+        cldnn::memory::ptr mem = nullptr;
+
+        // The weights only read by the GPU kernels go to the device memory right away instead of the host copy
+        // which is transferred to the device at the program build
+        if (props.isWeightsOnly &&
+            engine.get_device_info().dev_type == cldnn::device_type::discrete_gpu &&
+            engine.supports_allocation(cldnn::allocation_type::usm_device)) {
+            mem = engine.allocate_memory(constLayout, cldnn::allocation_type::usm_device, false);
+            for (size_t offset = 0; offset < bufSize; offset += weights_upload_chunk_size) {
+                mem->copy_from(stream, data, offset, offset, std::min(weights_upload_chunk_size, bufSize - offset), true);
+            }
+        } else {
+            mem = engine.allocate_memory(constLayout, false);
+            cldnn::mem_lock<char> lock{mem, stream};
+            auto buf = lock.data();
 
-        std::memcpy(&buf[0], &data[0], bufSize);
+            std::memcpy(&buf[0], &data[0], bufSize);
+        }
         p.add_primitive(*op, cldnn::data(initialconstPrimID, mem));
         p.blobMemCache[std::make_pair(data, newDims)] = initialconstPrimID;
         constPrimID = initialconstPrimID;
@@ -116,7 +139,7 @@ static void CreateConstantOp(ProgramBuilder& p, const std::shared_ptr<ov::op::v0
     auto constUsers = op->get_output_target_inputs(0);
 
     std::unordered_map<std::shared_ptr<ov::op::v0::Constant>, ConstProperties> consts = {
-        {op, {false}}
+        {op, {false, false}}
     };
 
     auto is_binary_eltwise = [&] (ov::Node* op) -> bool {
@@ -202,6 +225,12 @@ static void CreateConstantOp(ProgramBuilder& p, const std::shared_ptr<ov::op::v0
         }
     }
 
+    consts[op].isWeightsOnly = !constUsers.empty() && std::all_of(constUsers.begin(), constUsers.end(), [](const ov::Input<ov::Node>& user) {
+        auto node = user.get_node();
+        return user.get_index() == 1 && (ov::is_type<ov::intel_gpu::op::FullyConnected>(node) ||
+                                        ov::is_type<ov::intel_gpu::op::FullyConnectedCompressed>(node));
+    });
+
     for (auto& it : consts) {
         create_data(p, constDims, it.first, it.second);
     }
@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "intel_gpu/plugin/program_builder.hpp"
+#include "intel_gpu/plugin/common_utils.hpp"
+
+#include "intel_gpu/op/sdpa.hpp"
+
+#include "intel_gpu/primitives/scaled_dot_product_attention.hpp"
+
+namespace ov {
+namespace op {
+namespace internal {
+using ScaledDotProductAttention = ov::intel_gpu::op::ScaledDotProductAttention;
+}  // namespace internal
+}  // namespace op
+}  // namespace ov
+
+namespace ov {
+namespace intel_gpu {
+
+static void CreateScaledDotProductAttentionOp(ProgramBuilder& p, const std::shared_ptr<op::ScaledDotProductAttention>& op) {
+    validate_inputs_count(op, {3, 4});
+    auto inputs = p.GetInputInfo(op);
+    std::string layerName = layer_type_name_ID(op);
+
+    auto sdpa_prim = cldnn::scaled_dot_product_attention(layerName,
+                                                         inputs,
+                                                         op->get_scale(),
+                                                         op->get_causal());
+
+    p.add_primitive(*op, sdpa_prim);
+}
+
+REGISTER_FACTORY_IMPL(internal, ScaledDotProductAttention);
+
+}  // namespace intel_gpu
+}  // namespace ov
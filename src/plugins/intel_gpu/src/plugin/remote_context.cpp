@@ -9,6 +9,7 @@
 #include "intel_gpu/plugin/remote_allocators.hpp"
 #include "intel_gpu/runtime/itt.hpp"
 #include "intel_gpu/runtime/device_query.hpp"
+#include <algorithm>
 #include <memory>
 
 namespace ov {
@@ -198,6 +199,49 @@ void RemoteContextImpl::add_to_cache(size_t hash, cldnn::memory::ptr memory) {
     m_memory_cache.add(hash, memory);
 }
 
+void RemoteContextImpl::set_memory_pool_capacity(size_t bytes) {
+    std::lock_guard<std::mutex> lock(m_pool_mutex);
+    m_pool_capacity = bytes;
+    while (m_pooled_bytes > m_pool_capacity) {
+        m_pooled_bytes -= m_pooled_memory.front()->size();
+        m_pooled_memory.pop_front();
+    }
+}
+
+size_t RemoteContextImpl::get_memory_pool_capacity() const {
+    std::lock_guard<std::mutex> lock(m_pool_mutex);
+    return m_pool_capacity;
+}
+
+cldnn::memory::ptr RemoteContextImpl::try_get_pooled_memory(const cldnn::layout& layout, cldnn::allocation_type type) {
+    std::lock_guard<std::mutex> lock(m_pool_mutex);
+    auto it = std::find_if(m_pooled_memory.begin(), m_pooled_memory.end(), [&](const cldnn::memory::ptr& memory) {
+        return memory->get_allocation_type() == type && memory->get_layout() == layout;
+    });
+    if (it == m_pooled_memory.end())
+        return nullptr;
+
+    auto memory = *it;
+    m_pooled_bytes -= memory->size();
+    m_pooled_memory.erase(it);
+    return memory;
+}
+
+void RemoteContextImpl::return_to_pool(cldnn::memory::ptr memory) {
+    std::lock_guard<std::mutex> lock(m_pool_mutex);
+    // The memory still referenced by the other owners would be handed out to a new tensor while in use
+    if (!memory || memory.use_count() != 1 || memory->size() > m_pool_capacity)
+        return;
+
+    // The least recently released memory is freed first
+    m_pooled_memory.push_back(memory);
+    m_pooled_bytes += memory->size();
+    while (m_pooled_bytes > m_pool_capacity) {
+        m_pooled_bytes -= m_pooled_memory.front()->size();
+        m_pooled_memory.pop_front();
+    }
+}
+
 std::shared_ptr<ov::IRemoteTensor> RemoteContextImpl::reuse_surface(const ov::element::Type type, const ov::Shape& shape, const ov::AnyMap& params) {
     uint32_t plane = extract_object(params, ov::intel_gpu::va_plane);
 
@@ -92,6 +92,12 @@ const AnyMap& RemoteTensorImpl::get_properties() const {
 }
 
 bool RemoteTensorImpl::deallocate() noexcept {
+    // The memory shared with the other owners (e.g. the memory cache or the network outputs) is not pooled
+    if (m_memory_object && m_memory_object.use_count() == 1 && supports_pooling()) {
+        try {
+            m_context->return_to_pool(std::move(m_memory_object));
+        } catch (...) { }
+    }
     m_memory_object.reset();
     return m_memory_object == nullptr;
 }
@@ -112,6 +118,12 @@ void RemoteTensorImpl::allocate() {
             return;
     }
 
+    if (supports_pooling()) {
+        m_memory_object = context->try_get_pooled_memory(m_layout, get_allocation_type());
+        if (m_memory_object)
+            return;
+    }
+
     auto& engine = context->get_engine();
 
     switch (m_mem_type) {
@@ -131,6 +143,10 @@ void RemoteTensorImpl::allocate() {
         m_memory_object = engine.share_buffer(m_layout, m_mem);
         break;
     }
+    case TensorType::BT_HOST_SHARED: {
+        m_memory_object = engine.share_host_memory(m_layout, m_mem);
+        break;
+    }
     case TensorType::BT_USM_SHARED: {
         m_memory_object = engine.share_usm(m_layout, m_mem);
         break;
@@ -174,11 +190,27 @@ bool RemoteTensorImpl::is_shared() const {
            m_mem_type == TensorType::BT_USM_SHARED ||
            m_mem_type == TensorType::BT_IMG_SHARED ||
            m_mem_type == TensorType::BT_SURF_SHARED ||
-           m_mem_type == TensorType::BT_DX_BUF_SHARED;
+           m_mem_type == TensorType::BT_DX_BUF_SHARED ||
+           m_mem_type == TensorType::BT_HOST_SHARED;
 }
 
 bool RemoteTensorImpl::supports_caching() const {
-    return is_shared();
+    // The host buffers are owned by the user and may be freed and reallocated at the same address after the inference
+    return is_shared() && m_mem_type != TensorType::BT_HOST_SHARED;
+}
+
+bool RemoteTensorImpl::supports_pooling() const {
+    return m_mem_type == TensorType::BT_BUF_INTERNAL ||
+           m_mem_type == TensorType::BT_USM_HOST_INTERNAL ||
+           m_mem_type == TensorType::BT_USM_DEVICE_INTERNAL;
+}
+
+cldnn::allocation_type RemoteTensorImpl::get_allocation_type() const {
+    switch (m_mem_type) {
+    case TensorType::BT_USM_HOST_INTERNAL: return cldnn::allocation_type::usm_host;
+    case TensorType::BT_USM_DEVICE_INTERNAL: return cldnn::allocation_type::usm_device;
+    default: return cldnn::allocation_type::cl_mem;
+    }
 }
 
 bool RemoteTensorImpl::is_surface() const noexcept {
@@ -207,6 +239,7 @@ void RemoteTensorImpl::init_properties() {
     switch (m_mem_type) {
     case TensorType::BT_BUF_INTERNAL:
     case TensorType::BT_BUF_SHARED:
+    case TensorType::BT_HOST_SHARED:
         m_properties = {
             ov::intel_gpu::shared_mem_type(ov::intel_gpu::SharedMemType::OCL_BUFFER),
             ov::intel_gpu::ocl_context(params.context),
@@ -0,0 +1,214 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "intel_gpu/plugin/requests_merger.hpp"
+#include "intel_gpu/runtime/itt.hpp"
+
+#include "openvino/runtime/iremote_tensor.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace ov {
+namespace intel_gpu {
+
+RequestsMerger::RequestsMerger(std::shared_ptr<SyncInferRequest> merged_request,
+                               std::shared_ptr<ov::threading::ITaskExecutor> task_executor,
+                               std::chrono::microseconds timeout)
+    : m_merged_request(merged_request)
+    , m_task_executor(task_executor)
+    , m_timeout(timeout)
+    , m_merged_inputs(merged_request->get_inputs().size()) {
+    m_worker = std::thread([this] { run(); });
+}
+
+RequestsMerger::~RequestsMerger() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_worker.join();
+}
+
+bool RequestsMerger::is_applicable(const std::vector<ov::Output<const ov::Node>>& inputs,
+                                   const std::vector<ov::Output<const ov::Node>>& outputs) {
+    auto has_dynamic_batch = [](const ov::Output<const ov::Node>& port) {
+        const auto& shape = port.get_partial_shape();
+        // The batch slices must start at the byte boundaries
+        return shape.rank().is_static() && shape.size() > 0 && shape[0].is_dynamic() && port.get_element_type().bitwidth() >= 8;
+    };
+    return !inputs.empty() && !outputs.empty() &&
+           std::all_of(inputs.begin(), inputs.end(), has_dynamic_batch) &&
+           std::all_of(outputs.begin(), outputs.end(), has_dynamic_batch);
+}
+
+std::future<void> RequestsMerger::submit(SyncInferRequest& request) {
+    auto job = std::make_shared<Job>();
+    job->request = &request;
+    job->batch = 0;
+    job->arrival = std::chrono::steady_clock::now();
+    auto future = job->promise.get_future();
+
+    if (!m_enabled || !is_mergeable(request, job->batch)) {
+        infer_separately(job);
+        return future;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_jobs.push_back(job);
+    }
+    m_cv.notify_all();
+    return future;
+}
+
+bool RequestsMerger::is_mergeable(const SyncInferRequest& request, size_t& batch) const {
+    // Only the host tensors with the same batch for all the inputs can be concatenated
+    for (const auto& port : request.get_inputs()) {
+        if (!request.get_tensors(port).empty())
+            return false;
+        auto tensor = request.get_tensor(port);
+        if (std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr) || !tensor->is_continuous())
+            return false;
+        const auto& shape = tensor->get_shape();
+        if (shape.empty() || shape[0] == 0 || (batch != 0 && shape[0] != batch))
+            return false;
+        batch = shape[0];
+    }
+    for (const auto& port : request.get_outputs()) {
+        auto tensor = request.get_tensor(port);
+        if (std::dynamic_pointer_cast<ov::IRemoteTensor>(tensor._ptr) || !tensor->is_continuous())
+            return false;
+    }
+    return batch != 0;
+}
+
+bool RequestsMerger::is_compatible(const SyncInferRequest& lhs, const SyncInferRequest& rhs) const {
+    for (const auto& port : lhs.get_inputs()) {
+        const auto& lhs_shape = lhs.get_tensor(port)->get_shape();
+        const auto& rhs_shape = rhs.get_tensor(port)->get_shape();
+        if (lhs_shape.size() != rhs_shape.size() || !std::equal(lhs_shape.begin() + 1, lhs_shape.end(), rhs_shape.begin() + 1))
+            return false;
+    }
+    return true;
+}
+
+std::vector<std::shared_ptr<RequestsMerger::Job>> RequestsMerger::take_compatible_jobs() {
+    std::vector<std::shared_ptr<Job>> jobs = { m_jobs.front() };
+    m_jobs.pop_front();
+    for (auto it = m_jobs.begin(); it != m_jobs.end();) {
+        if (is_compatible(*jobs.front()->request, *(*it)->request)) {
+            jobs.push_back(*it);
+            it = m_jobs.erase(it);
+        } else {
+            it++;
+        }
+    }
+    return jobs;
+}
+
+void RequestsMerger::run() {
+    while (true) {
+        std::vector<std::shared_ptr<Job>> jobs;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv.wait(lock, [this] { return m_stop || !m_jobs.empty(); });
+            if (m_jobs.empty())
+                return;
+
+            // There is nothing to wait for once all the requests of the model are queued
+            auto deadline = m_jobs.front()->arrival + m_timeout;
+            m_cv.wait_until(lock, deadline, [this] { return m_stop || m_jobs.size() >= m_attached_requests; });
+            jobs = take_compatible_jobs();
+        }
+
+        bool merged = false;
+        if (jobs.size() > 1) {
+            try {
+                merged = infer_merged(jobs);
+            } catch (...) {
+                // The requests are repeated one by one, so each of them reports its own error if any
+                merged = false;
+            }
+        }
+
+        if (merged) {
+            for (auto& job : jobs)
+                job->promise.set_value();
+        } else {
+            for (auto& job : jobs)
+                infer_separately(job);
+        }
+    }
+}
+
+bool RequestsMerger::infer_merged(const std::vector<std::shared_ptr<Job>>& jobs) {
+    OV_ITT_SCOPED_TASK(itt::domains::intel_gpu_plugin, "RequestsMerger::infer_merged");
+    size_t total_batch = 0;
+    for (const auto& job : jobs)
+        total_batch += job->batch;
+
+    const auto& inputs = m_merged_request->get_inputs();
+    for (size_t i = 0; i < inputs.size(); i++) {
+        auto shape = jobs.front()->request->get_tensor(inputs[i])->get_shape();
+        shape[0] = total_batch;
+
+        auto& merged_input = m_merged_inputs[i];
+        if (!merged_input)
+            merged_input = ov::make_tensor(inputs[i].get_element_type(), shape);
+        else
+            merged_input->set_shape(shape);
+
+        auto dst = static_cast<uint8_t*>(merged_input->data());
+        for (const auto& job : jobs) {
+            auto tensor = job->request->get_tensor(inputs[i]);
+            std::memcpy(dst, tensor->data(), tensor->get_byte_size());
+            dst += tensor->get_byte_size();
+        }
+        m_merged_request->set_tensor(inputs[i], { merged_input, nullptr });
+    }
+
+    m_merged_request->infer();
+
+    const auto& outputs = m_merged_request->get_outputs();
+    for (const auto& port : outputs) {
+        const auto& shape = m_merged_request->get_tensor(port)->get_shape();
+        if (shape.empty() || shape[0] != total_batch) {
+            m_enabled = false;
+            return false;
+        }
+    }
+
+    for (const auto& port : outputs) {
+        auto merged_output = m_merged_request->get_tensor(port);
+        auto src = static_cast<const uint8_t*>(merged_output->data());
+        const size_t batch_bytes = merged_output->get_byte_size() / total_batch;
+        for (const auto& job : jobs) {
+            auto shape = merged_output->get_shape();
+            shape[0] = job->batch;
+            auto tensor = job->request->get_tensor(port);
+            if (tensor->get_shape() != shape)
+                tensor->set_shape(shape);
+            std::memcpy(tensor->data(), src, job->batch * batch_bytes);
+            src += job->batch * batch_bytes;
+        }
+    }
+    return true;
+}
+
+void RequestsMerger::infer_separately(const std::shared_ptr<Job>& job) {
+    m_task_executor->run([job] {
+        try {
+            job->request->infer();
+            job->promise.set_value();
+        } catch (...) {
+            job->promise.set_exception(std::current_exception());
+        }
+    });
+}
+
+}  // namespace intel_gpu
+}  // namespace ov
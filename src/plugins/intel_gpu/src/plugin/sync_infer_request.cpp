@@ -7,6 +7,7 @@
 #include "openvino/core/parallel.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "transformations/utils/utils.hpp"
+#include "openvino/util/file_util.hpp"
 
 #include "intel_gpu/plugin/sync_infer_request.hpp"
 #include "intel_gpu/plugin/remote_context.hpp"
@@ -19,8 +20,13 @@
 #include "intel_gpu/runtime/debug_configuration.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <fstream>
+#include <iomanip>
 #include <iterator>
+#include <limits>
 #include <memory>
+#include <sstream>
 #include <string>
 #include <map>
 #include <functional>
@@ -28,6 +34,27 @@
 
 namespace {
 
+std::atomic<size_t> requests_counter{0};
+
+std::string escape_json(const std::string& str) {
+    std::string escaped;
+    for (auto c : str) {
+        if (c == '"' || c == '\\')
+            escaped.push_back('\\');
+        escaped.push_back(c);
+    }
+    return escaped;
+}
+
+std::string dims_to_json(const std::vector<size_t>& dims) {
+    std::stringstream ss;
+    ss << "[";
+    for (size_t i = 0; i < dims.size(); i++)
+        ss << (i == 0 ? "" : ",") << dims[i];
+    ss << "]";
+    return ss.str();
+}
+
 inline std::string get_port_name(const ov::Output<const ov::Node>& port, const bool is_legacy_api) {
     std::string name;
     // TODO: Should use tensor name as the port name, but many legacy tests still use legacy name
@@ -204,7 +231,9 @@ SyncInferRequest::SyncInferRequest(const std::shared_ptr<const CompiledModel>& c
     , m_graph(compiled_model->get_graph(0))
     , m_context(std::static_pointer_cast<RemoteContextImpl>(compiled_model->get_context_impl()))
     , m_enable_profiling(m_graph->get_config().get_property(ov::enable_profiling))
-    , m_use_external_queue(m_graph->use_external_queue()) {
+    , m_use_external_queue(m_graph->use_external_queue())
+    , m_kernels_profiling_interval(m_graph->get_config().get_property(ov::intel_gpu::kernels_profiling_interval))
+    , m_request_id(requests_counter++) {
     bool is_legacy_api = !compiled_model->is_new_api();
     init_mappings(is_legacy_api);
     allocate_inputs();
@@ -358,6 +387,10 @@ void SyncInferRequest::enqueue() {
     auto network = m_graph->get_network();
     network->assign_variables_memories();
 
+    m_profile_kernels = m_kernels_profiling_interval > 0 && m_infer_count++ % m_kernels_profiling_interval == 0;
+    if (m_profile_kernels)
+        network->get_stream().start_kernels_profiling();
+
     m_internal_outputs.clear();
     m_internal_outputs = network->execute(dependencies);
 
@@ -441,6 +474,40 @@ void SyncInferRequest::wait() {
     if (m_enable_profiling) {
         m_graph->update_profiling_info();
     }
+
+    if (m_profile_kernels) {
+        m_profile_kernels = false;
+        dump_kernels_profiling(m_graph->get_network()->get_stream().stop_kernels_profiling());
+    }
+}
+
+// Writes the kernels of one inference in the Chrome trace event format with the timestamps relative to the first kernel
+void SyncInferRequest::dump_kernels_profiling(const std::vector<cldnn::kernel_profiling_record>& records) const {
+    auto dir = m_graph->get_config().get_property(ov::intel_gpu::kernels_profiling_path);
+    auto file_name = "gpu_kernels_" + std::to_string(m_request_id) + "_" + std::to_string(m_infer_count - 1) + ".json";
+    auto path = dir.empty() ? file_name : ov::util::path_join({dir, file_name});
+
+    std::ofstream trace(path);
+    OPENVINO_ASSERT(trace.is_open(), "[GPU] Can't open the kernels profiling file ", path);
+
+    uint64_t origin = std::numeric_limits<uint64_t>::max();
+    for (const auto& record : records)
+        origin = std::min(origin, record.start);
+
+    trace << std::fixed << std::setprecision(3);
+    trace << "{\"traceEvents\":[";
+    for (size_t i = 0; i < records.size(); i++) {
+        const auto& record = records[i];
+        trace << (i == 0 ? "\n" : ",\n")
+              << "{\"name\":\"" << escape_json(record.layer_id) << "\",\"cat\":\"kernel\",\"ph\":\"X\",\"pid\":0,\"tid\":0,"
+              << "\"ts\":" << static_cast<double>(record.start - origin) / 1000.0 << ","
+              << "\"dur\":" << static_cast<double>(record.end - record.start) / 1000.0 << ","
+              << "\"args\":{\"kernel\":\"" << escape_json(record.kernel_name) << "\","
+              << "\"gws\":" << dims_to_json(record.gws) << ","
+              << "\"lws\":" << dims_to_json(record.lws) << ","
+              << "\"memory_bytes\":" << record.memory_bytes << "}}";
+    }
+    trace << "\n]}\n";
 }
 
 // ----------------------------------------------------------------------------------------- //
@@ -520,6 +587,14 @@ TensorWrapper SyncInferRequest::create_or_share_device_tensor(const TensorWrappe
         return { create_shared_device_tensor(tensor_shape, element_type, input_ptr), user_tensor_wrapper.owner };
     }
 
+    // The plain host memory of the user is accessed by the integrated GPU in place, if it's suitably aligned
+    bool can_share_host = !is_convert_required(user_tensor->get_element_type(), element_type) &&
+                          m_graph->get_engine().can_share_host_memory(input_ptr, user_tensor->get_byte_size());
+    if (can_share_host) {
+        auto host_shared_tensor = std::make_shared<RemoteTensorImpl>(m_context, tensor_shape, element_type, TensorType::BT_HOST_SHARED, input_ptr);
+        return { host_shared_tensor, user_tensor_wrapper.owner };
+    }
+
     auto actual_memory_shape = tensor_shape;
     if (is_dynamic) {
         auto& shape_predictor = m_graph->get_network()->get_shape_predictor();
@@ -36,7 +36,11 @@ ConvertFullyConnectedToFullyConnectedCompressed::ConvertFullyConnectedToFullyCon
 
     auto transpose_const_m = wrap_type<ov::op::v0::Constant>();
     auto transpose_m = wrap_type<ov::op::v1::Transpose>({mul_m, transpose_const_m});
-    auto weights_input_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{mul_m, transpose_m});
+
+    // The group quantized weights [OC, IC / group_size, group_size] are reshaped to [OC, IC]
+    auto reshape_const_m = wrap_type<ov::op::v0::Constant>();
+    auto reshape_m = wrap_type<ov::op::v1::Reshape>({mul_m, reshape_const_m}, consumers_count(1));
+    auto weights_input_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{mul_m, transpose_m, reshape_m});
 
     auto data_m = any_input();
     auto fully_connected_m = wrap_type<op::FullyConnected>({data_m, weights_input_m});
@@ -53,9 +57,40 @@ ConvertFullyConnectedToFullyConnectedCompressed::ConvertFullyConnectedToFullyCon
         }
 
         const auto& fc_input_a = fc->get_input_node_shared_ptr(0);
-        const auto& scale = pattern_map.at(mul_const_m).get_node_shared_ptr();
+        std::shared_ptr<ov::Node> scale = pattern_map.at(mul_const_m).get_node_shared_ptr();
         std::shared_ptr<ov::Node> optional_zero_point = nullptr;
 
+        const bool grouped = pattern_map.count(reshape_m) > 0;
+        ov::Shape grouped_weights_shape;
+        if (grouped) {
+            const auto& weights_shape = pattern_map.at(weights_m).get_shape();
+            const auto& fc_weights_shape = pattern_map.at(reshape_m).get_shape();
+            if (weights_shape.size() != 3 || fc_weights_shape.size() != 2 ||
+                fc_weights_shape != ov::Shape{weights_shape[0], weights_shape[1] * weights_shape[2]})
+                return false;
+            grouped_weights_shape = fc_weights_shape;
+        }
+
+        // The grouped decompression constants [OC, IC / group_size, 1] are passed to the kernels as [OC, IC / group_size]
+        auto is_grouped_const = [&](const std::shared_ptr<ov::Node>& node) {
+            const auto& shape = node->get_output_shape(0);
+            const auto& weights_shape = pattern_map.at(weights_m).get_shape();
+            return shape == ov::Shape{weights_shape[0], weights_shape[1], 1};
+        };
+        auto reshape_const = [](const std::shared_ptr<ov::Node>& node, const ov::Shape& shape) {
+            const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node);
+            const auto new_constant = std::make_shared<ov::op::v0::Constant>(*constant, shape);
+            ov::copy_runtime_info(constant, new_constant);
+            new_constant->set_friendly_name(constant->get_friendly_name());
+            return new_constant;
+        };
+        if (grouped) {
+            if (!is_grouped_const(scale))
+                return false;
+            const auto& weights_shape = pattern_map.at(weights_m).get_shape();
+            scale = reshape_const(scale, ov::Shape{weights_shape[0], weights_shape[1]});
+        }
+
         ov::NodeVector nodes_to_copy_info{pattern_map.at(fully_connected_m).get_node_shared_ptr(),
                                           pattern_map.at(convert_m).get_node_shared_ptr()};
         if (pattern_map.count(mul_no_sub_m)) {
@@ -69,9 +104,18 @@ ConvertFullyConnectedToFullyConnectedCompressed::ConvertFullyConnectedToFullyCon
         if (with_zero_point) {
             optional_zero_point = pattern_map.at(sub_const_m).get_node_shared_ptr();
             nodes_to_copy_info.push_back(subtract_m);
+            if (grouped && ov::shape_size(optional_zero_point->get_output_shape(0)) != 1) {
+                if (!is_grouped_const(optional_zero_point))
+                    return false;
+                optional_zero_point = reshape_const(optional_zero_point, scale->get_output_shape(0));
+            }
         }
 
         std::shared_ptr<ov::Node> fc_input_b = pattern_map.at(weights_m).get_node_shared_ptr();
+        if (grouped) {
+            fc_input_b = reshape_const(fc_input_b, grouped_weights_shape);
+            nodes_to_copy_info.push_back(pattern_map.at(reshape_m).get_node_shared_ptr());
+        }
         if (pattern_map.count(transpose_m)) {
             const auto& transpose = pattern_map.at(transpose_m).get_node_shared_ptr();
             const auto& transpose_const = pattern_map.at(transpose_const_m).get_node_shared_ptr();
@@ -0,0 +1,59 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "keep_matmul_in_fp32.hpp"
+
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "transformations/rt_info/disable_fp16_compression.hpp"
+
+namespace ov {
+namespace intel_gpu {
+
+namespace {
+// The weights and the probabilities are bounded, their products don't overflow the fp16 accumulation
+bool is_bounded_input(const ov::Output<ov::Node>& input) {
+    auto node = input.get_node_shared_ptr();
+    if (ov::is_type<ov::op::v0::Convert>(node))
+        node = node->get_input_node_shared_ptr(0);
+    return ov::is_type<ov::op::v0::Constant>(node) ||
+           ov::is_type<ov::op::v1::Softmax>(node) ||
+           ov::is_type<ov::op::v8::Softmax>(node);
+}
+}  // namespace
+
+KeepLargeMatMulInFP32::KeepLargeMatMulInFP32(int64_t min_reduction_size) {
+    auto matmul_m = ov::pass::pattern::wrap_type<ov::op::v0::MatMul>({ov::pass::pattern::any_input(ov::pass::pattern::has_static_rank()),
+                                                                      ov::pass::pattern::any_input(ov::pass::pattern::has_static_rank())},
+                                                                     ov::pass::pattern::type_matches(ov::element::f32));
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        auto matmul = std::dynamic_pointer_cast<ov::op::v0::MatMul>(m.get_match_root());
+        if (!matmul || transformation_callback(matmul) || ov::fp16_compression_is_disabled(matmul))
+            return false;
+
+        if (is_bounded_input(matmul->input_value(0)) || is_bounded_input(matmul->input_value(1)))
+            return false;
+
+        const auto& shape_a = matmul->get_input_partial_shape(0);
+        if (shape_a.size() == 0)
+            return false;
+        // The reduction dimension of the 1D input is its only one
+        const auto& k = shape_a.size() > 1 && matmul->get_transpose_a() ? shape_a[shape_a.size() - 2] : shape_a[shape_a.size() - 1];
+        if (k.is_dynamic() || k.get_length() < min_reduction_size)
+            return false;
+
+        ov::disable_fp16_compression(matmul);
+        return false;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(matmul_m, "KeepLargeMatMulInFP32");
+    register_matcher(m, callback);
+}
+
+}  // namespace intel_gpu
+}  // namespace ov
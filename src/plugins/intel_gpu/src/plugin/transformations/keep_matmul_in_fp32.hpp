@@ -0,0 +1,22 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov {
+namespace intel_gpu {
+
+/// Marks the MatMuls of two activations with a long reduction dimension with disable_fp16_compression, so the fp16
+/// compression keeps them in fp32 with the other precision sensitive subgraphs instead of overflowing the fp16 sums.
+/// The MatMuls with the weights and the ones reading the Softmax probabilities keep the inference precision.
+class KeepLargeMatMulInFP32: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("KeepLargeMatMulInFP32", "0");
+    explicit KeepLargeMatMulInFP32(int64_t min_reduction_size = 4096);
+};
+
+}   // namespace intel_gpu
+}   // namespace ov
@@ -0,0 +1,70 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "intel_gpu/op/sdpa.hpp"
+
+namespace ov {
+namespace intel_gpu {
+namespace op {
+
+ScaledDotProductAttention::ScaledDotProductAttention(const ov::Output<Node>& Q,
+                                                     const ov::Output<Node>& K,
+                                                     const ov::Output<Node>& V,
+                                                     float scale,
+                                                     bool is_causal)
+    : Op({Q, K, V}), m_scale(scale), m_is_causal(is_causal) {
+    validate_and_infer_types();
+}
+
+ScaledDotProductAttention::ScaledDotProductAttention(const ov::Output<Node>& Q,
+                                                     const ov::Output<Node>& K,
+                                                     const ov::Output<Node>& V,
+                                                     const ov::Output<Node>& attn_mask,
+                                                     float scale,
+                                                     bool is_causal)
+    : Op({Q, K, V, attn_mask}), m_scale(scale), m_is_causal(is_causal) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ov::Node> ScaledDotProductAttention::clone_with_new_inputs(const ov::OutputVector& new_args) const {
+    check_new_args_count(this, new_args);
+
+    if (new_args.size() == 4)
+        return std::make_shared<ScaledDotProductAttention>(new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_scale, m_is_causal);
+
+    return std::make_shared<ScaledDotProductAttention>(new_args.at(0), new_args.at(1), new_args.at(2), m_scale, m_is_causal);
+}
+
+void ScaledDotProductAttention::validate_and_infer_types() {
+    const auto input_size = get_input_size();
+    NODE_VALIDATION_CHECK(this,
+        input_size == 3 || input_size == 4,
+        "Number of inputs is incorrect. Current value is: ",
+        input_size,
+        ", expected 3 or 4.");
+
+    const auto& q_shape = get_input_partial_shape(0);
+    const auto& v_shape = get_input_partial_shape(2);
+    NODE_VALIDATION_CHECK(this,
+        q_shape.rank().compatible(4) && get_input_partial_shape(1).rank().compatible(4) && v_shape.rank().compatible(4),
+        "Query, key and value are expected to be of rank 4.");
+
+    auto out_shape = ov::PartialShape::dynamic(4);
+    if (q_shape.rank().is_static()) {
+        out_shape = q_shape;
+        out_shape[3] = v_shape.rank().is_static() ? v_shape[3] : ov::Dimension::dynamic();
+    }
+
+    set_output_type(0, get_input_element_type(0), out_shape);
+}
+
+bool ScaledDotProductAttention::visit_attributes(ov::AttributeVisitor &visitor) {
+    visitor.on_attribute("scale", m_scale);
+    visitor.on_attribute("is_causal", m_is_causal);
+    return true;
+}
+
+}  // namespace op
+}  // namespace intel_gpu
+}  // namespace ov
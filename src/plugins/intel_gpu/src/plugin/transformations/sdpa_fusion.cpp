@@ -0,0 +1,215 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "sdpa_fusion.hpp"
+
+#include "intel_gpu/op/sdpa.hpp"
+
+#include "openvino/op/add.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/divide.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/multiply.hpp"
+#include "openvino/op/softmax.hpp"
+#include "openvino/op/transpose.hpp"
+#include "openvino/op/unsqueeze.hpp"
+#include "openvino/core/rt_info.hpp"
+#include "openvino/pass/pattern/op/wrap_type.hpp"
+#include "openvino/pass/pattern/op/or.hpp"
+#include "transformations/utils/utils.hpp"
+
+#include <numeric>
+
+namespace ov {
+namespace intel_gpu {
+
+namespace {
+const std::vector<int64_t> swap_last_dims_order = {0, 1, 3, 2};
+// The head sizes are kept in the private memory of the kernel work items
+constexpr int64_t max_head_size = 256;
+
+bool is_swap_last_dims_transpose(const std::shared_ptr<ov::Node>& node) {
+    const auto transpose = ov::as_type_ptr<ov::op::v1::Transpose>(node);
+    if (!transpose)
+        return false;
+    const auto order = ov::as_type_ptr<ov::op::v0::Constant>(transpose->get_input_node_shared_ptr(1));
+    return order && order->cast_vector<int64_t>() == swap_last_dims_order;
+}
+
+// The constant [1, 1, L, S] mask with zeros for the key positions up to the (right aligned) query position
+// and large negative values after it is the causal mask
+bool is_causal_mask(const std::shared_ptr<ov::Node>& node, const ov::PartialShape& scores_shape) {
+    const auto constant = ov::as_type_ptr<ov::op::v0::Constant>(node);
+    if (!constant || !constant->get_element_type().is_real())
+        return false;
+
+    const auto& shape = constant->get_output_shape(0);
+    if (shape.size() != 4 || shape[0] != 1 || shape[1] != 1 || scores_shape[2].is_dynamic() || scores_shape[3].is_dynamic())
+        return false;
+
+    const auto query_len = static_cast<size_t>(scores_shape[2].get_length());
+    const auto kv_len = static_cast<size_t>(scores_shape[3].get_length());
+    if (shape[2] != query_len || shape[3] != kv_len || kv_len < query_len)
+        return false;
+
+    const auto values = constant->cast_vector<float>();
+    for (size_t l = 0; l < query_len; l++) {
+        for (size_t s = 0; s < kv_len; s++) {
+            const float value = values[l * kv_len + s];
+            const bool masked = s > l + kv_len - query_len;
+            if (masked ? value > -10000.f : value != 0.f)
+                return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+ScaledDotProductAttentionFusion::ScaledDotProductAttentionFusion() {
+    using namespace ov::pass::pattern;
+
+    auto query_m = any_input(has_static_rank());
+    auto key_m = any_input(has_static_rank());
+    auto qk_m = wrap_type<ov::op::v0::MatMul>({query_m, key_m}, consumers_count(1));
+
+    auto scale_const_m = wrap_type<ov::op::v0::Constant>();
+    auto scaled_mul_m = wrap_type<ov::op::v1::Multiply>({qk_m, scale_const_m}, consumers_count(1));
+    auto scaled_div_m = wrap_type<ov::op::v1::Divide>({qk_m, scale_const_m}, consumers_count(1));
+    auto scores_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{qk_m, scaled_mul_m, scaled_div_m});
+
+    auto mask_m = any_input(has_static_rank());
+    auto masked_m = wrap_type<ov::op::v1::Add>({scores_m, mask_m}, consumers_count(1));
+    auto softmax_input_m = std::make_shared<ov::pass::pattern::op::Or>(ov::OutputVector{scores_m, masked_m});
+
+    auto softmax_m = wrap_type<ov::op::v1::Softmax, ov::op::v8::Softmax>({softmax_input_m}, consumers_count(1));
+    auto value_m = any_input(has_static_rank());
+    auto output_m = wrap_type<ov::op::v0::MatMul>({softmax_m, value_m});
+
+    ov::matcher_pass_callback callback = [=](ov::pass::pattern::Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto output = ov::as_type_ptr<ov::op::v0::MatMul>(pattern_map.at(output_m).get_node_shared_ptr());
+        const auto qk = ov::as_type_ptr<ov::op::v0::MatMul>(pattern_map.at(qk_m).get_node_shared_ptr());
+        if (!output || !qk || transformation_callback(output))
+            return false;
+
+        if (qk->get_transpose_a() || output->get_transpose_a() || output->get_transpose_b())
+            return false;
+
+        const auto softmax = pattern_map.at(softmax_m).get_node_shared_ptr();
+        int64_t softmax_axis = 0;
+        if (const auto softmax_v1 = ov::as_type_ptr<ov::op::v1::Softmax>(softmax)) {
+            softmax_axis = static_cast<int64_t>(softmax_v1->get_axis());
+        } else {
+            softmax_axis = ov::as_type_ptr<ov::op::v8::Softmax>(softmax)->get_axis();
+        }
+        if (softmax_axis != -1 && softmax_axis != 3)
+            return false;
+
+        ov::Output<ov::Node> query = pattern_map.at(query_m);
+        ov::Output<ov::Node> key = pattern_map.at(key_m);
+        ov::Output<ov::Node> value = pattern_map.at(value_m);
+        const auto element_type = query.get_element_type();
+        if ((element_type != ov::element::f32 && element_type != ov::element::f16) ||
+            key.get_element_type() != element_type || value.get_element_type() != element_type)
+            return false;
+
+        // The kernels expect K as [B, H, S, D], so the keys transposed for the MatMul are taken before the transposition
+        ov::NodeVector new_nodes;
+        if (!qk->get_transpose_b()) {
+            if (is_swap_last_dims_transpose(key.get_node_shared_ptr())) {
+                key = key.get_node_shared_ptr()->input_value(0);
+            } else {
+                auto order = ov::op::v0::Constant::create(ov::element::i64, ov::Shape{4}, swap_last_dims_order);
+                auto transpose = std::make_shared<ov::op::v1::Transpose>(key, order);
+                new_nodes.push_back(transpose);
+                key = transpose;
+            }
+        }
+
+        const auto& q_shape = query.get_partial_shape();
+        const auto& k_shape = key.get_partial_shape();
+        const auto& v_shape = value.get_partial_shape();
+        if (q_shape.size() != 4 || k_shape.size() != 4 || v_shape.size() != 4)
+            return false;
+        // The head sizes are compiled into the kernels
+        if (q_shape[3].is_dynamic() || k_shape[3] != q_shape[3] || v_shape[3].is_dynamic())
+            return false;
+        if (q_shape[3].get_length() > max_head_size || v_shape[3].get_length() > max_head_size)
+            return false;
+        // The batch is not broadcast by the kernels
+        if (!q_shape[0].compatible(k_shape[0]) || !q_shape[0].compatible(v_shape[0]))
+            return false;
+        // The key and value heads are shared by the equal groups of the query heads, the number of the groups is
+        // compiled into the kernels
+        if (q_shape[1].is_dynamic() || k_shape[1].is_dynamic() || v_shape[1] != k_shape[1] ||
+            k_shape[1].get_length() == 0 || q_shape[1].get_length() % k_shape[1].get_length() != 0)
+            return false;
+
+        float scale = 1.0f;
+        const bool has_scale = pattern_map.count(scaled_mul_m) || pattern_map.count(scaled_div_m);
+        if (has_scale) {
+            const auto scale_const = ov::as_type_ptr<ov::op::v0::Constant>(pattern_map.at(scale_const_m).get_node_shared_ptr());
+            if (ov::shape_size(scale_const->get_output_shape(0)) != 1 || !scale_const->get_element_type().is_real())
+                return false;
+            scale = scale_const->cast_vector<float>()[0];
+            if (pattern_map.count(scaled_div_m)) {
+                if (scale == 0.0f)
+                    return false;
+                scale = 1.0f / scale;
+            }
+        }
+
+        bool is_causal = false;
+        ov::Output<ov::Node> mask;
+        const bool has_mask = pattern_map.count(masked_m) > 0;
+        if (has_mask) {
+            mask = pattern_map.at(mask_m);
+            const auto& scores_shape = qk->get_output_partial_shape(0);
+            const auto& mask_shape = mask.get_partial_shape();
+            if (mask_shape.size() > 4)
+                return false;
+            const size_t rank_diff = 4 - mask_shape.size();
+            for (size_t i = 0; i < mask_shape.size(); i++) {
+                if (mask_shape[i] != 1 && !mask_shape[i].compatible(scores_shape[i + rank_diff]))
+                    return false;
+            }
+
+            if (is_causal_mask(mask.get_node_shared_ptr(), scores_shape)) {
+                is_causal = true;
+            } else if (rank_diff > 0) {
+                std::vector<int64_t> axes(rank_diff);
+                std::iota(axes.begin(), axes.end(), 0);
+                auto unsqueeze = std::make_shared<ov::op::v0::Unsqueeze>(mask, ov::op::v0::Constant::create(ov::element::i64, {rank_diff}, axes));
+                new_nodes.push_back(unsqueeze);
+                mask = unsqueeze;
+            }
+        }
+
+        std::shared_ptr<ov::Node> sdpa = nullptr;
+        if (has_mask && !is_causal) {
+            sdpa = std::make_shared<op::ScaledDotProductAttention>(query, key, value, mask, scale, is_causal);
+        } else {
+            sdpa = std::make_shared<op::ScaledDotProductAttention>(query, key, value, scale, is_causal);
+        }
+        new_nodes.push_back(sdpa);
+
+        ov::NodeVector nodes_to_copy_info{qk, softmax, output};
+        for (const auto& node : {scaled_mul_m, scaled_div_m, masked_m}) {
+            if (pattern_map.count(node))
+                nodes_to_copy_info.push_back(pattern_map.at(node).get_node_shared_ptr());
+        }
+
+        sdpa->set_friendly_name(output->get_friendly_name());
+        ov::copy_runtime_info(nodes_to_copy_info, new_nodes);
+        ov::replace_node(output, sdpa);
+
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(output_m, "ScaledDotProductAttentionFusion");
+    this->register_matcher(m, callback);
+}
+
+}  // namespace intel_gpu
+}  // namespace ov
@@ -0,0 +1,21 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "openvino/pass/graph_rewrite.hpp"
+
+namespace ov {
+namespace intel_gpu {
+
+/// Fuses MatMul(Q, K^T) -> [Multiply(scale)] -> [Add(mask)] -> Softmax -> MatMul(V) into the ScaledDotProductAttention op,
+/// so the [B, H, L, S] scores are not materialized. The constant causal masks are replaced with the is_causal attribute.
+class ScaledDotProductAttentionFusion: public ov::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ScaledDotProductAttentionFusion", "0");
+    ScaledDotProductAttentionFusion();
+};
+
+}   // namespace intel_gpu
+}   // namespace ov
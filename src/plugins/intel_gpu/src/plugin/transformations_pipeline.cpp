@@ -28,6 +28,7 @@
 #include "openvino/op/normalize_l2.hpp"
 #include "openvino/op/convolution.hpp"
 #include "openvino/op/group_conv.hpp"
+#include "openvino/op/fake_quantize.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/util/sub_graph_base.hpp"
 
@@ -51,6 +52,7 @@
 #include "transformations/fp16_compression/mark_decompression_convert_constant_folding.hpp"
 #include "transformations/fp16_compression/convert_compression_only_to_legacy.hpp"
 #include "transformations/common_optimizations/common_optimizations.hpp"
+#include "transformations/common_optimizations/matmul_horizontal_fusion.hpp"
 #include "transformations/common_optimizations/lin_op_sequence_fusion.hpp"
 #include "transformations/common_optimizations/weights_dequantize_to_fake_quantize.hpp"
 #include "transformations/common_optimizations/convert_quantize_dequantize.hpp"
@@ -112,12 +114,15 @@
 #include "plugin/transformations/convert_matmul_to_fc.hpp"
 #include "plugin/transformations/move_fc_reshape_to_weights.hpp"
 #include "plugin/transformations/convert_fc_to_compressed.hpp"
+#include "plugin/transformations/sdpa_fusion.hpp"
+#include "plugin/transformations/keep_matmul_in_fp32.hpp"
 
 #include "transformations/low_precision/mark_dequantization_subgraph.hpp"
 #include "low_precision/pull_reshape_through_dequantization.hpp"
 #include "low_precision/pull_transpose_through_dequantization.hpp"
 #include "low_precision/convolution.hpp"
 #include "low_precision/convolution_backprop_data.hpp"
+#include "low_precision/fake_quantize_decomposition.hpp"
 #include "low_precision/group_convolution.hpp"
 #include "low_precision/low_precision.hpp"
 #include "low_precision/mat_mul.hpp"
@@ -139,6 +144,50 @@ static bool disable_reduce_decomposition(const std::shared_ptr<const ov::Node> n
     }
     return false;
 }
+
+bool is_quantized_convolution(const std::shared_ptr<const ov::Node>& node) {
+    if (!ov::is_type<ov::op::v1::Convolution>(node) && !ov::is_type<ov::op::v1::GroupConvolution>(node))
+        return false;
+    auto activations = ov::as_type_ptr<const ov::op::v0::FakeQuantize>(node->get_input_node_shared_ptr(0));
+    auto weights = ov::as_type_ptr<const ov::op::v0::FakeQuantize>(node->get_input_node_shared_ptr(1));
+    return activations && weights && ov::is_type<ov::op::v0::Constant>(weights->get_input_node_shared_ptr(0));
+}
+
+// Returns the FakeQuantize nodes of the quantized convolutions which are better executed in fp16. An int8 convolution
+// surrounded by the fp16 layers gets a quantizing reorder on the input and a dequantizing one on the output, which
+// the int8 kernel wins back only when it has enough MACs per moved activation element. The required intensity is
+// lower on the devices with the int8 systolic arrays since their int8 kernels gain more over fp16.
+std::unordered_set<const ov::Node*> plan_fp16_convolutions(const std::shared_ptr<const ov::Model>& model, const cldnn::device_info& info) {
+    const size_t min_macs_per_element = info.supports_immad ? 16 : 64;
+    std::unordered_set<const ov::Node*> fp16_fake_quantizes;
+    for (const auto& node : model->get_ordered_ops()) {
+        if (!is_quantized_convolution(node) || node->is_dynamic())
+            continue;
+
+        auto activations = node->get_input_node_shared_ptr(0);
+        auto weights = node->get_input_node_shared_ptr(1);
+        if (activations->get_output_target_inputs(0).size() != 1 || activations->get_input_partial_shape(0).is_dynamic())
+            continue;
+        // The int8 producer or consumer convolutions keep the data quantized across the boundary without a reorder
+        if (is_quantized_convolution(activations->get_input_node_shared_ptr(0)))
+            continue;
+        const auto& consumers = node->get_output_target_inputs(0);
+        if (std::any_of(consumers.begin(), consumers.end(), [](const ov::Input<ov::Node>& consumer) {
+                return ov::is_type<ov::op::v0::FakeQuantize>(consumer.get_node());
+            }))
+            continue;
+
+        const auto& out_shape = node->get_output_shape(0);
+        const size_t out_elements = ov::shape_size(out_shape);
+        const size_t in_elements = ov::shape_size(node->get_input_shape(0));
+        const size_t macs = out_elements * ov::shape_size(weights->get_output_shape(0)) / out_shape[1];
+        if (macs < min_macs_per_element * (in_elements + out_elements)) {
+            fp16_fake_quantizes.insert(activations.get());
+            fp16_fake_quantizes.insert(weights.get());
+        }
+    }
+    return fp16_fake_quantizes;
+}
 }  // namespace
 
 namespace ov {
@@ -231,12 +280,16 @@ void TransformationsPipeline::apply(std::shared_ptr<ov::Model> func) {
 
         const bool keep_precision_sensitive_in_fp32_1 = true;
         const bool convert_input_output_precision = false;
+        // the long fp16 sums of two activations overflow, such MatMuls stay in fp32 as the other sensitive subgraphs
+        if (fp_convert_precision_map.count(ov::element::f32) && fp_convert_precision_map[ov::element::f32] == ov::element::f16)
+            manager.register_pass<KeepLargeMatMulInFP32>();
         manager.register_pass<ov::pass::ConvertPrecision>(fp_convert_precision_map,
                                                           empty_fuse_map,
                                                           keep_precision_sensitive_in_fp32_1,
                                                           convert_input_output_precision);
 
         manager.register_pass<ov::pass::CommonOptimizations>();
+        manager.register_pass<ov::pass::MatMulHorizontalFusion>();
 
         manager.register_pass<ov::pass::WrapInterpolateIntoTransposes>();
         manager.register_pass<ov::pass::TransposeSinking>();
@@ -534,6 +587,13 @@ void TransformationsPipeline::apply(std::shared_ptr<ov::Model> func) {
             }
             return false;
         });
+        if (config.get_property(ov::intel_gpu::plan_layers_precision)) {
+            // The FakeQuantize nodes left undecomposed are executed as the fp16 quantize of the fp16 convolution
+            auto fp16_fake_quantizes = plan_fp16_convolutions(func, device_info);
+            lptPassConfig->set_callback<FakeQuantizeDecompositionTransformation>([fp16_fake_quantizes](const_node_ptr& node) -> bool {
+                return fp16_fake_quantizes.count(node.get()) != 0;
+            });
+        }
         lptPassConfig->set_callback<ConvolutionBackpropDataTransformation>([func, defaultPrecisions](const_node_ptr& node) -> bool {
             auto fillStaticChannel = [func](const ov::PartialShape& shape, size_t& channel) -> bool {
                 const auto rank = shape.rank();
@@ -634,6 +694,7 @@ void TransformationsPipeline::apply(std::shared_ptr<ov::Model> func) {
 
     {
         ov::pass::Manager manager;
+        manager.register_pass<ov::intel_gpu::ScaledDotProductAttentionFusion>();
         manager.register_pass<ov::intel_gpu::ConvertMatMulToFullyConnected>();
         manager.register_pass<ov::intel_gpu::MoveFCReshapeToWeights>();
         manager.register_pass<ov::intel_gpu::ConvertFullyConnectedToFullyConnectedCompressed>();
@@ -49,5 +49,10 @@ const ov::SoPtr<ov::ITensor>& VariableState::get_state() const {
     return m_state;
 }
 
+void VariableState::truncate(int64_t /* axis */, size_t /* length */) {
+    // read_value expects the variable memory of its static output layout, so the state can't change its shape
+    OPENVINO_THROW("[GPU] The truncation of the variable state ", get_name(), " is not supported");
+}
+
 }  // namespace intel_gpu
 }  // namespace ov
@@ -11,6 +11,7 @@
 
 #include "ocl/ocl_engine_factory.hpp"
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <memory>
@@ -160,6 +161,27 @@ memory_ptr engine::share_usm(const layout& layout, shared_handle usm_ptr) {
     return reinterpret_handle(layout, params);
 }
 
+memory_ptr engine::share_host_memory(const layout& layout, void* host_ptr) {
+    shared_mem_params params = { shared_mem_type::shared_mem_host_ptr, nullptr, nullptr, host_ptr,
+#ifdef _WIN32
+        nullptr,
+#else
+        0,
+#endif
+        0 };
+    return reinterpret_handle(layout, params);
+}
+
+bool engine::can_share_host_memory(const void* host_ptr, size_t size) const {
+    // The zero-copy access to the host pointer requires the page aligned pointer and the cache line multiple size
+    constexpr size_t host_ptr_alignment = 4096;
+    constexpr size_t host_size_alignment = 64;
+    return get_device_info().dev_type == device_type::integrated_gpu &&
+           host_ptr != nullptr && size > 0 &&
+           reinterpret_cast<uintptr_t>(host_ptr) % host_ptr_alignment == 0 &&
+           size % host_size_alignment == 0;
+}
+
 memory::ptr engine::share_image(const layout& layout, shared_handle img) {
     shared_mem_params params = { shared_mem_type::shared_mem_image, nullptr, nullptr, img,
 #ifdef _WIN32
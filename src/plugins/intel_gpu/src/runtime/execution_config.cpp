@@ -73,7 +73,14 @@ void ExecutionConfig::set_default() {
         std::make_tuple(ov::intel_gpu::partial_build_program, false),
         std::make_tuple(ov::intel_gpu::allow_new_shape_infer, false),
         std::make_tuple(ov::intel_gpu::use_only_static_kernels_for_dynamic_shape, false),
-        std::make_tuple(ov::intel_gpu::buffers_preallocation_ratio, 1.1f));
+        std::make_tuple(ov::intel_gpu::buffers_preallocation_ratio, 1.1f),
+        std::make_tuple(ov::intel_gpu::tuning_cache_path, ""),
+        std::make_tuple(ov::intel_gpu::sdpa_fp16_accumulation, false),
+        std::make_tuple(ov::intel_gpu::requests_merge_timeout, 0),
+        std::make_tuple(ov::intel_gpu::kernels_profiling_interval, 0),
+        std::make_tuple(ov::intel_gpu::kernels_profiling_path, ""),
+        std::make_tuple(ov::intel_gpu::remote_tensors_pool_size, 0),
+        std::make_tuple(ov::intel_gpu::plan_layers_precision, false));
 }
 
 void ExecutionConfig::register_property_impl(const std::pair<std::string, ov::Any>& property, PropertyVisibility visibility, BaseValidator::Ptr validator) {
@@ -14,6 +14,7 @@
 #include "intel_gpu/runtime/debug_configuration.hpp"
 #include "intel_gpu/runtime/itt.hpp"
 #include "intel_gpu/runtime/file_util.hpp"
+#include "intel_gpu/runtime/lru_cache.hpp"
 
 #ifdef WIN32
 #include <sdkddkver.h>
@@ -23,6 +24,7 @@
 #endif
 
 #include <algorithm>
+#include <array>
 #include <cassert>
 #include <sstream>
 #include <fstream>
@@ -37,7 +39,29 @@
 #endif
 
 namespace {
-std::mutex cacheAccessMutex;
+// The accesses to the cache files are serialized per the file, so the different batches are loaded and saved in parallel
+constexpr size_t cache_access_mutexes_num = 32;
+std::mutex& get_cache_access_mutex(size_t hash_value) {
+    static std::array<std::mutex, cache_access_mutexes_num> mutexes;
+    return mutexes[hash_value % cache_access_mutexes_num];
+}
+
+// The binaries of the programs built or loaded from the cache_dir in the process, addressed by the batch hash of the
+// options, the device and the full source code, so the identical programs of the different compiled models (e.g. the
+// common reorders) are not read from the disk again. The host memory taken by the cache is bounded by the number of the
+// programs and the size of a single program binary
+constexpr size_t programs_binaries_cache_capacity = 64;
+constexpr size_t max_cached_program_binary_size = 4 * 1024 * 1024;
+using programs_binaries_cache = cldnn::LruCacheThreadSafe<size_t, std::shared_ptr<std::vector<unsigned char>>>;
+programs_binaries_cache& get_programs_binaries_cache() {
+    static programs_binaries_cache cache(programs_binaries_cache_capacity);
+    return cache;
+}
+
+void add_program_binary(size_t hash_value, const std::shared_ptr<std::vector<unsigned char>>& binary) {
+    if (binary->size() <= max_cached_program_binary_size)
+        get_programs_binaries_cache().add(hash_value, binary);
+}
 
 std::string reorder_options(const std::string& org_options) {
     std::stringstream ss(org_options);
@@ -233,15 +257,21 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
     cl::Program::Binaries precompiled_kernels = {};
 
     if (is_cache_enabled()) {
-        // Try to load file with name ${hash_value}.cl_cache which contains precompiled kernels for current bucket
-        // If read is successful, then remove kernels from compilation bucket
-        std::vector<uint8_t> bin;
-        {
-            std::lock_guard<std::mutex> lock(cacheAccessMutex);
-            bin = ov::util::load_binary(cached_bin_name);
-        }
-        if (!bin.empty()) {
-            precompiled_kernels.push_back(bin);
+        if (auto built_bin = get_programs_binaries_cache().get(batch.hash_value)) {
+            // The same program was already built or loaded by this or another kernels cache in the process
+            precompiled_kernels.push_back(*built_bin);
+        } else {
+            // Try to load file with name ${hash_value}.cl_cache which contains precompiled kernels for current bucket
+            // If read is successful, then remove kernels from compilation bucket
+            std::vector<uint8_t> bin;
+            {
+                std::lock_guard<std::mutex> lock(get_cache_access_mutex(batch.hash_value));
+                bin = ov::util::load_binary(cached_bin_name);
+            }
+            if (!bin.empty()) {
+                precompiled_kernels.push_back(bin);
+                add_program_binary(batch.hash_value, std::make_shared<std::vector<unsigned char>>(std::move(bin)));
+            }
         }
     }
     try {
@@ -271,8 +301,12 @@ void kernels_cache::build_batch(const engine& build_engine, const batch_program&
                 // Note: Bin file contains full bucket, not separate kernels, so kernels reuse across different models is quite limited
                 // Bucket size can be changed in get_max_kernels_per_batch() method, but forcing it to 1 will lead to much longer
                 // compile time.
-                std::lock_guard<std::mutex> lock(cacheAccessMutex);
-                ov::intel_gpu::save_binary(cached_bin_name, getProgramBinaries(program));
+                auto binaries = std::make_shared<std::vector<unsigned char>>(getProgramBinaries(program));
+                {
+                    std::lock_guard<std::mutex> lock(get_cache_access_mutex(batch.hash_value));
+                    ov::intel_gpu::save_binary(cached_bin_name, *binaries);
+                }
+                add_program_binary(batch.hash_value, binaries);
             }
         } else {
             cl::Program program(cl_build_engine.get_cl_context(), {cl_build_engine.get_cl_device()}, precompiled_kernels);
@@ -425,6 +459,18 @@ void kernels_cache::build_all() {
 #endif
 
     if (_task_executor && use_threads) {
+        // The most expensive batches are scheduled first, so the long builds don't remain at the tail of the parallel build.
+        // The build time is estimated by the source code size
+        auto get_build_cost = [](const batch_program& batch) {
+            size_t cost = 0;
+            for (const auto& source : batch.source)
+                cost += source.size();
+            return cost;
+        };
+        std::stable_sort(batches.begin(), batches.end(), [&](const batch_program& lhs, const batch_program& rhs) {
+            return get_build_cost(lhs) > get_build_cost(rhs);
+        });
+
         std::exception_ptr exception;
         std::vector<ov::threading::Task> tasks;
         for (size_t idx = 0; idx < batches.size(); idx++) {
@@ -543,47 +589,90 @@ void kernels_cache::save(BinaryOutputBuffer& ob) const {
 void kernels_cache::load(BinaryInputBuffer& ib) {
     OPENVINO_ASSERT(_engine.type() == engine_types::ocl, "[GPU] Not supported engine type");
 
-    std::unordered_map<uint32_t, std::vector<unsigned char>> precompiled_kernels;
+    // The binaries are only indexed here, the programs are built by build_cached_kernels() for the kernels in use
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cached_kernels.clear();
+    _precompiled_binaries.clear();
 
     size_t num_cached_binaries;
     ib >> num_cached_binaries;
     for (size_t i = 0; i < num_cached_binaries; ++i) {
         uint32_t id;
         ib >> id;
-        ib >> precompiled_kernels[id];
+        ib >> _precompiled_binaries[id];
+    }
+}
+
+void kernels_cache::build_cached_kernels(const std::vector<std::string>& cached_kernel_ids) {
+    OV_ITT_SCOPED_TASK(ov::intel_gpu::itt::domains::intel_gpu_plugin, "KernelsCache::BuildCachedKernels");
+    OPENVINO_ASSERT(_engine.type() == engine_types::ocl, "[GPU] Not supported engine type");
+
+    // The cached kernel id is "<entry point>@<binary id>"
+    std::set<uint32_t> used_binaries;
+    for (const auto& cached_kernel_id : cached_kernel_ids) {
+        auto pos = cached_kernel_id.rfind('@');
+        OPENVINO_ASSERT(pos != std::string::npos, "[GPU] Invalid cached kernel id ", cached_kernel_id);
+        used_binaries.insert(static_cast<uint32_t>(std::stoul(cached_kernel_id.substr(pos + 1))));
     }
 
     std::unique_ptr<ocl::ocl_engine> build_engine =
         cldnn::make_unique<ocl::ocl_engine>(_engine.get_device(), runtime_types::ocl);
 
-    try {
-        std::lock_guard<std::mutex> lock(_mutex);
-        _cached_kernels.clear();
+    std::mutex build_mutex;
+    std::exception_ptr exception;
+    auto build_binary = [&](uint32_t binary_id) {
+        try {
+            auto binary = _precompiled_binaries.find(binary_id);
+            OPENVINO_ASSERT(binary != _precompiled_binaries.end(), "[GPU] Kernel binary ", binary_id, " not found in the model cache");
 
-        for (auto& precompiled_kernel : precompiled_kernels) {
             cl::vector<cl::Kernel> kernels;
-            cl::Program program(build_engine->get_cl_context(), {build_engine->get_cl_device()}, {precompiled_kernel.second});
+            cl::Program program(build_engine->get_cl_context(), {build_engine->get_cl_device()}, {binary->second});
             program.build({build_engine->get_cl_device()});
             program.createKernels(&kernels);
 
+            std::lock_guard<std::mutex> lock(build_mutex);
             for (auto& k : kernels) {
                 const auto& entry_point = k.getInfo<CL_KERNEL_FUNCTION_NAME>();
-                std::string cached_kernel_id = entry_point + "@" + std::to_string(precompiled_kernel.first);
-                const auto& iter = _cached_kernels.find(cached_kernel_id);
-                if (iter == _cached_kernels.end()) {
+                std::string cached_kernel_id = entry_point + "@" + std::to_string(binary_id);
+                if (_cached_kernels.find(cached_kernel_id) == _cached_kernels.end()) {
                     cl_kernel cl_kernel = k.get();
                     cl_context cl_context = build_engine->get_cl_context().get();
-                    kernel::ptr kernel = kernels_factory::create(_engine, cl_context, cl_kernel, entry_point);
-                    _cached_kernels[cached_kernel_id] = kernel;
+                    _cached_kernels[cached_kernel_id] = kernels_factory::create(_engine, cl_context, cl_kernel, entry_point);
                 }
             }
+        } catch (const cl::BuildError& err) {
+            std::string err_log = "";
+            for (auto& p : err.getBuildLog()) {
+                err_log += p.second + '\n';
+            }
+            std::lock_guard<std::mutex> lock(build_mutex);
+            exception = std::make_exception_ptr(ov::Exception(err_log));
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(build_mutex);
+            exception = std::current_exception();
         }
-    } catch (const cl::BuildError& err) {
-        std::string err_log = "";
-        for (auto& p : err.getBuildLog()) {
-            err_log += p.second + '\n';
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_task_executor && used_binaries.size() > 1) {
+            std::vector<ov::threading::Task> tasks;
+            for (auto binary_id : used_binaries) {
+                tasks.push_back([&build_binary, binary_id] { build_binary(binary_id); });
+            }
+            _task_executor->run_and_wait(tasks);
+        } else {
+            for (auto binary_id : used_binaries) {
+                build_binary(binary_id);
+            }
         }
-        OPENVINO_THROW(err_log);
+
+        // The binaries of the kernels which are not used by the network are never built
+        _precompiled_binaries.clear();
+    }
+
+    if (exception) {
+        std::rethrow_exception(exception);
     }
 }
 
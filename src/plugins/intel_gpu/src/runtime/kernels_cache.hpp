@@ -83,6 +83,7 @@ private:
     compiled_kernels _kernels;
     std::map<std::vector<unsigned char>, uint32_t> _cached_binaries;
     std::unordered_map<std::string, kernel::ptr> _cached_kernels;
+    std::unordered_map<uint32_t, std::vector<unsigned char>> _precompiled_binaries;
     std::vector<std::string> batch_header_str;
     std::unordered_map<kernel_impl_params, size_t, impl_hasher> _kernel_batch_hash;
     void get_program_source(const kernels_code& kernels_source_code, std::vector<batch_program>*) const;
@@ -129,6 +130,8 @@ public:
 
     void save(BinaryOutputBuffer& ob) const;
     void load(BinaryInputBuffer& ib);
+    // Builds the loaded binaries containing the given cached kernels, the other binaries are released
+    void build_cached_kernels(const std::vector<std::string>& cached_kernel_ids);
 };
 
 }  // namespace cldnn
@@ -30,6 +30,16 @@ memory::ptr memory_pool::alloc_memory(const layout& layout, allocation_type type
 
 memory_pool::~memory_pool() {}
 
+uint64_t memory_pool::get_size_class(uint64_t bytes_count) const {
+    uint64_t size_class = 1;
+    while (size_class < bytes_count)
+        size_class <<= 1;
+    // the rounding must not make the allocation fail
+    if (size_class > _engine->get_device_info().max_alloc_mem_size)
+        return bytes_count;
+    return size_class;
+}
+
 bool memory_pool::has_conflict(const memory_set& a,
                                const std::set<primitive_id>& b,
                                uint32_t b_network_id) {
@@ -120,7 +130,8 @@ memory::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
                                                   uint32_t network_id,
                                                   const std::set<primitive_id>& restrictions,
                                                   allocation_type type,
-                                                  bool reset) {
+                                                  bool reset,
+                                                  bool is_dynamic) {
     auto it = _non_padded_pool.lower_bound(layout.bytes_count());
     while (it != _non_padded_pool.end()) {
         if (it->second._network_id == network_id &&
@@ -139,6 +150,15 @@ memory::ptr memory_pool::get_from_non_padded_pool(const layout& layout,
     }
     GPU_DEBUG_LOG << "[" << id << ": output]" << std::endl;
     // didn't find anything for you? create new resource
+    if (is_dynamic) {
+        const auto size_class = get_size_class(layout.bytes_count());
+        if (size_class > layout.bytes_count()) {
+            const cldnn::layout class_layout(ov::PartialShape{static_cast<int64_t>(size_class)}, data_types::u8, format::bfyx);
+            auto mem = alloc_memory(class_layout, type, reset);
+            _non_padded_pool.emplace(size_class, memory_record({{id, network_id}}, mem, network_id, type));
+            return _engine->reinterpret_buffer(*mem, layout);
+        }
+    }
     auto mem = alloc_memory(layout, type, reset);
     {
         _non_padded_pool.emplace(layout.bytes_count(),
@@ -222,7 +242,8 @@ memory::ptr memory_pool::get_memory(const layout& layout,
                                     const std::set<primitive_id>& restrictions,
                                     allocation_type type,
                                     bool reusable_across_network,
-                                    bool reset) {
+                                    bool reset,
+                                    bool is_dynamic) {
     bool do_reuse = reusable_across_network;
     GPU_DEBUG_GET_INSTANCE(debug_config);
     GPU_DEBUG_IF(debug_config->disable_memory_reuse) {
@@ -232,7 +253,7 @@ memory::ptr memory_pool::get_memory(const layout& layout,
         // reusable within the same network
         if (!layout.format.is_image() && layout.data_padding == padding{{0, 0, 0, 0}, 0}) {
             // non-padded buffers
-            return get_from_non_padded_pool(layout, id, network_id, restrictions, type, reset);
+            return get_from_non_padded_pool(layout, id, network_id, restrictions, type, reset, is_dynamic);
         } else if (!layout.format.is_image()) {
             // padded buffers
             return get_from_padded_pool(layout, id, network_id, restrictions, type);
@@ -303,8 +324,41 @@ void memory_pool::clear_pool_for_network(uint32_t network_id) {
 
 memory_pool::memory_pool(engine& engine) : _engine(&engine) { }
 
+size_t memory_pool::get_capacity(const memory& mem, uint32_t network_id) const {
+    for (auto it = _non_padded_pool.lower_bound(mem.size()); it != _non_padded_pool.end(); ++it) {
+        if (it->second._network_id == network_id &&
+            it->second._memory->get_internal_params().mem == mem.get_internal_params().mem)
+            return static_cast<size_t>(it->first);
+    }
+    return mem.size();
+}
+
+std::map<std::string, uint64_t> memory_pool::get_statistics() const {
+    std::map<std::string, uint64_t> statistics;
+    for (const auto& pool_name : {"non_padded_pool", "padded_pool", "no_reusable_pool"}) {
+        statistics[std::string(pool_name) + "_records"] = 0;
+        statistics[std::string(pool_name) + "_bytes"] = 0;
+    }
+    auto add_record = [&statistics](const std::string& pool_name, const memory_record& record) {
+        statistics[pool_name + "_records"]++;
+        statistics[pool_name + "_bytes"] += record._memory->size();
+    };
+    for (const auto& mem : _non_padded_pool)
+        add_record("non_padded_pool", mem.second);
+    for (const auto& mem : _padded_pool) {
+        for (const auto& record : mem.second)
+            add_record("padded_pool", record);
+    }
+    for (const auto& mem : _no_reusable_pool)
+        add_record("no_reusable_pool", mem.second);
+    return statistics;
+}
+
 void memory_pool::dump(uint32_t net_id) {
     GPU_DEBUG_COUT << "Dump memory pool of network " << net_id << std::endl;
+    for (const auto& stat : get_statistics()) {
+        GPU_DEBUG_COUT << stat.first << ": " << stat.second << std::endl;
+    }
     GPU_DEBUG_COUT << "========== non-padded pool ( " << _non_padded_pool.size() << " records) ==========" << std::endl;
     for (auto mem : _non_padded_pool) {
         GPU_DEBUG_COUT << mem.second._memory->buffer_ptr() << " (size: " << mem.first << ", type: " << mem.second._type
@@ -215,6 +215,9 @@ memory::ptr ocl_engine::reinterpret_handle(const layout& new_layout, shared_mem_
                             "[GPU] shared buffer has smaller size (", actual_mem_size,
                             ") than specified layout (", requested_mem_size, ")");
             return std::make_shared<ocl::gpu_buffer>(this, new_layout, buf);
+        } else if (params.mem_type == shared_mem_type::shared_mem_host_ptr) {
+            cl::Buffer buf(get_cl_context(), CL_MEM_READ_WRITE | CL_MEM_USE_HOST_PTR, new_layout.bytes_count(), params.mem);
+            return std::make_shared<ocl::gpu_buffer>(this, new_layout, buf);
         } else if (params.mem_type == shared_mem_type::shared_mem_usm) {
             cl::UsmMemory usm_buffer(get_usm_helper(), params.mem);
             auto actual_mem_size = get_usm_helper().get_usm_allocation_size(usm_buffer.get());
@@ -126,6 +126,17 @@ event::ptr gpu_buffer::copy_from(stream& stream, const void* host_ptr, bool bloc
     return ev;
 }
 
+event::ptr gpu_buffer::copy_from(stream& stream, const void* host_ptr, size_t src_offset, size_t dst_offset, size_t size, bool blocking) {
+    OPENVINO_ASSERT(dst_offset + size <= _bytes_count, "[GPU] Out of bounds copy to the buffer of ", _bytes_count, " bytes");
+    auto& cl_stream = downcast<ocl_stream>(stream);
+    auto ev = blocking ? stream.create_user_event(true) : stream.create_base_event();
+    cl::Event* ev_ocl = blocking ? nullptr : &downcast<ocl_event>(ev.get())->get();
+    auto src_ptr = reinterpret_cast<const char*>(host_ptr) + src_offset;
+    cl_stream.get_cl_queue().enqueueWriteBuffer(_buffer, blocking, dst_offset, size, src_ptr, nullptr, ev_ocl);
+
+    return ev;
+}
+
 event::ptr gpu_buffer::copy_to(stream& stream, void* host_ptr, bool blocking) {
     auto& cl_stream = downcast<ocl_stream>(stream);
     auto ev = blocking ? stream.create_user_event(true) : stream.create_base_event();
@@ -292,6 +303,11 @@ event::ptr gpu_image2d::copy_from(stream& stream, const void* host_ptr, bool blo
     return ev;
 }
 
+event::ptr gpu_image2d::copy_from(stream& /* stream */, const void* /* host_ptr */, size_t /* src_offset */, size_t /* dst_offset */,
+                                  size_t /* size */, bool /* blocking */) {
+    OPENVINO_THROW("[GPU] Partial copy_from is not implemented for gpu_image2d");
+}
+
 event::ptr gpu_image2d::copy_to(stream& stream, memory& other, bool blocking) {
     auto& cl_stream = downcast<const ocl_stream>(stream);
     auto& casted = downcast<const gpu_image2d>(other);
@@ -476,6 +492,23 @@ event::ptr gpu_usm::copy_from(stream& stream, const void* host_ptr, bool blockin
     return ev;
 }
 
+event::ptr gpu_usm::copy_from(stream& stream, const void* host_ptr, size_t src_offset, size_t dst_offset, size_t size, bool blocking) {
+    OPENVINO_ASSERT(dst_offset + size <= _bytes_count, "[GPU] Out of bounds copy to the buffer of ", _bytes_count, " bytes");
+    auto& cl_stream = downcast<ocl_stream>(stream);
+    auto dst_ptr = reinterpret_cast<char*>(get_buffer().get()) + dst_offset;
+    auto src_ptr = reinterpret_cast<const char*>(host_ptr) + src_offset;
+    auto ev = blocking ? stream.create_user_event(true) : stream.create_base_event();
+    cl::Event* ev_ocl = blocking ? nullptr : &downcast<ocl_event>(ev.get())->get();
+    cl_stream.get_usm_helper().enqueue_memcpy(cl_stream.get_cl_queue(),
+                                              dst_ptr,
+                                              src_ptr,
+                                              size,
+                                              blocking,
+                                              nullptr,
+                                              ev_ocl);
+    return ev;
+}
+
 event::ptr gpu_usm::copy_to(stream& stream, void* host_ptr, bool blocking) {
     auto& cl_stream = downcast<ocl_stream>(stream);
     auto ev = blocking ? stream.create_user_event(true) : stream.create_base_event();
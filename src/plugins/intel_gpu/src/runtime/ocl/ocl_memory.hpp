@@ -42,6 +42,7 @@ struct gpu_buffer : public lockable_gpu_mem, public memory {
 
     event::ptr copy_from(stream& stream, const memory& other, bool blocking) override;
     event::ptr copy_from(stream& stream, const void* host_ptr, bool blocking) override;
+    event::ptr copy_from(stream& stream, const void* host_ptr, size_t src_offset, size_t dst_offset, size_t size, bool blocking) override;
 
     event::ptr copy_to(stream& stream, void* other , bool blocking) override;
 
@@ -69,6 +70,7 @@ struct gpu_image2d : public lockable_gpu_mem, public memory {
 
     event::ptr copy_from(stream& stream, const memory& other, bool blocking) override;
     event::ptr copy_from(stream& stream, const void* other, bool blocking) override;
+    event::ptr copy_from(stream& stream, const void* host_ptr, size_t src_offset, size_t dst_offset, size_t size, bool blocking) override;
 
     event::ptr copy_to(stream& stream, memory& other, bool blocking) override;
     event::ptr copy_to(stream& stream, void* other, bool blocking) override;
@@ -121,6 +123,7 @@ struct gpu_usm : public lockable_gpu_mem, public memory {
 
     event::ptr copy_from(stream& stream, const memory& other, bool blocking) override;
     event::ptr copy_from(stream& stream, const void* host_ptr, bool blocking) override;
+    event::ptr copy_from(stream& stream, const void* host_ptr, size_t src_offset, size_t dst_offset, size_t size, bool blocking) override;
 
     event::ptr copy_to(stream& stream, void* host_ptr, bool blocking) override;
 #ifdef ENABLE_ONEDNN_FOR_GPU
@@ -194,6 +194,26 @@ void set_arguments_impl(ocl_kernel_type& kernel,
     }
 }
 
+size_t get_memory_bytes(const kernel_arguments_data& args) {
+    size_t bytes = 0;
+    auto add = [&bytes](const memory::cptr& mem) {
+        if (mem)
+            bytes += mem->get_layout().bytes_count();
+    };
+    for (const auto& mem : args.inputs)
+        add(mem);
+    for (const auto& mem : args.intermediates)
+        add(mem);
+    for (const auto& mem : args.outputs)
+        add(mem);
+    for (const auto& mem : args.fused_op_inputs)
+        add(mem);
+    for (const auto& mem : { args.weights, args.recurrent, args.hidden, args.cell, args.bias, args.weights_zero_points,
+                             args.activations_zero_points, args.compensation, args.lookup_table, args.scale_table, args.slope })
+        add(mem);
+    return bytes;
+}
+
 sync_methods get_expected_sync_method(const ExecutionConfig& config) {
     auto profiling = config.get_property(ov::enable_profiling);
     auto queue_type = config.get_property(ov::intel_gpu::queue_type);
@@ -210,7 +230,8 @@ ocl_stream::ocl_stream(const ocl_engine &engine, const ExecutionConfig& config)
     auto context = engine.get_cl_context();
     auto device = engine.get_cl_device();
     ocl::command_queues_builder queue_builder;
-    queue_builder.set_profiling(config.get_property(ov::enable_profiling));
+    // The sampled kernels profiling needs the timestamps of the queue, but keeps the sync method
+    queue_builder.set_profiling(config.get_property(ov::enable_profiling) || config.get_property(ov::intel_gpu::kernels_profiling_interval) > 0);
     queue_builder.set_out_of_order(queue_type == QueueTypes::out_of_order);
 
     if (sync_method == sync_methods::none && queue_type == QueueTypes::out_of_order) {
@@ -278,7 +299,7 @@ void ocl_stream::set_arguments(kernel& kernel, const kernel_arguments_desc& args
 
 event::ptr ocl_stream::enqueue_kernel(kernel& kernel,
                                       const kernel_arguments_desc& args_desc,
-                                      const kernel_arguments_data& /* args */,
+                                      const kernel_arguments_data& args,
                                       std::vector<event::ptr> const& deps,
                                       bool is_output) {
     auto& ocl_kernel = downcast<ocl::ocl_kernel>(kernel);
@@ -302,7 +323,7 @@ event::ptr ocl_stream::enqueue_kernel(kernel& kernel,
 
     cl::Event ret_ev;
 
-    bool set_output_event = sync_method == sync_methods::events || is_output;
+    bool set_output_event = sync_method == sync_methods::events || is_output || _profile_kernels;
 
     try {
         _command_queue.enqueueNDRangeKernel(kern, cl::NullRange, global, local, dep_events_ptr, set_output_event ? &ret_ev : nullptr);
@@ -314,9 +335,41 @@ event::ptr ocl_stream::enqueue_kernel(kernel& kernel,
         throw ocl_error(err);
     }
 
+    if (_profile_kernels) {
+        kernel_profiling_record record{args_desc.layerID, kern.getInfo<CL_KERNEL_FUNCTION_NAME>(), args_desc.workGroups.global,
+                                       args_desc.workGroups.local, get_memory_bytes(args), 0, 0};
+        _kernels_records.emplace_back(record, ret_ev);
+    }
+
     return std::make_shared<ocl_event>(ret_ev, ++_queue_counter);
 }
 
+void ocl_stream::start_kernels_profiling() {
+    _kernels_records.clear();
+    _profile_kernels = true;
+}
+
+std::vector<kernel_profiling_record> ocl_stream::stop_kernels_profiling() {
+    _profile_kernels = false;
+    finish();
+
+    std::vector<kernel_profiling_record> records;
+    records.reserve(_kernels_records.size());
+    for (auto& kernel_record : _kernels_records) {
+        auto& record = kernel_record.first;
+        try {
+            record.start = kernel_record.second.getProfilingInfo<CL_PROFILING_COMMAND_START>();
+            record.end = kernel_record.second.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+        } catch (cl::Error const&) {
+            // The user queue may be created without the profiling
+            continue;
+        }
+        records.push_back(record);
+    }
+    _kernels_records.clear();
+    return records;
+}
+
 void ocl_stream::enqueue_barrier() {
     _command_queue.enqueueBarrierWithWaitList(nullptr, nullptr);
 }
@@ -79,6 +79,9 @@ public:
     event::ptr create_user_event(bool set) override;
     event::ptr create_base_event() override;
 
+    void start_kernels_profiling() override;
+    std::vector<kernel_profiling_record> stop_kernels_profiling() override;
+
     const cl::UsmHelper& get_usm_helper() const { return _engine.get_usm_helper(); }
 
     static QueueTypes detect_queue_type(void* queue_handle);
@@ -98,6 +101,9 @@ private:
 
     sync_methods sync_method;
 
+    bool _profile_kernels = false;
+    std::vector<std::pair<kernel_profiling_record, cl::Event>> _kernels_records;
+
 #ifdef ENABLE_ONEDNN_FOR_GPU
     std::shared_ptr<dnnl::stream> _onednn_stream = nullptr;
 #endif
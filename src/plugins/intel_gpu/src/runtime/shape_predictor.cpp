@@ -5,6 +5,9 @@
 #include "intel_gpu/runtime/shape_predictor.hpp"
 #include "intel_gpu/runtime/engine.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 namespace cldnn {
 
 static ov::Shape operator*(const ov::Shape& s1, const ov::Shape& s2) {
@@ -67,12 +70,14 @@ std::pair<bool, ov::Shape> ShapePredictor::predict_preallocation_shape(const std
     if (can_reuse_buffer)
         return {false, {}};
 
+    _reallocations_num++;
+
     // Check if there is enough data for prediction
     auto& shapes = _shapes_info[id];
     const auto shapes_num = shapes.size();
 
     // Number of shapes used for iterations mode predictions
-    const auto min_shapes_num = _max_deque_size;
+    const auto min_shapes_num = _iterations_shapes_num;
 
     if (shapes_num >= min_shapes_num) {
         std::vector<ov::Shape> diffs;
@@ -121,10 +126,20 @@ std::pair<bool, ov::Shape> ShapePredictor::predict_preallocation_shape(const std
             auto new_shape = current_shape + preallocation_shape;
             return {true, new_shape};
         } else if (_buffers_preallocation_ratio > 1.0f) {
-            // Apply percentage buffer preallocation
+            // Apply percentage buffer preallocation to the quantile of the history sizes
             auto current_shape_size = ov::shape_size(current_shape);
+            std::vector<size_t> sizes;
+            for (const auto& shape : shapes)
+                sizes.push_back(ov::shape_size(shape));
+            const auto quantile_idx = static_cast<size_t>(std::ceil(_preallocation_quantile * sizes.size())) - 1;
+            std::nth_element(sizes.begin(), sizes.begin() + quantile_idx, sizes.end());
+            auto preallocation_size = std::max(current_shape_size, sizes[quantile_idx]);
+            if (preallocation_size > current_shape_size &&
+                !can_preallocate(static_cast<size_t>(preallocation_size * _buffers_preallocation_ratio) * dt_size))
+                preallocation_size = current_shape_size;
+
             ov::Shape new_shape_size(current_shape.size(), 1);
-            new_shape_size[0] = static_cast<size_t>(current_shape_size * _buffers_preallocation_ratio);
+            new_shape_size[0] = static_cast<size_t>(preallocation_size * _buffers_preallocation_ratio);
             return {true, new_shape_size};
         }
     }
@@ -2,12 +2,14 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
 #include <memory>
 
 #include "openvino/runtime/core.hpp"
+#include "openvino/op/relu.hpp"
 
 #include <common_test_utils/test_common.hpp>
 #include "ngraph_functions/subgraph_builders.hpp"
@@ -16,6 +18,7 @@
 #include "transformations/utils/utils.hpp"
 #include "common_test_utils/common_utils.hpp"
 #include "shared_test_classes/base/layer_test_utils.hpp"
+#include "intel_gpu/runtime/internal_properties.hpp"
 
 using namespace ::testing;
 
@@ -199,3 +202,71 @@ TEST(TensorTest, smoke_canSetTensorForDynamicInput) {
     ASSERT_NO_THROW(inf_req.set_input_tensor(t2));
     ASSERT_NO_THROW(inf_req.infer());
 }
+
+TEST(TensorTest, smoke_canInferWithPageAlignedHostTensors) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{1, 4, 32, 32});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(relu)}, ov::ParameterVector{param});
+
+    auto ie = ov::Core();
+    auto compiled_model = ie.compile_model(model, ov::test::utils::DEVICE_GPU);
+    auto request = compiled_model.create_infer_request();
+
+    // The page aligned host buffers may be used by the integrated GPU in place
+    const size_t elements_count = ov::shape_size(param->get_shape());
+    const size_t alignment = 4096;
+    std::vector<uint8_t> input_storage(elements_count * sizeof(float) + alignment);
+    std::vector<uint8_t> output_storage(elements_count * sizeof(float) + alignment);
+    auto align = [&](std::vector<uint8_t>& storage) {
+        auto ptr = reinterpret_cast<uintptr_t>(storage.data());
+        return reinterpret_cast<float*>((ptr + alignment - 1) / alignment * alignment);
+    };
+    float* input_data = align(input_storage);
+    float* output_data = align(output_storage);
+
+    for (size_t iteration = 0; iteration < 2; iteration++) {
+        for (size_t i = 0; i < elements_count; i++)
+            input_data[i] = static_cast<float>(i % 7) - 3.f + static_cast<float>(iteration);
+
+        request.set_input_tensor(ov::Tensor(ov::element::f32, param->get_shape(), input_data));
+        request.set_output_tensor(ov::Tensor(ov::element::f32, param->get_shape(), output_data));
+        ASSERT_NO_THROW(request.infer());
+
+        for (size_t i = 0; i < elements_count; i++)
+            ASSERT_EQ(output_data[i], std::max(input_data[i], 0.f)) << "i = " << i << ", iteration = " << iteration;
+    }
+}
+
+TEST(TensorTest, smoke_canMergeConcurrentRequestsWithDynamicBatch) {
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{-1, 16});
+    auto relu = std::make_shared<ov::op::v0::Relu>(param);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{std::make_shared<ov::op::v0::Result>(relu)}, ov::ParameterVector{param});
+
+    auto ie = ov::Core();
+    auto compiled_model = ie.compile_model(model, ov::test::utils::DEVICE_GPU, ov::intel_gpu::requests_merge_timeout(100000));
+
+    // The requests with the different batches are merged into one execution and get their own parts of the output
+    const std::vector<size_t> batches = {1, 3, 2, 1};
+    std::vector<ov::InferRequest> requests;
+    std::vector<std::vector<float>> inputs;
+    for (size_t i = 0; i < batches.size(); i++) {
+        requests.push_back(compiled_model.create_infer_request());
+        inputs.emplace_back(batches[i] * 16);
+        for (size_t j = 0; j < inputs.back().size(); j++)
+            inputs.back()[j] = static_cast<float>(j % 5) - 2.f + static_cast<float>(i);
+        requests.back().set_input_tensor(ov::Tensor(ov::element::f32, {batches[i], 16}, inputs.back().data()));
+    }
+
+    for (auto& request : requests)
+        request.start_async();
+    for (auto& request : requests)
+        ASSERT_NO_THROW(request.wait());
+
+    for (size_t i = 0; i < batches.size(); i++) {
+        auto output = requests[i].get_output_tensor();
+        ASSERT_EQ(output.get_shape(), ov::Shape({batches[i], 16}));
+        auto output_data = output.data<float>();
+        for (size_t j = 0; j < inputs[i].size(); j++)
+            ASSERT_EQ(output_data[j], std::max(inputs[i][j], 0.f)) << "request = " << i << ", j = " << j;
+    }
+}
@@ -12,6 +12,7 @@
 #include "openvino/runtime/intel_gpu/ocl/ocl.hpp"
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/intel_gpu/properties.hpp"
+#include "intel_gpu/runtime/internal_properties.hpp"
 
 #include <remote_blob_tests/remote_blob_helpers.hpp>
 #include <common_test_utils/test_common.hpp>
@@ -2068,3 +2069,26 @@ TEST(OVRemoteContextGPU, smoke_RemoteTensorSetShape) {
     ASSERT_NO_THROW(remote_tensor.set_shape({1, 3, 4, 5}));
     ASSERT_NO_THROW(remote_tensor.set_shape({3, 3, 4, 5}));
 }
+
+TEST(OVRemoteContextGPU, smoke_RemoteTensorMemoryIsPooled) {
+#if defined(ANDROID)
+    GTEST_SKIP();
+#endif
+    auto core = ov::Core();
+    auto model = ngraph::builder::subgraph::makeConvertTranspose();
+    auto compiled_model = core.compile_model(model, ov::test::utils::DEVICE_GPU, ov::intel_gpu::remote_tensors_pool_size(1024 * 1024));
+    auto context = compiled_model.get_context().as<ov::intel_gpu::ocl::ClContext>();
+
+    cl_mem released_handle = nullptr;
+    {
+        auto remote_tensor = context.create_tensor(ov::element::f32, ov::Shape{1, 2, 3, 4});
+        released_handle = remote_tensor.as<ov::intel_gpu::ocl::ClBufferTensor>().get();
+    }
+
+    // The memory of the released tensor is reused only for the same layout
+    auto other_tensor = context.create_tensor(ov::element::f32, ov::Shape{1, 2, 3, 5});
+    ASSERT_NE(other_tensor.as<ov::intel_gpu::ocl::ClBufferTensor>().get(), released_handle);
+
+    auto remote_tensor = context.create_tensor(ov::element::f32, ov::Shape{1, 2, 3, 4});
+    ASSERT_EQ(remote_tensor.as<ov::intel_gpu::ocl::ClBufferTensor>().get(), released_handle);
+}
@@ -9,6 +9,7 @@
 #include <intel_gpu/primitives/reorder.hpp>
 #include <intel_gpu/primitives/reshape.hpp>
 #include <intel_gpu/primitives/data.hpp>
+#include <intel_gpu/primitives/activation.hpp>
 
 #include "softmax_inst.h"
 
@@ -263,4 +264,42 @@ TEST(dyn_shape_mem_test, igpu_shape_infer_dep_mem_type) {
     auto expected_layout = layout{ov::PartialShape{3, 2, 1, 1}, data_types::f16, format::bfyx};
     ASSERT_EQ(output.begin()->second.get_memory()->get_layout(), expected_layout);
 }
+
+TEST(dyn_shape_mem_test, size_class_reuse) {
+    auto& engine = get_test_engine();
+    auto input_dyn_layout = layout{ov::PartialShape{ov::Dimension(), 3}, data_types::f32, format::bfyx};
+    topology topology(input_layout("input", input_dyn_layout),
+                      activation("relu1", input_info("input"), activation_func::relu),
+                      softmax("softmax", input_info("relu1"), 1),
+                      reorder("output", input_info("softmax"), format::bfyx, data_types::f32));
+
+    ExecutionConfig config = get_test_default_config(engine);
+    config.set_property(ov::intel_gpu::allow_new_shape_infer(true));
+    network network(engine, topology, config);
+
+    // 48 bytes are rounded up to the 64 bytes size class
+    auto input_mem1 = engine.allocate_memory(layout{ov::PartialShape{4, 3}, data_types::f32, format::bfyx});
+    set_values<float>(input_mem1, std::vector<float>(12, 1.f));
+    network.set_input_data("input", input_mem1);
+    network.execute();
+    auto relu_mem1 = network.get_primitive("relu1")->output_memory_ptr();
+
+    // 60 bytes fit the same size class, so the buffer is not reallocated
+    auto input_mem2 = engine.allocate_memory(layout{ov::PartialShape{5, 3}, data_types::f32, format::bfyx});
+    set_values<float>(input_mem2, std::vector<float>(15, -1.f));
+    network.set_input_data("input", input_mem2);
+    auto outputs = network.execute();
+    auto relu_mem2 = network.get_primitive("relu1")->output_memory_ptr();
+    ASSERT_EQ(relu_mem1->buffer_ptr(), relu_mem2->buffer_ptr());
+
+    cldnn::mem_lock<float> output_ptr(outputs.at("output").get_memory(), get_test_stream());
+    for (size_t i = 0; i < 15; i++) {
+        ASSERT_NEAR(output_ptr[i], 1.f / 3.f, 1e-5f);
+    }
+
+    auto& pool = network.get_memory_pool();
+    const auto statistics = pool.get_statistics();
+    ASSERT_EQ(statistics.at("non_padded_pool_records"), pool.get_non_padded_pool_size());
+    ASSERT_EQ(statistics.at("non_padded_pool_bytes") % 64, 0);
+}
 }  // memory_realloc_tests
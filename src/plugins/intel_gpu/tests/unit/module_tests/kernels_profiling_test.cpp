@@ -0,0 +1,46 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils.h"
+
+#include <intel_gpu/primitives/input_layout.hpp>
+#include <intel_gpu/primitives/activation.hpp>
+
+#include <algorithm>
+
+using namespace cldnn;
+using namespace ::tests;
+
+TEST(kernels_profiling, records_kernels_of_out_of_order_queue) {
+    auto& engine = get_test_engine();
+    auto input = engine.allocate_memory({ data_types::f32, format::bfyx, { 1, 1, 4, 4 } });
+    set_values(input, std::vector<float>(16, -1.f));
+
+    topology topology(input_layout("input", input->get_layout()),
+                      activation("relu", input_info("input"), activation_func::relu));
+
+    ExecutionConfig config = get_test_default_config(engine);
+    config.set_property(ov::intel_gpu::queue_type(QueueTypes::out_of_order));
+    config.set_property(ov::intel_gpu::kernels_profiling_interval(1));
+    network network(engine, topology, config);
+    network.set_input_data("input", input);
+
+    network.get_stream().start_kernels_profiling();
+    network.execute();
+    auto records = network.get_stream().stop_kernels_profiling();
+
+    auto relu = std::find_if(records.begin(), records.end(), [](const kernel_profiling_record& record) {
+        return record.layer_id.find("relu") != std::string::npos;
+    });
+    ASSERT_NE(relu, records.end());
+    ASSERT_FALSE(relu->kernel_name.empty());
+    ASSERT_FALSE(relu->gws.empty());
+    ASSERT_LE(relu->start, relu->end);
+    ASSERT_EQ(relu->memory_bytes, 2 * 16 * sizeof(float));
+
+    // Nothing is recorded once the profiling is stopped
+    network.execute();
+    network.get_stream().start_kernels_profiling();
+    ASSERT_TRUE(network.get_stream().stop_kernels_profiling().empty());
+}
@@ -60,6 +60,8 @@ INSTANTIATE_TEST_SUITE_P(smoke, shape_predictor_tests,
         {{{1,1}, {1,1}, {1,1}}, {1,1}, 1.1f, false},
         {{{1,1}, {1,128}, {1,256}}, {281, 1}, 1.1f, false},
         {{{1,3,128}, {1,3,112}, {1,3,418}, {1,3,512}}, {1689,1,1}, 1.1f, false},
+        // the alternating sizes are preallocated by the quantile of the history
+        {{{1,100}, {1,10}, {1,90}, {1,20}, {1,40}}, {110,1}, 1.1f, false},
         {{{1,1}, {1,1}, {1,1}}, {}, 1.1f, true},
         {{{1,1}, {1,128}, {1,256}}, {}, 1.1f, true},
         {{{1,3,128}, {1,3,112}, {1,3,418}, {1,3,512}}, {}, 1.1f, true},
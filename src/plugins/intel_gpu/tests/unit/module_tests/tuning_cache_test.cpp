@@ -0,0 +1,38 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils.h"
+
+#include "auto_tuner.h"
+#include "kernels/activation/activation_kernel_base.h"
+
+#include <cstdio>
+
+using namespace ::tests;
+
+TEST(tuning_cache, stored_kernel_is_loaded_for_the_same_device) {
+    kernel_selector::activation_params params;
+    params.inputs[0] = kernel_selector::DataTensor(std::vector<size_t>{8, 8, 16, 1}, kernel_selector::Datatype::F16, kernel_selector::DataLayout::bfyx);
+    params.outputs[0] = params.inputs[0];
+    params.engineInfo.deviceId = "0x1234";
+
+    const std::string path = "tuning_cache_test.json";
+    {
+        kernel_selector::TuningCache cache;
+        cache.StoreKernel(params, "activation_ref", 3);
+        cache.Save(path);
+    }
+
+    kernel_selector::TuningCache cache(path);
+    std::remove(path.c_str());
+
+    auto entry = cache.LoadKernel(params);
+    ASSERT_EQ(std::get<0>(entry), "activation_ref");
+    ASSERT_EQ(std::get<1>(entry), 3);
+
+    // the entries of the other devices are not used
+    params.engineInfo.deviceId = "0x5678";
+    entry = cache.LoadKernel(params);
+    ASSERT_TRUE(std::get<0>(entry).empty());
+}
@@ -340,4 +340,38 @@ INSTANTIATE_TEST_SUITE_P(cldnn_usm, copy_between_gpu_buffer_and_gpu_usm, ::testi
     usm_test_params{ allocation_type::cl_mem },
     usm_test_params{ allocation_type::usm_host },
     usm_test_params{ allocation_type::usm_device },
-}));
\ No newline at end of file
+}));
+class copy_host_buffer_by_chunks : public BaseUSMTest {};
+TEST_P(copy_host_buffer_by_chunks, basic) {
+    auto p = GetParam();
+    if (!supports_usm()) {
+        return;
+    }
+    ocl::ocl_stream stream(*_engine, {});
+
+    size_t values_count = 100;
+    size_t chunk_values_count = 16;
+    std::vector<float> src_buffer(values_count);
+    std::iota(src_buffer.begin(), src_buffer.end(), 0.0f);
+
+    cldnn::layout linear_layout = cldnn::layout(cldnn::data_types::f32, cldnn::format::bfyx, cldnn::tensor(1, 1, int32_t(values_count), 1));
+    auto mem_dst = _engine->allocate_memory(linear_layout, p.type);
+
+    // The last chunk is shorter than the others
+    for (size_t offset = 0; offset < values_count; offset += chunk_values_count) {
+        size_t count = std::min(chunk_values_count, values_count - offset);
+        mem_dst->copy_from(stream, src_buffer.data(), offset * sizeof(float), offset * sizeof(float), count * sizeof(float), true);
+    }
+
+    std::vector<float> dst_buffer(values_count);
+    mem_dst->copy_to(stream, dst_buffer.data(), true);
+    ASSERT_EQ(src_buffer, dst_buffer);
+
+    ASSERT_ANY_THROW(mem_dst->copy_from(stream, src_buffer.data(), 0, sizeof(float), values_count * sizeof(float), true));
+}
+
+INSTANTIATE_TEST_SUITE_P(cldnn_usm, copy_host_buffer_by_chunks, ::testing::ValuesIn(std::vector<usm_test_params>{
+    usm_test_params{ allocation_type::cl_mem },
+    usm_test_params{ allocation_type::usm_host },
+    usm_test_params{ allocation_type::usm_device },
+}));
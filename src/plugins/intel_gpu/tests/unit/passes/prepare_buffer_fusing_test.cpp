@@ -268,6 +268,65 @@ TEST(prepare_buffer_fusing, in_place_concat_dynamic) {
     }
 }
 
+TEST(prepare_buffer_fusing, in_place_crop_dynamic) {
+    auto& engine = get_test_engine();
+    auto in_layout_0 = layout{ ov::PartialShape{ov::Dimension(1, 10), 4, 1, 2}, data_types::f32, format::bfyx };
+    auto in_layout = layout{ ov::PartialShape{1, 4, 1, 2}, data_types::f32, format::bfyx };
+
+    auto axis_mem = engine.allocate_memory({ {}, data_types::i64, format::bfyx });
+    auto splits_length_mem = engine.allocate_memory({ {2}, data_types::i64, format::bfyx });
+    set_values(axis_mem, {1});
+    set_values<int64_t>(splits_length_mem, {1, 3});
+
+    cldnn::crop_ngraph_op_mode op_mode = cldnn::crop_ngraph_op_mode::variadic_split;
+    topology topology;
+    topology.add(input_layout("input", in_layout_0));
+    topology.add(data("axis", axis_mem));
+    topology.add(data("splits_length", splits_length_mem));
+    topology.add(crop("crop1", { input_info("input"), input_info("axis"), input_info("splits_length") },
+                      tensor(batch(1), spatial(2, 1), feature(1)), { tensor(feature(0), spatial(0, 0), batch(0)) }, op_mode, 0));
+    topology.add(crop("crop2", { input_info("input"), input_info("axis"), input_info("splits_length") },
+                      tensor(batch(1), spatial(2, 1), feature(3)), { tensor(feature(1), spatial(0, 0), batch(0)) }, op_mode, 1));
+    topology.add(activation("output1", input_info("crop1"), activation_func::relu));
+    topology.add(activation("output2", input_info("crop2"), activation_func::relu));
+
+    ExecutionConfig config = get_test_default_config(engine);
+    config.set_property(ov::intel_gpu::optimize_data(true));
+    config.set_property(ov::intel_gpu::allow_new_shape_infer(true));
+    auto prog = program::build_program(engine, topology, config, false, false);
+    ASSERT_NE(prog, nullptr);
+    cldnn::network net(prog, 0);
+
+    auto input_memory = engine.allocate_memory(in_layout);
+    set_values<float>(input_memory, {-1.0f, 2.0f, 3.0f, -4.0f, 5.0f, 6.0f, -7.0f, 8.0f});
+    net.set_input_data("input", input_memory);
+
+    std::vector<float> ref_output1 = {0.0f, 2.0f};
+    std::vector<float> ref_output2 = {3.0f, 0.0f, 5.0f, 6.0f, 0.0f, 8.0f};
+
+    std::map<cldnn::primitive_id, cldnn::network_output> output;
+    EXPECT_NO_THROW(output = net.execute());
+
+    auto input_mem = net.get_primitive("input")->output_memory_ptr();
+    for (auto& crop_id : {"crop1", "crop2"}) {
+        auto crop_inst = net.get_primitive(crop_id);
+        ASSERT_TRUE(crop_inst->can_be_optimized());
+        ASSERT_TRUE(engine.is_the_same_buffer(*crop_inst->output_memory_ptr(), *input_mem));
+    }
+
+    auto out_mem1 = output.at("output1").get_memory();
+    cldnn::mem_lock<float> output_ptr1(out_mem1, get_test_stream());
+    for (size_t x = 0; x < ref_output1.size(); ++x) {
+        ASSERT_EQ(ref_output1[x], output_ptr1[x]);
+    }
+
+    auto out_mem2 = output.at("output2").get_memory();
+    cldnn::mem_lock<float> output_ptr2(out_mem2, get_test_stream());
+    for (size_t x = 0; x < ref_output2.size(); ++x) {
+        ASSERT_EQ(ref_output2[x], output_ptr2[x]);
+    }
+}
+
 TEST(prepare_buffer_fusing, in_place_concat_strided_slice_dyn) {
     auto& engine = get_test_engine();
     auto in_layout1_0 = layout{ ov::PartialShape::dynamic(4), data_types::f32, format::bfyx };
@@ -0,0 +1,168 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "test_utils.h"
+#include "random_generator.hpp"
+
+#include <intel_gpu/primitives/input_layout.hpp>
+#include <intel_gpu/primitives/scaled_dot_product_attention.hpp>
+
+#include "scaled_dot_product_attention_inst.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace cldnn;
+using namespace ::tests;
+
+namespace {
+struct sdpa_test_params {
+    ov::Shape query_shape;
+    size_t kv_len;
+    bool with_mask;
+    bool is_causal;
+};
+
+std::vector<float> sdpa_reference(const std::vector<float>& query,
+                                  const std::vector<float>& key,
+                                  const std::vector<float>& value,
+                                  const std::vector<float>& mask,
+                                  const ov::Shape& query_shape,
+                                  size_t kv_len,
+                                  float scale,
+                                  bool is_causal) {
+    const size_t heads = query_shape[0] * query_shape[1];
+    const size_t query_len = query_shape[2];
+    const size_t head_size = query_shape[3];
+
+    std::vector<float> output(heads * query_len * head_size, 0.f);
+    std::vector<float> scores(kv_len);
+    for (size_t bh = 0; bh < heads; bh++) {
+        for (size_t l = 0; l < query_len; l++) {
+            float max_score = -std::numeric_limits<float>::infinity();
+            for (size_t s = 0; s < kv_len; s++) {
+                float score = 0.f;
+                for (size_t d = 0; d < head_size; d++)
+                    score += query[(bh * query_len + l) * head_size + d] * key[(bh * kv_len + s) * head_size + d];
+                score *= scale;
+                if (!mask.empty())
+                    score += mask[l * kv_len + s];
+                if (is_causal && s > l + kv_len - query_len)
+                    score = -std::numeric_limits<float>::infinity();
+                scores[s] = score;
+                max_score = std::max(max_score, score);
+            }
+            float sum = 0.f;
+            for (size_t s = 0; s < kv_len; s++) {
+                scores[s] = std::exp(scores[s] - max_score);
+                sum += scores[s];
+            }
+            for (size_t s = 0; s < kv_len; s++) {
+                for (size_t d = 0; d < head_size; d++)
+                    output[(bh * query_len + l) * head_size + d] += scores[s] / sum * value[(bh * kv_len + s) * head_size + d];
+            }
+        }
+    }
+    return output;
+}
+
+class sdpa_gpu_test : public ::testing::TestWithParam<sdpa_test_params> {
+public:
+    tests::random_generator rg;
+
+    void SetUp() override {
+        rg.set_seed(GET_SUITE_NAME);
+    }
+
+    void execute(bool is_dynamic) {
+        auto& engine = get_test_engine();
+        const auto p = GetParam();
+        const float scale = 1.f / std::sqrt(static_cast<float>(p.query_shape[3]));
+
+        ov::Shape kv_shape = p.query_shape;
+        kv_shape[2] = p.kv_len;
+        ov::Shape mask_shape = {1, 1, p.query_shape[2], p.kv_len};
+
+        auto query_data = rg.generate_random_1d<float>(ov::shape_size(p.query_shape), -1, 1);
+        auto key_data = rg.generate_random_1d<float>(ov::shape_size(kv_shape), -1, 1);
+        auto value_data = rg.generate_random_1d<float>(ov::shape_size(kv_shape), -1, 1);
+        std::vector<float> mask_data;
+        if (p.with_mask)
+            mask_data = rg.generate_random_1d<float>(ov::shape_size(mask_shape), -2, 0);
+
+        auto make_layout = [&](const ov::Shape& shape) {
+            return is_dynamic ? layout{ov::PartialShape{-1, -1, -1, static_cast<int64_t>(shape[3])}, data_types::f32, format::bfyx}
+                              : layout{ov::PartialShape(shape), data_types::f32, format::bfyx};
+        };
+
+        auto query = engine.allocate_memory(layout{ov::PartialShape(p.query_shape), data_types::f32, format::bfyx});
+        auto key = engine.allocate_memory(layout{ov::PartialShape(kv_shape), data_types::f32, format::bfyx});
+        auto value = engine.allocate_memory(layout{ov::PartialShape(kv_shape), data_types::f32, format::bfyx});
+        set_values(query, query_data);
+        set_values(key, key_data);
+        set_values(value, value_data);
+
+        std::vector<input_info> inputs = { input_info("query"), input_info("key"), input_info("value") };
+        topology topology;
+        topology.add(input_layout("query", make_layout(p.query_shape)),
+                     input_layout("key", make_layout(kv_shape)),
+                     input_layout("value", make_layout(kv_shape)));
+        memory::ptr mask = nullptr;
+        if (p.with_mask) {
+            mask = engine.allocate_memory(layout{ov::PartialShape(mask_shape), data_types::f32, format::bfyx});
+            set_values(mask, mask_data);
+            topology.add(input_layout("mask", is_dynamic ? layout{ov::PartialShape::dynamic(4), data_types::f32, format::bfyx}
+                                                         : mask->get_layout()));
+            inputs.push_back(input_info("mask"));
+        }
+        topology.add(scaled_dot_product_attention("sdpa", inputs, scale, p.is_causal));
+
+        ExecutionConfig config = get_test_default_config(engine);
+        config.set_property(ov::intel_gpu::optimize_data(true));
+        config.set_property(ov::intel_gpu::allow_new_shape_infer(is_dynamic));
+        network network(engine, topology, config);
+        network.set_input_data("query", query);
+        network.set_input_data("key", key);
+        network.set_input_data("value", value);
+        if (p.with_mask)
+            network.set_input_data("mask", mask);
+
+        if (is_dynamic) {
+            auto impl = network.get_primitive("sdpa")->get_impl();
+            ASSERT_TRUE(impl != nullptr);
+            ASSERT_TRUE(impl->is_dynamic());
+        }
+
+        auto outputs = network.execute();
+        auto output = outputs.at("sdpa").get_memory();
+        cldnn::mem_lock<float> output_ptr(output, get_test_stream());
+
+        auto expected = sdpa_reference(query_data, key_data, value_data, mask_data, p.query_shape, p.kv_len, scale, p.is_causal);
+        ASSERT_EQ(output_ptr.size(), expected.size());
+        for (size_t i = 0; i < expected.size(); i++) {
+            ASSERT_NEAR(output_ptr[i], expected[i], 1e-4f) << "i = " << i;
+        }
+    }
+};
+}  // namespace
+
+TEST_P(sdpa_gpu_test, basic) {
+    execute(false);
+}
+
+TEST_P(sdpa_gpu_test, dynamic) {
+    execute(true);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke, sdpa_gpu_test,
+    ::testing::ValuesIn(std::vector<sdpa_test_params>{
+        // the query rows and the keys are not aligned to the work group and the tile sizes
+        { {1, 2, 20, 8}, 37, false, false },
+        { {2, 3, 16, 16}, 16, true, false },
+        { {1, 2, 20, 8}, 20, false, true },
+        // the causal keys follow the cached keys of the previous tokens
+        { {1, 4, 5, 32}, 29, true, true },
+    }));
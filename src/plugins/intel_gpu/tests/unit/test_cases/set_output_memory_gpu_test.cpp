@@ -67,6 +67,39 @@ TEST(set_output_memory_gpu, basic) {
     test_basic<float>(false);
 }
 
+TEST(set_output_memory_gpu, output_memory_changed_between_executions) {
+    auto& engine = get_test_engine();
+
+    auto input_data = engine.allocate_memory({ data_types::f32, format::bfyx, { 2, 3, 4, 4 } });
+    auto output_mem1 = engine.allocate_memory({ data_types::f32, format::bfyx, { 2, 3, 4, 4 } });
+    auto output_mem2 = engine.allocate_memory({ data_types::f32, format::bfyx, { 2, 3, 4, 4 } });
+
+    auto inputVals = generateVector(input_data->get_layout().count());
+    set_values(input_data, inputVals);
+
+    topology topology;
+    topology.add(input_layout("Input", input_data->get_layout()));
+    topology.add(reorder("reorder", input_info("Input"), input_data->get_layout()));
+
+    network network(engine, topology, get_test_default_config(engine));
+    network.set_input_data("Input", input_data);
+
+    // The kernel arguments are kept between the executions with the same output memory and set again after it's changed
+    for (const auto& output_mem : { output_mem1, output_mem1, output_mem2, output_mem1 }) {
+        set_values(output_mem, std::vector<float>(inputVals.size(), -1.f));
+        network.set_output_memory("reorder", output_mem);
+
+        auto outputs = network.execute();
+        auto output = outputs.at("reorder").get_memory();
+        ASSERT_TRUE(engine.is_the_same_buffer(*output_mem, *output));
+
+        cldnn::mem_lock<float> output_ptr(output, get_test_stream());
+        for (size_t i = 0; i < inputVals.size(); ++i) {
+            ASSERT_TRUE(are_equal(inputVals[i], output_ptr[i])) << i;
+        }
+    }
+}
+
 TEST(set_output_memory_gpu, basic_const) {
     auto& engine = get_test_engine();
 
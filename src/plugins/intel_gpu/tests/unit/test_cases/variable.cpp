@@ -236,6 +236,37 @@ TEST(variable_test_common, variables_are_preserved_across_inferences) {
     test_variables_are_preserved_across_inferences<int>(false);
 }
 
+TEST(variable_test_common, growing_state_is_preallocated) {
+    auto& engine = get_test_engine();
+
+    const layout variable_layout{data_types::f32, format::bfyx, tensor{1}};
+    const auto input_data = engine.allocate_memory(variable_layout);
+
+    topology topology;
+    topology.add(input_layout("input", input_data->get_layout()));
+    topology.add(assign{"assign", { input_info("input") }, "v0", variable_layout});
+
+    cldnn::network::ptr network = get_network(engine, topology, get_test_default_config(engine), get_test_stream_ptr(), false);
+
+    // the state grows by one row per iteration as the KV-cache does
+    auto state_layout = [](int64_t rows) {
+        return layout{ov::PartialShape{1, 2, rows, 4}, data_types::f32, format::bfyx};
+    };
+    for (int64_t rows = 1; rows <= 3; ++rows) {
+        network->update_variable_memory("v0", state_layout(rows));
+    }
+
+    // the growth is detected and the state buffer is allocated ahead of the following iterations
+    auto& variable = network->get_variable_memory("v0");
+    const auto buffer = variable.memory->buffer_ptr();
+    ASSERT_GT(variable.capacity, state_layout(3).count());
+    for (int64_t rows = 4; rows <= 8; ++rows) {
+        network->update_variable_memory("v0", state_layout(rows));
+        ASSERT_EQ(variable.memory->get_layout(), state_layout(rows));
+        ASSERT_EQ(variable.memory->buffer_ptr(), buffer);
+    }
+}
+
 #ifdef RUN_ALL_MODEL_CACHING_TESTS
 TEST_P(variable_test_i32, variable_i32_cached) {
     ASSERT_NO_FATAL_FAILURE(test(true));
@@ -0,0 +1,60 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/manager.hpp>
+#include <plugin/transformations/keep_matmul_in_fp32.hpp>
+#include <transformations/rt_info/disable_fp16_compression.hpp>
+
+using namespace testing;
+using namespace ov::intel_gpu;
+
+static bool run_and_check_fp32(const std::shared_ptr<ov::Node>& a, const std::shared_ptr<ov::Node>& b,
+                               const ov::ParameterVector& params, bool transpose_a = false) {
+    auto matmul = std::make_shared<ov::opset1::MatMul>(a, b, transpose_a, false);
+    auto model = std::make_shared<ov::Model>(ov::NodeVector{matmul}, params);
+
+    ov::pass::Manager manager;
+    manager.register_pass<KeepLargeMatMulInFP32>();
+    manager.run_passes(model);
+    return ov::fp16_compression_is_disabled(matmul);
+}
+
+TEST(TransformationTests, KeepLargeMatMulInFP32Activations) {
+    auto a = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 16, 8192});
+    auto b = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8192, 16});
+    ASSERT_TRUE(run_and_check_fp32(a, b, {a, b}));
+}
+
+TEST(TransformationTests, KeepLargeMatMulInFP32TransposedA) {
+    auto a = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8192, 16});
+    auto b = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8192, 16});
+    ASSERT_TRUE(run_and_check_fp32(a, b, {a, b}, true));
+}
+
+TEST(TransformationTests, KeepLargeMatMulInFP32SmallReduction) {
+    auto a = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8192, 64});
+    auto b = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 64, 8192});
+    ASSERT_FALSE(run_and_check_fp32(a, b, {a, b}));
+}
+
+TEST(TransformationTests, KeepLargeMatMulInFP32Weights) {
+    auto a = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 16, 8192});
+    auto weights = ov::opset1::Constant::create(ov::element::f32, ov::Shape{8192, 16}, std::vector<float>(8192 * 16, 0.1f));
+    ASSERT_FALSE(run_and_check_fp32(a, weights, {a}));
+}
+
+TEST(TransformationTests, KeepLargeMatMulInFP32Probabilities) {
+    auto scores = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8, 16, 8192});
+    auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8, 8192, 64});
+    auto softmax = std::make_shared<ov::opset8::Softmax>(scores, -1);
+    ASSERT_FALSE(run_and_check_fp32(softmax, value, {scores, value}));
+}
@@ -0,0 +1,144 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <openvino/core/model.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <intel_gpu/op/sdpa.hpp>
+#include <plugin/transformations/sdpa_fusion.hpp>
+#include <transformations/init_node_info.hpp>
+#include <transformations/utils/utils.hpp>
+
+#include "common_test_utils/ov_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_gpu;
+
+TEST_F(TransformationTestsF, ScaledDotProductAttentionFusionScaleAndMask) {
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8, -1, 64});
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8, -1, 64});
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8, -1, 64});
+        auto mask = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, -1, -1});
+        auto qk = std::make_shared<ov::opset1::MatMul>(query, key, false, true);
+        auto scaled = std::make_shared<ov::opset1::Multiply>(qk, ov::opset1::Constant::create(ov::element::f32, ov::Shape{}, {0.125f}));
+        auto masked = std::make_shared<ov::opset1::Add>(scaled, mask);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(masked, -1);
+        auto output = std::make_shared<ov::opset1::MatMul>(softmax, value);
+
+        model = std::make_shared<ov::Model>(ov::NodeVector{output}, ov::ParameterVector{query, key, value, mask});
+        manager.register_pass<ScaledDotProductAttentionFusion>();
+    }
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8, -1, 64});
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8, -1, 64});
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 8, -1, 64});
+        auto mask = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, -1, -1});
+        auto unsqueeze = std::make_shared<ov::opset1::Unsqueeze>(mask, ov::opset1::Constant::create(ov::element::i64, ov::Shape{1}, {0}));
+        auto sdpa = std::make_shared<op::ScaledDotProductAttention>(query, key, value, unsqueeze, 0.125f, false);
+
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{sdpa}, ov::ParameterVector{query, key, value, mask});
+    }
+}
+
+TEST_F(TransformationTestsF, ScaledDotProductAttentionFusionTransposedKeyAndCausalMask) {
+    std::vector<float> causal_mask(4 * 6, 0.f);
+    for (size_t l = 0; l < 4; l++) {
+        for (size_t s = l + 3; s < 6; s++)
+            causal_mask[l * 6 + s] = -std::numeric_limits<float>::infinity();
+    }
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::Shape{2, 4, 4, 32});
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::Shape{2, 4, 6, 32});
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::Shape{2, 4, 6, 16});
+        auto key_t = std::make_shared<ov::opset1::Transpose>(key, ov::opset1::Constant::create(ov::element::i64, ov::Shape{4}, {0, 1, 3, 2}));
+        auto qk = std::make_shared<ov::opset1::MatMul>(query, key_t);
+        auto scaled = std::make_shared<ov::opset1::Divide>(qk, ov::opset1::Constant::create(ov::element::f16, ov::Shape{1}, {4.f}));
+        auto masked = std::make_shared<ov::opset1::Add>(scaled, ov::opset1::Constant::create(ov::element::f16, ov::Shape{1, 1, 4, 6}, causal_mask));
+        auto softmax = std::make_shared<ov::opset1::Softmax>(masked, 3);
+        auto output = std::make_shared<ov::opset1::MatMul>(softmax, value);
+
+        model = std::make_shared<ov::Model>(ov::NodeVector{output}, ov::ParameterVector{query, key, value});
+        manager.register_pass<ScaledDotProductAttentionFusion>();
+    }
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::Shape{2, 4, 4, 32});
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::Shape{2, 4, 6, 32});
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::Shape{2, 4, 6, 16});
+        auto sdpa = std::make_shared<op::ScaledDotProductAttention>(query, key, value, 0.25f, true);
+
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{sdpa}, ov::ParameterVector{query, key, value});
+    }
+}
+
+TEST_F(TransformationTestsF, ScaledDotProductAttentionFusionNotAppliedForInnerSoftmaxAxis) {
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 2, 8, 16});
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 2, 8, 16});
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 2, 8, 16});
+        auto qk = std::make_shared<ov::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ov::opset1::Softmax>(qk, 2);
+        auto output = std::make_shared<ov::opset1::MatMul>(softmax, value);
+
+        model = std::make_shared<ov::Model>(ov::NodeVector{output}, ov::ParameterVector{query, key, value});
+        manager.register_pass<ScaledDotProductAttentionFusion>();
+    }
+}
+
+TEST_F(TransformationTestsF, ScaledDotProductAttentionFusionSharedKeyValueHeads) {
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::PartialShape{1, 8, -1, 64});
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::PartialShape{1, 1, -1, 64});
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::PartialShape{1, 1, -1, 64});
+        auto qk = std::make_shared<ov::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(qk, -1);
+        auto output = std::make_shared<ov::opset1::MatMul>(softmax, value);
+
+        model = std::make_shared<ov::Model>(ov::NodeVector{output}, ov::ParameterVector{query, key, value});
+        manager.register_pass<ScaledDotProductAttentionFusion>();
+    }
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::PartialShape{1, 8, -1, 64});
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::PartialShape{1, 1, -1, 64});
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f16, ov::PartialShape{1, 1, -1, 64});
+        auto sdpa = std::make_shared<op::ScaledDotProductAttention>(query, key, value, 1.0f, false);
+
+        model_ref = std::make_shared<ov::Model>(ov::NodeVector{sdpa}, ov::ParameterVector{query, key, value});
+    }
+}
+
+TEST_F(TransformationTestsF, ScaledDotProductAttentionFusionNotAppliedForDynamicHeads) {
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, -1, -1, 64});
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 1, -1, 64});
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::PartialShape{1, 1, -1, 64});
+        auto qk = std::make_shared<ov::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(qk, -1);
+        auto output = std::make_shared<ov::opset1::MatMul>(softmax, value);
+
+        model = std::make_shared<ov::Model>(ov::NodeVector{output}, ov::ParameterVector{query, key, value});
+        manager.register_pass<ScaledDotProductAttentionFusion>();
+    }
+}
+
+TEST_F(TransformationTestsF, ScaledDotProductAttentionFusionNotAppliedForLargeHeadSize) {
+    {
+        auto query = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 2, 8, 512});
+        auto key = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 2, 8, 512});
+        auto value = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 2, 8, 64});
+        auto qk = std::make_shared<ov::opset1::MatMul>(query, key, false, true);
+        auto softmax = std::make_shared<ov::opset8::Softmax>(qk, -1);
+        auto output = std::make_shared<ov::opset1::MatMul>(softmax, value);
+
+        model = std::make_shared<ov::Model>(ov::NodeVector{output}, ov::ParameterVector{query, key, value});
+        manager.register_pass<ScaledDotProductAttentionFusion>();
+    }
+}
@@ -385,11 +385,32 @@ ov::SoPtr<ov::IRemoteContext> ov::proxy::Plugin::create_proxy_context(
 
 std::shared_ptr<ov::ICompiledModel> ov::proxy::Plugin::compile_model(const std::shared_ptr<const ov::Model>& model,
                                                                      const ov::AnyMap& properties) const {
-    auto dev_name = get_fallback_device(get_device_from_config(properties));
+    auto dev_idx = get_device_from_config(properties);
+    auto dev_name = get_fallback_device(dev_idx);
     auto device_config = construct_device_config(dev_name, m_configs, properties);
     std::shared_ptr<const ov::IPlugin> plugin = shared_from_this();
 
-    auto device_model = get_core()->compile_model(model, dev_name, device_config);
+    ov::SoPtr<ov::ICompiledModel> device_model;
+    try {
+        device_model = get_core()->compile_model(model, dev_name, device_config);
+    } catch (const ov::Exception&) {
+        // Fail over to the hidden devices one by one. The same model is passed to each of them and the core loads
+        // the compiled model from the cache if the device compiled it before, so the next failover is fast.
+        const auto hidden_devices = get_hidden_devices().at(dev_idx);
+        if (hidden_devices.size() < 2)
+            throw;
+        for (const auto& hidden_device : hidden_devices) {
+            try {
+                device_model = get_core()->compile_model(model,
+                                                         hidden_device,
+                                                         construct_device_config(hidden_device, m_configs, properties));
+                break;
+            } catch (const ov::Exception&) {
+            }
+        }
+        if (!device_model)
+            throw;
+    }
     auto remote_context = create_proxy_context(device_model, properties);
     return std::make_shared<ov::proxy::CompiledModel>(device_model, plugin, remote_context);
 }
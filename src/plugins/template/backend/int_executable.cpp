@@ -76,6 +76,7 @@ inline void update_output_tensors(ov::TensorVector& output_values, const ngraph:
 class TemporaryOverrideOutputs {
     std::shared_ptr<ov::Model> model;
     std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, ov::PartialShape> orig_paramter_shapes_map;
+    bool shapes_changed = false;
 
 public:
     TemporaryOverrideOutputs(std::shared_ptr<ov::Model>& model,
@@ -83,13 +84,21 @@ public:
         : model(model) {
         for (const auto& param : model->get_parameters()) {
             auto output_tensor = param->output(0).get_tensor_ptr();
+            const auto& shape = tensor_map.at(output_tensor).get_shape();
             orig_paramter_shapes_map.insert({output_tensor, param->get_partial_shape()});
-            param->set_partial_shape(tensor_map.at(output_tensor).get_shape());
+            if (param->get_partial_shape() != ov::PartialShape(shape)) {
+                param->set_partial_shape(shape);
+                shapes_changed = true;
+            }
         }
-        model->validate_nodes_and_infer_types();
+        // The static model already has the shapes of the inputs, the revalidation of all nodes is skipped for it
+        if (shapes_changed)
+            model->validate_nodes_and_infer_types();
     }
 
     ~TemporaryOverrideOutputs() {
+        if (!shapes_changed)
+            return;
         for (const auto& param : model->get_parameters()) {
             auto output_tensor = param->output(0).get_tensor_ptr();
             param->set_partial_shape(orig_paramter_shapes_map.at(output_tensor));
@@ -104,6 +113,25 @@ ov::runtime::interpreter::INTExecutable::INTExecutable(const std::shared_ptr<ov:
         m_nodes.push_back(node);
     }
     set_parameters_and_results(*m_model);
+
+    // The tensors are released after their last consumer, so the memory of the intermediate tensors is reused by the
+    // next nodes instead of being held until the end of the inference
+    std::unordered_map<std::shared_ptr<ov::descriptor::Tensor>, size_t> last_use;
+    for (size_t i = 0; i < m_nodes.size(); ++i) {
+        for (const auto& input : m_nodes[i]->inputs()) {
+            last_use[input.get_tensor_ptr()] = i;
+        }
+        if (op::util::is_output(m_nodes[i]))
+            continue;
+        for (const auto& output : m_nodes[i]->outputs()) {
+            if (output.get_target_inputs().empty())
+                last_use[output.get_tensor_ptr()] = i;
+        }
+    }
+    m_tensors_to_release.resize(m_nodes.size());
+    for (const auto& it : last_use) {
+        m_tensors_to_release[it.second].push_back(it.first);
+    }
 }
 
 void ov::runtime::interpreter::INTExecutable::cancel() {
@@ -164,7 +192,8 @@ bool ov::runtime::interpreter::INTExecutable::call(std::vector<ov::Tensor>& outp
     auto overrider = TemporaryOverrideOutputs(m_model, tensor_map);
 
     // for each ordered op in the graph
-    for (const auto& op : m_nodes) {
+    for (size_t op_idx = 0; op_idx < m_nodes.size(); ++op_idx) {
+        const auto& op = m_nodes[op_idx];
         CHECK_TERMINATE()
         if (std::dynamic_pointer_cast<ov::op::v0::Parameter>(op)) {
             continue;
@@ -215,6 +244,9 @@ bool ov::runtime::interpreter::INTExecutable::call(std::vector<ov::Tensor>& outp
                 }
             }
         }
+        for (const auto& tensor : m_tensors_to_release[op_idx]) {
+            tensor_map.erase(tensor);
+        }
     }
 
     return true;
@@ -57,6 +57,8 @@ protected:
     bool m_is_compiled = false;
     std::shared_ptr<ov::Model> m_model;
     std::vector<std::shared_ptr<Node>> m_nodes;
+    // The tensors of the model which are not used after the node of the same index
+    std::vector<std::vector<std::shared_ptr<ov::descriptor::Tensor>>> m_tensors_to_release;
     std::atomic_bool m_cancel_execution{false};
     std::mutex m_mutex;
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 namespace MemoryTest {
@@ -11,6 +12,9 @@ namespace MemoryTest {
 /** Encapsulate memory measurements.
 Object of a class measures memory at start of object's life cycle.
 StatisticsWriter adds MemCounter to the memory structure.
+Besides the cumulative peak (vmhwm) the peak of the phase since the previous
+measurement is reported (vmhwm_phase), the peak is reset after every measurement
+where the system allows it (Linux), otherwise it equals the cumulative one.
 */
 
 class MemoryCounter {
@@ -22,6 +26,10 @@ public:
   MemoryCounter(const std::string &mem_counter_name);
 };
 
+/// Sets the function returning the memory allocated by the device in KB, it is
+/// called with every measurement. The empty function disables the measurement.
+void setDeviceMemoryCounter(const std::function<size_t()> &counter);
+
 #define MEMORY_SNAPSHOT(mem_counter_name) MemoryTest::MemoryCounter mem_counter_name(#mem_counter_name);
 
 } // namespace MemoryTest
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include <openvino/runtime/core.hpp>
+#include <openvino/runtime/intel_gpu/properties.hpp>
 
 #include <fstream>
 
@@ -11,6 +12,8 @@
 #include "memory_tests_helper/utils.h"
 
 
+// the inferences after the first one to measure the memory of the steady state
+constexpr size_t steadyStateIterations = 10;
 
 /**
  * @brief Function that contain executable pipeline which will be called from
@@ -36,6 +39,14 @@ int runPipeline(const std::string &model, const std::string &device,
         }
 
         ie.get_versions(device);
+        if (device.rfind("GPU", 0) == 0) {
+            MemoryTest::setDeviceMemoryCounter([&ie, &device]() {
+                size_t deviceMemory = 0;
+                for (const auto &usage : ie.get_property(device, ov::intel_gpu::memory_statistics))
+                    deviceMemory += usage.second;
+                return deviceMemory / 1024;
+            });
+        }
         MEMORY_SNAPSHOT(load_plugin);
 
         if (MemoryTest::fileExt(model) == "blob") {
@@ -72,7 +83,12 @@ int runPipeline(const std::string &model, const std::string &device,
 
         inferRequest.infer();
         MEMORY_SNAPSHOT(first_inference);
+
+        for (size_t i = 0; i < steadyStateIterations; i++)
+            inferRequest.infer();
+        MEMORY_SNAPSHOT(steady_state);
         MEMORY_SNAPSHOT(full_run);
+        MemoryTest::setDeviceMemoryCounter({});
     };
 
     try {
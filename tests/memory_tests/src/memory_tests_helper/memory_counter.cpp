@@ -3,6 +3,7 @@
 //
 
 #include "memory_tests_helper/memory_counter.h"
+#include <algorithm>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -70,6 +71,9 @@ namespace MemoryTest {
             :   -1;
         }
 
+    // the peak working set of the process can't be reset
+    bool resetVmHWM() { return false; }
+
 #else
 
     size_t getSystemDataByName(char* name) {
@@ -113,13 +117,31 @@ namespace MemoryTest {
 
     size_t getThreadsNum() { return getSystemDataByName((char *) "Threads:"); }
 
+    // resets VmHWM to the current VmRSS, available since Linux 4.0
+    bool resetVmHWM() {
+        std::ofstream clear_refs("/proc/self/clear_refs");
+        clear_refs << "5";
+        return clear_refs.good();
+    }
+
 #endif
 
 
+    static std::function<size_t()> deviceMemoryCounter;
+    static size_t totalVmHWM = 0;
+
+    void setDeviceMemoryCounter(const std::function<size_t()> &counter) {
+        deviceMemoryCounter = counter;
+    }
+
     MemoryCounter::MemoryCounter(const std::string &mem_counter_name) {
         name = mem_counter_name;
-        std::vector<size_t> memory_measurements = {getVmRSSInKB(), getVmHWMInKB(), getVmSizeInKB(),
-                                                   getVmPeakInKB(), getThreadsNum()};
+        size_t phaseVmHWM = getVmHWMInKB();
+        totalVmHWM = std::max(totalVmHWM, phaseVmHWM);
+        std::vector<size_t> memory_measurements = {getVmRSSInKB(), totalVmHWM, getVmSizeInKB(),
+                                                   getVmPeakInKB(), getThreadsNum(), phaseVmHWM,
+                                                   deviceMemoryCounter ? deviceMemoryCounter() : 0};
+        resetVmHWM();
         StatisticsWriter::Instance().addMemCounterToStructure({name, memory_measurements});
     }
 
@@ -75,7 +75,9 @@ public:
                             << SEPARATOR << "vmhwm: " << mem_structure[mem_counter][1] << '\n'
                             << SEPARATOR << "vmsize: " << mem_structure[mem_counter][2] << '\n'
                             << SEPARATOR << "vmpeak: " << mem_structure[mem_counter][3] << '\n'
-                            << SEPARATOR << "threads: " << mem_structure[mem_counter][4] << '\n';
+                            << SEPARATOR << "threads: " << mem_structure[mem_counter][4] << '\n'
+                            << SEPARATOR << "vmhwm_phase: " << mem_structure[mem_counter][5] << '\n'
+                            << SEPARATOR << "device_mem: " << mem_structure[mem_counter][6] << '\n';
         }
         statistics_file << "---" << '\n' << "measurement_unit: Kb";
     }
@@ -449,8 +449,8 @@ def prepare_tconf_with_refs(pytestconfig):
         logging.info(f"Save new test config with test results as references to {new_tconf_path}")
 
         upd_cases = []
-        steps_to_dump = {"create_exenetwork", "first_inference"}
-        vm_metrics_to_dump = {"vmhwm", "vmrss"}
+        steps_to_dump = {"read_network", "load_network", "create_exenetwork", "first_inference", "steady_state"}
+        vm_metrics_to_dump = {"vmhwm", "vmrss", "vmhwm_phase", "device_mem"}
         stat_metrics_to_dump = {"avg"}
 
         for record in pytestconfig.session_info:
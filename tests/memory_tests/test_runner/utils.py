@@ -10,6 +10,7 @@ from pymongo import MongoClient
 
 # constants
 REFS_FACTOR = 1.2  # 120%
+PHASE_REFS_FACTOR = 1.05  # 105%, the peaks of the phases are stable enough to catch smaller regressions
 TIMELINE_SIMILARITY = ('model', 'device', 'test_exe', 'os', 'cpu_info', 'target_branch')
 
 
@@ -84,7 +85,8 @@ def query_memory_timeline(records, db_url, db_name, db_collection, max_items=20,
 def compare_with_references(aggr_stats: dict, reference: dict):
     """Compare values with provided reference"""
 
-    vm_metrics_to_compare = {"vmrss", "vmhwm"}
+    vm_metrics_to_compare = {"vmrss": REFS_FACTOR, "vmhwm": REFS_FACTOR,
+                             "vmhwm_phase": PHASE_REFS_FACTOR, "device_mem": PHASE_REFS_FACTOR}
     stat_metrics_to_compare = {"avg"}
     status = 0
 
@@ -95,7 +97,8 @@ def compare_with_references(aggr_stats: dict, reference: dict):
             for stat_metric_name, reference_val in stat_metrics.items():
                 if stat_metric_name not in stat_metrics_to_compare:
                     continue
-                if aggr_stats[step_name][vm_metric][stat_metric_name] > reference_val * REFS_FACTOR:
+                if aggr_stats[step_name][vm_metric][stat_metric_name] > \
+                        reference_val * vm_metrics_to_compare[vm_metric]:
                     logging.error(f"Comparison failed for '{step_name}' step for '{vm_metric}' for"
                                   f" '{stat_metric_name}' metric. Reference: {reference_val}."
                                   f" Current values: {aggr_stats[step_name][vm_metric][stat_metric_name]}")
@@ -77,6 +77,13 @@ TEST_P(UnitTestSuite, infer_request_inference_full_pipeline) {
 }
 // tests_pipelines/tests_pipelines_full_pipeline.cpp
 
+
+// tests_pipelines/tests_pipelines_hot_reload.cpp
+TEST_P(UnitTestSuite, infer_while_reloading_models) {
+    runTest(test_infer_while_reloading_models, GetParam());
+}
+// tests_pipelines/tests_pipelines_hot_reload.cpp
+
 INSTANTIATE_TEST_SUITE_P(StressUnitTests, UnitTestSuiteNoModel,
                          ::testing::ValuesIn(generateTestsParams(
                                  {"processes", "threads", "iterations", "devices", "api_versions"})),
@@ -54,3 +54,8 @@ void test_create_infer_request_full_pipeline(const std::string &model, const std
 void test_infer_request_inference_full_pipeline(const std::string &model, const std::string &target_device,
                                                 const int &n, const int &api_version);
 // tests_pipelines/tests_pipelines_full_pipeline.cpp
+
+// tests_pipelines/tests_pipelines_hot_reload.cpp
+void test_infer_while_reloading_models(const std::string &model, const std::string &target_device, const int &n,
+                                       const int &api_version);
+// tests_pipelines/tests_pipelines_hot_reload.cpp
@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "tests_pipelines.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <dirent.h>
+#include <sys/resource.h>
+#include <unistd.h>
+
+#include <openvino/runtime/core.hpp>
+
+#include "common_utils.h"
+
+
+namespace {
+
+using Time = std::chrono::steady_clock;
+
+/// @brief Latency percentiles of the inferences and the CPU usage of the process during them
+struct ServingStats {
+    std::vector<double> latencies_ms;
+    double cpu_usage = 0;
+    long voluntary_switches = 0;
+    long involuntary_switches = 0;
+};
+
+double get_percentile(std::vector<double> values, double percentile) {
+    if (values.empty())
+        return 0;
+    std::sort(values.begin(), values.end());
+    auto index = static_cast<size_t>(percentile / 100 * (values.size() - 1));
+    return values[index];
+}
+
+double get_cpu_time_ms(const rusage &usage) {
+    return usage.ru_utime.tv_sec * 1e3 + usage.ru_utime.tv_usec / 1e3 +
+           usage.ru_stime.tv_sec * 1e3 + usage.ru_stime.tv_usec / 1e3;
+}
+
+/// @brief Infers the request until the condition is false, the CPU usage is the average number of busy cores
+template<typename Condition>
+ServingStats serve(ov::InferRequest &request, const Condition &keep_serving) {
+    ServingStats stats;
+    rusage usage_start, usage_end;
+    getrusage(RUSAGE_SELF, &usage_start);
+    auto start = Time::now();
+    while (keep_serving(stats.latencies_ms.size())) {
+        auto infer_start = Time::now();
+        request.infer();
+        stats.latencies_ms.push_back(std::chrono::duration<double, std::milli>(Time::now() - infer_start).count());
+    }
+    auto wall_time_ms = std::chrono::duration<double, std::milli>(Time::now() - start).count();
+    getrusage(RUSAGE_SELF, &usage_end);
+    stats.cpu_usage = wall_time_ms > 0 ? (get_cpu_time_ms(usage_end) - get_cpu_time_ms(usage_start)) / wall_time_ms : 0;
+    stats.voluntary_switches = usage_end.ru_nvcsw - usage_start.ru_nvcsw;
+    stats.involuntary_switches = usage_end.ru_nivcsw - usage_start.ru_nivcsw;
+    return stats;
+}
+
+void log_stats(const std::string &title, const ServingStats &stats) {
+    log_info(title << ": " << stats.latencies_ms.size() << " inferences"
+                   << ", p50 " << get_percentile(stats.latencies_ms, 50) << " ms"
+                   << ", p90 " << get_percentile(stats.latencies_ms, 90) << " ms"
+                   << ", p99 " << get_percentile(stats.latencies_ms, 99) << " ms"
+                   << ", max " << get_percentile(stats.latencies_ms, 100) << " ms"
+                   << ", CPU usage " << stats.cpu_usage << " cores"
+                   << ", context switches " << stats.voluntary_switches << " voluntary / "
+                   << stats.involuntary_switches << " involuntary");
+}
+
+void remove_directory(const std::string &path) {
+    if (DIR *dir = opendir(path.c_str())) {
+        while (dirent *entry = readdir(dir)) {
+            std::string name = entry->d_name;
+            if (name != "." && name != "..")
+                unlink(OS_PATH_JOIN({path, name}).c_str());
+        }
+        closedir(dir);
+    }
+    rmdir(path.c_str());
+}
+
+}  // namespace
+
+void test_infer_while_reloading_models(const std::string &model, const std::string &target_device, const int &n,
+                                       const int &api_version) {
+    log_info("Infer network: \"" << model << "\" for device: \"" << target_device << "\" while the network is "
+                                 << "compiled, imported from the cache and released in other thread for " << n
+                                 << " times");
+    if (api_version != 2) {
+        log_info("The test is implemented for API 2.0 only");
+        return;
+    }
+
+    ov::Core core;
+    auto serving_model = core.compile_model(model, target_device);
+    auto request = serving_model.create_infer_request();
+    auto inputs = serving_model.inputs();
+    fillTensors(request, inputs);
+    request.infer();
+
+    const size_t baseline_inferences = std::max(n, 100);
+    auto baseline = serve(request, [&](size_t done) { return done < baseline_inferences; });
+    log_stats("Serving alone", baseline);
+
+    // the models are released at the end of every iteration, the odd ones but the first are imported from the cache
+    const auto cache_dir = "stress_tests_cache_" + std::to_string(getpid()) + "_" +
+                           std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()));
+    std::atomic<bool> reloading{true};
+    std::exception_ptr reloading_exception;
+    double max_compile_ms = 0;
+    std::thread reloader([&] {
+        try {
+            ov::Core reload_core;
+            for (int i = 0; i < n; i++) {
+                auto start = Time::now();
+                ov::CompiledModel compiled_model;
+                if (i % 2 == 0) {
+                    compiled_model = reload_core.compile_model(model, target_device);
+                } else {
+                    compiled_model = reload_core.compile_model(model, target_device, ov::cache_dir(cache_dir));
+                }
+                max_compile_ms = std::max(
+                        max_compile_ms, std::chrono::duration<double, std::milli>(Time::now() - start).count());
+                auto reload_request = compiled_model.create_infer_request();
+                reload_request.infer();
+            }
+        } catch (...) {
+            reloading_exception = std::current_exception();
+        }
+        reloading = false;
+    });
+    auto reloading_stats = serve(request, [&](size_t) { return reloading.load(); });
+    reloader.join();
+    remove_directory(cache_dir);
+    if (reloading_exception)
+        std::rethrow_exception(reloading_exception);
+
+    log_stats("Serving while reloading", reloading_stats);
+    log_info("Longest compilation: " << max_compile_ms << " ms, p99 latency increase: "
+                                     << get_percentile(reloading_stats.latencies_ms, 99) /
+                                        std::max(get_percentile(baseline.latencies_ms, 99), 1e-3)
+                                     << " times");
+    // the inferences waiting for a lock held by the compilation don't complete till its end
+    if (reloading_stats.latencies_ms.size() <= 1 && max_compile_ms > get_percentile(baseline.latencies_ms, 100))
+        throw std::runtime_error("The serving network was blocked by the compilation of other networks");
+}
@@ -29,4 +29,7 @@ When destroyed, reports duration.
 
 #define SCOPED_TIMER(timer_name) TimeTest::Timer timer_name(#timer_name);
 
+/// Reports the duration (in microseconds) measured elsewhere, e.g. by the device, as a timer nested in the current one.
+    void reportTimer(const std::string &timer_name, float duration);
+
 } // namespace TimeTest
@@ -6,10 +6,14 @@
 
 #include <inference_engine.hpp>
 #include <openvino/openvino.hpp>
+#include <openvino/runtime/intel_cpu/properties.hpp>
 #include <ie_plugin_config.hpp>
 
+#include <algorithm>
 #include <string>
 
+#include "timetests_helper/timer.h"
+
 namespace TimeTest {
 /**
 * @brief Get extension from filename
@@ -51,4 +55,17 @@ void setPerformanceConfig(ov::Core ie, const std::string &device) {
     else
         ie.set_property(device, {{CONFIG_KEY(PERFORMANCE_HINT), CONFIG_VALUE(LATENCY)}});
 }
+
+/**
+ * @brief Function that reports the compilation stages measured by the device (OV API 2) as the "compile_<stage>"
+ * timers nested in the current one, the devices not measuring them are skipped
+ */
+void reportCompilationStages(const ov::CompiledModel &compiledModel) {
+    auto supported_properties = compiledModel.get_property(ov::supported_properties);
+    if (std::find(supported_properties.begin(), supported_properties.end(), ov::intel_cpu::compilation_stages) ==
+        supported_properties.end())
+        return;
+    for (const auto &stage : compiledModel.get_property(ov::intel_cpu::compilation_stages))
+        reportTimer("compile_" + stage.first, static_cast<float>(stage.second * 1000));
+}
 }
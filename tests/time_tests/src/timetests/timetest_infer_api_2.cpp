@@ -106,6 +106,7 @@ int runPipeline(const std::string &model, const std::string &device, const bool
                         SCOPED_TIMER(load_network_cache);
                         exeNetwork = ie.compile_model(model, device);
                     }
+                    TimeTest::reportCompilationStages(exeNetwork);
                 }
                 inferRequest = exeNetwork.create_infer_request();
             }
@@ -27,4 +27,9 @@ Timer::~Timer() {
     StatisticsWriter::Instance().deleteTimer({name, duration});
 }
 
+void reportTimer(const std::string &timer_name, float duration) {
+    StatisticsWriter::Instance().addTimer(timer_name);
+    StatisticsWriter::Instance().deleteTimer({timer_name, duration});
+}
+
 } // namespace TimeTest